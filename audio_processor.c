@@ -0,0 +1,475 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - Audio processor
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "filters.h"
+#include "audio_processor.h"
+#include "utils.h"
+#include <stdlib.h>		/* For malloc() / free() */
+#include <string.h>		/* For memset */
+#include <math.h>		/* For exp(), pow(), log10() */
+
+/*
+ * A basic broadcast audio processor, so that we don't need to run
+ * a chain of external compressors / limiters as separate JACK clients
+ * in front of us. It runs on the processing thread, on the (already
+ * pre-emphasized) input, before it gets matrixed, band-limited and
+ * upsampled. The audio goes through:
+ *
+ * 1) A slow wide-band AGC, that rides the gain towards agc_target
+ *    and holds it during pauses (below AP_AGC_GATE).
+ * 2) A 3-band Linkwitz-Riley crossover, with a compressor on each
+ *    band (stereo-linked), the bands are then added back together.
+ * 3) A limiter with one block of look-ahead, that keeps each channel
+ *    below limiter_ceiling.
+ *
+ * All envelope followers run once per block (block_len samples, on
+ * the block's peak or energy), and the gains get interpolated within
+ * each block, so that the per-sample work is just a multiply-add.
+ */
+
+
+/*********\
+* HELPERS *
+\*********/
+
+static inline float
+ap_db_to_gain(float db)
+{
+	return (float) pow(10.0L, (double) db / 20.0L);
+}
+
+/* One-pole coefficient for a time constant of msecs, per block */
+static inline float
+ap_block_coef(const struct audio_processor *ap, float msecs)
+{
+	if (msecs <= 0.0)
+		return 1.0;
+	return (float) (1.0L - exp(-(double) ap->block_len * 1000.0L /
+				   ((double) msecs * ap->sample_rate)));
+}
+
+static inline float
+ap_block_peak(const float *l, const float *r, uint32_t num_samples)
+{
+	float peak = 0.0;
+	float tmp = 0.0;
+	uint32_t i = 0;
+
+	for (i = 0; i < num_samples; i++) {
+		tmp = fabsf(l[i]) > fabsf(r[i]) ? fabsf(l[i]) : fabsf(r[i]);
+		peak = tmp > peak ? tmp : peak;
+	}
+
+	return peak;
+}
+
+static void
+ap_design_crossovers(struct audio_processor *ap, float low_freq,
+		     float high_freq)
+{
+	int i = 0;
+
+	for (i = 0; i < 2; i++) {
+		biquad_filter_design(&ap->low_lpf[i], BIQUAD_LPF, low_freq,
+				     M_SQRT1_2, ap->sample_rate);
+		biquad_filter_design(&ap->low_hpf[i], BIQUAD_HPF, low_freq,
+				     M_SQRT1_2, ap->sample_rate);
+		biquad_filter_design(&ap->high_lpf[i], BIQUAD_LPF, high_freq,
+				     M_SQRT1_2, ap->sample_rate);
+		biquad_filter_design(&ap->high_hpf[i], BIQUAD_HPF, high_freq,
+				     M_SQRT1_2, ap->sample_rate);
+	}
+
+	/* A 4th order LR low pass plus its high pass is a 2nd order
+	 * all-pass with the same (butterworth) poles */
+	biquad_filter_design(&ap->low_apf, BIQUAD_APF, high_freq,
+			     M_SQRT1_2, ap->sample_rate);
+
+	ap->xover_freq[0] = low_freq;
+	ap->xover_freq[1] = high_freq;
+
+	utils_dbg("[AUDIO PROC] Crossovers at %iHz / %iHz\n",
+		  (int) low_freq, (int) high_freq);
+}
+
+/* The crossover frequencies may change at any time
+ * from the control channel, re-design the filters if
+ * they are valid */
+static void
+ap_update_crossovers(struct audio_processor *ap,
+		     const struct audio_processor_control *ctl)
+{
+	float low_freq = ctl->xover_freq[0];
+	float high_freq = ctl->xover_freq[1];
+
+	if (low_freq == ap->xover_freq[0] && high_freq == ap->xover_freq[1])
+		return;
+
+	if (low_freq < 50.0 || high_freq < 2.0 * low_freq ||
+	    high_freq > 0.4 * ap->sample_rate)
+		return;
+
+	ap_design_crossovers(ap, low_freq, high_freq);
+}
+
+
+/********\
+* STAGES *
+\********/
+
+static void
+ap_agc(struct audio_processor *ap, const struct audio_processor_control *ctl,
+       float *l, float *r, uint32_t num_samples)
+{
+	const uint32_t len = ap->block_len;
+	const double coef = 1.0L - exp(-(double) len /
+				       (AP_AGC_WINDOW_SECS * ap->sample_rate));
+	const float max_step = AP_AGC_RATE_DB * (float) len / ap->sample_rate;
+	double energy = 0.0L;
+	float level = 0.0;
+	float target = 0.0;
+	float delta = 0.0;
+	float gain = 0.0;
+	float step = 0.0;
+	uint32_t b = 0;
+	uint32_t i = 0;
+
+	for (b = 0; b < num_samples; b += len) {
+		energy = 0.0L;
+		for (i = b; i < b + len; i++)
+			energy += l[i] * l[i] + r[i] * r[i];
+		ap->agc_power += (energy / (2.0L * len) - ap->agc_power) * coef;
+
+		/* Move towards the target level, unless it's too quiet */
+		level = (float) (10.0L * log10(ap->agc_power + 1e-12));
+		if (level > AP_AGC_GATE) {
+			target = ctl->agc_target - level;
+			target = fminf(target, ctl->agc_max_gain);
+			target = fmaxf(target, -ctl->agc_max_gain);
+			delta = fminf(target - ap->agc_gain_db, max_step);
+			delta = fmaxf(delta, -max_step);
+			ap->agc_gain_db += delta;
+		}
+
+		gain = ap_db_to_gain(ap->agc_gain_db);
+		step = (gain - ap->agc_gain) / (float) len;
+		for (i = 0; i < len; i++) {
+			l[b + i] *= ap->agc_gain + step * (float) (i + 1);
+			r[b + i] *= ap->agc_gain + step * (float) (i + 1);
+		}
+		ap->agc_gain = gain;
+	}
+}
+
+/* Split the audio into the low / mid / high bands */
+static void
+ap_split(struct audio_processor *ap, const float *l, const float *r,
+	 uint32_t num_samples)
+{
+	struct audio_processor_band *low = &ap->band[0];
+	struct audio_processor_band *mid = &ap->band[1];
+	struct audio_processor_band *high = &ap->band[2];
+	int i = 0;
+
+	biquad_filter_apply(&ap->low_lpf[0], l, r, low->buf_l, low->buf_r,
+			    num_samples);
+	biquad_filter_apply(&ap->low_lpf[1], low->buf_l, low->buf_r,
+			    low->buf_l, low->buf_r, num_samples);
+	biquad_filter_apply(&ap->low_apf, low->buf_l, low->buf_r,
+			    low->buf_l, low->buf_r, num_samples);
+
+	/* Everything above the low band goes to mid, and
+	 * then the high band gets split from there */
+	biquad_filter_apply(&ap->low_hpf[0], l, r, mid->buf_l, mid->buf_r,
+			    num_samples);
+	biquad_filter_apply(&ap->low_hpf[1], mid->buf_l, mid->buf_r,
+			    mid->buf_l, mid->buf_r, num_samples);
+
+	biquad_filter_apply(&ap->high_hpf[0], mid->buf_l, mid->buf_r,
+			    high->buf_l, high->buf_r, num_samples);
+	for (i = 0; i < 2; i++) {
+		biquad_filter_apply(&ap->high_lpf[i], mid->buf_l, mid->buf_r,
+				    mid->buf_l, mid->buf_r, num_samples);
+	}
+	biquad_filter_apply(&ap->high_hpf[1], high->buf_l, high->buf_r,
+			    high->buf_l, high->buf_r, num_samples);
+}
+
+/* Compress each band and add them back together on l / r */
+static void
+ap_compress(struct audio_processor *ap,
+	    const struct audio_processor_control *ctl,
+	    float *l, float *r, uint32_t num_samples)
+{
+	const struct audio_processor_band_control *bctl = NULL;
+	struct audio_processor_band *band = NULL;
+	const uint32_t len = ap->block_len;
+	float attack[AP_NUM_BANDS] = {0};
+	float release[AP_NUM_BANDS] = {0};
+	float start[AP_NUM_BANDS] = {0};
+	float step[AP_NUM_BANDS] = {0};
+	float peak = 0.0;
+	float over = 0.0;
+	float ratio = 0.0;
+	float gr = 0.0;
+	float gain = 0.0;
+	uint32_t b = 0;
+	uint32_t i = 0;
+	int k = 0;
+
+	for (k = 0; k < AP_NUM_BANDS; k++) {
+		attack[k] = ap_block_coef(ap, ctl->band[k].attack);
+		release[k] = ap_block_coef(ap, ctl->band[k].release);
+		ap->band[k].gain_reduction = 0.0;
+	}
+
+	for (b = 0; b < num_samples; b += len) {
+		for (k = 0; k < AP_NUM_BANDS; k++) {
+			band = &ap->band[k];
+			bctl = &ctl->band[k];
+
+			/* Envelope follower */
+			peak = ap_block_peak(band->buf_l + b,
+					     band->buf_r + b, len);
+			if (peak > band->env)
+				band->env += (peak - band->env) * attack[k];
+			else
+				band->env += (peak - band->env) * release[k];
+
+			/* Gain computer */
+			ratio = bctl->ratio > 1.0 ? bctl->ratio : 1.0;
+			over = (float) (20.0L * log10(band->env + 1e-9)) -
+			       bctl->threshold;
+			gr = over > 0.0 ? over * (1.0 - 1.0 / ratio) : 0.0;
+			band->gain_reduction = fmaxf(band->gain_reduction, gr);
+
+			gain = ap_db_to_gain(bctl->makeup_gain - gr);
+			start[k] = band->gain;
+			step[k] = (gain - band->gain) / (float) len;
+			band->gain = gain;
+		}
+
+		for (i = 0; i < len; i++) {
+			l[b + i] = 0.0;
+			r[b + i] = 0.0;
+			for (k = 0; k < AP_NUM_BANDS; k++) {
+				gain = start[k] + step[k] * (float) (i + 1);
+				l[b + i] += ap->band[k].buf_l[b + i] * gain;
+				r[b + i] += ap->band[k].buf_r[b + i] * gain;
+			}
+		}
+	}
+}
+
+/*
+ * The limiter delays the audio by one block, so when a block comes
+ * out we already know the peak of the next one. The gain at the end
+ * of each block is at most what both of them need, so it's already
+ * there when the next block comes out, and since it moves linearly
+ * within a block, it never exceeds what the current block needs.
+ */
+static void
+ap_limit(struct audio_processor *ap, const struct audio_processor_control *ctl,
+	 float *l, float *r, uint32_t num_samples)
+{
+	const uint32_t len = ap->block_len;
+	const float ceiling = ap_db_to_gain(ctl->limiter_ceiling);
+	float min_gain = 1.0;
+	float need = 0.0;
+	float peak = 0.0;
+	float target = 0.0;
+	float start = 0.0;
+	float gain = 0.0;
+	float step = 0.0;
+	float tmp = 0.0;
+	uint32_t b = 0;
+	uint32_t i = 0;
+
+	for (b = 0; b < num_samples; b += len) {
+		peak = ap_block_peak(l + b, r + b, len);
+		need = peak > ceiling ? ceiling / peak : 1.0;
+		target = fminf(need, ap->limiter_need);
+		ap->limiter_need = need;
+
+		start = ap->limiter_gain;
+		if (target < start)
+			ap->limiter_gain = target;
+		else
+			ap->limiter_gain += (target - start) *
+					    ap->limiter_release;
+		step = (ap->limiter_gain - start) / (float) len;
+		min_gain = fminf(min_gain, fminf(start, ap->limiter_gain));
+
+		for (i = 0; i < len; i++) {
+			gain = start + step * (float) (i + 1);
+			tmp = l[b + i];
+			l[b + i] = ap->delay_l[i] * gain;
+			ap->delay_l[i] = tmp;
+			tmp = r[b + i];
+			r[b + i] = ap->delay_r[i] * gain;
+			ap->delay_r[i] = tmp;
+		}
+	}
+
+	ap->limiter_gain_reduction = (float) (-20.0L * log10(min_gain));
+}
+
+
+/**************\
+* ENTRY POINTS *
+\**************/
+
+void
+audio_processor_run(struct audio_processor *ap,
+		    const struct audio_processor_control *ctl,
+		    float *l, float *r, uint32_t num_samples)
+{
+	if (num_samples != ap->period_size)
+		return;
+
+	ap_update_crossovers(ap, ctl);
+
+	ap_agc(ap, ctl, l, r, num_samples);
+	ap_split(ap, l, r, num_samples);
+	ap_compress(ap, ctl, l, r, num_samples);
+	ap_limit(ap, ctl, l, r, num_samples);
+}
+
+void
+audio_processor_reset(struct audio_processor *ap)
+{
+	int i = 0;
+
+	for (i = 0; i < 2; i++) {
+		biquad_filter_reset(&ap->low_lpf[i]);
+		biquad_filter_reset(&ap->low_hpf[i]);
+		biquad_filter_reset(&ap->high_lpf[i]);
+		biquad_filter_reset(&ap->high_hpf[i]);
+	}
+	biquad_filter_reset(&ap->low_apf);
+
+	for (i = 0; i < AP_NUM_BANDS; i++) {
+		ap->band[i].env = 0.0;
+		ap->band[i].gain = 1.0;
+		ap->band[i].gain_reduction = 0.0;
+	}
+
+	ap->agc_power = 0.0L;
+	ap->agc_gain_db = 0.0;
+	ap->agc_gain = 1.0;
+
+	memset(ap->delay_l, 0, ap->block_len * sizeof(float));
+	memset(ap->delay_r, 0, ap->block_len * sizeof(float));
+	ap->limiter_need = 1.0;
+	ap->limiter_gain = 1.0;
+	ap->limiter_gain_reduction = 0.0;
+}
+
+void
+audio_processor_init_control(struct audio_processor_control *ctl)
+{
+	/* Low bands are slower, so that we don't
+	 * modulate the waveform itself */
+	const float attack[AP_NUM_BANDS] = {20.0, 10.0, 3.0};
+	const float release[AP_NUM_BANDS] = {250.0, 150.0, 80.0};
+	int i = 0;
+
+	memset(ctl, 0, sizeof(struct audio_processor_control));
+	ctl->agc_target = AP_AGC_TARGET;
+	ctl->agc_max_gain = AP_AGC_MAX_GAIN;
+	ctl->xover_freq[0] = AP_XOVER_LOW_FREQ;
+	ctl->xover_freq[1] = AP_XOVER_HIGH_FREQ;
+	for (i = 0; i < AP_NUM_BANDS; i++) {
+		ctl->band[i].threshold = AP_COMP_THRESHOLD;
+		ctl->band[i].ratio = AP_COMP_RATIO;
+		ctl->band[i].attack = attack[i];
+		ctl->band[i].release = release[i];
+		ctl->band[i].makeup_gain = AP_COMP_MAKEUP;
+	}
+	ctl->limiter_ceiling = AP_LIMITER_CEILING;
+}
+
+void
+audio_processor_destroy(const struct audio_processor *ap)
+{
+	int i = 0;
+
+	for (i = 0; i < AP_NUM_BANDS; i++) {
+		if (ap->band[i].buf_l)
+			free(ap->band[i].buf_l);
+		if (ap->band[i].buf_r)
+			free(ap->band[i].buf_r);
+	}
+	if (ap->delay_l)
+		free(ap->delay_l);
+	if (ap->delay_r)
+		free(ap->delay_r);
+}
+
+int
+audio_processor_init(struct audio_processor *ap, uint32_t sample_rate,
+		     uint32_t period_size)
+{
+	uint32_t buf_len = 0;
+	int ret = 0;
+	int i = 0;
+
+	if (!sample_rate || !period_size)
+		return -1;
+
+	memset(ap, 0, sizeof(struct audio_processor));
+	ap->sample_rate = (float) sample_rate;
+	ap->period_size = period_size;
+
+	/* Blocks need to fit evenly within a period */
+	ap->block_len = AP_BLOCK_SAMPLES;
+	while (period_size % ap->block_len)
+		ap->block_len >>= 1;
+
+	buf_len = period_size * sizeof(float);
+	for (i = 0; i < AP_NUM_BANDS; i++) {
+		ap->band[i].buf_l = (float *) malloc(buf_len);
+		ap->band[i].buf_r = (float *) malloc(buf_len);
+		if (!ap->band[i].buf_l || !ap->band[i].buf_r) {
+			ret = -2;
+			goto cleanup;
+		}
+	}
+
+	ap->delay_l = (float *) malloc(ap->block_len * sizeof(float));
+	ap->delay_r = (float *) malloc(ap->block_len * sizeof(float));
+	if (!ap->delay_l || !ap->delay_r) {
+		ret = -2;
+		goto cleanup;
+	}
+
+	ap->limiter_release = ap_block_coef(ap, AP_LIMITER_RELEASE_MSECS);
+	ap_design_crossovers(ap, AP_XOVER_LOW_FREQ, AP_XOVER_HIGH_FREQ);
+	audio_processor_reset(ap);
+
+ cleanup:
+	if (ret < 0) {
+		audio_processor_destroy(ap);
+		utils_err("[AUDIO PROC] Init failed with code: %i\n", ret);
+	} else
+		utils_dbg("[AUDIO PROC] Init complete (%i samples per block)\n",
+			  ap->block_len);
+
+	return ret;
+}
@@ -0,0 +1,120 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - Audio processor
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>		/* For typed integers */
+
+/* Note: Expects filters.h to be included first (for the biquads) */
+
+/* Low / Mid / High */
+#define AP_NUM_BANDS		3
+
+/* The envelope followers run once per block of (up to) that
+ * many samples, the gains get interpolated within each block.
+ * The final limiter also delays the audio by one block. */
+#define AP_BLOCK_SAMPLES	32
+
+/* Defaults, levels are in dBFS and gains in dB */
+#define AP_AGC_TARGET		-18.0
+#define AP_AGC_MAX_GAIN		12.0
+/* Below that the AGC holds its gain (silence / pauses) */
+#define AP_AGC_GATE		-45.0
+/* Window of the AGC's level detector and how fast it
+ * may move its gain (in dB per second) */
+#define AP_AGC_WINDOW_SECS	3.0
+#define AP_AGC_RATE_DB		2.0
+
+#define AP_XOVER_LOW_FREQ	200.0
+#define AP_XOVER_HIGH_FREQ	3000.0
+
+#define AP_COMP_THRESHOLD	-20.0
+#define AP_COMP_RATIO		3.0
+#define AP_COMP_MAKEUP		4.0
+
+#define AP_LIMITER_CEILING	-1.0
+#define AP_LIMITER_RELEASE_MSECS	50.0
+
+/* Settings / status of each band's compressor,
+ * attack and release are in msecs */
+struct audio_processor_band_control {
+	float threshold;
+	float ratio;
+	float attack;
+	float release;
+	float makeup_gain;
+	float gain_reduction;
+};
+
+/* Exposed through fmmod's control channel */
+struct audio_processor_control {
+	int enabled;
+	float agc_target;
+	float agc_max_gain;
+	/* Crossover frequencies (Hz), low / mid and mid / high */
+	float xover_freq[AP_NUM_BANDS - 1];
+	struct audio_processor_band_control band[AP_NUM_BANDS];
+	float limiter_ceiling;
+	/* Status */
+	float agc_gain;
+	float limiter_gain_reduction;
+};
+
+struct audio_processor_band {
+	float *buf_l;
+	float *buf_r;
+	float env;
+	float gain;
+	/* Largest one within the last period, in dB */
+	float gain_reduction;
+};
+
+struct audio_processor {
+	float sample_rate;
+	uint32_t period_size;
+	uint32_t block_len;
+	/* AGC */
+	double agc_power;
+	float agc_gain_db;
+	float agc_gain;
+	/* Linkwitz-Riley (4th order) crossovers, each one is two
+	 * Butterworth biquads in series. The low band also goes
+	 * through an all-pass, to match the mid / high crossover's
+	 * phase response, so that the bands add up flat */
+	float xover_freq[AP_NUM_BANDS - 1];
+	struct biquad_filter_data low_lpf[2];
+	struct biquad_filter_data low_hpf[2];
+	struct biquad_filter_data high_lpf[2];
+	struct biquad_filter_data high_hpf[2];
+	struct biquad_filter_data low_apf;
+	struct audio_processor_band band[AP_NUM_BANDS];
+	/* Final limiter */
+	float *delay_l;
+	float *delay_r;
+	float limiter_need;
+	float limiter_gain;
+	float limiter_release;
+	float limiter_gain_reduction;
+};
+
+int audio_processor_init(struct audio_processor *, uint32_t, uint32_t);
+void audio_processor_destroy(const struct audio_processor *);
+void audio_processor_init_control(struct audio_processor_control *);
+void audio_processor_reset(struct audio_processor *);
+void audio_processor_run(struct audio_processor *,
+			 const struct audio_processor_control *,
+			 float *, float *, uint32_t);
@@ -0,0 +1,815 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - FFT helpers
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "fft.h"
+#include "utils.h"
+#include <stdlib.h>		/* For getenv() */
+#include <stdio.h>		/* For snprintf(), rename() */
+#include <unistd.h>		/* For getpid(), unlink() */
+#include <sys/stat.h>		/* For mkdir() */
+#include <errno.h>		/* For errno and EEXIST */
+#include <string.h>		/* For strcmp(), memset() */
+#include <math.h>		/* For sin(), cos() */
+#include <time.h>		/* For clock_gettime() */
+
+/*************\
+* FFTW WISDOM *
+\*************/
+
+/*
+ * Get the path of the wisdom file and make sure its
+ * parent directory exists (unless it was provided by
+ * the user).
+ */
+int
+fft_wisdom_get_path(char *path, size_t len)
+{
+	const char *env_path = NULL;
+	const char *cache_dir = NULL;
+	const char *home_dir = NULL;
+	char dir[FFT_WISDOM_PATH_LEN] = { 0 };
+	int ret = 0;
+
+	env_path = getenv(FFT_WISDOM_ENV);
+	if (env_path && env_path[0] != '\0') {
+		ret = snprintf(path, len, "%s", env_path);
+		return (ret < 0 || (size_t) ret >= len) ? -1 : 0;
+	}
+
+	cache_dir = getenv("XDG_CACHE_HOME");
+	if (cache_dir && cache_dir[0] != '\0')
+		ret = snprintf(dir, FFT_WISDOM_PATH_LEN, "%s/%s",
+			       cache_dir, FFT_WISDOM_DIR);
+	else {
+		home_dir = getenv("HOME");
+		if (!home_dir || home_dir[0] == '\0')
+			return -2;
+		/* Create ~/.cache if it's not there */
+		ret = snprintf(dir, FFT_WISDOM_PATH_LEN, "%s/.cache",
+			       home_dir);
+		if (ret < 0 || ret >= FFT_WISDOM_PATH_LEN)
+			return -1;
+		if (mkdir(dir, 0700) < 0 && errno != EEXIST)
+			return -3;
+		ret = snprintf(dir, FFT_WISDOM_PATH_LEN, "%s/.cache/%s",
+			       home_dir, FFT_WISDOM_DIR);
+	}
+	if (ret < 0 || ret >= FFT_WISDOM_PATH_LEN)
+		return -1;
+
+	if (mkdir(dir, 0700) < 0 && errno != EEXIST)
+		return -3;
+
+	ret = snprintf(path, len, "%s/%s", dir, FFT_WISDOM_FILE);
+	return (ret < 0 || (size_t) ret >= len) ? -1 : 0;
+}
+
+/*
+ * Load any previously stored wisdom, call this before
+ * creating any plans. A missing file is not an error,
+ * we'll just have to measure everything this time.
+ */
+int
+fft_wisdom_import(void)
+{
+	char path[FFT_WISDOM_PATH_LEN] = { 0 };
+	int ret = 0;
+
+	ret = fft_wisdom_get_path(path, FFT_WISDOM_PATH_LEN);
+	if (ret < 0) {
+		utils_wrn("[FFT] Unable to determine wisdom file path\n");
+		return ret;
+	}
+
+	if (!fftwf_import_wisdom_from_filename(path)) {
+		utils_dbg("[FFT] No usable wisdom on %s\n", path);
+		return 0;
+	}
+
+	utils_dbg("[FFT] Imported wisdom from %s\n", path);
+	return 1;
+}
+
+/*
+ * Store the accumulated wisdom (imported + newly measured
+ * plans). We write to a temporary file and rename it, so that
+ * the generator and the GUI can't corrupt each other's output
+ * if they happen to write at the same time.
+ */
+int
+fft_wisdom_export(void)
+{
+	char path[FFT_WISDOM_PATH_LEN] = { 0 };
+	char tmp_path[FFT_WISDOM_PATH_LEN + 16] = { 0 };
+	int ret = 0;
+
+	ret = fft_wisdom_get_path(path, FFT_WISDOM_PATH_LEN);
+	if (ret < 0) {
+		utils_wrn("[FFT] Unable to determine wisdom file path\n");
+		return ret;
+	}
+
+	snprintf(tmp_path, FFT_WISDOM_PATH_LEN + 16, "%s.%u", path,
+		 (unsigned int) getpid());
+
+	if (!fftwf_export_wisdom_to_filename(tmp_path)) {
+		utils_wrn("[FFT] Unable to store wisdom on %s\n", tmp_path);
+		unlink(tmp_path);
+		return -4;
+	}
+
+	if (rename(tmp_path, path) < 0) {
+		utils_perr("[FFT] Unable to store wisdom, rename()");
+		unlink(tmp_path);
+		return -5;
+	}
+
+	utils_dbg("[FFT] Exported wisdom to %s\n", path);
+	return 0;
+}
+
+
+/************\
+* FAST START *
+\************/
+
+int
+fft_fast_start_enabled(void)
+{
+	const char *env = getenv(FFT_FAST_START_ENV);
+
+	if (!env || env[0] == '\0')
+		return 0;
+
+	return (atoi(env) > 0);
+}
+
+
+/**************\
+* BUILT-IN FFT *
+\**************/
+
+/*
+ * A simple fallback for when FFTW is slow on the target. It's an
+ * iterative radix-2 complex FFT, with Bluestein's algorithm (chirp-z
+ * transform) for sizes that are not a power of two, which turns the
+ * DFT into a convolution that can be done through power of two FFTs.
+ * Real transforms of even sizes are done through a complex transform
+ * of half the size, by packing even/odd samples as real/imaginary parts
+ * and separating their spectra afterwards.
+ *
+ * For more information check out:
+ * https://en.wikipedia.org/wiki/Chirp_Z-transform#Bluestein.27s_algorithm
+ * http://www.robinscheibler.org/2013/02/13/real-fft.html
+ */
+
+struct fft_cfft {
+	uint32_t size;
+	uint32_t *bitrev;
+	fft_complex *twiddles;
+	/* For Bluestein's algorithm */
+	struct fft_cfft *pow2;
+	fft_complex *chirp;
+	fft_complex *chirp_fft;
+	fft_complex *work;
+};
+
+static inline int
+fft_is_pow2(uint32_t num)
+{
+	return num && !(num & (num - 1));
+}
+
+static void
+fft_cfft_destroy(struct fft_cfft *cfft)
+{
+	if (!cfft)
+		return;
+	free(cfft->bitrev);
+	fft_free(cfft->twiddles);
+	fft_cfft_destroy(cfft->pow2);
+	fft_free(cfft->chirp);
+	fft_free(cfft->chirp_fft);
+	fft_free(cfft->work);
+	free(cfft);
+}
+
+/* In-place radix-2 forward transform, data must
+ * already be in bit-reversed order */
+static void
+fft_cfft_pow2_run(const struct fft_cfft *cfft, fft_complex *data)
+{
+	const fft_complex *tw = NULL;
+	float u[2] = {0};
+	float v[2] = {0};
+	uint32_t len = 0;
+	uint32_t half = 0;
+	uint32_t step = 0;
+	uint32_t i = 0;
+	uint32_t j = 0;
+
+	for (len = 2; len <= cfft->size; len <<= 1) {
+		half = len >> 1;
+		step = cfft->size / len;
+		for (i = 0; i < cfft->size; i += len) {
+			for (j = 0; j < half; j++) {
+				tw = &cfft->twiddles[j * step];
+				u[0] = data[i + j][0];
+				u[1] = data[i + j][1];
+				v[0] = data[i + j + half][0] * (*tw)[0] -
+				       data[i + j + half][1] * (*tw)[1];
+				v[1] = data[i + j + half][0] * (*tw)[1] +
+				       data[i + j + half][1] * (*tw)[0];
+				data[i + j][0] = u[0] + v[0];
+				data[i + j][1] = u[1] + v[1];
+				data[i + j + half][0] = u[0] - v[0];
+				data[i + j + half][1] = u[1] - v[1];
+			}
+		}
+	}
+}
+
+/* Out of place forward transform (in != out) */
+static void
+fft_cfft_forward(const struct fft_cfft *cfft, const fft_complex *in,
+		 fft_complex *out)
+{
+	fft_complex *work = cfft->work;
+	float tmp[2] = {0};
+	uint32_t work_size = 0;
+	uint32_t i = 0;
+
+	if (cfft->bitrev) {
+		for (i = 0; i < cfft->size; i++) {
+			out[cfft->bitrev[i]][0] = in[i][0];
+			out[cfft->bitrev[i]][1] = in[i][1];
+		}
+		fft_cfft_pow2_run(cfft, out);
+		return;
+	}
+
+	/* Bluestein: a[n] = x[n] * conj(chirp[n]), convolve it with
+	 * chirp (through the FFT), and multiply with conj(chirp[k]) */
+	work_size = cfft->pow2->size;
+	memset(work, 0, work_size * sizeof(fft_complex));
+	for (i = 0; i < cfft->size; i++) {
+		work[cfft->pow2->bitrev[i]][0] = in[i][0] * cfft->chirp[i][0] +
+						 in[i][1] * cfft->chirp[i][1];
+		work[cfft->pow2->bitrev[i]][1] = in[i][1] * cfft->chirp[i][0] -
+						 in[i][0] * cfft->chirp[i][1];
+	}
+	fft_cfft_pow2_run(cfft->pow2, work);
+
+	/* Multiply with the chirp's spectrum, and get the inverse
+	 * transform through the forward one, as conj(FFT(conj(X))),
+	 * the output is then conjugated and normalized bellow */
+	for (i = 0; i < work_size; i++) {
+		tmp[0] = work[i][0] * cfft->chirp_fft[i][0] -
+			 work[i][1] * cfft->chirp_fft[i][1];
+		tmp[1] = work[i][0] * cfft->chirp_fft[i][1] +
+			 work[i][1] * cfft->chirp_fft[i][0];
+		work[i][0] = tmp[0];
+		work[i][1] = -tmp[1];
+	}
+
+	/* Bit-reverse in place (swap pairs once) */
+	for (i = 0; i < work_size; i++) {
+		if (cfft->pow2->bitrev[i] > i) {
+			tmp[0] = work[i][0];
+			tmp[1] = work[i][1];
+			work[i][0] = work[cfft->pow2->bitrev[i]][0];
+			work[i][1] = work[cfft->pow2->bitrev[i]][1];
+			work[cfft->pow2->bitrev[i]][0] = tmp[0];
+			work[cfft->pow2->bitrev[i]][1] = tmp[1];
+		}
+	}
+	fft_cfft_pow2_run(cfft->pow2, work);
+
+	for (i = 0; i < cfft->size; i++) {
+		tmp[0] = work[i][0] / (float) work_size;
+		tmp[1] = -work[i][1] / (float) work_size;
+		out[i][0] = tmp[0] * cfft->chirp[i][0] +
+			    tmp[1] * cfft->chirp[i][1];
+		out[i][1] = tmp[1] * cfft->chirp[i][0] -
+			    tmp[0] * cfft->chirp[i][1];
+	}
+}
+
+static struct fft_cfft*
+fft_cfft_create(uint32_t size)
+{
+	struct fft_cfft *cfft = NULL;
+	uint32_t pow2_size = 1;
+	uint32_t log2_size = 0;
+	uint32_t i = 0;
+	uint32_t j = 0;
+	uint64_t sq = 0;
+	double angle = 0;
+
+	cfft = (struct fft_cfft *) malloc(sizeof(struct fft_cfft));
+	if (!cfft)
+		return NULL;
+	memset(cfft, 0, sizeof(struct fft_cfft));
+	cfft->size = size;
+
+	if (fft_is_pow2(size)) {
+		while ((1U << log2_size) < size)
+			log2_size++;
+
+		cfft->bitrev = (uint32_t *) malloc(size * sizeof(uint32_t));
+		cfft->twiddles = fft_alloc_complex(size / 2 + 1);
+		if (!cfft->bitrev || !cfft->twiddles)
+			goto cleanup;
+
+		for (i = 0; i < size; i++) {
+			cfft->bitrev[i] = 0;
+			for (j = 0; j < log2_size; j++)
+				if (i & (1U << j))
+					cfft->bitrev[i] |= 1U << (log2_size - 1 - j);
+		}
+
+		for (i = 0; i < size / 2 + 1; i++) {
+			angle = -2.0L * M_PI * (double) i / (double) size;
+			cfft->twiddles[i][0] = (float) cos(angle);
+			cfft->twiddles[i][1] = (float) sin(angle);
+		}
+
+		return cfft;
+	}
+
+	/* Bluestein, we need a power of two transform
+	 * that can hold a linear convolution of size * 2 - 1 */
+	while (pow2_size < 2 * size - 1)
+		pow2_size <<= 1;
+
+	cfft->pow2 = fft_cfft_create(pow2_size);
+	cfft->chirp = fft_alloc_complex(size);
+	cfft->chirp_fft = fft_alloc_complex(pow2_size);
+	cfft->work = fft_alloc_complex(pow2_size);
+	if (!cfft->pow2 || !cfft->chirp || !cfft->chirp_fft || !cfft->work)
+		goto cleanup;
+
+	/* chirp[n] = exp(i * pi * n^2 / size), keep n^2 modulo
+	 * 2 * size to avoid losing precision on large n */
+	for (i = 0; i < size; i++) {
+		sq = ((uint64_t) i * (uint64_t) i) % (2 * (uint64_t) size);
+		angle = M_PI * (double) sq / (double) size;
+		cfft->chirp[i][0] = (float) cos(angle);
+		cfft->chirp[i][1] = (float) sin(angle);
+	}
+
+	/* The chirp's spectrum, for both positive and negative n */
+	memset(cfft->work, 0, pow2_size * sizeof(fft_complex));
+	for (i = 0; i < size; i++) {
+		cfft->work[i][0] = cfft->chirp[i][0];
+		cfft->work[i][1] = cfft->chirp[i][1];
+		if (i) {
+			cfft->work[pow2_size - i][0] = cfft->chirp[i][0];
+			cfft->work[pow2_size - i][1] = cfft->chirp[i][1];
+		}
+	}
+	fft_cfft_forward(cfft->pow2, cfft->work, cfft->chirp_fft);
+
+	return cfft;
+
+ cleanup:
+	fft_cfft_destroy(cfft);
+	return NULL;
+}
+
+
+/********************\
+* PLANS AND BACKENDS *
+\********************/
+
+struct fft_plan {
+	enum fft_backend backend;
+	int inverse;
+	uint32_t size;
+	uint32_t howmany;
+	uint32_t num_bins;
+	/* FFTW */
+	fftwf_plan fftw_plan;
+	/* Built-in */
+	struct fft_cfft *cfft;
+	fft_complex *twiddles;
+	fft_complex *work_in;
+	fft_complex *work_out;
+};
+
+float*
+fft_alloc_real(size_t num)
+{
+	return fftwf_alloc_real(num);
+}
+
+fft_complex*
+fft_alloc_complex(size_t num)
+{
+	return (fft_complex *) fftwf_alloc_complex(num);
+}
+
+void
+fft_free(void *ptr)
+{
+	if (ptr)
+		fftwf_free(ptr);
+}
+
+static enum fft_backend
+fft_get_backend(void)
+{
+	const char *env = getenv(FFT_BACKEND_ENV);
+
+	if (!env || env[0] == '\0')
+		return FFT_BACKEND_AUTO;
+	if (!strcmp(env, "fftw"))
+		return FFT_BACKEND_FFTW;
+	if (!strcmp(env, "builtin"))
+		return FFT_BACKEND_BUILTIN;
+	return FFT_BACKEND_AUTO;
+}
+
+void
+fft_destroy_plan(struct fft_plan *plan)
+{
+	if (!plan)
+		return;
+	if (plan->fftw_plan)
+		fftwf_destroy_plan(plan->fftw_plan);
+	fft_cfft_destroy(plan->cfft);
+	fft_free(plan->twiddles);
+	fft_free(plan->work_in);
+	fft_free(plan->work_out);
+	free(plan);
+}
+
+static struct fft_plan*
+fft_plan_alloc(enum fft_backend backend, uint32_t size, uint32_t howmany,
+	       int inverse)
+{
+	struct fft_plan *plan = NULL;
+
+	plan = (struct fft_plan *) malloc(sizeof(struct fft_plan));
+	if (!plan)
+		return NULL;
+	memset(plan, 0, sizeof(struct fft_plan));
+
+	plan->backend = backend;
+	plan->inverse = inverse;
+	plan->size = size;
+	plan->howmany = howmany;
+	plan->num_bins = size / 2 + 1;
+
+	return plan;
+}
+
+static struct fft_plan*
+fft_plan_create_fftw(uint32_t size, uint32_t howmany, int inverse,
+		     float *real, fft_complex *cplx, enum fft_plan_mode mode)
+{
+	struct fft_plan *plan = NULL;
+	unsigned int flags = 0;
+	int n = (int) size;
+
+	plan = fft_plan_alloc(FFT_BACKEND_FFTW, size, howmany, inverse);
+	if (!plan)
+		return NULL;
+
+	switch (mode) {
+	case FFT_PLAN_ESTIMATE:
+		flags = FFTW_ESTIMATE;
+		break;
+	case FFT_PLAN_WISDOM_ONLY:
+		flags = FFTW_MEASURE | FFTW_WISDOM_ONLY;
+		break;
+	case FFT_PLAN_MEASURE:
+	default:
+		flags = FFTW_MEASURE;
+		break;
+	}
+
+	if (inverse)
+		plan->fftw_plan = fftwf_plan_many_dft_c2r(1, &n, howmany,
+							  (fftwf_complex *) cplx,
+							  NULL, 1, plan->num_bins,
+							  real, NULL, 1, size,
+							  flags);
+	else
+		plan->fftw_plan = fftwf_plan_many_dft_r2c(1, &n, howmany,
+							  real, NULL, 1, size,
+							  (fftwf_complex *) cplx,
+							  NULL, 1, plan->num_bins,
+							  flags);
+	if (!plan->fftw_plan) {
+		fft_destroy_plan(plan);
+		return NULL;
+	}
+
+	return plan;
+}
+
+static struct fft_plan*
+fft_plan_create_builtin(uint32_t size, uint32_t howmany, int inverse)
+{
+	struct fft_plan *plan = NULL;
+	uint32_t cfft_size = 0;
+	double angle = 0;
+	uint32_t i = 0;
+
+	plan = fft_plan_alloc(FFT_BACKEND_BUILTIN, size, howmany, inverse);
+	if (!plan)
+		return NULL;
+
+	/* Even sizes go through a half-size complex transform */
+	cfft_size = (size % 2) ? size : size / 2;
+
+	plan->cfft = fft_cfft_create(cfft_size);
+	plan->work_in = fft_alloc_complex(cfft_size);
+	plan->work_out = fft_alloc_complex(cfft_size);
+	if (!plan->cfft || !plan->work_in || !plan->work_out)
+		goto cleanup;
+
+	if (!(size % 2)) {
+		plan->twiddles = fft_alloc_complex(cfft_size + 1);
+		if (!plan->twiddles)
+			goto cleanup;
+		for (i = 0; i <= cfft_size; i++) {
+			angle = -2.0L * M_PI * (double) i / (double) size;
+			plan->twiddles[i][0] = (float) cos(angle);
+			plan->twiddles[i][1] = (float) sin(angle);
+		}
+	}
+
+	return plan;
+
+ cleanup:
+	fft_destroy_plan(plan);
+	return NULL;
+}
+
+static void
+fft_builtin_r2c(const struct fft_plan *plan, const float *in, fft_complex *out)
+{
+	const uint32_t half = plan->cfft->size;
+	const fft_complex *z = plan->work_out;
+	const fft_complex *tw = plan->twiddles;
+	float zk[2] = {0};
+	float zc[2] = {0};
+	float e[2] = {0};
+	float o[2] = {0};
+	uint32_t i = 0;
+
+	/* Odd size, do a full complex transform */
+	if (plan->size % 2) {
+		for (i = 0; i < plan->size; i++) {
+			plan->work_in[i][0] = in[i];
+			plan->work_in[i][1] = 0.0;
+		}
+		fft_cfft_forward(plan->cfft, plan->work_in, plan->work_out);
+		memcpy(out, plan->work_out, plan->num_bins * sizeof(fft_complex));
+		return;
+	}
+
+	/* z[n] = x[2n] + i * x[2n + 1] */
+	memcpy(plan->work_in, in, plan->size * sizeof(float));
+	fft_cfft_forward(plan->cfft, plan->work_in, plan->work_out);
+
+	/* E[k] = (Z[k] + conj(Z[N/2 - k])) / 2
+	 * O[k] = -i * (Z[k] - conj(Z[N/2 - k])) / 2
+	 * X[k] = E[k] + W^k * O[k] */
+	for (i = 0; i <= half; i++) {
+		zk[0] = z[i % half][0];
+		zk[1] = z[i % half][1];
+		zc[0] = z[(half - i) % half][0];
+		zc[1] = -z[(half - i) % half][1];
+		e[0] = 0.5 * (zk[0] + zc[0]);
+		e[1] = 0.5 * (zk[1] + zc[1]);
+		o[0] = 0.5 * (zk[1] - zc[1]);
+		o[1] = -0.5 * (zk[0] - zc[0]);
+		out[i][0] = e[0] + tw[i][0] * o[0] - tw[i][1] * o[1];
+		out[i][1] = e[1] + tw[i][0] * o[1] + tw[i][1] * o[0];
+	}
+}
+
+static void
+fft_builtin_c2r(const struct fft_plan *plan, const fft_complex *in, float *out)
+{
+	const uint32_t half = plan->cfft->size;
+	const fft_complex *tw = plan->twiddles;
+	fft_complex *zf = plan->work_in;
+	float xk[2] = {0};
+	float xc[2] = {0};
+	float e[2] = {0};
+	float o[2] = {0};
+	uint32_t i = 0;
+
+	/* We get the inverse through the forward transform,
+	 * as conj(FFT(conj(X))) */
+
+	/* Odd size, rebuild the full (hermitian) spectrum */
+	if (plan->size % 2) {
+		for (i = 0; i < plan->size; i++) {
+			if (i < plan->num_bins) {
+				zf[i][0] = in[i][0];
+				zf[i][1] = -in[i][1];
+			} else {
+				zf[i][0] = in[plan->size - i][0];
+				zf[i][1] = in[plan->size - i][1];
+			}
+		}
+		fft_cfft_forward(plan->cfft, zf, plan->work_out);
+		for (i = 0; i < plan->size; i++)
+			out[i] = plan->work_out[i][0];
+		return;
+	}
+
+	/* Z[k] = (X[k] + conj(X[N/2 - k])) +
+	 *	  i * conj(W^k) * (X[k] - conj(X[N/2 - k])) */
+	for (i = 0; i < half; i++) {
+		xk[0] = in[i][0];
+		xk[1] = in[i][1];
+		xc[0] = in[half - i][0];
+		xc[1] = -in[half - i][1];
+		e[0] = xk[0] + xc[0];
+		e[1] = xk[1] + xc[1];
+		o[0] = (xk[0] - xc[0]) * tw[i][0] + (xk[1] - xc[1]) * tw[i][1];
+		o[1] = (xk[1] - xc[1]) * tw[i][0] - (xk[0] - xc[0]) * tw[i][1];
+		/* conj(E + i * O) */
+		zf[i][0] = e[0] - o[1];
+		zf[i][1] = -(e[1] + o[0]);
+	}
+	fft_cfft_forward(plan->cfft, zf, plan->work_out);
+
+	/* z = conj(result), x[2n] = Re(z[n]), x[2n + 1] = Im(z[n]) */
+	for (i = 0; i < half; i++) {
+		out[2 * i] = plan->work_out[i][0];
+		out[2 * i + 1] = -plan->work_out[i][1];
+	}
+}
+
+void
+fft_execute_r2c(const struct fft_plan *plan, float *in, fft_complex *out)
+{
+	uint32_t i = 0;
+
+	if (plan->backend == FFT_BACKEND_FFTW) {
+		fftwf_execute_dft_r2c(plan->fftw_plan, in, (fftwf_complex *) out);
+		return;
+	}
+
+	for (i = 0; i < plan->howmany; i++)
+		fft_builtin_r2c(plan, in + i * plan->size,
+				out + i * plan->num_bins);
+}
+
+void
+fft_execute_c2r(const struct fft_plan *plan, fft_complex *in, float *out)
+{
+	uint32_t i = 0;
+
+	if (plan->backend == FFT_BACKEND_FFTW) {
+		fftwf_execute_dft_c2r(plan->fftw_plan, (fftwf_complex *) in, out);
+		return;
+	}
+
+	for (i = 0; i < plan->howmany; i++)
+		fft_builtin_c2r(plan, in + i * plan->num_bins,
+				out + i * plan->size);
+}
+
+enum fft_backend
+fft_plan_get_backend(const struct fft_plan *plan)
+{
+	return plan->backend;
+}
+
+/* Run a plan a few times on scratch buffers and return
+ * the best time (in nsecs) */
+static int64_t
+fft_plan_bench(const struct fft_plan *plan)
+{
+	struct timespec start = {0};
+	struct timespec end = {0};
+	float *real = NULL;
+	fft_complex *cplx = NULL;
+	int64_t best = -1;
+	int64_t elapsed = 0;
+	uint32_t i = 0;
+	int run = 0;
+
+	real = fft_alloc_real(plan->howmany * plan->size);
+	cplx = fft_alloc_complex(plan->howmany * plan->num_bins);
+	if (!real || !cplx)
+		goto cleanup;
+
+	for (i = 0; i < plan->howmany * plan->size; i++)
+		real[i] = (float) sin(0.1L * (double) i);
+
+	/* One extra run to warm up the caches */
+	for (run = 0; run <= FFT_BENCH_RUNS; run++) {
+		if (plan->inverse)
+			for (i = 0; i < plan->howmany * plan->num_bins; i++) {
+				cplx[i][0] = (float) cos(0.1L * (double) i);
+				cplx[i][1] = (float) sin(0.1L * (double) i);
+			}
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (plan->inverse)
+			fft_execute_c2r(plan, cplx, real);
+		else
+			fft_execute_r2c(plan, real, cplx);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		elapsed = (int64_t) (end.tv_sec - start.tv_sec) * 1000000000LL +
+			  (int64_t) (end.tv_nsec - start.tv_nsec);
+		if (run && (best < 0 || elapsed < best))
+			best = elapsed;
+	}
+
+ cleanup:
+	fft_free(real);
+	fft_free(cplx);
+	return best;
+}
+
+static struct fft_plan*
+fft_plan_create(uint32_t size, uint32_t howmany, int inverse, float *real,
+		fft_complex *cplx, enum fft_plan_mode mode)
+{
+	enum fft_backend backend = fft_get_backend();
+	struct fft_plan *fftw = NULL;
+	struct fft_plan *builtin = NULL;
+	int64_t fftw_time = 0;
+	int64_t builtin_time = 0;
+
+	if (!size || !howmany)
+		return NULL;
+
+	if (backend != FFT_BACKEND_BUILTIN)
+		fftw = fft_plan_create_fftw(size, howmany, inverse, real, cplx,
+					    mode);
+
+	if (backend == FFT_BACKEND_FFTW)
+		return fftw;
+
+	/* Without measuring we can't tell which one is faster, stick
+	 * with FFTW. If there is no wisdom for FFTW let the caller
+	 * fall back to an estimated plan and try again later. */
+	if (backend == FFT_BACKEND_AUTO &&
+	   (mode == FFT_PLAN_WISDOM_ONLY || mode == FFT_PLAN_ESTIMATE) &&
+	   (fftw || mode == FFT_PLAN_WISDOM_ONLY))
+		return fftw;
+
+	builtin = fft_plan_create_builtin(size, howmany, inverse);
+
+	if (backend == FFT_BACKEND_BUILTIN || !fftw)
+		return builtin;
+	if (!builtin)
+		return fftw;
+
+	/* Keep the fastest one */
+	fftw_time = fft_plan_bench(fftw);
+	builtin_time = fft_plan_bench(builtin);
+	utils_dbg("[FFT] %s, size %u x%u: FFTW %lins, built-in %lins\n",
+		  inverse ? "c2r" : "r2c", size, howmany,
+		  (long) fftw_time, (long) builtin_time);
+
+	if (builtin_time >= 0 && builtin_time < fftw_time) {
+		fft_destroy_plan(fftw);
+		return builtin;
+	}
+
+	fft_destroy_plan(builtin);
+	return fftw;
+}
+
+struct fft_plan*
+fft_plan_r2c(uint32_t size, uint32_t howmany, float *in, fft_complex *out,
+	     enum fft_plan_mode mode)
+{
+	return fft_plan_create(size, howmany, 0, in, out, mode);
+}
+
+struct fft_plan*
+fft_plan_c2r(uint32_t size, uint32_t howmany, fft_complex *in, float *out,
+	     enum fft_plan_mode mode)
+{
+	return fft_plan_create(size, howmany, 1, out, in, mode);
+}
@@ -0,0 +1,102 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - FFT helpers
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stddef.h>		/* For size_t */
+#include <stdint.h>		/* For typed integers */
+#include <fftw3.h>		/* For FFTW support */
+
+/*
+ * A thin layer on top of the available FFT implementations (backends),
+ * currently FFTW (single precision) and a built-in fallback, since
+ * FFTW may be poorly tuned on some targets. Only what we need is
+ * covered: 1D real to complex / complex to real transforms, possibly
+ * batched (howmany transforms on consecutive regions of the same
+ * buffers, size samples / size / 2 + 1 bins apart). Complex to real
+ * transforms don't preserve their input and, as with FFTW, the output
+ * of a forward + inverse transform is scaled by size.
+ *
+ * By default we measure both backends when creating a plan and keep
+ * the fastest one, this can be overriden through the environment
+ * variable bellow ("fftw", "builtin" or "auto"). Plans are always
+ * executed through the new-array interface (the buffers passed on
+ * execute don't have to be the ones used for planning, as long as they
+ * come from fft_alloc_*), but a plan shouldn't be executed from more
+ * than one thread at a time.
+ */
+#define FFT_BACKEND_ENV		"JMPXRDS_FFT_BACKEND"
+#define FFT_BENCH_RUNS		8
+
+/* Same layout as fftwf_complex */
+typedef float fft_complex[2];
+
+enum fft_backend {
+	FFT_BACKEND_AUTO = 0,
+	FFT_BACKEND_FFTW = 1,
+	FFT_BACKEND_BUILTIN = 2,
+};
+
+enum fft_plan_mode {
+	FFT_PLAN_MEASURE = 0,		/* Find the fastest plan (slow) */
+	FFT_PLAN_WISDOM_ONLY = 1,	/* Same but only from wisdom, or fail */
+	FFT_PLAN_ESTIMATE = 2,		/* Don't measure anything (fast) */
+};
+
+struct fft_plan;
+
+float *fft_alloc_real(size_t num);
+fft_complex *fft_alloc_complex(size_t num);
+void fft_free(void *ptr);
+
+struct fft_plan *fft_plan_r2c(uint32_t size, uint32_t howmany, float *in,
+			      fft_complex *out, enum fft_plan_mode mode);
+struct fft_plan *fft_plan_c2r(uint32_t size, uint32_t howmany, fft_complex *in,
+			      float *out, enum fft_plan_mode mode);
+void fft_execute_r2c(const struct fft_plan *plan, float *in, fft_complex *out);
+void fft_execute_c2r(const struct fft_plan *plan, fft_complex *in, float *out);
+enum fft_backend fft_plan_get_backend(const struct fft_plan *plan);
+void fft_destroy_plan(struct fft_plan *plan);
+
+/*
+ * FFTW_MEASURE plans take a while to create and may differ from
+ * run to run. To avoid that we keep FFTW's wisdom (the measured plans)
+ * on a state file that's shared between the generator, the GUI and
+ * wisdom_tool. The file's location can be overriden through the
+ * environment variable bellow, by default it goes to the user's
+ * cache directory ($XDG_CACHE_HOME/jmpxrds or ~/.cache/jmpxrds).
+ */
+#define FFT_WISDOM_ENV		"JMPXRDS_FFTW_WISDOM"
+#define FFT_WISDOM_DIR		"jmpxrds"
+#define FFT_WISDOM_FILE		"fftw_wisdom"
+#define FFT_WISDOM_PATH_LEN	256
+
+int fft_wisdom_get_path(char *path, size_t len);
+int fft_wisdom_import(void);
+int fft_wisdom_export(void);
+
+/*
+ * Fast start: instead of measuring plans during init (which can take
+ * a few seconds without wisdom), create them from stored wisdom if
+ * possible, or else through FFTW's estimator, so that we can go on
+ * air right away. The measured plans are then created in the background
+ * and get swapped in once ready. Enable it by setting the environment
+ * variable bellow to 1.
+ */
+#define FFT_FAST_START_ENV	"JMPXRDS_FAST_START"
+
+int fft_fast_start_enabled(void);
@@ -33,6 +33,8 @@
 inline static double
 sinc(double phase)
 {
+	if (phase == 0.0L)
+		return 1.0L;
 	return (sin(M_PI * phase) / (M_PI * phase));
 }
 
@@ -41,7 +43,7 @@ sinc(double phase)
  * https://en.wikipedia.org/wiki/Window_function
  */
 inline static double
-nutall_window(uint16_t bin, uint16_t num_bins)
+nutall_window(uint32_t bin, uint32_t num_bins)
 {
 	double width = (double) num_bins - 1.0L;
 
@@ -56,13 +58,13 @@ nutall_window(uint16_t bin, uint16_t num_bins)
 }
 
 static void
-generate_lpf_impulse(float* out, uint16_t num_bins,
+generate_lpf_impulse(float* out, uint32_t num_bins,
 			float cutoff_freq, float sample_rate)
 {
 	double fc_pre_warped = 2.0L * ((double) cutoff_freq / (double) sample_rate);
 	double middle_bin = ((double) num_bins - 1.0L) / 2.0L;
 	double phase = 0;
-	int i = 0;
+	uint32_t i = 0;
 
 	/*
 	 * Sinc impulse: h[n] = sinc(2*fc * (n - (N-1/2))
@@ -158,6 +160,11 @@ fmpreemph_filter_init(struct fmpreemph_filter_data *fmprf,
 {
 	int ret = 0;
 
+	memset(fmprf, 0, sizeof(struct fmpreemph_filter_data));
+
+	/* Force a state reset on the first period */
+	fmprf->prev_tau_mode = LPF_PREEMPH_NONE;
+
 	ret = fmpreemph_filter_init_mode(fmprf,
 			   sample_rate,
 			   (float) AFLT_CUTOFF_FREQ,
@@ -173,18 +180,43 @@ fmpreemph_filter_init(struct fmpreemph_filter_data *fmprf,
 	return ret;
 }
 
-float
+/*
+ * Process a whole period of L/R samples. The recursion prevents us
+ * from vectorizing across samples, so instead we run the two channels
+ * side by side (as a 2-lane interleaved IIR) with the taps and the
+ * state hoisted to locals, which the compiler can map to a single
+ * SIMD register per term.
+ */
+void
 fmpreemph_filter_apply(struct fmpreemph_filter_data *fmprf,
-		       float sample, enum fmpreemph_mode tau_mode)
+		       const float *in_l, const float *in_r,
+		       float *out_l, float *out_r, uint32_t num_samples,
+		       enum fmpreemph_mode tau_mode)
 {
-	float out = 0.0;
 	const float *ataps = NULL;
 	const float *btaps = NULL;
-	static enum fmpreemph_mode prev_tau_mode = LPF_PREEMPH_NONE;
+	const float *in[2] = {in_l, in_r};
+	float *out[2] = {out_l, out_r};
+	float x[2] = {0};
+	float y[2] = {0};
+	float x1[2] = {0};
+	float y1[2] = {0};
+	float y2[2] = {0};
+	float a0 = 0.0;
+	float a1 = 0.0;
+	float b0 = 0.0;
+	float b1 = 0.0;
+	uint32_t i = 0;
+	int c = 0;
 
 	switch (tau_mode) {
 		case LPF_PREEMPH_NONE:
-			return sample;
+			if (out_l != in_l)
+				memcpy(out_l, in_l, num_samples * sizeof(float));
+			if (out_r != in_r)
+				memcpy(out_r, in_r, num_samples * sizeof(float));
+			fmprf->prev_tau_mode = tau_mode;
+			return;
 
 		case LPF_PREEMPH_75US:
 			ataps = fmprf->ataps_75;
@@ -198,28 +230,150 @@ fmpreemph_filter_apply(struct fmpreemph_filter_data *fmprf,
 			break;
 	}
 
-	out += ataps[0] * sample;
+	if (!num_samples)
+		return;
+
+	a0 = ataps[0];
+	a1 = ataps[1];
+	b0 = btaps[0];
+	b1 = btaps[1];
 
 	/* When switching modes don't use the previous
-	 * input/output. */
-	if (prev_tau_mode != tau_mode) {
-		fmprf->last_in = sample;
-		fmprf->last_out[0] = out;
-		prev_tau_mode = tau_mode;
-		return out;
+	 * input/output, start over from the first sample. */
+	if (fmprf->prev_tau_mode != tau_mode) {
+		for (c = 0; c < 2; c++) {
+			x1[c] = in[c][0];
+			y1[c] = a0 * x1[c];
+			y2[c] = y1[c];
+			out[c][0] = y1[c] * 8.0;
+		}
+		fmprf->prev_tau_mode = tau_mode;
+		i = 1;
+	} else {
+		for (c = 0; c < 2; c++) {
+			x1[c] = fmprf->last_in[c];
+			y1[c] = fmprf->last_out[0][c];
+			y2[c] = fmprf->last_out[1][c];
+		}
+	}
+
+	for (; i < num_samples; i++) {
+		for (c = 0; c < 2; c++) {
+			x[c] = in[c][i];
+			y[c] = a0 * x[c] + a1 * x1[c] +
+			       b0 * y1[c] + b1 * y2[c];
+			x1[c] = x[c];
+			y2[c] = y1[c];
+			y1[c] = y[c];
+			out[c][i] = y[c] * 8.0;
+		}
+	}
+
+	for (c = 0; c < 2; c++) {
+		fmprf->last_in[c] = x1[c];
+		fmprf->last_out[0][c] = y1[c];
+		fmprf->last_out[1][c] = y2[c];
+	}
+}
+
+
+/****************\
+* BIQUAD FILTERS *
+\****************/
+
+/*
+ * Coefficients from the "Audio EQ Cookbook" (R. Bristow-Johnson),
+ * normalized so that a0 is 1. The filter runs in transposed direct
+ * form II, which behaves well with floats, and for the same reason
+ * as the pre-emphasis filter the two channels run side by side.
+ */
+void
+biquad_filter_design(struct biquad_filter_data *bq, enum biquad_type type,
+		     float freq, float q, float sample_rate)
+{
+	double w0 = 2.0L * M_PI * (double) freq / (double) sample_rate;
+	double alpha = sin(w0) / (2.0L * (double) q);
+	double cos_w0 = cos(w0);
+	double a0 = 1.0L + alpha;
+	double b0 = 0.0L;
+	double b1 = 0.0L;
+	double b2 = 0.0L;
+
+	switch (type) {
+	case BIQUAD_HPF:
+		b0 = (1.0L + cos_w0) / 2.0L;
+		b1 = -(1.0L + cos_w0);
+		b2 = b0;
+		break;
+	case BIQUAD_APF:
+		b0 = 1.0L - alpha;
+		b1 = -2.0L * cos_w0;
+		b2 = 1.0L + alpha;
+		break;
+	case BIQUAD_LPF:
+	default:
+		b0 = (1.0L - cos_w0) / 2.0L;
+		b1 = 1.0L - cos_w0;
+		b2 = b0;
+		break;
 	}
 
-	out += ataps[1] * fmprf->last_in;
+	bq->b0 = (float) (b0 / a0);
+	bq->b1 = (float) (b1 / a0);
+	bq->b2 = (float) (b2 / a0);
+	bq->a1 = (float) (-2.0L * cos_w0 / a0);
+	bq->a2 = (float) ((1.0L - alpha) / a0);
+}
 
-	fmprf->last_in = sample;
+void
+biquad_filter_reset(struct biquad_filter_data *bq)
+{
+	int c = 0;
 
-	out += btaps[0] * fmprf->last_out[0];
-	out += btaps[1] * fmprf->last_out[1];
+	for (c = 0; c < 2; c++) {
+		bq->z1[c] = 0.0;
+		bq->z2[c] = 0.0;
+	}
+}
 
-	fmprf->last_out[1] = fmprf->last_out[0];
-	fmprf->last_out[0] = out;
+void
+biquad_filter_apply(struct biquad_filter_data *bq,
+		    const float *in_l, const float *in_r,
+		    float *out_l, float *out_r, uint32_t num_samples)
+{
+	const float *in[2] = {in_l, in_r};
+	float *out[2] = {out_l, out_r};
+	const float b0 = bq->b0;
+	const float b1 = bq->b1;
+	const float b2 = bq->b2;
+	const float a1 = bq->a1;
+	const float a2 = bq->a2;
+	float x[2] = {0};
+	float y[2] = {0};
+	float z1[2] = {0};
+	float z2[2] = {0};
+	uint32_t i = 0;
+	int c = 0;
+
+	for (c = 0; c < 2; c++) {
+		z1[c] = bq->z1[c];
+		z2[c] = bq->z2[c];
+	}
 
-	return out * 8.0;
+	for (i = 0; i < num_samples; i++) {
+		for (c = 0; c < 2; c++) {
+			x[c] = in[c][i];
+			y[c] = b0 * x[c] + z1[c];
+			z1[c] = b1 * x[c] - a1 * y[c] + z2[c];
+			z2[c] = b2 * x[c] - a2 * y[c];
+			out[c][i] = y[c];
+		}
+	}
+
+	for (c = 0; c < 2; c++) {
+		bq->z1[c] = z1[c];
+		bq->z2[c] = z2[c];
+	}
 }
 
 /*****************************\
@@ -230,27 +384,62 @@ void
 lpf_filter_destroy(const struct lpf_filter_data *lpf)
 {
 	if(lpf->filter_resp)
-		fftwf_free(lpf->filter_resp);
+		fft_free(lpf->filter_resp);
+	if(lpf->filter_resp_next)
+		fft_free(lpf->filter_resp_next);
 	if(lpf->real_in)
-		fftwf_free(lpf->real_in);
+		fft_free(lpf->real_in);
 	if(lpf->real_out)
-		fftwf_free(lpf->real_out);
+		fft_free(lpf->real_out);
 	if(lpf->complex_buff)
-		fftwf_free(lpf->complex_buff);
+		fft_free(lpf->complex_buff);
 	if(lpf->dft_plan)
-		fftwf_destroy_plan(lpf->dft_plan);
+		fft_destroy_plan(lpf->dft_plan);
 	if(lpf->ift_plan)
-		fftwf_destroy_plan(lpf->ift_plan);
+		fft_destroy_plan(lpf->ift_plan);
+}
+
+/*
+ * Create the DFT/IFT plans, one transform per channel. This way FFTW
+ * can also use its SIMD codelets that work on multiple transforms at
+ * once. Since we always execute them through the new-array interface,
+ * the buffers used here don't have to be the filter's own buffers, as
+ * long as they have the same size and alignment (which fft_alloc_*
+ * guarantees).
+ */
+static int
+lpf_filter_create_plans(const struct lpf_filter_data *lpf, float *real_in,
+			fft_complex *complex_buff, float *real_out,
+			enum fft_plan_mode mode, struct fft_plan **dft_plan,
+			struct fft_plan **ift_plan)
+{
+	*dft_plan = fft_plan_r2c(lpf->num_bins, lpf->num_channels, real_in,
+				 complex_buff, mode);
+	if (!(*dft_plan))
+		return -1;
+
+	*ift_plan = fft_plan_c2r(lpf->num_bins, lpf->num_channels,
+				 complex_buff, real_out, mode);
+	if (!(*ift_plan)) {
+		fft_destroy_plan(*dft_plan);
+		*dft_plan = NULL;
+		return -1;
+	}
+
+	return 0;
 }
 
 int
 lpf_filter_init(struct lpf_filter_data *lpf, uint32_t cutoff_freq,
-		uint32_t sample_rate, uint16_t max_frames,
-		uint8_t overlap_factor)
+		uint32_t sample_rate, uint32_t max_frames,
+		uint8_t overlap_factor, uint8_t num_channels, int fast_plan)
 {
 	float nyquist_freq = 0.0;
 	int ret = 0;
 
+	if (num_channels < 1)
+		return -1;
+
 	/* Initialize filter parameters */
 	lpf->period_size = max_frames;
 	lpf->num_bins = (overlap_factor + 1) * lpf->period_size;
@@ -259,117 +448,320 @@ lpf_filter_init(struct lpf_filter_data *lpf, uint32_t cutoff_freq,
 	nyquist_freq = (float) lpf->sample_rate / 2.0;
 	lpf->bin_bw = (nyquist_freq / (float) lpf->num_bins);
 	lpf->overlap_len = overlap_factor * lpf->period_size;
+	lpf->num_channels = num_channels;
+	lpf->dc_gain = 0.0;
 
-
-	/* Allocate buffers for DFT/IFT */
-	lpf->real_in = fftwf_alloc_real(lpf->num_bins);
+	/* Allocate buffers for DFT/IFT, channels are placed one after
+	 * the other on the same buffer so that one plan covers them all */
+	lpf->real_in = fft_alloc_real(num_channels * lpf->num_bins);
 	if(!lpf->real_in) {
 		ret = -2;
 		goto cleanup;
 	}
-	memset(lpf->real_in, 0, lpf->num_bins * sizeof(float));
+	memset(lpf->real_in, 0, num_channels * lpf->num_bins * sizeof(float));
 
-	lpf->real_out = fftwf_alloc_real(lpf->num_bins);
+	lpf->real_out = fft_alloc_real(num_channels * lpf->num_bins);
 	if(!lpf->real_out) {
 		ret = -3;
 		goto cleanup;
 	}
-	memset(lpf->real_out, 0, lpf->num_bins * sizeof(float));
+	memset(lpf->real_out, 0, num_channels * lpf->num_bins * sizeof(float));
 
-	lpf->complex_buff = fftwf_alloc_complex(lpf->middle_bin - 0);
+	lpf->complex_buff = fft_alloc_complex(num_channels * lpf->middle_bin);
 	if(!lpf->complex_buff) {
 		ret = -4;
 		goto cleanup;
 	}
-	memset(lpf->complex_buff, 0, sizeof(fftwf_complex) *
-				     (lpf->middle_bin - 0));
+	memset(lpf->complex_buff, 0, sizeof(fft_complex) *
+				     num_channels * lpf->middle_bin);
 
 
-	/* Allocate buffer for the filter's responce */
-	lpf->filter_resp = fftwf_alloc_complex(lpf->middle_bin - 0);
+	/* Allocate buffers for the filter's responce, it's the same
+	 * for all channels. We keep a second one for designing a new
+	 * responce while the filter is running. */
+	lpf->filter_resp = fft_alloc_complex(lpf->middle_bin - 0);
 	if(!lpf->filter_resp) {
 		ret = -4;
 		goto cleanup;
 	}
 
+	lpf->filter_resp_next = fft_alloc_complex(lpf->middle_bin - 0);
+	if(!lpf->filter_resp_next) {
+		ret = -4;
+		goto cleanup;
+	}
+
 
-	/* Create DFT plan */
-	lpf->dft_plan = fftwf_plan_dft_r2c_1d(lpf->num_bins, lpf->real_in,
-					     lpf->complex_buff, FFTW_MEASURE);
-	if(!lpf->dft_plan) {
+	/* Create the DFT/IFT plans */
+	lpf->estimated_plans = 0;
+	if (fast_plan) {
+		ret = lpf_filter_create_plans(lpf, lpf->real_in,
+					      lpf->complex_buff, lpf->real_out,
+					      FFT_PLAN_WISDOM_ONLY,
+					      &lpf->dft_plan, &lpf->ift_plan);
+		if (ret < 0) {
+			ret = lpf_filter_create_plans(lpf, lpf->real_in,
+						      lpf->complex_buff,
+						      lpf->real_out,
+						      FFT_PLAN_ESTIMATE,
+						      &lpf->dft_plan,
+						      &lpf->ift_plan);
+			lpf->estimated_plans = 1;
+		}
+	} else
+		ret = lpf_filter_create_plans(lpf, lpf->real_in,
+					      lpf->complex_buff, lpf->real_out,
+					      FFT_PLAN_MEASURE, &lpf->dft_plan,
+					      &lpf->ift_plan);
+	if (ret < 0) {
 		ret = -5;
 		goto cleanup;
 	}
 
 
-	/* Create IFT plan */
-	lpf->ift_plan = fftwf_plan_dft_c2r_1d(lpf->num_bins, lpf->complex_buff,
-					     lpf->real_out, FFTW_MEASURE);
-	if(!lpf->ift_plan)
+	/* Generate the initial filter responce, use as many taps as
+	 * we can for the steepest roll-off */
+	ret = lpf_filter_design(lpf, cutoff_freq, 0);
+	if (ret < 0) {
 		ret = -6;
+		goto cleanup;
+	}
+	lpf_filter_swap_resp(lpf);
 
 
-	/* Generate filter's responce on time domain on lpf->real_in and
-	 * calculate its responce on the frequency domain */
-	generate_lpf_impulse(lpf->real_in, lpf->num_bins,
-			     (float) cutoff_freq, (float) sample_rate);
+ cleanup:
+	if(ret < 0)
+		lpf_filter_destroy(lpf);
+	return ret;
+}
 
-	fftwf_execute(lpf->dft_plan);
+/*
+ * Measure a new set of plans for this filter on scratch buffers,
+ * so that the filter can keep running while we are at it.
+ */
+int
+lpf_filter_replan(const struct lpf_filter_data *lpf,
+		  struct fft_plan **dft_plan, struct fft_plan **ift_plan)
+{
+	float *real_in = NULL;
+	float *real_out = NULL;
+	fft_complex *complex_buff = NULL;
+	int ret = 0;
 
-	/* Store the result on lpf->filter_resp and clear the complex
-	 * buffer */
-	memcpy(lpf->filter_resp, lpf->complex_buff,
-	       sizeof(fftwf_complex) * (lpf->middle_bin - 0));
-	memset(lpf->complex_buff, 0, sizeof(fftwf_complex) *
-					(lpf->middle_bin - 0));
+	real_in = fft_alloc_real(lpf->num_channels * lpf->num_bins);
+	real_out = fft_alloc_real(lpf->num_channels * lpf->num_bins);
+	complex_buff = fft_alloc_complex(lpf->num_channels * lpf->middle_bin);
+	if (!real_in || !real_out || !complex_buff) {
+		ret = -1;
+		goto cleanup;
+	}
 
+	ret = lpf_filter_create_plans(lpf, real_in, complex_buff, real_out,
+				      FFT_PLAN_MEASURE, dft_plan, ift_plan);
+	if (ret < 0)
+		ret = -2;
 
  cleanup:
-	if(ret < 0)
-		lpf_filter_destroy(lpf);
+	if (real_in)
+		fft_free(real_in);
+	if (real_out)
+		fft_free(real_out);
+	if (complex_buff)
+		fft_free(complex_buff);
 	return ret;
 }
 
+void
+lpf_filter_swap_plans(struct lpf_filter_data *lpf,
+		      struct fft_plan **dft_plan, struct fft_plan **ift_plan)
+{
+	struct fft_plan *tmp = NULL;
+
+	tmp = lpf->dft_plan;
+	lpf->dft_plan = *dft_plan;
+	*dft_plan = tmp;
+
+	tmp = lpf->ift_plan;
+	lpf->ift_plan = *ift_plan;
+	*ift_plan = tmp;
+
+	lpf->estimated_plans = 0;
+}
+
+/*
+ * Design a new filter responce on filter_resp_next, without touching
+ * the one in use, so that this can run on a non-RT thread while the
+ * filter is running (executing a plan through the new-array interface
+ * is thread-safe). When transition_bw is 0 we use all the bins for the
+ * impulse, with cutoff_freq at the middle of the transition band. Else
+ * cutoff_freq is the end of the passband and we use as many taps as
+ * needed for the requested transition band, with the Nutall window's
+ * main lobe being 8 bins wide, the transition is ~4 * sample_rate / taps.
+ * Use lpf_filter_swap_resp() to switch to the new responce.
+ */
 int
-lpf_filter_apply(const struct lpf_filter_data *lpf, const float *in, float *out,
-		 uint16_t num_samples, float gain)
+lpf_filter_design(struct lpf_filter_data *lpf, uint32_t cutoff_freq,
+		  uint32_t transition_bw)
 {
-	float ratio = 0.0;
-	fftw_complex tmp = {0};
-	int i = 0;
-
-	/* Shift the buffer's content to make room for the new
-	 * period on its end and then put the new data there. */
-	memmove(lpf->real_in, lpf->real_in + lpf->period_size,
-		lpf->overlap_len * sizeof(float));
-	memcpy(lpf->real_in + lpf->overlap_len, in,
-		num_samples * sizeof(float));
+	float *real_buff = NULL;
+	fft_complex *complex_buff = NULL;
+	struct fft_plan *dft_plan = NULL;
+	float sinc_cutoff = (float) cutoff_freq;
+	uint32_t num_taps = lpf->num_bins;
+	float dc_gain = 0.0;
+	int ret = 0;
+	uint32_t i = 0;
+
+	if (transition_bw) {
+		sinc_cutoff += (float) transition_bw / 2.0;
+		num_taps = (4 * lpf->sample_rate) / transition_bw + 1;
+		if (num_taps > lpf->num_bins)
+			num_taps = lpf->num_bins;
+	}
+
+	if (sinc_cutoff >= (float) lpf->sample_rate / 2.0)
+		return -1;
+
+	real_buff = fft_alloc_real(lpf->num_bins);
+	complex_buff = fft_alloc_complex(lpf->middle_bin);
+	if (!real_buff || !complex_buff) {
+		ret = -2;
+		goto cleanup;
+	}
+	memset(real_buff, 0, lpf->num_bins * sizeof(float));
+
+	/* Use a separate plan for this, the filter's plans may be running
+	 * on the processing thread and they may not be re-entrant */
+	dft_plan = fft_plan_r2c(lpf->num_bins, 1, real_buff, complex_buff,
+				FFT_PLAN_ESTIMATE);
+	if (!dft_plan) {
+		ret = -3;
+		goto cleanup;
+	}
+
+	/* Generate filter's responce on time domain on the scratch
+	 * buffer and calculate its responce on the frequency
+	 * domain. Shorter impulses are centered on the window, so that
+	 * the filter's delay remains the same. */
+	generate_lpf_impulse(real_buff + (lpf->num_bins - num_taps) / 2,
+			     num_taps, sinc_cutoff, (float) lpf->sample_rate);
+
+	/* Keep the filter's gain at DC the same as with the initial
+	 * design, so that re-designing it won't change the audio level */
+	for (i = 0; i < lpf->num_bins; i++)
+		dc_gain += real_buff[i];
+	if (lpf->dc_gain == 0.0)
+		lpf->dc_gain = dc_gain;
+	else if (dc_gain != 0.0)
+		for (i = 0; i < lpf->num_bins; i++)
+			real_buff[i] *= lpf->dc_gain / dc_gain;
+
+	fft_execute_r2c(dft_plan, real_buff, complex_buff);
+
+	memcpy(lpf->filter_resp_next, complex_buff,
+	       sizeof(fft_complex) * (lpf->middle_bin - 0));
+
+ cleanup:
+	if (dft_plan)
+		fft_destroy_plan(dft_plan);
+	if (real_buff)
+		fft_free(real_buff);
+	if (complex_buff)
+		fft_free(complex_buff);
+	return ret;
+}
+
+/* Switch to the responce generated by lpf_filter_design(), call
+ * this between periods */
+void
+lpf_filter_swap_resp(struct lpf_filter_data *lpf)
+{
+	fft_complex *tmp = lpf->filter_resp;
+
+	lpf->filter_resp = lpf->filter_resp_next;
+	lpf->filter_resp_next = tmp;
+}
+
+/*
+ * Run the filter on all channels, the new period for each channel
+ * should already be at the end of its region on real_in. The filtered
+ * output is left on real_out, unnormalized.
+ */
+static void
+lpf_filter_run(const struct lpf_filter_data *lpf)
+{
+	const fft_complex *resp = lpf->filter_resp;
+	fft_complex *cbuf = NULL;
+	double tmp[2] = {0};
+	uint32_t i = 0;
+	int c = 0;
 
 	/* Run the DFT plan to get the freq domain (complex or
 	 * analytical) representation of the signal */
-	fftwf_execute(lpf->dft_plan);
+	fft_execute_r2c(lpf->dft_plan, lpf->real_in, lpf->complex_buff);
 
 	/* Now signal is on the complex buffer, convolution of 1d
 	 * signals on the time domain equals piecewise multiplication
 	 * on the frequency domain, so we multiply the complex
 	 * representation of the signal with the complex representation
 	 * of the filter's impulse. */
-	for(i = 0; i < lpf->middle_bin; i++) {
-		/* Real part */
-		tmp[0] = lpf->filter_resp[i][0] * lpf->complex_buff[i][0] -
-			 lpf->filter_resp[i][1] * lpf->complex_buff[i][1];
-		/* Imaginary part */
-		tmp[1] = lpf->filter_resp[i][0] * lpf->complex_buff[i][1] +
-			 lpf->filter_resp[i][1] * lpf->complex_buff[i][0];
-
-		lpf->complex_buff[i][0] = tmp[0];
-		lpf->complex_buff[i][1] = tmp[1];
+	for(c = 0; c < lpf->num_channels; c++) {
+		cbuf = lpf->complex_buff + c * lpf->middle_bin;
+		for(i = 0; i < lpf->middle_bin; i++) {
+			/* Real part */
+			tmp[0] = resp[i][0] * cbuf[i][0] -
+				 resp[i][1] * cbuf[i][1];
+			/* Imaginary part */
+			tmp[1] = resp[i][0] * cbuf[i][1] +
+				 resp[i][1] * cbuf[i][0];
+
+			cbuf[i][0] = tmp[0];
+			cbuf[i][1] = tmp[1];
+		}
 	}
 
 	/* Switch the signal back to the time domain */
-	fftwf_execute(lpf->ift_plan);
+	fft_execute_c2r(lpf->ift_plan, lpf->complex_buff, lpf->real_out);
+}
+
+/*
+ * Shift a channel's input region to make room for the new
+ * chunk on its end and then put the new data there.
+ */
+static void
+lpf_filter_push(const struct lpf_filter_data *lpf, int channel,
+		const float *in, uint32_t num_samples)
+{
+	float *real_in = lpf->real_in + channel * lpf->num_bins;
 
-	/* Note that FFTW returns unnormalized data so the IFT output
+	memmove(real_in, real_in + num_samples,
+		(lpf->num_bins - num_samples) * sizeof(float));
+	memcpy(real_in + lpf->num_bins - num_samples, in,
+		num_samples * sizeof(float));
+}
+
+/*
+ * Inputs larger than a period are processed in chunks of up to
+ * period_size samples (each one needs its own DFT/IFT round-trip).
+ * For a chunk of n samples we output real_out[period_size - n] onwards
+ * and discard the rest, so that the filter's delay is the same no
+ * matter the chunk size (for full periods that's the begining of
+ * real_out).
+ */
+int
+lpf_filter_apply(const struct lpf_filter_data *lpf, const float *in, float *out,
+		 uint32_t num_samples, float gain)
+{
+	const float *real_out = NULL;
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+	float ratio = 0.0;
+	uint32_t i = 0;
+
+	if (lpf->num_channels != 1)
+		return -1;
+
+	/* Note that the IFT returns unnormalized data so the IFT output
 	 * is multiplied with the product of the logical dimentions
 	 * which in our case is bins.
 	 * To make things simpler and more efficient, we calculate a gain
@@ -377,14 +769,563 @@ lpf_filter_apply(const struct lpf_filter_data *lpf, const float *in, float *out,
 	 * normalization (multiplication is cheaper than division). */
 	ratio = (float) gain / (float) lpf->num_bins;
 
-	/* Output the begining of the real_out buffer and discard the overlap
-	 * that follows */
-	for(i = 0; i < num_samples; i++)
-		out[i] = lpf->real_out[i] * ratio;
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > lpf->period_size)
+			chunk = lpf->period_size;
+
+		lpf_filter_push(lpf, 0, in + done, chunk);
+
+		lpf_filter_run(lpf);
+
+		real_out = lpf->real_out + (lpf->period_size - chunk);
+		for(i = 0; i < chunk; i++)
+			out[done + i] = real_out[i] * ratio;
+	}
+
+	return 0;
+}
+
+int
+lpf_filter_apply_stereo(const struct lpf_filter_data *lpf,
+			const float *in_l, const float *in_r,
+			float *out_l, float *out_r,
+			uint32_t num_samples, float gain)
+{
+	const float *real_out_l = NULL;
+	const float *real_out_r = NULL;
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+	float ratio = 0.0;
+	uint32_t i = 0;
+
+	if (lpf->num_channels != 2)
+		return -1;
+
+	/* Same as above */
+	ratio = (float) gain / (float) lpf->num_bins;
+
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > lpf->period_size)
+			chunk = lpf->period_size;
+
+		lpf_filter_push(lpf, 0, in_l + done, chunk);
+		lpf_filter_push(lpf, 1, in_r + done, chunk);
+
+		/* Both channels go through the same DFT/IFT plans */
+		lpf_filter_run(lpf);
+
+		real_out_l = lpf->real_out + (lpf->period_size - chunk);
+		real_out_r = real_out_l + lpf->num_bins;
+		for(i = 0; i < chunk; i++) {
+			out_l[done + i] = real_out_l[i] * ratio;
+			out_r[done + i] = real_out_r[i] * ratio;
+		}
+	}
+
+	return 0;
+}
+
+
+/******************\
+* SHORT FIR FILTER *
+\******************/
+
+/*
+ * For short filters (a few dozen taps) at low sample rates it's
+ * cheaper to do the convolution on the time domain than to go through
+ * the FFT. The filter is linear-phase (its impulse is symmetric), so
+ * we can add the samples that get multiplied with the same tap before
+ * multiplying them, saving half the multiplications. Its delay is
+ * (num_taps - 1) / 2 samples and fir_filter_delay() can be used on
+ * another instance to delay a signal by the same amount.
+ */
+
+void
+fir_filter_destroy(const struct fir_filter_data *fir)
+{
+	if(fir->taps)
+		free(fir->taps);
+	if(fir->buf)
+		free(fir->buf);
+}
+
+int
+fir_filter_init(struct fir_filter_data *fir, uint32_t num_taps,
+		uint32_t max_frames, float cutoff_freq, float sample_rate)
+{
+	float dc_gain = 0.0;
+	uint32_t buf_len = 0;
+	uint32_t i = 0;
+	int ret = 0;
+
+	/* We need an odd number of taps for an integer delay */
+	if (!(num_taps % 2) || !max_frames ||
+	    cutoff_freq >= sample_rate / 2.0)
+		return -1;
+
+	fir->num_taps = num_taps;
+	fir->period_size = max_frames;
+
+	fir->taps = (float *) malloc(num_taps * sizeof(float));
+	if(!fir->taps) {
+		ret = -2;
+		goto cleanup;
+	}
+
+	/* The last num_taps - 1 input samples, followed by the new chunk */
+	buf_len = num_taps - 1 + max_frames;
+	fir->buf = (float *) malloc(buf_len * sizeof(float));
+	if(!fir->buf) {
+		ret = -2;
+		goto cleanup;
+	}
+	memset(fir->buf, 0, buf_len * sizeof(float));
+
+	/* Windowed sinc with unity gain at DC */
+	generate_lpf_impulse(fir->taps, num_taps, cutoff_freq, sample_rate);
+	for (i = 0; i < num_taps; i++)
+		dc_gain += fir->taps[i];
+	for (i = 0; i < num_taps; i++)
+		fir->taps[i] /= dc_gain;
+
+ cleanup:
+	if(ret < 0)
+		fir_filter_destroy(fir);
+	return ret;
+}
+
+/* Clear the filter's history */
+void
+fir_filter_reset(const struct fir_filter_data *fir)
+{
+	memset(fir->buf, 0, (fir->num_taps - 1 + fir->period_size) *
+			    sizeof(float));
+}
+
+/* Put a new chunk after the history, or move the
+ * end of it (the new history) to the start */
+static inline void
+fir_filter_push(const struct fir_filter_data *fir, const float *in,
+		uint32_t num_samples)
+{
+	memcpy(fir->buf + fir->num_taps - 1, in, num_samples * sizeof(float));
+}
+
+static inline void
+fir_filter_shift(const struct fir_filter_data *fir, uint32_t num_samples)
+{
+	memmove(fir->buf, fir->buf + num_samples,
+		(fir->num_taps - 1) * sizeof(float));
+}
+
+/* The input may be the same buffer as the output */
+void
+fir_filter_apply(const struct fir_filter_data *fir, const float *in,
+		 float *out, uint32_t num_samples)
+{
+	const uint32_t middle_tap = (fir->num_taps - 1) / 2;
+	const float *x = NULL;
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+	uint32_t i = 0;
+	uint32_t k = 0;
+	float acc = 0.0;
+
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > fir->period_size)
+			chunk = fir->period_size;
+
+		fir_filter_push(fir, in + done, chunk);
+
+		for (i = 0; i < chunk; i++) {
+			x = fir->buf + i;
+			acc = fir->taps[middle_tap] * x[middle_tap];
+			for (k = 0; k < middle_tap; k++)
+				acc += fir->taps[k] *
+				       (x[k] + x[fir->num_taps - 1 - k]);
+			out[done + i] = acc;
+		}
+
+		fir_filter_shift(fir, chunk);
+	}
+}
+
+/* Only delay the input by the filter's delay, without
+ * filtering it. Use a separate instance for this. */
+void
+fir_filter_delay(const struct fir_filter_data *fir, const float *in,
+		 float *out, uint32_t num_samples)
+{
+	const uint32_t middle_tap = (fir->num_taps - 1) / 2;
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > fir->period_size)
+			chunk = fir->period_size;
+
+		fir_filter_push(fir, in + done, chunk);
+		memmove(out + done, fir->buf + middle_tap,
+			chunk * sizeof(float));
+		fir_filter_shift(fir, chunk);
+	}
+}
+
+
+/*****************\
+* TRUE PEAK METER *
+\*****************/
+
+/*
+ * The sample peak of a signal is not what comes out of the DAC, after
+ * reconstruction the signal may peak between samples, so for metering
+ * the deviation we also need its true peak. As in ITU-R BS.1770 we
+ * oversample the signal by TP_OVERSAMPLING and track the peak of the
+ * oversampled signal. Oversampling is done with a polyphase FIR, each
+ * phase produces one of the TP_OVERSAMPLING samples for each input
+ * sample and we only keep the largest one, so no output buffer is
+ * needed. The taps are stored phase-interleaved so that the phases
+ * get computed together. Since we go through the signal anyway, we
+ * also track its sample peak and its energy (for RMS).
+ */
+
+void
+tp_meter_destroy(const struct tp_meter_data *tpm)
+{
+	if(tpm->buf)
+		free(tpm->buf);
+}
+
+int
+tp_meter_init(struct tp_meter_data *tpm, uint32_t max_frames)
+{
+	float impulse[TP_TAPS_PER_PHASE * TP_OVERSAMPLING] = {0};
+	const uint32_t num_taps = TP_TAPS_PER_PHASE * TP_OVERSAMPLING;
+	float dc_gain = 0.0;
+	uint32_t buf_len = 0;
+	uint32_t i = 0;
+	uint32_t k = 0;
+
+	if (!max_frames)
+		return -1;
+
+	memset(tpm, 0, sizeof(struct tp_meter_data));
+	tpm->period_size = max_frames;
+
+	/* The last TP_TAPS_PER_PHASE - 1 samples, followed by the new chunk */
+	buf_len = TP_TAPS_PER_PHASE - 1 + max_frames;
+	tpm->buf = (float *) malloc(buf_len * sizeof(float));
+	if(!tpm->buf)
+		return -2;
+	memset(tpm->buf, 0, buf_len * sizeof(float));
+
+	/* Prototype filter at the oversampled rate (frequencies are
+	 * relative to the input sample rate), each phase should
+	 * have unity gain at DC */
+	generate_lpf_impulse(impulse, num_taps, 0.5 * TP_CUTOFF_RATIO,
+			     (float) TP_OVERSAMPLING);
+
+	for (i = 0; i < TP_OVERSAMPLING; i++) {
+		dc_gain = 0.0;
+		for (k = 0; k < TP_TAPS_PER_PHASE; k++)
+			dc_gain += impulse[k * TP_OVERSAMPLING + i];
+		for (k = 0; k < TP_TAPS_PER_PHASE; k++)
+			tpm->taps[k][i] = impulse[k * TP_OVERSAMPLING + i] /
+					  dc_gain;
+	}
 
 	return 0;
 }
 
+void
+tp_meter_run(const struct tp_meter_data *tpm, const float *in,
+	     uint32_t num_samples, struct tp_meter_levels *levels)
+{
+	float acc[TP_OVERSAMPLING] = {0};
+	const float *x = NULL;
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+	uint32_t i = 0;
+	uint32_t k = 0;
+	uint32_t p = 0;
+
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > tpm->period_size)
+			chunk = tpm->period_size;
+
+		memcpy(tpm->buf + TP_TAPS_PER_PHASE - 1, in + done,
+		       chunk * sizeof(float));
+
+		for (i = 0; i < chunk; i++) {
+			/* Newest sample last */
+			x = tpm->buf + i;
+
+			levels->energy += x[TP_TAPS_PER_PHASE - 1] *
+					  x[TP_TAPS_PER_PHASE - 1];
+			if (fabsf(x[TP_TAPS_PER_PHASE - 1]) > levels->peak)
+				levels->peak = fabsf(x[TP_TAPS_PER_PHASE - 1]);
+
+			for (p = 0; p < TP_OVERSAMPLING; p++)
+				acc[p] = 0.0;
+			for (k = 0; k < TP_TAPS_PER_PHASE; k++)
+				for (p = 0; p < TP_OVERSAMPLING; p++)
+					acc[p] += tpm->taps[k][p] *
+						  x[TP_TAPS_PER_PHASE - 1 - k];
+			for (p = 0; p < TP_OVERSAMPLING; p++)
+				if (fabsf(acc[p]) > levels->true_peak)
+					levels->true_peak = fabsf(acc[p]);
+		}
+
+		memmove(tpm->buf, tpm->buf + chunk,
+			(TP_TAPS_PER_PHASE - 1) * sizeof(float));
+	}
+
+	/* The true peak can't be lower than the sample peak */
+	if (levels->peak > levels->true_peak)
+		levels->true_peak = levels->peak;
+
+	levels->num_samples += num_samples;
+}
+
+
+/*******************\
+* COMPOSITE LIMITER *
+\*******************/
+
+/*
+ * A look-ahead limiter for the MPX signal. For each sample we know
+ * the gain the audio part needs so that audio + aux stays within the
+ * ceiling. The limiter's gain is the minimum of that over the next
+ * lookahead samples, smoothed by a box filter of the same length, so
+ * it reaches the needed gain right when the peak comes in, and it
+ * recovers through a one-pole release. Since the gain changes slowly
+ * it doesn't spread the audio's spectrum the way a clipper would, so
+ * the pilot / RDS stay clean, and the downsampler (that only cuts
+ * above the MPX band) won't add overshoots of its own.
+ *
+ * The running minimum uses the van Herk / Gil-Werman algorithm. The
+ * signal is split in blocks of the window's length and for each block
+ * we get the prefix and suffix minimums, any window then spans one
+ * block's suffix and the next one's prefix, so it costs 3 comparisons
+ * per sample no matter how long the window is. Apart from the prefix
+ * / suffix scans, the passes are branch-free and independent across
+ * samples so that the compiler can vectorize them.
+ */
+
+void
+mpx_limiter_destroy(const struct mpx_limiter_data *lim)
+{
+	if (lim->gain_hist)
+		free(lim->gain_hist);
+	if (lim->audio)
+		free(lim->audio);
+	if (lim->aux)
+		free(lim->aux);
+	if (lim->need)
+		free(lim->need);
+	if (lim->prefix)
+		free(lim->prefix);
+	if (lim->suffix)
+		free(lim->suffix);
+	if (lim->win_min)
+		free(lim->win_min);
+}
+
+/*
+ * Start over with an empty history. Instead of filling it with silence,
+ * which would send out lookahead samples of nothing (pilot / RDS
+ * included), the first lookahead samples that come in pass through
+ * untouched while they fill up the history, and then the output gets
+ * delayed, so those samples get repeated once. With a 1ms look-ahead
+ * that's a whole number of pilot / RDS subcarrier cycles, so they
+ * stay in phase.
+ */
+void
+mpx_limiter_reset(struct mpx_limiter_data *lim)
+{
+	uint32_t i = 0;
+
+	for (i = 0; i < lim->lookahead; i++)
+		lim->gain_hist[i] = 1.0;
+	lim->gain_sum = (double) lim->lookahead;
+	lim->gain_pos = 0;
+	lim->gain = 1.0;
+	lim->fill = 0;
+}
+
+/* Split the chunk and get the gain each sample needs,
+ * note that fminf / fmaxf don't vectorize (because of
+ * their NaN handling), so we use plain comparisons */
+static inline void
+mpx_limiter_split(const float *mpx, const float *aux, float *audio_in,
+		  float *aux_in, float *need_in, uint32_t num_samples,
+		  float ceiling)
+{
+	float headroom = 0.0;
+	float level = 0.0;
+	uint32_t i = 0;
+
+	for (i = 0; i < num_samples; i++) {
+		aux_in[i] = aux[i];
+		audio_in[i] = mpx[i] - aux_in[i];
+		headroom = ceiling - fabsf(aux_in[i]);
+		headroom = headroom > 1e-6f ? headroom : 1e-6f;
+		level = fabsf(audio_in[i]);
+		need_in[i] = headroom / (level > headroom ?
+					 level : headroom);
+	}
+}
+
+int
+mpx_limiter_init(struct mpx_limiter_data *lim, uint32_t lookahead,
+		 uint32_t release, uint32_t max_frames)
+{
+	uint32_t buf_len = 0;
+
+	if (!lookahead || !release || !max_frames)
+		return -1;
+
+	memset(lim, 0, sizeof(struct mpx_limiter_data));
+	lim->lookahead = lookahead;
+	lim->period_size = max_frames;
+	lim->release = (float) (1.0L - exp(-1.0L / (double) release));
+
+	buf_len = (lookahead + max_frames) * sizeof(float);
+	lim->gain_hist = (float *) malloc(lookahead * sizeof(float));
+	lim->audio = (float *) malloc(buf_len);
+	lim->aux = (float *) malloc(buf_len);
+	lim->need = (float *) malloc(buf_len);
+	lim->prefix = (float *) malloc(buf_len);
+	lim->suffix = (float *) malloc(buf_len);
+	lim->win_min = (float *) malloc(max_frames * sizeof(float));
+	if (!lim->gain_hist || !lim->audio || !lim->aux || !lim->need ||
+	    !lim->prefix || !lim->suffix || !lim->win_min) {
+		mpx_limiter_destroy(lim);
+		memset(lim, 0, sizeof(struct mpx_limiter_data));
+		return -2;
+	}
+
+	mpx_limiter_reset(lim);
+
+	return 0;
+}
+
+/*
+ * Limit num_samples of the MPX signal in place, aux is the pilot /
+ * RDS part of it. The output is delayed by lookahead samples, returns
+ * the lowest gain applied.
+ */
+float
+mpx_limiter_run(struct mpx_limiter_data *lim, float *mpx, const float *aux,
+		uint32_t num_samples, float ceiling)
+{
+	const uint32_t lookahead = lim->lookahead;
+	const uint32_t win_len = lookahead + 1;
+	float *audio_in = NULL;
+	float *aux_in = NULL;
+	float *need_in = NULL;
+	float *out = NULL;
+	const float *prefix_end = lim->prefix + lookahead;
+	const float *aux_chunk = NULL;
+	const float *suffix = lim->suffix;
+	float *win_min = lim->win_min;
+	float min_gain = 1.0;
+	float avg = 0.0;
+	float m = 0.0;
+	uint32_t buf_len = 0;
+	uint32_t block_end = 0;
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+	uint32_t b = 0;
+	uint32_t i = 0;
+
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > lim->period_size)
+			chunk = lim->period_size;
+		buf_len = lookahead + chunk;
+		audio_in = lim->audio + lookahead;
+		aux_in = lim->aux + lookahead;
+		need_in = lim->need + lookahead;
+		aux_chunk = aux + done;
+		out = mpx + done;
+
+		/* Just reset, pass the samples through until
+		 * the history is full (see mpx_limiter_reset()) */
+		if (lim->fill < lookahead) {
+			if (chunk > lookahead - lim->fill)
+				chunk = lookahead - lim->fill;
+			mpx_limiter_split(out, aux_chunk, lim->audio + lim->fill,
+					  lim->aux + lim->fill,
+					  lim->need + lim->fill, chunk,
+					  ceiling);
+			lim->fill += chunk;
+			continue;
+		}
+
+		mpx_limiter_split(out, aux_chunk, audio_in, aux_in, need_in,
+				  chunk, ceiling);
+
+		/* Prefix / suffix minimums of each block */
+		for (b = 0; b < buf_len; b += win_len) {
+			block_end = b + win_len;
+			if (block_end > buf_len)
+				block_end = buf_len;
+			lim->prefix[b] = lim->need[b];
+			for (i = b + 1; i < block_end; i++) {
+				lim->prefix[i] = lim->prefix[i - 1];
+				if (lim->need[i] < lim->prefix[i])
+					lim->prefix[i] = lim->need[i];
+			}
+			lim->suffix[block_end - 1] = lim->need[block_end - 1];
+			for (i = block_end - 1; i > b; i--) {
+				lim->suffix[i - 1] = lim->suffix[i];
+				if (lim->need[i - 1] < lim->suffix[i - 1])
+					lim->suffix[i - 1] = lim->need[i - 1];
+			}
+		}
+
+		/* Minimum over the window [i, i + lookahead] */
+		for (i = 0; i < chunk; i++)
+			win_min[i] = suffix[i] < prefix_end[i] ?
+				     suffix[i] : prefix_end[i];
+
+		for (i = 0; i < chunk; i++) {
+			m = win_min[i];
+			lim->gain_sum += m - lim->gain_hist[lim->gain_pos];
+			lim->gain_hist[lim->gain_pos] = m;
+			lim->gain_pos++;
+			if (lim->gain_pos >= lookahead)
+				lim->gain_pos = 0;
+
+			avg = (float) (lim->gain_sum / (double) lookahead);
+			if (avg < lim->gain)
+				lim->gain = avg;
+			else
+				lim->gain += (avg - lim->gain) * lim->release;
+			if (lim->gain < min_gain)
+				min_gain = lim->gain;
+
+			out[i] = lim->audio[i] * lim->gain + lim->aux[i];
+		}
+
+		/* Keep the last lookahead samples for the next chunk */
+		memmove(lim->audio, lim->audio + chunk,
+			lookahead * sizeof(float));
+		memmove(lim->aux, lim->aux + chunk,
+			lookahead * sizeof(float));
+		memmove(lim->need, lim->need + chunk,
+			lookahead * sizeof(float));
+	}
+
+	return min_gain;
+}
+
 
 /***********************************************\
 * HILBERT TRANSFORMER FOR THE HARTLEY MODULATOR *
@@ -393,73 +1334,186 @@ lpf_filter_apply(const struct lpf_filter_data *lpf, const float *in, float *out,
 /*
  * The Hilbert transformer is an all-pass filter that shifts
  * the phase of the input signal by -pi/2 (90deg). To understand
- * this implementation think of the signal as a vector on the I/Q
- * plane. To rotate the vector by -pi/2 we need to swap Q with I.
- * We need to do that for both positive and negative frequencies
- * (it's not like the LP filter, we need the whole thing). This is
- * equivalent to multiplying positive frequencies with i
- * (so it's (0 +i) * (Re -iIm) = -Im +iRe) and negative frequencies
- * with -i (so it's (0 -i) * (Re +iIm) = Im -iRe). Note that if
- * we wanted +pi/2 we would do the oposite (-i for positive freqs
- * and i for negative).
+ * this think of the signal as a vector on the I/Q plane. To rotate
+ * the vector by -pi/2 we need to swap Q with I. We need to do that
+ * for both positive and negative frequencies, which is equivalent to
+ * multiplying positive frequencies with i (so it's (0 +i) * (Re -iIm) =
+ * -Im +iRe) and negative frequencies with -i (so it's (0 -i) *
+ * (Re +iIm) = Im -iRe). Note that if we wanted +pi/2 we would do the
+ * oposite (-i for positive freqs and i for negative).
+ *
+ * The ideal transformer's impulse is h[n] = -2 / (pi * n) for odd n
+ * and 0 for even n (including n = 0), so every other tap is zero. We
+ * use a windowed version of it with an odd number of taps, centered
+ * on the window, so that its delay is an integer number of samples
+ * and there is no gain at DC or at Nyquist. The filter runs on the
+ * frequency domain through overlap-save: we keep a sliding window of
+ * the input that spans over HT_OVERLAP_FACTOR + 1 periods, and since
+ * the impulse is shorter than the overlap, the last period of the
+ * output is free of time aliasing. This way the output is continuous
+ * across periods. Since the filter is causal, its output is delayed
+ * by (num_taps - 1) / 2 samples, so the in-phase signal (and anything
+ * else that should remain aligned with it) needs to be delayed by the
+ * same amount.
  *
  * For more information about Hilbert transformation check out
  * http://www.katjaas.nl/hilbert/hilbert.html
  */
 
+static void
+generate_hilbert_impulse(float *out, uint32_t num_taps)
+{
+	int32_t middle_tap = (int32_t) (num_taps - 1) / 2;
+	int32_t n = 0;
+	uint32_t i = 0;
+
+	for (i = 0; i < num_taps; i++) {
+		n = (int32_t) i - middle_tap;
+		if (!(n % 2))
+			out[i] = 0.0;
+		else
+			out[i] = (float) ((-2.0L / (M_PI * (double) n)) *
+					  nutall_window(i, num_taps));
+	}
+}
+
 void
 hilbert_transformer_destroy(const struct hilbert_transformer_data *ht)
 {
-	if(ht->real_buff)
-		fftwf_free(ht->real_buff);
+	if(ht->filter_resp)
+		fft_free(ht->filter_resp);
 	if(ht->complex_buff)
-		fftwf_free(ht->complex_buff);
+		fft_free(ht->complex_buff);
+	if(ht->real_in)
+		fft_free(ht->real_in);
+	if(ht->real_out)
+		fft_free(ht->real_out);
+	if(ht->delay_buf)
+		free(ht->delay_buf);
 	if(ht->dft_plan)
-		fftwf_destroy_plan(ht->dft_plan);
+		fft_destroy_plan(ht->dft_plan);
 	if(ht->ift_plan)
-		fftwf_destroy_plan(ht->ift_plan);
+		fft_destroy_plan(ht->ift_plan);
+}
+
+/* Same as with the LPF, plans are always executed through the
+ * new-array interface */
+static int
+hilbert_transformer_create_plans(const struct hilbert_transformer_data *ht,
+				 float *real_in, fft_complex *complex_buff,
+				 float *real_out, enum fft_plan_mode mode,
+				 struct fft_plan **dft_plan,
+				 struct fft_plan **ift_plan)
+{
+	*dft_plan = fft_plan_r2c(ht->num_bins, 1, real_in, complex_buff,
+				 mode);
+	if (!(*dft_plan))
+		return -1;
+
+	*ift_plan = fft_plan_c2r(ht->num_bins, 1, complex_buff, real_out,
+				 mode);
+	if (!(*ift_plan)) {
+		fft_destroy_plan(*dft_plan);
+		*dft_plan = NULL;
+		return -1;
+	}
+
+	return 0;
 }
 
 int
-hilbert_transformer_init(struct hilbert_transformer_data *ht, uint16_t num_bins)
+hilbert_transformer_init(struct hilbert_transformer_data *ht,
+			 uint32_t max_frames, int fast_plan)
 {
+	float *impulse = NULL;
 	int ret = 0;
-	ht->num_bins = num_bins;
 
-	/* Allocate buffers */
-	ht->real_buff = fftwf_alloc_real(num_bins);
-	if(!ht->real_buff) {
+	/* Initialize transformer parameters, the impulse must
+	 * fit within the overlap and have an odd number of taps */
+	ht->period_size = max_frames;
+	ht->num_bins = (HT_OVERLAP_FACTOR + 1) * ht->period_size;
+	ht->middle_bin = (ht->num_bins / 2) + 1;
+	ht->num_taps = HT_OVERLAP_FACTOR * ht->period_size + 1;
+	if (!(ht->num_taps % 2))
+		ht->num_taps--;
+	ht->delay = (ht->num_taps - 1) / 2;
+
+	/* Allocate buffers, r2c only needs bins / 2 + 1 complex bins */
+	ht->real_in = fft_alloc_real(ht->num_bins);
+	if(!ht->real_in) {
 		ret = -1;
 		goto cleanup;
 	}
-	memset(ht->real_buff, 0, num_bins * sizeof(float));
+	memset(ht->real_in, 0, ht->num_bins * sizeof(float));
 
+	ht->real_out = fft_alloc_real(ht->num_bins);
+	if(!ht->real_out) {
+		ret = -1;
+		goto cleanup;
+	}
+	memset(ht->real_out, 0, ht->num_bins * sizeof(float));
 
-	/* Note: Instead of allocating bins / 2 + 1 as we did with
-	 * the FIR filter, we allocate the full thing to get the mirroring
-	 * effect. */
-	ht->complex_buff = fftwf_alloc_complex(num_bins);
+	ht->complex_buff = fft_alloc_complex(ht->middle_bin);
 	if(!ht->complex_buff) {
 		ret = -2;
 		goto cleanup;
 	}
-	memset(ht->complex_buff, 0, num_bins * sizeof(fftwf_complex));
+	memset(ht->complex_buff, 0, ht->middle_bin * sizeof(fft_complex));
 
+	ht->filter_resp = fft_alloc_complex(ht->middle_bin);
+	if(!ht->filter_resp) {
+		ret = -2;
+		goto cleanup;
+	}
 
-	/* Create DFT plan */
-	ht->dft_plan = fftwf_plan_dft_r2c_1d(num_bins, ht->real_buff,
-					     ht->complex_buff, FFTW_MEASURE);
-	if(!ht->dft_plan) {
+	/* Delay line for hilbert_transformer_delay() */
+	ht->delay_buf = (float *) malloc((ht->delay + ht->period_size) *
+					 sizeof(float));
+	if(!ht->delay_buf) {
+		ret = -2;
+		goto cleanup;
+	}
+	memset(ht->delay_buf, 0, (ht->delay + ht->period_size) * sizeof(float));
+
+
+	/* Create DFT/IFT plans */
+	ht->estimated_plans = 0;
+	if (fast_plan) {
+		ret = hilbert_transformer_create_plans(ht, ht->real_in,
+						       ht->complex_buff,
+						       ht->real_out,
+						       FFT_PLAN_WISDOM_ONLY,
+						       &ht->dft_plan,
+						       &ht->ift_plan);
+		if (ret < 0) {
+			ret = hilbert_transformer_create_plans(ht,
+							ht->real_in,
+							ht->complex_buff,
+							ht->real_out,
+							FFT_PLAN_ESTIMATE,
+							&ht->dft_plan,
+							&ht->ift_plan);
+			ht->estimated_plans = 1;
+		}
+	} else
+		ret = hilbert_transformer_create_plans(ht, ht->real_in,
+						       ht->complex_buff,
+						       ht->real_out,
+						       FFT_PLAN_MEASURE,
+						       &ht->dft_plan,
+						       &ht->ift_plan);
+	if (ret < 0) {
 		ret = -3;
 		goto cleanup;
 	}
 
 
-	/* Create IFT plan */
-	ht->ift_plan = fftwf_plan_dft_c2r_1d(num_bins, ht->complex_buff,
-					    ht->real_buff, FFTW_MEASURE);
-	if(!ht->ift_plan)
-		ret = -4;
+	/* Generate the impulse on the (still empty) output buffer
+	 * and get the transformer's responce on the frequency domain */
+	impulse = ht->real_out;
+	generate_hilbert_impulse(impulse, ht->num_taps);
+	fft_execute_r2c(ht->dft_plan, impulse, ht->filter_resp);
+	memset(impulse, 0, ht->num_bins * sizeof(float));
 
  cleanup:
 	if(ret < 0)
@@ -468,56 +1522,137 @@ hilbert_transformer_init(struct hilbert_transformer_data *ht, uint16_t num_bins)
 }
 
 int
-hilbert_transformer_apply(const struct hilbert_transformer_data *ht, const float *in,
-			  uint16_t num_samples)
+hilbert_transformer_replan(const struct hilbert_transformer_data *ht,
+			   struct fft_plan **dft_plan,
+			   struct fft_plan **ift_plan)
 {
-	float ratio = 0.0;
-	float tmp = 0.0L;
-	int middle_point = 0;
-	int i = 0;
+	float *real_in = NULL;
+	float *real_out = NULL;
+	fft_complex *complex_buff = NULL;
+	int ret = 0;
 
-	/* Clear and fill the real buffer */
-	memset(ht->real_buff, 0, ht->num_bins * sizeof(float));
-	memcpy(ht->real_buff, in, num_samples * sizeof(float));
+	real_in = fft_alloc_real(ht->num_bins);
+	real_out = fft_alloc_real(ht->num_bins);
+	complex_buff = fft_alloc_complex(ht->middle_bin);
+	if (!real_in || !real_out || !complex_buff) {
+		ret = -1;
+		goto cleanup;
+	}
 
-	/* Run the DFT plan to transform signal */
-	fftwf_execute(ht->dft_plan);
+	ret = hilbert_transformer_create_plans(ht, real_in, complex_buff,
+					       real_out, FFT_PLAN_MEASURE,
+					       dft_plan, ift_plan);
+	if (ret < 0)
+		ret = -2;
 
-	/* Now signal is on the complex buffer. */
+ cleanup:
+	if (real_in)
+		fft_free(real_in);
+	if (real_out)
+		fft_free(real_out);
+	if (complex_buff)
+		fft_free(complex_buff);
+	return ret;
+}
 
-	/* Get the first half (+1 here is to cover odd bins) */
-	middle_point = (ht->num_bins + 1) / 2;
+void
+hilbert_transformer_swap_plans(struct hilbert_transformer_data *ht,
+			       struct fft_plan **dft_plan,
+			       struct fft_plan **ift_plan)
+{
+	struct fft_plan *tmp = NULL;
 
-	/* -Im +iRe */
-	for(i = 0; i < middle_point; i++) {
-		ht->complex_buff[i][1] *= -1.0L;
-		tmp = ht->complex_buff[i][1];
-		ht->complex_buff[i][1] = ht->complex_buff[i][0];
-		ht->complex_buff[i][0] = tmp;
-	}
+	tmp = ht->dft_plan;
+	ht->dft_plan = *dft_plan;
+	*dft_plan = tmp;
 
-	/* Middle point */
-	ht->complex_buff[i][0] = 0.0L;
-	ht->complex_buff[i][1] = 0.0L;
+	tmp = ht->ift_plan;
+	ht->ift_plan = *ift_plan;
+	*ift_plan = tmp;
 
-	/* Im -iRe */
-	for(i = middle_point + 1; i < ht->num_bins; i++) {
-		ht->complex_buff[i][0] *= -1.0L;
-		tmp = ht->complex_buff[i][1];
-		ht->complex_buff[i][1] = ht->complex_buff[i][0];
-		ht->complex_buff[i][0] = tmp;
-	}
+	ht->estimated_plans = 0;
+}
 
-	/* Switch the signal back to the time domain */
-	fftwf_execute(ht->ift_plan);
+/*
+ * Process num_samples from in, the phase shifted signal goes to out_q
+ * and the input, delayed to match it, goes to out_i. The input may be
+ * the same buffer as out_i (but not out_q).
+ */
+int
+hilbert_transformer_apply(const struct hilbert_transformer_data *ht,
+			  const float *in, float *out_i, float *out_q,
+			  uint32_t num_samples)
+{
+	const fft_complex *resp = ht->filter_resp;
+	fft_complex *cbuf = ht->complex_buff;
+	const float *real_out = NULL;
+	const float *delayed_in = NULL;
+	double tmp[2] = {0};
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+	float ratio = 0.0;
+	uint32_t i = 0;
 
-	/* Note that FFTW returns unnormalized data so the IFT output
+	/* Note that the IFT returns unnormalized data so the IFT output
 	 * is multiplied with the product of the logical dimentions
 	 * which in our case is num_bins.*/
 	ratio = 1.0 / (float) ht->num_bins;
 
-	for(i = 0; i < num_samples; i++)
-		ht->real_buff[i] *= ratio;
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > ht->period_size)
+			chunk = ht->period_size;
+
+		/* Slide the input window and put the new chunk at its end */
+		memmove(ht->real_in, ht->real_in + chunk,
+			(ht->num_bins - chunk) * sizeof(float));
+		memcpy(ht->real_in + ht->num_bins - chunk, in + done,
+		       chunk * sizeof(float));
+
+		/* The in-phase output is also on the input window */
+		delayed_in = ht->real_in + ht->num_bins - chunk - ht->delay;
+		memcpy(out_i + done, delayed_in, chunk * sizeof(float));
+
+		fft_execute_r2c(ht->dft_plan, ht->real_in, cbuf);
+
+		for (i = 0; i < ht->middle_bin; i++) {
+			tmp[0] = resp[i][0] * cbuf[i][0] -
+				 resp[i][1] * cbuf[i][1];
+			tmp[1] = resp[i][0] * cbuf[i][1] +
+				 resp[i][1] * cbuf[i][0];
+			cbuf[i][0] = tmp[0];
+			cbuf[i][1] = tmp[1];
+		}
+
+		fft_execute_c2r(ht->ift_plan, cbuf, ht->real_out);
+
+		/* Only the end of the window is free of time aliasing */
+		real_out = ht->real_out + ht->num_bins - chunk;
+		for (i = 0; i < chunk; i++)
+			out_q[done + i] = real_out[i] * ratio;
+	}
 
 	return 0;
 }
+
+/* Delay a signal (in place) by the same amount as the
+ * transformer, to keep it aligned with its output */
+void
+hilbert_transformer_delay(const struct hilbert_transformer_data *ht,
+			  float *buf, uint32_t num_samples)
+{
+	uint32_t chunk = 0;
+	uint32_t done = 0;
+
+	for (done = 0; done < num_samples; done += chunk) {
+		chunk = num_samples - done;
+		if (chunk > ht->period_size)
+			chunk = ht->period_size;
+
+		memcpy(ht->delay_buf + ht->delay, buf + done,
+		       chunk * sizeof(float));
+		memcpy(buf + done, ht->delay_buf, chunk * sizeof(float));
+		memmove(ht->delay_buf, ht->delay_buf + chunk,
+			ht->delay * sizeof(float));
+	}
+}
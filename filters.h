@@ -18,24 +18,32 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <stdint.h>		/* For typed integers */
-#include <fftw3.h>		/* For FFTW support */
+#include "fft.h"		/* For FFT plans / buffers */
 #include <jack/jack.h>		/* For jack-related types */
 
-/* A generic FFT-based FIR low pass filter */
+/* A generic FFT-based FIR low pass filter. It can process
+ * more than one channel (e.g. L/R audio) in one go, using
+ * a single batched plan and a shared filter responce. Each
+ * channel gets its own num_bins (or middle_bin for the complex
+ * buffer) region on the buffers below. */
 struct lpf_filter_data {
-	uint16_t period_size;
-	uint16_t num_bins;
-	uint16_t middle_bin;
-	uint16_t cutoff_bin;
+	uint32_t period_size;
+	uint32_t num_bins;
+	uint32_t middle_bin;
+	uint32_t cutoff_bin;
 	uint32_t sample_rate;
 	float bin_bw;
-	fftwf_complex *filter_resp;
-	fftwf_complex *complex_buff;
+	float dc_gain;
+	uint8_t num_channels;
+	fft_complex *filter_resp;
+	fft_complex *filter_resp_next;
+	fft_complex *complex_buff;
 	float *real_in;
 	float *real_out;
-	uint16_t overlap_len;
-	fftwf_plan dft_plan;
-	fftwf_plan ift_plan;
+	uint32_t overlap_len;
+	struct fft_plan *dft_plan;
+	struct fft_plan *ift_plan;
+	uint8_t estimated_plans;
 };
 
 /*
@@ -56,20 +64,27 @@ struct lpf_filter_data {
 #define	AFLT_LPF_OVERLAP_FACTOR 3
 #define SSB_LPF_OVERLAP_FACTOR 3
 
+/*
+ * In fast mode, plans are created from stored wisdom if possible,
+ * or else through FFTW's estimator (estimated_plans gets set). In
+ * that case *_replan() can be used later on, from a non-RT thread, to
+ * measure a proper set of plans on scratch buffers, and *_swap_plans()
+ * to swap them in between periods. The old plans are returned on the
+ * provided pointers for the caller to destroy.
+ */
 void lpf_filter_destroy(const struct lpf_filter_data *);
-int lpf_filter_init(struct lpf_filter_data *, uint32_t, uint32_t, uint16_t, uint8_t);
-int lpf_filter_apply(const struct lpf_filter_data *, const float*, float*, uint16_t, float);
-
+int lpf_filter_init(struct lpf_filter_data *, uint32_t, uint32_t, uint32_t,
+		    uint8_t, uint8_t, int);
+int lpf_filter_replan(const struct lpf_filter_data *, struct fft_plan **,
+		      struct fft_plan **);
+void lpf_filter_swap_plans(struct lpf_filter_data *, struct fft_plan **,
+			   struct fft_plan **);
+int lpf_filter_design(struct lpf_filter_data *, uint32_t, uint32_t);
+void lpf_filter_swap_resp(struct lpf_filter_data *);
+int lpf_filter_apply(const struct lpf_filter_data *, const float*, float*, uint32_t, float);
+int lpf_filter_apply_stereo(const struct lpf_filter_data *, const float *,
+			    const float *, float *, float *, uint32_t, float);
 
-/* FM Preemphasis IIR filter */
-struct fmpreemph_filter_data {
-	float last_in;
-	float last_out[2];
-	float ataps_50[2];
-	float btaps_50[2];
-	float ataps_75[2];
-	float btaps_75[2];
-};
 
 enum fmpreemph_mode {
 	LPF_PREEMPH_50US = 0,	/* E.U. / WORLD */
@@ -78,24 +93,159 @@ enum fmpreemph_mode {
 	LPF_PREEMPH_MAX = 3
 };
 
+/* FM Preemphasis IIR filter, it processes both audio
+ * channels in lockstep so its state is kept per channel
+ * (index 0 -> L, index 1 -> R) */
+struct fmpreemph_filter_data {
+	float last_in[2];
+	float last_out[2][2];
+	float ataps_50[2];
+	float btaps_50[2];
+	float ataps_75[2];
+	float btaps_75[2];
+	enum fmpreemph_mode prev_tau_mode;
+};
+
 int
 fmpreemph_filter_init(struct fmpreemph_filter_data *, float);
 
-float
+void
 fmpreemph_filter_apply(struct fmpreemph_filter_data *,
-		       float, enum fmpreemph_mode);
+		       const float *, const float *,
+		       float *, float *, uint32_t,
+		       enum fmpreemph_mode);
+
+/* Second order IIR filter (biquad), like the pre-emphasis filter
+ * above it processes both audio channels in lockstep */
+enum biquad_type {
+	BIQUAD_LPF = 0,
+	BIQUAD_HPF = 1,
+	BIQUAD_APF = 2,
+};
 
+struct biquad_filter_data {
+	float b0;
+	float b1;
+	float b2;
+	float a1;
+	float a2;
+	float z1[2];
+	float z2[2];
+};
+
+void biquad_filter_design(struct biquad_filter_data *, enum biquad_type,
+			  float, float, float);
+void biquad_filter_reset(struct biquad_filter_data *);
+void biquad_filter_apply(struct biquad_filter_data *,
+			 const float *, const float *,
+			 float *, float *, uint32_t);
+
+/* Pilot protection, the audio's passband ends at AFLT_CUTOFF_FREQ
+ * and it should be fully attenuated before the 19KHz pilot */
 #define AFLT_CUTOFF_FREQ 16750
+#define AFLT_STOPBAND_FREQ 19000
+
+/* Short linear-phase FIR low pass filter, running on the time domain */
+struct fir_filter_data {
+	uint32_t num_taps;
+	uint32_t period_size;
+	float *taps;
+	float *buf;
+};
+
+void fir_filter_destroy(const struct fir_filter_data *);
+int fir_filter_init(struct fir_filter_data *, uint32_t, uint32_t, float, float);
+void fir_filter_reset(const struct fir_filter_data *);
+void fir_filter_apply(const struct fir_filter_data *, const float *, float *,
+		      uint32_t);
+void fir_filter_delay(const struct fir_filter_data *, const float *, float *,
+		      uint32_t);
+
+/* Level meter with true peak detection (ITU-R BS.1770), through
+ * TP_OVERSAMPLING x oversampling with a polyphase FIR */
+#define TP_OVERSAMPLING		4
+#define TP_TAPS_PER_PHASE	16
+/* Prototype filter's cutoff, relative to the input's nyquist */
+#define TP_CUTOFF_RATIO		0.9
+
+struct tp_meter_data {
+	float taps[TP_TAPS_PER_PHASE][TP_OVERSAMPLING];
+	uint32_t period_size;
+	float *buf;
+};
 
-/* Hilbert transformer for the Hartley modulator (SSB) */
+/* Levels accumulated by tp_meter_run() */
+struct tp_meter_levels {
+	float peak;
+	float true_peak;
+	double energy;
+	uint32_t num_samples;
+};
+
+void tp_meter_destroy(const struct tp_meter_data *);
+int tp_meter_init(struct tp_meter_data *, uint32_t);
+void tp_meter_run(const struct tp_meter_data *, const float *, uint32_t,
+		  struct tp_meter_levels *);
+
+/* Look-ahead limiter for the composite (MPX) signal, it only
+ * reduces the audio part, the pilot / RDS part (aux) passes
+ * through untouched, delayed along with the audio */
+struct mpx_limiter_data {
+	uint32_t lookahead;
+	uint32_t period_size;
+	float release;
+	float gain;
+	/* Box filter over the last lookahead window gains */
+	double gain_sum;
+	uint32_t gain_pos;
+	float *gain_hist;
+	/* The last lookahead samples, followed by the new chunk,
+	 * fill is how much of the history we've got after a reset */
+	uint32_t fill;
+	float *audio;
+	float *aux;
+	float *need;
+	/* Scratch space for the running minimum */
+	float *prefix;
+	float *suffix;
+	float *win_min;
+};
+
+void mpx_limiter_destroy(const struct mpx_limiter_data *);
+int mpx_limiter_init(struct mpx_limiter_data *, uint32_t, uint32_t, uint32_t);
+void mpx_limiter_reset(struct mpx_limiter_data *);
+float mpx_limiter_run(struct mpx_limiter_data *, float *, const float *,
+		      uint32_t, float);
+
+/* Hilbert transformer for the Hartley modulator (SSB), it's an
+ * FFT-based FIR filter (overlap-save) so it works like the LPF above,
+ * only that it also needs to delay the in-phase signal to match its
+ * own delay (delay samples). */
 struct hilbert_transformer_data {
-	uint16_t num_bins;
-	fftwf_complex *complex_buff;
-	float *real_buff;
-	fftwf_plan dft_plan;
-	fftwf_plan ift_plan;
+	uint32_t period_size;
+	uint32_t num_bins;
+	uint32_t middle_bin;
+	uint32_t num_taps;
+	uint32_t delay;
+	fft_complex *filter_resp;
+	fft_complex *complex_buff;
+	float *real_in;
+	float *real_out;
+	float *delay_buf;
+	struct fft_plan *dft_plan;
+	struct fft_plan *ift_plan;
+	uint8_t estimated_plans;
 };
 
-int hilbert_transformer_init(struct hilbert_transformer_data *ht, uint16_t);
+#define HT_OVERLAP_FACTOR 1
+
+int hilbert_transformer_init(struct hilbert_transformer_data *ht, uint32_t, int);
+int hilbert_transformer_replan(const struct hilbert_transformer_data *ht,
+			       struct fft_plan **, struct fft_plan **);
+void hilbert_transformer_swap_plans(struct hilbert_transformer_data *ht,
+				    struct fft_plan **, struct fft_plan **);
 void hilbert_transformer_destroy(const struct hilbert_transformer_data *ht);
-int hilbert_transformer_apply(const struct hilbert_transformer_data *ht, const float *, uint16_t);
+int hilbert_transformer_apply(const struct hilbert_transformer_data *ht,
+			      const float *, float *, float *, uint32_t);
+void hilbert_transformer_delay(const struct hilbert_transformer_data *ht,
+			       float *, uint32_t);
@@ -0,0 +1,98 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - Fixed-point helpers
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>		/* For typed integers */
+#include <math.h>		/* For lrintf() */
+
+/*
+ * Helpers for the fixed-point path (see FMMOD_FIXED_POINT_ENV). Samples
+ * are in Q15 (1.0 is 1 << 15), kept in 32bit integers when they may go
+ * above full scale (e.g. L + R) and in 16bit ones for tables. Gain ramps
+ * are in Q24 so that their per-sample steps don't get rounded to zero.
+ *
+ * Only include this from .c files, so that the inlines below don't get
+ * defined twice.
+ */
+#define FXP_Q15_BITS	15
+#define FXP_Q15_ONE	(1 << FXP_Q15_BITS)
+#define FXP_Q15_MAX	32767
+#define FXP_Q15_MIN	-32768
+#define FXP_Q24_BITS	24
+
+/* To Q15, no saturation */
+static inline int32_t
+fxp_from_float(float x)
+{
+	return (int32_t) lrintf(x * (float) FXP_Q15_ONE);
+}
+
+/* To a Q15 table entry, saturated */
+static inline int16_t
+fxp_q15_from_float(float x)
+{
+	int32_t val = fxp_from_float(x);
+
+	if (val > FXP_Q15_MAX)
+		return FXP_Q15_MAX;
+	if (val < FXP_Q15_MIN)
+		return FXP_Q15_MIN;
+	return (int16_t) val;
+}
+
+/* Q15 to the Q14 samples of the fixed-point downsampler (see
+ * polyphase.h), saturated at twice full scale */
+static inline int16_t
+fxp_q14_from_q15(int32_t x)
+{
+	int32_t val = (x + 1) >> 1;
+
+	if (val > FXP_Q15_MAX)
+		return FXP_Q15_MAX;
+	if (val < FXP_Q15_MIN)
+		return FXP_Q15_MIN;
+	return (int16_t) val;
+}
+
+static inline float
+fxp_to_float(int32_t x)
+{
+	return (float) x * (1.0f / (float) FXP_Q15_ONE);
+}
+
+/* Q15 x Q15 (rounded), the product may go above full scale */
+static inline int32_t
+fxp_mul(int32_t a, int32_t b)
+{
+	return (int32_t) (((int64_t) a * b +
+			   (1 << (FXP_Q15_BITS - 1))) >> FXP_Q15_BITS);
+}
+
+/* Q15 x Q24 gain (rounded) */
+static inline int32_t
+fxp_mul_gain(int32_t a, int32_t gain)
+{
+	return (int32_t) (((int64_t) a * gain +
+			   (1 << (FXP_Q24_BITS - 1))) >> FXP_Q24_BITS);
+}
+
+static inline int32_t
+fxp_gain_from_float(float x)
+{
+	return (int32_t) lrintf(x * (float) (1 << FXP_Q24_BITS));
+}
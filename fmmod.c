@@ -22,6 +22,7 @@
 #endif
 #include "utils.h"
 #include "fmmod.h"
+#include "fixed_point.h"
 #include <jack/transport.h>
 #include <jack/thread.h>	/* For thread handling through jack */
 #include <stdlib.h>		/* For malloc() */
@@ -33,6 +34,7 @@
 #include <fcntl.h>		/* For O_* and F_* constants */
 #include <errno.h>		/* For errno and EEXIST */
 #include <math.h>		/* For fmin/fmax */
+#include <time.h>		/* For clock_gettime() */
 
 /*********\
 * HELPERS *
@@ -49,6 +51,30 @@ num_resampled_samples(int in_srate, int out_srate, int num_samples)
 }
 
 
+/* Set a new target for the ramp, to be reached
+ * after num_samples */
+static inline void
+fmmod_ramp_set(struct fmmod_ramp *ramp, float target, uint32_t num_samples)
+{
+	ramp->start = ramp->end;
+	ramp->end = target;
+	ramp->step = (ramp->end - ramp->start) / (float) num_samples;
+}
+
+/* Get the ramp's value for the i-th sample */
+static inline float
+fmmod_ramp_get(const struct fmmod_ramp *ramp, uint32_t i)
+{
+	return ramp->start + ramp->step * (float) (i + 1);
+}
+
+static inline int
+fmmod_ramp_is_zero(const struct fmmod_ramp *ramp)
+{
+	return ramp->start == 0.0 && ramp->end == 0.0;
+}
+
+
 static int
 write_to_sock(struct fmmod_instance *fmmod, const float *samples, int num_samples)
 {
@@ -94,25 +120,42 @@ write_to_sock(struct fmmod_instance *fmmod, const float *samples, int num_sample
  * available
  */
 static int
-fmmod_mono_generator(struct fmmod_instance *fmmod, const float* lpr,
-		     __attribute__((unused)) const float* lmr,
-		     int num_samples, float* out)
+fmmod_mono_generator(struct fmmod_instance *fmmod, uint32_t offset,
+		     int num_samples)
 {
 	struct osc_state *sin_osc = &fmmod->sin_osc;
-	const struct fmmod_control *ctl = fmmod->ctl;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	const float *lpr = fmmod->uaudio_buf_0 + offset;
+	const float *rds_buf = fmmod->rds_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	float aux = 0.0;
+	float mpx_gain = 0.0;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
 	int i = 0;
 
 	/* No stereo pilot / subcarrier */
 	for(i = 0; i < num_samples; i++) {
 		/* L + R */
 		out[i] = lpr[i];
+		aux = 0.0;
 
 		/* RDS symbols modulated by the 57KHz carrier (3 x Pilot) */
-		out[i] += ctl->rds_gain * osc_get_57Khz_sample(sin_osc) *
-					  rds_get_next_sample(&fmmod->rds_enc);
+		if (rds)
+			aux += fmmod_ramp_get(&gains->rds, offset + i) *
+			       osc_get_57Khz_sample(sin_osc) * rds_buf[i];
 
-		/* Set mpx gain percentage */
-		out[i] *= ctl->mpx_gain;
+		/* Subcarriers above RDS */
+		if (sca)
+			aux += sca_buf[i];
+
+		/* Set mpx gain percentage, also keep the pilot / RDS
+		 * part on its own for the composite limiter */
+		mpx_gain = fmmod_ramp_get(&gains->mpx, offset + i);
+		out[i] = (out[i] + aux) * mpx_gain;
+		aux_out[i] = aux * mpx_gain;
 
 		osc_increase_phase(sin_osc);
 	}
@@ -127,11 +170,21 @@ fmmod_mono_generator(struct fmmod_instance *fmmod, const float* lpr,
  * at 38KHz (twice the pilot's frequency)
  */
 static int
-fmmod_dsb_generator(struct fmmod_instance *fmmod, const float* lpr,
-		    const float* lmr, int num_samples, float* out)
+fmmod_dsb_generator(struct fmmod_instance *fmmod, uint32_t offset,
+		    int num_samples)
 {
 	struct osc_state *sin_osc = &fmmod->sin_osc;
-	const struct fmmod_control *ctl = fmmod->ctl;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	const float *lpr = fmmod->uaudio_buf_0 + offset;
+	const float *lmr = fmmod->uaudio_buf_1 + offset;
+	const float *rds_buf = fmmod->rds_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	float aux = 0.0;
+	float mpx_gain = 0.0;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
 	int i = 0;
 
 	for(i = 0; i < num_samples; i++) {
@@ -139,18 +192,27 @@ fmmod_dsb_generator(struct fmmod_instance *fmmod, const float* lpr,
 		out[i] = lpr[i];
 
 		/* Stereo Pilot at 19KHz */
-		out[i] += ctl->pilot_gain * osc_get_19Khz_sample(sin_osc);
+		aux = fmmod_ramp_get(&gains->pilot, offset + i) *
+		      osc_get_19Khz_sample(sin_osc);
 
 		/* AM modulated L - R */
 		out[i] += lmr[i] * osc_get_38Khz_sample(sin_osc) *
-			           ctl->stereo_carrier_gain;
+			  fmmod_ramp_get(&gains->stereo_carrier, offset + i);
 
 		/* RDS symbols modulated by the 57KHz carrier (3 x Pilot) */
-		out[i] += ctl->rds_gain * osc_get_57Khz_sample(sin_osc) *
-					  rds_get_next_sample(&fmmod->rds_enc);
+		if (rds)
+			aux += fmmod_ramp_get(&gains->rds, offset + i) *
+			       osc_get_57Khz_sample(sin_osc) * rds_buf[i];
 
-		/* Set mpx gain percentage */
-		out[i] *= ctl->mpx_gain;
+		/* Subcarriers above RDS */
+		if (sca)
+			aux += sca_buf[i];
+
+		/* Set mpx gain percentage, also keep the pilot / RDS
+		 * part on its own for the composite limiter */
+		mpx_gain = fmmod_ramp_get(&gains->mpx, offset + i);
+		out[i] = (out[i] + aux) * mpx_gain;
+		aux_out[i] = aux * mpx_gain;
 
 		osc_increase_phase(sin_osc);
 	}
@@ -158,6 +220,243 @@ fmmod_dsb_generator(struct fmmod_instance *fmmod, const float* lpr,
 	return 0;
 }
 
+
+/************************\
+* FIXED-POINT GENERATORS *
+\************************/
+
+/*
+ * The above two in Q15, see FMMOD_FIXED_POINT_ENV. The carriers come
+ * from the oscilator's fixed-point tables and the RDS waveform from
+ * rds_q15_buf, the audio and the subcarriers get converted on the way
+ * in since the upsamplers work in floating point. On the way out the
+ * MPX goes to umpx_q14_buf for the fixed-point downsampler, unless the
+ * composite limiter needs it (and aux_buf) in floating point. The
+ * oscilator's phase only moves once per tile.
+ */
+
+static inline void
+fmmod_fxp_ramp_init(struct fmmod_fxp_ramp *fxr, const struct fmmod_ramp *ramp,
+		    uint32_t offset)
+{
+	fxr->start = fxp_gain_from_float(ramp->start +
+					 ramp->step * (float) offset);
+	fxr->step = fxp_gain_from_float(ramp->step);
+}
+
+/* Get the ramp's value for the i-th sample of the tile */
+static inline int32_t
+fmmod_fxp_ramp_get(const struct fmmod_fxp_ramp *fxr, uint32_t i)
+{
+	return fxr->start + fxr->step * (int32_t) (i + 1);
+}
+
+static int
+fmmod_mono_generator_fxp(struct fmmod_instance *fmmod, uint32_t offset,
+			 int num_samples)
+{
+	struct osc_state *sin_osc = &fmmod->sin_osc;
+	const struct osc_fxp_carriers *carriers = &fmmod->fxp_carriers;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	const float *lpr = fmmod->uaudio_buf_0 + offset;
+	const int16_t *rds_buf = fmmod->rds_q15_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	int16_t *q14_out = fmmod->umpx_q14_buf + offset;
+	struct fmmod_fxp_ramp rds_gain = {0};
+	struct fmmod_fxp_ramp mpx_gain = {0};
+	int32_t mpx = 0;
+	int32_t aux = 0;
+	int32_t gain = 0;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
+	int q14 = fmmod->plan.fxp_mpx;
+	uint32_t pos = 0;
+	int i = 0;
+
+	fmmod_fxp_ramp_init(&rds_gain, &gains->rds, offset);
+	fmmod_fxp_ramp_init(&mpx_gain, &gains->mpx, offset);
+	pos = osc_get_position(sin_osc) % OSC_FXP_PERIOD;
+
+	for(i = 0; i < num_samples; i++) {
+		/* L + R */
+		mpx = fxp_from_float(lpr[i]);
+		aux = 0;
+
+		/* RDS symbols modulated by the 57KHz carrier */
+		if (rds)
+			aux += fxp_mul_gain(fxp_mul(rds_buf[i],
+						    carriers->rds[pos]),
+					    fmmod_fxp_ramp_get(&rds_gain, i));
+
+		/* Subcarriers above RDS */
+		if (sca)
+			aux += fxp_from_float(sca_buf[i]);
+
+		gain = fmmod_fxp_ramp_get(&mpx_gain, i);
+		if (q14) {
+			q14_out[i] = fxp_q14_from_q15(fxp_mul_gain(mpx + aux,
+								   gain));
+		} else {
+			out[i] = fxp_to_float(fxp_mul_gain(mpx + aux, gain));
+			aux_out[i] = fxp_to_float(fxp_mul_gain(aux, gain));
+		}
+
+		if (++pos == OSC_FXP_PERIOD)
+			pos = 0;
+	}
+
+	osc_advance_phase(sin_osc, num_samples);
+
+	return 0;
+}
+
+static int
+fmmod_dsb_generator_fxp(struct fmmod_instance *fmmod, uint32_t offset,
+			int num_samples)
+{
+	struct osc_state *sin_osc = &fmmod->sin_osc;
+	const struct osc_fxp_carriers *carriers = &fmmod->fxp_carriers;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	const float *lpr = fmmod->uaudio_buf_0 + offset;
+	const float *lmr = fmmod->uaudio_buf_1 + offset;
+	const int16_t *rds_buf = fmmod->rds_q15_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	int16_t *q14_out = fmmod->umpx_q14_buf + offset;
+	struct fmmod_fxp_ramp pilot_gain = {0};
+	struct fmmod_fxp_ramp stereo_gain = {0};
+	struct fmmod_fxp_ramp rds_gain = {0};
+	struct fmmod_fxp_ramp mpx_gain = {0};
+	int32_t mpx = 0;
+	int32_t aux = 0;
+	int32_t gain = 0;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
+	int q14 = fmmod->plan.fxp_mpx;
+	uint32_t pos = 0;
+	int i = 0;
+
+	fmmod_fxp_ramp_init(&pilot_gain, &gains->pilot, offset);
+	fmmod_fxp_ramp_init(&stereo_gain, &gains->stereo_carrier, offset);
+	fmmod_fxp_ramp_init(&rds_gain, &gains->rds, offset);
+	fmmod_fxp_ramp_init(&mpx_gain, &gains->mpx, offset);
+	pos = osc_get_position(sin_osc) % OSC_FXP_PERIOD;
+
+	for(i = 0; i < num_samples; i++) {
+		/* L + R */
+		mpx = fxp_from_float(lpr[i]);
+
+		/* Stereo Pilot at 19KHz */
+		aux = fxp_mul_gain(carriers->pilot[pos],
+				   fmmod_fxp_ramp_get(&pilot_gain, i));
+
+		/* AM modulated L - R */
+		mpx += fxp_mul_gain(fxp_mul(fxp_from_float(lmr[i]),
+					    carriers->stereo[pos]),
+				    fmmod_fxp_ramp_get(&stereo_gain, i));
+
+		/* RDS symbols modulated by the 57KHz carrier */
+		if (rds)
+			aux += fxp_mul_gain(fxp_mul(rds_buf[i],
+						    carriers->rds[pos]),
+					    fmmod_fxp_ramp_get(&rds_gain, i));
+
+		/* Subcarriers above RDS */
+		if (sca)
+			aux += fxp_from_float(sca_buf[i]);
+
+		gain = fmmod_fxp_ramp_get(&mpx_gain, i);
+		if (q14) {
+			q14_out[i] = fxp_q14_from_q15(fxp_mul_gain(mpx + aux,
+								   gain));
+		} else {
+			out[i] = fxp_to_float(fxp_mul_gain(mpx + aux, gain));
+			aux_out[i] = fxp_to_float(fxp_mul_gain(aux, gain));
+		}
+
+		if (++pos == OSC_FXP_PERIOD)
+			pos = 0;
+	}
+
+	osc_advance_phase(sin_osc, num_samples);
+
+	return 0;
+}
+
+/*
+ * Run a tile of test signals through the floating point and the
+ * fixed-point DSB generators and return the SNR of the latter (in dB),
+ * with the gains ramping up so that the Q24 ramps get checked as well.
+ * Meant to run on init, before the first period.
+ */
+static float
+fmmod_fxp_measure_snr(struct fmmod_instance *fmmod)
+{
+	const struct osc_state saved_osc = fmmod->sin_osc;
+	struct fmmod_gains *gains = &fmmod->gains;
+	struct fmmod_plan *plan = &fmmod->plan;
+	float *ref = fmmod->sca_carrier_buf;
+	uint32_t len = FMMOD_TILE_SAMPLES;
+	double signal = 0.0;
+	double noise = 0.0;
+	double err = 0.0;
+	double t = 0.0;
+	uint32_t i = 0;
+
+	if (len > fmmod->upsampled_num_samples)
+		len = fmmod->upsampled_num_samples;
+
+	for (i = 0; i < len; i++) {
+		t = 2.0 * M_PI * (double) i / (double) OSC_SAMPLE_RATE;
+		fmmod->uaudio_buf_0[i] = (float) (0.6 * sin(1000.0 * t) +
+						  0.3 * sin(9500.0 * t));
+		fmmod->uaudio_buf_1[i] = (float) (0.5 * sin(2300.0 * t) +
+						  0.2 * sin(14000.0 * t));
+		fmmod->rds_buf[i] = (float) sin(1187.5 * t);
+		fmmod->rds_q15_buf[i] = fxp_q15_from_float(fmmod->rds_buf[i]);
+	}
+
+	memset(gains, 0, sizeof(struct fmmod_gains));
+	fmmod_ramp_set(&gains->pilot, 0.08, len);
+	fmmod_ramp_set(&gains->stereo_carrier, 1.0, len);
+	fmmod_ramp_set(&gains->rds, 0.1, len);
+	fmmod_ramp_set(&gains->mpx, 1.0, len);
+	plan->rds = 1;
+	plan->sca = 0;
+	plan->fxp_mpx = 0;
+
+	fmmod_dsb_generator(fmmod, 0, len);
+	memcpy(ref, fmmod->umpxbuf, len * sizeof(float));
+	fmmod->sin_osc = saved_osc;
+
+	fmmod_dsb_generator_fxp(fmmod, 0, len);
+	fmmod->sin_osc = saved_osc;
+
+	for (i = 0; i < len; i++) {
+		err = (double) fmmod->umpxbuf[i] - (double) ref[i];
+		signal += (double) ref[i] * (double) ref[i];
+		noise += err * err;
+	}
+
+	/* Leave everything as we found it */
+	memset(gains, 0, sizeof(struct fmmod_gains));
+	plan->rds = 0;
+	memset(fmmod->uaudio_buf_0, 0, len * sizeof(float));
+	memset(fmmod->uaudio_buf_1, 0, len * sizeof(float));
+	memset(fmmod->rds_buf, 0, len * sizeof(float));
+	memset(fmmod->rds_q15_buf, 0, len * sizeof(int16_t));
+	memset(fmmod->umpxbuf, 0, len * sizeof(float));
+	memset(fmmod->aux_buf, 0, len * sizeof(float));
+	memset(ref, 0, len * sizeof(float));
+
+	if (noise <= 0.0)
+		return 200.0;
+	return (float) (10.0 * log10(signal / noise));
+}
+
 /*
  * Single Side Band modulation
  *
@@ -184,11 +483,21 @@ fmmod_dsb_generator(struct fmmod_instance *fmmod, const float* lpr,
  * the carrier (the upper side band).
  */
 static int
-fmmod_ssb_lpf_generator(struct fmmod_instance *fmmod, const float* lpr,
-			const float* lmr, int num_samples, float* out)
+fmmod_ssb_lpf_generator(struct fmmod_instance *fmmod, uint32_t offset,
+			int num_samples)
 {
 	struct osc_state *sin_osc = &fmmod->sin_osc;
-	const struct fmmod_control *ctl = fmmod->ctl;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	const float *lpr = fmmod->uaudio_buf_0 + offset;
+	const float *lmr = fmmod->uaudio_buf_1 + offset;
+	const float *rds_buf = fmmod->rds_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	float aux = 0.0;
+	float mpx_gain = 0.0;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
 	const struct fmmod_flts *flts = &fmmod->flts;
 	double saved_phase = 0.0L;
 	int i = 0;
@@ -211,26 +520,35 @@ fmmod_ssb_lpf_generator(struct fmmod_instance *fmmod, const float* lpr,
 	saved_phase = sin_osc->current_phase;
 	for(i = 0; i < num_samples; i++) {
 		out[i] += lmr[i] * osc_get_38Khz_sample(sin_osc);
+		out[i] *= fmmod_ramp_get(&gains->stereo_carrier, offset + i);
 		osc_increase_phase(sin_osc);
 	}
 	sin_osc->current_phase = saved_phase;
 
 	/* Apply the lpf filter to suppres the USB of L-R */
-	lpf_filter_apply(&flts->ssb_lpf, out, out,
-		    num_samples, ctl->stereo_carrier_gain * 2.0);
+	lpf_filter_apply(&flts->ssb_lpf, out, out, num_samples, 2.0);
 
 	/* Now add the rest */
 	for(i = 0; i < num_samples; i++) {
 
 		/* Stereo Pilot at 19KHz */
-		out[i] += ctl->pilot_gain * osc_get_19Khz_sample(sin_osc);
+		aux = fmmod_ramp_get(&gains->pilot, offset + i) *
+		      osc_get_19Khz_sample(sin_osc);
 
 		/* RDS symbols modulated by the 57KHz carrier (3 x Pilot) */
-		out[i] += ctl->rds_gain * osc_get_57Khz_sample(sin_osc) *
-					  rds_get_next_sample(&fmmod->rds_enc);
+		if (rds)
+			aux += fmmod_ramp_get(&gains->rds, offset + i) *
+			       osc_get_57Khz_sample(sin_osc) * rds_buf[i];
 
-		/* Set mpx gain percentage */
-		out[i] *= ctl->mpx_gain;
+		/* Subcarriers above RDS */
+		if (sca)
+			aux += sca_buf[i];
+
+		/* Set mpx gain percentage, also keep the pilot / RDS
+		 * part on its own for the composite limiter */
+		mpx_gain = fmmod_ramp_get(&gains->mpx, offset + i);
+		out[i] = (out[i] + aux) * mpx_gain;
+		aux_out[i] = aux * mpx_gain;
 
 		osc_increase_phase(sin_osc);
 	}
@@ -248,21 +566,32 @@ fmmod_ssb_lpf_generator(struct fmmod_instance *fmmod, const float* lpr,
  * http://dp.nonoo.hu/projects/ham-dsp-tutorial/09-ssb-hartley/
  */
 static int
-fmmod_ssb_hartley_generator(struct fmmod_instance *fmmod, const float* lpr,
-			   const float* lmr, int num_samples, float* out)
+fmmod_ssb_hartley_generator(struct fmmod_instance *fmmod, uint32_t offset,
+			    int num_samples)
 {
 	struct osc_state *sin_osc = &fmmod->sin_osc;
 	struct osc_state *cos_osc = &fmmod->cos_osc;
-	const struct fmmod_control *ctl = fmmod->ctl;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	float *lpr = fmmod->uaudio_buf_0 + offset;
+	float *lmr = fmmod->uaudio_buf_1 + offset;
+	const float *rds_buf = fmmod->rds_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	float aux = 0.0;
+	float mpx_gain = 0.0;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
 	const struct fmmod_flts *flts = &fmmod->flts;
-	const struct hilbert_transformer_data *ht = &flts->ht;
 	float carrier_freq = 38000.0;
 	int i = 0;
 
-	/* Phase shift L-R by 90deg using the Hilbert transformer */
-	hilbert_transformer_apply(&flts->ht, lmr, num_samples);
-
-	/* Now shifted L-R signal is in ht->real_buff */
+	/* Phase shift L-R by 90deg using the Hilbert transformer, the
+	 * shifted signal goes to the output buffer and L-R gets delayed
+	 * to match the transformer's delay. Also delay L+R by the same
+	 * amount to keep it aligned with L-R. */
+	hilbert_transformer_apply(&flts->ht, lmr, lmr, out, num_samples);
+	hilbert_transformer_delay(&flts->ht, lpr, num_samples);
 
 	for(i = 0; i < num_samples; i++) {
 		/* Phase lock the ssb oscilator to the master
@@ -275,25 +604,34 @@ fmmod_ssb_hartley_generator(struct fmmod_instance *fmmod, const float* lpr,
 		 * -to preserve the phase difference also on the carrier-. Then
 		 * add them to get the lower sideband (the upper sideband will
 		 * be canceled-out) */
-		out[i] =  ht->real_buff[i] *
-			  osc_get_sample_for_freq(cos_osc, carrier_freq);
+		out[i] *= osc_get_sample_for_freq(cos_osc, carrier_freq);
 		out[i] += lmr[i] *
 			  osc_get_sample_for_freq(sin_osc, carrier_freq);
 
-		out[i] *= ctl->stereo_carrier_gain * 1.5;
+		out[i] *= fmmod_ramp_get(&gains->stereo_carrier, offset + i) *
+			  1.5;
 
 		/* L + R */
 		out[i] += lpr[i];
 
 		/* Stereo Pilot at 19KHz */
-		out[i] += ctl->pilot_gain * osc_get_19Khz_sample(sin_osc);
+		aux = fmmod_ramp_get(&gains->pilot, offset + i) *
+		      osc_get_19Khz_sample(sin_osc);
 
 		/* RDS symbols modulated by the 57KHz carrier (3 x Pilot) */
-		out[i] += ctl->rds_gain * osc_get_57Khz_sample(sin_osc) *
-					  rds_get_next_sample(&fmmod->rds_enc);
+		if (rds)
+			aux += fmmod_ramp_get(&gains->rds, offset + i) *
+			       osc_get_57Khz_sample(sin_osc) * rds_buf[i];
 
-		/* Set mpx gain percentage */
-		out[i] *= ctl->mpx_gain;
+		/* Subcarriers above RDS */
+		if (sca)
+			aux += sca_buf[i];
+
+		/* Set mpx gain percentage, also keep the pilot / RDS
+		 * part on its own for the composite limiter */
+		mpx_gain = fmmod_ramp_get(&gains->mpx, offset + i);
+		out[i] = (out[i] + aux) * mpx_gain;
+		aux_out[i] = aux * mpx_gain;
 
 		osc_increase_phase(sin_osc);
 	}
@@ -302,166 +640,1885 @@ fmmod_ssb_hartley_generator(struct fmmod_instance *fmmod, const float* lpr,
 }
 
 
-/*******************\
-* PROCESSING THREAD *
-\*******************/
+/************************\
+* WEAVER MODULATOR (SSB) *
+\************************/
 
-static void*
-fmmod_process(struct fmmod_instance *fmmod)
+/*
+ * The Weaver (or third) method for SSB, proposed by D. K. Weaver
+ * in 1956 ("A Third Method of Generation and Detection of
+ * Single-Sideband Signals").
+ *
+ * L-R is mixed with a first LO at the middle of the audio band
+ * (lo_freq), which folds the band around DC, and the resulting I/Q
+ * pair is low-pass filtered at lo_freq to drop the folded-over
+ * part. This happens at the input sample rate, before upsampling, so
+ * a short FIR is enough, instead of filtering at 228KHz like the LPF
+ * and the Hartley modulators do. Then I/Q get upsampled and mixed
+ * with a second LO at 38KHz - lo_freq, which moves the band below
+ * the 38KHz carrier, leaving only the lower sideband.
+ *
+ * Near the carrier (low audio frequencies) both sidebands fall within
+ * the FIR's transition band, so we get a vestigial sideband there
+ * with complementary levels, which a stereo decoder handles just fine.
+ *
+ * L+R, I and Q go through identical band-limited upsamplers that
+ * start together, so they stay aligned, and L+R is delayed by the
+ * same amount as the FIR delays I/Q. The second LO needs to follow
+ * the phase the first LO had when the upsampled samples went in, so
+ * the delay of the FIR and of the upsamplers at lo_freq is measured
+ * when creating the modulator (delay_phase) and taken into account.
+ */
+
+/*
+ * Mix L-R with the first LO and filter it, delay L+R to match,
+ * and upsample all three. The upsampled L+R / I go to lpr_out /
+ * lmr_out and Q to the weaver's q_out.
+ */
+static int
+fmmod_weaver_upsample(struct fmmod_instance *fmmod, const float *lpr_in,
+		      const float *lmr_in, float *lpr_out, float *lmr_out)
 {
-	struct resampler_data *rsmpl = &fmmod->rsmpl;
-	const struct fmmod_flts *flts = &fmmod->flts;
+	struct fmmod_weaver *weaver = &fmmod->weaver;
+	const struct resampler_data *rsmpl = &fmmod->rsmpl;
+	int frames_generated[3] = {0};
+	uint32_t i = 0;
+
+	/* Primed by the housekeeping thread, see fmmod_weaver_prime() */
+	weaver->running = 1;
+
+	/* Get the first LO's cosine / sine on I / Q and mix them
+	 * with L-R, the NCO only runs for this period, the phase
+	 * we keep track of moves forward once per period */
+	osc_nco_set_phase(&weaver->lo_nco, weaver->lo_phase);
+	osc_nco_run_quadrature(&weaver->lo_nco, weaver->q_buf, weaver->i_buf,
+			       fmmod->num_in_samples);
+	for (i = 0; i < fmmod->num_in_samples; i++) {
+		weaver->i_buf[i] *= lmr_in[i];
+		weaver->q_buf[i] *= lmr_in[i];
+	}
+	weaver->lo_phase = fmod(weaver->lo_phase + weaver->lo_step *
+				(double) fmmod->num_in_samples, 2.0L * M_PI);
+
+	fir_filter_delay(&weaver->lpr_delay, lpr_in, weaver->lpr_buf,
+			 fmmod->num_in_samples);
+	fir_filter_apply(&weaver->i_fir, weaver->i_buf, weaver->i_buf,
+			 fmmod->num_in_samples);
+	fir_filter_apply(&weaver->q_fir, weaver->q_buf, weaver->q_buf,
+			 fmmod->num_in_samples);
+
+	frames_generated[0] = resampler_upsample_audio_one(rsmpl,
+						weaver->upsampler_lpr,
+						weaver->lpr_buf, lpr_out,
+						fmmod->num_in_samples,
+						fmmod->upsampled_num_samples);
+	frames_generated[1] = resampler_upsample_audio_one(rsmpl,
+						weaver->upsampler_i,
+						weaver->i_buf, lmr_out,
+						fmmod->num_in_samples,
+						fmmod->upsampled_num_samples);
+	frames_generated[2] = resampler_upsample_audio_one(rsmpl,
+						weaver->upsampler_q,
+						weaver->q_buf, weaver->q_out,
+						fmmod->num_in_samples,
+						fmmod->upsampled_num_samples);
+
+	/* They are identical and got the same input, so they
+	 * should always generate the same number of frames */
+	if (unlikely(frames_generated[0] != frames_generated[1] ||
+		     frames_generated[0] != frames_generated[2]))
+		return -1;
+
+	return frames_generated[0];
+}
+
+static int
+fmmod_ssb_weaver_generator(struct fmmod_instance *fmmod, uint32_t offset,
+			   int num_samples)
+{
+	struct osc_state *sin_osc = &fmmod->sin_osc;
+	struct fmmod_weaver *weaver = &fmmod->weaver;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	const float *lpr = fmmod->uaudio_buf_0 + offset;
+	const float *lmr = fmmod->uaudio_buf_1 + offset;
+	const float *rds_buf = fmmod->rds_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	float aux = 0.0;
+	float mpx_gain = 0.0;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
+	const float *q = weaver->q_out + offset;
+	const float *lo_sin = weaver->lo_sin;
+	const float *lo_cos = weaver->lo_cos;
+	int i = 0;
+
+	/* The second LO, at 38KHz - lo_freq, phase locked to the
+	 * master oscilator at the start of each run */
+	osc_nco_set_phase(&weaver->lo_out_nco,
+			  sin_osc->current_phase * 38000.0L -
+			  (weaver->lo_out_phase - weaver->delay_phase));
+	osc_nco_run_quadrature(&weaver->lo_out_nco, weaver->lo_sin,
+			       weaver->lo_cos, num_samples);
+	weaver->lo_out_phase = fmod(weaver->lo_out_phase +
+				    weaver->lo_out_step *
+				    (double) num_samples, 2.0L * M_PI);
+
+	for(i = 0; i < num_samples; i++) {
+		/* L-R SSB (lower sideband) */
+		out[i] = lmr[i] * lo_sin[i] + q[i] * lo_cos[i];
+
+		out[i] *= fmmod_ramp_get(&gains->stereo_carrier, offset + i) *
+			  2.0;
+
+		/* L + R */
+		out[i] += lpr[i];
+
+		/* Stereo Pilot at 19KHz */
+		aux = fmmod_ramp_get(&gains->pilot, offset + i) *
+		      osc_get_19Khz_sample(sin_osc);
+
+		/* RDS symbols modulated by the 57KHz carrier (3 x Pilot) */
+		if (rds)
+			aux += fmmod_ramp_get(&gains->rds, offset + i) *
+			       osc_get_57Khz_sample(sin_osc) * rds_buf[i];
+
+		/* Subcarriers above RDS */
+		if (sca)
+			aux += sca_buf[i];
+
+		/* Set mpx gain percentage, also keep the pilot / RDS
+		 * part on its own for the composite limiter */
+		mpx_gain = fmmod_ramp_get(&gains->mpx, offset + i);
+		out[i] = (out[i] + aux) * mpx_gain;
+		aux_out[i] = aux * mpx_gain;
+
+		osc_increase_phase(sin_osc);
+	}
+
+	return 0;
+}
+
+/*
+ * Start all three upsamplers from the same point and sync the LOs
+ * to their timelines. This is slow (the upsamplers get cleared and
+ * primed), so it's done by the housekeeping thread, when creating the
+ * modulator and after the processing thread left it idle (stale).
+ */
+static int
+fmmod_weaver_prime(const struct fmmod_instance *fmmod,
+		   struct fmmod_weaver *weaver)
+{
+	const struct resampler_data *rsmpl = &fmmod->rsmpl;
+	uint64_t in_frames[3] = {0};
+	uint64_t out_frames[3] = {0};
+	int ret = 0;
+
+	fir_filter_reset(&weaver->i_fir);
+	fir_filter_reset(&weaver->q_fir);
+	fir_filter_reset(&weaver->lpr_delay);
+	ret |= resampler_reset_audio_upsampler(rsmpl, weaver->upsampler_lpr,
+					       &in_frames[0], &out_frames[0]);
+	ret |= resampler_reset_audio_upsampler(rsmpl, weaver->upsampler_i,
+					       &in_frames[1], &out_frames[1]);
+	ret |= resampler_reset_audio_upsampler(rsmpl, weaver->upsampler_q,
+					       &in_frames[2], &out_frames[2]);
+	if (ret < 0)
+		return -1;
+
+	weaver->lo_phase = fmod(weaver->lo_step * (double) in_frames[0],
+				2.0L * M_PI);
+	weaver->lo_out_phase = fmod(weaver->lo_out_step *
+				    (double) out_frames[0], 2.0L * M_PI);
+
+	return 0;
+}
+
+static void
+fmmod_weaver_destroy(const struct fmmod_weaver *weaver)
+{
+	fir_filter_destroy(&weaver->i_fir);
+	fir_filter_destroy(&weaver->q_fir);
+	fir_filter_destroy(&weaver->lpr_delay);
+	if (weaver->upsampler_lpr)
+		soxr_delete(weaver->upsampler_lpr);
+	if (weaver->upsampler_i)
+		soxr_delete(weaver->upsampler_i);
+	if (weaver->upsampler_q)
+		soxr_delete(weaver->upsampler_q);
+	if (weaver->lpr_buf)
+		free(weaver->lpr_buf);
+	if (weaver->i_buf)
+		free(weaver->i_buf);
+	if (weaver->q_buf)
+		free(weaver->q_buf);
+	if (weaver->q_out)
+		free(weaver->q_out);
+	if (weaver->lo_sin)
+		free(weaver->lo_sin);
+	if (weaver->lo_cos)
+		free(weaver->lo_cos);
+}
+
+/*
+ * The first LO goes at the middle of the audio band, as set for the
+ * pilot protection filter, and the upsamplers use the same design.
+ */
+static int
+fmmod_weaver_init(const struct fmmod_instance *fmmod,
+		  struct fmmod_weaver *weaver)
+{
+	const struct resampler_data *rsmpl = &fmmod->rsmpl;
+	uint32_t passband_end = fmmod->audio_lpf_cutoff;
+	uint32_t stopband_begin = fmmod->audio_lpf_cutoff +
+				  fmmod->audio_lpf_transition;
+	double upsampler_phase = 0.0L;
+	int ret = 0;
+
+	memset(weaver, 0, sizeof(struct fmmod_weaver));
+
+	weaver->lo_freq = (double) fmmod->audio_lpf_cutoff / 2.0L;
+	weaver->lo_step = 2.0L * M_PI * weaver->lo_freq /
+			  (double) rsmpl->audio_samplerate;
+	weaver->lo_out_step = 2.0L * M_PI * weaver->lo_freq /
+			      (double) rsmpl->osc_samplerate;
+
+	ret = osc_nco_init(&weaver->lo_nco, rsmpl->audio_samplerate,
+			   (float) weaver->lo_freq);
+	ret |= osc_nco_init(&weaver->lo_out_nco, rsmpl->osc_samplerate,
+			    (float) (38000.0L - weaver->lo_freq));
+	if (ret < 0) {
+		utils_err("[FMMOD] Could not initialize the Weaver LOs\n");
+		ret = FMMOD_ERR_OSC_ERR;
+		goto cleanup;
+	}
+
+	ret = fir_filter_init(&weaver->i_fir, WEAVER_FIR_TAPS,
+			      fmmod->num_in_samples, weaver->lo_freq,
+			      rsmpl->audio_samplerate);
+	ret |= fir_filter_init(&weaver->q_fir, WEAVER_FIR_TAPS,
+			       fmmod->num_in_samples, weaver->lo_freq,
+			       rsmpl->audio_samplerate);
+	ret |= fir_filter_init(&weaver->lpr_delay, WEAVER_FIR_TAPS,
+			       fmmod->num_in_samples, weaver->lo_freq,
+			       rsmpl->audio_samplerate);
+	if (ret < 0) {
+		utils_err("[FMMOD] FIR filter init failed\n");
+		ret = FMMOD_ERR_AFLT;
+		goto cleanup;
+	}
+
+	ret = resampler_create_audio_upsampler(rsmpl, passband_end,
+					       stopband_begin,
+					       &weaver->upsampler_lpr);
+	ret |= resampler_create_audio_upsampler(rsmpl, passband_end,
+						stopband_begin,
+						&weaver->upsampler_i);
+	ret |= resampler_create_audio_upsampler(rsmpl, passband_end,
+						stopband_begin,
+						&weaver->upsampler_q);
+	if (ret < 0) {
+		ret = FMMOD_ERR_RESAMPLER_ERR;
+		goto cleanup;
+	}
+
+	weaver->lpr_buf = (float *) malloc(fmmod->num_in_samples *
+					   sizeof(float));
+	weaver->i_buf = (float *) malloc(fmmod->num_in_samples *
+					 sizeof(float));
+	weaver->q_buf = (float *) malloc(fmmod->num_in_samples *
+					 sizeof(float));
+	weaver->q_out = (float *) malloc(fmmod->upsampled_num_samples *
+					 sizeof(float));
+	weaver->lo_sin = (float *) malloc(fmmod->upsampled_num_samples *
+					  sizeof(float));
+	weaver->lo_cos = (float *) malloc(fmmod->upsampled_num_samples *
+					  sizeof(float));
+	if (!weaver->lpr_buf || !weaver->i_buf || !weaver->q_buf ||
+	    !weaver->q_out || !weaver->lo_sin || !weaver->lo_cos) {
+		ret = FMMOD_ERR_NOMEM;
+		goto cleanup;
+	}
+
+	/* Total phase delay of I/Q at lo_freq, the FIR filter delays
+	 * them by (num_taps - 1) / 2 samples at the input sample rate */
+	ret = resampler_measure_phase_delay(rsmpl, weaver->upsampler_i,
+					    weaver->lo_freq, &upsampler_phase);
+	if (ret < 0) {
+		utils_err("[FMMOD] Could not measure upsampler delay: %i\n",
+			  ret);
+		ret = FMMOD_ERR_RESAMPLER_ERR;
+		goto cleanup;
+	}
+	weaver->delay_phase = fmod(upsampler_phase + weaver->lo_step *
+				   (double) ((WEAVER_FIR_TAPS - 1) / 2),
+				   2.0L * M_PI);
+
+	utils_dbg("[FMMOD] LO at %.1fHz, phase delay %.3frad\n",
+		  weaver->lo_freq, weaver->delay_phase);
+
+	ret = fmmod_weaver_prime(fmmod, weaver);
+	if (ret < 0) {
+		utils_err("[FMMOD] Could not prime the Weaver upsamplers\n");
+		ret = FMMOD_ERR_RESAMPLER_ERR;
+		goto cleanup;
+	}
+
+ cleanup:
+	if (ret < 0)
+		fmmod_weaver_destroy(weaver);
+	return ret;
+}
+
+/* Swap it out between periods and destroy it */
+static void
+fmmod_release_weaver(struct fmmod_instance *fmmod)
+{
+	struct fmmod_weaver weaver;
+
+	if (!fmmod->weaver_active)
+		return;
+
+	pthread_mutex_lock(&fmmod->proc_mutex);
+	weaver = fmmod->weaver;
+	memset(&fmmod->weaver, 0, sizeof(struct fmmod_weaver));
+	fmmod->weaver_active = 0;
+	pthread_mutex_unlock(&fmmod->proc_mutex);
+
+	fmmod_weaver_destroy(&weaver);
+	utils_dbg("[FMMOD] Weaver modulator released\n");
+}
+
+
+/***********************************\
+* MPX POWER CONTROL (ITU-R BS.412) *
+\***********************************/
+
+/*
+ * ITU-R BS.412 limits the power of the MPX signal, integrated over
+ * any 60 second window, to that of a sine that would give +/-19KHz
+ * deviation (0dBr), some regulators allow a few dB more. We measure
+ * the power at the output, using the energy we get from the level
+ * meter, in one-second bins and keep a running sum of the last
+ * MPXP_WINDOW_SECS bins, so it's O(1) per period.
+ *
+ * The power is controlled through a slowly moving gain on L + R /
+ * L - R, applied before the generator. The pilot is not affected by
+ * it so we also keep track of the power of the audio part alone, as
+ * if it didn't go through our gain. From that we know which gain
+ * would bring the integrated power to the limit, and we move towards
+ * it at most MPXP_ATTACK_DB / MPXP_RELEASE_DB per second. RDS is
+ * tiny and we count it as audio, which errs on the safe side.
+ */
+static void
+fmmod_update_mpx_power(struct fmmod_instance *fmmod,
+		       const struct tp_meter_levels *levels)
+{
+	const struct fmmod_control *snap = &fmmod->ctl_snap;
 	struct fmmod_control *ctl = fmmod->ctl;
-	mpx_generator get_mpx_samples;
-	float *left_in = NULL;
-	float *right_in = NULL;
-	float *upsampled_audio_l = NULL;
-	float *upsampled_audio_r = NULL;
-	float *lpr_buf = NULL;
-	float *lmr_buf = NULL;
-	float lpr = 0.0;
-	float lmr = 0.0;
-	int frames_generated = 0;
+	struct mpx_power_control *mpxp = &fmmod->mpxp;
+	double pilot_power = 0.0L;
+	double audio_energy = 0.0L;
+	double audio_power = 0.0L;
+	double power = 0.0L;
+	double gain = 0.0L;
+	double limit = 0.0L;
+	double target_db = 0.0L;
+	double period_secs = 0.0L;
+	uint64_t num_samples = 0;
+	int i = 0;
+
+	if (!levels->num_samples)
+		return;
+
+	if (fmmod->plan.stereo)
+		pilot_power = 0.5L * snap->pilot_gain * snap->pilot_gain *
+			      snap->mpx_gain * snap->mpx_gain;
+
+	/* Undo the gain we applied during this period */
+	gain = 0.5L * (mpxp->gain.start + mpxp->gain.end);
+	if (gain < 0.01L)
+		gain = 0.01L;
+	audio_energy = levels->energy - pilot_power * levels->num_samples;
+	if (audio_energy < 0.0L)
+		audio_energy = 0.0L;
+
+	mpxp->cur_energy += levels->energy;
+	mpxp->cur_audio_energy += audio_energy / (gain * gain);
+	mpxp->cur_num_samples += levels->num_samples;
+
+	/* Move on to the next bin */
+	if (mpxp->cur_num_samples >= FMMOD_OUTPUT_SAMPLERATE) {
+		i = mpxp->bin;
+		mpxp->energy_sum += mpxp->cur_energy - mpxp->energy[i];
+		mpxp->audio_energy_sum += mpxp->cur_audio_energy -
+					  mpxp->audio_energy[i];
+		mpxp->num_samples_sum += mpxp->cur_num_samples;
+		mpxp->num_samples_sum -= mpxp->num_samples[i];
+		mpxp->energy[i] = mpxp->cur_energy;
+		mpxp->audio_energy[i] = mpxp->cur_audio_energy;
+		mpxp->num_samples[i] = mpxp->cur_num_samples;
+		mpxp->cur_energy = 0.0L;
+		mpxp->cur_audio_energy = 0.0L;
+		mpxp->cur_num_samples = 0;
+		mpxp->bin = (i + 1) % MPXP_WINDOW_SECS;
+
+		/* Once per window re-sum the bins, so that rounding
+		 * errors don't pile up on the running sums */
+		if (mpxp->bin == 0) {
+			mpxp->energy_sum = 0.0L;
+			mpxp->audio_energy_sum = 0.0L;
+			for (i = 0; i < MPXP_WINDOW_SECS; i++) {
+				mpxp->energy_sum += mpxp->energy[i];
+				mpxp->audio_energy_sum += mpxp->audio_energy[i];
+			}
+		}
+	}
+
+	num_samples = mpxp->num_samples_sum + mpxp->cur_num_samples;
+	power = (mpxp->energy_sum + mpxp->cur_energy) / (double) num_samples;
+	audio_power = (mpxp->audio_energy_sum + mpxp->cur_audio_energy) /
+		      (double) num_samples;
+
+	/* The gain that would bring the power to the limit */
+	if (snap->use_mpx_power_control && audio_power > 0.0L) {
+		limit = MPXP_REF_POWER * pow(10.0L, snap->mpx_power_limit / 10.0L);
+		limit -= pilot_power;
+		if (limit < 1e-9)
+			limit = 1e-9;
+		target_db = 10.0L * log10(limit / audio_power);
+		if (target_db > 0.0L)
+			target_db = 0.0L;
+	}
+
+	period_secs = (double) levels->num_samples /
+		      (double) FMMOD_OUTPUT_SAMPLERATE;
+	if (target_db < mpxp->gain_db)
+		mpxp->gain_db = fmax(target_db, mpxp->gain_db -
+				     MPXP_ATTACK_DB * period_secs);
+	else
+		mpxp->gain_db = fmin(target_db, mpxp->gain_db +
+				     MPXP_RELEASE_DB * period_secs);
+
+	ctl->mpx_power = power > 0.0L ?
+			 (float) (10.0L * log10(power / MPXP_REF_POWER)) : -99.0;
+	ctl->mpx_power_gain_reduction = (float) -mpxp->gain_db;
+}
+
+
+/*****************\
+* SUBCARRIER BANK *
+\*****************/
+
+/*
+ * Extra subcarriers above RDS (e.g. SCA at 67 / 80KHz), each one FM or
+ * AM modulated by its own JACK input, or a tone. They come from table
+ * based NCOs (see oscilator.c), phase-locked to the pilot, so each one
+ * costs a couple of table lookups per sample. Their sum goes to sca_buf
+ * and the generators add it to the pilot / RDS part of the composite,
+ * so the composite limiter leaves them alone too. The RDS2 streams
+ * (already modulated by the encoder) go to sca_buf as well.
+ */
+
+/* The usual SCA frequency first, the rest leave room for the
+ * default deviation below FMMOD_MPX_WIDE_PASSBAND_END */
+static const float fmmod_sca_default_freqs[FMMOD_SCA_MAX] = {
+	67000.0, 80000.0, 73000.0, 83000.0
+};
+
+/* Max FM deviation that keeps the subcarrier's upper sideband within
+ * the MPX passband (Carson's rule), negative if there isn't any */
+static inline float
+fmmod_sca_max_deviation(float freq)
+{
+	return (float) (FMMOD_MPX_WIDE_PASSBAND_END -
+			FMMOD_SCA_AUDIO_PASSBAND) - freq;
+}
+
+/* Sanitize this period's settings and ramp the levels to their new values */
+static void
+fmmod_sca_update(struct fmmod_instance *fmmod, uint32_t num_samples)
+{
+	struct fmmod_plan *plan = &fmmod->plan;
+	struct fmmod_sca_control *sctl = NULL;
+	struct fmmod_sca *sca = NULL;
+	float levels[FMMOD_SCA_MAX] = {0};
+	float total = 0.0;
+	float scale = 1.0;
+	int i = 0;
+
+	plan->sca_bank = 0;
+	for (i = 0; i < fmmod->num_sca; i++) {
+		sca = &fmmod->sca[i];
+		sctl = &fmmod->ctl_snap.sca[i];
+
+		if (sctl->freq < FMMOD_SCA_MIN_FREQ ||
+		    sctl->freq > FMMOD_SCA_MAX_FREQ)
+			sctl->enabled = 0;
+		if (sctl->tone_freq < 20.0 ||
+		    sctl->tone_freq > FMMOD_SCA_AUDIO_PASSBAND)
+			sctl->tone_freq = 1000.0;
+		if (sctl->modulation == FMMOD_SCA_AM)
+			sctl->deviation = fminf(fmaxf(sctl->deviation, 0.0), 1.0);
+		else
+			sctl->deviation = fminf(fmaxf(sctl->deviation, 0.0),
+						fminf(20000.0,
+						      fmmod_sca_max_deviation(sctl->freq)));
+
+		if (sctl->enabled && sca->carrier.freq != sctl->freq &&
+		    osc_nco_init(&sca->carrier, OSC_SAMPLE_RATE,
+				 sctl->freq) < 0)
+			sctl->enabled = 0;
+		if (sctl->enabled && sctl->source == FMMOD_SCA_SRC_TONE &&
+		    sca->tone.freq != sctl->tone_freq)
+			osc_nco_init(&sca->tone, OSC_SAMPLE_RATE,
+				     sctl->tone_freq);
+
+		if (sctl->enabled && fmmod->dgr.level < FMMOD_DGR_NO_SCA)
+			levels[i] = fminf(fmaxf(sctl->level, 0.0), 1.0);
+		total += levels[i];
+	}
+
+	/* Scale them down together if they'd eat up too much
+	 * of the deviation */
+	if (total > FMMOD_SCA_MAX_INJECTION)
+		scale = FMMOD_SCA_MAX_INJECTION / total;
+
+	for (i = 0; i < fmmod->num_sca; i++) {
+		sca = &fmmod->sca[i];
+		fmmod_ramp_set(&sca->level, levels[i] * scale, num_samples);
+		if (!fmmod_ramp_is_zero(&sca->level))
+			plan->sca_bank = 1;
+	}
+
+	plan->rds2 = fmmod->num_rds2 &&
+		     !fmmod_ramp_is_zero(&fmmod->gains.rds2);
+}
+
+/* Upsample the inputs of the subcarriers that use them, called
+ * with the input buffers locked */
+static void
+fmmod_sca_upsample(struct fmmod_instance *fmmod)
+{
+	const struct fmmod_control *ctl = &fmmod->ctl_snap;
+	struct fmmod_sca *sca = NULL;
+	int frames = 0;
+	int i = 0;
+
+	for (i = 0; i < fmmod->num_sca; i++) {
+		sca = &fmmod->sca[i];
+		if (!ctl->sca[i].enabled ||
+		    ctl->sca[i].source != FMMOD_SCA_SRC_INPUT)
+			continue;
+
+		frames = resampler_upsample_audio_one(&fmmod->rsmpl,
+						      sca->upsampler,
+						      sca->inbuf, sca->ubuf,
+						      fmmod->num_in_samples,
+						      fmmod->upsampled_num_samples);
+		if (frames < 0)
+			frames = 0;
+		if (frames < fmmod->upsampled_num_samples)
+			memset(sca->ubuf + frames, 0,
+			       (fmmod->upsampled_num_samples - frames) *
+			       sizeof(float));
+	}
+}
+
+/* Put the sum of the subcarriers for this tile on sca_buf */
+static void
+fmmod_sca_run(struct fmmod_instance *fmmod, uint32_t offset,
+	      uint32_t num_samples)
+{
+	const struct fmmod_sca_control *sctl = NULL;
+	struct fmmod_sca *sca = NULL;
+	float *out = fmmod->sca_buf + offset;
+	float *mod = fmmod->sca_mod_buf;
+	float *carrier = fmmod->sca_carrier_buf;
+	const float *in = NULL;
+	const float *src = NULL;
+	uint32_t chunk = 0;
+	uint32_t pos = 0;
+	uint32_t j = 0;
 	int i = 0;
+
+	memset(out, 0, num_samples * sizeof(float));
+
+	for (i = 0; i < fmmod->num_sca; i++) {
+		sca = &fmmod->sca[i];
+		sctl = &fmmod->ctl_snap.sca[i];
+		if (fmmod_ramp_is_zero(&sca->level))
+			continue;
+
+		osc_nco_sync(&sca->carrier, &fmmod->sin_osc);
+
+		for (pos = 0; pos < num_samples; pos += chunk) {
+			chunk = num_samples - pos;
+			if (chunk > FMMOD_TILE_SAMPLES)
+				chunk = FMMOD_TILE_SAMPLES;
+
+			/* Get the modulating signal */
+			in = NULL;
+			if (sctl->source == FMMOD_SCA_SRC_TONE) {
+				osc_nco_run(&sca->tone, NULL, 0.0, mod, chunk);
+				in = mod;
+			} else if (sctl->source == FMMOD_SCA_SRC_INPUT &&
+				   fmmod->plan.sca_input) {
+				src = sca->ubuf + offset + pos;
+				for (j = 0; j < chunk; j++)
+					mod[j] = src[j] > 1.0 ? 1.0 :
+						 src[j] < -1.0 ? -1.0 : src[j];
+				in = mod;
+			}
+
+			if (sctl->modulation == FMMOD_SCA_FM)
+				osc_nco_run(&sca->carrier, in, sctl->deviation,
+					    carrier, chunk);
+			else {
+				osc_nco_run(&sca->carrier, NULL, 0.0,
+					    carrier, chunk);
+				if (in)
+					for (j = 0; j < chunk; j++)
+						carrier[j] *= 1.0 +
+							      sctl->deviation *
+							      in[j];
+			}
+
+			for (j = 0; j < chunk; j++)
+				out[pos + j] += carrier[j] *
+						fmmod_ramp_get(&sca->level,
+							       offset + pos + j);
+		}
+	}
+}
+
+/* Add the RDS2 streams of this tile to sca_buf, returns 0
+ * if the encoder didn't give us anything */
+static int
+fmmod_sca_add_rds2(struct fmmod_instance *fmmod, uint32_t offset,
+		   uint32_t num_samples)
+{
+	const struct osc_state *sin_osc = &fmmod->sin_osc;
+	const struct fmmod_ramp *gain = &fmmod->gains.rds2;
+	float *out = fmmod->sca_buf + offset;
+	float *rds2 = fmmod->sca_mod_buf;
+	int bank = fmmod->plan.sca_bank;
+	uint32_t sample = 0;
+	uint32_t chunk = 0;
+	uint32_t pos = 0;
+	uint32_t j = 0;
+
+	/* The sample within the current second */
+	sample = osc_get_position(sin_osc);
+
+	for (pos = 0; pos < num_samples; pos += chunk) {
+		chunk = num_samples - pos;
+		if (chunk > FMMOD_TILE_SAMPLES)
+			chunk = FMMOD_TILE_SAMPLES;
+
+		if (!rds_get_upper_samples(&fmmod->rds_enc, rds2, chunk,
+					   sample + pos))
+			break;
+
+		for (j = 0; j < chunk; j++)
+			out[pos + j] = (bank ? out[pos + j] : 0.0) +
+				       fmmod_ramp_get(gain, offset + pos + j) *
+				       rds2[j];
+	}
+
+	if (pos == 0)
+		return 0;
+	if (pos < num_samples && !bank)
+		memset(out + pos, 0, (num_samples - pos) * sizeof(float));
+
+	return 1;
+}
+
+
+/********************\
+* DEGRADATION LADDER *
+\********************/
+
+/*
+ * Last resort, when the audio didn't make it in time. Instead of
+ * leaving a gap on air (that knocks receivers out of stereo and RDS
+ * sync), keep the pilot and RDS going. The main oscilator is not used
+ * here, the pilot and the 57KHz carrier come from short tables, and
+ * we just move its phase forward so that the next period continues
+ * from where this one ended.
+ */
+static int
+fmmod_continuation_generator(struct fmmod_instance *fmmod, uint32_t offset,
+			     int num_samples)
+{
+	struct osc_state *sin_osc = &fmmod->sin_osc;
+	const struct fmmod_gains *gains = &fmmod->gains;
+	const float *rds_buf = fmmod->rds_buf + offset;
+	const float *sca_buf = fmmod->sca_buf + offset;
+	float *out = fmmod->umpxbuf + offset;
+	float *aux_out = fmmod->aux_buf + offset;
+	int stereo = fmmod->plan.stereo;
+	int rds = fmmod->plan.rds;
+	int sca = fmmod->plan.sca;
+	uint32_t pos = 0;
+	int i = 0;
+
+	/* The sample within the current second */
+	pos = osc_get_position(sin_osc);
+
+	for(i = 0; i < num_samples; i++, pos++) {
+		out[i] = 0.0;
+
+		/* Stereo Pilot at 19KHz */
+		if (stereo)
+			out[i] = fmmod_ramp_get(&gains->pilot, offset + i) *
+				 fmmod->pilot_table[pos % FMMOD_PILOT_TABLE_LEN];
+
+		/* RDS symbols modulated by the 57KHz carrier (3 x Pilot) */
+		if (rds)
+			out[i] += fmmod_ramp_get(&gains->rds, offset + i) *
+				  fmmod->rds_carrier_table[pos % FMMOD_RDS_TABLE_LEN] *
+				  rds_buf[i];
+
+		/* Subcarriers above RDS */
+		if (sca)
+			out[i] += sca_buf[i];
+
+		/* Set mpx gain percentage */
+		out[i] *= fmmod_ramp_get(&gains->mpx, offset + i);
+		aux_out[i] = out[i];
+	}
+
+	osc_advance_phase(sin_osc, num_samples);
+
+	return 0;
+}
+
+static void
+fmmod_init_continuation_tables(struct fmmod_instance *fmmod)
+{
+	const struct osc_state *sin_osc = &fmmod->sin_osc;
+	int i = 0;
+
+	/* Same as what the oscilator would give us at
+	 * the i-th sample of each second */
+	for (i = 0; i < FMMOD_PILOT_TABLE_LEN; i++)
+		fmmod->pilot_table[i] = (float) sin(sin_osc->phase_step *
+						    (double) i * 19000.0L);
+	for (i = 0; i < FMMOD_RDS_TABLE_LEN; i++)
+		fmmod->rds_carrier_table[i] = (float) sin(sin_osc->phase_step *
+							  (double) i * 57000.0L);
+}
+
+static void
+fmmod_set_degradation(struct fmmod_instance *fmmod,
+		      enum fmmod_degradation level)
+{
+	struct fmmod_degradation_state *dgr = &fmmod->dgr;
+	struct fmmod_control *ctl = fmmod->ctl;
+
+	if (level > dgr->level)
+		utils_wrn("[FMMOD] Running late, degradation level %i -> %i\n",
+			  dgr->level, level);
+	else
+		utils_info("[FMMOD] Headroom recovered, degradation level %i -> %i\n",
+			   dgr->level, level);
+
+	dgr->level = level;
+	dgr->calm_periods = 0;
+	/* Start over on the new path */
+	dgr->cost = 0;
+
+	ctl->degradation_level = level;
+	ctl->degradation_transitions[level]++;
+}
+
+/* Called after each period with the time it took to process it */
+static void
+fmmod_update_degradation(struct fmmod_instance *fmmod, int64_t elapsed)
+{
+	struct fmmod_degradation_state *dgr = &fmmod->dgr;
+	struct fmmod_control *ctl = fmmod->ctl;
+	uint32_t dropped = 0;
+	double load = 0.0L;
+
+	dropped = __atomic_load_n(&dgr->dropped, __ATOMIC_RELAXED);
+	ctl->dropped_periods += dropped - dgr->dropped_seen;
+
+	/* Project the next period's cost, follow any increase
+	 * immediately and decreases slowly */
+	if (elapsed > dgr->cost)
+		dgr->cost = elapsed;
+	else
+		dgr->cost += (elapsed - dgr->cost) / 16;
+	load = (double) dgr->cost / (double) dgr->budget;
+	ctl->period_load = (float) (100.0L * load);
+
+	if (!ctl->use_degradation) {
+		if (dgr->level != FMMOD_DGR_NONE)
+			fmmod_set_degradation(fmmod, FMMOD_DGR_NONE);
+	} else if ((dropped != dgr->dropped_seen ||
+		    load > FMMOD_DGR_LOAD_HIGH) &&
+		   dgr->level < FMMOD_DGR_MAX - 1) {
+		fmmod_set_degradation(fmmod, dgr->level + 1);
+	} else if (dgr->level > FMMOD_DGR_NONE &&
+		   load < FMMOD_DGR_LOAD_LOW) {
+		dgr->calm_periods++;
+		if (dgr->calm_periods >= dgr->recovery_periods)
+			fmmod_set_degradation(fmmod, dgr->level - 1);
+	} else
+		dgr->calm_periods = 0;
+
+	dgr->dropped_seen = dropped;
+}
+
+
+/***********************\
+* ELASTIC OUTPUT BUFFER *
+\***********************/
+
+/*
+ * When enabled (see FMMOD_OUTBUF_ENV) finished periods don't go to
+ * the socket / RTP server directly, they get queued here and the
+ * sink thread sends them out at a steady rate, one period every
+ * time JACK's frame clock advances by a period. Pacing on the
+ * system clock instead would drift against the sound card that
+ * drives JACK, and the ring would slowly run dry or overflow.
+ * This way the processing thread may run late (or early) by up to
+ * the buffer's depth without it showing up downstream. The sink
+ * starts once the ring is half full, and if it runs dry it keeps
+ * the pilot going until it fills up again, instead of sending out
+ * silence.
+ */
+
+static void
+fmmod_outbuf_push(struct fmmod_instance *fmmod, const float *samples,
+		  uint32_t num_samples)
+{
+	struct fmmod_outbuf *ob = &fmmod->ob;
+	float *slot = NULL;
+
+	/* No elastic buffer, send it out right away */
+	if (!ob->depth) {
+		write_to_sock(fmmod, samples, num_samples);
+		rtp_server_send_buffer(&fmmod->rtpsrv, samples, num_samples);
+		iq_sink_push(&fmmod->iq, samples, num_samples);
+		return;
+	}
+
+	pthread_mutex_lock(&ob->mutex);
+
+	/* We are too far ahead, make room by dropping the oldest period */
+	if (ob->fill == ob->depth) {
+		ob->tail = (ob->tail + 1) % ob->depth;
+		ob->fill--;
+		fmmod->ctl->outbuf_overflows++;
+	}
+
+	slot = ob->periods + ob->head * ob->period_len;
+	memcpy(slot, samples, num_samples * sizeof(float));
+	ob->head = (ob->head + 1) % ob->depth;
+	ob->fill++;
+
+	pthread_mutex_unlock(&ob->mutex);
+}
+
+/*
+ * Fill the sink buffer with the pilot, continuing from the last
+ * period that went out. The pilot is the only thing around 19KHz,
+ * so correlating that period with a 19KHz sine / cosine gives us its
+ * amplitude and phase (as the sine / cosine parts). We only use whole
+ * table lengths for that so that the sine / cosine are orthogonal.
+ */
+static void
+fmmod_outbuf_continuation(struct fmmod_outbuf *ob)
+{
+	double i_sum = 0.0L;
+	double q_sum = 0.0L;
+	uint32_t len = 0;
+	uint32_t pos = 0;
+	uint32_t i = 0;
+
+	if (!ob->pilot_valid) {
+		len = ob->period_len - (ob->period_len %
+					FMMOD_OUTBUF_PILOT_TABLE_LEN);
+		if (!len)
+			len = ob->period_len;
+
+		for (i = 0; i < len; i++, pos++) {
+			if (pos == FMMOD_OUTBUF_PILOT_TABLE_LEN)
+				pos = 0;
+			i_sum += ob->sink_buf[i] * ob->pilot_sin[pos];
+			q_sum += ob->sink_buf[i] * ob->pilot_cos[pos];
+		}
+
+		ob->pilot_i = (float) (2.0L * i_sum / (double) len);
+		ob->pilot_q = (float) (2.0L * q_sum / (double) len);
+		ob->pilot_pos = ob->period_len % FMMOD_OUTBUF_PILOT_TABLE_LEN;
+		ob->pilot_valid = 1;
+	}
+
+	pos = ob->pilot_pos;
+	for (i = 0; i < ob->period_len; i++, pos++) {
+		if (pos == FMMOD_OUTBUF_PILOT_TABLE_LEN)
+			pos = 0;
+		ob->sink_buf[i] = ob->pilot_i * ob->pilot_sin[pos] +
+				  ob->pilot_q * ob->pilot_cos[pos];
+	}
+	ob->pilot_pos = pos;
+}
+
+/* Called by the sink thread with the ring's lock held */
+static void
+fmmod_outbuf_update_stats(struct fmmod_instance *fmmod)
+{
+	struct fmmod_outbuf *ob = &fmmod->ob;
+	struct fmmod_control *ctl = fmmod->ctl;
+	float avg_fill = 0.0;
+
+	if (!ob->stat_periods || ob->fill < ob->stat_min_fill)
+		ob->stat_min_fill = ob->fill;
+	if (!ob->stat_periods || ob->fill > ob->stat_max_fill)
+		ob->stat_max_fill = ob->fill;
+	ob->stat_fill_sum += ob->fill;
+	ob->stat_periods++;
+
+	if ((int64_t) ob->stat_periods * ob->period_ns < 1000000000LL)
+		return;
+
+	avg_fill = (float) ob->stat_fill_sum / (float) ob->stat_periods;
+	ctl->outbuf_fill = avg_fill;
+	ctl->outbuf_min_fill = ob->stat_min_fill;
+	ctl->outbuf_max_fill = ob->stat_max_fill;
+	ctl->outbuf_latency = (uint32_t) (avg_fill * (float) ob->period_ns /
+					  1000.0);
+
+	ob->stat_periods = 0;
+	ob->stat_fill_sum = 0;
+}
+
+static void*
+fmmod_outbuf_sink_loop(void *arg)
+{
+	struct fmmod_instance *fmmod = (struct fmmod_instance *)arg;
+	struct fmmod_outbuf *ob = &fmmod->ob;
+	struct timespec next = {0};
+	jack_nframes_t next_frame = 0;
+	int64_t wait_ns = 0;
+	int32_t ahead = 0;
+	int have_period = 0;
+
+	next_frame = jack_frame_time(fmmod->client);
+
+	pthread_mutex_lock(&ob->mutex);
+	while (fmmod->active) {
+		/* Wait until JACK's frame clock reaches the next period,
+		 * the monotonic clock is only used for sleeping in
+		 * between, so its drift doesn't add up */
+		next_frame += ob->period_frames;
+		while (fmmod->active) {
+			ahead = (int32_t) (next_frame -
+					   jack_frame_time(fmmod->client));
+			if (ahead <= 0)
+				break;
+			wait_ns = (int64_t) ahead * 1000000000LL /
+				  ob->samplerate;
+			clock_gettime(CLOCK_MONOTONIC, &next);
+			next.tv_sec += wait_ns / 1000000000LL;
+			next.tv_nsec += wait_ns % 1000000000LL;
+			if (next.tv_nsec >= 1000000000L) {
+				next.tv_nsec -= 1000000000L;
+				next.tv_sec++;
+			}
+			pthread_cond_timedwait(&ob->trigger, &ob->mutex,
+					       &next);
+		}
+		if (!fmmod->active)
+			break;
+
+		/* We've been away for too long (e.g. the system
+		 * got suspended), don't try to catch up */
+		if (-ahead > (int32_t) ob->samplerate)
+			next_frame = jack_frame_time(fmmod->client);
+
+		if (!ob->running && ob->fill >= ob->prefill)
+			ob->running = 1;
+
+		have_period = 0;
+		if (ob->running && ob->fill) {
+			memcpy(ob->sink_buf,
+			       ob->periods + ob->tail * ob->period_len,
+			       ob->period_len * sizeof(float));
+			ob->tail = (ob->tail + 1) % ob->depth;
+			ob->fill--;
+			have_period = 1;
+		} else if (ob->running) {
+			/* Ran dry, wait until we have enough
+			 * periods queued again */
+			ob->running = 0;
+			fmmod->ctl->outbuf_underflows++;
+		}
+
+		fmmod_outbuf_update_stats(fmmod);
+		pthread_mutex_unlock(&ob->mutex);
+
+		if (have_period) {
+			ob->pilot_valid = 0;
+			ob->started = 1;
+		} else if (ob->started)
+			fmmod_outbuf_continuation(ob);
+
+		/* Nothing went out yet */
+		if (ob->started) {
+			write_to_sock(fmmod, ob->sink_buf, ob->period_len);
+			rtp_server_send_buffer(&fmmod->rtpsrv, ob->sink_buf,
+					       ob->period_len);
+			iq_sink_push(&fmmod->iq, ob->sink_buf, ob->period_len);
+		}
+
+		pthread_mutex_lock(&ob->mutex);
+	}
+	pthread_mutex_unlock(&ob->mutex);
+
+	return arg;
+}
+
+
+/*******************\
+* PROCESSING THREAD *
+\*******************/
+
+/*
+ * Decide what the current period needs to go through. In mono there
+ * is no need for the right channel's upsampler nor for L - R, the
+ * Weaver modulator needs band-limited audio and is only used when
+ * ready (it's created on demand by the housekeeping thread). Whether
+ * we need RDS or not is decided after upsampling, when we ask the
+ * encoder for its waveform.
+ */
+static void
+fmmod_update_plan(struct fmmod_instance *fmmod)
+{
+	const struct fmmod_control *ctl = &fmmod->ctl_snap;
+	struct fmmod_plan *plan = &fmmod->plan;
+
+	enum fmmod_degradation level = fmmod->dgr.level;
+
+	plan->mode = ctl->stereo_modulation;
+	/* SSB needs the Hilbert transformer / Weaver filters,
+	 * fall back to plain DSB when we are running late */
+	if (level >= FMMOD_DGR_DSB && plan->mode != FMMOD_MONO)
+		plan->mode = FMMOD_DSB;
+	plan->stereo = plan->mode != FMMOD_MONO;
+	plan->weaver = plan->mode == FMMOD_SSB_WEAVER && fmmod->weaver_active &&
+		       !__atomic_load_n(&fmmod->weaver.stale, __ATOMIC_ACQUIRE);
+	plan->band_limit = ctl->use_audio_lpf || plan->weaver;
+	if (level >= FMMOD_DGR_NO_AUDIO_LPF)
+		plan->band_limit = 0;
+	plan->limit = ctl->use_mpx_limiter;
+	plan->process_audio = ctl->aproc.enabled &&
+			      level < FMMOD_DGR_NO_AUDIO_PROC;
+	plan->sca_input = 1;
+	plan->fixed_point = fmmod->fixed_point &&
+			    (plan->mode == FMMOD_MONO ||
+			     plan->mode == FMMOD_DSB);
+	plan->fxp_mpx = plan->fixed_point && !plan->limit &&
+			fmmod->rsmpl.mpx_fxp;
+}
+
+/* Ramp the gains to their new values within this period */
+static void
+fmmod_update_gains(struct fmmod_instance *fmmod, uint32_t num_samples)
+{
+	const struct fmmod_control *ctl = &fmmod->ctl_snap;
+	struct fmmod_gains *gains = &fmmod->gains;
+
+	fmmod_ramp_set(&gains->pilot, ctl->pilot_gain, num_samples);
+	fmmod_ramp_set(&gains->rds, ctl->rds_gain, num_samples);
+	fmmod_ramp_set(&gains->rds2, fmmod->dgr.level >= FMMOD_DGR_NO_SCA ?
+		       0.0 : ctl->rds2_gain, num_samples);
+	fmmod_ramp_set(&gains->stereo_carrier, ctl->stereo_carrier_gain,
+		       num_samples);
+	fmmod_ramp_set(&gains->mpx, ctl->mpx_gain, num_samples);
+}
+
+/* Publish the MPX output levels of this period, see
+ * fmmod_read_mpx_levels() for the other side */
+static void
+fmmod_publish_mpx_levels(struct fmmod_control *ctl,
+			 const struct tp_meter_levels *levels)
+{
+	uint32_t seq = ctl->mpx_levels_seq;
+
+	__atomic_store_n(&ctl->mpx_levels_seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	ctl->peak_mpx_out = levels->peak;
+	ctl->true_peak_mpx_out = levels->true_peak;
+	if (levels->num_samples)
+		ctl->rms_mpx_out = (float) sqrt(levels->energy /
+						(double) levels->num_samples);
+	else
+		ctl->rms_mpx_out = 0.0;
+
+	__atomic_store_n(&ctl->mpx_levels_seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+/* Let the control channel know what the audio processor does */
+static void
+fmmod_publish_aproc_status(struct fmmod_instance *fmmod)
+{
+	struct audio_processor_control *aproc_ctl = &fmmod->ctl->aproc;
+	const struct audio_processor *aproc = &fmmod->aproc;
+	int i = 0;
+
+	if (!fmmod->aproc_running) {
+		aproc_ctl->agc_gain = 0.0;
+		for (i = 0; i < AP_NUM_BANDS; i++)
+			aproc_ctl->band[i].gain_reduction = 0.0;
+		aproc_ctl->limiter_gain_reduction = 0.0;
+		return;
+	}
+
+	aproc_ctl->agc_gain = aproc->agc_gain_db;
+	for (i = 0; i < AP_NUM_BANDS; i++)
+		aproc_ctl->band[i].gain_reduction =
+				aproc->band[i].gain_reduction;
+	aproc_ctl->limiter_gain_reduction = aproc->limiter_gain_reduction;
+}
+
+/*
+ * Create the multiplex signal out of frames_generated samples of
+ * upsampled L + R / L - R, downsample it to the output sample rate and
+ * send it out. It's called with uaudio_buf_mutex held, and releases it
+ * once done with the upsampled audio.
+ */
+static int
+fmmod_generate_mpx(struct fmmod_instance *fmmod, mpx_generator get_mpx_samples,
+		   uint32_t tile_len, int frames_generated)
+{
+	struct resampler_data *rsmpl = &fmmod->rsmpl;
+	const struct fmmod_flts *flts = &fmmod->flts;
+	struct fmmod_control *ctl = fmmod->ctl;
+	struct fmmod_plan *plan = &fmmod->plan;
+	float lim_gain = 0.0;
+	float min_lim_gain = 1.0;
+	struct tp_meter_levels levels = {0};
+	uint32_t offset = 0;
+	int num_samples = 0;
+	int frames_downsampled = 0;
+	int frames_out = 0;
+
+	fmmod_update_gains(fmmod, frames_generated);
+	fmmod_sca_update(fmmod, frames_generated);
+
+	/* The limiter's history is stale after
+	 * it's been disabled for a while */
+	if (plan->limit && !fmmod->limiter_running)
+		mpx_limiter_reset(&fmmod->flts.mpx_lim);
+	fmmod->limiter_running = plan->limit;
+
+	/* Create the multiplex signal and downsample it to the output
+	 * sample rate, one tile at a time, so that each tile goes through
+	 * all stages (RDS, generator, downsampler, peak meter) while it's
+	 * still in cache, instead of streaming whole periods through
+	 * memory on each stage. */
+	pthread_mutex_lock(&fmmod->mpx_buf_mutex);
+	for (offset = 0; offset < frames_generated; offset += tile_len) {
+		num_samples = frames_generated - offset;
+		if (num_samples > tile_len)
+			num_samples = tile_len;
+
+		/* Get the RDS waveform for this tile, if the encoder is
+		 * disabled (or muted) skip RDS altogether */
+		plan->rds = 0;
+		if (!fmmod_ramp_is_zero(&fmmod->gains.rds)) {
+			if (plan->fixed_point)
+				plan->rds = rds_get_samples_q15(&fmmod->rds_enc,
+						fmmod->rds_q15_buf + offset,
+						num_samples) > 0;
+			else
+				plan->rds = rds_get_samples(&fmmod->rds_enc,
+						fmmod->rds_buf + offset,
+						num_samples) > 0;
+		}
+
+		plan->sca = plan->sca_bank;
+		if (plan->sca_bank)
+			fmmod_sca_run(fmmod, offset, num_samples);
+		if (plan->rds2 && fmmod_sca_add_rds2(fmmod, offset, num_samples))
+			plan->sca = 1;
+
+		get_mpx_samples(fmmod, offset, num_samples);
+
+		/* Keep the composite within the ceiling */
+		if (plan->limit) {
+			lim_gain = mpx_limiter_run(&fmmod->flts.mpx_lim,
+						   fmmod->umpxbuf + offset,
+						   fmmod->aux_buf + offset,
+						   num_samples,
+						   fmmod->ctl_snap.mpx_limiter_ceiling);
+			if (lim_gain < min_lim_gain)
+				min_lim_gain = lim_gain;
+		}
+
+		/* Now downsample to the output sample rate */
+		if (plan->fxp_mpx)
+			frames_downsampled = resampler_downsample_mpx_q14(rsmpl,
+						fmmod->umpx_q14_buf + offset,
+						fmmod->outbuf + frames_out,
+						num_samples,
+						fmmod->num_out_samples -
+						frames_out);
+		else
+			frames_downsampled = resampler_downsample_mpx(rsmpl,
+						fmmod->umpxbuf + offset,
+						fmmod->outbuf + frames_out,
+						num_samples,
+						fmmod->num_out_samples -
+						frames_out);
+		if (unlikely(frames_downsampled < 0)) {
+			pthread_mutex_unlock(&fmmod->uaudio_buf_mutex);
+			pthread_mutex_unlock(&fmmod->mpx_buf_mutex);
+			return FMMOD_ERR_RESAMPLER_ERR;
+		}
+
+		/* Update mpx output levels */
+		tp_meter_run(&flts->mpx_tpm, fmmod->outbuf + frames_out,
+			     frames_downsampled, &levels);
+
+		frames_out += frames_downsampled;
+	}
+	pthread_mutex_unlock(&fmmod->uaudio_buf_mutex);
+
+	fmmod_publish_mpx_levels(ctl, &levels);
+	fmmod_update_mpx_power(fmmod, &levels);
+	ctl->mpx_limiter_gain_reduction = (float) (-20.0L *
+					  log10(fmax(min_lim_gain, 1e-6)));
+	ctl->mpx_limiter_latency = plan->limit ? MPXL_LOOKAHEAD_USECS : 0;
+	fmmod_publish_aproc_status(fmmod);
+	frames_generated = frames_out;
+	if (unlikely(frames_generated <= 0)) {
+		pthread_mutex_unlock(&fmmod->mpx_buf_mutex);
+		return 0;
+	}
+
+	/* When we start generating frames the resampler needs a few
+	 * periods to start generating the expected number of output
+	 * samples, so skip those initial periods to avoid sending
+	 * fewer samples to the socket/rtp server. */
+	if (unlikely(frames_generated != fmmod->num_out_samples)) {
+		pthread_mutex_unlock(&fmmod->mpx_buf_mutex);
+		return 0;
+	}
+
+	/* Write raw MPX signal to socket and send out a FLAC-encoded
+	 * version of it as an RTP stream, through the output buffer */
+	fmmod_outbuf_push(fmmod, fmmod->outbuf, frames_generated);
+
+	pthread_mutex_unlock(&fmmod->mpx_buf_mutex);
+
+	return 0;
+}
+
+/*
+ * Send out a pilot / RDS only period in place of one that has no audio,
+ * goes by the current plan without its SCA input or fixed point paths
+ */
+static int
+fmmod_process_continuation(struct fmmod_instance *fmmod)
+{
+	struct fmmod_plan *plan = &fmmod->plan;
+
+	fmmod->ctl->continuation_periods++;
+	plan->sca_input = 0;
+	plan->fixed_point = 0;
+	plan->fxp_mpx = 0;
+	pthread_mutex_lock(&fmmod->uaudio_buf_mutex);
+	return fmmod_generate_mpx(fmmod, fmmod_continuation_generator,
+				  FMMOD_TILE_SAMPLES,
+				  fmmod->upsampled_num_samples);
+}
+
+static void*
+fmmod_process(struct fmmod_instance *fmmod)
+{
+	struct resampler_data *rsmpl = &fmmod->rsmpl;
+	const struct fmmod_flts *flts = &fmmod->flts;
+	struct fmmod_control *ctl = fmmod->ctl;
+	struct fmmod_plan *plan = &fmmod->plan;
+	mpx_generator get_mpx_samples;
+	float *left_in = NULL;
+	float *right_in = NULL;
+	float *lpr_in = NULL;
+	float *lmr_in = NULL;
+	float *lpr_buf = NULL;
+	float *lmr_buf = NULL;
+	float lpr = 0.0;
+	float lmr = 0.0;
+	float mpxp_gain = 0.0;
+	uint32_t tile_len = 0;
+	int frames_generated = 0;
+	int i = 0;
+	int ret = 0;
+
+	/* The settings may change at any time, so take a snapshot
+	 * and from now on only go by that and the plan */
+	memcpy(&fmmod->ctl_snap, ctl, sizeof(struct fmmod_control));
+	fmmod_update_plan(fmmod);
+	iq_sink_set_deviation(&fmmod->iq, fmmod->ctl_snap.iq_deviation);
+	ctl->iq_dropped = __atomic_load_n(&fmmod->iq.dropped, __ATOMIC_RELAXED);
+
+	/* Input audio buffers */
+	left_in = fmmod->inbuf_l;
+	right_in = fmmod->inbuf_r;
+
+	/* L + R / L - R input buffers (reuse input buffers) */
+	lpr_in = fmmod->inbuf_l;
+	lmr_in = fmmod->inbuf_r;
+
+	/* L + R / L - R buffers (reuse upsampled buffers) */
+	lpr_buf = fmmod->uaudio_buf_0;
+	lmr_buf = fmmod->uaudio_buf_1;
+
+	ret = pthread_mutex_trylock(&fmmod->inbuf_mutex);
+	if (ret != 0) {
+		if (ret != EBUSY)
+			goto done;
+		/* The audio didn't make it in time, instead of skipping
+		 * this period send out pilot / RDS only */
+		utils_wrn("[FMMOD] Buffer overrun, sending pilot / RDS only\n");
+		__atomic_add_fetch(&fmmod->dgr.dropped, 1, __ATOMIC_RELAXED);
+		ret = fmmod_process_continuation(fmmod);
+		goto done;
+	}
+
+	/* Run the audio processor on L / R, if it was disabled
+	 * for a while start over */
+	if (plan->process_audio) {
+		if (!fmmod->aproc_running)
+			audio_processor_reset(&fmmod->aproc);
+		audio_processor_run(&fmmod->aproc, &fmmod->ctl_snap.aproc,
+				    left_in, right_in, fmmod->num_in_samples);
+	}
+	fmmod->aproc_running = plan->process_audio;
+
+	/* Move L + R to the left and L - R to the right input buffer, it's
+	 * cheaper to do it here than after upsampling. In mono we only need
+	 * L + R, and only that gets upsampled. This is also where the MPX
+	 * power control's gain goes. */
+	fmmod_ramp_set(&fmmod->mpxp.gain,
+		       (float) pow(10.0L, fmmod->mpxp.gain_db / 20.0L),
+		       fmmod->num_in_samples);
+	if (plan->stereo) {
+		for (i = 0; i < fmmod->num_in_samples; i++) {
+			mpxp_gain = fmmod_ramp_get(&fmmod->mpxp.gain, i);
+			lpr = left_in[i] + right_in[i];
+			lmr = left_in[i] - right_in[i];
+			lpr_in[i] = lpr * mpxp_gain;
+			lmr_in[i] = lmr * mpxp_gain;
+		}
+	} else {
+		for (i = 0; i < fmmod->num_in_samples; i++)
+			lpr_in[i] = (left_in[i] + right_in[i]) *
+				    fmmod_ramp_get(&fmmod->mpxp.gain, i);
+	}
+
+	/* The audio upsampler is bypassed (JACK already runs at the main
+	 * oscilator's sample rate), so we need to apply a separate low-pass
+	 * filter to the audio signal so that it doesn't hit the 19Khz pilot */
+	if (plan->band_limit && rsmpl->audio_upsampler_bypass)
+		lpf_filter_apply_stereo(&flts->audio_lpf, lpr_in, lmr_in,
+					lpr_in, lmr_in,
+					fmmod->num_in_samples, 1.0);
+
+	/* Upsample audio to the sample rate of the main oscilator, if
+	 * requested also band-limit it in the process to protect the pilot */
+	pthread_mutex_lock(&fmmod->uaudio_buf_mutex);
+	if (plan->weaver) {
+		/* The main audio upsamplers are left idle while the
+		 * Weaver modulator is running */
+		if (unlikely(!fmmod->weaver.running))
+			resampler_reset_audio(rsmpl);
+		frames_generated = fmmod_weaver_upsample(fmmod, lpr_in, lmr_in,
+							 lpr_buf, lmr_buf);
+	} else {
+		/* Leave the Weaver modulator to the housekeeping
+		 * thread, to get it primed again */
+		if (unlikely(fmmod->weaver.running)) {
+			fmmod->weaver.running = 0;
+			__atomic_store_n(&fmmod->weaver.stale, 1,
+					 __ATOMIC_RELEASE);
+		}
+		if (plan->stereo)
+			frames_generated = resampler_upsample_audio(rsmpl,
+						lpr_in, lmr_in,
+						lpr_buf, lmr_buf,
+						fmmod->num_in_samples,
+						fmmod->upsampled_num_samples,
+						plan->band_limit);
+		else
+			frames_generated = resampler_upsample_audio_mono(rsmpl,
+						lpr_in, lpr_buf,
+						fmmod->num_in_samples,
+						fmmod->upsampled_num_samples,
+						plan->band_limit);
+	}
+	fmmod_sca_upsample(fmmod);
+	pthread_mutex_unlock(&fmmod->inbuf_mutex);
+
+	/* Let the housekeeping thread reset / prime the audio upsamplers
+	 * we left idle. We don't take hk_mutex here, if it's not waiting
+	 * we'll signal it again on the next period */
+	if (unlikely(resampler_audio_stale(rsmpl) ||
+		     __atomic_load_n(&fmmod->weaver.stale, __ATOMIC_RELAXED)))
+		pthread_cond_signal(&fmmod->hk_trigger);
+	if (unlikely(frames_generated <= 0)) {
+		pthread_mutex_unlock(&fmmod->uaudio_buf_mutex);
+		if (frames_generated < 0)
+			ret = FMMOD_ERR_RESAMPLER_ERR;
+		goto done;
+	}
+
+	/* Choose modulation method, the generators that run FFT-based
+	 * filters need to process the whole period at once, the rest
+	 * work on tiles (see below) */
+	tile_len = FMMOD_TILE_SAMPLES;
+	switch (plan->mode) {
+	case FMMOD_MONO:
+		if (plan->fixed_point)
+			get_mpx_samples = fmmod_mono_generator_fxp;
+		else
+			get_mpx_samples = fmmod_mono_generator;
+		break;
+	/* The SSB filters are created on demand by the housekeeping
+	 * thread, until they are ready stick with DSB */
+	case FMMOD_SSB_HARTLEY:
+		if (likely(flts->ht_active)) {
+			get_mpx_samples = fmmod_ssb_hartley_generator;
+			tile_len = frames_generated;
+		} else
+			get_mpx_samples = fmmod_dsb_generator;
+		break;
+	case FMMOD_SSB_LPF:
+		if (likely(flts->ssb_lpf_active)) {
+			get_mpx_samples = fmmod_ssb_lpf_generator;
+			tile_len = frames_generated;
+		} else
+			get_mpx_samples = fmmod_dsb_generator;
+		break;
+	case FMMOD_SSB_WEAVER:
+		if (likely(plan->weaver))
+			get_mpx_samples = fmmod_ssb_weaver_generator;
+		else
+			get_mpx_samples = fmmod_dsb_generator;
+		break;
+	case FMMOD_DSB:
+	default:
+		if (plan->fixed_point)
+			get_mpx_samples = fmmod_dsb_generator_fxp;
+		else
+			get_mpx_samples = fmmod_dsb_generator;
+		break;
+	}
+
+	ret = fmmod_generate_mpx(fmmod, get_mpx_samples, tile_len,
+				 frames_generated);
+
+ done:
+	if (ret < 0) {
+		utils_err("[FMMMOD] Error while processing: %i\n", ret);
+		raise(SIGTERM);
+	}
+	return fmmod;
+}
+
+static void*
+fmmod_process_loop(void* arg)
+{
+	struct fmmod_instance *fmmod = (struct fmmod_instance *)arg;
+	struct timespec start = {0};
+	struct timespec end = {0};
+	int64_t elapsed = 0;
+	uint32_t missed = 0;
+
+	while(fmmod->active) {
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		while (pthread_cond_wait(&fmmod->proc_trigger,
+					 &fmmod->proc_mutex) != 0);
+
+		if(!fmmod->active) {
+			pthread_mutex_unlock(&fmmod->proc_mutex);
+			break;
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		fmmod_process(fmmod);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		elapsed = (int64_t) (end.tv_sec - start.tv_sec) * 1000000000LL +
+			  (end.tv_nsec - start.tv_nsec);
+		fmmod_update_degradation(fmmod, elapsed);
+
+		/* Fill in for the periods the JACK callback had to skip
+		 * while we were busy, so that there are no gaps on air */
+		missed = __atomic_exchange_n(&fmmod->dgr.missed, 0,
+					     __ATOMIC_RELAXED);
+		while (missed-- > 0 && fmmod->active) {
+			if (fmmod_process_continuation(fmmod) < 0) {
+				utils_err("[FMMOD] Error while sending pilot / RDS only\n");
+				raise(SIGTERM);
+				break;
+			}
+		}
+
+		pthread_mutex_unlock(&fmmod->proc_mutex);
+	}
+
+	return arg;
+}
+
+
+/**************\
+* HOUSEKEEPING *
+\**************/
+
+/*
+ * Measure a new set of plans for a filter that was initialized
+ * with estimated plans (fast start) and swap them in between
+ * periods, the processing thread holds proc_mutex for the whole
+ * period so it won't see a half-updated filter.
+ */
+static int
+fmmod_replan_lpf(struct fmmod_instance *fmmod, struct lpf_filter_data *lpf)
+{
+	struct fft_plan *dft_plan = NULL;
+	struct fft_plan *ift_plan = NULL;
+	int ret = 0;
+
+	if (!lpf->estimated_plans)
+		return 0;
+
+	ret = lpf_filter_replan(lpf, &dft_plan, &ift_plan);
+	if (ret < 0)
+		return ret;
+
+	pthread_mutex_lock(&fmmod->proc_mutex);
+	lpf_filter_swap_plans(lpf, &dft_plan, &ift_plan);
+	pthread_mutex_unlock(&fmmod->proc_mutex);
+
+	/* We got the old ones back */
+	fft_destroy_plan(dft_plan);
+	fft_destroy_plan(ift_plan);
+
+	return 1;
+}
+
+static int
+fmmod_replan_ht(struct fmmod_instance *fmmod,
+		struct hilbert_transformer_data *ht)
+{
+	struct fft_plan *dft_plan = NULL;
+	struct fft_plan *ift_plan = NULL;
+	int ret = 0;
+
+	if (!ht->estimated_plans)
+		return 0;
+
+	ret = hilbert_transformer_replan(ht, &dft_plan, &ift_plan);
+	if (ret < 0)
+		return ret;
+
+	pthread_mutex_lock(&fmmod->proc_mutex);
+	hilbert_transformer_swap_plans(ht, &dft_plan, &ift_plan);
+	pthread_mutex_unlock(&fmmod->proc_mutex);
+
+	fft_destroy_plan(dft_plan);
+	fft_destroy_plan(ift_plan);
+
+	return 1;
+}
+
+static void
+fmmod_replan_filters(struct fmmod_instance *fmmod)
+{
+	struct fmmod_flts *flts = &fmmod->flts;
+	int replaced = 0;
+	int ret = 0;
+
+	ret = fmmod_replan_lpf(fmmod, &flts->audio_lpf);
+	if (ret < 0)
+		utils_wrn("[FILTERS] Replan failed for LPF (Audio): %i\n", ret);
+	else
+		replaced += ret;
+
+	ret = fmmod_replan_lpf(fmmod, &flts->ssb_lpf);
+	if (ret < 0)
+		utils_wrn("[FILTERS] Replan failed for LPF (SSB): %i\n", ret);
+	else
+		replaced += ret;
+
+	ret = fmmod_replan_ht(fmmod, &flts->ht);
+	if (ret < 0)
+		utils_wrn("[FILTERS] Replan failed for Hilbert transformer: %i\n",
+			  ret);
+	else
+		replaced += ret;
+
+	/* Store the new plans so that the next (fast) start
+	 * will pick them up from wisdom */
+	if (replaced) {
+		utils_dbg("[FILTERS] Swapped in %i measured plan(s)\n", replaced);
+		fft_wisdom_export();
+	}
+}
+
+/*
+ * Apply a new pilot protection filter design requested through the
+ * control channel. The new design is prepared here and swapped in
+ * between periods, so no periods get dropped in the process.
+ */
+static void
+fmmod_update_audio_lpf(struct fmmod_instance *fmmod)
+{
+	struct fmmod_control *ctl = fmmod->ctl;
+	struct fmmod_flts *flts = &fmmod->flts;
+	struct resampler_data *rsmpl = &fmmod->rsmpl;
+	soxr_t upsampler_l = NULL;
+	soxr_t upsampler_r = NULL;
+	int cutoff = ctl->audio_lpf_cutoff;
+	int transition = ctl->audio_lpf_transition;
+	int ret = 0;
+
+	if (cutoff == fmmod->audio_lpf_cutoff &&
+	    transition == fmmod->audio_lpf_transition)
+		return;
+
+	/* The stopband must begin below the pilot */
+	if (cutoff <= 0 || transition <= 0 ||
+	    cutoff + transition > AFLT_STOPBAND_FREQ ||
+	    2 * (cutoff + transition) > (int) rsmpl->audio_samplerate) {
+		ret = -1;
+		goto cleanup;
+	}
+
+	if (rsmpl->audio_upsampler_bypass) {
+		ret = lpf_filter_design(&flts->audio_lpf, cutoff, transition);
+		if (ret < 0)
+			goto cleanup;
+
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		lpf_filter_swap_resp(&flts->audio_lpf);
+		pthread_mutex_unlock(&fmmod->proc_mutex);
+	} else {
+		ret = resampler_redesign_audio_lpf(rsmpl, cutoff,
+						   cutoff + transition,
+						   &upsampler_l, &upsampler_r);
+		if (ret < 0)
+			goto cleanup;
+
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		resampler_swap_audio_lpf(rsmpl, &upsampler_l, &upsampler_r);
+		pthread_mutex_unlock(&fmmod->proc_mutex);
+
+		/* The ones retired by the previous swap */
+		soxr_delete(upsampler_l);
+		soxr_delete(upsampler_r);
+	}
+
+ cleanup:
+	if (ret < 0) {
+		utils_wrn("[FILTERS] Invalid audio LPF design (%i/%iHz): %i\n",
+			  cutoff, transition, ret);
+		/* Revert to the current one */
+		ctl->audio_lpf_cutoff = fmmod->audio_lpf_cutoff;
+		ctl->audio_lpf_transition = fmmod->audio_lpf_transition;
+		return;
+	}
+
+	utils_dbg("[FILTERS] New audio LPF design: %iHz cutoff, %iHz transition\n",
+		  cutoff, transition);
+	fmmod->audio_lpf_cutoff = cutoff;
+	fmmod->audio_lpf_transition = transition;
+
+	/* The Weaver modulator follows the audio LPF design, let
+	 * it get re-created with the new one */
+	fmmod_release_weaver(fmmod);
+}
+
+/*
+ * Mode-specific filters (the SSB LPF and the Hilbert transformer) are
+ * big and slow to plan, and most setups never use them, so instead of
+ * creating them during init, we create them here when the requested
+ * stereo modulation needs them, and release them after they've been
+ * unused for FMMOD_FLT_IDLE_TIMEOUT seconds. They are created on a
+ * local copy and get swapped in / out between periods.
+ */
+static void
+fmmod_update_ssb_lpf(struct fmmod_instance *fmmod, int in_use, time_t now)
+{
+	struct fmmod_flts *flts = &fmmod->flts;
+	struct lpf_filter_data lpf;
 	int ret = 0;
 
-	/* Input audio buffers */
-	left_in = fmmod->inbuf_l;
-	right_in = fmmod->inbuf_r;
+	if (in_use)
+		flts->ssb_lpf_last_used = now;
+
+	if (in_use && !flts->ssb_lpf_active) {
+		memset(&lpf, 0, sizeof(struct lpf_filter_data));
+		ret = lpf_filter_init(&lpf, 38000, OSC_SAMPLE_RATE,
+				      fmmod->upsampled_num_samples,
+				      SSB_LPF_OVERLAP_FACTOR, 1, 0);
+		if (ret < 0) {
+			utils_wrn("[FILTERS] LPF (SSB) init failed with code: %i\n",
+				  ret);
+			return;
+		}
 
-	/* Upsampled audio buffers */
-	upsampled_audio_l = fmmod->uaudio_buf_0;
-	upsampled_audio_r = fmmod->uaudio_buf_1;
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		flts->ssb_lpf = lpf;
+		flts->ssb_lpf_active = 1;
+		pthread_mutex_unlock(&fmmod->proc_mutex);
 
-	/* L + R / L - R buffers (reuse upsampled buffers) */
-	lpr_buf = fmmod->uaudio_buf_0;
-	lmr_buf = fmmod->uaudio_buf_1;
+		fft_wisdom_export();
+		utils_dbg("[FILTERS] LPF (SSB) created\n");
+	} else if (!in_use && flts->ssb_lpf_active &&
+		   now - flts->ssb_lpf_last_used > FMMOD_FLT_IDLE_TIMEOUT) {
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		lpf = flts->ssb_lpf;
+		memset(&flts->ssb_lpf, 0, sizeof(struct lpf_filter_data));
+		flts->ssb_lpf_active = 0;
+		pthread_mutex_unlock(&fmmod->proc_mutex);
 
-	/* Apply a low-pass filter to the audio signal so that
-	 * it doesn't hit the 19Khz pilot */
-	ret = pthread_mutex_trylock(&fmmod->inbuf_mutex);
-	if (ret != 0) {
-		if (ret == EBUSY) {
-			utils_wrn("[FMMOD] Buffer overrun, skipping this period\n");
-			return fmmod;
-		}
-		goto done;
+		lpf_filter_destroy(&lpf);
+		utils_dbg("[FILTERS] LPF (SSB) released\n");
 	}
+}
 
-	if (ctl->use_audio_lpf) {
-		lpf_filter_apply(&flts->lpf_l, left_in, left_in,
-				 fmmod->num_in_samples, 1.0);
-		lpf_filter_apply(&flts->lpf_r, right_in, right_in,
-				 fmmod->num_in_samples, 1.0);
-	}
+static void
+fmmod_update_ht(struct fmmod_instance *fmmod, int in_use, time_t now)
+{
+	struct fmmod_flts *flts = &fmmod->flts;
+	struct hilbert_transformer_data ht;
+	int ret = 0;
 
-	/* Upsample audio to the sample rate of the main oscilator,
-	 * apply a low-pass filter in the process */
-	pthread_mutex_lock(&fmmod->uaudio_buf_mutex);
-	frames_generated = resampler_upsample_audio(rsmpl, left_in, right_in,
-						    upsampled_audio_l,
-						    upsampled_audio_r,
-						    fmmod->num_in_samples,
-						    fmmod->upsampled_num_samples);
-	pthread_mutex_unlock(&fmmod->inbuf_mutex);
-	if (unlikely(frames_generated <= 0)) {
-		pthread_mutex_unlock(&fmmod->uaudio_buf_mutex);
-		if (frames_generated < 0)
-			ret = FMMOD_ERR_RESAMPLER_ERR;
-		goto done;
-	}
+	if (in_use)
+		flts->ht_last_used = now;
+
+	if (in_use && !flts->ht_active) {
+		memset(&ht, 0, sizeof(struct hilbert_transformer_data));
+		ret = hilbert_transformer_init(&ht,
+					       fmmod->upsampled_num_samples, 0);
+		if (ret < 0) {
+			utils_wrn("[FILTERS] Hilbert transformer init failed with code: %i\n",
+				  ret);
+			return;
+		}
 
-	/* Move L + R to buffer 0 and L - R to buffer 1 */
-	for (i = 0; i < frames_generated; i++) {
-		lpr = upsampled_audio_l[i] + upsampled_audio_r[i];
-		lmr = upsampled_audio_l[i] - upsampled_audio_r[i];
-		lpr_buf[i] = lpr;
-		lmr_buf[i] = lmr;
-	}
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		flts->ht = ht;
+		flts->ht_active = 1;
+		pthread_mutex_unlock(&fmmod->proc_mutex);
 
-	/* Choose modulation method */
-	switch (ctl->stereo_modulation) {
-	case FMMOD_MONO:
-		get_mpx_samples = fmmod_mono_generator;
-		break;
-	case FMMOD_SSB_HARTLEY:
-		get_mpx_samples = fmmod_ssb_hartley_generator;
-		break;
-	case FMMOD_SSB_LPF:
-		get_mpx_samples = fmmod_ssb_lpf_generator;
-		break;
-	case FMMOD_DSB:
-	default:
-		get_mpx_samples = fmmod_dsb_generator;
-		break;
+		fft_wisdom_export();
+		utils_dbg("[FILTERS] Hilbert transformer created\n");
+	} else if (!in_use && flts->ht_active &&
+		   now - flts->ht_last_used > FMMOD_FLT_IDLE_TIMEOUT) {
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		ht = flts->ht;
+		memset(&flts->ht, 0, sizeof(struct hilbert_transformer_data));
+		flts->ht_active = 0;
+		pthread_mutex_unlock(&fmmod->proc_mutex);
+
+		hilbert_transformer_destroy(&ht);
+		utils_dbg("[FILTERS] Hilbert transformer released\n");
 	}
+}
 
-	/* Create the multiplex signal */
-	pthread_mutex_lock(&fmmod->mpx_buf_mutex);
-	get_mpx_samples(fmmod, lpr_buf, lmr_buf, frames_generated, fmmod->umpxbuf);
-	pthread_mutex_unlock(&fmmod->uaudio_buf_mutex);
+/* The Weaver modulator works the same way */
+static void
+fmmod_update_weaver(struct fmmod_instance *fmmod, int in_use, time_t now)
+{
+	struct fmmod_weaver weaver;
+	int ret = 0;
 
-	/* Now downsample to the output sample rate */
-	frames_generated = resampler_downsample_mpx(rsmpl, fmmod->umpxbuf, fmmod->outbuf,
-						    frames_generated,
-						    fmmod->num_out_samples);
-	if (unlikely(frames_generated <= 0)) {
-		pthread_mutex_unlock(&fmmod->mpx_buf_mutex);
-		if (frames_generated < 0)
-			ret = FMMOD_ERR_RESAMPLER_ERR;
-		goto done;
-	}
+	if (in_use)
+		fmmod->weaver_last_used = now;
 
-	/* Update mpx output peak gain */
-	ctl->peak_mpx_out = 0;
-	for (i = 0; i < frames_generated; i++) {
-		if (fmmod->outbuf[i] > ctl->peak_mpx_out)
-			ctl->peak_mpx_out = fmmod->outbuf[i];
-	}
+	if (in_use && !fmmod->weaver_active) {
+		ret = fmmod_weaver_init(fmmod, &weaver);
+		if (ret < 0) {
+			utils_wrn("[FMMOD] Weaver modulator init failed with code: %i\n",
+				  ret);
+			return;
+		}
 
-	/* When we start generating frames the resampler needs a few
-	 * periods to start generating the expected number of output
-	 * samples, so skip those initial periods to avoid sending
-	 * fewer samples to the socket/rtp server. */
-	if (unlikely(frames_generated != fmmod->num_out_samples)) {
-		pthread_mutex_unlock(&fmmod->mpx_buf_mutex);
-		goto done;
-	}
+		pthread_mutex_lock(&fmmod->proc_mutex);
+		fmmod->weaver = weaver;
+		fmmod->weaver_active = 1;
+		pthread_mutex_unlock(&fmmod->proc_mutex);
 
-	/* Write raw MPX signal to socket */
-	write_to_sock(fmmod, fmmod->outbuf, frames_generated);
+		utils_dbg("[FMMOD] Weaver modulator created\n");
+	} else if (!in_use && fmmod->weaver_active &&
+		   now - fmmod->weaver_last_used > FMMOD_FLT_IDLE_TIMEOUT)
+		fmmod_release_weaver(fmmod);
+	else if (fmmod->weaver_active &&
+		 __atomic_load_n(&fmmod->weaver.stale, __ATOMIC_ACQUIRE)) {
+		/* The processing thread won't touch it until we are done */
+		ret = fmmod_weaver_prime(fmmod, &fmmod->weaver);
+		if (ret < 0) {
+			utils_wrn("[FMMOD] Weaver modulator priming failed\n");
+			return;
+		}
+		__atomic_store_n(&fmmod->weaver.stale, 0, __ATOMIC_RELEASE);
+	}
+}
 
-	/* Send out a FLAC-encoded version of the signal as an RTP stream */
-	rtp_server_send_buffer(&fmmod->rtpsrv, fmmod->outbuf, frames_generated);
+static void
+fmmod_update_mode_filters(struct fmmod_instance *fmmod)
+{
+	enum fmmod_stereo_modulation mode = fmmod->ctl->stereo_modulation;
+	struct timespec now = {0};
 
-	pthread_mutex_unlock(&fmmod->mpx_buf_mutex);
+	clock_gettime(CLOCK_MONOTONIC, &now);
 
- done:
-	if (ret < 0) {
-		utils_err("[FMMMOD] Error while processing: %i\n", ret);
-		raise(SIGTERM);
-	}
-	return fmmod;
+	fmmod_update_ssb_lpf(fmmod, mode == FMMOD_SSB_LPF, now.tv_sec);
+	fmmod_update_ht(fmmod, mode == FMMOD_SSB_HARTLEY, now.tv_sec);
+	fmmod_update_weaver(fmmod, mode == FMMOD_SSB_WEAVER, now.tv_sec);
 }
 
+/*
+ * Anything that's too slow for the processing thread and
+ * can be done in the background goes here. This thread runs
+ * at normal priority and wakes up once per second, or when
+ * triggered.
+ */
 static void*
-fmmod_process_loop(void* arg)
+fmmod_housekeeping_loop(void *arg)
 {
 	struct fmmod_instance *fmmod = (struct fmmod_instance *)arg;
+	struct timespec ts = {0};
 
-	while(fmmod->active) {
-		pthread_mutex_lock(&fmmod->proc_mutex);
-		while (pthread_cond_wait(&fmmod->proc_trigger,
-					 &fmmod->proc_mutex) != 0);
+	while (fmmod->active) {
+		resampler_prepare_audio(&fmmod->rsmpl);
 
-		if(!fmmod->active) {
-			pthread_mutex_unlock(&fmmod->proc_mutex);
-			break;
+		if (__atomic_load_n(&fmmod->fast_start, __ATOMIC_ACQUIRE)) {
+			fmmod_replan_filters(fmmod);
+			__atomic_store_n(&fmmod->fast_start, 0, __ATOMIC_RELEASE);
 		}
 
-		fmmod_process(fmmod);
+		fmmod_update_audio_lpf(fmmod);
 
-		pthread_mutex_unlock(&fmmod->proc_mutex);
+		fmmod_update_mode_filters(fmmod);
+
+		clock_gettime(CLOCK_REALTIME, &ts);
+		ts.tv_sec += 1;
+		pthread_mutex_lock(&fmmod->hk_mutex);
+		if (fmmod->active)
+			pthread_cond_timedwait(&fmmod->hk_trigger,
+					       &fmmod->hk_mutex, &ts);
+		pthread_mutex_unlock(&fmmod->hk_mutex);
 	}
 
 	return arg;
@@ -485,6 +2542,7 @@ fmmod_process_cb(jack_nframes_t num_samples, void *arg)
 	const jack_default_audio_sample_t *right_in = NULL;
 	float tmp_gain_l = 0.0;
 	float tmp_gain_r = 0.0;
+	float audio_gain = 0.0;
 	int i = 0;
 
 	/* FMmod is inactive, don't do any processing */
@@ -504,9 +2562,13 @@ fmmod_process_cb(jack_nframes_t num_samples, void *arg)
 	}
 
 	/* Try to consume input, if previous buffer is still not in
-	 * we got an overrun so skip this period */
+	 * we got an overrun, we can't touch the output from here so
+	 * leave it to the processing thread to send out a pilot / RDS
+	 * only period in place of this one once it's done */
 	if (pthread_mutex_trylock(&fmmod->inbuf_mutex) != 0) {
-		utils_dbg("[FMMOD] got overrun, skipping period\n");
+		utils_dbg("[FMMOD] got overrun, sending pilot / RDS only\n");
+		__atomic_add_fetch(&fmmod->dgr.dropped, 1, __ATOMIC_RELAXED);
+		__atomic_add_fetch(&fmmod->dgr.missed, 1, __ATOMIC_RELAXED);
 		return 0;
 	}
 
@@ -514,32 +2576,28 @@ fmmod_process_cb(jack_nframes_t num_samples, void *arg)
 	left_in = (float *) jack_port_get_buffer(fmmod->inL, num_samples);
 	right_in = (float *) jack_port_get_buffer(fmmod->inR, num_samples);
 
-	/* If pre-emphasis is requested, run the input buffers through
-	 * the pre-emphasis filter in the time domain, else just copy them
-	 * to inbuf_* */
-	if (ctl->preemph_tau != LPF_PREEMPH_NONE) {
-		for(i = 0; i < num_samples; i++) {
-			fmmod->inbuf_l[i] = fmpreemph_filter_apply(&flts->fmprf_l,
-							left_in[i],
-							ctl->preemph_tau);
-			fmmod->inbuf_r[i] = fmpreemph_filter_apply(&flts->fmprf_r,
-							right_in[i],
-							ctl->preemph_tau);
-		}
-	} else {
-		memcpy(fmmod->inbuf_l, left_in, num_samples * sizeof(float));
-		memcpy(fmmod->inbuf_r, right_in, num_samples * sizeof(float));
-	}
-
-	/* Update audio gain levels */
+	/* Run the input buffers through the pre-emphasis filter in the
+	 * time domain and put the result on inbuf_*, if pre-emphasis is
+	 * disabled they'll just get copied */
+	fmpreemph_filter_apply(&flts->fmprf, left_in, right_in,
+			       fmmod->inbuf_l, fmmod->inbuf_r,
+			       num_samples, ctl->preemph_tau);
+
+	/* The subcarriers' inputs are used as they are */
+	for (i = 0; i < fmmod->num_sca; i++)
+		memcpy(fmmod->sca[i].inbuf,
+		       jack_port_get_buffer(fmmod->sca[i].port, num_samples),
+		       num_samples * sizeof(float));
+
+	/* Update audio gain levels, ramping to the new gain */
+	fmmod_ramp_set(&fmmod->audio_gain, ctl->audio_gain, num_samples);
 	for(i = 0, tmp_gain_l = 0.0, tmp_gain_r = 0.0;
 	    i < num_samples; i++) {
-		fmmod->inbuf_l[i] *= ctl->audio_gain;
-		if(fmmod->inbuf_l[i] > tmp_gain_l)
-			tmp_gain_l = fmmod->inbuf_l[i];
-		fmmod->inbuf_r[i] *= ctl->audio_gain;
-		if(fmmod->inbuf_r[i] > tmp_gain_r)
-			tmp_gain_r = fmmod->inbuf_r[i];
+		audio_gain = fmmod_ramp_get(&fmmod->audio_gain, i);
+		fmmod->inbuf_l[i] *= audio_gain;
+		tmp_gain_l = fmaxf(tmp_gain_l, fabsf(fmmod->inbuf_l[i]));
+		fmmod->inbuf_r[i] *= audio_gain;
+		tmp_gain_r = fmaxf(tmp_gain_r, fabsf(fmmod->inbuf_r[i]));
 	}
 
 	/* We are done with inbuf, let mutex go and
@@ -642,6 +2700,8 @@ fmmod_destroy_locks(struct fmmod_instance *fmmod)
 	pthread_mutex_destroy(&fmmod->mpx_buf_mutex);
 	pthread_mutex_destroy(&fmmod->proc_mutex);
 	pthread_cond_destroy(&fmmod->proc_trigger);
+	pthread_mutex_destroy(&fmmod->hk_mutex);
+	pthread_cond_destroy(&fmmod->hk_trigger);
 	utils_dbg("[FMMOD] Locks destroyed\n");
 }
 
@@ -653,6 +2713,8 @@ fmmod_init_locks(struct fmmod_instance *fmmod)
 	pthread_mutex_init(&fmmod->mpx_buf_mutex, NULL);
 	pthread_mutex_init(&fmmod->proc_mutex, NULL);
 	pthread_cond_init(&fmmod->proc_trigger, NULL);
+	pthread_mutex_init(&fmmod->hk_mutex, NULL);
+	pthread_cond_init(&fmmod->hk_trigger, NULL);
 	utils_dbg("[FMMOD] Locks initialized\n");
 }
 
@@ -667,6 +2729,14 @@ fmmod_free_buffers(const struct fmmod_instance *fmmod)
 		free(fmmod->uaudio_buf_0);
 	if (fmmod->uaudio_buf_1 != NULL)
 		free(fmmod->uaudio_buf_1);
+	if (fmmod->rds_buf != NULL)
+		free(fmmod->rds_buf);
+	if (fmmod->rds_q15_buf != NULL)
+		free(fmmod->rds_q15_buf);
+	if (fmmod->umpx_q14_buf != NULL)
+		free(fmmod->umpx_q14_buf);
+	if (fmmod->aux_buf != NULL)
+		free(fmmod->aux_buf);
 	if (fmmod->umpxbuf != NULL)
 		free(fmmod->umpxbuf);
 	if (fmmod->outbuf != NULL)
@@ -724,6 +2794,22 @@ fmmod_init_buffers(struct fmmod_instance *fmmod, uint32_t jack_samplerate)
 	}
 	memset(fmmod->uaudio_buf_1, 0, upsampled_buf_len);
 
+	/* Upsampled RDS waveform */
+	fmmod->rds_buf = (float *) malloc(upsampled_buf_len);
+	if (fmmod->rds_buf == NULL) {
+		ret = FMMOD_ERR_NOMEM;
+		goto cleanup;
+	}
+	memset(fmmod->rds_buf, 0, upsampled_buf_len);
+
+	/* Pilot / RDS part of the upsampled MPX */
+	fmmod->aux_buf = (float *) malloc(upsampled_buf_len);
+	if (fmmod->aux_buf == NULL) {
+		ret = FMMOD_ERR_NOMEM;
+		goto cleanup;
+	}
+	memset(fmmod->aux_buf, 0, upsampled_buf_len);
+
 	/* Upsampled MPX */
 	fmmod->umpxbuf = (float *) malloc(upsampled_buf_len);
 	if (fmmod->umpxbuf == NULL) {
@@ -774,19 +2860,321 @@ fmmod_init_osc(struct fmmod_instance *fmmod)
 		return FMMOD_ERR_OSC_ERR;
 	}
 
+	fmmod_init_continuation_tables(fmmod);
+
 	utils_dbg("[OSC] Init complete\n");
 
 	return 0;
 }
 
+/*
+ * Set up the fixed-point path if we were asked for it, and check it
+ * against the floating point one before using it. The fixed-point MPX
+ * downsampler is only used when the MPX ends at 60KHz, with it going
+ * up to 94KHz the transition band is too narrow for a short FIR.
+ */
+static int
+fmmod_init_fxp(struct fmmod_instance *fmmod, int wide_mpx)
+{
+	const char *env = getenv(FMMOD_FIXED_POINT_ENV);
+	struct resampler_data *rsmpl = &fmmod->rsmpl;
+	float snr = 0.0;
+	int ret = 0;
+
+	if (!env || atoi(env) <= 0)
+		return 0;
+
+	fmmod->rds_q15_buf = (int16_t *) calloc(fmmod->upsampled_num_samples,
+						sizeof(int16_t));
+	fmmod->umpx_q14_buf = (int16_t *) calloc(fmmod->upsampled_num_samples,
+						 sizeof(int16_t));
+	if (fmmod->rds_q15_buf == NULL || fmmod->umpx_q14_buf == NULL)
+		return FMMOD_ERR_NOMEM;
+
+	osc_fxp_init_carriers(&fmmod->fxp_carriers, &fmmod->sin_osc);
+	snr = fmmod_fxp_measure_snr(fmmod);
+	utils_dbg("[FMMOD] Fixed-point generator SNR: %.1fdB\n", snr);
+
+	if (!wide_mpx) {
+		ret = resampler_init_fxp(rsmpl, FMMOD_OUTPUT_SAMPLERATE,
+					 FMMOD_MPX_PASSBAND_END,
+					 FMMOD_FXP_MPX_STOPBAND_BEGIN,
+					 fmmod->upsampled_num_samples);
+		if (ret < 0) {
+			utils_wrn("[FMMOD] No fixed-point MPX downsampler, "
+				  "using floating point\n");
+			return 0;
+		}
+		snr = fmin(snr, rsmpl->mpx_fxp_downsampler.snr);
+	}
+	fmmod->fxp_snr = snr;
+
+	if (snr < FMMOD_FXP_MIN_SNR) {
+		utils_wrn("[FMMOD] Fixed-point SNR too low (%.1fdB), "
+			  "using floating point\n", snr);
+		rsmpl->mpx_fxp = 0;
+		return 0;
+	}
+
+	fmmod->fixed_point = 1;
+	utils_info("[FMMOD] Using fixed-point processing, SNR: %.1fdB\n", snr);
+
+	return 0;
+}
+
+/* How many subcarriers we were asked for, we need to know that
+ * before initializing the resampler (see fmmod_initialize()) */
+static uint32_t
+fmmod_sca_requested(void)
+{
+	const char *env = getenv(FMMOD_SCA_ENV);
+	int num_sca = 0;
+
+	if (env && env[0] != '\0')
+		num_sca = atoi(env);
+	if (num_sca <= 0)
+		return 0;
+	if (num_sca > FMMOD_SCA_MAX) {
+		utils_wrn("[SCA] Too many subcarriers, using %i\n",
+			  FMMOD_SCA_MAX);
+		num_sca = FMMOD_SCA_MAX;
+	}
+
+	return num_sca;
+}
+
+/* Number of RDS2 streams, on top of the legacy one */
+static int
+fmmod_rds2_requested(void)
+{
+	const char *env = getenv(RDS_STREAMS_ENV);
+	int num_streams = 0;
+
+	if (env && env[0] != '\0')
+		num_streams = atoi(env);
+	if (num_streams <= 0)
+		return 0;
+	if (num_streams > RDS_MAX_STREAMS - 1) {
+		utils_wrn("[RDS] Too many RDS2 streams, using %i\n",
+			  RDS_MAX_STREAMS - 1);
+		num_streams = RDS_MAX_STREAMS - 1;
+	}
+
+	return num_streams;
+}
+
+static void
+fmmod_unregister_sca(struct fmmod_instance *fmmod)
+{
+	int i = 0;
+
+	for (i = 0; i < fmmod->num_sca; i++) {
+		if (fmmod->sca[i].port)
+			jack_port_unregister(fmmod->client,
+					     fmmod->sca[i].port);
+		fmmod->sca[i].port = NULL;
+	}
+}
+
+static void
+fmmod_destroy_sca(struct fmmod_instance *fmmod)
+{
+	struct fmmod_sca *sca = NULL;
+	int i = 0;
+
+	for (i = 0; i < fmmod->num_sca; i++) {
+		sca = &fmmod->sca[i];
+		if (sca->upsampler)
+			soxr_delete(sca->upsampler);
+		sca->upsampler = NULL;
+		free(sca->inbuf);
+		sca->inbuf = NULL;
+		free(sca->ubuf);
+		sca->ubuf = NULL;
+	}
+
+	free(fmmod->sca_buf);
+	fmmod->sca_buf = NULL;
+}
+
+static int
+fmmod_init_sca(struct fmmod_instance *fmmod)
+{
+	struct fmmod_sca *sca = NULL;
+	char port_name[8] = { 0 };
+	uint64_t in_frames = 0;
+	uint64_t out_frames = 0;
+	int ret = 0;
+	int i = 0;
+
+	if (!fmmod->num_sca && !fmmod->num_rds2)
+		return 0;
+
+	fmmod->sca_buf = (float *) malloc(fmmod->upsampled_num_samples *
+					  sizeof(float));
+	if (fmmod->sca_buf == NULL) {
+		ret = FMMOD_ERR_NOMEM;
+		goto cleanup;
+	}
+	memset(fmmod->sca_buf, 0, fmmod->upsampled_num_samples *
+				  sizeof(float));
+
+	for (i = 0; i < fmmod->num_sca; i++) {
+		sca = &fmmod->sca[i];
+
+		sca->inbuf = (float *) malloc(fmmod->num_in_samples *
+					      sizeof(float));
+		sca->ubuf = (float *) malloc(fmmod->upsampled_num_samples *
+					     sizeof(float));
+		if (sca->inbuf == NULL || sca->ubuf == NULL) {
+			ret = FMMOD_ERR_NOMEM;
+			goto cleanup;
+		}
+		memset(sca->inbuf, 0, fmmod->num_in_samples * sizeof(float));
+
+		/* Band-limit the input to what fits around the subcarrier */
+		ret = resampler_create_audio_upsampler(&fmmod->rsmpl,
+						FMMOD_SCA_AUDIO_PASSBAND,
+						FMMOD_SCA_AUDIO_STOPBAND,
+						&sca->upsampler);
+		if (ret < 0) {
+			ret = FMMOD_ERR_RESAMPLER_ERR;
+			goto cleanup;
+		}
+		if (sca->upsampler)
+			resampler_reset_audio_upsampler(&fmmod->rsmpl,
+							sca->upsampler,
+							&in_frames,
+							&out_frames);
+
+		snprintf(port_name, 8, "SCA%i", i + 1);
+		sca->port = jack_port_register(fmmod->client, port_name,
+					       JACK_DEFAULT_AUDIO_TYPE,
+					       JackPortIsInput |
+					       JackPortIsTerminal, 0);
+		if (sca->port == NULL) {
+			utils_err("[SCA] Unable to register %s port\n",
+				  port_name);
+			ret = FMMOD_ERR_JACKD_ERR;
+			goto cleanup;
+		}
+	}
+
+	utils_info("[SCA] Subcarrier bank ready, %i subcarriers\n",
+		   fmmod->num_sca);
+
+ cleanup:
+	if (ret < 0) {
+		utils_err("[SCA] Init failed with code: %i\n", ret);
+		fmmod_unregister_sca(fmmod);
+		fmmod_destroy_sca(fmmod);
+	}
+	return ret;
+}
+
+static int
+fmmod_init_outbuf(struct fmmod_instance *fmmod, uint32_t jack_samplerate)
+{
+	struct fmmod_outbuf *ob = &fmmod->ob;
+	const char *env = getenv(FMMOD_OUTBUF_ENV);
+	pthread_condattr_t cattr;
+	int depth = 0;
+	int i = 0;
+
+	if (env && env[0] != '\0')
+		depth = atoi(env);
+	if (depth <= 0) {
+		utils_dbg("[OUTBUF] Disabled\n");
+		return 0;
+	}
+	if (depth > FMMOD_OUTBUF_MAX_PERIODS) {
+		utils_wrn("[OUTBUF] Depth too large, using %i periods\n",
+			  FMMOD_OUTBUF_MAX_PERIODS);
+		depth = FMMOD_OUTBUF_MAX_PERIODS;
+	}
+
+	ob->period_len = fmmod->num_out_samples;
+	ob->periods = (float *) malloc(depth * ob->period_len * sizeof(float));
+	ob->sink_buf = (float *) malloc(ob->period_len * sizeof(float));
+	if (ob->periods == NULL || ob->sink_buf == NULL) {
+		utils_err("[OUTBUF] Could not allocate output buffer\n");
+		free(ob->periods);
+		ob->periods = NULL;
+		free(ob->sink_buf);
+		ob->sink_buf = NULL;
+		return FMMOD_ERR_NOMEM;
+	}
+	memset(ob->sink_buf, 0, ob->period_len * sizeof(float));
+
+	ob->depth = depth;
+	ob->prefill = (depth + 1) / 2;
+	/* Drain at the rate periods come in from JACK */
+	ob->period_frames = fmmod->num_in_samples;
+	ob->samplerate = jack_samplerate;
+	ob->period_ns = (int64_t) fmmod->num_in_samples * 1000000000LL /
+			jack_samplerate;
+
+	for (i = 0; i < FMMOD_OUTBUF_PILOT_TABLE_LEN; i++) {
+		ob->pilot_sin[i] = (float) sin(2.0L * M_PI * 19000.0L *
+					       (double) i /
+					       (double) FMMOD_OUTPUT_SAMPLERATE);
+		ob->pilot_cos[i] = (float) cos(2.0L * M_PI * 19000.0L *
+					       (double) i /
+					       (double) FMMOD_OUTPUT_SAMPLERATE);
+	}
+
+	/* The sink thread sleeps on the monotonic clock */
+	pthread_mutex_init(&ob->mutex, NULL);
+	pthread_condattr_init(&cattr);
+	pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+	pthread_cond_init(&ob->trigger, &cattr);
+	pthread_condattr_destroy(&cattr);
+
+	utils_info("[OUTBUF] Elastic output buffer of %i periods (%ius)\n",
+		   depth, (int) (depth * ob->period_ns / 1000));
+
+	return 0;
+}
+
+static void
+fmmod_destroy_outbuf(struct fmmod_instance *fmmod)
+{
+	struct fmmod_outbuf *ob = &fmmod->ob;
+
+	if (!ob->depth)
+		return;
+
+	/* Wake up the sink thread and wait for it to exit,
+	 * it may still be using the socket / RTP server */
+	pthread_mutex_lock(&ob->mutex);
+	pthread_cond_signal(&ob->trigger);
+	pthread_mutex_unlock(&ob->mutex);
+	if (ob->thread_running)
+		pthread_join(ob->tid, NULL);
+	ob->thread_running = 0;
+
+	pthread_mutex_destroy(&ob->mutex);
+	pthread_cond_destroy(&ob->trigger);
+
+	free(ob->periods);
+	ob->periods = NULL;
+	free(ob->sink_buf);
+	ob->sink_buf = NULL;
+	ob->depth = 0;
+
+	utils_dbg("[OUTBUF] Destroyed\n");
+}
+
 static void
 fmmod_destroy_filters(struct fmmod_instance *fmmod)
 {
 	struct fmmod_flts *flts = &fmmod->flts;
 
-	lpf_filter_destroy(&flts->lpf_l);
+	lpf_filter_destroy(&flts->audio_lpf);
+
+	tp_meter_destroy(&flts->mpx_tpm);
 
-	lpf_filter_destroy(&flts->lpf_r);
+	mpx_limiter_destroy(&flts->mpx_lim);
 
 	lpf_filter_destroy(&flts->ssb_lpf);
 
@@ -802,70 +3190,60 @@ fmmod_init_filters(struct fmmod_instance *fmmod, uint32_t jack_samplerate)
 	int ret = 0;
 
 	/* Initialize audio FM pre-emphasis IIR filter */
-	ret = fmpreemph_filter_init(&flts->fmprf_l, (float) jack_samplerate);
+	ret = fmpreemph_filter_init(&flts->fmprf, (float) jack_samplerate);
 	if(ret < 0) {
-		utils_err("[FILTERS] Pre-emphasis filter (L) init failed with code: %i\n", ret);
+		utils_err("[FILTERS] Pre-emphasis filter init failed with code: %i\n", ret);
 		ret = FMMOD_ERR_AFLT;
 		return ret;
 	}
 
-	ret = fmpreemph_filter_init(&flts->fmprf_r, (float) jack_samplerate);
-	if(ret < 0) {
-		utils_err("[FILTERS] Pre-emphasis filter (R) init failed with code: %i\n", ret);
-		ret = FMMOD_ERR_AFLT;
-		return ret;
+	/* Initialize audio low-pass FFT filter for protecting the pilot,
+	 * both L and R go through the same (batched) filter. We only need
+	 * it when the audio upsampler is bypassed, else the upsampler
+	 * band-limits the audio by itself. */
+	if (fmmod->rsmpl.audio_upsampler_bypass) {
+		ret = lpf_filter_init(&flts->audio_lpf, AFLT_CUTOFF_FREQ,
+				      jack_samplerate, fmmod->num_in_samples,
+				      AFLT_LPF_OVERLAP_FACTOR, 2,
+				      __atomic_load_n(&fmmod->fast_start,
+						      __ATOMIC_ACQUIRE));
+		if (ret < 0) {
+			utils_err("[FILTERS] LPF (Audio) init failed with code: %i\n", ret);
+			ret = FMMOD_ERR_AFLT;
+			goto cleanup;
+		}
 	}
 
-	/* Initialize audio low-pass FFT filter for protecting the pilot */
-	ret = lpf_filter_init(&flts->lpf_l, AFLT_CUTOFF_FREQ, jack_samplerate,
-			      fmmod->num_in_samples, AFLT_LPF_OVERLAP_FACTOR);
+	/* Initialize the MPX output level meter */
+	ret = tp_meter_init(&flts->mpx_tpm, fmmod->num_out_samples);
 	if (ret < 0) {
-		utils_err("[FILTERS] LPF (L) init failed with code: %i\n", ret);
+		utils_err("[FILTERS] MPX level meter init failed with code: %i\n", ret);
+		lpf_filter_destroy(&flts->audio_lpf);
 		ret = FMMOD_ERR_AFLT;
 		goto cleanup;
 	}
 
-	ret = lpf_filter_init(&flts->lpf_r, AFLT_CUTOFF_FREQ, jack_samplerate,
-			      fmmod->num_in_samples, AFLT_LPF_OVERLAP_FACTOR);
+	/* Initialize the composite limiter, it runs at the main
+	 * oscilator's sample rate, on tiles of up to a period */
+	ret = mpx_limiter_init(&flts->mpx_lim,
+			       OSC_SAMPLE_RATE / 1000 * MPXL_LOOKAHEAD_USECS / 1000,
+			       OSC_SAMPLE_RATE / 1000 * MPXL_RELEASE_MSECS,
+			       fmmod->upsampled_num_samples);
 	if (ret < 0) {
-		utils_err("[FILTERS] LPF (R) init failed with code: %i\n", ret);
+		utils_err("[FILTERS] MPX limiter init failed with code: %i\n", ret);
+		tp_meter_destroy(&flts->mpx_tpm);
+		lpf_filter_destroy(&flts->audio_lpf);
 		ret = FMMOD_ERR_AFLT;
 		goto cleanup;
 	}
 
-	/* Initialize the low pass FFT filter for the filter-based SSB modulator */
-	ret = lpf_filter_init(&flts->ssb_lpf, 38000, OSC_SAMPLE_RATE,
-			      fmmod->upsampled_num_samples, SSB_LPF_OVERLAP_FACTOR);
-	if (ret < 0) {
-		utils_err("[FILTERS] LPF (SSB) init failed with code: %i\n", ret);
-		ret = FMMOD_ERR_LPF;
-		goto cleanup;
-	}
-
-
-	/* Initialize the Hilbert transformer for the Hartley modulator */
-	ret = hilbert_transformer_init(&flts->ht, fmmod->upsampled_num_samples);
-	if (ret < 0) {
-		utils_err("[FILTERS] Hilbert transformer init failed with code: %i\n", ret);
-		ret = FMMOD_ERR_HILBERT;
-		goto cleanup;
-	}
+	/* The SSB LPF and the Hilbert transformer are created
+	 * on demand, see fmmod_update_mode_filters() */
 
  cleanup:
-	if (ret < 0) {
-		switch (ret) {
-		case FMMOD_ERR_HILBERT:
-			lpf_filter_destroy(&flts->ssb_lpf);
-			/* Fallthrough */
-		case FMMOD_ERR_LPF:
-			lpf_filter_destroy(&flts->lpf_l);
-			lpf_filter_destroy(&flts->lpf_r);
-			/* Fallthrough */
-		default:
-			break;
-		}
+	if (ret < 0)
 		utils_err("[FILTERS] Init failed with code: %i\n", ret);
-	} else
+	else
 		utils_dbg("[FILTERS] Init complete\n");
 
 	return ret;
@@ -909,6 +3287,7 @@ static int
 fmmod_init_ctl(struct fmmod_instance *fmmod)
 {
 	struct fmmod_control *ctl = NULL;
+	int i = 0;
 
 	/* Initialize the control I/O channel */
 	fmmod->ctl_map = utils_shm_init(FMMOD_CTL_SHM_NAME,
@@ -927,7 +3306,34 @@ fmmod_init_ctl(struct fmmod_instance *fmmod)
 	ctl->mpx_gain = 0.75;
 	ctl->stereo_modulation = FMMOD_DSB;
 	ctl->use_audio_lpf = 1;
+	ctl->audio_lpf_cutoff = AFLT_CUTOFF_FREQ;
+	ctl->audio_lpf_transition = AFLT_STOPBAND_FREQ - AFLT_CUTOFF_FREQ;
+	fmmod->audio_lpf_cutoff = ctl->audio_lpf_cutoff;
+	fmmod->audio_lpf_transition = ctl->audio_lpf_transition;
 	ctl->preemph_tau = LPF_PREEMPH_50US;
+	ctl->use_mpx_power_control = 0;
+	ctl->mpx_power_limit = 0.0;
+	ctl->use_mpx_limiter = 0;
+	ctl->mpx_limiter_ceiling = 1.0;
+	audio_processor_init_control(&ctl->aproc);
+	ctl->use_degradation = 1;
+	ctl->outbuf_depth = fmmod->ob.depth;
+	ctl->num_subcarriers = fmmod->num_sca;
+	ctl->rds2_streams = fmmod->num_rds2;
+	ctl->rds2_gain = 0.03;
+	ctl->iq_sample_rate = fmmod->iq.active ? fmmod->iq.sample_rate : 0;
+	ctl->iq_deviation = IQ_SINK_DEFAULT_DEVIATION;
+	ctl->fixed_point = fmmod->fixed_point;
+	ctl->fixed_point_snr = fmmod->fxp_snr;
+	for (i = 0; i < FMMOD_SCA_MAX; i++) {
+		ctl->sca[i].freq = fmmod_sca_default_freqs[i];
+		ctl->sca[i].modulation = FMMOD_SCA_FM;
+		ctl->sca[i].source = FMMOD_SCA_SRC_INPUT;
+		ctl->sca[i].tone_freq = 1000.0;
+		ctl->sca[i].level = 0.1;
+		ctl->sca[i].deviation = 6000.0;
+	}
+	fmmod->mpxp.gain.end = 1.0;
 	ctl->sample_rate = FMMOD_OUTPUT_SAMPLERATE;
 	ctl->max_samples = fmmod->num_out_samples;
 
@@ -946,6 +3352,8 @@ fmmod_initialize(struct fmmod_instance *fmmod)
 {
 	uint32_t jack_samplerate = 0;
 	uint32_t output_buf_len = 0;
+	int fast_start = 0;
+	int wide_mpx = 0;
 	int ret = 0;
 
 	memset(fmmod, 0, sizeof(struct fmmod_instance));
@@ -966,11 +3374,22 @@ fmmod_initialize(struct fmmod_instance *fmmod)
 		goto cleanup;
 	}
 
+	/* Time budget of each period (in nsecs) for the degradation ladder */
+	fmmod->dgr.budget = (int64_t) fmmod->num_in_samples * 1000000000LL /
+			    jack_samplerate;
+	fmmod->dgr.recovery_periods = FMMOD_DGR_RECOVERY_SECS * jack_samplerate /
+				      fmmod->num_in_samples;
+
 	/* Initialize buffers */
 	ret = fmmod_init_buffers(fmmod, jack_samplerate);
 	if (ret < 0)
 		goto cleanup;
 
+	/* Initialize the elastic output buffer, if requested */
+	ret = fmmod_init_outbuf(fmmod, jack_samplerate);
+	if (ret < 0)
+		goto cleanup;
+
 	/* Initialize locks / triggers */
 	fmmod_init_locks(fmmod);
 
@@ -979,24 +3398,69 @@ fmmod_initialize(struct fmmod_instance *fmmod)
 	if (ret < 0)
 		goto cleanup;
 
-	/* Initialize resampler */
+	/* Initialize resampler, if we'll have subcarriers (or RDS2
+	 * streams) above RDS the MPX downsampler needs to let them through */
+	fmmod->num_sca = fmmod_sca_requested();
+	fmmod->num_rds2 = fmmod_rds2_requested();
+	wide_mpx = fmmod->num_sca || fmmod->num_rds2;
 	ret = resampler_init(&fmmod->rsmpl, jack_samplerate,
 			     fmmod->client,
 			     OSC_SAMPLE_RATE,
-			     RDS_SAMPLE_RATE,
-			     FMMOD_OUTPUT_SAMPLERATE);
+			     FMMOD_OUTPUT_SAMPLERATE,
+			     AFLT_CUTOFF_FREQ,
+			     AFLT_STOPBAND_FREQ,
+			     wide_mpx ? FMMOD_MPX_WIDE_PASSBAND_END :
+					FMMOD_MPX_PASSBAND_END,
+			     wide_mpx ? FMMOD_MPX_WIDE_STOPBAND_BEGIN :
+					FMMOD_MPX_STOPBAND_BEGIN,
+			     fmmod->num_in_samples);
 	if (ret < 0) {
 		ret = FMMOD_ERR_RESAMPLER_ERR;
 		goto cleanup;
 	}
 
-	/* Initialize filters */
+	/* Initialize the subcarrier bank */
+	ret = fmmod_init_sca(fmmod);
+	if (ret < 0)
+		goto cleanup;
+
+	/* Switch to the fixed-point path, if requested */
+	ret = fmmod_init_fxp(fmmod, wide_mpx);
+	if (ret < 0)
+		goto cleanup;
+
+	/* Feed the resamplers with silence so that they
+	 * output full-length periods from the start */
+	resampler_prime(&fmmod->rsmpl, fmmod->num_in_samples,
+			fmmod->upsampled_num_samples,
+			fmmod->num_out_samples);
+
+	/* Initialize filters, load any stored FFTW wisdom first so that
+	 * we don't have to measure the same plans again, and store any
+	 * newly measured ones afterwards. On fast start we'll measure
+	 * them later on, from the housekeeping thread. */
+	fft_wisdom_import();
+	fast_start = fft_fast_start_enabled();
+	__atomic_store_n(&fmmod->fast_start, fast_start, __ATOMIC_RELEASE);
+	if (fast_start)
+		utils_info("[FMMOD] Fast start, using estimated FFT plans\n");
 	ret = fmmod_init_filters(fmmod, jack_samplerate);
 	if (ret < 0)
 		goto cleanup;
+	if (!fast_start)
+		fft_wisdom_export();
+
+	/* Initialize the audio processor */
+	ret = audio_processor_init(&fmmod->aproc, jack_samplerate,
+				   fmmod->num_in_samples);
+	if (ret < 0) {
+		ret = FMMOD_ERR_AFLT;
+		goto cleanup;
+	}
 
 	/* Initialize RDS encoder */
-	ret = rds_encoder_init(&fmmod->rds_enc, fmmod->client, &fmmod->rsmpl);
+	ret = rds_encoder_init(&fmmod->rds_enc, fmmod->client, OSC_SAMPLE_RATE,
+			       1 + fmmod->num_rds2);
 	if (ret < 0) {
 		ret = FMMOD_ERR_RDS_ERR;
 		goto cleanup;
@@ -1018,6 +3482,13 @@ fmmod_initialize(struct fmmod_instance *fmmod)
 		goto cleanup;
 	}
 
+	/* Initialize the FM I/Q output, if requested */
+	ret = iq_sink_init(&fmmod->iq, FMMOD_OUTPUT_SAMPLERATE, wide_mpx);
+	if (ret < 0) {
+		ret = FMMOD_ERR_IQ_ERR;
+		goto cleanup;
+	}
+
 	/* Initialize control channel */
 	ret = fmmod_init_ctl(fmmod);
 	if (ret < 0)
@@ -1035,6 +3506,32 @@ fmmod_initialize(struct fmmod_instance *fmmod)
 		return ret;
 	}
 
+	/* Init the output buffer's sink thread, it has
+	 * deadlines to meet so it runs at RT priority */
+	if (fmmod->ob.depth) {
+		ret = jack_client_create_thread(fmmod->client, &fmmod->ob.tid,
+					jack_client_real_time_priority(fmmod->client),
+					jack_is_realtime(fmmod->client),
+					fmmod_outbuf_sink_loop, (void *) fmmod);
+		if (ret != 0) {
+			utils_err("[OUTBUF] Could not create sink thread\n");
+			ret = FMMOD_ERR_JACKD_ERR;
+			goto cleanup;
+		}
+		fmmod->ob.thread_running = 1;
+	}
+
+	/* Init housekeeping thread */
+	ret = pthread_create(&fmmod->hk_tid, NULL, fmmod_housekeeping_loop,
+			     (void *) fmmod);
+	if (ret != 0) {
+		utils_err("[FMMOD] Could not create housekeeping thread: %i\n",
+			  ret);
+		fmmod->hk_tid = 0;
+		ret = FMMOD_ERR_NOMEM;
+		goto cleanup;
+	}
+
 	/* Tell the JACK server that we are ready to roll.  Our
 	 * process() callback will start running now. */
 	ret = jack_activate(fmmod->client);
@@ -1066,6 +3563,7 @@ fmmod_destroy(struct fmmod_instance *fmmod, int shutdown)
 			jack_port_unregister(fmmod->client, fmmod->inL);
 		if (fmmod->inR)
 			jack_port_unregister(fmmod->client, fmmod->inR);
+		fmmod_unregister_sca(fmmod);
 		jack_client_close(fmmod->client);
 	} else
 		utils_dbg("[FMMOD] Jack dropped fmmod\n");
@@ -1079,6 +3577,19 @@ fmmod_destroy(struct fmmod_instance *fmmod, int shutdown)
 	pthread_cond_signal(&fmmod->proc_trigger);
 	pthread_mutex_unlock(&fmmod->proc_mutex);
 
+	/* Wake up the housekeeping thread and wait for it to exit,
+	 * it may still be using the filters */
+	pthread_mutex_lock(&fmmod->hk_mutex);
+	pthread_cond_signal(&fmmod->hk_trigger);
+	pthread_mutex_unlock(&fmmod->hk_mutex);
+	if (fmmod->hk_tid)
+		pthread_join(fmmod->hk_tid, NULL);
+
+	/* Same for the sink thread */
+	fmmod_destroy_outbuf(fmmod);
+
+	iq_sink_destroy(&fmmod->iq);
+
 	utils_shm_destroy(fmmod->ctl_map, 1);
 
 	utils_dbg("[FMMOD] Control channel closed\n");
@@ -1089,8 +3600,15 @@ fmmod_destroy(struct fmmod_instance *fmmod, int shutdown)
 
 	resampler_destroy(&fmmod->rsmpl);
 
+	if (fmmod->weaver_active)
+		fmmod_weaver_destroy(&fmmod->weaver);
+
 	fmmod_destroy_filters(fmmod);
 
+	audio_processor_destroy(&fmmod->aproc);
+
+	fmmod_destroy_sca(fmmod);
+
 	fmmod_destroy_locks(fmmod);
 
 	fmmod_free_buffers(fmmod);
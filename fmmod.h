@@ -18,11 +18,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <jack/jack.h>		/* For jack-related types */
-#include "filters.h"
+#include <time.h>		/* For time_t */
+#include "filters.h"		/* Also brings in fft.h */
+#include "audio_processor.h"	/* Needs filters.h */
 #include "resampler.h"
 #include "oscilator.h"		/* Also brings in stdint.h and config.h */
 #include "rds_encoder.h"
 #include "rtp_server.h"
+#include "iq_sink.h"
 
 /* We need something big enough to output the MPX
  * signal. 96KHz should be enough for the audio part
@@ -45,18 +48,73 @@ enum fmmod_errors {
 	FMMOD_ERR_LPF = -11,
 	FMMOD_ERR_HILBERT = -12,
 	FMMOD_ERR_AFLT = -13,
+	FMMOD_ERR_IQ_ERR = -14,
 };
 
 /* Stereo signal (L-R) encoding:
  * DSB -> Double side band (default)
  * SSB HARTLEY -> Single Side Band Hartley modulator
  * SSB LPF -> LPF-Based Single Side Band modulator
+ * SSB WEAVER -> Weaver (third method) Single Side Band modulator
  * For more infos check out fmmod.c */
 enum fmmod_stereo_modulation {
 	FMMOD_DSB = 0,
 	FMMOD_SSB_HARTLEY = 1,
 	FMMOD_SSB_LPF = 2,
-	FMMOD_MONO = 3
+	FMMOD_MONO = 3,
+	FMMOD_SSB_WEAVER = 4
+};
+
+/* Degradation ladder, when a period gets too close to its deadline
+ * we go down one step (to a cheaper path), and back up once there is
+ * enough headroom again. The first steps only cost quality, the ones
+ * that keep the program audio in check (LPF, audio processor / limiter)
+ * go last. As a last resort, when the audio doesn't make it in time
+ * at all, we send a period of pilot / RDS only. */
+enum fmmod_degradation {
+	FMMOD_DGR_NONE = 0,		/* Full quality */
+	FMMOD_DGR_DSB = 1,		/* SSB -> DSB */
+	FMMOD_DGR_NO_SCA = 2,		/* Fade out the subcarriers / RDS2 */
+	FMMOD_DGR_NO_AUDIO_LPF = 3,	/* Don't band-limit the audio */
+	FMMOD_DGR_NO_AUDIO_PROC = 4,	/* Skip the audio processor */
+	FMMOD_DGR_MAX = 5
+};
+
+/* Subcarrier bank (SCA), up to FMMOD_SCA_MAX extra subcarriers above
+ * RDS, each one FM or AM modulated by its own JACK input or a tone. The
+ * number of subcarriers (and their inputs) is set on startup through
+ * FMMOD_SCA_ENV, the rest can be changed through the control channel.
+ * Each subcarrier's sidebands (its audio bandwidth, plus the deviation
+ * for FM) must stay below the MPX downsampler's passband end, and their
+ * total injection is kept within FMMOD_SCA_MAX_INJECTION. */
+#define FMMOD_SCA_ENV		"JMPXRDS_SUBCARRIERS"
+#define FMMOD_SCA_MAX		4
+#define FMMOD_SCA_MIN_FREQ	60000
+#define FMMOD_SCA_MAX_FREQ	(FMMOD_MPX_WIDE_PASSBAND_END - \
+				 FMMOD_SCA_AUDIO_PASSBAND)
+#define FMMOD_SCA_MAX_INJECTION	0.20
+
+enum fmmod_sca_modulation {
+	FMMOD_SCA_FM = 0,
+	FMMOD_SCA_AM = 1
+};
+
+enum fmmod_sca_source {
+	FMMOD_SCA_SRC_NONE = 0,		/* Unmodulated carrier */
+	FMMOD_SCA_SRC_TONE = 1,
+	FMMOD_SCA_SRC_INPUT = 2		/* The subcarrier's JACK input */
+};
+
+/* Level is the injection relative to full deviation, deviation
+ * is in Hz for FM and the modulation depth (0 - 1) for AM */
+struct fmmod_sca_control {
+	int enabled;
+	float freq;
+	enum fmmod_sca_modulation modulation;
+	enum fmmod_sca_source source;
+	float tone_freq;
+	float level;
+	float deviation;
 };
 
 /* Control I/O channel */
@@ -68,22 +126,349 @@ struct fmmod_control {
 	float mpx_gain;
 	enum fmmod_stereo_modulation stereo_modulation;
 	int use_audio_lpf;
+	int audio_lpf_cutoff;
+	int audio_lpf_transition;
 	enum fmpreemph_mode preemph_tau;
 	float peak_mpx_out;
 	float peak_audio_in_l;
 	float peak_audio_in_r;
 	int sample_rate;
 	int max_samples;
+	/* MPX output levels of the last period, peak_mpx_out above
+	 * is the absolute sample peak. Since they are updated
+	 * together, they are published through a seqlock, use
+	 * fmmod_read_mpx_levels() to get a consistent set */
+	uint32_t mpx_levels_seq;
+	float true_peak_mpx_out;
+	float rms_mpx_out;
+	/* ITU-R BS.412 MPX power control, limit and
+	 * the measured 60sec power are in dBr */
+	int use_mpx_power_control;
+	float mpx_power_limit;
+	float mpx_power;
+	float mpx_power_gain_reduction;
+	/* Composite limiter, the ceiling is relative to full
+	 * deviation, gain reduction (dB) is the largest one
+	 * of the last period and latency is in usecs */
+	int use_mpx_limiter;
+	float mpx_limiter_ceiling;
+	float mpx_limiter_gain_reduction;
+	int mpx_limiter_latency;
+	/* Built-in audio processor (AGC, multiband
+	 * compressor and limiter) */
+	struct audio_processor_control aproc;
+	/* Degradation ladder, load is the projected cost of
+	 * a period as a percentage of its duration, transitions
+	 * count how many times we entered each level */
+	int use_degradation;
+	enum fmmod_degradation degradation_level;
+	float period_load;
+	uint32_t degradation_transitions[FMMOD_DGR_MAX];
+	uint32_t continuation_periods;
+	uint32_t dropped_periods;
+	/* Elastic output buffer, depth and fill are in periods
+	 * (fill is the average / min / max of the last second) and
+	 * latency is the extra latency it adds, in usecs */
+	uint32_t outbuf_depth;
+	float outbuf_fill;
+	uint32_t outbuf_min_fill;
+	uint32_t outbuf_max_fill;
+	uint32_t outbuf_latency;
+	uint32_t outbuf_underflows;
+	uint32_t outbuf_overflows;
+	/* Subcarrier bank, num_subcarriers is read-only */
+	uint32_t num_subcarriers;
+	struct fmmod_sca_control sca[FMMOD_SCA_MAX];
+	/* RDS2 streams (on top of the legacy one) and their
+	 * level, rds2_streams is read-only */
+	uint32_t rds2_streams;
+	float rds2_gain;
+	/* I/Q output, iq_sample_rate is 0 when it's disabled and
+	 * iq_dropped counts the MPX samples it had to drop (both
+	 * are read-only), iq_deviation is the peak deviation in Hz */
+	uint32_t iq_sample_rate;
+	float iq_deviation;
+	uint32_t iq_dropped;
+	/* Fixed-point path and its SNR against the floating
+	 * point one, measured on init (both read-only) */
+	uint32_t fixed_point;
+	float fixed_point_snr;
 };
 
+static inline void
+fmmod_read_mpx_levels(const struct fmmod_control *ctl, float *peak,
+		      float *true_peak, float *rms)
+{
+	uint32_t seq = 0;
+
+	do {
+		seq = __atomic_load_n(&ctl->mpx_levels_seq, __ATOMIC_ACQUIRE);
+		*peak = ctl->peak_mpx_out;
+		*true_peak = ctl->true_peak_mpx_out;
+		*rms = ctl->rms_mpx_out;
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while ((seq & 1) ||
+		 seq != __atomic_load_n(&ctl->mpx_levels_seq, __ATOMIC_RELAXED));
+}
+
+/* Mode-specific filters get released after being
+ * unused for that long (in seconds) */
+#define FMMOD_FLT_IDLE_TIMEOUT	60
+
+/* Composite limiter, see filters.c */
+#define MPXL_LOOKAHEAD_USECS	1000
+#define MPXL_RELEASE_MSECS	50
+
 /* Filters */
 struct fmmod_flts {
-	struct fmpreemph_filter_data fmprf_l;
-	struct fmpreemph_filter_data fmprf_r;
-	struct lpf_filter_data lpf_l;
-	struct lpf_filter_data lpf_r;
+	struct fmpreemph_filter_data fmprf;
+	struct lpf_filter_data audio_lpf;
+	struct tp_meter_data mpx_tpm;
+	struct mpx_limiter_data mpx_lim;
+	/* Created on demand by the housekeeping thread */
 	struct lpf_filter_data ssb_lpf;
 	struct hilbert_transformer_data ht;
+	int ssb_lpf_active;
+	int ht_active;
+	time_t ssb_lpf_last_used;
+	time_t ht_last_used;
+};
+
+/* Weaver modulator, filtering happens at the input
+ * sample rate, before upsampling */
+#define WEAVER_FIR_TAPS	127
+
+struct fmmod_weaver {
+	struct fir_filter_data i_fir;
+	struct fir_filter_data q_fir;
+	struct fir_filter_data lpr_delay;
+	/* Band-limited upsamplers for L+R, I and Q */
+	soxr_t upsampler_lpr;
+	soxr_t upsampler_i;
+	soxr_t upsampler_q;
+	/* Input-rate buffers */
+	float *lpr_buf;
+	float *i_buf;
+	float *q_buf;
+	/* Upsampled Q, I goes to the L-R buffer */
+	float *q_out;
+	/* First LO, at the input / output sample rates */
+	double lo_freq;
+	double lo_step;
+	double lo_out_step;
+	double lo_phase;
+	double lo_out_phase;
+	/* Table NCOs for the two LOs, re-synced from the phases
+	 * above on each run, and the second LO's sine / cosine */
+	struct osc_nco lo_nco;
+	struct osc_nco lo_out_nco;
+	float *lo_sin;
+	float *lo_cos;
+	/* FIR + upsampler delay at lo_freq, in radians */
+	double delay_phase;
+	int running;
+	/* Left idle by the processing thread, the housekeeping
+	 * thread primes it again, use __atomic_* to access it */
+	int stale;
+};
+
+/* A gain that moves linearly from start to end within a
+ * period, instead of jumping to its new value (zipper noise) */
+struct fmmod_ramp {
+	float start;
+	float end;
+	float step;
+};
+
+/* Same in Q24, for the fixed-point generators */
+struct fmmod_fxp_ramp {
+	int32_t start;
+	int32_t step;
+};
+
+/* The MPX gains for the current period */
+struct fmmod_gains {
+	struct fmmod_ramp pilot;
+	struct fmmod_ramp rds;
+	struct fmmod_ramp rds2;
+	struct fmmod_ramp stereo_carrier;
+	struct fmmod_ramp mpx;
+};
+
+/* MPX power control (ITU-R BS.412), the power is
+ * integrated over a sliding 60sec window, made of
+ * one-second bins */
+#define MPXP_WINDOW_SECS	60
+/* How fast the gain may go down / up, in dB per second */
+#define MPXP_ATTACK_DB		1.0
+#define MPXP_RELEASE_DB		0.25
+/* The reference power (0dBr), that of a sine that gives
+ * +/-19KHz deviation, when full scale is +/-75KHz */
+#define MPXP_REF_POWER		(0.5 * (19.0 / 75.0) * (19.0 / 75.0))
+#define MPXP_LIMIT_MIN		-12.0
+#define MPXP_LIMIT_MAX		12.0
+
+struct mpx_power_control {
+	/* MPX energy and the energy of L+R / L-R (without
+	 * our gain applied) for each bin */
+	double energy[MPXP_WINDOW_SECS];
+	double audio_energy[MPXP_WINDOW_SECS];
+	uint32_t num_samples[MPXP_WINDOW_SECS];
+	/* Running sums of the above */
+	double energy_sum;
+	double audio_energy_sum;
+	uint64_t num_samples_sum;
+	/* The bin being filled */
+	int bin;
+	double cur_energy;
+	double cur_audio_energy;
+	uint32_t cur_num_samples;
+	/* Gain applied on L+R / L-R */
+	double gain_db;
+	struct fmmod_ramp gain;
+};
+
+/* Go down when the projected cost of a period goes above
+ * FMMOD_DGR_LOAD_HIGH of its duration, go back up when it
+ * stays below FMMOD_DGR_LOAD_LOW for FMMOD_DGR_RECOVERY_SECS */
+#define FMMOD_DGR_LOAD_HIGH	0.75
+#define FMMOD_DGR_LOAD_LOW	0.40
+#define FMMOD_DGR_RECOVERY_SECS	5
+
+struct fmmod_degradation_state {
+	enum fmmod_degradation level;
+	/* In nsecs */
+	int64_t cost;
+	int64_t budget;
+	uint32_t calm_periods;
+	uint32_t recovery_periods;
+	/* Periods that didn't make it, from both threads */
+	uint32_t dropped;
+	uint32_t dropped_seen;
+	/* Periods the JACK callback couldn't hand over, the
+	 * processing thread owes a pilot / RDS period for each */
+	uint32_t missed;
+};
+
+/* Pilot / RDS carrier tables for the last resort (pilot / RDS only)
+ * periods, at the main oscilator's sample rate they both fit an
+ * integer number of samples per cycle */
+#define FMMOD_PILOT_TABLE_LEN	(OSC_SAMPLE_RATE / 19000)
+#define FMMOD_RDS_TABLE_LEN	(OSC_SAMPLE_RATE / 57000)
+
+/* Depth of the elastic output buffer in periods, 0 (the default)
+ * sends each period out as soon as it's ready */
+#define FMMOD_OUTBUF_ENV		"JMPXRDS_OUTBUF_PERIODS"
+#define FMMOD_OUTBUF_MAX_PERIODS	32
+
+/* 19KHz and 192KHz have 1KHz as their GCD, so 19 pilot cycles
+ * fit in 192 samples at the output sample rate */
+#define FMMOD_OUTBUF_PILOT_TABLE_LEN	(FMMOD_OUTPUT_SAMPLERATE / 1000)
+
+struct fmmod_outbuf {
+	/* Ring of depth periods, period_len samples each */
+	float *periods;
+	uint32_t depth;
+	uint32_t period_len;
+	uint32_t head;
+	uint32_t tail;
+	uint32_t fill;
+	/* Start sending once there are that many periods
+	 * queued, and again after the ring runs dry */
+	uint32_t prefill;
+	int running;
+	int started;
+	/* The period being sent out */
+	float *sink_buf;
+	int64_t period_ns;
+	/* The sink is paced on JACK's frame clock */
+	uint32_t period_frames;
+	uint32_t samplerate;
+	/* Pilot continuation for when the ring runs dry */
+	float pilot_sin[FMMOD_OUTBUF_PILOT_TABLE_LEN];
+	float pilot_cos[FMMOD_OUTBUF_PILOT_TABLE_LEN];
+	float pilot_i;
+	float pilot_q;
+	uint32_t pilot_pos;
+	int pilot_valid;
+	/* Occupancy within the current second */
+	uint32_t stat_periods;
+	uint32_t stat_fill_sum;
+	uint32_t stat_min_fill;
+	uint32_t stat_max_fill;
+	/* Sink thread */
+	jack_native_thread_t tid;
+	int thread_running;
+	pthread_mutex_t mutex;
+	pthread_cond_t trigger;
+};
+
+/* The generators, the downsampler and the peak meter process
+ * each period in tiles of that many samples, so that the
+ * tile's buffers (L+R, L-R, RDS, MPX) stay within L1 */
+#define FMMOD_TILE_SAMPLES	1024
+
+/* The MPX downsampler's passband / stopband (in Hz), with the
+ * subcarrier bank or RDS2 in use we open it up to the output's Nyquist */
+#define FMMOD_MPX_PASSBAND_END		60000
+#define FMMOD_MPX_STOPBAND_BEGIN	62500
+#define FMMOD_MPX_WIDE_PASSBAND_END	94000
+#define FMMOD_MPX_WIDE_STOPBAND_BEGIN	96000
+
+/*
+ * Fixed-point path, for boards without a decent FPU, enabled on startup
+ * through FMMOD_FIXED_POINT_ENV. The DSB / mono generators, the RDS
+ * waveform and the MPX downsampler then run in Q15 (the SSB modulators,
+ * the subcarrier bank and RDS2 stay on floating point, and so does the
+ * downsampler when they are in use since its transition band is too
+ * narrow for that). On init it gets checked against the floating point
+ * path, if the SNR is below FMMOD_FXP_MIN_SNR we fall back to that.
+ */
+#define FMMOD_FIXED_POINT_ENV		"JMPXRDS_FIXED_POINT"
+#define FMMOD_FXP_MIN_SNR		70.0
+#define FMMOD_FXP_MPX_STOPBAND_BEGIN	(FMMOD_OUTPUT_SAMPLERATE / 2)
+
+/* Audio bandwidth of the subcarriers' inputs */
+#define FMMOD_SCA_AUDIO_PASSBAND	5000
+#define FMMOD_SCA_AUDIO_STOPBAND	6000
+
+struct fmmod_sca {
+	jack_port_t *port;
+	/* Input / upsampled audio */
+	float *inbuf;
+	float *ubuf;
+	soxr_t upsampler;
+	/* Carrier / tone NCOs, re-initialized when the
+	 * frequencies change */
+	struct osc_nco carrier;
+	struct osc_nco tone;
+	struct fmmod_ramp level;
+};
+
+/* What the current period needs to go through, derived
+ * from the control settings at the start of each period,
+ * so that we skip anything that won't make it on air */
+struct fmmod_plan {
+	enum fmmod_stereo_modulation mode;
+	int stereo;
+	int weaver;
+	int band_limit;
+	int rds;
+	int limit;
+	int process_audio;
+	/* Set when sca_buf is in use, it carries the subcarrier
+	 * bank and / or the RDS2 streams */
+	int sca;
+	int sca_bank;
+	int rds2;
+	/* Unset on pilot / RDS only periods */
+	int sca_input;
+	/* Use the fixed-point generators / RDS waveform */
+	int fixed_point;
+	/* With nothing in between (e.g. the composite limiter), the
+	 * fixed-point generators feed the fixed-point downsampler
+	 * directly, through umpx_q14_buf */
+	int fxp_mpx;
 };
 
 struct fmmod_instance {
@@ -103,12 +488,55 @@ struct fmmod_instance {
 	float *uaudio_buf_0;
 	float *uaudio_buf_1;
 	pthread_mutex_t uaudio_buf_mutex;
+	/* Upsampled RDS waveform */
+	float *rds_buf;
+	/* The pilot / RDS part of the upsampled MPX,
+	 * for the composite limiter */
+	float *aux_buf;
+	int limiter_running;
 	/* MPX Output buffer */
 	float *umpxbuf;
 	float *outbuf;
 	pthread_mutex_t mpx_buf_mutex;
 	/* For socket output */
 	int out_sock_fd;
+	/* Elastic output buffer */
+	struct fmmod_outbuf ob;
+	/* FM I/Q output */
+	struct iq_sink iq;
+	/* Subcarrier bank */
+	struct fmmod_sca sca[FMMOD_SCA_MAX];
+	uint32_t num_sca;
+	/* RDS2 streams, on top of the legacy one */
+	uint32_t num_rds2;
+	/* Sum of the subcarriers and the RDS2 streams,
+	 * at the main oscilator's sample rate */
+	float *sca_buf;
+	float sca_mod_buf[FMMOD_TILE_SAMPLES];
+	float sca_carrier_buf[FMMOD_TILE_SAMPLES];
+	/* Processing plan for the current period */
+	struct fmmod_plan plan;
+	/* The control block may get modified at any time,
+	 * so each period works on its own copy */
+	struct fmmod_control ctl_snap;
+	struct fmmod_gains gains;
+	/* Owned by the JACK process callback */
+	struct fmmod_ramp audio_gain;
+	/* Audio processor */
+	struct audio_processor aproc;
+	int aproc_running;
+	/* MPX power control */
+	struct mpx_power_control mpxp;
+	/* Degradation ladder */
+	struct fmmod_degradation_state dgr;
+	float pilot_table[FMMOD_PILOT_TABLE_LEN];
+	float rds_carrier_table[FMMOD_RDS_TABLE_LEN];
+	/* Fixed-point path */
+	int fixed_point;
+	float fxp_snr;
+	struct osc_fxp_carriers fxp_carriers;
+	int16_t *rds_q15_buf;
+	int16_t *umpx_q14_buf;
 	/* Filters */
 	struct fmmod_flts flts;
 	/* The Oscilator */
@@ -127,12 +555,28 @@ struct fmmod_instance {
 	jack_nframes_t added_latency;
 	/* SSB modulators */
 	struct osc_state cos_osc;
+	/* Created on demand by the housekeeping thread */
+	struct fmmod_weaver weaver;
+	int weaver_active;
+	time_t weaver_last_used;
 	/* Control */
 	struct shm_mapping *ctl_map;
 	struct fmmod_control *ctl;
+	/* Housekeeping (non-RT) thread */
+	pthread_t hk_tid;
+	pthread_mutex_t hk_mutex;
+	pthread_cond_t hk_trigger;
+	/* Cleared by the housekeeping thread once the measured
+	 * plans are in, use __atomic_* to access it */
+	int fast_start;
+	int audio_lpf_cutoff;
+	int audio_lpf_transition;
 };
 
-typedef int (*mpx_generator) (struct fmmod_instance *, const float*, const float*, int, float*);
+/* The generators process num_samples of the current period, starting
+ * at offset, from the L+R / L-R buffers to the upsampled MPX buffer.
+ * They may use the L+R / L-R buffers as scratch space */
+typedef int (*mpx_generator) (struct fmmod_instance *, uint32_t, int);
 
 int fmmod_initialize(struct fmmod_instance *fmmod);
 void fmmod_destroy(struct fmmod_instance *fmmod, int shutdown);
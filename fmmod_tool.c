@@ -24,7 +24,7 @@
 #include <string.h>		/* For memset / strncmp */
 #include <unistd.h>		/* For getopt() */
 
-#define TEMP_BUF_LEN	3 + 1
+#define TEMP_BUF_LEN	6 + 1
 
 void
 usage(char *name)
@@ -37,11 +37,157 @@ usage(char *name)
 		"\t-m   <int>\tSet MPX gain percentage (default is 100%%)\n"
 		"\t-p   <int>\tSet pilot gain percentage (default is 8%%)\n"
 		"\t-r   <int>\tSet RDS gain percentage (default is 2%%)\n"
+		"\t-w   <int>\tSet RDS2 gain percentage, for each stream (needs JMPXRDS_RDS2_STREAMS\n"
+				"\t\t\t\t\ton startup, default is 3%%)\n"
 		"\t-c   <int>\tSet stereo carrier gain percentage (default is 100%%)\n"
 		"\t-s   <int>\tSet stereo mode 0-> DSBSC (default), 1-> SSB (Hartley),\n"
-				"\t\t\t\t\t2-> SSB (LP Filter), 3-> Mono\n"
+				"\t\t\t\t\t2-> SSB (LP Filter), 3-> Mono,\n"
+				"\t\t\t\t\t4-> SSB (Weaver)\n"
 		"\t-f   <int>\tEnable Audio LPF (FIR) (1 -> enabled (default), 0-> disabled)\n"
-		"\t-e	<int>\tSet FM Pre-emphasis tau (0-> 50us, 1-> 75us, 2-> Disabled)\n");
+		"\t-l   <int>\tSet Audio LPF cutoff (passband end) in Hz (default is 16750)\n"
+		"\t-t   <int>\tSet Audio LPF transition band width in Hz (default is 2250),\n"
+				"\t\t\t\t\tcutoff + transition can't go above 19000\n"
+		"\t-e	<int>\tSet FM Pre-emphasis tau (0-> 50us, 1-> 75us, 2-> Disabled)\n"
+		"\t-b   <int>\tEnable ITU-R BS.412 MPX power control (1 -> enabled, 0-> disabled (default))\n"
+		"\t-d   <int>\tSet MPX power limit in dBr, -12 to 12 (default is 0)\n"
+		"\t-k   <int>\tEnable composite limiter (1 -> enabled, 0-> disabled (default))\n"
+		"\t-x   <int>\tSet composite limiter ceiling percentage (default is 100%%)\n"
+		"\t-o   <int>\tEnable audio processor (1 -> enabled, 0-> disabled (default))\n"
+		"\t-u   <int>\tDegrade gracefully when running late (1 -> enabled (default), 0-> disabled)\n"
+		"\t-y   <spec>\tSet up a subcarrier (needs JMPXRDS_SUBCARRIERS on startup), spec is\n"
+				"\t\t\t\t\t<n>,<freq>,<fm|am>,<input|tone|none>,<level %%>[,<deviation>[,<tone freq>]]\n"
+				"\t\t\t\t\twith deviation in Hz for FM or depth %% for AM, or <n>,off to disable it\n"
+				"\t\t\t\t\t(freq + deviation can't go above 89000, total injection is capped at 20%%)\n"
+		"\t-q   <int>\tSet I/Q output peak deviation in Hz (needs JMPXRDS_IQ_OUTPUT\n"
+				"\t\t\t\t\ton startup, default is 75000)\n");
+}
+
+static void
+print_subcarriers(const struct fmmod_control *ctl)
+{
+	const struct fmmod_sca_control *sca = NULL;
+	int i = 0;
+
+	utils_info("Subcarriers: %u\n", ctl->num_subcarriers);
+	for (i = 0; i < ctl->num_subcarriers && i < FMMOD_SCA_MAX; i++) {
+		sca = &ctl->sca[i];
+		if (!sca->enabled) {
+			utils_info("\tSCA%i: Disabled\n", i + 1);
+			continue;
+		}
+		utils_info("\tSCA%i: %iHz, %s (%i%s) from %s, level %i%%\n",
+			   i + 1, (int) sca->freq,
+			   sca->modulation == FMMOD_SCA_AM ? "AM" : "FM",
+			   sca->modulation == FMMOD_SCA_AM ?
+				(int)(100 * sca->deviation) :
+				(int) sca->deviation,
+			   sca->modulation == FMMOD_SCA_AM ? "%" : "Hz",
+			   sca->source == FMMOD_SCA_SRC_INPUT ? "input" :
+			   sca->source == FMMOD_SCA_SRC_TONE ? "tone" : "none",
+			   (int)(100 * sca->level));
+	}
+}
+
+static int
+set_subcarrier(struct fmmod_control *ctl, const char *spec)
+{
+	struct fmmod_sca_control *sca = NULL;
+	struct fmmod_sca_control new_sca = { 0 };
+	char modulation[6] = { 0 };
+	char source[6] = { 0 };
+	int idx = 0;
+	int freq = 0;
+	int level = 0;
+	int deviation = -1;
+	int tone_freq = -1;
+	int ret = 0;
+
+	ret = sscanf(spec, "%i,%5[^,],%5[^,],%i,%i,%i", &idx, modulation,
+		     source, &level, &deviation, &tone_freq);
+	if (ret < 1 || idx < 1 || idx > ctl->num_subcarriers ||
+	    idx > FMMOD_SCA_MAX) {
+		utils_err("Invalid subcarrier\n");
+		return -1;
+	}
+	sca = &ctl->sca[idx - 1];
+
+	if (ret == 2 && !strncmp(modulation, "off", 3)) {
+		sca->enabled = 0;
+		utils_info("Disabled subcarrier:  \t%i\n", idx);
+		return 0;
+	}
+
+	/* Work on a copy and only apply it if it checks out, the
+	 * engine may pick up the subcarrier's settings at any time */
+	new_sca = *sca;
+
+	/* The frequency comes first, re-scan with it */
+	ret = sscanf(spec, "%i,%i,%5[^,],%5[^,],%i,%i,%i", &idx, &freq,
+		     modulation, source, &level, &deviation, &tone_freq);
+	if (ret < 5 || freq < FMMOD_SCA_MIN_FREQ ||
+	    freq > FMMOD_SCA_MAX_FREQ || level < 0 || level > 100) {
+		utils_err("Invalid subcarrier spec, frequency must be within "
+			  "%iHz - %iHz\n", FMMOD_SCA_MIN_FREQ,
+			  FMMOD_SCA_MAX_FREQ);
+		return -1;
+	}
+
+	if (!strncmp(modulation, "am", 2))
+		new_sca.modulation = FMMOD_SCA_AM;
+	else if (!strncmp(modulation, "fm", 2))
+		new_sca.modulation = FMMOD_SCA_FM;
+	else {
+		utils_err("Invalid modulation: %s\n", modulation);
+		return -1;
+	}
+
+	if (!strncmp(source, "input", 5))
+		new_sca.source = FMMOD_SCA_SRC_INPUT;
+	else if (!strncmp(source, "tone", 4))
+		new_sca.source = FMMOD_SCA_SRC_TONE;
+	else if (!strncmp(source, "none", 4))
+		new_sca.source = FMMOD_SCA_SRC_NONE;
+	else {
+		utils_err("Invalid source: %s\n", source);
+		return -1;
+	}
+
+	if (deviation >= 0) {
+		if (new_sca.modulation == FMMOD_SCA_AM)
+			new_sca.deviation = (float) (deviation > 100 ? 100 :
+						     deviation) / 100.0;
+		else
+			new_sca.deviation = (float) (deviation > 20000 ?
+						     20000 : deviation);
+	} else if (new_sca.modulation == FMMOD_SCA_AM &&
+		   new_sca.deviation > 1.0)
+		new_sca.deviation = 0.8;
+	else if (new_sca.modulation == FMMOD_SCA_FM &&
+		 new_sca.deviation <= 1.0)
+		new_sca.deviation = 6000.0;
+	if (tone_freq > 0)
+		new_sca.tone_freq = (float) tone_freq;
+
+	/* Keep the upper sideband within the MPX passband */
+	if (new_sca.modulation == FMMOD_SCA_FM &&
+	    (float) freq + new_sca.deviation + FMMOD_SCA_AUDIO_PASSBAND >
+	    FMMOD_MPX_WIDE_PASSBAND_END) {
+		utils_err("Subcarrier doesn't fit, frequency + deviation must "
+			  "be below %iHz\n", FMMOD_MPX_WIDE_PASSBAND_END -
+			  FMMOD_SCA_AUDIO_PASSBAND);
+		return -1;
+	}
+
+	sca->modulation = new_sca.modulation;
+	sca->source = new_sca.source;
+	sca->deviation = new_sca.deviation;
+	sca->tone_freq = new_sca.tone_freq;
+	sca->freq = (float) freq;
+	sca->level = (float) level / 100.0;
+	sca->enabled = 1;
+	utils_info("Set subcarrier:  \t%i\n", idx);
+
+	return 0;
 }
 
 
@@ -51,6 +197,9 @@ main(int argc, char *argv[])
 	int ret = 0;
 	int opt = 0;
 	long int tmp = 0;
+	float peak_mpx_out = 0.0;
+	float true_peak_mpx_out = 0.0;
+	float rms_mpx_out = 0.0;
 	char temp[TEMP_BUF_LEN] = { 0 };
 	struct shm_mapping *shmem = NULL;
 	struct fmmod_control *ctl = NULL;
@@ -63,39 +212,115 @@ main(int argc, char *argv[])
 	}
 	ctl = (struct fmmod_control*) shmem->mem;
 
-	while ((opt = getopt(argc, argv, "ga:m:p:r:c:s:f:e:")) != -1)
+	while ((opt = getopt(argc, argv, "ga:m:p:r:w:c:s:f:l:t:e:b:d:k:x:o:u:y:q:")) != -1)
 		switch (opt) {
 		case 'g':
+			fmmod_read_mpx_levels(ctl, &peak_mpx_out,
+					      &true_peak_mpx_out, &rms_mpx_out);
 			utils_info("Current config:\n"
 				"\tAudio:     %i%%\n"
 				"\tMPX:       %i%%\n"
 				"\tPilot:     %i%%\n"
 				"\tRDS:       %i%%\n"
+				"\tRDS2:      %i%% (%u streams)\n"
 				"\tStereo gain: %i%%\n"
 				"\tStereo mode: %s\n"
-				"\tAudio LPF: %s\n"
+				"\tAudio LPF: %s (%iHz, %iHz transition)\n"
 				"\tFM Pre-emph tau: %s\n"
+				"\tMPX power control: %s (limit %.1fdBr)\n"
+				"\tComposite limiter: %s (ceiling %i%%, latency %ius)\n"
+				"\tAudio processor: %s\n"
+				"\tGraceful degradation: %s\n"
 				"Current gains:\n"
 				"\tAudio Left:  %f\n"
 				"\tAudio Right: %f\n"
-				"\tMPX:         %f\n",
+				"\tMPX:         %f\n"
+				"\tMPX (true peak): %f\n"
+				"\tMPX (RMS):   %f\n"
+				"\tMPX power (60sec): %.2fdBr\n"
+				"\tMPX power gain reduction: %.2fdB\n"
+				"\tComposite limiter gain reduction: %.2fdB\n"
+				"\tAudio processor AGC gain: %.2fdB\n"
+				"\tAudio processor gain reduction: %.2fdB / %.2fdB / %.2fdB"
+				" (limiter %.2fdB)\n"
+				"Processing:\n"
+				"\tPeriod load: %.1f%%\n"
+				"\tDegradation level: %i (transitions %u / %u / %u / %u / %u)\n"
+				"\tContinuation periods: %u\n"
+				"\tDropped periods: %u\n"
+				"Output buffer:\n"
+				"\tDepth: %u periods\n"
+				"\tFill: %.1f periods (min %u, max %u)\n"
+				"\tLatency: %uus\n"
+				"\tUnderflows / overflows: %u / %u\n",
 				(int)(100 * ctl->audio_gain),
 				(int)(100 * ctl->mpx_gain),
 				(int)(100 * ctl->pilot_gain),
 				(int)(100 * ctl->rds_gain),
+				(int)(100 * ctl->rds2_gain),
+				ctl->rds2_streams,
 				(int)(100 * ctl->stereo_carrier_gain),
 				ctl->stereo_modulation == FMMOD_MONO ? "Mono" :
 				ctl->stereo_modulation ==
 					FMMOD_SSB_HARTLEY ? "SSB (Hartley)" :
 				ctl->stereo_modulation ==
 					FMMOD_SSB_LPF ? "SSB (LP Filter)" :
+				ctl->stereo_modulation ==
+					FMMOD_SSB_WEAVER ? "SSB (Weaver)" :
 				"DSBSC",
 				ctl->use_audio_lpf ? "Enabled" : "Disabled",
+				ctl->audio_lpf_cutoff,
+				ctl->audio_lpf_transition,
 				(ctl->preemph_tau == 0) ? "50us (World)" :
 				(ctl->preemph_tau == 1) ? "75us (U.S.A.)" :
 				"Disabled",
+				ctl->use_mpx_power_control ? "Enabled" : "Disabled",
+				ctl->mpx_power_limit,
+				ctl->use_mpx_limiter ? "Enabled" : "Disabled",
+				(int)(100 * ctl->mpx_limiter_ceiling),
+				ctl->mpx_limiter_latency,
+				ctl->aproc.enabled ? "Enabled" : "Disabled",
+				ctl->use_degradation ? "Enabled" : "Disabled",
 				ctl->peak_audio_in_l, ctl->peak_audio_in_r,
-				ctl->peak_mpx_out);
+				peak_mpx_out, true_peak_mpx_out, rms_mpx_out,
+				ctl->mpx_power, ctl->mpx_power_gain_reduction,
+				ctl->mpx_limiter_gain_reduction,
+				ctl->aproc.agc_gain,
+				ctl->aproc.band[0].gain_reduction,
+				ctl->aproc.band[1].gain_reduction,
+				ctl->aproc.band[2].gain_reduction,
+				ctl->aproc.limiter_gain_reduction,
+				ctl->period_load,
+				ctl->degradation_level,
+				ctl->degradation_transitions[0],
+				ctl->degradation_transitions[1],
+				ctl->degradation_transitions[2],
+				ctl->degradation_transitions[3],
+				ctl->degradation_transitions[4],
+				ctl->continuation_periods,
+				ctl->dropped_periods,
+				ctl->outbuf_depth,
+				ctl->outbuf_fill,
+				ctl->outbuf_min_fill,
+				ctl->outbuf_max_fill,
+				ctl->outbuf_latency,
+				ctl->outbuf_underflows,
+				ctl->outbuf_overflows);
+			print_subcarriers(ctl);
+			if (ctl->iq_sample_rate)
+				utils_info("I/Q output: %uS/s, deviation %iHz,"
+					   " dropped %u samples\n",
+					   ctl->iq_sample_rate,
+					   (int) ctl->iq_deviation,
+					   ctl->iq_dropped);
+			else
+				utils_info("I/Q output: Disabled\n");
+			if (ctl->fixed_point)
+				utils_info("Fixed-point processing: Enabled"
+					   " (SNR %.1fdB)\n",
+					   ctl->fixed_point_snr);
+			else
+				utils_info("Fixed-point processing: Disabled\n");
 			break;
 
 		case 'a':
@@ -130,6 +355,14 @@ main(int argc, char *argv[])
 				   (int)(100 * ctl->rds_gain));
 			break;
 
+		case 'w':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 4, "%s", optarg);
+			ctl->rds2_gain = (float)(strtol(temp, NULL, 10)) / 100.0;
+			utils_info("New RDS2 gain:  \t%i%%\n",
+				   (int)(100 * ctl->rds2_gain));
+			break;
+
 		case 'c':
 			memset(temp, 0, TEMP_BUF_LEN);
 			snprintf(temp, 4, "%s", optarg);
@@ -143,12 +376,14 @@ main(int argc, char *argv[])
 			memset(temp, 0, TEMP_BUF_LEN);
 			snprintf(temp, 2, "%s", optarg);
 			tmp = strtol(temp, NULL, 10) & 0x7;
-			if(tmp == FMMOD_DSB || tmp > FMMOD_MONO)
+			if(tmp == FMMOD_DSB || tmp > FMMOD_SSB_WEAVER)
 				ctl->stereo_modulation = FMMOD_DSB;
 			else if(tmp == FMMOD_SSB_HARTLEY)
 				ctl->stereo_modulation = FMMOD_SSB_HARTLEY;
 			else if(tmp == FMMOD_SSB_LPF)
 				ctl->stereo_modulation = FMMOD_SSB_LPF;
+			else if(tmp == FMMOD_SSB_WEAVER)
+				ctl->stereo_modulation = FMMOD_SSB_WEAVER;
 			else
 				ctl->stereo_modulation = FMMOD_MONO;
 			utils_info("Set stereo modulation:  \t%i\n",
@@ -162,6 +397,22 @@ main(int argc, char *argv[])
 			utils_info("Set Audio LPF status:  \t%i\n",
 				   ctl->use_audio_lpf);
 			break;
+
+		case 'l':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 6, "%s", optarg);
+			ctl->audio_lpf_cutoff = strtol(temp, NULL, 10);
+			utils_info("Set Audio LPF cutoff:  \t%iHz\n",
+				   ctl->audio_lpf_cutoff);
+			break;
+
+		case 't':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 5, "%s", optarg);
+			ctl->audio_lpf_transition = strtol(temp, NULL, 10);
+			utils_info("Set Audio LPF transition:  \t%iHz\n",
+				   ctl->audio_lpf_transition);
+			break;
 		case 'e':
 			memset(temp, 0, TEMP_BUF_LEN);
 			snprintf(temp, 2, "%s", optarg);
@@ -175,6 +426,84 @@ main(int argc, char *argv[])
 			utils_info("Set FM Pre-emphasis tau:  \t%i\n",
 				   ctl->preemph_tau);
 			break;
+
+		case 'b':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 2, "%s", optarg);
+			ctl->use_mpx_power_control = strtol(temp, NULL, 10) & 0x1;
+			utils_info("Set MPX power control status:  \t%i\n",
+				   ctl->use_mpx_power_control);
+			break;
+
+		case 'd':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 4, "%s", optarg);
+			tmp = strtol(temp, NULL, 10);
+			if (tmp < MPXP_LIMIT_MIN)
+				tmp = MPXP_LIMIT_MIN;
+			else if (tmp > MPXP_LIMIT_MAX)
+				tmp = MPXP_LIMIT_MAX;
+			ctl->mpx_power_limit = (float) tmp;
+			utils_info("Set MPX power limit:  \t%idBr\n",
+				   (int) ctl->mpx_power_limit);
+			break;
+
+		case 'k':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 2, "%s", optarg);
+			ctl->use_mpx_limiter = strtol(temp, NULL, 10) & 0x1;
+			utils_info("Set composite limiter status:  \t%i\n",
+				   ctl->use_mpx_limiter);
+			break;
+
+		case 'x':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 4, "%s", optarg);
+			tmp = strtol(temp, NULL, 10);
+			if (tmp < 10)
+				tmp = 10;
+			else if (tmp > 150)
+				tmp = 150;
+			ctl->mpx_limiter_ceiling = (float) tmp / 100.0;
+			utils_info("Set composite limiter ceiling:  \t%i%%\n",
+				   (int)(100 * ctl->mpx_limiter_ceiling));
+			break;
+
+		case 'o':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 2, "%s", optarg);
+			ctl->aproc.enabled = strtol(temp, NULL, 10) & 0x1;
+			utils_info("Set audio processor status:  \t%i\n",
+				   ctl->aproc.enabled);
+			break;
+
+		case 'u':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, 2, "%s", optarg);
+			ctl->use_degradation = strtol(temp, NULL, 10) & 0x1;
+			utils_info("Set graceful degradation status:  \t%i\n",
+				   ctl->use_degradation);
+			break;
+
+		case 'y':
+			if (set_subcarrier(ctl, optarg) < 0) {
+				utils_shm_destroy(shmem, 0);
+				return -1;
+			}
+			break;
+
+		case 'q':
+			memset(temp, 0, TEMP_BUF_LEN);
+			snprintf(temp, TEMP_BUF_LEN, "%s", optarg);
+			tmp = strtol(temp, NULL, 10);
+			if (tmp < 1000)
+				tmp = 1000;
+			else if (tmp > IQ_SINK_MAX_DEVIATION)
+				tmp = IQ_SINK_MAX_DEVIATION;
+			ctl->iq_deviation = (float) tmp;
+			utils_info("New I/Q deviation:  \t%iHz\n",
+				   (int) ctl->iq_deviation);
+			break;
 		default:
 			usage(argv[0]);
 			utils_shm_destroy(shmem, 0);
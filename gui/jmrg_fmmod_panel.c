@@ -5,7 +5,7 @@
 
 struct rbutton_group {
 	struct fmmod_control *ctl;
-	GtkWidget *rbuttons[4];
+	GtkWidget *rbuttons[5];
 	int type;
 	guint	esid;
 };
@@ -175,8 +175,17 @@ jmrg_fmmodp_fmdc_init(struct fmmod_control *ctl)
 		goto cleanup;
 	}
 
+	rbgrp->rbuttons[4] = jmrg_radio_button_init("SSB (Weaver)",
+					    (int*) &ctl->stereo_modulation,
+					    FMMOD_SSB_WEAVER,
+					    GTK_RADIO_BUTTON(rbgrp->rbuttons[3]));
+	if(!rbgrp->rbuttons[4]) {
+		ret = -8;
+		goto cleanup;
+	}
+
 	/* Now put them on the box */
-	for(i = 0; i < 4; i++)
+	for(i = 0; i < 5; i++)
 		gtk_box_pack_start(GTK_BOX(vbox), rbgrp->rbuttons[i],
 				   TRUE, TRUE, 2);
 
@@ -191,7 +200,7 @@ jmrg_fmmodp_fmdc_init(struct fmmod_control *ctl)
 	return container;
  cleanup:
 	if(rbgrp) {
-		for(i = 0; i < 4; i++)
+		for(i = 0; i < 5; i++)
 			if(rbgrp->rbuttons[i])
 				gtk_widget_destroy(rbgrp->rbuttons[i]);
 		free(rbgrp);
@@ -469,7 +478,7 @@ jmrg_fmmodp_mpx_gain_ctl_init(struct fmmod_control *ctl)
 		goto cleanup;
 	gtk_box_pack_start(GTK_BOX(hbox), mpxgain_ctl, 1, 1, 1);
 
-	mpx_lvl = jmrg_level_bar_init(NULL, &ctl->peak_mpx_out);
+	mpx_lvl = jmrg_level_bar_init(NULL, &ctl->true_peak_mpx_out);
 	if(!mpx_lvl)
 		goto cleanup;
 	gtk_widget_set_margin_bottom(mpx_lvl, 6);
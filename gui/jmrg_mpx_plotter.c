@@ -82,13 +82,13 @@ jmrg_mpxp_update_y_vals(struct mpx_plotter *mpxp)
 	ret = fread((void*) mpxp->real_buff, sizeof(float),
 		    mpxp->max_samples, sock);
 	fclose(sock);
-	if(ret != mpxp->max_samples) {
+	if((uint32_t) ret != mpxp->max_samples) {
 		utils_perr("[MPX PLOTTER] Could not read from socket");
 		skip = 1;
 		return;
 	}
 
-	fftwf_execute(mpxp->dft_plan);
+	fft_execute_r2c(mpxp->dft_plan, mpxp->real_buff, mpxp->complex_buff);
 
 	for(i = 0; i < mpxp->drawable_bins; i++) {
 		mag = powf(mpxp->complex_buff[i][0], 2) +
@@ -187,11 +187,11 @@ jmrg_mpxp_destroy(__attribute__((unused)) GtkWidget *widget,
 	if(mpxp->points)
 		free(mpxp->points);
 	if(mpxp->complex_buff)
-		fftwf_free(mpxp->complex_buff);
+		fft_free(mpxp->complex_buff);
 	if(mpxp->real_buff)
-		fftwf_free(mpxp->real_buff);
+		fft_free(mpxp->real_buff);
 	if(mpxp->dft_plan)
-		fftwf_destroy_plan(mpxp->dft_plan);
+		fft_destroy_plan(mpxp->dft_plan);
 	free(mpxp);
 
 	return;
@@ -239,7 +239,7 @@ jmrg_mpx_plotter_init(int sample_rate, int max_samples)
 	 * contain the whole spectrum up to nyquist_freq */
 	nyquist_freq = sample_rate / 2;
 	passband_ratio = (double) 60000.0L / (double) nyquist_freq;
-	mpxp->drawable_bins = (uint16_t)
+	mpxp->drawable_bins = (uint32_t)
 			      (passband_ratio * (double) mpxp->half_bins);
 
 	/* Our plot can't be smaller than 120x120 since the grid won't fit */
@@ -249,13 +249,13 @@ jmrg_mpx_plotter_init(int sample_rate, int max_samples)
 	}
 
 	/* Allocate buffers */
-	mpxp->real_buff = fftwf_alloc_real(mpxp->max_samples);
+	mpxp->real_buff = fft_alloc_real(mpxp->max_samples);
 	if(!mpxp->real_buff) {
 		ret = -3;
 		goto cleanup;
 	}
 
-	mpxp->complex_buff = fftwf_alloc_complex(mpxp->half_bins);
+	mpxp->complex_buff = fft_alloc_complex(mpxp->half_bins);
 	if(!mpxp->complex_buff) {
 		ret = -4;
 		goto cleanup;
@@ -283,13 +283,16 @@ jmrg_mpx_plotter_init(int sample_rate, int max_samples)
 	for(i = 0; i < mpxp->drawable_bins; i++)
 		mpxp->y_peak_vals[i] = -1.0;
 
-	/* Create DFT plan */
-	mpxp->dft_plan = fftwf_plan_dft_r2c_1d(mpxp->num_bins, mpxp->real_buff,
-					     mpxp->complex_buff, FFTW_MEASURE);
+	/* Create DFT plan, re-use the wisdom stored by the generator
+	 * (or by us on a previous run) if available */
+	fft_wisdom_import();
+	mpxp->dft_plan = fft_plan_r2c(mpxp->num_bins, 1, mpxp->real_buff,
+				      mpxp->complex_buff, FFT_PLAN_MEASURE);
 	if(!mpxp->dft_plan) {
 		ret = -8;
 		goto cleanup;
 	}
+	fft_wisdom_export();
 
 	/* Initialize x axis and grid points */
 	/* Window's coordinates go from -1.0 to +1.0 */
@@ -1,6 +1,5 @@
 #include "jmpxrds_gui.h" /* Also brings in gtk and utils */
 #include <stdint.h>	/* For typed integers */
-#include <fftw3.h>	/* For FFTW support */
 #include <epoxy/gl.h>	/* For OpenGL support */
 
 struct grid_point {
@@ -24,14 +23,14 @@ struct mpx_plotter {
 	GLint	in_gp_idx;
 	GLuint	vbos[3];
 	GLuint	vao;
-	fftwf_complex *complex_buff;
+	fft_complex *complex_buff;
 	float	*real_buff;
-	fftwf_plan dft_plan;
+	struct fft_plan *dft_plan;
 	uint32_t sample_rate;
-	uint16_t num_bins;
-	uint16_t max_samples;
-	uint16_t half_bins;
-	uint16_t drawable_bins;
+	uint32_t num_bins;
+	uint32_t max_samples;
+	uint32_t half_bins;
+	uint32_t drawable_bins;
 	int	avg;
 	int	max_hold;
 	char	sockpath[32];
@@ -0,0 +1,616 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - FM I/Q output
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "utils.h"
+#include "iq_sink.h"
+#include <stdlib.h>		/* For malloc/free/getenv */
+#include <string.h>		/* For memset/memcpy/strcmp */
+#include <unistd.h>		/* For write(), close() */
+#include <fcntl.h>		/* For open() and O_* constants */
+#include <sys/stat.h>		/* For stat() */
+#include <errno.h>		/* For errno */
+#include <math.h>		/* For sin(), lrintf() */
+
+/*********\
+* HELPERS *
+\*********/
+
+static uint32_t
+iq_sink_gcd(uint32_t a, uint32_t b)
+{
+	uint32_t tmp = 0;
+
+	while (b) {
+		tmp = a % b;
+		a = b;
+		b = tmp;
+	}
+
+	return a;
+}
+
+/* Modified Bessel function of the first kind (order 0),
+ * for the Kaiser window */
+static double
+iq_sink_bessel_i0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+	int k = 0;
+
+	for (k = 1; k < 64; k++) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+		if (term < sum * 1e-12)
+			break;
+	}
+
+	return sum;
+}
+
+static uint32_t
+iq_sink_sample_size(enum iq_sink_format format)
+{
+	switch (format) {
+	case IQ_SINK_S8:
+		return 2 * sizeof(int8_t);
+	case IQ_SINK_S16:
+		return 2 * sizeof(int16_t);
+	case IQ_SINK_F32:
+	default:
+		return 2 * sizeof(float);
+	}
+}
+
+
+/******************************\
+* POLYPHASE INTERPOLATOR / NCO *
+\******************************/
+
+/*
+ * The prototype filter is a Kaiser-windowed sinc at L times the MPX
+ * rate, with its cutoff at the MPX's Nyquist. Phase p of the interpolator
+ * gets taps p, p + L, p + 2L etc, so for each output sample we only do
+ * num_taps multiplications, instead of filtering the zero-stuffed signal.
+ */
+static int
+iq_sink_design_interpolator(struct iq_sink *iq)
+{
+	uint32_t len = iq->interp * iq->num_taps;
+	double center = (double) (len - 1) / 2.0;
+	double beta = 0.1102 * (IQ_SINK_STOPBAND_ATTEN - 8.7);
+	double fc = 0.5 / (double) iq->interp;
+	double x = 0.0;
+	double r = 0.0;
+	double h = 0.0;
+	uint32_t n = 0;
+	uint32_t p = 0;
+	uint32_t k = 0;
+
+	iq->coeffs = (float *) malloc(len * sizeof(float));
+	if (iq->coeffs == NULL)
+		return -1;
+
+	for (n = 0; n < len; n++) {
+		x = (double) n - center;
+		h = (x == 0.0) ? 2.0 * fc :
+		    sin(2.0 * M_PI * fc * x) / (M_PI * x);
+		r = 2.0 * (double) n / (double) (len - 1) - 1.0;
+		h *= iq_sink_bessel_i0(beta * sqrt(1.0 - r * r)) /
+		     iq_sink_bessel_i0(beta);
+
+		/* Make up for the zero-stuffing and store it
+		 * reversed within its phase */
+		p = n % iq->interp;
+		k = n / iq->interp;
+		iq->coeffs[p * iq->num_taps + (iq->num_taps - 1 - k)] =
+				(float) (h * (double) iq->interp);
+	}
+
+	return 0;
+}
+
+/* Upsample num_samples MPX samples (hist + num_taps - 1 onwards)
+ * to iq->mpx, returns the number of samples generated */
+static uint32_t
+iq_sink_interpolate(struct iq_sink *iq, uint32_t num_samples)
+{
+	const uint32_t num_taps = iq->num_taps;
+	const float *coeffs = NULL;
+	const float *x = NULL;
+	uint32_t phase = iq->phase;
+	uint32_t idx = 0;
+	uint32_t out = 0;
+	uint32_t j = 0;
+	float acc = 0.0;
+
+	while (idx < num_samples) {
+		coeffs = iq->coeffs + phase * num_taps;
+		x = iq->hist + idx;
+		acc = 0.0;
+		for (j = 0; j < num_taps; j++)
+			acc += coeffs[j] * x[j];
+		iq->mpx[out++] = acc;
+
+		phase += iq->decim;
+		while (phase >= iq->interp) {
+			phase -= iq->interp;
+			idx++;
+		}
+	}
+	iq->phase = phase;
+
+	/* Keep the last num_taps - 1 samples for the next chunk */
+	memmove(iq->hist, iq->hist + num_samples,
+		(num_taps - 1) * sizeof(float));
+
+	return out;
+}
+
+/* Get cos / sin for a phase, from the table */
+static inline void
+iq_sink_nco_lookup(const float *table, uint32_t phase, float *i, float *q)
+{
+	const uint32_t shift = 32 - IQ_SINK_NCO_TABLE_BITS;
+	const uint32_t quarter = IQ_SINK_NCO_TABLE_LEN / 4;
+	uint32_t idx = phase >> shift;
+	float frac = (float) (phase & ((1U << shift) - 1)) *
+		     (1.0 / (double) (1U << shift));
+
+	*q = table[idx] + frac * (table[idx + 1] - table[idx]);
+	idx += quarter;
+	*i = table[idx] + frac * (table[idx + 1] - table[idx]);
+}
+
+/*
+ * FM-modulate iq->mpx to iq->out. The phase increments are computed
+ * first (so that the loop vectorizes), then accumulated on the 32bit
+ * phase (it wraps around for free), and the I/Q samples come from the
+ * sine table.
+ */
+static void
+iq_sink_modulate(struct iq_sink *iq, uint32_t num_samples)
+{
+	const float *table = iq->sin_table;
+	uint32_t *phases = iq->phases;
+	const float *mpx = iq->mpx;
+	float scale = 0.0;
+	uint32_t acc = iq->nco_phase;
+	int8_t *out_s8 = NULL;
+	int16_t *out_s16 = NULL;
+	float *out_f32 = NULL;
+	float i_val = 0.0;
+	float q_val = 0.0;
+	uint32_t i = 0;
+
+	/* Hz -> phase step, full scale MPX is the peak deviation */
+	scale = iq->deviation * 4294967296.0 / (double) iq->sample_rate;
+
+	for (i = 0; i < num_samples; i++)
+		phases[i] = (uint32_t) (int32_t) (mpx[i] * scale);
+
+	for (i = 0; i < num_samples; i++) {
+		acc += phases[i];
+		phases[i] = acc;
+	}
+	iq->nco_phase = acc;
+
+	switch (iq->format) {
+	case IQ_SINK_S8:
+		out_s8 = (int8_t *) iq->out;
+		for (i = 0; i < num_samples; i++) {
+			iq_sink_nco_lookup(table, phases[i], &i_val, &q_val);
+			out_s8[2 * i] = (int8_t) lrintf(127.0 * i_val);
+			out_s8[2 * i + 1] = (int8_t) lrintf(127.0 * q_val);
+		}
+		break;
+	case IQ_SINK_S16:
+		out_s16 = (int16_t *) iq->out;
+		for (i = 0; i < num_samples; i++) {
+			iq_sink_nco_lookup(table, phases[i], &i_val, &q_val);
+			out_s16[2 * i] = (int16_t) lrintf(32767.0 * i_val);
+			out_s16[2 * i + 1] = (int16_t) lrintf(32767.0 * q_val);
+		}
+		break;
+	case IQ_SINK_F32:
+	default:
+		out_f32 = (float *) iq->out;
+		for (i = 0; i < num_samples; i++)
+			iq_sink_nco_lookup(table, phases[i], &out_f32[2 * i],
+					   &out_f32[2 * i + 1]);
+		break;
+	}
+}
+
+
+/*********\
+* OUTPUTS *
+\*********/
+
+static int
+iq_sink_open(struct iq_sink *iq)
+{
+	int flags = 0;
+
+	if (iq->target == IQ_SINK_FILE) {
+		iq->fd = open(iq->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (iq->fd < 0) {
+			utils_perr("[IQ] Unable to open output file");
+			return -1;
+		}
+		return 0;
+	}
+
+	/* On a FIFO, wait for someone to open the other
+	 * side, we'll retry on the next chunk */
+	iq->fd = open(iq->path, O_WRONLY | O_NONBLOCK);
+	if (iq->fd < 0) {
+		if (errno != ENXIO)
+			utils_perr("[IQ] Unable to open FIFO");
+		return -1;
+	}
+
+	/* Blocking writes from now on, so that we don't
+	 * break the I/Q pairs with short writes */
+	flags = fcntl(iq->fd, F_GETFL);
+	fcntl(iq->fd, F_SETFL, flags & ~O_NONBLOCK);
+	utils_dbg("[IQ] FIFO reader connected\n");
+
+	return 0;
+}
+
+static int
+iq_sink_write(struct iq_sink *iq, uint32_t num_samples)
+{
+	struct iq_sink_shm_ring *ring = iq->ring;
+	const uint8_t *buf = (const uint8_t *) iq->out;
+	uint8_t *data = NULL;
+	size_t len = num_samples * iq_sink_sample_size(iq->format);
+	size_t chunk = 0;
+	uint64_t pos = 0;
+	ssize_t ret = 0;
+
+	if (iq->target == IQ_SINK_SHM) {
+		data = (uint8_t *) (ring + 1);
+		pos = ring->write_pos;
+		while (len > 0) {
+			chunk = ring->size - (pos % ring->size);
+			if (chunk > len)
+				chunk = len;
+			memcpy(data + (pos % ring->size), buf, chunk);
+			buf += chunk;
+			pos += chunk;
+			len -= chunk;
+		}
+		__atomic_store_n(&ring->write_pos, pos, __ATOMIC_RELEASE);
+		return 0;
+	}
+
+	if (iq->fd < 0 && iq_sink_open(iq) < 0)
+		return -1;
+
+	while (len > 0) {
+		ret = write(iq->fd, buf, len);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			/* The reader went away, wait for the next one */
+			if (errno == EPIPE && iq->target == IQ_SINK_FIFO) {
+				close(iq->fd);
+				iq->fd = -1;
+				return -1;
+			}
+			utils_perr("[IQ] write() failed");
+			return -1;
+		}
+		buf += ret;
+		len -= ret;
+		iq->bytes_out += ret;
+	}
+
+	return 0;
+}
+
+
+/*************\
+* SINK THREAD *
+\*************/
+
+static void
+iq_sink_process(struct iq_sink *iq, const float *in, uint32_t num_samples)
+{
+	uint32_t frames = 0;
+
+	memcpy(iq->hist + iq->num_taps - 1, in, num_samples * sizeof(float));
+	frames = iq_sink_interpolate(iq, num_samples);
+	iq_sink_modulate(iq, frames);
+	iq_sink_write(iq, frames);
+}
+
+static void *
+iq_sink_loop(void *arg)
+{
+	struct iq_sink *iq = (struct iq_sink *) arg;
+	const uint32_t mask = IQ_SINK_RING_LEN - 1;
+	uint32_t head = 0;
+	uint32_t tail = 0;
+	uint32_t num_samples = 0;
+
+	while (iq->active) {
+		pthread_mutex_lock(&iq->mutex);
+		while (iq->active &&
+		       __atomic_load_n(&iq->head, __ATOMIC_ACQUIRE) == iq->tail)
+			pthread_cond_wait(&iq->trigger, &iq->mutex);
+		pthread_mutex_unlock(&iq->mutex);
+
+		if (!iq->active)
+			break;
+
+		head = __atomic_load_n(&iq->head, __ATOMIC_ACQUIRE);
+		tail = iq->tail;
+		while (tail != head) {
+			/* Up to a chunk, without wrapping around */
+			num_samples = head - tail;
+			if (num_samples > IQ_SINK_CHUNK)
+				num_samples = IQ_SINK_CHUNK;
+			if (num_samples > IQ_SINK_RING_LEN - (tail & mask))
+				num_samples = IQ_SINK_RING_LEN - (tail & mask);
+
+			iq_sink_process(iq, iq->in + (tail & mask), num_samples);
+
+			tail += num_samples;
+			__atomic_store_n(&iq->tail, tail, __ATOMIC_RELEASE);
+		}
+	}
+
+	return arg;
+}
+
+
+/**************\
+* ENTRY POINTS *
+\**************/
+
+/* Called from the output path with each MPX period, it only
+ * queues it up for the sink thread. The trigger is signaled
+ * without holding the mutex (this may run on an RT thread), if
+ * the sink thread misses it it'll get the next period's. */
+void
+iq_sink_push(struct iq_sink *iq, const float *mpx, uint32_t num_samples)
+{
+	const uint32_t mask = IQ_SINK_RING_LEN - 1;
+	uint32_t head = 0;
+	uint32_t tail = 0;
+	uint32_t chunk = 0;
+
+	if (!iq->active)
+		return;
+
+	head = iq->head;
+	tail = __atomic_load_n(&iq->tail, __ATOMIC_ACQUIRE);
+	if (IQ_SINK_RING_LEN - (head - tail) < num_samples) {
+		__atomic_add_fetch(&iq->dropped, num_samples, __ATOMIC_RELAXED);
+		return;
+	}
+
+	chunk = IQ_SINK_RING_LEN - (head & mask);
+	if (chunk > num_samples)
+		chunk = num_samples;
+	memcpy(iq->in + (head & mask), mpx, chunk * sizeof(float));
+	memcpy(iq->in, mpx + chunk, (num_samples - chunk) * sizeof(float));
+
+	__atomic_store_n(&iq->head, head + num_samples, __ATOMIC_RELEASE);
+	pthread_cond_signal(&iq->trigger);
+}
+
+void
+iq_sink_set_deviation(struct iq_sink *iq, float deviation)
+{
+	if (!(deviation > 0.0))
+		deviation = IQ_SINK_DEFAULT_DEVIATION;
+	if (deviation > IQ_SINK_MAX_DEVIATION)
+		deviation = IQ_SINK_MAX_DEVIATION;
+	iq->deviation = deviation;
+}
+
+
+/****************\
+* INIT / DESTROY *
+\****************/
+
+static int
+iq_sink_parse_env(struct iq_sink *iq)
+{
+	const char *format = getenv(IQ_SINK_FORMAT_ENV);
+	const char *rate = getenv(IQ_SINK_RATE_ENV);
+	struct stat st;
+
+	iq->path = getenv(IQ_SINK_OUTPUT_ENV);
+	if (iq->path == NULL || iq->path[0] == '\0')
+		return 0;
+
+	if (!strcmp(iq->path, "shm"))
+		iq->target = IQ_SINK_SHM;
+	else if (!stat(iq->path, &st) && S_ISFIFO(st.st_mode))
+		iq->target = IQ_SINK_FIFO;
+	else
+		iq->target = IQ_SINK_FILE;
+
+	iq->sample_rate = IQ_SINK_DEFAULT_RATE;
+	if (rate && rate[0] != '\0')
+		iq->sample_rate = strtoul(rate, NULL, 10);
+	if (iq->sample_rate < IQ_SINK_MIN_RATE ||
+	    iq->sample_rate > IQ_SINK_MAX_RATE) {
+		utils_err("[IQ] Sample rate out of range (%u - %u)\n",
+			  IQ_SINK_MIN_RATE, IQ_SINK_MAX_RATE);
+		return -1;
+	}
+
+	iq->format = IQ_SINK_S16;
+	if (format && !strcmp(format, "s8"))
+		iq->format = IQ_SINK_S8;
+	else if (format && !strcmp(format, "f32"))
+		iq->format = IQ_SINK_F32;
+	else if (format && format[0] != '\0' && strcmp(format, "s16")) {
+		utils_err("[IQ] Unknown sample format: %s\n", format);
+		return -1;
+	}
+
+	return 1;
+}
+
+int
+iq_sink_init(struct iq_sink *iq, uint32_t mpx_samplerate, int wide)
+{
+	uint32_t gcd = 0;
+	uint32_t ring_size = 0;
+	int ret = 0;
+	int i = 0;
+
+	memset(iq, 0, sizeof(struct iq_sink));
+	iq->fd = -1;
+
+	ret = iq_sink_parse_env(iq);
+	if (ret <= 0)
+		return ret;
+
+	/* Get the interpolator's L / M */
+	gcd = iq_sink_gcd(iq->sample_rate, mpx_samplerate);
+	iq->interp = iq->sample_rate / gcd;
+	iq->decim = mpx_samplerate / gcd;
+	if (iq->interp > IQ_SINK_MAX_PHASES) {
+		utils_err("[IQ] Unsupported sample rate: %u\n",
+			  iq->sample_rate);
+		return -2;
+	}
+	iq->mpx_samplerate = mpx_samplerate;
+	iq->num_taps = wide ? IQ_SINK_WIDE_TAPS : IQ_SINK_TAPS;
+
+	ret = iq_sink_design_interpolator(iq);
+	if (ret < 0) {
+		ret = -3;
+		goto cleanup;
+	}
+
+	for (i = 0; i < IQ_SINK_NCO_TABLE_SIZE; i++)
+		iq->sin_table[i] = (float) sin(2.0 * M_PI * (double) i /
+					       (double) IQ_SINK_NCO_TABLE_LEN);
+	iq_sink_set_deviation(iq, IQ_SINK_DEFAULT_DEVIATION);
+
+	/* Allocate buffers */
+	iq->max_out = (IQ_SINK_CHUNK * iq->interp) / iq->decim + 2;
+	iq->in = (float *) malloc(IQ_SINK_RING_LEN * sizeof(float));
+	iq->hist = (float *) malloc((iq->num_taps - 1 + IQ_SINK_CHUNK) *
+				    sizeof(float));
+	iq->mpx = (float *) malloc(iq->max_out * sizeof(float));
+	iq->phases = (uint32_t *) malloc(iq->max_out * sizeof(uint32_t));
+	iq->out = malloc(iq->max_out * iq_sink_sample_size(iq->format));
+	if (iq->in == NULL || iq->hist == NULL || iq->mpx == NULL ||
+	    iq->phases == NULL || iq->out == NULL) {
+		ret = -4;
+		goto cleanup;
+	}
+	memset(iq->hist, 0, (iq->num_taps - 1) * sizeof(float));
+
+	/* Set up the output */
+	if (iq->target == IQ_SINK_SHM) {
+		ring_size = IQ_SINK_SHM_RING_SECS * iq->sample_rate *
+			    iq_sink_sample_size(iq->format);
+		iq->shm = utils_shm_init(IQ_SINK_SHM_NAME,
+					 sizeof(struct iq_sink_shm_ring) +
+					 ring_size);
+		if (!iq->shm) {
+			utils_err("[IQ] Unable to create shm ring\n");
+			ret = -5;
+			goto cleanup;
+		}
+		iq->ring = (struct iq_sink_shm_ring *) iq->shm->mem;
+		iq->ring->format = iq->format;
+		iq->ring->sample_rate = iq->sample_rate;
+		iq->ring->size = ring_size;
+	} else if (iq->target == IQ_SINK_FILE) {
+		ret = iq_sink_open(iq);
+		if (ret < 0) {
+			ret = -6;
+			goto cleanup;
+		}
+	}
+
+	pthread_mutex_init(&iq->mutex, NULL);
+	pthread_cond_init(&iq->trigger, NULL);
+
+	iq->active = 1;
+	ret = pthread_create(&iq->tid, NULL, iq_sink_loop, (void *) iq);
+	if (ret != 0) {
+		utils_err("[IQ] Unable to create sink thread\n");
+		iq->active = 0;
+		ret = -7;
+		goto cleanup;
+	}
+
+	utils_info("[IQ] Sending out %s I/Q at %uHz (%u / %u) to %s\n",
+		   iq->format == IQ_SINK_S8 ? "s8" :
+		   iq->format == IQ_SINK_S16 ? "s16" : "f32",
+		   iq->sample_rate, iq->interp, iq->decim, iq->path);
+
+ cleanup:
+	if (ret < 0) {
+		utils_err("[IQ] Init failed with code: %i\n", ret);
+		iq_sink_destroy(iq);
+	}
+
+	return ret;
+}
+
+void
+iq_sink_destroy(struct iq_sink *iq)
+{
+	if (iq->active) {
+		iq->active = 0;
+		pthread_mutex_lock(&iq->mutex);
+		pthread_cond_signal(&iq->trigger);
+		pthread_mutex_unlock(&iq->mutex);
+		pthread_join(iq->tid, NULL);
+		pthread_mutex_destroy(&iq->mutex);
+		pthread_cond_destroy(&iq->trigger);
+	}
+
+	/* Note that fd is 0 if we never got initialized */
+	if (iq->path && iq->fd >= 0)
+		close(iq->fd);
+	iq->fd = -1;
+
+	if (iq->shm)
+		utils_shm_destroy(iq->shm, 1);
+	iq->shm = NULL;
+	iq->ring = NULL;
+
+	free(iq->coeffs);
+	iq->coeffs = NULL;
+	free(iq->in);
+	iq->in = NULL;
+	free(iq->hist);
+	iq->hist = NULL;
+	free(iq->mpx);
+	iq->mpx = NULL;
+	free(iq->phases);
+	iq->phases = NULL;
+	free(iq->out);
+	iq->out = NULL;
+}
@@ -0,0 +1,142 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - FM I/Q output
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>		/* For typed integers */
+#include <pthread.h>		/* For pthread mutex / conditional */
+
+/*
+ * The I/Q sink FM-modulates the MPX output and sends it out as complex
+ * baseband, for driving SDR transmitters directly. It's set up on startup
+ * through the following environment variables:
+ *
+ * IQ_SINK_OUTPUT_ENV: Where to write the I/Q samples, a file or a FIFO
+ *		       path, or "shm" for a ring on IQ_SINK_SHM_NAME (see
+ *		       struct iq_sink_shm_ring). Unset disables the sink.
+ * IQ_SINK_RATE_ENV: Output sample rate (default 2.4MS/s)
+ * IQ_SINK_FORMAT_ENV: Sample format, "s8", "s16" (default) or "f32",
+ *		       interleaved I/Q
+ *
+ * The peak deviation may be changed at runtime through fmmod's control
+ * channel, full scale on the MPX output maps to that.
+ */
+#define IQ_SINK_OUTPUT_ENV	"JMPXRDS_IQ_OUTPUT"
+#define IQ_SINK_RATE_ENV	"JMPXRDS_IQ_RATE"
+#define IQ_SINK_FORMAT_ENV	"JMPXRDS_IQ_FORMAT"
+
+#define IQ_SINK_DEFAULT_RATE	2400000
+#define IQ_SINK_MIN_RATE	1000000
+#define IQ_SINK_MAX_RATE	10000000
+#define IQ_SINK_DEFAULT_DEVIATION	75000.0
+#define IQ_SINK_MAX_DEVIATION	150000.0
+
+/*
+ * The MPX gets upsampled through a polyphase interpolator by L / M (the
+ * ratio between the output rate and the MPX rate, reduced), so the output
+ * rate must give an L up to IQ_SINK_MAX_PHASES, which is the case for the
+ * usual SDR rates (e.g. 2.4MS/s from 192KHz is 25 / 2). Each phase is a
+ * short FIR, the longer one is used when the MPX goes up to 94KHz (with
+ * subcarriers or RDS2) since the images start right above it.
+ */
+#define IQ_SINK_MAX_PHASES	1024
+#define IQ_SINK_TAPS		32
+#define IQ_SINK_WIDE_TAPS	96
+#define IQ_SINK_STOPBAND_ATTEN	70.0
+
+/* The NCO's sine table (linearly interpolated), cosine comes from
+ * the same table a quarter cycle later. The table goes on for another
+ * quarter cycle (plus one sample) so that we don't have to wrap. */
+#define IQ_SINK_NCO_TABLE_BITS	10
+#define IQ_SINK_NCO_TABLE_LEN	(1 << IQ_SINK_NCO_TABLE_BITS)
+#define IQ_SINK_NCO_TABLE_SIZE	(IQ_SINK_NCO_TABLE_LEN + \
+				 IQ_SINK_NCO_TABLE_LEN / 4 + 1)
+
+/* MPX samples waiting to be processed (~340ms at 192KHz)
+ * and how many of them are processed at a time */
+#define IQ_SINK_RING_LEN	65536
+#define IQ_SINK_CHUNK		1024
+
+enum iq_sink_format {
+	IQ_SINK_S8 = 0,
+	IQ_SINK_S16 = 1,
+	IQ_SINK_F32 = 2,
+};
+
+enum iq_sink_target {
+	IQ_SINK_FILE = 0,
+	IQ_SINK_FIFO = 1,
+	IQ_SINK_SHM = 2,
+};
+
+/* Header of the shm ring, the I/Q data follows. The writer only moves
+ * write_pos forward (in bytes, since start, the ring's offset is
+ * write_pos % size) and never waits for the readers, a reader that
+ * falls more than size bytes behind has lost data. */
+struct iq_sink_shm_ring {
+	uint32_t format;
+	uint32_t sample_rate;
+	uint32_t size;
+	uint32_t reserved;
+	uint64_t write_pos;
+};
+
+#define IQ_SINK_SHM_RING_SECS	1
+
+struct iq_sink {
+	int active;
+	enum iq_sink_format format;
+	enum iq_sink_target target;
+	const char *path;
+	int fd;
+	struct shm_mapping *shm;
+	struct iq_sink_shm_ring *ring;
+	uint32_t mpx_samplerate;
+	uint32_t sample_rate;
+	/* Polyphase interpolator, L phases of num_taps each,
+	 * stored in reverse so that each one is a plain dot
+	 * product with the history */
+	uint32_t interp;
+	uint32_t decim;
+	uint32_t num_taps;
+	float *coeffs;
+	uint32_t phase;
+	float *hist;
+	/* NCO */
+	uint32_t nco_phase;
+	float deviation;
+	float sin_table[IQ_SINK_NCO_TABLE_SIZE];
+	/* Work buffers */
+	float *mpx;
+	uint32_t *phases;
+	void *out;
+	uint32_t max_out;
+	/* Input ring, between the output path and the sink thread */
+	float *in;
+	uint32_t head;
+	uint32_t tail;
+	uint32_t dropped;
+	uint64_t bytes_out;
+	pthread_t tid;
+	pthread_mutex_t mutex;
+	pthread_cond_t trigger;
+};
+
+int iq_sink_init(struct iq_sink *iq, uint32_t mpx_samplerate, int wide);
+void iq_sink_push(struct iq_sink *iq, const float *mpx, uint32_t num_samples);
+void iq_sink_set_deviation(struct iq_sink *iq, float deviation);
+void iq_sink_destroy(struct iq_sink *iq);
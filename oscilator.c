@@ -18,8 +18,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "oscilator.h"
+#include "fixed_point.h"
 #include <stdlib.h>		/* For NULL */
-#include <math.h>		/* For sin, cos, M_PI, fmod and signbit */
+#include <math.h>		/* For sin, cos, M_PI, fmod, lround and signbit */
 #include <string.h>		/* For memset */
 
 /***********\
@@ -144,3 +145,205 @@ osc_get_57Khz_sample(const struct osc_state *osc)
 {
 	return osc_get_sample_for_freq(osc, 57000.0);
 }
+
+/**
+ * osc_get_position -	Get the sample within the current second
+ *			(the current phase in phase steps)
+ */
+uint32_t
+osc_get_position(const struct osc_state *osc)
+{
+	return (uint32_t) lround(osc->current_phase / osc->phase_step);
+}
+
+/**
+ * osc_advance_phase -	Move the phase num_samples forward, for
+ *			when the samples came from somewhere else
+ */
+void
+osc_advance_phase(struct osc_state *osc, uint32_t num_samples)
+{
+	osc->current_phase = fmod(osc->current_phase +
+				  osc->phase_step * (double) num_samples,
+				  (double) (ONE_PERIOD));
+}
+
+
+/**********************\
+* FIXED-POINT CARRIERS *
+\**********************/
+
+/*
+ * On the fixed-point path the pilot, the stereo subcarrier and the
+ * RDS carrier come from Q15 tables of one pilot period, instead of
+ * calling sin() for each one of them on each sample (that's what hurts
+ * the most on boards without a decent FPU). Since the pilot's period
+ * is a whole number of samples this is exact, and as long as they are
+ * indexed by osc_get_position() they stay in sync with the oscilator.
+ */
+
+/**
+ * osc_fxp_init_carriers - Fill in the fixed-point carrier tables
+ *
+ */
+void
+osc_fxp_init_carriers(struct osc_fxp_carriers *fxp,
+		      const struct osc_state *osc)
+{
+	double phase = 0.0;
+	int i = 0;
+
+	for (i = 0; i < OSC_FXP_PERIOD; i++) {
+		phase = osc->phase_step * (double) i;
+		fxp->pilot[i] = fxp_q15_from_float((float) sin(phase * 19000.0));
+		fxp->stereo[i] = fxp_q15_from_float((float) sin(phase * 38000.0));
+		fxp->rds[i] = fxp_q15_from_float((float) sin(phase * 57000.0));
+	}
+}
+
+
+/*****************\
+* SUBCARRIER NCOs *
+\*****************/
+
+/*
+ * Numerically controlled oscilators for the subcarriers above 57KHz.
+ * Calling sin() on each sample of each subcarrier gets expensive as we
+ * add more of them, so the phase is kept in 32bit fixed point (so that
+ * it wraps around for free) and the sine comes from a table, with linear
+ * interpolation between its entries (the error stays around -100dB).
+ * To keep the subcarriers phase-locked to the pilot, their phase gets
+ * re-synced with the main oscilator before each run. The Weaver SSB
+ * modulator's LOs use them too, as sine / cosine pairs.
+ */
+
+#define OSC_NCO_FRAC_BITS	(32 - OSC_NCO_TABLE_BITS)
+
+/* One extra entry so that we don't need to wrap the index
+ * when interpolating */
+static float osc_nco_table[OSC_NCO_TABLE_LEN + 1];
+static int osc_nco_table_ready = 0;
+
+static inline float
+osc_nco_sample(uint32_t phase)
+{
+	uint32_t idx = phase >> OSC_NCO_FRAC_BITS;
+	float frac = (float) (phase & ((1U << OSC_NCO_FRAC_BITS) - 1)) *
+		     (1.0f / (float) (1U << OSC_NCO_FRAC_BITS));
+
+	return osc_nco_table[idx] + frac * (osc_nco_table[idx + 1] -
+					    osc_nco_table[idx]);
+}
+
+/**
+ * osc_nco_init - Initialize a subcarrier NCO
+ *
+ */
+int
+osc_nco_init(struct osc_nco *nco, uint32_t sample_rate, float freq)
+{
+	int i = 0;
+
+	if (nco == NULL)
+		return -1;
+
+	memset(nco, 0, sizeof(struct osc_nco));
+
+	if (freq <= 0 || freq > OSC_NCO_MAX_FREQUENCY ||
+	    2 * freq >= sample_rate)
+		return -3;
+
+	if (!osc_nco_table_ready) {
+		for (i = 0; i <= OSC_NCO_TABLE_LEN; i++)
+			osc_nco_table[i] = (float) sin((double) (ONE_PERIOD) *
+						       (double) i /
+						       (double) OSC_NCO_TABLE_LEN);
+		osc_nco_table_ready = 1;
+	}
+
+	nco->sample_rate = sample_rate;
+	nco->freq = freq;
+	nco->hz_to_step = 4294967296.0L / (double) sample_rate;
+	nco->step = (uint32_t) llround((double) freq * nco->hz_to_step);
+
+	return 0;
+}
+
+/**
+ * osc_nco_sync - Lock the NCO's phase to the main oscilator's,
+ *		  plus any phase offset due to modulation
+ */
+void
+osc_nco_sync(struct osc_nco *nco, const struct osc_state *osc)
+{
+	double cycles = osc->current_phase * (double) nco->freq /
+			(double) (ONE_PERIOD);
+
+	cycles -= floor(cycles);
+	nco->phase = (uint32_t) (cycles * 4294967296.0L) + nco->fm_phase;
+}
+
+/**
+ * osc_nco_set_phase - Set the NCO's phase (in radians), for when
+ *		       it's not locked to the main oscilator
+ */
+void
+osc_nco_set_phase(struct osc_nco *nco, double phase)
+{
+	double cycles = phase / (double) (ONE_PERIOD);
+
+	cycles -= floor(cycles);
+	nco->phase = (uint32_t) (cycles * 4294967296.0L);
+}
+
+/**
+ * osc_nco_run - Generate num_samples of the NCO's output, if fm
+ *		 is set, the frequency is modulated by fm[i] * deviation (Hz)
+ */
+void
+osc_nco_run(struct osc_nco *nco, const float *fm, float deviation,
+	    float *out, uint32_t num_samples)
+{
+	uint32_t phase = nco->phase;
+	uint32_t fm_phase = nco->fm_phase;
+	uint32_t offset = 0;
+	float dev_steps = (float) ((double) deviation * nco->hz_to_step);
+	uint32_t i = 0;
+
+	if (fm == NULL) {
+		for (i = 0; i < num_samples; i++) {
+			out[i] = osc_nco_sample(phase);
+			phase += nco->step;
+		}
+	} else {
+		for (i = 0; i < num_samples; i++) {
+			out[i] = osc_nco_sample(phase);
+			offset = (uint32_t) (int32_t) (fm[i] * dev_steps);
+			phase += nco->step + offset;
+			fm_phase += offset;
+		}
+	}
+
+	nco->phase = phase;
+	nco->fm_phase = fm_phase;
+}
+
+/**
+ * osc_nco_run_quadrature - Generate num_samples of the NCO's sine
+ *			    and cosine (a quarter cycle ahead)
+ */
+void
+osc_nco_run_quadrature(struct osc_nco *nco, float *sin_out, float *cos_out,
+		       uint32_t num_samples)
+{
+	uint32_t phase = nco->phase;
+	uint32_t i = 0;
+
+	for (i = 0; i < num_samples; i++) {
+		sin_out[i] = osc_nco_sample(phase);
+		cos_out[i] = osc_nco_sample(phase + (1U << 30));
+		phase += nco->step;
+	}
+
+	nco->phase = phase;
+}
@@ -45,6 +45,12 @@
 #define ONE_PERIOD		2.0 * M_PI
 
 
+/* Subcarrier NCOs, the sine table has 2^OSC_NCO_TABLE_BITS
+ * entries and they may go up to OSC_NCO_MAX_FREQUENCY */
+#define OSC_NCO_TABLE_BITS	10
+#define OSC_NCO_TABLE_LEN	(1 << OSC_NCO_TABLE_BITS)
+#define OSC_NCO_MAX_FREQUENCY	94000
+
 enum osc_type {
 	OSC_TYPE_SINE = 0,
 	OSC_TYPE_COSINE = 1,
@@ -57,6 +63,29 @@ struct osc_state {
 	int type;
 };
 
+/* Fixed-point carriers, the pilot's period is a whole number
+ * of samples, so the pilot and its harmonics come from tables
+ * of one pilot period, indexed by the sample within the second */
+#define OSC_FXP_PERIOD		(OSC_SAMPLE_RATE / 19000)
+
+struct osc_fxp_carriers {
+	int16_t pilot[OSC_FXP_PERIOD];
+	int16_t stereo[OSC_FXP_PERIOD];
+	int16_t rds[OSC_FXP_PERIOD];
+};
+
+/* Phase is 32bit fixed point, a full cycle wraps it around */
+struct osc_nco {
+	uint32_t phase;
+	uint32_t step;
+	/* Phase offset accumulated through frequency modulation */
+	uint32_t fm_phase;
+	float freq;
+	/* Phase steps per Hz */
+	double hz_to_step;
+	uint32_t sample_rate;
+};
+
 int osc_initialize(struct osc_state *, uint32_t, int);
 void osc_increase_phase(struct osc_state *);
 void osc_shift_90deg(struct osc_state *sinwg);
@@ -64,3 +93,12 @@ float osc_get_sample_for_freq(const struct osc_state *osc, float freq);
 float osc_get_19Khz_sample(const struct osc_state *);
 float osc_get_38Khz_sample(const struct osc_state *);
 float osc_get_57Khz_sample(const struct osc_state *);
+uint32_t osc_get_position(const struct osc_state *osc);
+void osc_advance_phase(struct osc_state *osc, uint32_t num_samples);
+void osc_fxp_init_carriers(struct osc_fxp_carriers *fxp,
+			   const struct osc_state *osc);
+int osc_nco_init(struct osc_nco *, uint32_t, float);
+void osc_nco_sync(struct osc_nco *, const struct osc_state *);
+void osc_nco_set_phase(struct osc_nco *, double);
+void osc_nco_run(struct osc_nco *, const float *, float, float *, uint32_t);
+void osc_nco_run_quadrature(struct osc_nco *, float *, float *, uint32_t);
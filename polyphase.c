@@ -0,0 +1,652 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - Polyphase resampler
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "polyphase.h"
+#include "fixed_point.h"
+#include "polyphase_tables.h"
+#include "utils.h"
+#include <stdlib.h>		/* For malloc/free */
+#include <string.h>		/* For memset/memmove */
+#include <math.h>		/* For sin(), sqrt(), log10() */
+
+/* Samples are in Q14, the accumulator ends up in Q29 */
+#define POLYPHASE_SAMPLE_BITS	14
+#define POLYPHASE_ACC_BITS	(POLYPHASE_SAMPLE_BITS + FXP_Q15_BITS)
+
+/* Vectors of 4 floats for the kernels' inner loop, GCC / Clang turn
+ * them into SSE / NEON instructions (or plain ones if there is no
+ * SIMD unit). The unaligned one is for reading the input history,
+ * the coefficient tables are aligned. */
+typedef float polyphase_v4sf __attribute__ ((vector_size (16)));
+typedef float polyphase_v4sf_u __attribute__ ((vector_size (16), aligned (4)));
+
+
+/*********\
+* HELPERS *
+\*********/
+
+static uint32_t
+polyphase_gcd(uint32_t a, uint32_t b)
+{
+	uint32_t tmp = 0;
+
+	while (b) {
+		tmp = a % b;
+		a = b;
+		b = tmp;
+	}
+
+	return a;
+}
+
+/* Modified Bessel function of the first kind (order 0),
+ * for the Kaiser window */
+static double
+polyphase_bessel_i0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+	int k = 0;
+
+	for (k = 1; k < 64; k++) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+		if (term < sum * 1e-12)
+			break;
+	}
+
+	return sum;
+}
+
+static inline int16_t
+polyphase_sample_from_float(float x)
+{
+	int32_t val = (int32_t) lrintf(x * (float) (1 << POLYPHASE_SAMPLE_BITS));
+
+	if (val > FXP_Q15_MAX)
+		return FXP_Q15_MAX;
+	if (val < FXP_Q15_MIN)
+		return FXP_Q15_MIN;
+	return (int16_t) val;
+}
+
+/* Dot product of num_taps samples with a row of coefficients,
+ * num_taps is a multiple of POLYPHASE_KERNEL_TAP_ALIGN */
+static inline float
+polyphase_dot(const float *x, const float *coeffs, uint32_t num_taps)
+{
+	const polyphase_v4sf_u *xv = (const polyphase_v4sf_u *) x;
+	const polyphase_v4sf *cv = (const polyphase_v4sf *) coeffs;
+	polyphase_v4sf acc0 = { 0.0f, 0.0f, 0.0f, 0.0f };
+	polyphase_v4sf acc1 = { 0.0f, 0.0f, 0.0f, 0.0f };
+	uint32_t i = 0;
+
+	for (i = 0; i < num_taps / 4; i += 2) {
+		acc0 += xv[i] * cv[i];
+		acc1 += xv[i + 1] * cv[i + 1];
+	}
+	acc0 += acc1;
+
+	return acc0[0] + acc0[1] + acc0[2] + acc0[3];
+}
+
+/* Same as above for two neighbouring rows, in one pass */
+static inline void
+polyphase_dot2(const float *x, const float *coeffs, uint32_t num_taps,
+	       float *out0, float *out1)
+{
+	const polyphase_v4sf_u *xv = (const polyphase_v4sf_u *) x;
+	const polyphase_v4sf *cv0 = (const polyphase_v4sf *) coeffs;
+	const polyphase_v4sf *cv1 = (const polyphase_v4sf *) (coeffs + num_taps);
+	polyphase_v4sf acc0 = { 0.0f, 0.0f, 0.0f, 0.0f };
+	polyphase_v4sf acc1 = { 0.0f, 0.0f, 0.0f, 0.0f };
+	uint32_t i = 0;
+
+	for (i = 0; i < num_taps / 4; i++) {
+		acc0 += xv[i] * cv0[i];
+		acc1 += xv[i] * cv1[i];
+	}
+
+	*out0 = acc0[0] + acc0[1] + acc0[2] + acc0[3];
+	*out1 = acc1[0] + acc1[1] + acc1[2] + acc1[3];
+}
+
+
+/********\
+* DESIGN *
+\********/
+
+/* Kaiser's estimate for the prototype's length, for the given stopband
+ * attenuation (in dB) and transition band (normalized to its rate) */
+uint32_t
+polyphase_kaiser_len(double atten, double transition)
+{
+	return (uint32_t) ceil((atten - 7.95) / (14.36 * transition)) + 1;
+}
+
+/*
+ * The prototype filter runs at num_phases times the input rate, phase p
+ * gets taps p, p + P, p + 2P etc, so for each output sample we only do
+ * num_taps multiplications instead of filtering the zero-stuffed
+ * signal. fc is the cutoff, normalized to the prototype's rate. When
+ * interpolated is set there is one more row at the end (phase 0, one
+ * input sample later), so that we can interpolate between any two
+ * neighbouring phases.
+ */
+void
+polyphase_design(uint32_t num_phases, uint32_t num_taps, double fc,
+		 double atten, int interpolated, double *out)
+{
+	uint32_t num_rows = interpolated ? num_phases + 1 : num_phases;
+	uint32_t len = num_phases * num_taps + (interpolated ? 1 : 0);
+	double center = (double) (len - 1) / 2.0;
+	double beta = 0.1102 * (atten - 8.7);
+	double x = 0.0;
+	double r = 0.0;
+	double h = 0.0;
+	uint32_t n = 0;
+	uint32_t p = 0;
+	uint32_t k = 0;
+
+	for (p = 0; p < num_rows; p++) {
+		for (k = 0; k < num_taps; k++) {
+			n = p + k * num_phases;
+			x = (double) n - center;
+			h = (x == 0.0) ? 2.0 * fc :
+			    sin(2.0 * M_PI * fc * x) / (M_PI * x);
+			r = 2.0 * (double) n / (double) (len - 1) - 1.0;
+			h *= polyphase_bessel_i0(beta * sqrt(1.0 - r * r)) /
+			     polyphase_bessel_i0(beta);
+
+			/* Make up for the zero-stuffing and store it
+			 * reversed within its phase */
+			out[p * num_taps + (num_taps - 1 - k)] =
+					h * (double) num_phases;
+		}
+	}
+}
+
+
+/************\
+* PROCESSING *
+\************/
+
+/* Resample inframes samples from in to out, up to outframes, any
+ * input left over is kept for the next call. Returns the number
+ * of samples written to out, or -1 if there is no room for in. */
+int
+polyphase_process(struct polyphase *pp, const float *in, float *out,
+		  uint32_t inframes, uint32_t outframes)
+{
+	const struct polyphase_kernel *kernel = pp->kernel;
+	const uint32_t num_taps = kernel->num_taps;
+	const int exact = (kernel->num_phases == kernel->interp);
+	const float frac_scale = 1.0f / (float) kernel->interp;
+	const float *x = NULL;
+	uint32_t phase = pp->phase;
+	uint32_t avail = 0;
+	uint32_t idx = 0;
+	uint32_t num_out = 0;
+	uint32_t pos = 0;
+	float y0 = 0.0f;
+	float y1 = 0.0f;
+
+	/* The caller keeps asking for a bit fewer samples than we could
+	 * generate (e.g. 44.1KHz periods don't map to a whole number of
+	 * samples at 228KHz), so input we didn't get to piles up. Instead
+	 * of letting the latency grow, drop one input sample each time
+	 * there is more than one left over, a much smaller glitch than
+	 * dropping it all at once */
+	if (pp->hist_len > num_taps) {
+		memmove(pp->hist, pp->hist + 1,
+			(pp->hist_len - 1) * sizeof(float));
+		pp->hist_len--;
+	}
+
+	if (pp->hist_len + inframes > pp->hist_size)
+		return -1;
+
+	memcpy(pp->hist + pp->hist_len, in, inframes * sizeof(float));
+	pp->hist_len += inframes;
+
+	if (pp->hist_len >= num_taps)
+		avail = pp->hist_len - (num_taps - 1);
+
+	while (idx < avail && num_out < outframes) {
+		x = pp->hist + idx;
+		if (exact) {
+			out[num_out++] = polyphase_dot(x, kernel->coeffs +
+						       phase * num_taps,
+						       num_taps);
+		} else {
+			/* The phase falls between rows pos / interp
+			 * and the one after it */
+			pos = phase * kernel->num_phases;
+			polyphase_dot2(x, kernel->coeffs +
+				       (pos / kernel->interp) * num_taps,
+				       num_taps, &y0, &y1);
+			out[num_out++] = y0 + (y1 - y0) * frac_scale *
+					 (float) (pos % kernel->interp);
+		}
+
+		phase += kernel->decim;
+		while (phase >= kernel->interp) {
+			phase -= kernel->interp;
+			idx++;
+		}
+	}
+	pp->phase = phase;
+
+	if (idx > pp->hist_len)
+		idx = pp->hist_len;
+	memmove(pp->hist, pp->hist + idx,
+		(pp->hist_len - idx) * sizeof(float));
+	pp->hist_len -= idx;
+
+	return num_out;
+}
+
+/* Run the filter over the history, up to outframes. The accumulator
+ * can't overflow, polyphase_q15_init() made sure of that. */
+static uint32_t
+polyphase_q15_run(struct polyphase_q15 *pp, float *out, uint32_t outframes)
+{
+	const uint32_t num_taps = pp->num_taps;
+	const float scale = 1.0f / (float) (1 << POLYPHASE_ACC_BITS);
+	const int16_t *coeffs = NULL;
+	const int16_t *x = NULL;
+	uint32_t phase = pp->phase;
+	uint32_t avail = 0;
+	uint32_t idx = 0;
+	uint32_t num_out = 0;
+	uint32_t i = 0;
+	int32_t acc = 0;
+
+	/* Samples with a full window after them */
+	if (pp->hist_len >= num_taps)
+		avail = pp->hist_len - (num_taps - 1);
+
+	while (idx < avail && num_out < outframes) {
+		coeffs = pp->coeffs + phase * num_taps;
+		x = pp->hist + idx;
+		acc = 0;
+		for (i = 0; i < num_taps; i++)
+			acc += (int32_t) coeffs[i] * x[i];
+		out[num_out++] = (float) acc * scale;
+
+		phase += pp->decim;
+		while (phase >= pp->interp) {
+			phase -= pp->interp;
+			idx++;
+		}
+	}
+	pp->phase = phase;
+
+	/* The next window starts at idx, anything
+	 * before that is not needed anymore */
+	if (idx > pp->hist_len)
+		idx = pp->hist_len;
+	memmove(pp->hist, pp->hist + idx,
+		(pp->hist_len - idx) * sizeof(int16_t));
+	pp->hist_len -= idx;
+
+	return num_out;
+}
+
+/* Resample inframes samples from in to out, up to outframes, any
+ * input left over is kept for the next call. Returns the number
+ * of samples written to out, or -1 if there is no room for in. */
+int
+polyphase_q15_process(struct polyphase_q15 *pp, const float *in,
+		      float *out, uint32_t inframes, uint32_t outframes)
+{
+	int16_t *hist_in = NULL;
+	uint32_t i = 0;
+
+	if (pp->hist_len + inframes > pp->hist_size)
+		return -1;
+
+	hist_in = pp->hist + pp->hist_len;
+	for (i = 0; i < inframes; i++)
+		hist_in[i] = polyphase_sample_from_float(in[i]);
+	pp->hist_len += inframes;
+
+	return polyphase_q15_run(pp, out, outframes);
+}
+
+/* Same as above, for input that's already in Q14 (see
+ * fxp_q14_from_q15()), so that the fixed-point generators
+ * don't have to go through floating point on the way here */
+int
+polyphase_q15_process_q14(struct polyphase_q15 *pp, const int16_t *in,
+			  float *out, uint32_t inframes, uint32_t outframes)
+{
+	if (pp->hist_len + inframes > pp->hist_size)
+		return -1;
+
+	memcpy(pp->hist + pp->hist_len, in, inframes * sizeof(int16_t));
+	pp->hist_len += inframes;
+
+	return polyphase_q15_run(pp, out, outframes);
+}
+
+/* Same as above, in double precision, with the unquantized
+ * coefficients, for measuring the SNR on init. x starts with
+ * num_taps - 1 zeroes, as the history does after a reset. */
+static uint32_t
+polyphase_run_ref(const struct polyphase_q15 *pp, const double *coeffs,
+		  const double *x, uint32_t len, double *out)
+{
+	const uint32_t num_taps = pp->num_taps;
+	uint32_t phase = 0;
+	uint32_t idx = 0;
+	uint32_t num_out = 0;
+	uint32_t i = 0;
+	double acc = 0.0;
+
+	while (idx + num_taps <= len) {
+		acc = 0.0;
+		for (i = 0; i < num_taps; i++)
+			acc += coeffs[phase * num_taps + i] * x[idx + i];
+		out[num_out++] = acc;
+
+		phase += pp->decim;
+		while (phase >= pp->interp) {
+			phase -= pp->interp;
+			idx++;
+		}
+	}
+
+	return num_out;
+}
+
+/* Run a few tones within the passband through both filters
+ * and return the SNR of the fixed-point one (in dB) */
+static float
+polyphase_measure_snr(struct polyphase_q15 *pp, const double *coeffs,
+		      uint32_t in_rate, uint32_t passband_end,
+		      uint32_t max_inframes)
+{
+	static const double tones[4] = { 0.1, 0.35, 0.6, 0.85 };
+	uint32_t ref_len = POLYPHASE_TEST_LEN + pp->num_taps - 1;
+	uint32_t max_out = 0;
+	double *x = NULL;
+	double *ref_out = NULL;
+	float *in = NULL;
+	float *out = NULL;
+	double signal = 0.0;
+	double noise = 0.0;
+	double err = 0.0;
+	double t = 0.0;
+	uint32_t num_ref = 0;
+	uint32_t num_out = 0;
+	uint32_t chunk = 0;
+	uint32_t i = 0;
+	int ret = 0;
+	int j = 0;
+	float snr = 0.0;
+
+	max_out = (uint32_t) (((uint64_t) POLYPHASE_TEST_LEN * pp->interp) /
+			      pp->decim) + 2;
+	x = (double *) calloc(ref_len, sizeof(double));
+	ref_out = (double *) malloc(max_out * sizeof(double));
+	in = (float *) malloc(POLYPHASE_TEST_LEN * sizeof(float));
+	out = (float *) malloc(max_out * sizeof(float));
+	if (!x || !ref_out || !in || !out)
+		goto cleanup;
+
+	for (i = 0; i < POLYPHASE_TEST_LEN; i++) {
+		t = (double) i / (double) in_rate;
+		in[i] = 0.0;
+		for (j = 0; j < 4; j++)
+			in[i] += (float) (0.22 * sin(2.0 * M_PI * tones[j] *
+						     passband_end * t));
+		x[pp->num_taps - 1 + i] = in[i];
+	}
+
+	num_ref = polyphase_run_ref(pp, coeffs, x, ref_len, ref_out);
+
+	/* Feed the fixed-point one as we would do
+	 * on each period */
+	for (i = 0; i < POLYPHASE_TEST_LEN; i += chunk) {
+		chunk = POLYPHASE_TEST_LEN - i;
+		if (chunk > max_inframes)
+			chunk = max_inframes;
+		ret = polyphase_q15_process(pp, in + i, out + num_out, chunk,
+					    max_out - num_out);
+		if (ret < 0)
+			goto cleanup;
+		num_out += ret;
+	}
+
+	if (num_out > num_ref)
+		num_out = num_ref;
+	for (i = 0; i < num_out; i++) {
+		err = (double) out[i] - ref_out[i];
+		signal += ref_out[i] * ref_out[i];
+		noise += err * err;
+	}
+	if (noise > 0.0 && signal > 0.0)
+		snr = (float) (10.0 * log10(signal / noise));
+	else if (signal > 0.0)
+		snr = 200.0;
+
+ cleanup:
+	polyphase_q15_reset(pp);
+	free(x);
+	free(ref_out);
+	free(in);
+	free(out);
+	return snr;
+}
+
+
+/****************\
+* INIT / DESTROY *
+\****************/
+
+/* Look for a precomputed kernel for the given ratio / design */
+const struct polyphase_kernel *
+polyphase_find_kernel(uint32_t in_rate, uint32_t out_rate,
+		      uint32_t passband_end, uint32_t stopband_begin)
+{
+	const struct polyphase_kernel *kernel = NULL;
+	int i = 0;
+
+	for (i = 0; i < POLYPHASE_NUM_KERNELS; i++) {
+		kernel = &polyphase_kernels[i];
+		if (kernel->in_rate == in_rate &&
+		    kernel->out_rate == out_rate &&
+		    kernel->passband_end == passband_end &&
+		    kernel->stopband_begin == stopband_begin)
+			return kernel;
+	}
+
+	return NULL;
+}
+
+void
+polyphase_reset(struct polyphase *pp)
+{
+	memset(pp->hist, 0, pp->hist_size * sizeof(float));
+	pp->hist_len = pp->kernel->num_taps - 1;
+	pp->phase = 0;
+}
+
+/* All allocations happen here, max_inframes is the
+ * most we'll get on each call to polyphase_process() */
+int
+polyphase_init(struct polyphase *pp, const struct polyphase_kernel *kernel,
+	       uint32_t max_inframes)
+{
+	memset(pp, 0, sizeof(struct polyphase));
+
+	if (!kernel || !max_inframes)
+		return -1;
+	pp->kernel = kernel;
+
+	/* Room for the history plus two periods, in case
+	 * we didn't get to all of the previous one */
+	pp->hist_size = kernel->num_taps - 1 + 2 * max_inframes;
+	pp->hist = (float *) malloc(pp->hist_size * sizeof(float));
+	if (!pp->hist) {
+		utils_err("[POLYPHASE] Could not allocate history buffer\n");
+		return -2;
+	}
+	polyphase_reset(pp);
+
+	utils_dbg("[POLYPHASE] Kernel %u -> %u (%u / %u), %u taps per phase\n",
+		  kernel->in_rate, kernel->out_rate, kernel->interp,
+		  kernel->decim, kernel->num_taps);
+
+	return 0;
+}
+
+void
+polyphase_destroy(struct polyphase *pp)
+{
+	free(pp->hist);
+	pp->hist = NULL;
+	pp->hist_len = 0;
+	pp->hist_size = 0;
+	pp->kernel = NULL;
+}
+
+void
+polyphase_q15_reset(struct polyphase_q15 *pp)
+{
+	memset(pp->hist, 0, pp->hist_size * sizeof(int16_t));
+	pp->hist_len = pp->num_taps - 1;
+	pp->phase = 0;
+}
+
+int
+polyphase_q15_init(struct polyphase_q15 *pp, uint32_t in_rate,
+		   uint32_t out_rate, uint32_t passband_end,
+		   uint32_t stopband_begin, uint32_t max_inframes)
+{
+	double *coeffs = NULL;
+	double proto_rate = 0.0;
+	double fc = 0.0;
+	double df = 0.0;
+	uint32_t gcd = 0;
+	uint32_t len = 0;
+	uint32_t sum = 0;
+	uint32_t max_sum = 0;
+	uint32_t i = 0;
+	uint32_t j = 0;
+	int ret = 0;
+
+	memset(pp, 0, sizeof(struct polyphase_q15));
+
+	if (!in_rate || !out_rate || !max_inframes ||
+	    passband_end >= stopband_begin) {
+		ret = -1;
+		goto cleanup;
+	}
+
+	gcd = polyphase_gcd(in_rate, out_rate);
+	pp->interp = out_rate / gcd;
+	pp->decim = in_rate / gcd;
+	if (pp->interp > POLYPHASE_MAX_PHASES) {
+		utils_err("[POLYPHASE] Unsupported ratio: %u / %u\n",
+			  out_rate, in_rate);
+		ret = -2;
+		goto cleanup;
+	}
+
+	/* The cutoff goes in the middle of the transition band */
+	proto_rate = (double) in_rate * (double) pp->interp;
+	fc = ((double) passband_end + (double) stopband_begin) /
+	     (2.0 * proto_rate);
+	df = ((double) stopband_begin - (double) passband_end) / proto_rate;
+	len = polyphase_kaiser_len(POLYPHASE_STOPBAND_ATTEN, df);
+	pp->num_taps = (len + pp->interp - 1) / pp->interp;
+	if (pp->num_taps > POLYPHASE_MAX_TAPS) {
+		utils_err("[POLYPHASE] Transition band too narrow (%u taps)\n",
+			  pp->num_taps);
+		ret = -3;
+		goto cleanup;
+	}
+	len = pp->interp * pp->num_taps;
+
+	coeffs = (double *) malloc(len * sizeof(double));
+	pp->coeffs = (int16_t *) malloc(len * sizeof(int16_t));
+	if (!coeffs || !pp->coeffs) {
+		ret = -4;
+		goto cleanup;
+	}
+
+	polyphase_design(pp->interp, pp->num_taps, fc,
+			 POLYPHASE_STOPBAND_ATTEN, 0, coeffs);
+	for (i = 0; i < len; i++)
+		pp->coeffs[i] = fxp_q15_from_float((float) coeffs[i]);
+
+	/* With full scale samples of the worst possible sign on each
+	 * tap, the accumulator gets to the phase's sum of |coeffs|
+	 * times 1 << 15, make sure that fits in 32 bits */
+	for (i = 0; i < pp->interp; i++) {
+		sum = 0;
+		for (j = 0; j < pp->num_taps; j++)
+			sum += abs(pp->coeffs[i * pp->num_taps + j]);
+		if (sum > max_sum)
+			max_sum = sum;
+	}
+	if ((uint64_t) max_sum << FXP_Q15_BITS > INT32_MAX) {
+		utils_err("[POLYPHASE] Accumulator may overflow (gain %.2f)\n",
+			  (float) max_sum / (float) FXP_Q15_ONE);
+		ret = -5;
+		goto cleanup;
+	}
+
+	/* Room for the history plus two periods, in case
+	 * we didn't get to all of the previous one */
+	pp->hist_size = pp->num_taps - 1 + 2 * max_inframes;
+	pp->hist = (int16_t *) malloc(pp->hist_size * sizeof(int16_t));
+	if (!pp->hist) {
+		ret = -4;
+		goto cleanup;
+	}
+	polyphase_q15_reset(pp);
+
+	pp->snr = polyphase_measure_snr(pp, coeffs, in_rate, passband_end,
+					max_inframes);
+
+	utils_dbg("[POLYPHASE] %u / %u, %u taps per phase, SNR: %.1fdB\n",
+		  pp->interp, pp->decim, pp->num_taps, pp->snr);
+
+ cleanup:
+	free(coeffs);
+	if (ret < 0) {
+		utils_err("[POLYPHASE] Init failed with code: %i\n", ret);
+		polyphase_q15_destroy(pp);
+	}
+	return ret;
+}
+
+void
+polyphase_q15_destroy(struct polyphase_q15 *pp)
+{
+	free(pp->coeffs);
+	pp->coeffs = NULL;
+	free(pp->hist);
+	pp->hist = NULL;
+	pp->hist_len = 0;
+	pp->hist_size = 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - Polyphase resampler
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>		/* For typed integers */
+
+/*
+ * Polyphase FIR resampler for rational ratios (L / M) in fixed point,
+ * with Q15 coefficients, Q14 samples (so that the input may go up to
+ * twice full scale before clipping) and 32bit accumulators (the worst
+ * case sum of each phase gets checked on init, so that they can't
+ * overflow). It's used in place of SoXr on the fixed-point path (see
+ * FMMOD_FIXED_POINT_ENV).
+ *
+ * The prototype filter is a Kaiser-windowed sinc designed on init, its
+ * length comes from the transition band and the stopband attenuation,
+ * so keep the transition band wide (e.g. up to the output's Nyquist).
+ */
+#define POLYPHASE_MAX_PHASES		1024
+#define POLYPHASE_MAX_TAPS		128
+#define POLYPHASE_STOPBAND_ATTEN	80.0
+
+/* Length of the test signal used for measuring the
+ * SNR against the floating point filter */
+#define POLYPHASE_TEST_LEN		8192
+
+struct polyphase_q15 {
+	uint32_t interp;
+	uint32_t decim;
+	uint32_t num_taps;
+	/* interp phases of num_taps each, reversed so
+	 * that each one is a plain dot product */
+	int16_t *coeffs;
+	/* Input history, the last num_taps - 1 samples plus
+	 * any input we didn't get to on the last call */
+	int16_t *hist;
+	uint32_t hist_len;
+	uint32_t hist_size;
+	uint32_t phase;
+	/* SNR against the floating point filter, measured on init */
+	float snr;
+};
+
+/*
+ * Floating point polyphase kernels for the fixed ratios / designs we
+ * use all the time (e.g. 48KHz -> 228KHz with the default audio LPF),
+ * their coefficients are precomputed in polyphase_tables.h (generated
+ * by polyphase_tool -g). Ratios with too many phases for a table (e.g.
+ * 44.1KHz -> 228KHz, 760 / 147) get POLYPHASE_KERNEL_INTERP_PHASES + 1
+ * rows instead, and we interpolate linearly between them. For anything
+ * else the resampler falls back to SoXr.
+ */
+#define POLYPHASE_KERNEL_ATTEN		100.0
+#define POLYPHASE_KERNEL_INTERP_PHASES	128
+/* So that the inner loop can work on two vectors of 4 floats at once */
+#define POLYPHASE_KERNEL_TAP_ALIGN	8
+
+struct polyphase_kernel {
+	uint32_t in_rate;
+	uint32_t out_rate;
+	uint32_t passband_end;
+	uint32_t stopband_begin;
+	uint32_t interp;
+	uint32_t decim;
+	/* Same as interp for exact tables, else the
+	 * table has num_phases + 1 rows */
+	uint32_t num_phases;
+	uint32_t num_taps;
+	const float *coeffs;
+};
+
+struct polyphase {
+	const struct polyphase_kernel *kernel;
+	/* Same as on polyphase_q15 */
+	float *hist;
+	uint32_t hist_len;
+	uint32_t hist_size;
+	uint32_t phase;
+};
+
+uint32_t polyphase_kaiser_len(double atten, double transition);
+void polyphase_design(uint32_t num_phases, uint32_t num_taps, double fc,
+		      double atten, int interpolated, double *out);
+const struct polyphase_kernel *polyphase_find_kernel(uint32_t in_rate,
+						     uint32_t out_rate,
+						     uint32_t passband_end,
+						     uint32_t stopband_begin);
+int polyphase_init(struct polyphase *pp, const struct polyphase_kernel *kernel,
+		   uint32_t max_inframes);
+int polyphase_process(struct polyphase *pp, const float *in, float *out,
+		      uint32_t inframes, uint32_t outframes);
+void polyphase_reset(struct polyphase *pp);
+void polyphase_destroy(struct polyphase *pp);
+
+int polyphase_q15_init(struct polyphase_q15 *pp, uint32_t in_rate,
+		       uint32_t out_rate, uint32_t passband_end,
+		       uint32_t stopband_begin, uint32_t max_inframes);
+int polyphase_q15_process(struct polyphase_q15 *pp, const float *in,
+			  float *out, uint32_t inframes, uint32_t outframes);
+int polyphase_q15_process_q14(struct polyphase_q15 *pp, const int16_t *in,
+			      float *out, uint32_t inframes,
+			      uint32_t outframes);
+void polyphase_q15_reset(struct polyphase_q15 *pp);
+void polyphase_q15_destroy(struct polyphase_q15 *pp);
@@ -0,0 +1,9735 @@
+/* Generated by polyphase_tool -g, do not edit */
+
+/* Only include this from polyphase.c */
+
+/* 48000 -> 228000, passband: 20000, stopband: 28000, 19 / 4 */
+static const float polyphase_48000_228000_20000[760]
+__attribute__ ((aligned (16))) = {
+	-2.37601548e-06, 7.37854447e-06, -1.77953411e-05, 3.71154556e-05,
+	-7.01298610e-05, 1.23134141e-04, -2.04120796e-04, 3.22989427e-04,
+	-4.91843961e-04, 7.25517197e-04, -1.04259375e-03, 1.46746459e-03,
+	-2.03452620e-03, 2.79706475e-03, -3.84733454e-03, 5.36717414e-03,
+	-7.77951885e-03, 1.23488134e-02, -2.52908491e-02, 9.98852961e-01,
+	2.66915599e-02, -1.27102454e-02, 7.94750750e-03, -5.46626776e-03,
+	3.91337411e-03, -2.84409363e-03, 2.06919619e-03, -1.49340116e-03,
+	1.06201984e-03, -7.39942413e-04, 5.02382415e-04, -3.30513416e-04,
+	2.09336772e-04, -1.26620907e-04, 7.23588443e-05, -3.84633232e-05,
+	1.85542263e-05, -7.76630282e-06, 2.54729508e-06, -4.40994075e-07,
+	-6.57826294e-06, 2.08255100e-05, -5.07170812e-05, 1.06438854e-04,
+	-2.02013925e-04, 3.55907582e-04, -5.91599311e-04, 9.38201032e-04,
+	-1.43131904e-03, 2.11456222e-03, -3.04247482e-03, 4.28642179e-03,
+	-5.94660305e-03, 8.17740879e-03, -1.12444692e-02, 1.56674581e-02,
+	-2.26428212e-02, 3.56873902e-02, -7.14203521e-02, 9.89705314e-01,
+	8.39809524e-02, -3.89149767e-02, 2.41418135e-02, -1.65514563e-02,
+	1.18335291e-02, -8.59687250e-03, 6.25582473e-03, -4.51774632e-03,
+	3.21573217e-03, -2.24321778e-03, 1.52530988e-03, -1.00530702e-03,
+	6.38121014e-04, -3.87007025e-04, 2.21895466e-04, -1.18461763e-04,
+	5.74867329e-05, -2.42848695e-05, 8.10660451e-06, -1.49540813e-06,
+	-1.00088844e-05, 3.23326754e-05, -7.95325689e-05, 1.67974459e-04,
+	-3.20248921e-04, 5.66165195e-04, -9.43688034e-04, 1.49993946e-03,
+	-2.29257556e-03, 3.39217415e-03, -4.88686350e-03, 6.89160252e-03,
+	-9.56710379e-03, 1.31596729e-02, -1.80904610e-02, 2.51773378e-02,
+	-3.62845839e-02, 5.68028632e-02, -1.11276378e-01, 9.71562256e-01,
+	1.45913629e-01, -6.56286135e-02, 4.03772597e-02, -2.75896390e-02,
+	1.96975447e-02, -1.43039269e-02, 1.04105761e-02, -7.52257239e-03,
+	5.35944074e-03, -3.74309540e-03, 2.54894796e-03, -1.68298370e-03,
+	1.07058877e-03, -6.51001278e-04, 3.74487095e-04, -2.00776633e-04,
+	9.80046274e-05, -4.17740043e-05, 1.41815945e-05, -2.76954289e-06,
+	-1.26499212e-05, 4.17407085e-05, -1.03737562e-04, 2.20517680e-04,
+	-4.22359602e-04, 7.49302147e-04, -1.25242164e-03, 1.99518356e-03,
+	-3.05527377e-03, 4.52774462e-03, -6.53109445e-03, 9.21944437e-03,
+	-1.28073411e-02, 1.76218531e-02, -2.42187932e-02, 3.36696917e-02,
+	-4.83932557e-02, 7.52730431e-02, -1.44568545e-01, 9.44725211e-01,
+	2.11718308e-01, -9.21644625e-02, 5.62080600e-02, -3.82722544e-02,
+	2.72839651e-02, -1.98038903e-02, 1.44156515e-02, -1.04225026e-02,
+	7.43213036e-03, -5.19682594e-03, 3.54409207e-03, -2.34419997e-03,
+	1.49439889e-03, -9.11080403e-04, 5.25798788e-04, -2.83083871e-04,
+	1.38977581e-04, -5.97578751e-05, 2.06172294e-05, -4.23964708e-06,
+	-1.45131490e-05, 4.89705201e-05, -1.23003837e-04, 2.63204993e-04,
+	-5.06476986e-04, 9.01723569e-04, -1.51143333e-03, 2.41333951e-03,
+	-3.70263652e-03, 5.49575132e-03, -7.93760570e-03, 1.12161476e-02,
+	-1.55919188e-02, 2.14600202e-02, -2.94877860e-02, 4.09524916e-02,
+	-5.87097402e-02, 9.07622998e-02, -1.71138703e-01, 9.09638773e-01,
+	2.80528750e-01, -1.17799508e-01, 7.11797246e-02, -4.82889958e-02,
+	3.43714006e-02, -2.49357531e-02, 1.81534508e-02, -1.31321169e-02,
+	9.37254102e-03, -6.56128952e-03, 4.48111545e-03, -2.96919681e-03,
+	1.89684024e-03, -1.15941735e-03, 6.71263938e-04, -3.62895412e-04,
+	1.79168267e-04, -7.76973749e-05, 2.72256897e-05, -5.86823641e-06,
+	-1.56364300e-05, 5.40185288e-05, -1.37175515e-04, 2.95516212e-04,
+	-5.71355696e-04, 1.02089202e-03, -1.71605539e-03, 2.74642741e-03,
+	-4.22176725e-03, 6.27626702e-03, -9.07671525e-03, 1.28388145e-02,
+	-1.78603504e-02, 2.45905532e-02, -3.37835935e-02, 4.68726813e-02,
+	-6.70320350e-02, 1.03025490e-01, -1.90960182e-01, 8.66881838e-01,
+	3.51398588e-01, -1.41789309e-01, 8.48406529e-02, -5.73362051e-02,
+	4.07446610e-02, -2.95433755e-02, 2.15098902e-02, -1.55683690e-02,
+	1.11209037e-02, -7.79421705e-03, 5.33080643e-03, -3.53835577e-03,
+	2.26518696e-03, -1.38809765e-03, 8.06208398e-04, -4.37625025e-04,
+	2.17263632e-04, -9.50025634e-05, 3.37897676e-05, -7.60399078e-06,
+	-1.60794879e-05, 5.69498880e-05, -1.46260377e-04, 3.17266457e-04,
+	-6.16372200e-04, 1.10534217e-03, -1.86336674e-03, 2.98918618e-03,
+	-4.60384655e-03, 6.85529383e-03, -9.92715211e-03, 1.40562507e-02,
+	-1.95682168e-02, 2.69517504e-02, -3.70223578e-02, 5.13188998e-02,
+	-7.32182551e-02, 1.11909664e-01, -2.04134324e-01, 8.17156086e-01,
+	4.23318054e-01, -1.63383890e-01, 9.67541014e-02, -6.51253860e-02,
+	4.62009231e-02, -3.34800126e-02, 2.43777303e-02, -1.76530204e-02,
+	1.26206969e-02, -8.85543443e-03, 6.06522868e-03, -4.03277599e-03,
+	2.58707159e-03, -1.58935015e-03, 9.25985382e-04, -5.04661679e-04,
+	2.51911027e-04, -1.11047973e-04, 4.00677378e-05, -9.38226443e-06,
+	-1.59193164e-05, 5.78900669e-05, -1.50416825e-04, 3.28588699e-04,
+	-6.41505100e-04, 1.15466407e-03, -1.95218876e-03, 3.13909745e-03,
+	-4.84420689e-03, 7.22492007e-03, -1.04763359e-02, 1.48494167e-02,
+	-2.06878467e-02, 2.85047936e-02, -3.91514888e-02, 5.42230144e-02,
+	-7.71880186e-02, 1.17353569e-01, -2.10884410e-01, 7.61272066e-01,
+	4.95232290e-01, -1.81844267e-01, 1.06510241e-01, -7.13916108e-02,
+	5.05557652e-02, -3.66127276e-02, 2.66598236e-02, -1.93150213e-02,
+	1.38203743e-02, -9.70809464e-03, 6.65858015e-03, -4.43485623e-03,
+	2.85086599e-03, -1.75578587e-03, 1.02611758e-03, -5.61448612e-04,
+	2.81758404e-04, -1.25190493e-04, 4.57996644e-05, -1.11262526e-05,
+	-1.52454208e-05, 5.70151993e-05, -1.49937190e-04, 3.29908042e-04,
+	-6.47299112e-04, 1.16945707e-03, -1.98303198e-03, 3.19633131e-03,
+	-4.94228824e-03, 7.38330202e-03, -1.07204064e-02, 1.52115310e-02,
+	-2.12085177e-02, 2.92340609e-02, -4.01500632e-02, 5.55604609e-02,
+	-7.89222137e-02, 1.19385040e-01, -2.11547187e-01, 7.00133182e-01,
+	5.66060840e-01, -1.96459259e-01, 1.13738000e-01, -7.59015944e-02,
+	5.36488973e-02, -3.88265648e-02, 2.82721857e-02, -2.04927708e-02,
+	1.46750126e-02, -1.03198617e-02, 7.08802565e-03, -4.72886492e-03,
+	3.04605890e-03, -1.88063823e-03, 1.10244261e-03, -6.05565985e-04,
+	3.05497529e-04, -1.36789423e-04, 5.07150435e-05, -1.27488342e-05,
+	-1.41550845e-05, 5.45416256e-05, -1.45228201e-04, 3.21909044e-04,
+	-6.34814740e-04, 1.15125737e-03, -1.95799749e-03, 3.16361892e-03,
+	-4.90148098e-03, 7.33447790e-03, -1.06640103e-02, 1.51478309e-02,
+	-2.11361863e-02, 2.91467992e-02, -4.00283588e-02, 5.53494213e-02,
+	-7.84612078e-02, 1.18116394e-01, -2.06562204e-01, 6.34717943e-01,
+	6.34717943e-01, -2.06562204e-01, 1.18116394e-01, -7.84612078e-02,
+	5.53494213e-02, -4.00283588e-02, 2.91467992e-02, -2.11361863e-02,
+	1.51478309e-02, -1.06640103e-02, 7.33447790e-03, -4.90148098e-03,
+	3.16361892e-03, -1.95799749e-03, 1.15125737e-03, -6.34814740e-04,
+	3.21909044e-04, -1.45228201e-04, 5.45416256e-05, -1.41550845e-05,
+	-1.27488342e-05, 5.07150435e-05, -1.36789423e-04, 3.05497529e-04,
+	-6.05565985e-04, 1.10244261e-03, -1.88063823e-03, 3.04605890e-03,
+	-4.72886492e-03, 7.08802565e-03, -1.03198617e-02, 1.46750126e-02,
+	-2.04927708e-02, 2.82721857e-02, -3.88265648e-02, 5.36488973e-02,
+	-7.59015944e-02, 1.13738000e-01, -1.96459259e-01, 5.66060840e-01,
+	7.00133182e-01, -2.11547187e-01, 1.19385040e-01, -7.89222137e-02,
+	5.55604609e-02, -4.01500632e-02, 2.92340609e-02, -2.12085177e-02,
+	1.52115310e-02, -1.07204064e-02, 7.38330202e-03, -4.94228824e-03,
+	3.19633131e-03, -1.98303198e-03, 1.16945707e-03, -6.47299112e-04,
+	3.29908042e-04, -1.49937190e-04, 5.70151993e-05, -1.52454208e-05,
+	-1.11262526e-05, 4.57996644e-05, -1.25190493e-04, 2.81758404e-04,
+	-5.61448612e-04, 1.02611758e-03, -1.75578587e-03, 2.85086599e-03,
+	-4.43485623e-03, 6.65858015e-03, -9.70809464e-03, 1.38203743e-02,
+	-1.93150213e-02, 2.66598236e-02, -3.66127276e-02, 5.05557652e-02,
+	-7.13916108e-02, 1.06510241e-01, -1.81844267e-01, 4.95232290e-01,
+	7.61272066e-01, -2.10884410e-01, 1.17353569e-01, -7.71880186e-02,
+	5.42230144e-02, -3.91514888e-02, 2.85047936e-02, -2.06878467e-02,
+	1.48494167e-02, -1.04763359e-02, 7.22492007e-03, -4.84420689e-03,
+	3.13909745e-03, -1.95218876e-03, 1.15466407e-03, -6.41505100e-04,
+	3.28588699e-04, -1.50416825e-04, 5.78900669e-05, -1.59193164e-05,
+	-9.38226443e-06, 4.00677378e-05, -1.11047973e-04, 2.51911027e-04,
+	-5.04661679e-04, 9.25985382e-04, -1.58935015e-03, 2.58707159e-03,
+	-4.03277599e-03, 6.06522868e-03, -8.85543443e-03, 1.26206969e-02,
+	-1.76530204e-02, 2.43777303e-02, -3.34800126e-02, 4.62009231e-02,
+	-6.51253860e-02, 9.67541014e-02, -1.63383890e-01, 4.23318054e-01,
+	8.17156086e-01, -2.04134324e-01, 1.11909664e-01, -7.32182551e-02,
+	5.13188998e-02, -3.70223578e-02, 2.69517504e-02, -1.95682168e-02,
+	1.40562507e-02, -9.92715211e-03, 6.85529383e-03, -4.60384655e-03,
+	2.98918618e-03, -1.86336674e-03, 1.10534217e-03, -6.16372200e-04,
+	3.17266457e-04, -1.46260377e-04, 5.69498880e-05, -1.60794879e-05,
+	-7.60399078e-06, 3.37897676e-05, -9.50025634e-05, 2.17263632e-04,
+	-4.37625025e-04, 8.06208398e-04, -1.38809765e-03, 2.26518696e-03,
+	-3.53835577e-03, 5.33080643e-03, -7.79421705e-03, 1.11209037e-02,
+	-1.55683690e-02, 2.15098902e-02, -2.95433755e-02, 4.07446610e-02,
+	-5.73362051e-02, 8.48406529e-02, -1.41789309e-01, 3.51398588e-01,
+	8.66881838e-01, -1.90960182e-01, 1.03025490e-01, -6.70320350e-02,
+	4.68726813e-02, -3.37835935e-02, 2.45905532e-02, -1.78603504e-02,
+	1.28388145e-02, -9.07671525e-03, 6.27626702e-03, -4.22176725e-03,
+	2.74642741e-03, -1.71605539e-03, 1.02089202e-03, -5.71355696e-04,
+	2.95516212e-04, -1.37175515e-04, 5.40185288e-05, -1.56364300e-05,
+	-5.86823641e-06, 2.72256897e-05, -7.76973749e-05, 1.79168267e-04,
+	-3.62895412e-04, 6.71263938e-04, -1.15941735e-03, 1.89684024e-03,
+	-2.96919681e-03, 4.48111545e-03, -6.56128952e-03, 9.37254102e-03,
+	-1.31321169e-02, 1.81534508e-02, -2.49357531e-02, 3.43714006e-02,
+	-4.82889958e-02, 7.11797246e-02, -1.17799508e-01, 2.80528750e-01,
+	9.09638773e-01, -1.71138703e-01, 9.07622998e-02, -5.87097402e-02,
+	4.09524916e-02, -2.94877860e-02, 2.14600202e-02, -1.55919188e-02,
+	1.12161476e-02, -7.93760570e-03, 5.49575132e-03, -3.70263652e-03,
+	2.41333951e-03, -1.51143333e-03, 9.01723569e-04, -5.06476986e-04,
+	2.63204993e-04, -1.23003837e-04, 4.89705201e-05, -1.45131490e-05,
+	-4.23964708e-06, 2.06172294e-05, -5.97578751e-05, 1.38977581e-04,
+	-2.83083871e-04, 5.25798788e-04, -9.11080403e-04, 1.49439889e-03,
+	-2.34419997e-03, 3.54409207e-03, -5.19682594e-03, 7.43213036e-03,
+	-1.04225026e-02, 1.44156515e-02, -1.98038903e-02, 2.72839651e-02,
+	-3.82722544e-02, 5.62080600e-02, -9.21644625e-02, 2.11718308e-01,
+	9.44725211e-01, -1.44568545e-01, 7.52730431e-02, -4.83932557e-02,
+	3.36696917e-02, -2.42187932e-02, 1.76218531e-02, -1.28073411e-02,
+	9.21944437e-03, -6.53109445e-03, 4.52774462e-03, -3.05527377e-03,
+	1.99518356e-03, -1.25242164e-03, 7.49302147e-04, -4.22359602e-04,
+	2.20517680e-04, -1.03737562e-04, 4.17407085e-05, -1.26499212e-05,
+	-2.76954289e-06, 1.41815945e-05, -4.17740043e-05, 9.80046274e-05,
+	-2.00776633e-04, 3.74487095e-04, -6.51001278e-04, 1.07058877e-03,
+	-1.68298370e-03, 2.54894796e-03, -3.74309540e-03, 5.35944074e-03,
+	-7.52257239e-03, 1.04105761e-02, -1.43039269e-02, 1.96975447e-02,
+	-2.75896390e-02, 4.03772597e-02, -6.56286135e-02, 1.45913629e-01,
+	9.71562256e-01, -1.11276378e-01, 5.68028632e-02, -3.62845839e-02,
+	2.51773378e-02, -1.80904610e-02, 1.31596729e-02, -9.56710379e-03,
+	6.89160252e-03, -4.88686350e-03, 3.39217415e-03, -2.29257556e-03,
+	1.49993946e-03, -9.43688034e-04, 5.66165195e-04, -3.20248921e-04,
+	1.67974459e-04, -7.95325689e-05, 3.23326754e-05, -1.00088844e-05,
+	-1.49540813e-06, 8.10660451e-06, -2.42848695e-05, 5.74867329e-05,
+	-1.18461763e-04, 2.21895466e-04, -3.87007025e-04, 6.38121014e-04,
+	-1.00530702e-03, 1.52530988e-03, -2.24321778e-03, 3.21573217e-03,
+	-4.51774632e-03, 6.25582473e-03, -8.59687250e-03, 1.18335291e-02,
+	-1.65514563e-02, 2.41418135e-02, -3.89149767e-02, 8.39809524e-02,
+	9.89705314e-01, -7.14203521e-02, 3.56873902e-02, -2.26428212e-02,
+	1.56674581e-02, -1.12444692e-02, 8.17740879e-03, -5.94660305e-03,
+	4.28642179e-03, -3.04247482e-03, 2.11456222e-03, -1.43131904e-03,
+	9.38201032e-04, -5.91599311e-04, 3.55907582e-04, -2.02013925e-04,
+	1.06438854e-04, -5.07170812e-05, 2.08255100e-05, -6.57826294e-06,
+	-4.40994075e-07, 2.54729508e-06, -7.76630282e-06, 1.85542263e-05,
+	-3.84633232e-05, 7.23588443e-05, -1.26620907e-04, 2.09336772e-04,
+	-3.30513416e-04, 5.02382415e-04, -7.39942413e-04, 1.06201984e-03,
+	-1.49340116e-03, 2.06919619e-03, -2.84409363e-03, 3.91337411e-03,
+	-5.46626776e-03, 7.94750750e-03, -1.27102454e-02, 2.66915599e-02,
+	9.98852961e-01, -2.52908491e-02, 1.23488134e-02, -7.77951885e-03,
+	5.36717414e-03, -3.84733454e-03, 2.79706475e-03, -2.03452620e-03,
+	1.46746459e-03, -1.04259375e-03, 7.25517197e-04, -4.91843961e-04,
+	3.22989427e-04, -2.04120796e-04, 1.23134141e-04, -7.01298610e-05,
+	3.71154556e-05, -1.77953411e-05, 7.37854447e-06, -2.37601548e-06,
+};
+
+/* 44100 -> 228000, passband: 20000, stopband: 24100, 760 / 147 (interpolated) */
+static const float polyphase_44100_228000_20000[9288]
+__attribute__ ((aligned (16))) = {
+	7.04218369e-20, 5.79380555e-20, 1.81765854e-20, -2.51455424e-19,
+	7.63668180e-19, -1.73000834e-18, -2.95576786e-22, -1.18114084e-18,
+	3.32169146e-18, 2.61119884e-18, -4.41071808e-19, -3.50034913e-18,
+	9.90745670e-18, -1.96410152e-17, -2.50264867e-18, -7.86713930e-18,
+	2.35418902e-17, -1.09051312e-17, -8.91848465e-18, -1.44604792e-17,
+	4.81132232e-17, -1.84175718e-17, -2.52392385e-17, -2.26005060e-17,
+	8.98684280e-17, -2.67833835e-17, 2.87948780e-17, -3.07085034e-17,
+	3.24910692e-17, -3.41106302e-17, 3.55373614e-17, -3.67443935e-17,
+	3.77085816e-17, -3.84111756e-17, 3.88383714e-17, 1.00000000e+00,
+	3.88383714e-17, -3.84111756e-17, 3.77085816e-17, -3.67443935e-17,
+	3.55373614e-17, -3.41106302e-17, 3.24910692e-17, -3.07085034e-17,
+	2.87948780e-17, -2.67833835e-17, 8.98684280e-17, -2.26005060e-17,
+	-2.52392385e-17, -1.84175718e-17, 4.81132232e-17, -1.44604792e-17,
+	-8.91848465e-18, -1.09051312e-17, 2.35418902e-17, -7.86713930e-18,
+	-2.50264867e-18, -1.96410152e-17, 9.90745670e-18, -3.50034913e-18,
+	-4.41071808e-19, 2.61119884e-18, 3.32169146e-18, -1.18114084e-18,
+	-2.95576786e-22, -1.73000834e-18, 7.63668180e-19, -2.51455424e-19,
+	1.81765854e-20, 5.79380555e-20, 7.04218369e-20, -1.30626217e-20,
+	-2.18925457e-07, 4.80737736e-07, -9.08767560e-07, 1.56842649e-06,
+	-2.54107005e-06, 3.92594251e-06, -5.84206970e-06, 8.43007498e-06,
+	-1.18539091e-05, 1.63025072e-05, -2.19914200e-05, 2.91645054e-05,
+	-3.80958311e-05, 4.90920093e-05, -6.24952958e-05, 7.86879272e-05,
+	-9.80983748e-05, 1.21210490e-04, -1.48576959e-04, 1.80839155e-04,
+	-2.18756547e-04, 2.63250591e-04, -3.15470922e-04, 3.76896875e-04,
+	-4.49496653e-04, 5.35984241e-04, -6.40249631e-04, 7.68113332e-04,
+	-9.28728339e-04, 1.13738303e-03, -1.42166194e-03, 1.83682791e-03,
+	-2.51188385e-03, 3.83327285e-03, -7.72221014e-03, 9.99899379e-01,
+	7.84472300e-03, -3.86422852e-03, 2.52587569e-03, -1.84487128e-03,
+	1.42694018e-03, -1.14114721e-03, 9.31567778e-04, -7.70341200e-04,
+	6.42047469e-04, -5.37464520e-04, 4.50732895e-04, -3.77939380e-04,
+	3.16355517e-04, -2.64003755e-04, 2.19398533e-04, -1.81385961e-04,
+	1.49041600e-04, -1.21603831e-04, 9.84296925e-05, -7.89652866e-05,
+	6.27258025e-05, -4.92819831e-05, 3.82509236e-05, -2.92897809e-05,
+	2.20914121e-05, -1.63812605e-05, 1.19150116e-05, -8.47668573e-06,
+	5.87694441e-06, -3.95145912e-06, 2.55925510e-06, -1.58098278e-06,
+	9.17103206e-07, -4.85996196e-07, 2.22016159e-07, -7.35299573e-08,
+	-4.34650121e-07, 9.55959258e-07, -1.80869677e-06, 3.12341277e-06,
+	-5.06250510e-06, 7.82410824e-06, -1.16458789e-05, 1.68086280e-05,
+	-2.36397809e-05, 3.25166916e-05, -4.38699026e-05, 5.81865270e-05,
+	-7.60140465e-05, 9.79649710e-05, -1.24723020e-04, 1.57051768e-04,
+	-1.95807118e-04, 2.41955524e-04, -2.96600816e-04, 3.61023770e-04,
+	-4.36740733e-04, 5.25591084e-04, -6.29869166e-04, 7.52526565e-04,
+	-8.97489202e-04, 1.07016902e-03, -1.27832058e-03, 1.53354270e-03,
+	-1.85406729e-03, 2.27033137e-03, -2.83721392e-03, 3.66455313e-03,
+	-5.00837253e-03, 7.63364515e-03, -1.53201088e-02, 9.99597554e-01,
+	1.58101021e-02, -7.75743613e-03, 5.06432415e-03, -3.69671728e-03,
+	2.85832066e-03, -2.28538364e-03, 1.86542167e-03, -1.54245151e-03,
+	1.28550978e-03, -1.07608836e-03, 9.02432688e-04, -7.56695334e-04,
+	6.33406484e-04, -5.28602832e-04, 4.39307904e-04, -3.63210337e-04,
+	2.98458818e-04, -2.43528412e-04, 1.97131990e-04, -1.58160873e-04,
+	1.25644769e-04, -9.87246380e-05, 7.66342304e-05, -5.86874786e-05,
+	4.42697509e-05, -3.28316104e-05, 2.38841177e-05, -1.69950152e-05,
+	1.17853360e-05, -7.92614419e-06, 5.13522358e-06, -3.17362298e-06,
+	1.84202945e-06, -9.76986874e-07, 4.47009290e-07, -1.48657795e-07,
+	-6.47067573e-07, 1.42541315e-06, -2.69929506e-06, 4.66409032e-06,
+	-7.56287764e-06, 1.16922687e-05, -1.74080852e-05, 2.51308064e-05,
+	-3.53507581e-05, 4.86330834e-05, -6.56226297e-05, 8.70490166e-05,
+	-1.13732322e-04, 1.46590056e-04, -1.86646405e-04, 2.35045157e-04,
+	-2.93068346e-04, 3.62163498e-04, -4.43983718e-04, 5.40446834e-04,
+	-6.53823028e-04, 7.86865539e-04, -9.43007823e-04, 1.12666578e-03,
+	-1.34371143e-03, 1.60223712e-03, -1.91383437e-03, 2.29583492e-03,
+	-2.77547062e-03, 3.39817938e-03, -4.24583092e-03, 5.48212630e-03,
+	-7.48807919e-03, 1.13992045e-02, -2.27919563e-02, 9.99094634e-01,
+	2.38942229e-02, -1.16776153e-02, 7.61391125e-03, -5.55446062e-03,
+	4.29329778e-03, -3.43203025e-03, 2.80100527e-03, -2.31586977e-03,
+	1.93000200e-03, -1.61554898e-03, 1.35482871e-03, -1.13604081e-03,
+	9.50962804e-04, -7.93638580e-04, 6.59596270e-04, -5.45364147e-04,
+	4.48162130e-04, -3.65700726e-04, 2.96047818e-04, -2.37539392e-04,
+	1.88719303e-04, -1.48298452e-04, 1.15127038e-04, -8.81755938e-05,
+	6.65218387e-05, -4.93412965e-05, 3.59002413e-05, -2.55499682e-05,
+	1.77217073e-05, -1.19217353e-05, 7.72641286e-06, -4.77700723e-06,
+	2.77425647e-06, -1.47270195e-06, 6.74862066e-07, -2.25350562e-07,
+	-8.56075105e-07, 1.88885443e-06, -3.58008027e-06, 6.18960649e-06,
+	-1.00407834e-05, 1.55282284e-05, -2.31253919e-05, 3.33918187e-05,
+	-4.69800639e-05, 6.46423181e-05, -8.72369181e-05, 1.15735096e-04,
+	-1.51228546e-04, 1.94938698e-04, -2.48229004e-04, 3.12622115e-04,
+	-3.89824646e-04, 4.81763370e-04, -5.90638474e-04, 7.19002118e-04,
+	-8.69874828e-04, 1.04691911e-03, -1.25470127e-03, 1.49909273e-03,
+	-1.78789890e-03, 2.13187346e-03, -2.54641513e-03, 3.05454003e-03,
+	-3.69239610e-03, 4.52026664e-03, -5.64669504e-03, 7.28850852e-03,
+	-9.94963412e-03, 1.51280718e-02, -3.01360720e-02, 9.98390802e-01,
+	3.20951140e-02, -1.56227286e-02, 1.01731886e-02, -7.41701571e-03,
+	5.73102259e-03, -4.58040431e-03, 3.73775947e-03, -3.09013270e-03,
+	2.57513751e-03, -2.15552244e-03, 1.80764913e-03, -1.51574779e-03,
+	1.26883354e-03, -1.05895163e-03, 8.80131174e-04, -7.27737877e-04,
+	5.98061553e-04, -4.88047365e-04, 3.95117769e-04, -3.17053202e-04,
+	2.51911574e-04, -1.97973717e-04, 1.53706303e-04, -1.17736497e-04,
+	8.88343929e-05, -6.59004827e-05, 4.79562400e-05, -3.41364747e-05,
+	2.36825531e-05, -1.59358845e-05, 1.03313103e-05, -6.39020815e-06,
+	3.71325262e-06, -1.97286535e-06, 9.05453606e-07, -3.03573409e-07,
+	-1.06157375e-06, 2.34604468e-06, -4.45058079e-06, 7.69912486e-06,
+	-1.24948420e-05, 1.93298258e-05, -2.87945494e-05, 4.15869374e-05,
+	-5.85210066e-05, 8.05351416e-05, -1.08700226e-04, 1.44228067e-04,
+	-1.88480832e-04, 2.42982608e-04, -3.09434711e-04, 3.89737078e-04,
+	-4.86019098e-04, 6.00684693e-04, -7.36478608e-04, 8.96584237e-04,
+	-1.08476853e-03, 1.30559812e-03, -1.56476526e-03, 1.86958728e-03,
+	-2.22978916e-03, 2.65876530e-03, -3.17568981e-03, 3.80921150e-03,
+	-4.60430583e-03, 5.63593835e-03, -7.03899601e-03, 9.08267193e-03,
+	-1.23916855e-02, 1.88184018e-02, -3.73508351e-02, 9.97486313e-01,
+	4.04107478e-02, -1.95907090e-02, 1.27406942e-02, -9.28328944e-03,
+	7.17064137e-03, -5.72981980e-03, 4.67512272e-03, -3.86477518e-03,
+	3.22052821e-03, -2.69568361e-03, 2.26062111e-03, -1.89558737e-03,
+	1.58682704e-03, -1.32438199e-03, 1.10077962e-03, -9.10221552e-04,
+	7.48066709e-04, -6.10494581e-04, 4.94282146e-04, -3.96654408e-04,
+	3.15183540e-04, -2.47720551e-04, 1.92348839e-04, -1.47352440e-04,
+	1.11194034e-04, -8.24992551e-05, 6.00449102e-05, -4.27494169e-05,
+	2.96643322e-05, -1.99662173e-05, 1.29483838e-05, -8.01228484e-06,
+	4.65847711e-06, -2.47719515e-06, 1.13865952e-06, -3.83289594e-07,
+	-1.26346829e-06, 2.79675210e-06, -5.31033589e-06, 9.19182571e-06,
+	-1.49236978e-05, 2.30949346e-05, -3.44123568e-05, 4.97115013e-05,
+	-6.99669827e-05, 9.63024157e-05, -1.30000162e-04, 1.72511420e-04,
+	-2.25467528e-04, 2.90693790e-04, -3.70227782e-04, 4.66344920e-04,
+	-5.81595321e-04, 7.18857659e-04, -8.81418404e-04, 1.07308871e-03,
+	-1.29837760e-03, 1.56275018e-03, -1.87301707e-03, 2.23793108e-03,
+	-2.66912184e-03, 3.18260242e-03, -3.80128837e-03, 4.55940651e-03,
+	-5.51066656e-03, 6.74454567e-03, -8.42193160e-03, 1.08636003e-02,
+	-1.48128999e-02, 2.24683841e-02, -4.44346853e-02, 9.96381496e-01,
+	4.88390407e-02, -2.35794613e-02, 1.53149534e-02, -1.11521817e-02,
+	8.61129612e-03, -6.87958782e-03, 5.61253140e-03, -4.63933050e-03,
+	3.86578475e-03, -3.23570632e-03, 2.71347097e-03, -2.27532997e-03,
+	1.90475104e-03, -1.58976913e-03, 1.32140816e-03, -1.09270480e-03,
+	8.98086871e-04, -7.32968323e-04, 5.93480992e-04, -4.76294897e-04,
+	3.78496972e-04, -2.97508912e-04, 2.31031324e-04, -1.77005563e-04,
+	1.33587292e-04, -9.91276277e-05, 7.21589915e-05, -5.13836329e-05,
+	3.56634694e-05, -2.40103338e-05, 1.55760830e-05, -9.64228336e-06,
+	5.60938032e-06, -2.98540371e-06, 1.37435195e-06, -4.64460486e-07,
+	-1.46166732e-06, 3.24075164e-06, -6.15889583e-06, 1.06669064e-05,
+	-1.73260204e-05, 2.68214649e-05, -3.99756642e-05, 5.77609184e-05,
+	-8.13114809e-05, 1.11935123e-04, -1.51124487e-04, 2.00568844e-04,
+	-2.62167235e-04, 3.38044562e-04, -4.30572853e-04, 5.42400986e-04,
+	-6.76497493e-04, 8.36213140e-04, -1.02537296e-03, 1.24841204e-03,
+	-1.51057666e-03, 1.81822424e-03, -2.17927556e-03, 2.60390766e-03,
+	-3.10563881e-03, 3.70307728e-03, -4.42284404e-03, 5.30468622e-03,
+	-6.41094998e-03, 7.84544613e-03, -9.79470811e-03, 1.26302895e-02,
+	-1.72119632e-02, 2.60762436e-02, -5.13861226e-02, 9.95076752e-01,
+	5.73778544e-02, -2.75868627e-02, 1.78944793e-02, -1.30225861e-02,
+	1.00521250e-02, -8.02901697e-03, 6.54942015e-03, -5.41333065e-03,
+	4.51051679e-03, -3.77526362e-03, 3.16592436e-03, -2.65474543e-03,
+	2.22241275e-03, -1.85495212e-03, 1.54188295e-03, -1.27507691e-03,
+	1.04803102e-03, -8.55394287e-04, 6.92654127e-04, -5.55926360e-04,
+	4.41813475e-04, -3.47308615e-04, 2.69730317e-04, -2.06677909e-04,
+	1.56000617e-04, -1.15775549e-04, 8.42911705e-05, -6.00339193e-05,
+	4.16763578e-05, -2.80658100e-05, 1.82128399e-05, -1.12792373e-05,
+	6.56540407e-06, -3.49719779e-06, 1.61239965e-06, -5.47045573e-07,
+	-1.65608324e-06, 3.67782504e-06, -6.99582210e-06, 1.21235817e-05,
+	-1.97005054e-05, 3.05073641e-05, -4.54813737e-05, 6.57306678e-05,
+	-9.25480854e-05, 1.27424370e-04, -1.72061129e-04, 2.28384235e-04,
+	-2.98558814e-04, 3.85007563e-04, -4.90434965e-04, 6.17861108e-04,
+	-7.70670392e-04, 9.52682727e-04, -1.16825823e-03, 1.42245173e-03,
+	-1.72124154e-03, 2.07187070e-03, -2.48336133e-03, 2.96730258e-03,
+	-3.53908439e-03, 4.21988522e-03, -5.03999349e-03, 6.04461600e-03,
+	-7.30463303e-03, 8.93800395e-03, -1.11565408e-02, 1.43817481e-02,
+	-1.95875810e-02, 2.96402414e-02, -5.82037085e-02, 9.93572555e-01,
+	6.60249962e-02, -3.16107638e-02, 2.04777738e-02, -1.48933905e-02,
+	1.14922630e-02, -9.17741376e-03, 7.48522217e-03, -6.18630661e-03,
+	5.15433320e-03, -4.31402791e-03, 3.61770641e-03, -3.03360313e-03,
+	2.53961905e-03, -2.11976965e-03, 1.76206987e-03, -1.45722691e-03,
+	1.19780791e-03, -9.77697958e-04, 7.91741185e-04, -6.35500327e-04,
+	5.05094511e-04, -3.97089356e-04, 3.08422276e-04, -2.36351432e-04,
+	1.78420385e-04, -1.32432906e-04, 9.64340856e-05, -6.86950343e-05,
+	4.76993605e-05, -3.21301995e-05, 2.08570698e-05, -1.29221682e-05,
+	7.52598189e-06, -4.01227873e-06, 1.85266800e-06, -6.31002467e-07,
+	-1.84663226e-06, 4.10776097e-06, -7.82068761e-06, 1.35610842e-05,
+	-2.20458750e-05, 3.41506181e-05, -5.09264416e-05, 7.36163029e-05,
+	-1.03670479e-04, 1.42761397e-04, -1.92798182e-04, 2.55941707e-04,
+	-3.34621399e-04, 4.31555777e-04, -5.49779579e-04, 6.92681637e-04,
+	-8.64059425e-04, 1.06819877e-03, -1.30999110e-03, 1.59510639e-03,
+	-1.93024937e-03, 2.32354150e-03, -2.78509675e-03, 3.32790356e-03,
+	-3.96920541e-03, 4.73272463e-03, -5.65237707e-03, 6.77876569e-03,
+	-8.19119819e-03, 1.00215904e-02, -1.25066541e-02, 1.61169980e-02,
+	-2.19384794e-02, 3.31586751e-02, -6.48860658e-02, 9.91869452e-01,
+	7.47782199e-02, -3.56489895e-02, 2.30633285e-02, -1.67634775e-02,
+	1.29308421e-02, -1.03240831e-02, 8.41936962e-03, -6.95778862e-03,
+	5.79684230e-03, -4.85167120e-03, 4.06854191e-03, -3.41167217e-03,
+	2.85617652e-03, -2.38406020e-03, 1.98183457e-03, -1.63904363e-03,
+	1.34732609e-03, -1.09980465e-03, 8.90681649e-04, -7.14968191e-04,
+	5.68301423e-04, -4.46820723e-04, 3.47083562e-04, -2.66008007e-04,
+	2.00832906e-04, -1.49089534e-04, 1.08580331e-04, -7.73617008e-05,
+	5.37288131e-05, -3.62010346e-05, 2.35071719e-05, -1.45700861e-05,
+	8.49053935e-06, -4.53034256e-06, 2.09501910e-06, -7.16286917e-07,
+	-2.03323447e-06, 4.53035504e-06, -8.63307685e-06, 1.49786648e-05,
+	-2.43608787e-05, 3.77492523e-05, -5.63078794e-05, 8.14134528e-05,
+	-1.14672449e-04, 1.57937577e-04, -2.13323917e-04, 2.83225597e-04,
+	-3.70334410e-04, 4.77662544e-04, -6.08572598e-04, 7.66819468e-04,
+	-9.56610656e-04, 1.18269442e-03, -1.45048938e-03, 1.76627577e-03,
+	-2.13747865e-03, 2.57309018e-03, -3.08430615e-03, 3.68550059e-03,
+	-4.39575142e-03, 5.24129711e-03, -6.25963901e-03, 7.50670983e-03,
+	-9.07013377e-03, 1.10955843e-02, -1.38442826e-02, 1.78350745e-02,
+	-2.42634057e-02, 3.66298798e-02, -7.14318792e-02, 9.89968059e-01,
+	8.36352264e-02, -3.96993397e-02, 2.56496252e-02, -1.86317256e-02,
+	1.43669922e-02, -1.14683284e-02, 9.35129389e-03, -7.72730644e-03,
+	6.43765211e-03, -5.38786523e-03, 4.51815546e-03, -3.78872149e-03,
+	3.17189161e-03, -2.64766211e-03, 2.20104257e-03, -1.82041577e-03,
+	1.49649401e-03, -1.22163957e-03, 9.89414888e-04, -7.94281240e-04,
+	6.31395456e-04, -4.96472217e-04, 3.85690465e-04, -2.95629444e-04,
+	2.23224433e-04, -1.65735217e-04, 1.20722460e-04, -8.60286092e-05,
+	5.97610253e-05, -4.02758275e-05, 2.61615308e-05, -1.62219904e-05,
+	9.45849437e-06, -5.05108018e-06, 2.33931182e-06, -8.02852817e-07,
+	-2.21581379e-06, 4.94540990e-06, -9.43258608e-06, 1.63755927e-05,
+	-2.66442939e-05, 4.13013323e-05, -6.16227559e-05, 8.91178254e-05,
+	-1.25547885e-04, 1.72944423e-04, -2.33626788e-04, 3.10220478e-04,
+	-4.05677562e-04, 5.23301574e-04, -6.66780387e-04, 8.40232057e-04,
+	-1.04827084e-03, 1.29610365e-03, -1.58967190e-03, 1.93586081e-03,
+	-2.34280928e-03, 2.82037201e-03, -3.38081585e-03, 4.03988605e-03,
+	-4.81847483e-03, 5.74530767e-03, -6.86142759e-03, 8.22802794e-03,
+	-9.94093421e-03, 1.21593719e-02, -1.51686708e-02, 1.95350275e-02,
+	-2.65611285e-02, 4.00522286e-02, -7.78398956e-02, 9.87869068e-01,
+	9.25936650e-02, -4.37595907e-02, 2.82351367e-02, -2.04970090e-02,
+	1.57998412e-02, -1.26094526e-02, 1.02804260e-02, -8.49438967e-03,
+	7.07637057e-03, -5.92228176e-03, 4.96627165e-03, -4.16452001e-03,
+	3.48657072e-03, -2.91041367e-03, 2.41955933e-03, -2.00123196e-03,
+	1.64522002e-03, -1.34312782e-03, 1.08788019e-03, -8.73390686e-04,
+	6.94337783e-04, -5.46013274e-04, 4.24219209e-04, -3.25197497e-04,
+	2.45581172e-04, -1.82359699e-04, 1.32852992e-04, -9.46904210e-05,
+	6.57922837e-05, -4.43520725e-05, 2.88185171e-05, -1.78768700e-05,
+	1.04292575e-05, -5.57417752e-06, 2.58540184e-06, -8.90652223e-07,
+	-2.39429802e-06, 5.35273531e-06, -1.02188235e-05, 1.77511561e-05,
+	-2.88949264e-05, 4.48049655e-05, -6.68681983e-05, 9.67252092e-05,
+	-1.36290789e-04, 1.87773595e-04, -2.53695435e-04, 3.36911164e-04,
+	-4.40630878e-04, 5.68446965e-04, -7.24369788e-04, 9.12877456e-04,
+	-1.13898745e-03, 1.40836132e-03, -1.72745856e-03, 2.10376373e-03,
+	-2.54612271e-03, 3.06524402e-03, -3.67445430e-03, 4.39085482e-03,
+	-5.23713099e-03, 6.24446487e-03, -7.45739538e-03, 8.94230471e-03,
+	-1.08031004e-02, 1.32123480e-02, -1.64790739e-02, 2.12159214e-02,
+	-2.88304389e-02, 4.34241331e-02, -8.41089245e-02, 9.85573240e-01,
+	1.01651133e-01, -4.78274955e-02, 3.08183281e-02, -2.23581991e-02,
+	1.72285159e-02, -1.37467578e-02, 1.12061968e-02, -9.25856799e-03,
+	7.71260579e-03, -6.45459267e-03, 5.41261521e-03, -4.53883677e-03,
+	3.80002037e-03, -3.17215322e-03, 2.63725033e-03, -2.18138083e-03,
+	1.79341247e-03, -1.46419451e-03, 1.18601682e-03, -9.52247693e-04,
+	7.57089528e-04, -5.95413276e-04, 4.62645971e-04, -3.54693874e-04,
+	2.67889285e-04, -1.98952688e-04, 1.44964415e-04, -1.03341772e-04,
+	7.18188535e-05, -4.84272467e-05, 3.14764881e-05, -1.95337038e-05,
+	1.14022323e-05, -6.09931570e-06, 2.83314178e-06, -9.79635362e-07,
+	-2.56861882e-06, 5.75214819e-06, -1.09914094e-05, 1.91046623e-05,
+	-3.11116109e-05, 4.82583012e-05, -7.20413937e-05, 1.04231476e-04,
+	-1.46895272e-04, 2.02416899e-04, -2.73518696e-04, 3.63282721e-04,
+	-4.75174702e-04, 6.13073213e-04, -7.81308143e-04, 9.84714325e-04,
+	-1.22870872e-03, 1.51940319e-03, -1.86377032e-03, 2.26988804e-03,
+	-2.74730191e-03, 3.30756511e-03, -3.96505216e-03, 4.73820442e-03,
+	-5.65147842e-03, 6.73848098e-03, -8.04719944e-03, 9.64913027e-03,
+	-1.16561398e-02, 1.42539155e-02, -1.77747583e-02, 2.28768358e-02,
+	-3.10701509e-02, 4.67440441e-02, -9.02378380e-02, 9.83081408e-01,
+	1.10805180e-01, -5.19007855e-02, 3.33976569e-02, -2.42141646e-02,
+	1.86521423e-02, -1.48795463e-02, 1.21280376e-02, -1.00193715e-02,
+	8.34596627e-03, -6.98447024e-03, 5.85691119e-03, -4.91144106e-03,
+	4.11204724e-03, -3.43271925e-03, 2.85398117e-03, -2.36075108e-03,
+	1.94097975e-03, -1.58476473e-03, 1.28376401e-03, -1.03080341e-03,
+	8.19611788e-04, -6.44641575e-04, 5.00946894e-04, -3.84100250e-04,
+	2.90134903e-04, -2.15503860e-04, 1.57049190e-04, -1.11977274e-04,
+	7.78369809e-05, -5.24988119e-05, 3.41337891e-05, -2.11914620e-05,
+	1.23768156e-05, -6.62617117e-06, 3.08238119e-06, -1.06975066e-06,
+	-2.73871174e-06, 6.14347265e-06, -1.17499762e-05, 2.04354381e-05,
+	-3.32932117e-05, 5.16595322e-05, -7.71395908e-05, 1.11632581e-04,
+	-1.57355564e-04, 2.16866295e-04, -2.93085606e-04, 3.89320471e-04,
+	-5.09289704e-04, 6.57155231e-04, -8.37563308e-04, 1.05570196e-03,
+	-1.31738365e-03, 1.62916597e-03, -1.99852930e-03, 2.43413864e-03,
+	-2.94623151e-03, 3.54719613e-03, -4.25244241e-03, 5.08173513e-03,
+	-6.06127887e-03, 7.22707219e-03, -8.63050148e-03, 1.03481004e-02,
+	-1.24995669e-02, 1.52834863e-02, -1.90550015e-02, 2.45168660e-02,
+	-3.32791016e-02, 5.00104520e-02, -9.62255713e-02, 9.80394476e-01,
+	1.20053302e-01, -5.59771710e-02, 3.59715745e-02, -2.60637722e-02,
+	2.00698460e-02, -1.60071208e-02, 1.30453801e-02, -1.07763309e-02,
+	8.97606116e-03, -7.51158731e-03, 6.29888514e-03, -5.28210258e-03,
+	4.42245838e-03, -3.69195053e-03, 3.06961763e-03, -2.53923156e-03,
+	2.08783035e-03, -1.70476366e-03, 1.38106104e-03, -1.10900900e-03,
+	8.81865656e-04, -6.93667512e-04, 5.39098101e-04, -4.13398275e-04,
+	3.12304133e-04, -2.32002870e-04, 1.69099757e-04, -1.20591521e-04,
+	8.38428951e-05, -5.65642158e-05, 3.67887542e-05, -2.28491058e-05,
+	1.33523979e-05, -7.15441594e-06, 3.33296669e-06, -1.16094473e-06,
+	-2.90451620e-06, 6.52654008e-06, -1.24941687e-05, 2.17428298e-05,
+	-3.54386232e-05, 5.50068952e-05, -8.21601006e-05, 1.18924569e-04,
+	-1.67666009e-04, 2.31113902e-04, -3.12385410e-04, 4.15010007e-04,
+	-5.42956896e-04, 7.00668358e-04, -8.93103676e-04, 1.12580033e-03,
+	-1.40496204e-03, 1.73758736e-03, -2.13165881e-03, 2.59642183e-03,
+	-3.14279784e-03, 3.78399994e-03, -4.53646042e-03, 5.42125006e-03,
+	-6.46629751e-03, 7.70995873e-03, -9.20696807e-03, 1.10388168e-02,
+	-1.33329036e-02, 1.63004811e-02, -2.03190931e-02, 2.61351236e-02,
+	-3.54561522e-02, 5.32218873e-02, -1.02071123e-01, 9.77513416e-01,
+	1.29392949e-01, -6.00543424e-02, 3.85385265e-02, -2.79058875e-02,
+	2.14807531e-02, -1.71287848e-02, 1.39576573e-02, -1.15289780e-02,
+	9.60250047e-03, -8.03561748e-03, 6.73826323e-03, -5.65059157e-03,
+	4.73106124e-03, -3.94968615e-03, 3.28402579e-03, -2.71671131e-03,
+	2.23387288e-03, -1.82411655e-03, 1.47784727e-03, -1.18681566e-03,
+	9.43812250e-04, -7.42460432e-04, 5.77075712e-04, -4.42569590e-04,
+	3.34383067e-04, -2.48439355e-04, 1.81108537e-04, -1.29179089e-04,
+	8.98328112e-05, -6.06208939e-05, 3.94397076e-05, -2.45055886e-05,
+	1.43283638e-05, -7.68371771e-06, 3.58474201e-06, -1.25316245e-06,
+	-3.06597549e-06, 6.90118914e-06, -1.32236443e-05, 2.30262040e-05,
+	-3.75467702e-05, 5.82986718e-05, -8.71002985e-05, 1.26103572e-04,
+	-1.77821075e-04, 2.45151999e-04, -3.31407562e-04, 4.40337191e-04,
+	-5.76157638e-04, 7.43588375e-04, -9.47898187e-04, 1.19497007e-03,
+	-1.49139454e-03, 1.84460605e-03, -2.26308338e-03, 2.75664541e-03,
+	-3.33688899e-03, 4.01784153e-03, -4.81694407e-03, 5.75655530e-03,
+	-6.86630301e-03, 8.18686503e-03, -9.77627082e-03, 1.17208872e-02,
+	-1.41556790e-02, 1.73043302e-02, -2.15663347e-02, 2.77307365e-02,
+	-3.76001884e-02, 5.63769216e-02, -1.07773555e-01, 9.74439275e-01,
+	1.38821525e-01, -6.41299710e-02, 4.10969538e-02, -2.97393755e-02,
+	2.28839903e-02, -1.82438428e-02, 1.48643031e-02, -1.22768456e-02,
+	1.02248953e-02, -8.55623533e-03, 7.17477249e-03, -6.01667895e-03,
+	5.03766385e-03, -4.20576566e-03, 3.49707203e-03, -2.89307966e-03,
+	2.37901619e-03, -1.94274884e-03, 1.57406216e-03, -1.26417467e-03,
+	1.00541273e-03, -7.90989705e-04, 6.14855854e-04, -4.71595835e-04,
+	3.56357788e-04, -2.64802941e-04, 1.93067941e-04, -1.37734542e-04,
+	9.58029316e-05, -6.46662707e-05, 4.20849641e-05, -2.61598564e-05,
+	1.53040920e-05, -8.21374007e-06, 3.83754808e-06, -1.34634691e-06,
+	-3.22303678e-06, 7.26726583e-06, -1.39380729e-05, 2.42849473e-05,
+	-3.96166085e-05, 6.15331894e-05, -9.19576251e-05, 1.33165813e-04,
+	-1.87815353e-04, 2.58973030e-04, -3.50141735e-04, 4.65288171e-04,
+	-6.08873653e-04, 7.85891519e-04, -1.00191635e-03, 1.26317251e-03,
+	-1.57663267e-03, 1.95016180e-03, -2.39272880e-03, 2.91471868e-03,
+	-3.52839486e-03, 4.24858804e-03, -5.09373382e-03, 6.08746002e-03,
+	-7.26106774e-03, 8.65751989e-03, -1.03380866e-02, 1.23939257e-02,
+	-1.49674300e-02, 1.82944738e-02, -2.27960406e-02, 2.93028498e-02,
+	-3.97101207e-02, 5.94741672e-02, -1.13331992e-01, 9.71173164e-01,
+	1.48336384e-01, -6.82017104e-02, 4.36452937e-02, -3.15631011e-02,
+	2.42786856e-02, -1.93516012e-02, 1.57647534e-02, -1.30194683e-02,
+	1.08428582e-02, -9.07311658e-03, 7.60814090e-03, -6.38013648e-03,
+	5.34207491e-03, -4.46002915e-03, 3.70862323e-03, -3.06822626e-03,
+	2.52316939e-03, -2.06058614e-03, 1.66964530e-03, -1.34103740e-03,
+	1.06662833e-03, -8.39224745e-04, 6.52414682e-04, -5.00458659e-04,
+	3.78214383e-04, -2.81083247e-04, 2.04970368e-04, -1.46252435e-04,
+	1.01749449e-04, -6.86977615e-05, 4.47228302e-05, -2.78108484e-05,
+	1.62789560e-05, -8.74414271e-06, 4.09122313e-06, -1.44043951e-06,
+	-3.37565110e-06, 7.62462354e-06, -1.46371371e-05, 2.55184669e-05,
+	-4.16471254e-05, 6.47088216e-05, -9.67295872e-05, 1.40107609e-04,
+	-1.97643560e-04, 2.72569611e-04, -3.68577825e-04, 4.89849381e-04,
+	-6.41087031e-04, 8.27554493e-04, -1.05512826e-03, 1.33036973e-03,
+	-1.66062881e-03, 2.05419545e-03, -2.52052218e-03, 3.07055253e-03,
+	-3.71720726e-03, 4.47610888e-03, -5.36667283e-03, 6.41377656e-03,
+	-7.65036780e-03, 9.12165661e-03, -1.08920976e-02, 1.30575530e-02,
+	-1.57677018e-02, 1.92703616e-02, -2.40075379e-02, 3.08506262e-02,
+	-4.17848850e-02, 6.25122782e-02, -1.18745623e-01, 9.67716268e-01,
+	1.57934836e-01, -7.22671972e-02, 4.61819803e-02, -3.33759302e-02,
+	2.56639690e-02, -2.04513685e-02, 1.66584459e-02, -1.37563823e-02,
+	1.14560032e-02, -9.58593834e-03, 8.03809762e-03, -6.74073684e-03,
+	5.64410391e-03, -4.71231737e-03, 3.91854674e-03, -3.24204121e-03,
+	2.66624189e-03, -2.17755432e-03, 1.76453649e-03, -1.41735537e-03,
+	1.12742037e-03, -8.87135028e-04, 6.89728389e-04, -5.29139735e-04,
+	3.99938946e-04, -2.97269898e-04, 2.16808216e-04, -1.54727314e-04,
+	1.07668548e-04, -7.27127736e-05, 4.73516056e-05, -2.94574978e-05,
+	1.72523246e-05, -9.27458157e-06, 4.34560273e-06, -1.53537992e-06,
+	-3.52377331e-06, 7.97312300e-06, -1.53205322e-05, 2.67261906e-05,
+	-4.36373400e-05, 6.78239894e-05, -1.01413760e-04, 1.46925369e-04,
+	-2.07300543e-04, 2.85934528e-04, -3.86705956e-04, 5.14007554e-04,
+	-6.72780242e-04, 8.68554479e-04, -1.10750462e-03, 1.39652453e-03,
+	-1.74333628e-03, 2.15664895e-03, -2.64639197e-03, 3.22405947e-03,
+	-3.90321993e-03, 4.70027577e-03, -5.63560701e-03, 6.73532057e-03,
+	-8.03398326e-03, 9.57901318e-03, -1.14379918e-02, 1.37113964e-02,
+	-1.65560476e-02, 2.02314542e-02, -2.52001669e-02, 3.23732459e-02,
+	-4.38234433e-02, 6.54899509e-02, -1.24013702e-01, 9.64069837e-01,
+	1.67614147e-01, -7.63240522e-02, 4.87054455e-02, -3.51767298e-02,
+	2.70389727e-02, -2.15424554e-02, 1.75448206e-02, -1.44871260e-02,
+	1.20639461e-02, -1.00943793e-02, 8.46437311e-03, -7.09825387e-03,
+	5.94356127e-03, -4.96247180e-03, 4.12671053e-03, -3.41441504e-03,
+	2.80814350e-03, -2.29357954e-03, 1.85867573e-03, -1.49308025e-03,
+	1.18775028e-03, -9.34690112e-04, 7.26773220e-04, -5.57620770e-04,
+	4.21517593e-04, -3.13352523e-04, 2.28573886e-04, -1.63153726e-04,
+	1.13556409e-04, -7.67087084e-05, 4.99695836e-05, -3.10987321e-05,
+	1.82235618e-05, -9.80470906e-06, 4.60051993e-06, -1.63110614e-06,
+	-3.66736214e-06, 8.31263237e-06, -1.59879666e-05, 2.79075673e-05,
+	-4.55863037e-05, 7.08771615e-05, -1.06007786e-04, 1.53615601e-04,
+	-2.16781280e-04, 2.99060747e-04, -4.04516484e-04, 5.37749723e-04,
+	-7.03936145e-04, 9.08869153e-04, -1.15901673e-03, 1.46160049e-03,
+	-1.82470933e-03, 2.25746539e-03, -2.77026804e-03, 3.37515370e-03,
+	-4.08632864e-03, 4.92096282e-03, -5.90038511e-03, 7.05191108e-03,
+	-8.41169819e-03, 1.00293324e-02, -1.19754627e-02, 1.43550904e-02,
+	-1.73320291e-02, 2.11772223e-02, -2.63732818e-02, 3.38699078e-02,
+	-4.58247838e-02, 6.84059240e-02, -1.29135545e-01, 9.60235192e-01,
+	1.77371538e-01, -8.03698815e-02, 5.12141200e-02, -3.69643693e-02,
+	2.84028318e-02, -2.26241758e-02, 1.84233204e-02, -1.52112401e-02,
+	1.26663050e-02, -1.05981198e-02, 8.88669933e-03, -7.45246260e-03,
+	6.24025841e-03, -5.21033478e-03, 4.33298325e-03, -3.58523886e-03,
+	2.94878444e-03, -2.40858829e-03, 1.95200328e-03, -1.56816391e-03,
+	1.24757967e-03, -9.81859655e-04, 7.63525491e-04, -5.85883514e-04,
+	4.42936464e-04, -3.29320770e-04, 2.40259781e-04, -1.71526213e-04,
+	1.19409209e-04, -8.06829626e-05, 5.25750526e-05, -3.27334742e-05,
+	1.91920274e-05, -1.03341743e-05, 4.85580531e-06, -1.72755454e-06,
+	-3.80638010e-06, 8.64302724e-06, -1.66391614e-05, 2.90620667e-05,
+	-4.74931003e-05, 7.38668551e-05, -1.10509379e-04, 1.60174909e-04,
+	-2.26080884e-04, 3.11941410e-04, -4.22000005e-04, 5.61063233e-04,
+	-7.34537995e-04, 9.48476692e-04, -1.20963653e-03, 1.52556196e-03,
+	-1.90470316e-03, 2.35658906e-03, -2.89208165e-03, 3.52375111e-03,
+	-4.26643120e-03, 5.13804664e-03, -6.16085884e-03, 7.36337061e-03,
+	-8.78330081e-03, 1.04723619e-02, -1.25042098e-02, 1.49882763e-02,
+	-1.80952168e-02, 2.21071478e-02, -2.75262504e-02, 3.53398292e-02,
+	-4.77879217e-02, 7.12589789e-02, -1.34110533e-01, 9.56213717e-01,
+	1.87204188e-01, -8.44022775e-02, 5.37064341e-02, -3.87377205e-02,
+	2.97546848e-02, -2.36958467e-02, 1.92933910e-02, -1.59282681e-02,
+	1.32627000e-02, -1.10968422e-02, 9.30480989e-03, -7.80313949e-03,
+	6.53400792e-03, -5.45574957e-03, 4.53723432e-03, -3.75440439e-03,
+	3.08807543e-03, -2.52250743e-03, 2.04445970e-03, -1.64255843e-03,
+	1.30687026e-03, -1.02861343e-03, 7.99961601e-04, -6.13909774e-04,
+	4.64181737e-04, -3.45164304e-04, 2.51858317e-04, -1.79839327e-04,
+	1.25223123e-04, -8.46329300e-05, 5.51662969e-05, -3.43606426e-05,
+	2.01570775e-05, -1.08626232e-05, 5.11128712e-06, -1.82465986e-06,
+	-3.94079354e-06, 8.96419062e-06, -1.72738509e-05, 3.01891801e-05,
+	-4.93568470e-05, 7.67916364e-05, -1.14916322e-04, 1.66599998e-04,
+	-2.35194603e-04, 3.24569846e-04, -4.39147356e-04, 5.83935743e-04,
+	-7.64569454e-04, 9.87355790e-04, -1.25933662e-03, 1.58837411e-03,
+	-1.98327400e-03, 2.45396544e-03, -3.01176554e-03, 3.66976938e-03,
+	-4.44342754e-03, 5.35140632e-03, -6.41688292e-03, 7.66952526e-03,
+	-9.14858363e-03, 1.09078546e-02, -1.30239388e-02, 1.56106030e-02,
+	-1.88451902e-02, 2.30207237e-02, -2.86584550e-02, 3.67822466e-02,
+	-4.97118992e-02, 7.40479404e-02, -1.38938110e-01, 9.52006869e-01,
+	1.97109235e-01, -8.84188201e-02, 5.61808187e-02, -4.04956588e-02,
+	3.10936741e-02, -2.47567890e-02, 2.01544815e-02, -1.66377562e-02,
+	1.38527540e-02, -1.15902312e-02, 9.71844023e-03, -8.15006248e-03,
+	6.82462364e-03, -5.69856049e-03, 4.73933400e-03, -3.92180401e-03,
+	3.22592772e-03, -2.63526427e-03, 2.13598587e-03, -1.71621615e-03,
+	1.36558399e-03, -1.07492137e-03, 8.36058049e-04, -6.41681425e-04,
+	4.85239633e-04, -3.60872819e-04, 2.63361925e-04, -1.88087621e-04,
+	1.30994330e-04, -8.85560029e-05, 5.77415978e-05, -3.59791525e-05,
+	2.11180648e-05, -1.13896988e-05, 5.36679132e-06, -1.92235525e-06,
+	-4.07057257e-06, 9.27601294e-06, -1.78917824e-05, 3.12884198e-05,
+	-5.11766938e-05, 7.96501215e-05, -1.19226473e-04, 1.72887671e-04,
+	-2.44117824e-04, 3.36939571e-04, -4.55949622e-04, 6.06355236e-04,
+	-7.94014598e-04, 1.02548567e-03, -1.30809023e-03, 1.65000292e-03,
+	-2.06037903e-03, 2.54954124e-03, -3.12925395e-03, 3.81312800e-03,
+	-4.61721977e-03, 5.56092360e-03, -6.66831515e-03, 7.97020483e-03,
+	-9.50734352e-03, 1.13355685e-02, -1.35343616e-02, 1.62217269e-02,
+	-1.95815380e-02, 2.39174543e-02, -2.97692924e-02, 3.81964157e-02,
+	-5.15957863e-02, 7.67716768e-02, -1.43617785e-01, 9.47616166e-01,
+	2.07083775e-01, -9.24170776e-02, 5.86357058e-02, -4.22370635e-02,
+	3.24189465e-02, -2.58063277e-02, 2.10060449e-02, -1.73392541e-02,
+	1.44360924e-02, -1.20779736e-02, 1.01273278e-02, -8.49301120e-03,
+	7.11192080e-03, -5.93861297e-03, 4.93915349e-03, -4.08733088e-03,
+	3.36225319e-03, -2.74678659e-03, 2.22652306e-03, -1.78908970e-03,
+	1.42368302e-03, -1.12075352e-03, 8.71791444e-04, -6.69180422e-04,
+	5.06096428e-04, -3.76436044e-04, 2.74763056e-04, -1.96265664e-04,
+	1.36719012e-04, -9.24495740e-05, 6.02992348e-05, -3.75879161e-05,
+	2.20743390e-05, -1.19150414e-05, 5.62214172e-06, -2.02057233e-06,
+	-4.19569106e-06, 9.57839207e-06, -1.84927165e-05, 3.23593201e-05,
+	-5.29518247e-05, 8.24409766e-05, -1.23437758e-04, 1.79034838e-04,
+	-2.52846077e-04, 3.49044287e-04, -4.72398139e-04, 6.28310021e-04,
+	-8.22857924e-04, 1.06284608e-03, -1.35587130e-03, 1.71041520e-03,
+	-2.13597653e-03, 2.64326446e-03, -3.24448266e-03, 3.95374831e-03,
+	-4.78771224e-03, 5.76648284e-03, -6.91501653e-03, 8.26524290e-03,
+	-9.85938186e-03, 1.17552671e-02, -1.40351963e-02, 1.68213121e-02,
+	-2.03038583e-02, 2.47968557e-02, -3.08581743e-02, 3.95816122e-02,
+	-5.34386811e-02, 7.94291002e-02, -1.48149129e-01, 9.43043193e-01,
+	2.17124865e-01, -9.63946080e-02, 6.10695299e-02, -4.39608189e-02,
+	3.37296539e-02, -2.68437924e-02, 2.18475381e-02, -1.80323149e-02,
+	1.50123439e-02, -1.25597588e-02, 1.05312120e-02, -8.83176708e-03,
+	7.39571611e-03, -6.17575371e-03, 5.13656497e-03, -4.25087895e-03,
+	3.49696434e-03, -2.85700267e-03, 2.31601292e-03, -1.86113201e-03,
+	1.48112973e-03, -1.16608016e-03, 9.07138525e-04, -6.96388809e-04,
+	5.26738460e-04, -3.91843748e-04, 2.86054187e-04, -2.04368035e-04,
+	1.42393357e-04, -9.63110380e-05, 6.28374866e-05, -3.91858435e-05,
+	2.30252472e-05, -1.24382890e-05, 5.87716008e-06, -2.11924119e-06,
+	-4.31612660e-06, 9.87123332e-06, -1.90764267e-05, 3.34014368e-05,
+	-5.46814573e-05, 8.51629186e-05, -1.27548180e-04, 1.85038508e-04,
+	-2.61375031e-04, 3.60877893e-04, -4.88484499e-04, 6.49788742e-04,
+	-8.51084361e-04, 1.09941732e-03, -1.40265444e-03, 1.76957864e-03,
+	-2.21002579e-03, 2.73508436e-03, -3.35738903e-03, 4.09155354e-03,
+	-4.95481155e-03, 5.96797115e-03, -7.15685128e-03, 8.55447689e-03,
+	-1.02045046e-02, 1.21667191e-02, -1.45261679e-02, 1.74090306e-02,
+	-2.10117587e-02, 2.56584558e-02, -3.19245276e-02, 4.09371319e-02,
+	-5.52397099e-02, 8.20191670e-02, -1.52531779e-01, 9.38289603e-01,
+	2.27229526e-01, -1.00348960e-01, 6.34807287e-02, -4.56658145e-02,
+	3.50249536e-02, -2.78685176e-02, 2.26784222e-02, -1.87164953e-02,
+	1.55811402e-02, -1.30352791e-02, 1.09298349e-02, -9.16611346e-03,
+	7.67582791e-03, -6.40983070e-03, 5.33144174e-03, -4.41234308e-03,
+	3.62997440e-03, -2.96584137e-03, 2.40439756e-03, -1.93229637e-03,
+	1.53788676e-03, -1.21087171e-03, 9.42076175e-04, -7.23288732e-04,
+	5.47152135e-04, -4.07085746e-04, 2.97227823e-04, -2.12389332e-04,
+	1.48013564e-04, -1.00137793e-04, 6.53546322e-05, -4.07718432e-05,
+	2.39701341e-05, -1.29590771e-05, 6.13166617e-06, -2.21829044e-06,
+	-4.43186049e-06, 1.01544494e-05, -1.96427000e-05, 3.44143474e-05,
+	-5.63648435e-05, 8.78147159e-05, -1.31555816e-04, 1.90895798e-04,
+	-2.69700503e-04, 3.72434481e-04, -5.04200555e-04, 6.70780384e-04,
+	-8.78679273e-04, 1.13518026e-03, -1.44841495e-03, 1.82746179e-03,
+	-2.28248719e-03, 2.82495156e-03, -3.46791199e-03, 4.22646886e-03,
+	-5.11842665e-03, 6.16527841e-03, -7.39368697e-03, 8.83774821e-03,
+	-1.05425225e-02, 1.25696991e-02, -1.50070078e-02, 1.79845625e-02,
+	-2.17048567e-02, 2.65017949e-02, -3.29677946e-02, 4.22622910e-02,
+	-5.69980280e-02, 8.45408780e-02, -1.56765434e-01, 9.33357108e-01,
+	2.37394739e-01, -1.04277675e-01, 6.58677435e-02, -4.73509458e-02,
+	3.63040088e-02, -2.88798433e-02, 2.34981634e-02, -1.93913563e-02,
+	1.61421166e-02, -1.35042294e-02, 1.13229408e-02, -9.49583579e-03,
+	7.95207626e-03, -6.64069338e-03, 5.52365825e-03, -4.57161906e-03,
+	3.76119736e-03, -3.07323216e-03, 2.49161956e-03, -2.00253642e-03,
+	1.59391705e-03, -1.25509884e-03, 9.76581431e-04, -7.49862453e-04,
+	5.67323941e-04, -4.22151907e-04, 3.08276505e-04, -2.20324175e-04,
+	1.53575843e-04, -1.03927242e-04, 6.78489517e-05, -4.23448231e-05,
+	2.49083429e-05, -1.34770392e-05, 6.38547795e-06, -2.31764726e-06,
+	-4.54287770e-06, 1.04279604e-05, -2.01913363e-05, 3.53976516e-05,
+	-5.80012695e-05, 9.03951881e-05, -1.35458817e-04, 1.96603929e-04,
+	-2.77818456e-04, 3.83708343e-04, -5.19538421e-04, 6.91274275e-04,
+	-9.05628471e-04, 1.17011632e-03, -1.49312886e-03, 1.88403407e-03,
+	-2.35332222e-03, 2.91281798e-03, -3.57599215e-03, 4.35842142e-03,
+	-5.27846886e-03, 6.35829736e-03, -7.62539454e-03, 9.11490227e-03,
+	-1.08732509e-02, 1.29639872e-02, -1.54774545e-02, 1.85475961e-02,
+	-2.23827801e-02, 2.73264255e-02, -3.39874335e-02, 4.35564265e-02,
+	-5.87128197e-02, 8.69932784e-02, -1.60849858e-01, 9.28247488e-01,
+	2.47617450e-01, -1.08178285e-01, 6.82290210e-02, -4.90151154e-02,
+	3.75659893e-02, -2.98771154e-02, 2.43062326e-02, -2.00564631e-02,
+	1.66949120e-02, -1.39663082e-02, 1.17102767e-02, -9.82072169e-03,
+	8.22428304e-03, -6.86819272e-03, 5.71309020e-03, -4.72860370e-03,
+	3.89054802e-03, -3.17910516e-03, 2.57762202e-03, -2.07180621e-03,
+	1.64918384e-03, -1.29873243e-03, 1.01063151e-03, -7.76092354e-04,
+	5.87240452e-04, -4.37032162e-04, 3.19192813e-04, -2.28167207e-04,
+	1.59076415e-04, -1.07676797e-04, 7.03187279e-05, -4.39036908e-05,
+	2.58392152e-05, -1.39918071e-05, 6.63841163e-06, -2.41723741e-06,
+	-4.64916683e-06, 1.06916938e-05, -2.07221491e-05, 3.63509709e-05,
+	-5.95900561e-05, 9.29032073e-05, -1.39255410e-04, 2.02160232e-04,
+	-2.85724999e-04, 3.94693971e-04, -5.34490480e-04, 7.11260092e-04,
+	-9.31918216e-04, 1.20420751e-03, -1.53677292e-03, 1.93926584e-03,
+	-2.42249348e-03, 2.99863695e-03, -3.68157175e-03, 4.48734039e-03,
+	-5.43485192e-03, 6.54692363e-03, -7.85184840e-03, 9.38578864e-03,
+	-1.11965103e-02, 1.33493697e-02, -1.59372534e-02, 1.90978280e-02,
+	-2.30451664e-02, 2.81319128e-02, -3.49829183e-02, 4.48188963e-02,
+	-6.03832986e-02, 8.93754587e-02, -1.64784876e-01, 9.22962582e-01,
+	2.57894571e-01, -1.12048320e-01, 7.05630135e-02, -5.06572330e-02,
+	3.88100719e-02, -3.08596857e-02, 2.51021063e-02, -2.07113857e-02,
+	1.72391692e-02, -1.44212169e-02, 1.20915923e-02, -1.01405612e-02,
+	8.49227210e-03, -7.09218127e-03, 5.89961464e-03, -4.88319490e-03,
+	4.01794207e-03, -3.28339117e-03, 2.66234860e-03, -2.14006023e-03,
+	1.70365069e-03, -1.34174363e-03, 1.04420380e-03, -8.01960959e-04,
+	6.06888341e-04, -4.51716506e-04, 3.29969370e-04, -2.35913098e-04,
+	1.64511522e-04, -1.11383874e-04, 7.27622473e-05, -4.54473546e-05,
+	2.67620917e-05, -1.45030110e-05, 6.89028179e-06, -2.51698532e-06,
+	-4.75072007e-06, 1.09455844e-05, -2.12349648e-05, 3.72739488e-05,
+	-6.11305587e-05, 9.53376979e-05, -1.42943899e-04, 2.07562144e-04,
+	-2.93416395e-04, 4.05386060e-04, -5.49049385e-04, 7.30727868e-04,
+	-9.57535228e-04, 1.23743639e-03, -1.57932462e-03, 1.99312835e-03,
+	-2.48996469e-03, 3.08236316e-03, -3.78459474e-03, 4.61315699e-03,
+	-5.58749204e-03, 6.73105581e-03, -8.07292650e-03, 9.65026106e-03,
+	-1.15121261e-02, 1.37256383e-02, -1.63861569e-02, 1.96349637e-02,
+	-2.36916641e-02, 2.89178349e-02, -3.59537393e-02, 4.60490800e-02,
+	-6.20087083e-02, 9.16865542e-02, -1.68570378e-01, 9.17504294e-01,
+	2.68222979e-01, -1.15885303e-01, 7.28681802e-02, -5.22762164e-02,
+	4.00354411e-02, -3.18269130e-02, 2.58852668e-02, -2.13556987e-02,
+	1.77745353e-02, -1.48686606e-02, 1.24666404e-02, -1.04551466e-02,
+	8.75586936e-03, -7.31251332e-03, 6.08310999e-03, -5.03529170e-03,
+	4.14329611e-03, -3.38602177e-03, 2.74574353e-03, -2.20725343e-03,
+	1.75728154e-03, -1.38410386e-03, 1.07727591e-03, -8.27450933e-04,
+	6.26254383e-04, -4.66195008e-04, 3.40598850e-04, -2.43556552e-04,
+	1.69877421e-04, -1.15045905e-04, 7.51778008e-05, -4.69747242e-05,
+	2.76763127e-05, -1.50102795e-05, 7.14090149e-06, -2.61681408e-06,
+	-4.84753319e-06, 1.11895744e-05, -2.17296233e-05, 3.81662511e-05,
+	-6.26221680e-05, 9.76976370e-05, -1.46522665e-04, 2.12807212e-04,
+	-3.00889054e-04, 4.15779511e-04, -5.63208063e-04, 7.49667996e-04,
+	-9.82466691e-04, 1.26978617e-03, -1.62076218e-03, 2.04559381e-03,
+	-2.55570075e-03, 3.16395274e-03, -3.88500680e-03, 4.73580451e-03,
+	-5.73630794e-03, 6.91059550e-03, -8.28851035e-03, 9.90817757e-03,
+	-1.18199288e-02, 1.40925913e-02, -1.68239248e-02, 2.01587171e-02,
+	-2.43219317e-02, 2.96837829e-02, -3.68994036e-02, 4.72463784e-02,
+	-6.35883221e-02, 9.39257456e-02, -1.72206317e-01, 9.11874588e-01,
+	2.78599520e-01, -1.19686752e-01, 7.51429875e-02, -5.38709923e-02,
+	4.12412892e-02, -3.27781629e-02, 2.66552021e-02, -2.19889821e-02,
+	1.83006617e-02, -1.53083481e-02, 1.28351768e-02, -1.07642732e-02,
+	9.01490291e-03, -7.52904497e-03, 6.26345618e-03, -5.18479436e-03,
+	4.26652775e-03, -3.48692930e-03, 2.82775169e-03, -2.27334123e-03,
+	1.81004069e-03, -1.42578481e-03, 1.10982565e-03, -8.52545106e-04,
+	6.45325471e-04, -4.80457817e-04, 3.51073979e-04, -2.51092306e-04,
+	1.75170392e-04, -1.18660330e-04, 7.75636853e-05, -4.84847111e-05,
+	2.85812182e-05, -1.55132405e-05, 7.39008242e-06, -2.71664552e-06,
+	-4.93960546e-06, 1.14236132e-05, -2.22059777e-05, 3.90275658e-05,
+	-6.40643092e-05, 9.99820549e-05, -1.49990166e-04, 2.17893094e-04,
+	-3.08139542e-04, 4.25869432e-04, -5.76959718e-04, 7.68071229e-04,
+	-1.00670026e-03, 1.30124060e-03, -1.66106460e-03, 2.09663535e-03,
+	-2.61966771e-03, 3.24336324e-03, -3.98275536e-03, 4.85521839e-03,
+	-5.88122089e-03, 7.08544734e-03, -8.49848515e-03, 1.01594005e-02,
+	-1.21197539e-02, 1.44500329e-02, -1.72503242e-02, 2.06688111e-02,
+	-2.49356390e-02, 3.04293613e-02, -3.78194346e-02, 4.84102146e-02,
+	-6.51214439e-02, 9.60922588e-02, -1.75692708e-01, 9.06075487e-01,
+	2.89021008e-01, -1.23450186e-01, 7.73859110e-02, -5.54404967e-02,
+	4.24268173e-02, -3.37128086e-02, 2.74114068e-02, -2.26108212e-02,
+	1.88172043e-02, -1.57399921e-02, 1.31969607e-02, -1.10677387e-02,
+	9.26920312e-03, -7.74163418e-03, 6.44053470e-03, -5.33160440e-03,
+	4.38755561e-03, -3.58604695e-03, 2.90831859e-03, -2.33827960e-03,
+	1.86189284e-03, -1.46675849e-03, 1.14183107e-03, -8.77226472e-04,
+	6.64088617e-04, -4.94495167e-04, 3.61387542e-04, -2.58515134e-04,
+	1.80386739e-04, -1.22224603e-04, 7.99182045e-05, -4.99762298e-05,
+	2.94761486e-05, -1.60115208e-05, 7.63763497e-06, -2.81640024e-06,
+	-5.02693963e-06, 1.16476575e-05, -2.26638942e-05, 3.98576029e-05,
+	-6.54564433e-05, 1.02190035e-04, -1.53344938e-04, 2.22817558e-04,
+	-3.15164579e-04, 4.35651144e-04, -5.90297834e-04, 7.85928692e-04,
+	-1.03022406e-03, 1.33178409e-03, -1.70021164e-03, 2.14622707e-03,
+	-2.68183284e-03, 3.32055370e-03, -4.07778962e-03, 4.97133619e-03,
+	-6.02215477e-03, 7.25551911e-03, -8.70273980e-03, 1.04037968e-02,
+	-1.24114425e-02, 1.47977736e-02, -1.76651298e-02, 2.11649776e-02,
+	-2.55324664e-02, 3.11541878e-02, -3.87133730e-02, 4.95400337e-02,
+	-6.66074078e-02, 9.81853656e-02, -1.79029628e-01, 9.00109074e-01,
+	2.99484228e-01, -1.27173122e-01, 7.95954350e-02, -5.69836758e-02,
+	4.35912353e-02, -3.46302311e-02, 2.81533823e-02, -2.32208070e-02,
+	1.93238239e-02, -1.61633093e-02, 1.35517546e-02, -1.13653437e-02,
+	9.51860275e-03, -7.95014093e-03, 6.61422866e-03, -5.47562470e-03,
+	4.50629940e-03, -3.68330876e-03, 2.98739045e-03, -2.40202502e-03,
+	1.91280313e-03, -1.50699722e-03, 1.17327046e-03, -9.01478211e-04,
+	6.82530965e-04, -5.08297385e-04, 3.71532388e-04, -2.65819854e-04,
+	1.85522790e-04, -1.25736194e-04, 8.22396702e-05, -5.14481979e-05,
+	3.03604451e-05, -1.65047466e-05, 7.88336839e-06, -2.91599769e-06,
+	-5.10954189e-06, 1.18616711e-05, -2.31032522e-05, 4.06560947e-05,
+	-6.67980660e-05, 1.04320715e-04, -1.56585598e-04, 2.27578486e-04,
+	-3.21961040e-04, 4.45120174e-04, -6.03216177e-04, 8.03231879e-04,
+	-1.05302670e-03, 1.36140162e-03, -1.73818384e-03, 2.19434405e-03,
+	-2.74216458e-03, 3.39548461e-03, -4.17006061e-03, 5.08409770e-03,
+	-6.15903608e-03, 7.42072172e-03, -8.90116694e-03, 1.06412376e-02,
+	-1.26948408e-02, 1.51356302e-02, -1.80681237e-02, 2.16469576e-02,
+	-2.61121055e-02, 3.18578940e-02, -3.95807766e-02, 5.06353030e-02,
+	-6.80455790e-02, 1.00204383e-01, -1.82217217e-01, 8.93977491e-01,
+	3.09985934e-01, -1.30853075e-01, 8.17700546e-02, -5.84994864e-02,
+	4.47337629e-02, -3.55298195e-02, 2.88806367e-02, -2.38185365e-02,
+	1.98201863e-02, -1.65780206e-02, 1.38993246e-02, -1.16568920e-02,
+	9.76293709e-03, -8.15442727e-03, 6.78442291e-03, -5.61675954e-03,
+	4.62267998e-03, -3.77864971e-03, 3.06491424e-03, -2.46453457e-03,
+	1.96273714e-03, -1.54647370e-03, 1.20412238e-03, -9.25283692e-04,
+	7.00639799e-04, -5.21854898e-04, 3.81501433e-04, -2.73001329e-04,
+	1.90574905e-04, -1.29192591e-04, 8.45264034e-05, -5.28995375e-05,
+	3.12334501e-05, -1.69925436e-05, 8.12709090e-06, -3.01535617e-06,
+	-5.18742180e-06, 1.20656251e-05, -2.35239443e-05, 4.14227957e-05,
+	-6.80887088e-05, 1.06373285e-04, -1.59710838e-04, 2.32173869e-04,
+	-3.28525956e-04, 4.54272267e-04, -6.15708800e-04, 8.19972658e-04,
+	-1.07509729e-03, 1.39007883e-03, -1.77496251e-03, 2.24096235e-03,
+	-2.80063261e-03, 3.46811797e-03, -4.25952115e-03, 5.19344488e-03,
+	-6.29179398e-03, 7.58096930e-03, -9.09366308e-03, 1.08715989e-02,
+	-1.29698005e-02, 1.54634263e-02, -1.84590960e-02, 2.21145014e-02,
+	-2.66742590e-02, 3.25401253e-02, -4.04212204e-02, 5.16955126e-02,
+	-6.94353533e-02, 1.02148674e-01, -1.85255676e-01, 8.87682938e-01,
+	3.20522856e-01, -1.34487563e-01, 8.39082761e-02, -5.99868967e-02,
+	4.58536297e-02, -3.64109717e-02, 2.95926858e-02, -2.44036127e-02,
+	2.03059627e-02, -1.69838515e-02, 1.42394407e-02, -1.19421904e-02,
+	1.00020440e-02, -8.35435740e-03, 6.95100407e-03, -5.75491465e-03,
+	4.73661939e-03, -3.87200572e-03, 3.14083766e-03, -2.52576594e-03,
+	2.01166092e-03, -1.58516096e-03, 1.23436564e-03, -9.48626489e-04,
+	7.18402551e-04, -5.35158235e-04, 3.91287665e-04, -2.80054468e-04,
+	1.95539472e-04, -1.32591299e-04, 8.67767353e-05, -5.43291755e-05,
+	3.20945074e-05, -1.74745377e-05, 8.36860980e-06, -3.11439291e-06,
+	-5.26059227e-06, 1.22594974e-05, -2.39258761e-05, 4.21574826e-05,
+	-6.93279382e-05, 1.08346991e-04, -1.62719433e-04, 2.36601815e-04,
+	-3.34856516e-04, 4.63103380e-04, -6.27770042e-04, 8.36143279e-04,
+	-1.09642541e-03, 1.41780196e-03, -1.81052978e-03, 2.28605902e-03,
+	-2.85720783e-03, 3.53841729e-03, -4.34612594e-03, 5.29932197e-03,
+	-6.42036035e-03, 7.73617921e-03, -9.28012857e-03, 1.10947611e-02,
+	-1.32361789e-02, 1.57809916e-02, -1.88378443e-02, 2.25673688e-02,
+	-2.72186413e-02, 3.32005410e-02, -4.12342973e-02, 5.27201754e-02,
+	-7.07761580e-02, 1.04017647e-01, -1.88145268e-01, 8.81227670e-01,
+	3.31091696e-01, -1.38074107e-01, 8.60086175e-02, -6.14448869e-02,
+	4.69500761e-02, -3.72730945e-02, 3.02890527e-02, -2.49756454e-02,
+	2.07808295e-02, -1.73805320e-02, 1.45718764e-02, -1.22210489e-02,
+	1.02357641e-02, -8.54979780e-03, 7.11386064e-03, -5.88999731e-03,
+	4.84804092e-03, -3.96331374e-03, 3.21510924e-03, -2.58567744e-03,
+	2.05954101e-03, -1.62303240e-03, 1.26397935e-03, -9.71490388e-04,
+	7.35806808e-04, -5.48198040e-04, 4.00884152e-04, -2.86974235e-04,
+	2.00412913e-04, -1.35929845e-04, 8.89890087e-05, -5.57360442e-05,
+	3.29429632e-05, -1.79503546e-05, 8.60773163e-06, -3.21302412e-06,
+	-5.32906948e-06, 1.24432733e-05, -2.43089665e-05, 4.28599542e-05,
+	-7.05153563e-05, 1.10241130e-04, -1.65610235e-04, 2.40860543e-04,
+	-3.40950068e-04, 4.71609689e-04, -6.39394532e-04, 8.51736370e-04,
+	-1.11700114e-03, 1.44455790e-03, -1.84486857e-03, 2.32961212e-03,
+	-2.91186241e-03, 3.60634764e-03, -4.42983155e-03, 5.40167545e-03,
+	-6.54466981e-03, 7.88627209e-03, -9.46046771e-03, 1.13106093e-02,
+	-1.34938386e-02, 1.60881627e-02, -1.92041745e-02, 2.30053288e-02,
+	-2.77449780e-02, 3.38388144e-02, -4.20196176e-02, 5.37088273e-02,
+	-7.20674515e-02, 1.05810757e-01, -1.90886316e-01, 8.74613999e-01,
+	3.41689130e-01, -1.41610230e-01, 8.80696104e-02, -6.28724500e-02,
+	4.80223533e-02, -3.81156041e-02, 3.09692687e-02, -2.55342509e-02,
+	2.12444690e-02, -1.77677968e-02, 1.48964096e-02, -1.24932810e-02,
+	1.04639408e-02, -8.74061729e-03, 7.27288302e-03, -6.02191637e-03,
+	4.95686916e-03, -4.05251173e-03, 3.28767832e-03, -2.64422802e-03,
+	2.10634447e-03, -1.66006186e-03, 1.29294294e-03, -9.93859403e-04,
+	7.52840324e-04, -5.60965073e-04, 4.10284042e-04, -2.93755647e-04,
+	2.05191688e-04, -1.39205775e-04, 9.11615788e-05, -5.71190826e-05,
+	3.37781662e-05, -1.84196205e-05, 8.84426229e-06, -3.31116504e-06,
+	-5.39287286e-06, 1.26169448e-05, -2.46731470e-05, 4.35300314e-05,
+	-7.16506006e-05, 1.12055057e-04, -1.68382176e-04, 2.44948389e-04,
+	-3.46804120e-04, 4.79787586e-04, -6.50577189e-04, 8.66744944e-04,
+	-1.13681507e-03, 1.47033417e-03, -1.87796261e-03, 2.37160073e-03,
+	-2.96456976e-03, 3.67187560e-03, -4.51059644e-03, 5.50045413e-03,
+	-6.66465973e-03, 8.03117193e-03, -9.63458875e-03, 1.15190334e-02,
+	-1.37426481e-02, 1.63847829e-02, -1.95579001e-02, 2.34281605e-02,
+	-2.82530065e-02, 3.44546335e-02, -4.27768097e-02, 5.46610273e-02,
+	-7.33087237e-02, 1.07527503e-01, -1.93479206e-01, 8.67844290e-01,
+	3.52311813e-01, -1.45093461e-01, 9.00897998e-02, -6.42685923e-02,
+	4.90697241e-02, -3.89379266e-02, 3.16328732e-02, -2.60790525e-02,
+	2.16965693e-02, -1.81453858e-02, 1.52128222e-02, -1.27587036e-02,
+	1.06864205e-02, -8.92668711e-03, 7.42796367e-03, -6.15058233e-03,
+	5.06303003e-03, -4.13953876e-03, 3.35849513e-03, -2.70137736e-03,
+	2.15203889e-03, -1.69622354e-03, 1.32123612e-03, -1.01571778e-03,
+	7.69491024e-04, -5.73450219e-04, 4.19480569e-04, -3.00393783e-04,
+	2.09872292e-04, -1.42416662e-04, 9.32928145e-05, -5.84772365e-05,
+	3.45994677e-05, -1.88819623e-05, 9.07800714e-06, -3.40873001e-06,
+	-5.45202498e-06, 1.27805110e-05, -2.50183622e-05, 4.41675572e-05,
+	-7.27333440e-05, 1.13788179e-04, -1.71034271e-04, 2.48863799e-04,
+	-3.52416338e-04, 4.87633681e-04, -6.61313230e-04, 8.81162404e-04,
+	-1.15585827e-03, 1.49511896e-03, -1.90979646e-03, 2.41200495e-03,
+	-3.01530457e-03, 3.73496936e-03, -4.58838097e-03, 5.59560910e-03,
+	-6.78027029e-03, 8.17080604e-03, -9.80240398e-03, 1.17199282e-02,
+	-1.39824815e-02, 1.66707022e-02, -1.98988431e-02, 2.38356523e-02,
+	-2.87424759e-02, 3.50477004e-02, -4.35055201e-02, 5.55763579e-02,
+	-7.44994964e-02, 1.09167433e-01, -1.95924381e-01, 8.60920963e-01,
+	3.62956378e-01, -1.48521334e-01, 9.20677457e-02, -6.56323339e-02,
+	5.00914633e-02, -3.97394982e-02, 3.22794143e-02, -2.66096807e-02,
+	2.21368245e-02, -1.85130438e-02, 1.55209005e-02, -1.30171372e-02,
+	1.09030525e-02, -9.10788101e-03, 7.57899708e-03, -6.27590742e-03,
+	5.16645084e-03, -4.22433501e-03, 3.42751079e-03, -2.75708582e-03,
+	2.19659244e-03, -1.73149213e-03, 1.34883896e-03, -1.03705002e-03,
+	7.85747014e-04, -5.85644491e-04, 4.28467062e-04, -3.06883779e-04,
+	2.14451264e-04, -1.45560104e-04, 9.53810997e-05, -5.98094597e-05,
+	3.54062229e-05, -1.93370077e-05, 9.30877117e-06, -3.50563251e-06,
+	-5.50655156e-06, 1.29339776e-05, -2.53445695e-05, 4.47723966e-05,
+	-7.37632945e-05, 1.15439957e-04, -1.73565611e-04, 2.52605340e-04,
+	-3.57784551e-04, 4.95144805e-04, -6.71598161e-04, 8.94982539e-04,
+	-1.17412236e-03, 1.51890107e-03, -1.94035547e-03, 2.45080591e-03,
+	-3.06404281e-03, 3.79559865e-03, -4.66314745e-03, 5.68709384e-03,
+	-6.89144451e-03, 8.30510516e-03, -9.96382971e-03, 1.19131931e-02,
+	-1.42132187e-02, 1.69457776e-02, -2.02268335e-02, 2.42276026e-02,
+	-2.92131474e-02, 3.56177319e-02, -4.42054135e-02, 5.64544248e-02,
+	-7.56393228e-02, 1.10730137e-01, -1.98222346e-01, 8.53846491e-01,
+	3.73619435e-01, -1.51891392e-01, 9.40020237e-02, -6.69627097e-02,
+	5.10868583e-02, -4.05197655e-02, 3.29084487e-02, -2.71257736e-02,
+	2.25649351e-02, -1.88705209e-02, 1.58204351e-02, -1.32684062e-02,
+	1.11136892e-02, -9.28407535e-03, 7.72587993e-03, -6.39780560e-03,
+	5.26706036e-03, -4.30684184e-03, 3.49467734e-03, -2.81131451e-03,
+	2.23997383e-03, -1.76584271e-03, 1.37573186e-03, -1.05784086e-03,
+	8.01596592e-04, -5.97539042e-04, 4.37236942e-04, -3.13220842e-04,
+	2.18925183e-04, -1.48633723e-04, 9.74248338e-05, -6.11147143e-05,
+	3.61977905e-05, -1.97843855e-05, 9.53635912e-06, -3.60178521e-06,
+	-5.55648138e-06, 1.30773573e-05, -2.56517391e-05, 4.53444362e-05,
+	-7.47401957e-05, 1.17009906e-04, -1.75975370e-04, 2.56171689e-04,
+	-3.62906748e-04, 5.02318011e-04, -6.81427790e-04, 9.08199530e-04,
+	-1.19159941e-03, 1.54166999e-03, -1.96962586e-03, 2.48798578e-03,
+	-3.11076175e-03, 3.85373482e-03, -4.73486013e-03, 5.77486416e-03,
+	-6.99812823e-03, 8.43400342e-03, -1.01187864e-02, 1.20987326e-02,
+	-1.44347454e-02, 1.72098728e-02, -2.05417095e-02, 2.46038198e-02,
+	-2.96647939e-02, 3.61644595e-02, -4.48761729e-02, 5.72948576e-02,
+	-7.67277881e-02, 1.12215253e-01, -2.00373663e-01, 8.46623396e-01,
+	3.84297575e-01, -1.55201184e-01, 9.58912261e-02, -6.82587696e-02,
+	5.20552092e-02, -4.12781861e-02, 3.35195426e-02, -2.76269767e-02,
+	2.29806081e-02, -1.92175729e-02, 1.61112213e-02, -1.35123386e-02,
+	1.13181865e-02, -9.45514918e-03, 7.86851108e-03, -6.51619269e-03,
+	5.36478883e-03, -4.38700180e-03, 3.55994782e-03, -2.86402531e-03,
+	2.28215242e-03, -1.79925088e-03, 1.40189556e-03, -1.07807533e-03,
+	8.17028249e-04, -6.09125165e-04, 4.45783732e-04, -3.19400245e-04,
+	2.23290676e-04, -1.51635174e-04, 9.94224337e-05, -6.23919720e-05,
+	3.69735338e-05, -2.02237261e-05, 9.76057564e-06, -3.69710007e-06,
+	-5.60184621e-06, 1.32106692e-05, -2.59398538e-05, 4.58835848e-05,
+	-7.56638263e-05, 1.18497597e-04, -1.78262801e-04, 2.59561641e-04,
+	-3.67781080e-04, 5.09150570e-04, -6.90798219e-04, 9.20807954e-04,
+	-1.20828205e-03, 1.56341583e-03, -1.99759467e-03, 2.52352779e-03,
+	-3.15543996e-03, 3.90935082e-03, -4.80348523e-03, 5.85887825e-03,
+	-7.10027021e-03, 8.55743845e-03, -1.02671986e-02, 1.22764559e-02,
+	-1.46469531e-02, 1.74628588e-02, -2.08433178e-02, 2.49641222e-02,
+	-3.00972005e-02, 3.66876295e-02, -4.55174998e-02, 5.80973097e-02,
+	-7.77645094e-02, 1.13622463e-01, -2.02378955e-01, 8.39254254e-01,
+	3.94987373e-01, -1.58448272e-01, 9.77339624e-02, -6.95195795e-02,
+	5.29958299e-02, -4.20142288e-02, 3.41122714e-02, -2.81129439e-02,
+	2.33835571e-02, -1.95539610e-02, 1.63930591e-02, -1.37487666e-02,
+	1.15164034e-02, -9.62098429e-03, 8.00679172e-03, -6.63098637e-03,
+	5.45956803e-03, -4.46475869e-03, 3.62327623e-03, -2.91518089e-03,
+	2.32309815e-03, -1.83169269e-03, 1.42731120e-03, -1.09773873e-03,
+	8.32030684e-04, -6.20394302e-04, 4.54101061e-04, -3.25417332e-04,
+	2.27544416e-04, -1.54562139e-04, 1.01372334e-04, -6.36402141e-05,
+	3.77328207e-05, -2.06546614e-05, 9.98122536e-06, -3.79148836e-06,
+	-5.64268076e-06, 1.33339392e-05, -2.62089088e-05, 4.63897726e-05,
+	-7.65339998e-05, 1.19902653e-04, -1.80427239e-04, 2.62774107e-04,
+	-3.72405860e-04, 5.15639979e-04, -6.99705851e-04, 9.32802780e-04,
+	-1.22416341e-03, 1.58412941e-03, -2.02424976e-03, 2.55741621e-03,
+	-3.19805732e-03, 3.96242122e-03, -4.86899093e-03, 5.93909674e-03,
+	-7.19782207e-03, 8.67535132e-03, -1.04089950e-02, 1.24462774e-02,
+	-1.48497394e-02, 1.77046134e-02, -2.11315135e-02, 2.53083383e-02,
+	-3.05101647e-02, 3.71870031e-02, -4.61291143e-02, 5.88614581e-02,
+	-7.87491360e-02, 1.14951497e-01, -2.04238903e-01, 8.31741687e-01,
+	4.05685385e-01, -1.61630225e-01, 9.95288606e-02, -7.07442216e-02,
+	5.39080478e-02, -4.27273741e-02, 3.46862202e-02, -2.85833367e-02,
+	2.37735026e-02, -1.98794523e-02, 1.66657535e-02, -1.39775265e-02,
+	1.17082022e-02, -9.78146533e-03, 8.14062535e-03, -6.74210626e-03,
+	5.55133132e-03, -4.54005759e-03, 3.68461763e-03, -2.96474475e-03,
+	2.36278163e-03, -1.86314469e-03, 1.45196029e-03, -1.11681663e-03,
+	8.46592810e-04, -6.31338051e-04, 4.62182667e-04, -3.31267525e-04,
+	2.31683128e-04, -1.57412333e-04, 1.03272990e-04, -6.48584329e-05,
+	3.84750244e-05, -2.10768253e-05, 1.01981131e-05, -3.88486073e-06,
+	-5.67902262e-06, 1.34471997e-05, -2.64589120e-05, 4.68629514e-05,
+	-7.73505649e-05, 1.21224752e-04, -1.82468096e-04, 2.65808111e-04,
+	-3.76779562e-04, 5.21783954e-04, -7.08147386e-04, 9.44179375e-04,
+	-1.23923712e-03, 1.60380218e-03, -2.04957986e-03, 2.58963638e-03,
+	-3.23859503e-03, 4.01292220e-03, -4.93134741e-03, 6.01548265e-03,
+	-7.29073839e-03, 8.78768663e-03, -1.05441087e-02, 1.26081164e-02,
+	-1.50430076e-02, 1.79350217e-02, -2.14061601e-02, 2.56363065e-02,
+	-3.09034960e-02, 3.76623565e-02, -4.67107552e-02, 5.95870039e-02,
+	-7.96813489e-02, 1.16202128e-01, -2.05954243e-01, 8.24088366e-01,
+	4.16388154e-01, -1.64744627e-01, 1.01274568e-01, -7.19317954e-02,
+	5.47912048e-02, -4.34171144e-02, 3.52409843e-02, -2.90378255e-02,
+	2.41501721e-02, -2.01938196e-02, 1.69291143e-02, -1.41984585e-02,
+	1.18934490e-02, -9.93647985e-03, 8.26991792e-03, -6.84947396e-03,
+	5.64001370e-03, -4.61284491e-03, 3.74392812e-03, -3.01268120e-03,
+	2.40117413e-03, -1.89358396e-03, 1.47582471e-03, -1.13529493e-03,
+	8.60703759e-04, -6.41948168e-04, 4.70022400e-04, -3.36946323e-04,
+	2.35703587e-04, -1.60183506e-04, 1.05122875e-04, -6.60456321e-05,
+	3.91995236e-05, -2.14898538e-05, 1.04110441e-05, -3.97712730e-06,
+	-5.71091219e-06, 1.35504894e-05, -2.66898833e-05, 4.73030944e-05,
+	-7.81134050e-05, 1.22463626e-04, -1.84384868e-04, 2.68662795e-04,
+	-3.80900824e-04, 5.27580437e-04, -7.16119827e-04, 9.54933502e-04,
+	-1.25349736e-03, 1.62242625e-03, -2.07357455e-03, 2.62017471e-03,
+	-3.27703562e-03, 4.06083159e-03, -4.99052687e-03, 6.08800143e-03,
+	-7.37897664e-03, 8.89439252e-03, -1.06724766e-02, 1.27618973e-02,
+	-1.52266673e-02, 1.81539757e-02, -2.16671298e-02, 2.59478758e-02,
+	-3.12770164e-02, 3.81134810e-02, -4.72621802e-02, 6.02736724e-02,
+	-8.05608615e-02, 1.17374175e-01, -2.07525770e-01, 8.16297011e-01,
+	4.27092207e-01, -1.67789074e-01, 1.02969751e-01, -7.30814178e-02,
+	5.56446575e-02, -4.40829543e-02, 3.57761691e-02, -2.94760890e-02,
+	2.45133005e-02, -2.04968422e-02, 1.71829564e-02, -1.44114074e-02,
+	1.20720132e-02, -1.00859184e-02, 8.39457785e-03, -6.95301315e-03,
+	5.72555183e-03, -4.68306840e-03, 3.80116490e-03, -3.05895546e-03,
+	2.43824759e-03, -1.92298811e-03, 1.49888679e-03, -1.15315981e-03,
+	8.74352892e-04, -6.52216579e-04, 4.77614231e-04, -3.42449308e-04,
+	2.39602626e-04, -1.62873442e-04, 1.06920485e-04, -6.72008276e-05,
+	3.99057035e-05, -2.18933857e-05, 1.06198238e-05, -4.06819769e-06,
+	-5.73839262e-06, 1.36438534e-05, -2.69018550e-05, 4.77101960e-05,
+	-7.88224382e-05, 1.23619060e-04, -1.86177127e-04, 2.71337414e-04,
+	-3.84768445e-04, 5.33027590e-04, -7.23620475e-04, 9.65061325e-04,
+	-1.26693880e-03, 1.63999443e-03, -2.09622423e-03, 2.64901866e-03,
+	-3.31336294e-03, 4.10612887e-03, -5.04650350e-03, 6.15662100e-03,
+	-7.46249730e-03, 8.99542068e-03, -1.07940404e-02, 1.29075495e-02,
+	-1.54006339e-02, 1.83613750e-02, -2.19143031e-02, 2.62429052e-02,
+	-3.16305603e-02, 3.85401830e-02, -4.77831656e-02, 6.09212126e-02,
+	-8.13874190e-02, 1.18467502e-01, -2.08954335e-01, 8.08370385e-01,
+	4.37794060e-01, -1.70761177e-01, 1.04613098e-01, -7.41922240e-02,
+	5.64677778e-02, -4.47244112e-02, 3.62913906e-02, -2.98978149e-02,
+	2.48626300e-02, -2.07883054e-02, 1.74271003e-02, -1.46162222e-02,
+	1.22437682e-02, -1.02296746e-02, 8.51451610e-03, -7.05264956e-03,
+	5.80788408e-03, -4.75067721e-03, 3.85628629e-03, -3.10353361e-03,
+	2.47397467e-03, -1.95133528e-03, 1.52112925e-03, -1.17039778e-03,
+	8.87529806e-04, -6.62135377e-04, 4.84952252e-04, -3.47772146e-04,
+	2.43377134e-04, -1.65479961e-04, 1.08664340e-04, -6.83230479e-05,
+	4.05929556e-05, -2.22870621e-05, 1.08242585e-05, -4.15798111e-06,
+	-5.76150975e-06, 1.37273429e-05, -2.70948714e-05, 4.80842718e-05,
+	-7.94776167e-05, 1.24690894e-04, -1.87844527e-04, 2.73831342e-04,
+	-3.88381387e-04, 5.38123801e-04, -7.30646935e-04, 9.74559405e-04,
+	-1.27955665e-03, 1.65650019e-03, -2.11752019e-03, 2.67615678e-03,
+	-3.34756219e-03, 4.14879516e-03, -5.09925352e-03, 6.22131171e-03,
+	-7.54126379e-03, 9.09072636e-03, -1.09087455e-02, 1.30450075e-02,
+	-1.55648292e-02, 1.85571260e-02, -2.21475694e-02, 2.65212643e-02,
+	-3.19639745e-02, 3.89422843e-02, -4.82735068e-02, 6.15293981e-02,
+	-8.21607989e-02, 1.19482017e-01, -2.10240846e-01, 8.00311299e-01,
+	4.48490217e-01, -1.73658563e-01, 1.06203318e-01, -7.52633681e-02,
+	5.72599531e-02, -4.53410152e-02, 3.67862755e-02, -3.03026997e-02,
+	2.51979103e-02, -2.10680008e-02, 1.76613714e-02, -1.48127567e-02,
+	1.24085909e-02, -1.03676453e-02, 8.62964625e-03, -7.14831110e-03,
+	5.88695060e-03, -4.81562193e-03, 3.90925176e-03, -3.14638266e-03,
+	2.50832874e-03, -1.97860418e-03, 1.54253525e-03, -1.18699567e-03,
+	9.00224342e-04, -6.71696838e-04, 4.92030683e-04, -3.52910592e-04,
+	2.47024057e-04, -1.68000924e-04, 1.10352982e-04, -6.94113356e-05,
+	4.12606785e-05, -2.26705274e-05, 1.10241550e-05, -4.24638642e-06,
+	-5.78031200e-06, 1.38010155e-05, -2.72689887e-05, 4.84253581e-05,
+	-8.00789274e-05, 1.25679017e-04, -1.89386802e-04, 2.76144063e-04,
+	-3.91738773e-04, 5.42867679e-04, -7.37197111e-04, 9.83424703e-04,
+	-1.29134664e-03, 1.67193765e-03, -2.13745454e-03, 2.70157871e-03,
+	-3.37961991e-03, 4.18881325e-03, -5.14875519e-03, 6.28204640e-03,
+	-7.61524252e-03, 9.18026840e-03, -1.10165422e-02, 1.31742110e-02,
+	-1.57191807e-02, 1.87411427e-02, -2.23668268e-02, 2.67828328e-02,
+	-3.22771184e-02, 3.93196219e-02, -4.87330182e-02, 6.20980264e-02,
+	-8.28808105e-02, 1.20417674e-01, -2.11386263e-01, 7.92122603e-01,
+	4.59177172e-01, -1.76478875e-01, 1.07739144e-01, -7.62940235e-02,
+	5.80205869e-02, -4.59323101e-02, 3.72604618e-02, -3.06904496e-02,
+	2.55188992e-02, -2.13357267e-02, 1.78856010e-02, -1.50008688e-02,
+	1.25663622e-02, -1.04997304e-02, 8.73988453e-03, -7.23992787e-03,
+	5.96269332e-03, -4.87785458e-03, 3.96002194e-03, -3.18747056e-03,
+	2.54128390e-03, -2.00477412e-03, 1.56308840e-03, -1.20294066e-03,
+	9.12426593e-04, -6.80893418e-04, 4.98843873e-04, -3.57860492e-04,
+	2.50540405e-04, -1.70434230e-04, 1.11984977e-04, -7.04647472e-05,
+	4.19082782e-05, -2.30434292e-05, 1.12193212e-05, -4.33332219e-06,
+	-5.79485037e-06, 1.38649346e-05, -2.74242749e-05, 4.87335120e-05,
+	-8.06263906e-05, 1.26583376e-04, -1.90803764e-04, 2.78275180e-04,
+	-3.94839889e-04, 5.47258056e-04, -7.43269207e-04, 9.91654578e-04,
+	-1.30230500e-03, 1.68630163e-03, -2.15602029e-03, 2.72527513e-03,
+	-3.40952399e-03, 4.22616757e-03, -5.19498878e-03, 6.33880040e-03,
+	-7.68440290e-03, 9.26400928e-03, -1.11173845e-02, 1.32951048e-02,
+	-1.58636223e-02, 1.89133463e-02, -2.25719820e-02, 2.70275012e-02,
+	-3.25698641e-02, 3.96720482e-02, -4.91615331e-02, 6.26269194e-02,
+	-8.35472955e-02, 1.21274470e-01, -2.12391603e-01, 7.83807194e-01,
+	4.69851413e-01, -1.79219774e-01, 1.09219332e-01, -7.72833837e-02,
+	5.87490993e-02, -4.64978528e-02, 3.77135986e-02, -3.10607798e-02,
+	2.58253622e-02, -2.15912882e-02, 1.80996257e-02, -1.51804217e-02,
+	1.27169668e-02, -1.06258333e-02, 8.84514991e-03, -7.32743222e-03,
+	6.03505601e-03, -4.93732870e-03, 4.00855870e-03, -3.22676622e-03,
+	2.57281505e-03, -2.02982497e-03, 1.58277277e-03, -1.21822026e-03,
+	9.24126907e-04, -6.89717763e-04, 5.05386310e-04, -3.62617786e-04,
+	2.53923253e-04, -1.72777819e-04, 1.13558920e-04, -7.14823544e-05,
+	4.25351689e-05, -2.34054185e-05, 1.14095658e-05, -4.41869679e-06,
+	-5.80517829e-06, 1.39191694e-05, -2.75608097e-05, 4.90088113e-05,
+	-8.11200607e-05, 1.27403968e-04, -1.92095303e-04, 2.80224407e-04,
+	-3.97684180e-04, 5.51293987e-04, -7.48861731e-04, 9.99246792e-04,
+	-1.31242852e-03, 1.69958762e-03, -2.17321127e-03, 2.74723784e-03,
+	-3.43726366e-03, 4.26084424e-03, -5.23793664e-03, 6.39155150e-03,
+	-7.74871736e-03, 9.34191505e-03, -1.12112313e-02, 1.34076391e-02,
+	-1.59980940e-02, 1.90736653e-02, -2.27629503e-02, 2.72551701e-02,
+	-3.28420962e-02, 3.99994308e-02, -4.95589041e-02, 6.31159229e-02,
+	-8.41601272e-02, 1.22052448e-01, -2.13257935e-01, 7.75368006e-01,
+	4.80509419e-01, -1.81878942e-01, 1.10642660e-01, -7.82306626e-02,
+	5.94449270e-02, -4.70372146e-02, 3.81453467e-02, -3.14134155e-02,
+	2.61170728e-02, -2.18344968e-02, 1.83032880e-02, -1.53512831e-02,
+	1.28602937e-02, -1.07458604e-02, 8.94536414e-03, -7.41075878e-03,
+	6.10398434e-03, -4.99399937e-03, 4.05482511e-03, -3.26423953e-03,
+	2.60289783e-03, -2.05373722e-03, 1.60157287e-03, -1.23282236e-03,
+	9.35315899e-04, -6.98162713e-04, 5.11652617e-04, -3.67178512e-04,
+	2.57169738e-04, -1.75029678e-04, 1.15073429e-04, -7.24632449e-05,
+	4.31407730e-05, -2.37561503e-05, 1.15946990e-05, -4.50241843e-06,
+	-5.81135162e-06, 1.39637952e-05, -2.76786839e-05, 4.92513538e-05,
+	-8.15600254e-05, 1.28140842e-04, -1.93261388e-04, 2.81991574e-04,
+	-4.00271254e-04, 5.54974749e-04, -7.53973487e-04, 1.00619950e-03,
+	-1.32171449e-03, 1.71179177e-03, -2.18902219e-03, 2.76745971e-03,
+	-3.46282951e-03, 4.29283104e-03, -5.27758314e-03, 6.44027999e-03,
+	-7.80816132e-03, 9.41395542e-03, -1.12980455e-02, 1.35117688e-02,
+	-1.61225421e-02, 1.92220356e-02, -2.29396562e-02, 2.74657510e-02,
+	-3.30937120e-02, 4.03016529e-02, -4.99250025e-02, 6.35649073e-02,
+	-8.47192108e-02, 1.22751691e-01, -2.13986383e-01, 7.66808017e-01,
+	4.91147665e-01, -1.84454080e-01, 1.12007935e-01, -7.91350952e-02,
+	6.01075241e-02, -4.75499806e-02, 3.85553785e-02, -3.17480915e-02,
+	2.63938131e-02, -2.20651713e-02, 1.84964361e-02, -1.55133254e-02,
+	1.29962358e-02, -1.08597220e-02, 9.04045181e-03, -7.48984455e-03,
+	6.16942589e-03, -5.04782320e-03, 4.09878552e-03, -3.29986140e-03,
+	2.63150868e-03, -2.07649199e-03, 1.61947373e-03, -1.24673517e-03,
+	9.45984458e-04, -7.06221309e-04, 5.17637563e-04, -3.71538808e-04,
+	2.60277071e-04, -1.77187834e-04, 1.16527153e-04, -7.34065223e-05,
+	4.37245217e-05, -2.40952837e-05, 1.17745320e-05, -4.58439526e-06,
+	-5.81342854e-06, 1.39988927e-05, -2.77780001e-05, 4.94612575e-05,
+	-8.19464055e-05, 1.28794099e-04, -1.94302068e-04, 2.83576623e-04,
+	-4.02600879e-04, 5.58299840e-04, -7.58603582e-04, 1.01251127e-03,
+	-1.33016071e-03, 1.72291092e-03, -2.20344861e-03, 2.78593468e-03,
+	-3.48621346e-03, 4.32211743e-03, -5.31391471e-03, 6.48496866e-03,
+	-7.86271325e-03, 9.48010371e-03, -1.13777943e-02, 1.36074545e-02,
+	-1.62369190e-02, 1.93584006e-02, -2.31020327e-02, 2.76591656e-02,
+	-3.33246214e-02, 4.05786132e-02, -5.02597192e-02, 6.39737671e-02,
+	-8.52244834e-02, 1.23372330e-01, -2.14578120e-01, 7.58130239e-01,
+	5.01762621e-01, -1.86942910e-01, 1.13313986e-01, -7.99959382e-02,
+	6.07363625e-02, -4.80357507e-02, 3.89433786e-02, -3.20645527e-02,
+	2.66553733e-02, -2.22831374e-02, 1.86789245e-02, -1.56664265e-02,
+	1.31246900e-02, -1.09673314e-02, 9.13034039e-03, -7.56462890e-03,
+	6.23133018e-03, -5.09875842e-03, 4.14040555e-03, -3.33360375e-03,
+	2.65862487e-03, -2.09807103e-03, 1.63646084e-03, -1.25994733e-03,
+	9.56123749e-04, -7.13886794e-04, 5.23336064e-04, -3.75694915e-04,
+	2.63242527e-04, -1.79250363e-04, 1.17918769e-04, -7.43113079e-05,
+	4.42858557e-05, -2.44224818e-05, 1.19488777e-05, -4.66453543e-06,
+	-5.81146948e-06, 1.40245484e-05, -2.78588717e-05, 4.96386602e-05,
+	-8.22793545e-05, 1.29363892e-04, -1.95217466e-04, 2.84979609e-04,
+	-4.04672980e-04, 5.61268977e-04, -7.62751420e-04, 1.01818104e-03,
+	-1.33776553e-03, 1.73294257e-03, -2.21648695e-03, 2.80265780e-03,
+	-3.50740882e-03, 4.34869452e-03, -5.34691984e-03, 6.52560281e-03,
+	-7.91235461e-03, 9.54033692e-03, -1.14504496e-02, 1.36946617e-02,
+	-1.63411831e-02, 1.94827110e-02, -2.32500217e-02, 2.78353463e-02,
+	-3.35347471e-02, 4.08302257e-02, -5.05629637e-02, 6.43424207e-02,
+	-8.56759138e-02, 1.23914536e-01, -2.15034373e-01, 7.49337724e-01,
+	5.12350755e-01, -1.89343179e-01, 1.14559671e-01, -8.08124703e-02,
+	6.13309318e-02, -4.84941395e-02, 3.93090439e-02, -3.23625545e-02,
+	2.69015523e-02, -2.24882282e-02, 1.88506132e-02, -1.58104689e-02,
+	1.32455579e-02, -1.10686059e-02, 9.21496030e-03, -7.63505363e-03,
+	6.28964875e-03, -5.14676487e-03, 4.17965215e-03, -3.36543955e-03,
+	2.68422449e-03, -2.11845674e-03, 1.65252020e-03, -1.27244781e-03,
+	9.65725224e-04, -7.21152624e-04, 5.28743186e-04, -3.79643182e-04,
+	2.66063458e-04, -1.81215388e-04, 1.19246983e-04, -7.51767405e-05,
+	4.48242250e-05, -2.47374128e-05, 1.21175505e-05, -4.74274717e-06,
+	-5.80553703e-06, 1.40408541e-05, -2.79214231e-05, 4.97837194e-05,
+	-8.25590585e-05, 1.29850426e-04, -1.96007784e-04, 2.86200700e-04,
+	-4.06487644e-04, 5.63882100e-04, -7.66416703e-04, 1.02320818e-03,
+	-1.34452779e-03, 1.74188489e-03, -2.22813449e-03, 2.81762517e-03,
+	-3.52641021e-03, 4.37255512e-03, -5.37658905e-03, 6.56217023e-03,
+	-7.95706991e-03, 9.59463564e-03, -1.15159875e-02, 1.37733612e-02,
+	-1.64352995e-02, 1.95949247e-02, -2.33835738e-02, 2.79942361e-02,
+	-3.37240246e-02, 4.10564197e-02, -5.08346649e-02, 6.46708109e-02,
+	-8.60735020e-02, 1.24378524e-01, -2.15356419e-01, 7.40433560e-01,
+	5.22908535e-01, -1.91652658e-01, 1.15743875e-01, -8.15839930e-02,
+	6.18907404e-02, -4.89247765e-02, 3.96520836e-02, -3.26418623e-02,
+	2.71321577e-02, -2.26802839e-02, 1.90113688e-02, -1.59453405e-02,
+	1.33587451e-02, -1.11634660e-02, 9.29424497e-03, -7.70106302e-03,
+	6.34433516e-03, -5.19180405e-03, 4.21649358e-03, -3.39534286e-03,
+	2.70828647e-03, -2.13763216e-03, 1.66763832e-03, -1.28422600e-03,
+	9.74780626e-04, -7.28012468e-04, 5.33854151e-04, -3.83380065e-04,
+	2.68737290e-04, -1.83081082e-04, 1.20510534e-04, -7.60019774e-05,
+	4.53390903e-05, -2.50397495e-05, 1.22803665e-05, -4.81893885e-06,
+	-5.79569590e-06, 1.40479069e-05, -2.79657896e-05, 4.98966117e-05,
+	-8.27857359e-05, 1.30253954e-04, -1.96673300e-04, 2.87240172e-04,
+	-4.08045114e-04, 5.66139364e-04, -7.69599431e-04, 1.02759242e-03,
+	-1.35044688e-03, 1.74973675e-03, -2.23838937e-03, 2.83083399e-03,
+	-3.54321363e-03, 4.39369370e-03, -5.40291494e-03, 6.59466120e-03,
+	-7.99684669e-03, 9.64298416e-03, -1.15743882e-02, 1.38435292e-02,
+	-1.65192390e-02, 1.96950074e-02, -2.35026487e-02, 2.81357884e-02,
+	-3.38924018e-02, 4.12571404e-02, -5.10747706e-02, 6.49589045e-02,
+	-8.64172798e-02, 1.24764551e-01, -2.15545584e-01, 7.31420867e-01,
+	5.33432428e-01, -1.93869140e-01, 1.16865509e-01, -8.23098309e-02,
+	6.24153151e-02, -4.93273069e-02, 3.99722196e-02, -3.29022522e-02,
+	2.73470060e-02, -2.28591521e-02, 1.91610639e-02, -1.60709344e-02,
+	1.34641616e-02, -1.12518361e-02, 9.36813085e-03, -7.76260385e-03,
+	6.39534503e-03, -5.23383913e-03, 4.25089949e-03, -3.42328880e-03,
+	2.73079061e-03, -2.15558104e-03, 1.68180224e-03, -1.29527168e-03,
+	9.83281999e-04, -7.34460216e-04, 5.38664340e-04, -3.86902131e-04,
+	2.71261523e-04, -1.84845667e-04, 1.21708192e-04, -7.67861954e-05,
+	4.58299225e-05, -2.53291697e-05, 1.24371440e-05, -4.89301905e-06,
+	-5.78201284e-06, 1.40458093e-05, -2.79921168e-05, 4.99775329e-05,
+	-8.29596365e-05, 1.30574781e-04, -1.97214366e-04, 2.88098416e-04,
+	-4.09345789e-04, 5.68041143e-04, -7.72299896e-04, 1.03133391e-03,
+	-1.35552269e-03, 1.75649765e-03, -2.24725058e-03, 2.84228254e-03,
+	-3.55781642e-03, 4.41210638e-03, -5.42589214e-03, 6.62306851e-03,
+	-8.03167552e-03, 9.68537039e-03, -1.16256368e-02, 1.39051467e-02,
+	-1.65929791e-02, 1.97829319e-02, -2.36072147e-02, 2.82599674e-02,
+	-3.40398397e-02, 4.14323480e-02, -5.12832477e-02, 6.52066923e-02,
+	-8.67073099e-02, 1.25072916e-01, -2.15603244e-01, 7.22302803e-01,
+	5.43918905e-01, -1.95990447e-01, 1.17923517e-01, -8.29893322e-02,
+	6.29042021e-02, -4.97013913e-02, 4.02691869e-02, -3.31435113e-02,
+	2.75459227e-02, -2.30246882e-02, 1.92995775e-02, -1.61871490e-02,
+	1.35617220e-02, -1.13336443e-02, 9.43655750e-03, -7.81962549e-03,
+	6.44263608e-03, -5.27283501e-03, 4.28284089e-03, -3.44925361e-03,
+	2.75171759e-03, -2.17228780e-03, 1.69499953e-03, -1.30557503e-03,
+	9.91221688e-04, -7.40489983e-04, 5.43169296e-04, -3.90206066e-04,
+	2.73633738e-04, -1.86507418e-04, 1.22838761e-04, -7.75285908e-05,
+	4.62962036e-05, -2.56053570e-05, 1.25877032e-05, -4.96489667e-06,
+	-5.76455653e-06, 1.40346687e-05, -2.80005610e-05, 5.00266975e-05,
+	-8.30810417e-05, 1.30813260e-04, -1.97631412e-04, 2.88775930e-04,
+	-4.10390225e-04, 5.69588028e-04, -7.74518687e-04, 1.03443318e-03,
+	-1.35975561e-03, 1.76216777e-03, -2.25471795e-03, 2.85197017e-03,
+	-3.57021726e-03, 4.42779099e-03, -5.44551733e-03, 6.64738746e-03,
+	-8.06154996e-03, 9.72178586e-03, -1.16697222e-02, 1.39582005e-02,
+	-1.66565031e-02, 1.98586786e-02, -2.36972491e-02, 2.83667477e-02,
+	-3.41663117e-02, 4.15820184e-02, -5.14600820e-02, 6.54141888e-02,
+	-8.69436860e-02, 1.25303961e-01, -2.15530822e-01, 7.13082553e-01,
+	5.54364438e-01, -1.98014430e-01, 1.18916868e-01, -8.36218693e-02,
+	6.33569669e-02, -5.00467061e-02, 4.05427335e-02, -3.33654372e-02,
+	2.77287423e-02, -2.31767550e-02, 1.94267952e-02, -1.62938882e-02,
+	1.36513454e-02, -1.14088225e-02, 9.49946762e-03, -7.87207986e-03,
+	6.48616817e-03, -5.30875831e-03, 4.31229019e-03, -3.47321466e-03,
+	2.77104896e-03, -2.18773755e-03, 1.70721828e-03, -1.31512665e-03,
+	9.98592352e-04, -7.46096111e-04, 5.47364727e-04, -3.93288667e-04,
+	2.75851595e-04, -1.88064664e-04, 1.23901077e-04, -7.82283807e-05,
+	4.67374273e-05, -2.58680003e-05, 1.27318664e-05, -5.03448098e-06,
+	-5.74339752e-06, 1.40145976e-05, -2.79912885e-05, 5.00443386e-05,
+	-8.31502638e-05, 1.30969796e-04, -1.97924940e-04, 2.89273319e-04,
+	-4.11179133e-04, 5.70780823e-04, -7.76256683e-04, 1.03689115e-03,
+	-1.36314656e-03, 1.76674797e-03, -2.26079218e-03, 2.85989730e-03,
+	-3.58041617e-03, 4.44074698e-03, -5.46178923e-03, 6.66761582e-03,
+	-8.08646662e-03, 9.75222578e-03, -1.17066382e-02, 1.40026820e-02,
+	-1.67098007e-02, 1.99222351e-02, -2.37727378e-02, 2.84561144e-02,
+	-3.42718040e-02, 4.17061425e-02, -5.16052783e-02, 6.55814324e-02,
+	-8.71265330e-02, 1.25458066e-01, -2.15329788e-01, 7.03763334e-01,
+	5.64765505e-01, -1.99938965e-01, 1.19844567e-01, -8.42068393e-02,
+	6.37731947e-02, -5.03629440e-02, 4.07926205e-02, -3.35678388e-02,
+	2.78953086e-02, -2.33152233e-02, 1.95426088e-02, -1.63910612e-02,
+	1.37329553e-02, -1.14773063e-02, 9.55680707e-03, -7.91992153e-03,
+	6.52590331e-03, -5.34157742e-03, 4.33922124e-03, -3.49515045e-03,
+	2.78876721e-03, -2.20191614e-03, 1.71844717e-03, -1.32391757e-03,
+	1.00538697e-03, -7.51273180e-04, 5.51246512e-04, -3.96146856e-04,
+	2.77912838e-04, -1.89515787e-04, 1.24894012e-04, -7.88848032e-05,
+	4.71530988e-05, -2.61167947e-05, 1.28694585e-05, -5.10168169e-06,
+	-5.71860816e-06, 1.39857130e-05, -2.79644756e-05, 5.00307074e-05,
+	-8.31676456e-05, 1.31044839e-04, -1.98095526e-04, 2.89591301e-04,
+	-4.11713376e-04, 5.71620545e-04, -7.77515053e-04, 1.03870913e-03,
+	-1.36569697e-03, 1.77023975e-03, -2.26547480e-03, 2.86606542e-03,
+	-3.58841452e-03, 4.45097547e-03, -5.47470862e-03, 6.68375385e-03,
+	-8.10642512e-03, 9.77668896e-03, -1.17363826e-02, 1.40385882e-02,
+	-1.67528680e-02, 1.99735967e-02, -2.38336758e-02, 2.85280632e-02,
+	-3.43563153e-02, 4.18047270e-02, -5.17188601e-02, 6.57084854e-02,
+	-8.72560060e-02, 1.25535655e-01, -2.15001660e-01, 6.94348396e-01,
+	5.75118591e-01, -2.01761960e-01, 1.20705644e-01, -8.47436644e-02,
+	6.41524911e-02, -5.06498139e-02, 4.10186226e-02, -3.37505362e-02,
+	2.80454748e-02, -2.34399715e-02, 1.96469170e-02, -1.64785829e-02,
+	1.38064800e-02, -1.15390352e-02, 9.60852495e-03, -7.96310776e-03,
+	6.56180569e-03, -5.37126251e-03, 4.36360933e-03, -3.51504065e-03,
+	2.80485573e-03, -2.21481012e-03, 1.72867540e-03, -1.33193922e-03,
+	1.01159883e-03, -7.56016004e-04, 5.54810701e-04, -3.98777675e-04,
+	2.79815294e-04, -1.90859229e-04, 1.25816475e-04, -7.94971184e-05,
+	4.75427359e-05, -2.63514414e-05, 1.30003067e-05, -5.16640904e-06,
+	-5.69026252e-06, 1.39481370e-05, -2.79203085e-05, 4.99860730e-05,
+	-8.31335600e-05, 1.31038888e-04, -1.98143818e-04, 2.89730694e-04,
+	-4.11993971e-04, 5.72108424e-04, -7.78295255e-04, 1.03988882e-03,
+	-1.36740878e-03, 1.77264526e-03, -2.26876818e-03, 2.87047710e-03,
+	-3.59421499e-03, 4.45847926e-03, -5.48427828e-03, 6.69580429e-03,
+	-8.12142808e-03, 9.79517784e-03, -1.17589575e-02, 1.40659212e-02,
+	-1.67857069e-02, 2.00127658e-02, -2.38800666e-02, 2.85826003e-02,
+	-3.44198570e-02, 4.18777935e-02, -5.18008700e-02, 6.57954332e-02,
+	-8.73322907e-02, 1.25537190e-01, -2.14547999e-01, 6.84841011e-01,
+	5.85420187e-01, -2.03481353e-01, 1.21499165e-01, -8.52317921e-02,
+	6.44944819e-02, -5.09070414e-02, 4.12205283e-02, -3.39133607e-02,
+	2.81791036e-02, -2.35508861e-02, 1.97396250e-02, -1.65563737e-02,
+	1.38718525e-02, -1.15939528e-02, 9.65457363e-03, -8.00159846e-03,
+	6.59384175e-03, -5.39778556e-03, 4.38543122e-03, -3.53286610e-03,
+	2.81929885e-03, -2.22640676e-03, 1.73789277e-03, -1.33918349e-03,
+	1.01722156e-03, -7.60319643e-04, 5.58053521e-04, -4.01178292e-04,
+	2.81556877e-04, -1.92093484e-04, 1.26667412e-04, -8.00646086e-05,
+	4.79058690e-05, -2.65716479e-05, 1.31242412e-05, -5.22857389e-06,
+	-5.65843631e-06, 1.39019960e-05, -2.78589828e-05, 4.99107220e-05,
+	-8.30484097e-05, 1.30952490e-04, -1.98070538e-04, 2.89692427e-04,
+	-4.12022083e-04, 5.72245899e-04, -7.78599032e-04, 1.04043229e-03,
+	-1.36828442e-03, 1.77396734e-03, -2.27067553e-03, 2.87313593e-03,
+	-3.59782161e-03, 4.46326274e-03, -5.49050303e-03, 6.70377234e-03,
+	-8.13148109e-03, 9.80769846e-03, -1.17743697e-02, 1.40846883e-02,
+	-1.68083257e-02, 2.00397521e-02, -2.39119226e-02, 2.86197424e-02,
+	-3.44624533e-02, 4.19253791e-02, -5.18513689e-02, 6.58423850e-02,
+	-8.73556028e-02, 1.25463174e-01, -2.13970414e-01, 6.75244481e-01,
+	5.95666796e-01, -2.05095116e-01, 1.22224227e-01, -8.56706961e-02,
+	6.47988136e-02, -5.11343688e-02, 4.13981398e-02, -3.40561551e-02,
+	2.82960672e-02, -2.36478617e-02, 1.98206448e-02, -1.66243597e-02,
+	1.39290106e-02, -1.16420064e-02, 9.69490876e-03, -8.03535631e-03,
+	6.62198015e-03, -5.42112040e-03, 4.40466515e-03, -3.54860883e-03,
+	2.83208183e-03, -2.23669412e-03, 1.74608964e-03, -1.34564271e-03,
+	1.02224912e-03, -7.64179402e-04, 5.60971380e-04, -4.03345999e-04,
+	2.83135588e-04, -1.93217110e-04, 1.27445804e-04, -8.05865796e-05,
+	4.82420416e-05, -2.67771287e-05, 1.32410947e-05, -5.28808777e-06,
+	-5.62320678e-06, 1.38474209e-05, -2.77807036e-05, 4.98049583e-05,
+	-8.29126263e-05, 1.30786238e-04, -1.97876476e-04, 2.89477531e-04,
+	-4.11799028e-04, 5.72034617e-04, -7.78428410e-04, 1.04034200e-03,
+	-1.36832682e-03, 1.77420943e-03, -2.27120090e-03, 2.87404659e-03,
+	-3.59923970e-03, 4.46533197e-03, -5.49338969e-03, 6.70766566e-03,
+	-8.13659274e-03, 9.81426046e-03, -1.17826299e-02, 1.40949018e-02,
+	-1.68207388e-02, 2.00545729e-02, -2.39292648e-02, 2.86395164e-02,
+	-3.44841404e-02, 4.19475357e-02, -5.18704365e-02, 6.58494730e-02,
+	-8.73261879e-02, 1.25314149e-01, -2.13270553e-01, 6.65562132e-01,
+	6.05854928e-01, -2.06601251e-01, 1.22879962e-01, -8.60598763e-02,
+	6.50651539e-02, -5.13315555e-02, 4.15512731e-02, -3.41787740e-02,
+	2.83962476e-02, -2.37308009e-02, 1.98898952e-02, -1.66824728e-02,
+	1.39778968e-02, -1.16831476e-02, 9.72948935e-03, -8.06434674e-03,
+	6.64619183e-03, -5.44124269e-03, 4.42129087e-03, -3.56225209e-03,
+	2.84319092e-03, -2.24566097e-03, 1.75325697e-03, -1.35130965e-03,
+	1.02667580e-03, -7.67590838e-04, 5.63560864e-04, -4.05278222e-04,
+	2.84549519e-04, -1.94228723e-04, 1.28150675e-04, -8.10623604e-05,
+	4.85508110e-05, -2.69676050e-05, 1.33507031e-05, -5.34486298e-06,
+	-5.58465267e-06, 1.37845468e-05, -2.76856849e-05, 4.96691027e-05,
+	-8.27266703e-05, 1.30540770e-04, -1.97562495e-04, 2.89087140e-04,
+	-4.11326269e-04, 5.71476429e-04, -7.77785698e-04, 1.03962078e-03,
+	-1.36753942e-03, 1.77337566e-03, -2.27034915e-03, 2.87321479e-03,
+	-3.59847592e-03, 4.46469464e-03, -5.49294708e-03, 6.70749438e-03,
+	-8.13677460e-03, 9.81487705e-03, -1.17837533e-02, 1.40965793e-02,
+	-1.68229668e-02, 2.00572526e-02, -2.39321232e-02, 2.86419599e-02,
+	-3.44849673e-02, 4.19443307e-02, -5.18581709e-02, 6.58168526e-02,
+	-8.72443212e-02, 1.25090696e-01, -2.12450109e-01, 6.55797315e-01,
+	6.15981110e-01, -2.07997798e-01, 1.23465533e-01, -8.63988598e-02,
+	6.52931915e-02, -5.14983780e-02, 4.16797586e-02, -3.42810834e-02,
+	2.84795365e-02, -2.37996146e-02, 1.99473020e-02, -1.67306505e-02,
+	1.40184584e-02, -1.17173318e-02, 9.75827777e-03, -8.08853798e-03,
+	6.66645002e-03, -5.45813000e-03, 4.43528964e-03, -3.57378033e-03,
+	2.85261333e-03, -2.25329686e-03, 1.75938629e-03, -1.35617754e-03,
+	1.03049625e-03, -7.70549762e-04, 5.65818750e-04, -4.06972517e-04,
+	2.85796851e-04, -1.95126998e-04, 1.28781084e-04, -8.14913046e-05,
+	4.88317479e-05, -2.71428054e-05, 1.34529051e-05, -5.39881265e-06,
+	-5.54285414e-06, 1.37135129e-05, -2.75741499e-05, 4.95034924e-05,
+	-8.24910303e-05, 1.30216771e-04, -1.97129524e-04, 2.88522490e-04,
+	-4.10605415e-04, 5.70573392e-04, -7.76673481e-04, 1.03827184e-03,
+	-1.36592614e-03, 1.77147077e-03, -2.26812598e-03, 2.87064727e-03,
+	-3.59553821e-03, 4.46136005e-03, -5.48918604e-03, 6.70327102e-03,
+	-8.13204116e-03, 9.80956501e-03, -1.17777594e-02, 1.40897435e-02,
+	-1.68150363e-02, 2.00478228e-02, -2.39205361e-02, 2.86271205e-02,
+	-3.44649953e-02, 4.19158460e-02, -5.18146885e-02, 6.57447021e-02,
+	-8.71103074e-02, 1.24793432e-01, -2.11510817e-01, 6.45953402e-01,
+	6.26041878e-01, -2.09282828e-01, 1.23980139e-01, -8.66872003e-02,
+	6.54826369e-02, -5.16346304e-02, 4.17834408e-02, -3.43629615e-02,
+	2.85458355e-02, -2.38542220e-02, 1.99927979e-02, -1.67688365e-02,
+	1.40506477e-02, -1.17445187e-02, 9.78123979e-03, -8.10790105e-03,
+	6.68273029e-03, -5.47176176e-03, 4.44664426e-03, -3.58317926e-03,
+	2.86033723e-03, -2.25959212e-03, 1.76446976e-03, -1.36024007e-03,
+	1.03370545e-03, -7.73052245e-04, 5.67741998e-04, -4.08426574e-04,
+	2.86875861e-04, -1.95910677e-04, 1.29336134e-04, -8.18727907e-05,
+	4.90844379e-05, -2.73024659e-05, 1.35475431e-05, -5.44985085e-06,
+	-5.49789263e-06, 1.36344627e-05, -2.74463302e-05, 4.93084810e-05,
+	-8.22062226e-05, 1.29814968e-04, -1.96578563e-04, 2.87784918e-04,
+	-4.09638218e-04, 5.69327763e-04, -7.75094619e-04, 1.03629875e-03,
+	-1.36349139e-03, 1.76850013e-03, -2.26453786e-03, 2.86635182e-03,
+	-3.59043582e-03, 4.45533909e-03, -5.48211934e-03, 6.69501054e-03,
+	-8.12240986e-03, 9.79834465e-03, -1.17646719e-02, 1.40744220e-02,
+	-1.67969800e-02, 2.00263226e-02, -2.38945505e-02, 2.85950563e-02,
+	-3.44242981e-02, 4.18621788e-02, -5.17401241e-02, 6.56332224e-02,
+	-8.69244797e-02, 1.24423016e-01, -2.10454452e-01, 6.36033785e-01,
+	6.36033785e-01, -2.10454452e-01, 1.24423016e-01, -8.69244797e-02,
+	6.56332224e-02, -5.17401241e-02, 4.18621788e-02, -3.44242981e-02,
+	2.85950563e-02, -2.38945505e-02, 2.00263226e-02, -1.67969800e-02,
+	1.40744220e-02, -1.17646719e-02, 9.79834465e-03, -8.12240986e-03,
+	6.69501054e-03, -5.48211934e-03, 4.45533909e-03, -3.59043582e-03,
+	2.86635182e-03, -2.26453786e-03, 1.76850013e-03, -1.36349139e-03,
+	1.03629875e-03, -7.75094619e-04, 5.69327763e-04, -4.09638218e-04,
+	2.87784918e-04, -1.96578563e-04, 1.29814968e-04, -8.22062226e-05,
+	4.93084810e-05, -2.74463302e-05, 1.36344627e-05, -5.49789263e-06,
+	-5.44985085e-06, 1.35475431e-05, -2.73024659e-05, 4.90844379e-05,
+	-8.18727907e-05, 1.29336134e-04, -1.95910677e-04, 2.86875861e-04,
+	-4.08426574e-04, 5.67741998e-04, -7.73052245e-04, 1.03370545e-03,
+	-1.36024007e-03, 1.76446976e-03, -2.25959212e-03, 2.86033723e-03,
+	-3.58317926e-03, 4.44664426e-03, -5.47176176e-03, 6.68273029e-03,
+	-8.10790105e-03, 9.78123979e-03, -1.17445187e-02, 1.40506477e-02,
+	-1.67688365e-02, 1.99927979e-02, -2.38542220e-02, 2.85458355e-02,
+	-3.43629615e-02, 4.17834408e-02, -5.16346304e-02, 6.54826369e-02,
+	-8.66872003e-02, 1.23980139e-01, -2.09282828e-01, 6.26041878e-01,
+	6.45953402e-01, -2.11510817e-01, 1.24793432e-01, -8.71103074e-02,
+	6.57447021e-02, -5.18146885e-02, 4.19158460e-02, -3.44649953e-02,
+	2.86271205e-02, -2.39205361e-02, 2.00478228e-02, -1.68150363e-02,
+	1.40897435e-02, -1.17777594e-02, 9.80956501e-03, -8.13204116e-03,
+	6.70327102e-03, -5.48918604e-03, 4.46136005e-03, -3.59553821e-03,
+	2.87064727e-03, -2.26812598e-03, 1.77147077e-03, -1.36592614e-03,
+	1.03827184e-03, -7.76673481e-04, 5.70573392e-04, -4.10605415e-04,
+	2.88522490e-04, -1.97129524e-04, 1.30216771e-04, -8.24910303e-05,
+	4.95034924e-05, -2.75741499e-05, 1.37135129e-05, -5.54285414e-06,
+	-5.39881265e-06, 1.34529051e-05, -2.71428054e-05, 4.88317479e-05,
+	-8.14913046e-05, 1.28781084e-04, -1.95126998e-04, 2.85796851e-04,
+	-4.06972517e-04, 5.65818750e-04, -7.70549762e-04, 1.03049625e-03,
+	-1.35617754e-03, 1.75938629e-03, -2.25329686e-03, 2.85261333e-03,
+	-3.57378033e-03, 4.43528964e-03, -5.45813000e-03, 6.66645002e-03,
+	-8.08853798e-03, 9.75827777e-03, -1.17173318e-02, 1.40184584e-02,
+	-1.67306505e-02, 1.99473020e-02, -2.37996146e-02, 2.84795365e-02,
+	-3.42810834e-02, 4.16797586e-02, -5.14983780e-02, 6.52931915e-02,
+	-8.63988598e-02, 1.23465533e-01, -2.07997798e-01, 6.15981110e-01,
+	6.55797315e-01, -2.12450109e-01, 1.25090696e-01, -8.72443212e-02,
+	6.58168526e-02, -5.18581709e-02, 4.19443307e-02, -3.44849673e-02,
+	2.86419599e-02, -2.39321232e-02, 2.00572526e-02, -1.68229668e-02,
+	1.40965793e-02, -1.17837533e-02, 9.81487705e-03, -8.13677460e-03,
+	6.70749438e-03, -5.49294708e-03, 4.46469464e-03, -3.59847592e-03,
+	2.87321479e-03, -2.27034915e-03, 1.77337566e-03, -1.36753942e-03,
+	1.03962078e-03, -7.77785698e-04, 5.71476429e-04, -4.11326269e-04,
+	2.89087140e-04, -1.97562495e-04, 1.30540770e-04, -8.27266703e-05,
+	4.96691027e-05, -2.76856849e-05, 1.37845468e-05, -5.58465267e-06,
+	-5.34486298e-06, 1.33507031e-05, -2.69676050e-05, 4.85508110e-05,
+	-8.10623604e-05, 1.28150675e-04, -1.94228723e-04, 2.84549519e-04,
+	-4.05278222e-04, 5.63560864e-04, -7.67590838e-04, 1.02667580e-03,
+	-1.35130965e-03, 1.75325697e-03, -2.24566097e-03, 2.84319092e-03,
+	-3.56225209e-03, 4.42129087e-03, -5.44124269e-03, 6.64619183e-03,
+	-8.06434674e-03, 9.72948935e-03, -1.16831476e-02, 1.39778968e-02,
+	-1.66824728e-02, 1.98898952e-02, -2.37308009e-02, 2.83962476e-02,
+	-3.41787740e-02, 4.15512731e-02, -5.13315555e-02, 6.50651539e-02,
+	-8.60598763e-02, 1.22879962e-01, -2.06601251e-01, 6.05854928e-01,
+	6.65562132e-01, -2.13270553e-01, 1.25314149e-01, -8.73261879e-02,
+	6.58494730e-02, -5.18704365e-02, 4.19475357e-02, -3.44841404e-02,
+	2.86395164e-02, -2.39292648e-02, 2.00545729e-02, -1.68207388e-02,
+	1.40949018e-02, -1.17826299e-02, 9.81426046e-03, -8.13659274e-03,
+	6.70766566e-03, -5.49338969e-03, 4.46533197e-03, -3.59923970e-03,
+	2.87404659e-03, -2.27120090e-03, 1.77420943e-03, -1.36832682e-03,
+	1.04034200e-03, -7.78428410e-04, 5.72034617e-04, -4.11799028e-04,
+	2.89477531e-04, -1.97876476e-04, 1.30786238e-04, -8.29126263e-05,
+	4.98049583e-05, -2.77807036e-05, 1.38474209e-05, -5.62320678e-06,
+	-5.28808777e-06, 1.32410947e-05, -2.67771287e-05, 4.82420416e-05,
+	-8.05865796e-05, 1.27445804e-04, -1.93217110e-04, 2.83135588e-04,
+	-4.03345999e-04, 5.60971380e-04, -7.64179402e-04, 1.02224912e-03,
+	-1.34564271e-03, 1.74608964e-03, -2.23669412e-03, 2.83208183e-03,
+	-3.54860883e-03, 4.40466515e-03, -5.42112040e-03, 6.62198015e-03,
+	-8.03535631e-03, 9.69490876e-03, -1.16420064e-02, 1.39290106e-02,
+	-1.66243597e-02, 1.98206448e-02, -2.36478617e-02, 2.82960672e-02,
+	-3.40561551e-02, 4.13981398e-02, -5.11343688e-02, 6.47988136e-02,
+	-8.56706961e-02, 1.22224227e-01, -2.05095116e-01, 5.95666796e-01,
+	6.75244481e-01, -2.13970414e-01, 1.25463174e-01, -8.73556028e-02,
+	6.58423850e-02, -5.18513689e-02, 4.19253791e-02, -3.44624533e-02,
+	2.86197424e-02, -2.39119226e-02, 2.00397521e-02, -1.68083257e-02,
+	1.40846883e-02, -1.17743697e-02, 9.80769846e-03, -8.13148109e-03,
+	6.70377234e-03, -5.49050303e-03, 4.46326274e-03, -3.59782161e-03,
+	2.87313593e-03, -2.27067553e-03, 1.77396734e-03, -1.36828442e-03,
+	1.04043229e-03, -7.78599032e-04, 5.72245899e-04, -4.12022083e-04,
+	2.89692427e-04, -1.98070538e-04, 1.30952490e-04, -8.30484097e-05,
+	4.99107220e-05, -2.78589828e-05, 1.39019960e-05, -5.65843631e-06,
+	-5.22857389e-06, 1.31242412e-05, -2.65716479e-05, 4.79058690e-05,
+	-8.00646086e-05, 1.26667412e-04, -1.92093484e-04, 2.81556877e-04,
+	-4.01178292e-04, 5.58053521e-04, -7.60319643e-04, 1.01722156e-03,
+	-1.33918349e-03, 1.73789277e-03, -2.22640676e-03, 2.81929885e-03,
+	-3.53286610e-03, 4.38543122e-03, -5.39778556e-03, 6.59384175e-03,
+	-8.00159846e-03, 9.65457363e-03, -1.15939528e-02, 1.38718525e-02,
+	-1.65563737e-02, 1.97396250e-02, -2.35508861e-02, 2.81791036e-02,
+	-3.39133607e-02, 4.12205283e-02, -5.09070414e-02, 6.44944819e-02,
+	-8.52317921e-02, 1.21499165e-01, -2.03481353e-01, 5.85420187e-01,
+	6.84841011e-01, -2.14547999e-01, 1.25537190e-01, -8.73322907e-02,
+	6.57954332e-02, -5.18008700e-02, 4.18777935e-02, -3.44198570e-02,
+	2.85826003e-02, -2.38800666e-02, 2.00127658e-02, -1.67857069e-02,
+	1.40659212e-02, -1.17589575e-02, 9.79517784e-03, -8.12142808e-03,
+	6.69580429e-03, -5.48427828e-03, 4.45847926e-03, -3.59421499e-03,
+	2.87047710e-03, -2.26876818e-03, 1.77264526e-03, -1.36740878e-03,
+	1.03988882e-03, -7.78295255e-04, 5.72108424e-04, -4.11993971e-04,
+	2.89730694e-04, -1.98143818e-04, 1.31038888e-04, -8.31335600e-05,
+	4.99860730e-05, -2.79203085e-05, 1.39481370e-05, -5.69026252e-06,
+	-5.16640904e-06, 1.30003067e-05, -2.63514414e-05, 4.75427359e-05,
+	-7.94971184e-05, 1.25816475e-04, -1.90859229e-04, 2.79815294e-04,
+	-3.98777675e-04, 5.54810701e-04, -7.56016004e-04, 1.01159883e-03,
+	-1.33193922e-03, 1.72867540e-03, -2.21481012e-03, 2.80485573e-03,
+	-3.51504065e-03, 4.36360933e-03, -5.37126251e-03, 6.56180569e-03,
+	-7.96310776e-03, 9.60852495e-03, -1.15390352e-02, 1.38064800e-02,
+	-1.64785829e-02, 1.96469170e-02, -2.34399715e-02, 2.80454748e-02,
+	-3.37505362e-02, 4.10186226e-02, -5.06498139e-02, 6.41524911e-02,
+	-8.47436644e-02, 1.20705644e-01, -2.01761960e-01, 5.75118591e-01,
+	6.94348396e-01, -2.15001660e-01, 1.25535655e-01, -8.72560060e-02,
+	6.57084854e-02, -5.17188601e-02, 4.18047270e-02, -3.43563153e-02,
+	2.85280632e-02, -2.38336758e-02, 1.99735967e-02, -1.67528680e-02,
+	1.40385882e-02, -1.17363826e-02, 9.77668896e-03, -8.10642512e-03,
+	6.68375385e-03, -5.47470862e-03, 4.45097547e-03, -3.58841452e-03,
+	2.86606542e-03, -2.26547480e-03, 1.77023975e-03, -1.36569697e-03,
+	1.03870913e-03, -7.77515053e-04, 5.71620545e-04, -4.11713376e-04,
+	2.89591301e-04, -1.98095526e-04, 1.31044839e-04, -8.31676456e-05,
+	5.00307074e-05, -2.79644756e-05, 1.39857130e-05, -5.71860816e-06,
+	-5.10168169e-06, 1.28694585e-05, -2.61167947e-05, 4.71530988e-05,
+	-7.88848032e-05, 1.24894012e-04, -1.89515787e-04, 2.77912838e-04,
+	-3.96146856e-04, 5.51246512e-04, -7.51273180e-04, 1.00538697e-03,
+	-1.32391757e-03, 1.71844717e-03, -2.20191614e-03, 2.78876721e-03,
+	-3.49515045e-03, 4.33922124e-03, -5.34157742e-03, 6.52590331e-03,
+	-7.91992153e-03, 9.55680707e-03, -1.14773063e-02, 1.37329553e-02,
+	-1.63910612e-02, 1.95426088e-02, -2.33152233e-02, 2.78953086e-02,
+	-3.35678388e-02, 4.07926205e-02, -5.03629440e-02, 6.37731947e-02,
+	-8.42068393e-02, 1.19844567e-01, -1.99938965e-01, 5.64765505e-01,
+	7.03763334e-01, -2.15329788e-01, 1.25458066e-01, -8.71265330e-02,
+	6.55814324e-02, -5.16052783e-02, 4.17061425e-02, -3.42718040e-02,
+	2.84561144e-02, -2.37727378e-02, 1.99222351e-02, -1.67098007e-02,
+	1.40026820e-02, -1.17066382e-02, 9.75222578e-03, -8.08646662e-03,
+	6.66761582e-03, -5.46178923e-03, 4.44074698e-03, -3.58041617e-03,
+	2.85989730e-03, -2.26079218e-03, 1.76674797e-03, -1.36314656e-03,
+	1.03689115e-03, -7.76256683e-04, 5.70780823e-04, -4.11179133e-04,
+	2.89273319e-04, -1.97924940e-04, 1.30969796e-04, -8.31502638e-05,
+	5.00443386e-05, -2.79912885e-05, 1.40145976e-05, -5.74339752e-06,
+	-5.03448098e-06, 1.27318664e-05, -2.58680003e-05, 4.67374273e-05,
+	-7.82283807e-05, 1.23901077e-04, -1.88064664e-04, 2.75851595e-04,
+	-3.93288667e-04, 5.47364727e-04, -7.46096111e-04, 9.98592352e-04,
+	-1.31512665e-03, 1.70721828e-03, -2.18773755e-03, 2.77104896e-03,
+	-3.47321466e-03, 4.31229019e-03, -5.30875831e-03, 6.48616817e-03,
+	-7.87207986e-03, 9.49946762e-03, -1.14088225e-02, 1.36513454e-02,
+	-1.62938882e-02, 1.94267952e-02, -2.31767550e-02, 2.77287423e-02,
+	-3.33654372e-02, 4.05427335e-02, -5.00467061e-02, 6.33569669e-02,
+	-8.36218693e-02, 1.18916868e-01, -1.98014430e-01, 5.54364438e-01,
+	7.13082553e-01, -2.15530822e-01, 1.25303961e-01, -8.69436860e-02,
+	6.54141888e-02, -5.14600820e-02, 4.15820184e-02, -3.41663117e-02,
+	2.83667477e-02, -2.36972491e-02, 1.98586786e-02, -1.66565031e-02,
+	1.39582005e-02, -1.16697222e-02, 9.72178586e-03, -8.06154996e-03,
+	6.64738746e-03, -5.44551733e-03, 4.42779099e-03, -3.57021726e-03,
+	2.85197017e-03, -2.25471795e-03, 1.76216777e-03, -1.35975561e-03,
+	1.03443318e-03, -7.74518687e-04, 5.69588028e-04, -4.10390225e-04,
+	2.88775930e-04, -1.97631412e-04, 1.30813260e-04, -8.30810417e-05,
+	5.00266975e-05, -2.80005610e-05, 1.40346687e-05, -5.76455653e-06,
+	-4.96489667e-06, 1.25877032e-05, -2.56053570e-05, 4.62962036e-05,
+	-7.75285908e-05, 1.22838761e-04, -1.86507418e-04, 2.73633738e-04,
+	-3.90206066e-04, 5.43169296e-04, -7.40489983e-04, 9.91221688e-04,
+	-1.30557503e-03, 1.69499953e-03, -2.17228780e-03, 2.75171759e-03,
+	-3.44925361e-03, 4.28284089e-03, -5.27283501e-03, 6.44263608e-03,
+	-7.81962549e-03, 9.43655750e-03, -1.13336443e-02, 1.35617220e-02,
+	-1.61871490e-02, 1.92995775e-02, -2.30246882e-02, 2.75459227e-02,
+	-3.31435113e-02, 4.02691869e-02, -4.97013913e-02, 6.29042021e-02,
+	-8.29893322e-02, 1.17923517e-01, -1.95990447e-01, 5.43918905e-01,
+	7.22302803e-01, -2.15603244e-01, 1.25072916e-01, -8.67073099e-02,
+	6.52066923e-02, -5.12832477e-02, 4.14323480e-02, -3.40398397e-02,
+	2.82599674e-02, -2.36072147e-02, 1.97829319e-02, -1.65929791e-02,
+	1.39051467e-02, -1.16256368e-02, 9.68537039e-03, -8.03167552e-03,
+	6.62306851e-03, -5.42589214e-03, 4.41210638e-03, -3.55781642e-03,
+	2.84228254e-03, -2.24725058e-03, 1.75649765e-03, -1.35552269e-03,
+	1.03133391e-03, -7.72299896e-04, 5.68041143e-04, -4.09345789e-04,
+	2.88098416e-04, -1.97214366e-04, 1.30574781e-04, -8.29596365e-05,
+	4.99775329e-05, -2.79921168e-05, 1.40458093e-05, -5.78201284e-06,
+	-4.89301905e-06, 1.24371440e-05, -2.53291697e-05, 4.58299225e-05,
+	-7.67861954e-05, 1.21708192e-04, -1.84845667e-04, 2.71261523e-04,
+	-3.86902131e-04, 5.38664340e-04, -7.34460216e-04, 9.83281999e-04,
+	-1.29527168e-03, 1.68180224e-03, -2.15558104e-03, 2.73079061e-03,
+	-3.42328880e-03, 4.25089949e-03, -5.23383913e-03, 6.39534503e-03,
+	-7.76260385e-03, 9.36813085e-03, -1.12518361e-02, 1.34641616e-02,
+	-1.60709344e-02, 1.91610639e-02, -2.28591521e-02, 2.73470060e-02,
+	-3.29022522e-02, 3.99722196e-02, -4.93273069e-02, 6.24153151e-02,
+	-8.23098309e-02, 1.16865509e-01, -1.93869140e-01, 5.33432428e-01,
+	7.31420867e-01, -2.15545584e-01, 1.24764551e-01, -8.64172798e-02,
+	6.49589045e-02, -5.10747706e-02, 4.12571404e-02, -3.38924018e-02,
+	2.81357884e-02, -2.35026487e-02, 1.96950074e-02, -1.65192390e-02,
+	1.38435292e-02, -1.15743882e-02, 9.64298416e-03, -7.99684669e-03,
+	6.59466120e-03, -5.40291494e-03, 4.39369370e-03, -3.54321363e-03,
+	2.83083399e-03, -2.23838937e-03, 1.74973675e-03, -1.35044688e-03,
+	1.02759242e-03, -7.69599431e-04, 5.66139364e-04, -4.08045114e-04,
+	2.87240172e-04, -1.96673300e-04, 1.30253954e-04, -8.27857359e-05,
+	4.98966117e-05, -2.79657896e-05, 1.40479069e-05, -5.79569590e-06,
+	-4.81893885e-06, 1.22803665e-05, -2.50397495e-05, 4.53390903e-05,
+	-7.60019774e-05, 1.20510534e-04, -1.83081082e-04, 2.68737290e-04,
+	-3.83380065e-04, 5.33854151e-04, -7.28012468e-04, 9.74780626e-04,
+	-1.28422600e-03, 1.66763832e-03, -2.13763216e-03, 2.70828647e-03,
+	-3.39534286e-03, 4.21649358e-03, -5.19180405e-03, 6.34433516e-03,
+	-7.70106302e-03, 9.29424497e-03, -1.11634660e-02, 1.33587451e-02,
+	-1.59453405e-02, 1.90113688e-02, -2.26802839e-02, 2.71321577e-02,
+	-3.26418623e-02, 3.96520836e-02, -4.89247765e-02, 6.18907404e-02,
+	-8.15839930e-02, 1.15743875e-01, -1.91652658e-01, 5.22908535e-01,
+	7.40433560e-01, -2.15356419e-01, 1.24378524e-01, -8.60735020e-02,
+	6.46708109e-02, -5.08346649e-02, 4.10564197e-02, -3.37240246e-02,
+	2.79942361e-02, -2.33835738e-02, 1.95949247e-02, -1.64352995e-02,
+	1.37733612e-02, -1.15159875e-02, 9.59463564e-03, -7.95706991e-03,
+	6.56217023e-03, -5.37658905e-03, 4.37255512e-03, -3.52641021e-03,
+	2.81762517e-03, -2.22813449e-03, 1.74188489e-03, -1.34452779e-03,
+	1.02320818e-03, -7.66416703e-04, 5.63882100e-04, -4.06487644e-04,
+	2.86200700e-04, -1.96007784e-04, 1.29850426e-04, -8.25590585e-05,
+	4.97837194e-05, -2.79214231e-05, 1.40408541e-05, -5.80553703e-06,
+	-4.74274717e-06, 1.21175505e-05, -2.47374128e-05, 4.48242250e-05,
+	-7.51767405e-05, 1.19246983e-04, -1.81215388e-04, 2.66063458e-04,
+	-3.79643182e-04, 5.28743186e-04, -7.21152624e-04, 9.65725224e-04,
+	-1.27244781e-03, 1.65252020e-03, -2.11845674e-03, 2.68422449e-03,
+	-3.36543955e-03, 4.17965215e-03, -5.14676487e-03, 6.28964875e-03,
+	-7.63505363e-03, 9.21496030e-03, -1.10686059e-02, 1.32455579e-02,
+	-1.58104689e-02, 1.88506132e-02, -2.24882282e-02, 2.69015523e-02,
+	-3.23625545e-02, 3.93090439e-02, -4.84941395e-02, 6.13309318e-02,
+	-8.08124703e-02, 1.14559671e-01, -1.89343179e-01, 5.12350755e-01,
+	7.49337724e-01, -2.15034373e-01, 1.23914536e-01, -8.56759138e-02,
+	6.43424207e-02, -5.05629637e-02, 4.08302257e-02, -3.35347471e-02,
+	2.78353463e-02, -2.32500217e-02, 1.94827110e-02, -1.63411831e-02,
+	1.36946617e-02, -1.14504496e-02, 9.54033692e-03, -7.91235461e-03,
+	6.52560281e-03, -5.34691984e-03, 4.34869452e-03, -3.50740882e-03,
+	2.80265780e-03, -2.21648695e-03, 1.73294257e-03, -1.33776553e-03,
+	1.01818104e-03, -7.62751420e-04, 5.61268977e-04, -4.04672980e-04,
+	2.84979609e-04, -1.95217466e-04, 1.29363892e-04, -8.22793545e-05,
+	4.96386602e-05, -2.78588717e-05, 1.40245484e-05, -5.81146948e-06,
+	-4.66453543e-06, 1.19488777e-05, -2.44224818e-05, 4.42858557e-05,
+	-7.43113079e-05, 1.17918769e-04, -1.79250363e-04, 2.63242527e-04,
+	-3.75694915e-04, 5.23336064e-04, -7.13886794e-04, 9.56123749e-04,
+	-1.25994733e-03, 1.63646084e-03, -2.09807103e-03, 2.65862487e-03,
+	-3.33360375e-03, 4.14040555e-03, -5.09875842e-03, 6.23133018e-03,
+	-7.56462890e-03, 9.13034039e-03, -1.09673314e-02, 1.31246900e-02,
+	-1.56664265e-02, 1.86789245e-02, -2.22831374e-02, 2.66553733e-02,
+	-3.20645527e-02, 3.89433786e-02, -4.80357507e-02, 6.07363625e-02,
+	-7.99959382e-02, 1.13313986e-01, -1.86942910e-01, 5.01762621e-01,
+	7.58130239e-01, -2.14578120e-01, 1.23372330e-01, -8.52244834e-02,
+	6.39737671e-02, -5.02597192e-02, 4.05786132e-02, -3.33246214e-02,
+	2.76591656e-02, -2.31020327e-02, 1.93584006e-02, -1.62369190e-02,
+	1.36074545e-02, -1.13777943e-02, 9.48010371e-03, -7.86271325e-03,
+	6.48496866e-03, -5.31391471e-03, 4.32211743e-03, -3.48621346e-03,
+	2.78593468e-03, -2.20344861e-03, 1.72291092e-03, -1.33016071e-03,
+	1.01251127e-03, -7.58603582e-04, 5.58299840e-04, -4.02600879e-04,
+	2.83576623e-04, -1.94302068e-04, 1.28794099e-04, -8.19464055e-05,
+	4.94612575e-05, -2.77780001e-05, 1.39988927e-05, -5.81342854e-06,
+	-4.58439526e-06, 1.17745320e-05, -2.40952837e-05, 4.37245217e-05,
+	-7.34065223e-05, 1.16527153e-04, -1.77187834e-04, 2.60277071e-04,
+	-3.71538808e-04, 5.17637563e-04, -7.06221309e-04, 9.45984458e-04,
+	-1.24673517e-03, 1.61947373e-03, -2.07649199e-03, 2.63150868e-03,
+	-3.29986140e-03, 4.09878552e-03, -5.04782320e-03, 6.16942589e-03,
+	-7.48984455e-03, 9.04045181e-03, -1.08597220e-02, 1.29962358e-02,
+	-1.55133254e-02, 1.84964361e-02, -2.20651713e-02, 2.63938131e-02,
+	-3.17480915e-02, 3.85553785e-02, -4.75499806e-02, 6.01075241e-02,
+	-7.91350952e-02, 1.12007935e-01, -1.84454080e-01, 4.91147665e-01,
+	7.66808017e-01, -2.13986383e-01, 1.22751691e-01, -8.47192108e-02,
+	6.35649073e-02, -4.99250025e-02, 4.03016529e-02, -3.30937120e-02,
+	2.74657510e-02, -2.29396562e-02, 1.92220356e-02, -1.61225421e-02,
+	1.35117688e-02, -1.12980455e-02, 9.41395542e-03, -7.80816132e-03,
+	6.44027999e-03, -5.27758314e-03, 4.29283104e-03, -3.46282951e-03,
+	2.76745971e-03, -2.18902219e-03, 1.71179177e-03, -1.32171449e-03,
+	1.00619950e-03, -7.53973487e-04, 5.54974749e-04, -4.00271254e-04,
+	2.81991574e-04, -1.93261388e-04, 1.28140842e-04, -8.15600254e-05,
+	4.92513538e-05, -2.76786839e-05, 1.39637952e-05, -5.81135162e-06,
+	-4.50241843e-06, 1.15946990e-05, -2.37561503e-05, 4.31407730e-05,
+	-7.24632449e-05, 1.15073429e-04, -1.75029678e-04, 2.57169738e-04,
+	-3.67178512e-04, 5.11652617e-04, -6.98162713e-04, 9.35315899e-04,
+	-1.23282236e-03, 1.60157287e-03, -2.05373722e-03, 2.60289783e-03,
+	-3.26423953e-03, 4.05482511e-03, -4.99399937e-03, 6.10398434e-03,
+	-7.41075878e-03, 8.94536414e-03, -1.07458604e-02, 1.28602937e-02,
+	-1.53512831e-02, 1.83032880e-02, -2.18344968e-02, 2.61170728e-02,
+	-3.14134155e-02, 3.81453467e-02, -4.70372146e-02, 5.94449270e-02,
+	-7.82306626e-02, 1.10642660e-01, -1.81878942e-01, 4.80509419e-01,
+	7.75368006e-01, -2.13257935e-01, 1.22052448e-01, -8.41601272e-02,
+	6.31159229e-02, -4.95589041e-02, 3.99994308e-02, -3.28420962e-02,
+	2.72551701e-02, -2.27629503e-02, 1.90736653e-02, -1.59980940e-02,
+	1.34076391e-02, -1.12112313e-02, 9.34191505e-03, -7.74871736e-03,
+	6.39155150e-03, -5.23793664e-03, 4.26084424e-03, -3.43726366e-03,
+	2.74723784e-03, -2.17321127e-03, 1.69958762e-03, -1.31242852e-03,
+	9.99246792e-04, -7.48861731e-04, 5.51293987e-04, -3.97684180e-04,
+	2.80224407e-04, -1.92095303e-04, 1.27403968e-04, -8.11200607e-05,
+	4.90088113e-05, -2.75608097e-05, 1.39191694e-05, -5.80517829e-06,
+	-4.41869679e-06, 1.14095658e-05, -2.34054185e-05, 4.25351689e-05,
+	-7.14823544e-05, 1.13558920e-04, -1.72777819e-04, 2.53923253e-04,
+	-3.62617786e-04, 5.05386310e-04, -6.89717763e-04, 9.24126907e-04,
+	-1.21822026e-03, 1.58277277e-03, -2.02982497e-03, 2.57281505e-03,
+	-3.22676622e-03, 4.00855870e-03, -4.93732870e-03, 6.03505601e-03,
+	-7.32743222e-03, 8.84514991e-03, -1.06258333e-02, 1.27169668e-02,
+	-1.51804217e-02, 1.80996257e-02, -2.15912882e-02, 2.58253622e-02,
+	-3.10607798e-02, 3.77135986e-02, -4.64978528e-02, 5.87490993e-02,
+	-7.72833837e-02, 1.09219332e-01, -1.79219774e-01, 4.69851413e-01,
+	7.83807194e-01, -2.12391603e-01, 1.21274470e-01, -8.35472955e-02,
+	6.26269194e-02, -4.91615331e-02, 3.96720482e-02, -3.25698641e-02,
+	2.70275012e-02, -2.25719820e-02, 1.89133463e-02, -1.58636223e-02,
+	1.32951048e-02, -1.11173845e-02, 9.26400928e-03, -7.68440290e-03,
+	6.33880040e-03, -5.19498878e-03, 4.22616757e-03, -3.40952399e-03,
+	2.72527513e-03, -2.15602029e-03, 1.68630163e-03, -1.30230500e-03,
+	9.91654578e-04, -7.43269207e-04, 5.47258056e-04, -3.94839889e-04,
+	2.78275180e-04, -1.90803764e-04, 1.26583376e-04, -8.06263906e-05,
+	4.87335120e-05, -2.74242749e-05, 1.38649346e-05, -5.79485037e-06,
+	-4.33332219e-06, 1.12193212e-05, -2.30434292e-05, 4.19082782e-05,
+	-7.04647472e-05, 1.11984977e-04, -1.70434230e-04, 2.50540405e-04,
+	-3.57860492e-04, 4.98843873e-04, -6.80893418e-04, 9.12426593e-04,
+	-1.20294066e-03, 1.56308840e-03, -2.00477412e-03, 2.54128390e-03,
+	-3.18747056e-03, 3.96002194e-03, -4.87785458e-03, 5.96269332e-03,
+	-7.23992787e-03, 8.73988453e-03, -1.04997304e-02, 1.25663622e-02,
+	-1.50008688e-02, 1.78856010e-02, -2.13357267e-02, 2.55188992e-02,
+	-3.06904496e-02, 3.72604618e-02, -4.59323101e-02, 5.80205869e-02,
+	-7.62940235e-02, 1.07739144e-01, -1.76478875e-01, 4.59177172e-01,
+	7.92122603e-01, -2.11386263e-01, 1.20417674e-01, -8.28808105e-02,
+	6.20980264e-02, -4.87330182e-02, 3.93196219e-02, -3.22771184e-02,
+	2.67828328e-02, -2.23668268e-02, 1.87411427e-02, -1.57191807e-02,
+	1.31742110e-02, -1.10165422e-02, 9.18026840e-03, -7.61524252e-03,
+	6.28204640e-03, -5.14875519e-03, 4.18881325e-03, -3.37961991e-03,
+	2.70157871e-03, -2.13745454e-03, 1.67193765e-03, -1.29134664e-03,
+	9.83424703e-04, -7.37197111e-04, 5.42867679e-04, -3.91738773e-04,
+	2.76144063e-04, -1.89386802e-04, 1.25679017e-04, -8.00789274e-05,
+	4.84253581e-05, -2.72689887e-05, 1.38010155e-05, -5.78031200e-06,
+	-4.24638642e-06, 1.10241550e-05, -2.26705274e-05, 4.12606785e-05,
+	-6.94113356e-05, 1.10352982e-04, -1.68000924e-04, 2.47024057e-04,
+	-3.52910592e-04, 4.92030683e-04, -6.71696838e-04, 9.00224342e-04,
+	-1.18699567e-03, 1.54253525e-03, -1.97860418e-03, 2.50832874e-03,
+	-3.14638266e-03, 3.90925176e-03, -4.81562193e-03, 5.88695060e-03,
+	-7.14831110e-03, 8.62964625e-03, -1.03676453e-02, 1.24085909e-02,
+	-1.48127567e-02, 1.76613714e-02, -2.10680008e-02, 2.51979103e-02,
+	-3.03026997e-02, 3.67862755e-02, -4.53410152e-02, 5.72599531e-02,
+	-7.52633681e-02, 1.06203318e-01, -1.73658563e-01, 4.48490217e-01,
+	8.00311299e-01, -2.10240846e-01, 1.19482017e-01, -8.21607989e-02,
+	6.15293981e-02, -4.82735068e-02, 3.89422843e-02, -3.19639745e-02,
+	2.65212643e-02, -2.21475694e-02, 1.85571260e-02, -1.55648292e-02,
+	1.30450075e-02, -1.09087455e-02, 9.09072636e-03, -7.54126379e-03,
+	6.22131171e-03, -5.09925352e-03, 4.14879516e-03, -3.34756219e-03,
+	2.67615678e-03, -2.11752019e-03, 1.65650019e-03, -1.27955665e-03,
+	9.74559405e-04, -7.30646935e-04, 5.38123801e-04, -3.88381387e-04,
+	2.73831342e-04, -1.87844527e-04, 1.24690894e-04, -7.94776167e-05,
+	4.80842718e-05, -2.70948714e-05, 1.37273429e-05, -5.76150975e-06,
+	-4.15798111e-06, 1.08242585e-05, -2.22870621e-05, 4.05929556e-05,
+	-6.83230479e-05, 1.08664340e-04, -1.65479961e-04, 2.43377134e-04,
+	-3.47772146e-04, 4.84952252e-04, -6.62135377e-04, 8.87529806e-04,
+	-1.17039778e-03, 1.52112925e-03, -1.95133528e-03, 2.47397467e-03,
+	-3.10353361e-03, 3.85628629e-03, -4.75067721e-03, 5.80788408e-03,
+	-7.05264956e-03, 8.51451610e-03, -1.02296746e-02, 1.22437682e-02,
+	-1.46162222e-02, 1.74271003e-02, -2.07883054e-02, 2.48626300e-02,
+	-2.98978149e-02, 3.62913906e-02, -4.47244112e-02, 5.64677778e-02,
+	-7.41922240e-02, 1.04613098e-01, -1.70761177e-01, 4.37794060e-01,
+	8.08370385e-01, -2.08954335e-01, 1.18467502e-01, -8.13874190e-02,
+	6.09212126e-02, -4.77831656e-02, 3.85401830e-02, -3.16305603e-02,
+	2.62429052e-02, -2.19143031e-02, 1.83613750e-02, -1.54006339e-02,
+	1.29075495e-02, -1.07940404e-02, 8.99542068e-03, -7.46249730e-03,
+	6.15662100e-03, -5.04650350e-03, 4.10612887e-03, -3.31336294e-03,
+	2.64901866e-03, -2.09622423e-03, 1.63999443e-03, -1.26693880e-03,
+	9.65061325e-04, -7.23620475e-04, 5.33027590e-04, -3.84768445e-04,
+	2.71337414e-04, -1.86177127e-04, 1.23619060e-04, -7.88224382e-05,
+	4.77101960e-05, -2.69018550e-05, 1.36438534e-05, -5.73839262e-06,
+	-4.06819769e-06, 1.06198238e-05, -2.18933857e-05, 3.99057035e-05,
+	-6.72008276e-05, 1.06920485e-04, -1.62873442e-04, 2.39602626e-04,
+	-3.42449308e-04, 4.77614231e-04, -6.52216579e-04, 8.74352892e-04,
+	-1.15315981e-03, 1.49888679e-03, -1.92298811e-03, 2.43824759e-03,
+	-3.05895546e-03, 3.80116490e-03, -4.68306840e-03, 5.72555183e-03,
+	-6.95301315e-03, 8.39457785e-03, -1.00859184e-02, 1.20720132e-02,
+	-1.44114074e-02, 1.71829564e-02, -2.04968422e-02, 2.45133005e-02,
+	-2.94760890e-02, 3.57761691e-02, -4.40829543e-02, 5.56446575e-02,
+	-7.30814178e-02, 1.02969751e-01, -1.67789074e-01, 4.27092207e-01,
+	8.16297011e-01, -2.07525770e-01, 1.17374175e-01, -8.05608615e-02,
+	6.02736724e-02, -4.72621802e-02, 3.81134810e-02, -3.12770164e-02,
+	2.59478758e-02, -2.16671298e-02, 1.81539757e-02, -1.52266673e-02,
+	1.27618973e-02, -1.06724766e-02, 8.89439252e-03, -7.37897664e-03,
+	6.08800143e-03, -4.99052687e-03, 4.06083159e-03, -3.27703562e-03,
+	2.62017471e-03, -2.07357455e-03, 1.62242625e-03, -1.25349736e-03,
+	9.54933502e-04, -7.16119827e-04, 5.27580437e-04, -3.80900824e-04,
+	2.68662795e-04, -1.84384868e-04, 1.22463626e-04, -7.81134050e-05,
+	4.73030944e-05, -2.66898833e-05, 1.35504894e-05, -5.71091219e-06,
+	-3.97712730e-06, 1.04110441e-05, -2.14898538e-05, 3.91995236e-05,
+	-6.60456321e-05, 1.05122875e-04, -1.60183506e-04, 2.35703587e-04,
+	-3.36946323e-04, 4.70022400e-04, -6.41948168e-04, 8.60703759e-04,
+	-1.13529493e-03, 1.47582471e-03, -1.89358396e-03, 2.40117413e-03,
+	-3.01268120e-03, 3.74392812e-03, -4.61284491e-03, 5.64001370e-03,
+	-6.84947396e-03, 8.26991792e-03, -9.93647985e-03, 1.18934490e-02,
+	-1.41984585e-02, 1.69291143e-02, -2.01938196e-02, 2.41501721e-02,
+	-2.90378255e-02, 3.52409843e-02, -4.34171144e-02, 5.47912048e-02,
+	-7.19317954e-02, 1.01274568e-01, -1.64744627e-01, 4.16388154e-01,
+	8.24088366e-01, -2.05954243e-01, 1.16202128e-01, -7.96813489e-02,
+	5.95870039e-02, -4.67107552e-02, 3.76623565e-02, -3.09034960e-02,
+	2.56363065e-02, -2.14061601e-02, 1.79350217e-02, -1.50430076e-02,
+	1.26081164e-02, -1.05441087e-02, 8.78768663e-03, -7.29073839e-03,
+	6.01548265e-03, -4.93134741e-03, 4.01292220e-03, -3.23859503e-03,
+	2.58963638e-03, -2.04957986e-03, 1.60380218e-03, -1.23923712e-03,
+	9.44179375e-04, -7.08147386e-04, 5.21783954e-04, -3.76779562e-04,
+	2.65808111e-04, -1.82468096e-04, 1.21224752e-04, -7.73505649e-05,
+	4.68629514e-05, -2.64589120e-05, 1.34471997e-05, -5.67902262e-06,
+	-3.88486073e-06, 1.01981131e-05, -2.10768253e-05, 3.84750244e-05,
+	-6.48584329e-05, 1.03272990e-04, -1.57412333e-04, 2.31683128e-04,
+	-3.31267525e-04, 4.62182667e-04, -6.31338051e-04, 8.46592810e-04,
+	-1.11681663e-03, 1.45196029e-03, -1.86314469e-03, 2.36278163e-03,
+	-2.96474475e-03, 3.68461763e-03, -4.54005759e-03, 5.55133132e-03,
+	-6.74210626e-03, 8.14062535e-03, -9.78146533e-03, 1.17082022e-02,
+	-1.39775265e-02, 1.66657535e-02, -1.98794523e-02, 2.37735026e-02,
+	-2.85833367e-02, 3.46862202e-02, -4.27273741e-02, 5.39080478e-02,
+	-7.07442216e-02, 9.95288606e-02, -1.61630225e-01, 4.05685385e-01,
+	8.31741687e-01, -2.04238903e-01, 1.14951497e-01, -7.87491360e-02,
+	5.88614581e-02, -4.61291143e-02, 3.71870031e-02, -3.05101647e-02,
+	2.53083383e-02, -2.11315135e-02, 1.77046134e-02, -1.48497394e-02,
+	1.24462774e-02, -1.04089950e-02, 8.67535132e-03, -7.19782207e-03,
+	5.93909674e-03, -4.86899093e-03, 3.96242122e-03, -3.19805732e-03,
+	2.55741621e-03, -2.02424976e-03, 1.58412941e-03, -1.22416341e-03,
+	9.32802780e-04, -6.99705851e-04, 5.15639979e-04, -3.72405860e-04,
+	2.62774107e-04, -1.80427239e-04, 1.19902653e-04, -7.65339998e-05,
+	4.63897726e-05, -2.62089088e-05, 1.33339392e-05, -5.64268076e-06,
+	-3.79148836e-06, 9.98122536e-06, -2.06546614e-05, 3.77328207e-05,
+	-6.36402141e-05, 1.01372334e-04, -1.54562139e-04, 2.27544416e-04,
+	-3.25417332e-04, 4.54101061e-04, -6.20394302e-04, 8.32030684e-04,
+	-1.09773873e-03, 1.42731120e-03, -1.83169269e-03, 2.32309815e-03,
+	-2.91518089e-03, 3.62327623e-03, -4.46475869e-03, 5.45956803e-03,
+	-6.63098637e-03, 8.00679172e-03, -9.62098429e-03, 1.15164034e-02,
+	-1.37487666e-02, 1.63930591e-02, -1.95539610e-02, 2.33835571e-02,
+	-2.81129439e-02, 3.41122714e-02, -4.20142288e-02, 5.29958299e-02,
+	-6.95195795e-02, 9.77339624e-02, -1.58448272e-01, 3.94987373e-01,
+	8.39254254e-01, -2.02378955e-01, 1.13622463e-01, -7.77645094e-02,
+	5.80973097e-02, -4.55174998e-02, 3.66876295e-02, -3.00972005e-02,
+	2.49641222e-02, -2.08433178e-02, 1.74628588e-02, -1.46469531e-02,
+	1.22764559e-02, -1.02671986e-02, 8.55743845e-03, -7.10027021e-03,
+	5.85887825e-03, -4.80348523e-03, 3.90935082e-03, -3.15543996e-03,
+	2.52352779e-03, -1.99759467e-03, 1.56341583e-03, -1.20828205e-03,
+	9.20807954e-04, -6.90798219e-04, 5.09150570e-04, -3.67781080e-04,
+	2.59561641e-04, -1.78262801e-04, 1.18497597e-04, -7.56638263e-05,
+	4.58835848e-05, -2.59398538e-05, 1.32106692e-05, -5.60184621e-06,
+	-3.69710007e-06, 9.76057564e-06, -2.02237261e-05, 3.69735338e-05,
+	-6.23919720e-05, 9.94224337e-05, -1.51635174e-04, 2.23290676e-04,
+	-3.19400245e-04, 4.45783732e-04, -6.09125165e-04, 8.17028249e-04,
+	-1.07807533e-03, 1.40189556e-03, -1.79925088e-03, 2.28215242e-03,
+	-2.86402531e-03, 3.55994782e-03, -4.38700180e-03, 5.36478883e-03,
+	-6.51619269e-03, 7.86851108e-03, -9.45514918e-03, 1.13181865e-02,
+	-1.35123386e-02, 1.61112213e-02, -1.92175729e-02, 2.29806081e-02,
+	-2.76269767e-02, 3.35195426e-02, -4.12781861e-02, 5.20552092e-02,
+	-6.82587696e-02, 9.58912261e-02, -1.55201184e-01, 3.84297575e-01,
+	8.46623396e-01, -2.00373663e-01, 1.12215253e-01, -7.67277881e-02,
+	5.72948576e-02, -4.48761729e-02, 3.61644595e-02, -2.96647939e-02,
+	2.46038198e-02, -2.05417095e-02, 1.72098728e-02, -1.44347454e-02,
+	1.20987326e-02, -1.01187864e-02, 8.43400342e-03, -6.99812823e-03,
+	5.77486416e-03, -4.73486013e-03, 3.85373482e-03, -3.11076175e-03,
+	2.48798578e-03, -1.96962586e-03, 1.54166999e-03, -1.19159941e-03,
+	9.08199530e-04, -6.81427790e-04, 5.02318011e-04, -3.62906748e-04,
+	2.56171689e-04, -1.75975370e-04, 1.17009906e-04, -7.47401957e-05,
+	4.53444362e-05, -2.56517391e-05, 1.30773573e-05, -5.55648138e-06,
+	-3.60178521e-06, 9.53635912e-06, -1.97843855e-05, 3.61977905e-05,
+	-6.11147143e-05, 9.74248338e-05, -1.48633723e-04, 2.18925183e-04,
+	-3.13220842e-04, 4.37236942e-04, -5.97539042e-04, 8.01596592e-04,
+	-1.05784086e-03, 1.37573186e-03, -1.76584271e-03, 2.23997383e-03,
+	-2.81131451e-03, 3.49467734e-03, -4.30684184e-03, 5.26706036e-03,
+	-6.39780560e-03, 7.72587993e-03, -9.28407535e-03, 1.11136892e-02,
+	-1.32684062e-02, 1.58204351e-02, -1.88705209e-02, 2.25649351e-02,
+	-2.71257736e-02, 3.29084487e-02, -4.05197655e-02, 5.10868583e-02,
+	-6.69627097e-02, 9.40020237e-02, -1.51891392e-01, 3.73619435e-01,
+	8.53846491e-01, -1.98222346e-01, 1.10730137e-01, -7.56393228e-02,
+	5.64544248e-02, -4.42054135e-02, 3.56177319e-02, -2.92131474e-02,
+	2.42276026e-02, -2.02268335e-02, 1.69457776e-02, -1.42132187e-02,
+	1.19131931e-02, -9.96382971e-03, 8.30510516e-03, -6.89144451e-03,
+	5.68709384e-03, -4.66314745e-03, 3.79559865e-03, -3.06404281e-03,
+	2.45080591e-03, -1.94035547e-03, 1.51890107e-03, -1.17412236e-03,
+	8.94982539e-04, -6.71598161e-04, 4.95144805e-04, -3.57784551e-04,
+	2.52605340e-04, -1.73565611e-04, 1.15439957e-04, -7.37632945e-05,
+	4.47723966e-05, -2.53445695e-05, 1.29339776e-05, -5.50655156e-06,
+	-3.50563251e-06, 9.30877117e-06, -1.93370077e-05, 3.54062229e-05,
+	-5.98094597e-05, 9.53810997e-05, -1.45560104e-04, 2.14451264e-04,
+	-3.06883779e-04, 4.28467062e-04, -5.85644491e-04, 7.85747014e-04,
+	-1.03705002e-03, 1.34883896e-03, -1.73149213e-03, 2.19659244e-03,
+	-2.75708582e-03, 3.42751079e-03, -4.22433501e-03, 5.16645084e-03,
+	-6.27590742e-03, 7.57899708e-03, -9.10788101e-03, 1.09030525e-02,
+	-1.30171372e-02, 1.55209005e-02, -1.85130438e-02, 2.21368245e-02,
+	-2.66096807e-02, 3.22794143e-02, -3.97394982e-02, 5.00914633e-02,
+	-6.56323339e-02, 9.20677457e-02, -1.48521334e-01, 3.62956378e-01,
+	8.60920963e-01, -1.95924381e-01, 1.09167433e-01, -7.44994964e-02,
+	5.55763579e-02, -4.35055201e-02, 3.50477004e-02, -2.87424759e-02,
+	2.38356523e-02, -1.98988431e-02, 1.66707022e-02, -1.39824815e-02,
+	1.17199282e-02, -9.80240398e-03, 8.17080604e-03, -6.78027029e-03,
+	5.59560910e-03, -4.58838097e-03, 3.73496936e-03, -3.01530457e-03,
+	2.41200495e-03, -1.90979646e-03, 1.49511896e-03, -1.15585827e-03,
+	8.81162404e-04, -6.61313230e-04, 4.87633681e-04, -3.52416338e-04,
+	2.48863799e-04, -1.71034271e-04, 1.13788179e-04, -7.27333440e-05,
+	4.41675572e-05, -2.50183622e-05, 1.27805110e-05, -5.45202498e-06,
+	-3.40873001e-06, 9.07800714e-06, -1.88819623e-05, 3.45994677e-05,
+	-5.84772365e-05, 9.32928145e-05, -1.42416662e-04, 2.09872292e-04,
+	-3.00393783e-04, 4.19480569e-04, -5.73450219e-04, 7.69491024e-04,
+	-1.01571778e-03, 1.32123612e-03, -1.69622354e-03, 2.15203889e-03,
+	-2.70137736e-03, 3.35849513e-03, -4.13953876e-03, 5.06303003e-03,
+	-6.15058233e-03, 7.42796367e-03, -8.92668711e-03, 1.06864205e-02,
+	-1.27587036e-02, 1.52128222e-02, -1.81453858e-02, 2.16965693e-02,
+	-2.60790525e-02, 3.16328732e-02, -3.89379266e-02, 4.90697241e-02,
+	-6.42685923e-02, 9.00897998e-02, -1.45093461e-01, 3.52311813e-01,
+	8.67844290e-01, -1.93479206e-01, 1.07527503e-01, -7.33087237e-02,
+	5.46610273e-02, -4.27768097e-02, 3.44546335e-02, -2.82530065e-02,
+	2.34281605e-02, -1.95579001e-02, 1.63847829e-02, -1.37426481e-02,
+	1.15190334e-02, -9.63458875e-03, 8.03117193e-03, -6.66465973e-03,
+	5.50045413e-03, -4.51059644e-03, 3.67187560e-03, -2.96456976e-03,
+	2.37160073e-03, -1.87796261e-03, 1.47033417e-03, -1.13681507e-03,
+	8.66744944e-04, -6.50577189e-04, 4.79787586e-04, -3.46804120e-04,
+	2.44948389e-04, -1.68382176e-04, 1.12055057e-04, -7.16506006e-05,
+	4.35300314e-05, -2.46731470e-05, 1.26169448e-05, -5.39287286e-06,
+	-3.31116504e-06, 8.84426229e-06, -1.84196205e-05, 3.37781662e-05,
+	-5.71190826e-05, 9.11615788e-05, -1.39205775e-04, 2.05191688e-04,
+	-2.93755647e-04, 4.10284042e-04, -5.60965073e-04, 7.52840324e-04,
+	-9.93859403e-04, 1.29294294e-03, -1.66006186e-03, 2.10634447e-03,
+	-2.64422802e-03, 3.28767832e-03, -4.05251173e-03, 4.95686916e-03,
+	-6.02191637e-03, 7.27288302e-03, -8.74061729e-03, 1.04639408e-02,
+	-1.24932810e-02, 1.48964096e-02, -1.77677968e-02, 2.12444690e-02,
+	-2.55342509e-02, 3.09692687e-02, -3.81156041e-02, 4.80223533e-02,
+	-6.28724500e-02, 8.80696104e-02, -1.41610230e-01, 3.41689130e-01,
+	8.74613999e-01, -1.90886316e-01, 1.05810757e-01, -7.20674515e-02,
+	5.37088273e-02, -4.20196176e-02, 3.38388144e-02, -2.77449780e-02,
+	2.30053288e-02, -1.92041745e-02, 1.60881627e-02, -1.34938386e-02,
+	1.13106093e-02, -9.46046771e-03, 7.88627209e-03, -6.54466981e-03,
+	5.40167545e-03, -4.42983155e-03, 3.60634764e-03, -2.91186241e-03,
+	2.32961212e-03, -1.84486857e-03, 1.44455790e-03, -1.11700114e-03,
+	8.51736370e-04, -6.39394532e-04, 4.71609689e-04, -3.40950068e-04,
+	2.40860543e-04, -1.65610235e-04, 1.10241130e-04, -7.05153563e-05,
+	4.28599542e-05, -2.43089665e-05, 1.24432733e-05, -5.32906948e-06,
+	-3.21302412e-06, 8.60773163e-06, -1.79503546e-05, 3.29429632e-05,
+	-5.57360442e-05, 8.89890087e-05, -1.35929845e-04, 2.00412913e-04,
+	-2.86974235e-04, 4.00884152e-04, -5.48198040e-04, 7.35806808e-04,
+	-9.71490388e-04, 1.26397935e-03, -1.62303240e-03, 2.05954101e-03,
+	-2.58567744e-03, 3.21510924e-03, -3.96331374e-03, 4.84804092e-03,
+	-5.88999731e-03, 7.11386064e-03, -8.54979780e-03, 1.02357641e-02,
+	-1.22210489e-02, 1.45718764e-02, -1.73805320e-02, 2.07808295e-02,
+	-2.49756454e-02, 3.02890527e-02, -3.72730945e-02, 4.69500761e-02,
+	-6.14448869e-02, 8.60086175e-02, -1.38074107e-01, 3.31091696e-01,
+	8.81227670e-01, -1.88145268e-01, 1.04017647e-01, -7.07761580e-02,
+	5.27201754e-02, -4.12342973e-02, 3.32005410e-02, -2.72186413e-02,
+	2.25673688e-02, -1.88378443e-02, 1.57809916e-02, -1.32361789e-02,
+	1.10947611e-02, -9.28012857e-03, 7.73617921e-03, -6.42036035e-03,
+	5.29932197e-03, -4.34612594e-03, 3.53841729e-03, -2.85720783e-03,
+	2.28605902e-03, -1.81052978e-03, 1.41780196e-03, -1.09642541e-03,
+	8.36143279e-04, -6.27770042e-04, 4.63103380e-04, -3.34856516e-04,
+	2.36601815e-04, -1.62719433e-04, 1.08346991e-04, -6.93279382e-05,
+	4.21574826e-05, -2.39258761e-05, 1.22594974e-05, -5.26059227e-06,
+	-3.11439291e-06, 8.36860980e-06, -1.74745377e-05, 3.20945074e-05,
+	-5.43291755e-05, 8.67767353e-05, -1.32591299e-04, 1.95539472e-04,
+	-2.80054468e-04, 3.91287665e-04, -5.35158235e-04, 7.18402551e-04,
+	-9.48626489e-04, 1.23436564e-03, -1.58516096e-03, 2.01166092e-03,
+	-2.52576594e-03, 3.14083766e-03, -3.87200572e-03, 4.73661939e-03,
+	-5.75491465e-03, 6.95100407e-03, -8.35435740e-03, 1.00020440e-02,
+	-1.19421904e-02, 1.42394407e-02, -1.69838515e-02, 2.03059627e-02,
+	-2.44036127e-02, 2.95926858e-02, -3.64109717e-02, 4.58536297e-02,
+	-5.99868967e-02, 8.39082761e-02, -1.34487563e-01, 3.20522856e-01,
+	8.87682938e-01, -1.85255676e-01, 1.02148674e-01, -6.94353533e-02,
+	5.16955126e-02, -4.04212204e-02, 3.25401253e-02, -2.66742590e-02,
+	2.21145014e-02, -1.84590960e-02, 1.54634263e-02, -1.29698005e-02,
+	1.08715989e-02, -9.09366308e-03, 7.58096930e-03, -6.29179398e-03,
+	5.19344488e-03, -4.25952115e-03, 3.46811797e-03, -2.80063261e-03,
+	2.24096235e-03, -1.77496251e-03, 1.39007883e-03, -1.07509729e-03,
+	8.19972658e-04, -6.15708800e-04, 4.54272267e-04, -3.28525956e-04,
+	2.32173869e-04, -1.59710838e-04, 1.06373285e-04, -6.80887088e-05,
+	4.14227957e-05, -2.35239443e-05, 1.20656251e-05, -5.18742180e-06,
+	-3.01535617e-06, 8.12709090e-06, -1.69925436e-05, 3.12334501e-05,
+	-5.28995375e-05, 8.45264034e-05, -1.29192591e-04, 1.90574905e-04,
+	-2.73001329e-04, 3.81501433e-04, -5.21854898e-04, 7.00639799e-04,
+	-9.25283692e-04, 1.20412238e-03, -1.54647370e-03, 1.96273714e-03,
+	-2.46453457e-03, 3.06491424e-03, -3.77864971e-03, 4.62267998e-03,
+	-5.61675954e-03, 6.78442291e-03, -8.15442727e-03, 9.76293709e-03,
+	-1.16568920e-02, 1.38993246e-02, -1.65780206e-02, 1.98201863e-02,
+	-2.38185365e-02, 2.88806367e-02, -3.55298195e-02, 4.47337629e-02,
+	-5.84994864e-02, 8.17700546e-02, -1.30853075e-01, 3.09985934e-01,
+	8.93977491e-01, -1.82217217e-01, 1.00204383e-01, -6.80455790e-02,
+	5.06353030e-02, -3.95807766e-02, 3.18578940e-02, -2.61121055e-02,
+	2.16469576e-02, -1.80681237e-02, 1.51356302e-02, -1.26948408e-02,
+	1.06412376e-02, -8.90116694e-03, 7.42072172e-03, -6.15903608e-03,
+	5.08409770e-03, -4.17006061e-03, 3.39548461e-03, -2.74216458e-03,
+	2.19434405e-03, -1.73818384e-03, 1.36140162e-03, -1.05302670e-03,
+	8.03231879e-04, -6.03216177e-04, 4.45120174e-04, -3.21961040e-04,
+	2.27578486e-04, -1.56585598e-04, 1.04320715e-04, -6.67980660e-05,
+	4.06560947e-05, -2.31032522e-05, 1.18616711e-05, -5.10954189e-06,
+	-2.91599769e-06, 7.88336839e-06, -1.65047466e-05, 3.03604451e-05,
+	-5.14481979e-05, 8.22396702e-05, -1.25736194e-04, 1.85522790e-04,
+	-2.65819854e-04, 3.71532388e-04, -5.08297385e-04, 6.82530965e-04,
+	-9.01478211e-04, 1.17327046e-03, -1.50699722e-03, 1.91280313e-03,
+	-2.40202502e-03, 2.98739045e-03, -3.68330876e-03, 4.50629940e-03,
+	-5.47562470e-03, 6.61422866e-03, -7.95014093e-03, 9.51860275e-03,
+	-1.13653437e-02, 1.35517546e-02, -1.61633093e-02, 1.93238239e-02,
+	-2.32208070e-02, 2.81533823e-02, -3.46302311e-02, 4.35912353e-02,
+	-5.69836758e-02, 7.95954350e-02, -1.27173122e-01, 2.99484228e-01,
+	9.00109074e-01, -1.79029628e-01, 9.81853656e-02, -6.66074078e-02,
+	4.95400337e-02, -3.87133730e-02, 3.11541878e-02, -2.55324664e-02,
+	2.11649776e-02, -1.76651298e-02, 1.47977736e-02, -1.24114425e-02,
+	1.04037968e-02, -8.70273980e-03, 7.25551911e-03, -6.02215477e-03,
+	4.97133619e-03, -4.07778962e-03, 3.32055370e-03, -2.68183284e-03,
+	2.14622707e-03, -1.70021164e-03, 1.33178409e-03, -1.03022406e-03,
+	7.85928692e-04, -5.90297834e-04, 4.35651144e-04, -3.15164579e-04,
+	2.22817558e-04, -1.53344938e-04, 1.02190035e-04, -6.54564433e-05,
+	3.98576029e-05, -2.26638942e-05, 1.16476575e-05, -5.02693963e-06,
+	-2.81640024e-06, 7.63763497e-06, -1.60115208e-05, 2.94761486e-05,
+	-4.99762298e-05, 7.99182045e-05, -1.22224603e-04, 1.80386739e-04,
+	-2.58515134e-04, 3.61387542e-04, -4.94495167e-04, 6.64088617e-04,
+	-8.77226472e-04, 1.14183107e-03, -1.46675849e-03, 1.86189284e-03,
+	-2.33827960e-03, 2.90831859e-03, -3.58604695e-03, 4.38755561e-03,
+	-5.33160440e-03, 6.44053470e-03, -7.74163418e-03, 9.26920312e-03,
+	-1.10677387e-02, 1.31969607e-02, -1.57399921e-02, 1.88172043e-02,
+	-2.26108212e-02, 2.74114068e-02, -3.37128086e-02, 4.24268173e-02,
+	-5.54404967e-02, 7.73859110e-02, -1.23450186e-01, 2.89021008e-01,
+	9.06075487e-01, -1.75692708e-01, 9.60922588e-02, -6.51214439e-02,
+	4.84102146e-02, -3.78194346e-02, 3.04293613e-02, -2.49356390e-02,
+	2.06688111e-02, -1.72503242e-02, 1.44500329e-02, -1.21197539e-02,
+	1.01594005e-02, -8.49848515e-03, 7.08544734e-03, -5.88122089e-03,
+	4.85521839e-03, -3.98275536e-03, 3.24336324e-03, -2.61966771e-03,
+	2.09663535e-03, -1.66106460e-03, 1.30124060e-03, -1.00670026e-03,
+	7.68071229e-04, -5.76959718e-04, 4.25869432e-04, -3.08139542e-04,
+	2.17893094e-04, -1.49990166e-04, 9.99820549e-05, -6.40643092e-05,
+	3.90275658e-05, -2.22059777e-05, 1.14236132e-05, -4.93960546e-06,
+	-2.71664552e-06, 7.39008242e-06, -1.55132405e-05, 2.85812182e-05,
+	-4.84847111e-05, 7.75636853e-05, -1.18660330e-04, 1.75170392e-04,
+	-2.51092306e-04, 3.51073979e-04, -4.80457817e-04, 6.45325471e-04,
+	-8.52545106e-04, 1.10982565e-03, -1.42578481e-03, 1.81004069e-03,
+	-2.27334123e-03, 2.82775169e-03, -3.48692930e-03, 4.26652775e-03,
+	-5.18479436e-03, 6.26345618e-03, -7.52904497e-03, 9.01490291e-03,
+	-1.07642732e-02, 1.28351768e-02, -1.53083481e-02, 1.83006617e-02,
+	-2.19889821e-02, 2.66552021e-02, -3.27781629e-02, 4.12412892e-02,
+	-5.38709923e-02, 7.51429875e-02, -1.19686752e-01, 2.78599520e-01,
+	9.11874588e-01, -1.72206317e-01, 9.39257456e-02, -6.35883221e-02,
+	4.72463784e-02, -3.68994036e-02, 2.96837829e-02, -2.43219317e-02,
+	2.01587171e-02, -1.68239248e-02, 1.40925913e-02, -1.18199288e-02,
+	9.90817757e-03, -8.28851035e-03, 6.91059550e-03, -5.73630794e-03,
+	4.73580451e-03, -3.88500680e-03, 3.16395274e-03, -2.55570075e-03,
+	2.04559381e-03, -1.62076218e-03, 1.26978617e-03, -9.82466691e-04,
+	7.49667996e-04, -5.63208063e-04, 4.15779511e-04, -3.00889054e-04,
+	2.12807212e-04, -1.46522665e-04, 9.76976370e-05, -6.26221680e-05,
+	3.81662511e-05, -2.17296233e-05, 1.11895744e-05, -4.84753319e-06,
+	-2.61681408e-06, 7.14090149e-06, -1.50102795e-05, 2.76763127e-05,
+	-4.69747242e-05, 7.51778008e-05, -1.15045905e-04, 1.69877421e-04,
+	-2.43556552e-04, 3.40598850e-04, -4.66195008e-04, 6.26254383e-04,
+	-8.27450933e-04, 1.07727591e-03, -1.38410386e-03, 1.75728154e-03,
+	-2.20725343e-03, 2.74574353e-03, -3.38602177e-03, 4.14329611e-03,
+	-5.03529170e-03, 6.08310999e-03, -7.31251332e-03, 8.75586936e-03,
+	-1.04551466e-02, 1.24666404e-02, -1.48686606e-02, 1.77745353e-02,
+	-2.13556987e-02, 2.58852668e-02, -3.18269130e-02, 4.00354411e-02,
+	-5.22762164e-02, 7.28681802e-02, -1.15885303e-01, 2.68222979e-01,
+	9.17504294e-01, -1.68570378e-01, 9.16865542e-02, -6.20087083e-02,
+	4.60490800e-02, -3.59537393e-02, 2.89178349e-02, -2.36916641e-02,
+	1.96349637e-02, -1.63861569e-02, 1.37256383e-02, -1.15121261e-02,
+	9.65026106e-03, -8.07292650e-03, 6.73105581e-03, -5.58749204e-03,
+	4.61315699e-03, -3.78459474e-03, 3.08236316e-03, -2.48996469e-03,
+	1.99312835e-03, -1.57932462e-03, 1.23743639e-03, -9.57535228e-04,
+	7.30727868e-04, -5.49049385e-04, 4.05386060e-04, -2.93416395e-04,
+	2.07562144e-04, -1.42943899e-04, 9.53376979e-05, -6.11305587e-05,
+	3.72739488e-05, -2.12349648e-05, 1.09455844e-05, -4.75072007e-06,
+	-2.51698532e-06, 6.89028179e-06, -1.45030110e-05, 2.67620917e-05,
+	-4.54473546e-05, 7.27622473e-05, -1.11383874e-04, 1.64511522e-04,
+	-2.35913098e-04, 3.29969370e-04, -4.51716506e-04, 6.06888341e-04,
+	-8.01960959e-04, 1.04420380e-03, -1.34174363e-03, 1.70365069e-03,
+	-2.14006023e-03, 2.66234860e-03, -3.28339117e-03, 4.01794207e-03,
+	-4.88319490e-03, 5.89961464e-03, -7.09218127e-03, 8.49227210e-03,
+	-1.01405612e-02, 1.20915923e-02, -1.44212169e-02, 1.72391692e-02,
+	-2.07113857e-02, 2.51021063e-02, -3.08596857e-02, 3.88100719e-02,
+	-5.06572330e-02, 7.05630135e-02, -1.12048320e-01, 2.57894571e-01,
+	9.22962582e-01, -1.64784876e-01, 8.93754587e-02, -6.03832986e-02,
+	4.48188963e-02, -3.49829183e-02, 2.81319128e-02, -2.30451664e-02,
+	1.90978280e-02, -1.59372534e-02, 1.33493697e-02, -1.11965103e-02,
+	9.38578864e-03, -7.85184840e-03, 6.54692363e-03, -5.43485192e-03,
+	4.48734039e-03, -3.68157175e-03, 2.99863695e-03, -2.42249348e-03,
+	1.93926584e-03, -1.53677292e-03, 1.20420751e-03, -9.31918216e-04,
+	7.11260092e-04, -5.34490480e-04, 3.94693971e-04, -2.85724999e-04,
+	2.02160232e-04, -1.39255410e-04, 9.29032073e-05, -5.95900561e-05,
+	3.63509709e-05, -2.07221491e-05, 1.06916938e-05, -4.64916683e-06,
+	-2.41723741e-06, 6.63841163e-06, -1.39918071e-05, 2.58392152e-05,
+	-4.39036908e-05, 7.03187279e-05, -1.07676797e-04, 1.59076415e-04,
+	-2.28167207e-04, 3.19192813e-04, -4.37032162e-04, 5.87240452e-04,
+	-7.76092354e-04, 1.01063151e-03, -1.29873243e-03, 1.64918384e-03,
+	-2.07180621e-03, 2.57762202e-03, -3.17910516e-03, 3.89054802e-03,
+	-4.72860370e-03, 5.71309020e-03, -6.86819272e-03, 8.22428304e-03,
+	-9.82072169e-03, 1.17102767e-02, -1.39663082e-02, 1.66949120e-02,
+	-2.00564631e-02, 2.43062326e-02, -2.98771154e-02, 3.75659893e-02,
+	-4.90151154e-02, 6.82290210e-02, -1.08178285e-01, 2.47617450e-01,
+	9.28247488e-01, -1.60849858e-01, 8.69932784e-02, -5.87128197e-02,
+	4.35564265e-02, -3.39874335e-02, 2.73264255e-02, -2.23827801e-02,
+	1.85475961e-02, -1.54774545e-02, 1.29639872e-02, -1.08732509e-02,
+	9.11490227e-03, -7.62539454e-03, 6.35829736e-03, -5.27846886e-03,
+	4.35842142e-03, -3.57599215e-03, 2.91281798e-03, -2.35332222e-03,
+	1.88403407e-03, -1.49312886e-03, 1.17011632e-03, -9.05628471e-04,
+	6.91274275e-04, -5.19538421e-04, 3.83708343e-04, -2.77818456e-04,
+	1.96603929e-04, -1.35458817e-04, 9.03951881e-05, -5.80012695e-05,
+	3.53976516e-05, -2.01913363e-05, 1.04279604e-05, -4.54287770e-06,
+	-2.31764726e-06, 6.38547795e-06, -1.34770392e-05, 2.49083429e-05,
+	-4.23448231e-05, 6.78489517e-05, -1.03927242e-04, 1.53575843e-04,
+	-2.20324175e-04, 3.08276505e-04, -4.22151907e-04, 5.67323941e-04,
+	-7.49862453e-04, 9.76581431e-04, -1.25509884e-03, 1.59391705e-03,
+	-2.00253642e-03, 2.49161956e-03, -3.07323216e-03, 3.76119736e-03,
+	-4.57161906e-03, 5.52365825e-03, -6.64069338e-03, 7.95207626e-03,
+	-9.49583579e-03, 1.13229408e-02, -1.35042294e-02, 1.61421166e-02,
+	-1.93913563e-02, 2.34981634e-02, -2.88798433e-02, 3.63040088e-02,
+	-4.73509458e-02, 6.58677435e-02, -1.04277675e-01, 2.37394739e-01,
+	9.33357108e-01, -1.56765434e-01, 8.45408780e-02, -5.69980280e-02,
+	4.22622910e-02, -3.29677946e-02, 2.65017949e-02, -2.17048567e-02,
+	1.79845625e-02, -1.50070078e-02, 1.25696991e-02, -1.05425225e-02,
+	8.83774821e-03, -7.39368697e-03, 6.16527841e-03, -5.11842665e-03,
+	4.22646886e-03, -3.46791199e-03, 2.82495156e-03, -2.28248719e-03,
+	1.82746179e-03, -1.44841495e-03, 1.13518026e-03, -8.78679273e-04,
+	6.70780384e-04, -5.04200555e-04, 3.72434481e-04, -2.69700503e-04,
+	1.90895798e-04, -1.31555816e-04, 8.78147159e-05, -5.63648435e-05,
+	3.44143474e-05, -1.96427000e-05, 1.01544494e-05, -4.43186049e-06,
+	-2.21829044e-06, 6.13166617e-06, -1.29590771e-05, 2.39701341e-05,
+	-4.07718432e-05, 6.53546322e-05, -1.00137793e-04, 1.48013564e-04,
+	-2.12389332e-04, 2.97227823e-04, -4.07085746e-04, 5.47152135e-04,
+	-7.23288732e-04, 9.42076175e-04, -1.21087171e-03, 1.53788676e-03,
+	-1.93229637e-03, 2.40439756e-03, -2.96584137e-03, 3.62997440e-03,
+	-4.41234308e-03, 5.33144174e-03, -6.40983070e-03, 7.67582791e-03,
+	-9.16611346e-03, 1.09298349e-02, -1.30352791e-02, 1.55811402e-02,
+	-1.87164953e-02, 2.26784222e-02, -2.78685176e-02, 3.50249536e-02,
+	-4.56658145e-02, 6.34807287e-02, -1.00348960e-01, 2.27229526e-01,
+	9.38289603e-01, -1.52531779e-01, 8.20191670e-02, -5.52397099e-02,
+	4.09371319e-02, -3.19245276e-02, 2.56584558e-02, -2.10117587e-02,
+	1.74090306e-02, -1.45261679e-02, 1.21667191e-02, -1.02045046e-02,
+	8.55447689e-03, -7.15685128e-03, 5.96797115e-03, -4.95481155e-03,
+	4.09155354e-03, -3.35738903e-03, 2.73508436e-03, -2.21002579e-03,
+	1.76957864e-03, -1.40265444e-03, 1.09941732e-03, -8.51084361e-04,
+	6.49788742e-04, -4.88484499e-04, 3.60877893e-04, -2.61375031e-04,
+	1.85038508e-04, -1.27548180e-04, 8.51629186e-05, -5.46814573e-05,
+	3.34014368e-05, -1.90764267e-05, 9.87123332e-06, -4.31612660e-06,
+	-2.11924119e-06, 5.87716008e-06, -1.24382890e-05, 2.30252472e-05,
+	-3.91858435e-05, 6.28374866e-05, -9.63110380e-05, 1.42393357e-04,
+	-2.04368035e-04, 2.86054187e-04, -3.91843748e-04, 5.26738460e-04,
+	-6.96388809e-04, 9.07138525e-04, -1.16608016e-03, 1.48112973e-03,
+	-1.86113201e-03, 2.31601292e-03, -2.85700267e-03, 3.49696434e-03,
+	-4.25087895e-03, 5.13656497e-03, -6.17575371e-03, 7.39571611e-03,
+	-8.83176708e-03, 1.05312120e-02, -1.25597588e-02, 1.50123439e-02,
+	-1.80323149e-02, 2.18475381e-02, -2.68437924e-02, 3.37296539e-02,
+	-4.39608189e-02, 6.10695299e-02, -9.63946080e-02, 2.17124865e-01,
+	9.43043193e-01, -1.48149129e-01, 7.94291002e-02, -5.34386811e-02,
+	3.95816122e-02, -3.08581743e-02, 2.47968557e-02, -2.03038583e-02,
+	1.68213121e-02, -1.40351963e-02, 1.17552671e-02, -9.85938186e-03,
+	8.26524290e-03, -6.91501653e-03, 5.76648284e-03, -4.78771224e-03,
+	3.95374831e-03, -3.24448266e-03, 2.64326446e-03, -2.13597653e-03,
+	1.71041520e-03, -1.35587130e-03, 1.06284608e-03, -8.22857924e-04,
+	6.28310021e-04, -4.72398139e-04, 3.49044287e-04, -2.52846077e-04,
+	1.79034838e-04, -1.23437758e-04, 8.24409766e-05, -5.29518247e-05,
+	3.23593201e-05, -1.84927165e-05, 9.57839207e-06, -4.19569106e-06,
+	-2.02057233e-06, 5.62214172e-06, -1.19150414e-05, 2.20743390e-05,
+	-3.75879161e-05, 6.02992348e-05, -9.24495740e-05, 1.36719012e-04,
+	-1.96265664e-04, 2.74763056e-04, -3.76436044e-04, 5.06096428e-04,
+	-6.69180422e-04, 8.71791444e-04, -1.12075352e-03, 1.42368302e-03,
+	-1.78908970e-03, 2.22652306e-03, -2.74678659e-03, 3.36225319e-03,
+	-4.08733088e-03, 4.93915349e-03, -5.93861297e-03, 7.11192080e-03,
+	-8.49301120e-03, 1.01273278e-02, -1.20779736e-02, 1.44360924e-02,
+	-1.73392541e-02, 2.10060449e-02, -2.58063277e-02, 3.24189465e-02,
+	-4.22370635e-02, 5.86357058e-02, -9.24170776e-02, 2.07083775e-01,
+	9.47616166e-01, -1.43617785e-01, 7.67716768e-02, -5.15957863e-02,
+	3.81964157e-02, -2.97692924e-02, 2.39174543e-02, -1.95815380e-02,
+	1.62217269e-02, -1.35343616e-02, 1.13355685e-02, -9.50734352e-03,
+	7.97020483e-03, -6.66831515e-03, 5.56092360e-03, -4.61721977e-03,
+	3.81312800e-03, -3.12925395e-03, 2.54954124e-03, -2.06037903e-03,
+	1.65000292e-03, -1.30809023e-03, 1.02548567e-03, -7.94014598e-04,
+	6.06355236e-04, -4.55949622e-04, 3.36939571e-04, -2.44117824e-04,
+	1.72887671e-04, -1.19226473e-04, 7.96501215e-05, -5.11766938e-05,
+	3.12884198e-05, -1.78917824e-05, 9.27601294e-06, -4.07057257e-06,
+	-1.92235525e-06, 5.36679132e-06, -1.13896988e-05, 2.11180648e-05,
+	-3.59791525e-05, 5.77415978e-05, -8.85560029e-05, 1.30994330e-04,
+	-1.88087621e-04, 2.63361925e-04, -3.60872819e-04, 4.85239633e-04,
+	-6.41681425e-04, 8.36058049e-04, -1.07492137e-03, 1.36558399e-03,
+	-1.71621615e-03, 2.13598587e-03, -2.63526427e-03, 3.22592772e-03,
+	-3.92180401e-03, 4.73933400e-03, -5.69856049e-03, 6.82462364e-03,
+	-8.15006248e-03, 9.71844023e-03, -1.15902312e-02, 1.38527540e-02,
+	-1.66377562e-02, 2.01544815e-02, -2.47567890e-02, 3.10936741e-02,
+	-4.04956588e-02, 5.61808187e-02, -8.84188201e-02, 1.97109235e-01,
+	9.52006869e-01, -1.38938110e-01, 7.40479404e-02, -4.97118992e-02,
+	3.67822466e-02, -2.86584550e-02, 2.30207237e-02, -1.88451902e-02,
+	1.56106030e-02, -1.30239388e-02, 1.09078546e-02, -9.14858363e-03,
+	7.66952526e-03, -6.41688292e-03, 5.35140632e-03, -4.44342754e-03,
+	3.66976938e-03, -3.01176554e-03, 2.45396544e-03, -1.98327400e-03,
+	1.58837411e-03, -1.25933662e-03, 9.87355790e-04, -7.64569454e-04,
+	5.83935743e-04, -4.39147356e-04, 3.24569846e-04, -2.35194603e-04,
+	1.66599998e-04, -1.14916322e-04, 7.67916364e-05, -4.93568470e-05,
+	3.01891801e-05, -1.72738509e-05, 8.96419062e-06, -3.94079354e-06,
+	-1.82465986e-06, 5.11128712e-06, -1.08626232e-05, 2.01570775e-05,
+	-3.43606426e-05, 5.51662969e-05, -8.46329300e-05, 1.25223123e-04,
+	-1.79839327e-04, 2.51858317e-04, -3.45164304e-04, 4.64181737e-04,
+	-6.13909774e-04, 7.99961601e-04, -1.02861343e-03, 1.30687026e-03,
+	-1.64255843e-03, 2.04445970e-03, -2.52250743e-03, 3.08807543e-03,
+	-3.75440439e-03, 4.53723432e-03, -5.45574957e-03, 6.53400792e-03,
+	-7.80313949e-03, 9.30480989e-03, -1.10968422e-02, 1.32627000e-02,
+	-1.59282681e-02, 1.92933910e-02, -2.36958467e-02, 2.97546848e-02,
+	-3.87377205e-02, 5.37064341e-02, -8.44022775e-02, 1.87204188e-01,
+	9.56213717e-01, -1.34110533e-01, 7.12589789e-02, -4.77879217e-02,
+	3.53398292e-02, -2.75262504e-02, 2.21071478e-02, -1.80952168e-02,
+	1.49882763e-02, -1.25042098e-02, 1.04723619e-02, -8.78330081e-03,
+	7.36337061e-03, -6.16085884e-03, 5.13804664e-03, -4.26643120e-03,
+	3.52375111e-03, -2.89208165e-03, 2.35658906e-03, -1.90470316e-03,
+	1.52556196e-03, -1.20963653e-03, 9.48476692e-04, -7.34537995e-04,
+	5.61063233e-04, -4.22000005e-04, 3.11941410e-04, -2.26080884e-04,
+	1.60174909e-04, -1.10509379e-04, 7.38668551e-05, -4.74931003e-05,
+	2.90620667e-05, -1.66391614e-05, 8.64302724e-06, -3.80638010e-06,
+	-1.72755454e-06, 4.85580531e-06, -1.03341743e-05, 1.91920274e-05,
+	-3.27334742e-05, 5.25750526e-05, -8.06829626e-05, 1.19409209e-04,
+	-1.71526213e-04, 2.40259781e-04, -3.29320770e-04, 4.42936464e-04,
+	-5.85883514e-04, 7.63525491e-04, -9.81859655e-04, 1.24757967e-03,
+	-1.56816391e-03, 1.95200328e-03, -2.40858829e-03, 2.94878444e-03,
+	-3.58523886e-03, 4.33298325e-03, -5.21033478e-03, 6.24025841e-03,
+	-7.45246260e-03, 8.88669933e-03, -1.05981198e-02, 1.26663050e-02,
+	-1.52112401e-02, 1.84233204e-02, -2.26241758e-02, 2.84028318e-02,
+	-3.69643693e-02, 5.12141200e-02, -8.03698815e-02, 1.77371538e-01,
+	9.60235192e-01, -1.29135545e-01, 6.84059240e-02, -4.58247838e-02,
+	3.38699078e-02, -2.63732818e-02, 2.11772223e-02, -1.73320291e-02,
+	1.43550904e-02, -1.19754627e-02, 1.00293324e-02, -8.41169819e-03,
+	7.05191108e-03, -5.90038511e-03, 4.92096282e-03, -4.08632864e-03,
+	3.37515370e-03, -2.77026804e-03, 2.25746539e-03, -1.82470933e-03,
+	1.46160049e-03, -1.15901673e-03, 9.08869153e-04, -7.03936145e-04,
+	5.37749723e-04, -4.04516484e-04, 2.99060747e-04, -2.16781280e-04,
+	1.53615601e-04, -1.06007786e-04, 7.08771615e-05, -4.55863037e-05,
+	2.79075673e-05, -1.59879666e-05, 8.31263237e-06, -3.66736214e-06,
+	-1.63110614e-06, 4.60051993e-06, -9.80470906e-06, 1.82235618e-05,
+	-3.10987321e-05, 4.99695836e-05, -7.67087084e-05, 1.13556409e-04,
+	-1.63153726e-04, 2.28573886e-04, -3.13352523e-04, 4.21517593e-04,
+	-5.57620770e-04, 7.26773220e-04, -9.34690112e-04, 1.18775028e-03,
+	-1.49308025e-03, 1.85867573e-03, -2.29357954e-03, 2.80814350e-03,
+	-3.41441504e-03, 4.12671053e-03, -4.96247180e-03, 5.94356127e-03,
+	-7.09825387e-03, 8.46437311e-03, -1.00943793e-02, 1.20639461e-02,
+	-1.44871260e-02, 1.75448206e-02, -2.15424554e-02, 2.70389727e-02,
+	-3.51767298e-02, 4.87054455e-02, -7.63240522e-02, 1.67614147e-01,
+	9.64069837e-01, -1.24013702e-01, 6.54899509e-02, -4.38234433e-02,
+	3.23732459e-02, -2.52001669e-02, 2.02314542e-02, -1.65560476e-02,
+	1.37113964e-02, -1.14379918e-02, 9.57901318e-03, -8.03398326e-03,
+	6.73532057e-03, -5.63560701e-03, 4.70027577e-03, -3.90321993e-03,
+	3.22405947e-03, -2.64639197e-03, 2.15664895e-03, -1.74333628e-03,
+	1.39652453e-03, -1.10750462e-03, 8.68554479e-04, -6.72780242e-04,
+	5.14007554e-04, -3.86705956e-04, 2.85934528e-04, -2.07300543e-04,
+	1.46925369e-04, -1.01413760e-04, 6.78239894e-05, -4.36373400e-05,
+	2.67261906e-05, -1.53205322e-05, 7.97312300e-06, -3.52377331e-06,
+	-1.53537992e-06, 4.34560273e-06, -9.27458157e-06, 1.72523246e-05,
+	-2.94574978e-05, 4.73516056e-05, -7.27127736e-05, 1.07668548e-04,
+	-1.54727314e-04, 2.16808216e-04, -2.97269898e-04, 3.99938946e-04,
+	-5.29139735e-04, 6.89728389e-04, -8.87135028e-04, 1.12742037e-03,
+	-1.41735537e-03, 1.76453649e-03, -2.17755432e-03, 2.66624189e-03,
+	-3.24204121e-03, 3.91854674e-03, -4.71231737e-03, 5.64410391e-03,
+	-6.74073684e-03, 8.03809762e-03, -9.58593834e-03, 1.14560032e-02,
+	-1.37563823e-02, 1.66584459e-02, -2.04513685e-02, 2.56639690e-02,
+	-3.33759302e-02, 4.61819803e-02, -7.22671972e-02, 1.57934836e-01,
+	9.67716268e-01, -1.18745623e-01, 6.25122782e-02, -4.17848850e-02,
+	3.08506262e-02, -2.40075379e-02, 1.92703616e-02, -1.57677018e-02,
+	1.30575530e-02, -1.08920976e-02, 9.12165661e-03, -7.65036780e-03,
+	6.41377656e-03, -5.36667283e-03, 4.47610888e-03, -3.71720726e-03,
+	3.07055253e-03, -2.52052218e-03, 2.05419545e-03, -1.66062881e-03,
+	1.33036973e-03, -1.05512826e-03, 8.27554493e-04, -6.41087031e-04,
+	4.89849381e-04, -3.68577825e-04, 2.72569611e-04, -1.97643560e-04,
+	1.40107609e-04, -9.67295872e-05, 6.47088216e-05, -4.16471254e-05,
+	2.55184669e-05, -1.46371371e-05, 7.62462354e-06, -3.37565110e-06,
+	-1.44043951e-06, 4.09122313e-06, -8.74414271e-06, 1.62789560e-05,
+	-2.78108484e-05, 4.47228302e-05, -6.86977615e-05, 1.01749449e-04,
+	-1.46252435e-04, 2.04970368e-04, -2.81083247e-04, 3.78214383e-04,
+	-5.00458659e-04, 6.52414682e-04, -8.39224745e-04, 1.06662833e-03,
+	-1.34103740e-03, 1.66964530e-03, -2.06058614e-03, 2.52316939e-03,
+	-3.06822626e-03, 3.70862323e-03, -4.46002915e-03, 5.34207491e-03,
+	-6.38013648e-03, 7.60814090e-03, -9.07311658e-03, 1.08428582e-02,
+	-1.30194683e-02, 1.57647534e-02, -1.93516012e-02, 2.42786856e-02,
+	-3.15631011e-02, 4.36452937e-02, -6.82017104e-02, 1.48336384e-01,
+	9.71173164e-01, -1.13331992e-01, 5.94741672e-02, -3.97101207e-02,
+	2.93028498e-02, -2.27960406e-02, 1.82944738e-02, -1.49674300e-02,
+	1.23939257e-02, -1.03380866e-02, 8.65751989e-03, -7.26106774e-03,
+	6.08746002e-03, -5.09373382e-03, 4.24858804e-03, -3.52839486e-03,
+	2.91471868e-03, -2.39272880e-03, 1.95016180e-03, -1.57663267e-03,
+	1.26317251e-03, -1.00191635e-03, 7.85891519e-04, -6.08873653e-04,
+	4.65288171e-04, -3.50141735e-04, 2.58973030e-04, -1.87815353e-04,
+	1.33165813e-04, -9.19576251e-05, 6.15331894e-05, -3.96166085e-05,
+	2.42849473e-05, -1.39380729e-05, 7.26726583e-06, -3.22303678e-06,
+	-1.34634691e-06, 3.83754808e-06, -8.21374007e-06, 1.53040920e-05,
+	-2.61598564e-05, 4.20849641e-05, -6.46662707e-05, 9.58029316e-05,
+	-1.37734542e-04, 1.93067941e-04, -2.64802941e-04, 3.56357788e-04,
+	-4.71595835e-04, 6.14855854e-04, -7.90989705e-04, 1.00541273e-03,
+	-1.26417467e-03, 1.57406216e-03, -1.94274884e-03, 2.37901619e-03,
+	-2.89307966e-03, 3.49707203e-03, -4.20576566e-03, 5.03766385e-03,
+	-6.01667895e-03, 7.17477249e-03, -8.55623533e-03, 1.02248953e-02,
+	-1.22768456e-02, 1.48643031e-02, -1.82438428e-02, 2.28839903e-02,
+	-2.97393755e-02, 4.10969538e-02, -6.41299710e-02, 1.38821525e-01,
+	9.74439275e-01, -1.07773555e-01, 5.63769216e-02, -3.76001884e-02,
+	2.77307365e-02, -2.15663347e-02, 1.73043302e-02, -1.41556790e-02,
+	1.17208872e-02, -9.77627082e-03, 8.18686503e-03, -6.86630301e-03,
+	5.75655530e-03, -4.81694407e-03, 4.01784153e-03, -3.33688899e-03,
+	2.75664541e-03, -2.26308338e-03, 1.84460605e-03, -1.49139454e-03,
+	1.19497007e-03, -9.47898187e-04, 7.43588375e-04, -5.76157638e-04,
+	4.40337191e-04, -3.31407562e-04, 2.45151999e-04, -1.77821075e-04,
+	1.26103572e-04, -8.71002985e-05, 5.82986718e-05, -3.75467702e-05,
+	2.30262040e-05, -1.32236443e-05, 6.90118914e-06, -3.06597549e-06,
+	-1.25316245e-06, 3.58474201e-06, -7.68371771e-06, 1.43283638e-05,
+	-2.45055886e-05, 3.94397076e-05, -6.06208939e-05, 8.98328112e-05,
+	-1.29179089e-04, 1.81108537e-04, -2.48439355e-04, 3.34383067e-04,
+	-4.42569590e-04, 5.77075712e-04, -7.42460432e-04, 9.43812250e-04,
+	-1.18681566e-03, 1.47784727e-03, -1.82411655e-03, 2.23387288e-03,
+	-2.71671131e-03, 3.28402579e-03, -3.94968615e-03, 4.73106124e-03,
+	-5.65059157e-03, 6.73826323e-03, -8.03561748e-03, 9.60250047e-03,
+	-1.15289780e-02, 1.39576573e-02, -1.71287848e-02, 2.14807531e-02,
+	-2.79058875e-02, 3.85385265e-02, -6.00543424e-02, 1.29392949e-01,
+	9.77513416e-01, -1.02071123e-01, 5.32218873e-02, -3.54561522e-02,
+	2.61351236e-02, -2.03190931e-02, 1.63004811e-02, -1.33329036e-02,
+	1.10388168e-02, -9.20696807e-03, 7.70995873e-03, -6.46629751e-03,
+	5.42125006e-03, -4.53646042e-03, 3.78399994e-03, -3.14279784e-03,
+	2.59642183e-03, -2.13165881e-03, 1.73758736e-03, -1.40496204e-03,
+	1.12580033e-03, -8.93103676e-04, 7.00668358e-04, -5.42956896e-04,
+	4.15010007e-04, -3.12385410e-04, 2.31113902e-04, -1.67666009e-04,
+	1.18924569e-04, -8.21601006e-05, 5.50068952e-05, -3.54386232e-05,
+	2.17428298e-05, -1.24941687e-05, 6.52654008e-06, -2.90451620e-06,
+	-1.16094473e-06, 3.33296669e-06, -7.15441594e-06, 1.33523979e-05,
+	-2.28491058e-05, 3.67887542e-05, -5.65642158e-05, 8.38428951e-05,
+	-1.20591521e-04, 1.69099757e-04, -2.32002870e-04, 3.12304133e-04,
+	-4.13398275e-04, 5.39098101e-04, -6.93667512e-04, 8.81865656e-04,
+	-1.10900900e-03, 1.38106104e-03, -1.70476366e-03, 2.08783035e-03,
+	-2.53923156e-03, 3.06961763e-03, -3.69195053e-03, 4.42245838e-03,
+	-5.28210258e-03, 6.29888514e-03, -7.51158731e-03, 8.97606116e-03,
+	-1.07763309e-02, 1.30453801e-02, -1.60071208e-02, 2.00698460e-02,
+	-2.60637722e-02, 3.59715745e-02, -5.59771710e-02, 1.20053302e-01,
+	9.80394476e-01, -9.62255713e-02, 5.00104520e-02, -3.32791016e-02,
+	2.45168660e-02, -1.90550015e-02, 1.52834863e-02, -1.24995669e-02,
+	1.03481004e-02, -8.63050148e-03, 7.22707219e-03, -6.06127887e-03,
+	5.08173513e-03, -4.25244241e-03, 3.54719613e-03, -2.94623151e-03,
+	2.43413864e-03, -1.99852930e-03, 1.62916597e-03, -1.31738365e-03,
+	1.05570196e-03, -8.37563308e-04, 6.57155231e-04, -5.09289704e-04,
+	3.89320471e-04, -2.93085606e-04, 2.16866295e-04, -1.57355564e-04,
+	1.11632581e-04, -7.71395908e-05, 5.16595322e-05, -3.32932117e-05,
+	2.04354381e-05, -1.17499762e-05, 6.14347265e-06, -2.73871174e-06,
+	-1.06975066e-06, 3.08238119e-06, -6.62617117e-06, 1.23768156e-05,
+	-2.11914620e-05, 3.41337891e-05, -5.24988119e-05, 7.78369809e-05,
+	-1.11977274e-04, 1.57049190e-04, -2.15503860e-04, 2.90134903e-04,
+	-3.84100250e-04, 5.00946894e-04, -6.44641575e-04, 8.19611788e-04,
+	-1.03080341e-03, 1.28376401e-03, -1.58476473e-03, 1.94097975e-03,
+	-2.36075108e-03, 2.85398117e-03, -3.43271925e-03, 4.11204724e-03,
+	-4.91144106e-03, 5.85691119e-03, -6.98447024e-03, 8.34596627e-03,
+	-1.00193715e-02, 1.21280376e-02, -1.48795463e-02, 1.86521423e-02,
+	-2.42141646e-02, 3.33976569e-02, -5.19007855e-02, 1.10805180e-01,
+	9.83081408e-01, -9.02378380e-02, 4.67440441e-02, -3.10701509e-02,
+	2.28768358e-02, -1.77747583e-02, 1.42539155e-02, -1.16561398e-02,
+	9.64913027e-03, -8.04719944e-03, 6.73848098e-03, -5.65147842e-03,
+	4.73820442e-03, -3.96505216e-03, 3.30756511e-03, -2.74730191e-03,
+	2.26988804e-03, -1.86377032e-03, 1.51940319e-03, -1.22870872e-03,
+	9.84714325e-04, -7.81308143e-04, 6.13073213e-04, -4.75174702e-04,
+	3.63282721e-04, -2.73518696e-04, 2.02416899e-04, -1.46895272e-04,
+	1.04231476e-04, -7.20413937e-05, 4.82583012e-05, -3.11116109e-05,
+	1.91046623e-05, -1.09914094e-05, 5.75214819e-06, -2.56861882e-06,
+	-9.79635362e-07, 2.83314178e-06, -6.09931570e-06, 1.14022323e-05,
+	-1.95337038e-05, 3.14764881e-05, -4.84272467e-05, 7.18188535e-05,
+	-1.03341772e-04, 1.44964415e-04, -1.98952688e-04, 2.67889285e-04,
+	-3.54693874e-04, 4.62645971e-04, -5.95413276e-04, 7.57089528e-04,
+	-9.52247693e-04, 1.18601682e-03, -1.46419451e-03, 1.79341247e-03,
+	-2.18138083e-03, 2.63725033e-03, -3.17215322e-03, 3.80002037e-03,
+	-4.53883677e-03, 5.41261521e-03, -6.45459267e-03, 7.71260579e-03,
+	-9.25856799e-03, 1.12061968e-02, -1.37467578e-02, 1.72285159e-02,
+	-2.23581991e-02, 3.08183281e-02, -4.78274955e-02, 1.01651133e-01,
+	9.85573240e-01, -8.41089245e-02, 4.34241331e-02, -2.88304389e-02,
+	2.12159214e-02, -1.64790739e-02, 1.32123480e-02, -1.08031004e-02,
+	8.94230471e-03, -7.45739538e-03, 6.24446487e-03, -5.23713099e-03,
+	4.39085482e-03, -3.67445430e-03, 3.06524402e-03, -2.54612271e-03,
+	2.10376373e-03, -1.72745856e-03, 1.40836132e-03, -1.13898745e-03,
+	9.12877456e-04, -7.24369788e-04, 5.68446965e-04, -4.40630878e-04,
+	3.36911164e-04, -2.53695435e-04, 1.87773595e-04, -1.36290789e-04,
+	9.67252092e-05, -6.68681983e-05, 4.48049655e-05, -2.88949264e-05,
+	1.77511561e-05, -1.02188235e-05, 5.35273531e-06, -2.39429802e-06,
+	-8.90652223e-07, 2.58540184e-06, -5.57417752e-06, 1.04292575e-05,
+	-1.78768700e-05, 2.88185171e-05, -4.43520725e-05, 6.57922837e-05,
+	-9.46904210e-05, 1.32852992e-04, -1.82359699e-04, 2.45581172e-04,
+	-3.25197497e-04, 4.24219209e-04, -5.46013274e-04, 6.94337783e-04,
+	-8.73390686e-04, 1.08788019e-03, -1.34312782e-03, 1.64522002e-03,
+	-2.00123196e-03, 2.41955933e-03, -2.91041367e-03, 3.48657072e-03,
+	-4.16452001e-03, 4.96627165e-03, -5.92228176e-03, 7.07637057e-03,
+	-8.49438967e-03, 1.02804260e-02, -1.26094526e-02, 1.57998412e-02,
+	-2.04970090e-02, 2.82351367e-02, -4.37595907e-02, 9.25936650e-02,
+	9.87869068e-01, -7.78398956e-02, 4.00522286e-02, -2.65611285e-02,
+	1.95350275e-02, -1.51686708e-02, 1.21593719e-02, -9.94093421e-03,
+	8.22802794e-03, -6.86142759e-03, 5.74530767e-03, -4.81847483e-03,
+	4.03988605e-03, -3.38081585e-03, 2.82037201e-03, -2.34280928e-03,
+	1.93586081e-03, -1.58967190e-03, 1.29610365e-03, -1.04827084e-03,
+	8.40232057e-04, -6.66780387e-04, 5.23301574e-04, -4.05677562e-04,
+	3.10220478e-04, -2.33626788e-04, 1.72944423e-04, -1.25547885e-04,
+	8.91178254e-05, -6.16227559e-05, 4.13013323e-05, -2.66442939e-05,
+	1.63755927e-05, -9.43258608e-06, 4.94540990e-06, -2.21581379e-06,
+	-8.02852817e-07, 2.33931182e-06, -5.05108018e-06, 9.45849437e-06,
+	-1.62219904e-05, 2.61615308e-05, -4.02758275e-05, 5.97610253e-05,
+	-8.60286092e-05, 1.20722460e-04, -1.65735217e-04, 2.23224433e-04,
+	-2.95629444e-04, 3.85690465e-04, -4.96472217e-04, 6.31395456e-04,
+	-7.94281240e-04, 9.89414888e-04, -1.22163957e-03, 1.49649401e-03,
+	-1.82041577e-03, 2.20104257e-03, -2.64766211e-03, 3.17189161e-03,
+	-3.78872149e-03, 4.51815546e-03, -5.38786523e-03, 6.43765211e-03,
+	-7.72730644e-03, 9.35129389e-03, -1.14683284e-02, 1.43669922e-02,
+	-1.86317256e-02, 2.56496252e-02, -3.96993397e-02, 8.36352264e-02,
+	9.89968059e-01, -7.14318792e-02, 3.66298798e-02, -2.42634057e-02,
+	1.78350745e-02, -1.38442826e-02, 1.10955843e-02, -9.07013377e-03,
+	7.50670983e-03, -6.25963901e-03, 5.24129711e-03, -4.39575142e-03,
+	3.68550059e-03, -3.08430615e-03, 2.57309018e-03, -2.13747865e-03,
+	1.76627577e-03, -1.45048938e-03, 1.18269442e-03, -9.56610656e-04,
+	7.66819468e-04, -6.08572598e-04, 4.77662544e-04, -3.70334410e-04,
+	2.83225597e-04, -2.13323917e-04, 1.57937577e-04, -1.14672449e-04,
+	8.14134528e-05, -5.63078794e-05, 3.77492523e-05, -2.43608787e-05,
+	1.49786648e-05, -8.63307685e-06, 4.53035504e-06, -2.03323447e-06,
+	-7.16286917e-07, 2.09501910e-06, -4.53034256e-06, 8.49053935e-06,
+	-1.45700861e-05, 2.35071719e-05, -3.62010346e-05, 5.37288131e-05,
+	-7.73617008e-05, 1.08580331e-04, -1.49089534e-04, 2.00832906e-04,
+	-2.66008007e-04, 3.47083562e-04, -4.46820723e-04, 5.68301423e-04,
+	-7.14968191e-04, 8.90681649e-04, -1.09980465e-03, 1.34732609e-03,
+	-1.63904363e-03, 1.98183457e-03, -2.38406020e-03, 2.85617652e-03,
+	-3.41167217e-03, 4.06854191e-03, -4.85167120e-03, 5.79684230e-03,
+	-6.95778862e-03, 8.41936962e-03, -1.03240831e-02, 1.29308421e-02,
+	-1.67634775e-02, 2.30633285e-02, -3.56489895e-02, 7.47782199e-02,
+	9.91869452e-01, -6.48860658e-02, 3.31586751e-02, -2.19384794e-02,
+	1.61169980e-02, -1.25066541e-02, 1.00215904e-02, -8.19119819e-03,
+	6.77876569e-03, -5.65237707e-03, 4.73272463e-03, -3.96920541e-03,
+	3.32790356e-03, -2.78509675e-03, 2.32354150e-03, -1.93024937e-03,
+	1.59510639e-03, -1.30999110e-03, 1.06819877e-03, -8.64059425e-04,
+	6.92681637e-04, -5.49779579e-04, 4.31555777e-04, -3.34621399e-04,
+	2.55941707e-04, -1.92798182e-04, 1.42761397e-04, -1.03670479e-04,
+	7.36163029e-05, -5.09264416e-05, 3.41506181e-05, -2.20458750e-05,
+	1.35610842e-05, -7.82068761e-06, 4.10776097e-06, -1.84663226e-06,
+	-6.31002467e-07, 1.85266800e-06, -4.01227873e-06, 7.52598189e-06,
+	-1.29221682e-05, 2.08570698e-05, -3.21301995e-05, 4.76993605e-05,
+	-6.86950343e-05, 9.64340856e-05, -1.32432906e-04, 1.78420385e-04,
+	-2.36351432e-04, 3.08422276e-04, -3.97089356e-04, 5.05094511e-04,
+	-6.35500327e-04, 7.91741185e-04, -9.77697958e-04, 1.19780791e-03,
+	-1.45722691e-03, 1.76206987e-03, -2.11976965e-03, 2.53961905e-03,
+	-3.03360313e-03, 3.61770641e-03, -4.31402791e-03, 5.15433320e-03,
+	-6.18630661e-03, 7.48522217e-03, -9.17741376e-03, 1.14922630e-02,
+	-1.48933905e-02, 2.04777738e-02, -3.16107638e-02, 6.60249962e-02,
+	9.93572555e-01, -5.82037085e-02, 2.96402414e-02, -1.95875810e-02,
+	1.43817481e-02, -1.11565408e-02, 8.93800395e-03, -7.30463303e-03,
+	6.04461600e-03, -5.03999349e-03, 4.21988522e-03, -3.53908439e-03,
+	2.96730258e-03, -2.48336133e-03, 2.07187070e-03, -1.72124154e-03,
+	1.42245173e-03, -1.16825823e-03, 9.52682727e-04, -7.70670392e-04,
+	6.17861108e-04, -4.90434965e-04, 3.85007563e-04, -2.98558814e-04,
+	2.28384235e-04, -1.72061129e-04, 1.27424370e-04, -9.25480854e-05,
+	6.57306678e-05, -4.54813737e-05, 3.05073641e-05, -1.97005054e-05,
+	1.21235817e-05, -6.99582210e-06, 3.67782504e-06, -1.65608324e-06,
+	-5.47045573e-07, 1.61239965e-06, -3.49719779e-06, 6.56540407e-06,
+	-1.12792373e-05, 1.82128399e-05, -2.80658100e-05, 4.16763578e-05,
+	-6.00339193e-05, 8.42911705e-05, -1.15775549e-04, 1.56000617e-04,
+	-2.06677909e-04, 2.69730317e-04, -3.47308615e-04, 4.41813475e-04,
+	-5.55926360e-04, 6.92654127e-04, -8.55394287e-04, 1.04803102e-03,
+	-1.27507691e-03, 1.54188295e-03, -1.85495212e-03, 2.22241275e-03,
+	-2.65474543e-03, 3.16592436e-03, -3.77526362e-03, 4.51051679e-03,
+	-5.41333065e-03, 6.54942015e-03, -8.02901697e-03, 1.00521250e-02,
+	-1.30225861e-02, 1.78944793e-02, -2.75868627e-02, 5.73778544e-02,
+	9.95076752e-01, -5.13861226e-02, 2.60762436e-02, -1.72119632e-02,
+	1.26302895e-02, -9.79470811e-03, 7.84544613e-03, -6.41094998e-03,
+	5.30468622e-03, -4.42284404e-03, 3.70307728e-03, -3.10563881e-03,
+	2.60390766e-03, -2.17927556e-03, 1.81822424e-03, -1.51057666e-03,
+	1.24841204e-03, -1.02537296e-03, 8.36213140e-04, -6.76497493e-04,
+	5.42400986e-04, -4.30572853e-04, 3.38044562e-04, -2.62167235e-04,
+	2.00568844e-04, -1.51124487e-04, 1.11935123e-04, -8.13114809e-05,
+	5.77609184e-05, -3.99756642e-05, 2.68214649e-05, -1.73260204e-05,
+	1.06669064e-05, -6.15889583e-06, 3.24075164e-06, -1.46166732e-06,
+	-4.64460486e-07, 1.37435195e-06, -2.98540371e-06, 5.60938032e-06,
+	-9.64228336e-06, 1.55760830e-05, -2.40103338e-05, 3.56634694e-05,
+	-5.13836329e-05, 7.21589915e-05, -9.91276277e-05, 1.33587292e-04,
+	-1.77005563e-04, 2.31031324e-04, -2.97508912e-04, 3.78496972e-04,
+	-4.76294897e-04, 5.93480992e-04, -7.32968323e-04, 8.98086871e-04,
+	-1.09270480e-03, 1.32140816e-03, -1.58976913e-03, 1.90475104e-03,
+	-2.27532997e-03, 2.71347097e-03, -3.23570632e-03, 3.86578475e-03,
+	-4.63933050e-03, 5.61253140e-03, -6.87958782e-03, 8.61129612e-03,
+	-1.11521817e-02, 1.53149534e-02, -2.35794613e-02, 4.88390407e-02,
+	9.96381496e-01, -4.44346853e-02, 2.24683841e-02, -1.48128999e-02,
+	1.08636003e-02, -8.42193160e-03, 6.74454567e-03, -5.51066656e-03,
+	4.55940651e-03, -3.80128837e-03, 3.18260242e-03, -2.66912184e-03,
+	2.23793108e-03, -1.87301707e-03, 1.56275018e-03, -1.29837760e-03,
+	1.07308871e-03, -8.81418404e-04, 7.18857659e-04, -5.81595321e-04,
+	4.66344920e-04, -3.70227782e-04, 2.90693790e-04, -2.25467528e-04,
+	1.72511420e-04, -1.30000162e-04, 9.63024157e-05, -6.99669827e-05,
+	4.97115013e-05, -3.44123568e-05, 2.30949346e-05, -1.49236978e-05,
+	9.19182571e-06, -5.31033589e-06, 2.79675210e-06, -1.26346829e-06,
+	-3.83289594e-07, 1.13865952e-06, -2.47719515e-06, 4.65847711e-06,
+	-8.01228484e-06, 1.29483838e-05, -1.99662173e-05, 2.96643322e-05,
+	-4.27494169e-05, 6.00449102e-05, -8.24992551e-05, 1.11194034e-04,
+	-1.47352440e-04, 1.92348839e-04, -2.47720551e-04, 3.15183540e-04,
+	-3.96654408e-04, 4.94282146e-04, -6.10494581e-04, 7.48066709e-04,
+	-9.10221552e-04, 1.10077962e-03, -1.32438199e-03, 1.58682704e-03,
+	-1.89558737e-03, 2.26062111e-03, -2.69568361e-03, 3.22052821e-03,
+	-3.86477518e-03, 4.67512272e-03, -5.72981980e-03, 7.17064137e-03,
+	-9.28328944e-03, 1.27406942e-02, -1.95907090e-02, 4.04107478e-02,
+	9.97486313e-01, -3.73508351e-02, 1.88184018e-02, -1.23916855e-02,
+	9.08267193e-03, -7.03899601e-03, 5.63593835e-03, -4.60430583e-03,
+	3.80921150e-03, -3.17568981e-03, 2.65876530e-03, -2.22978916e-03,
+	1.86958728e-03, -1.56476526e-03, 1.30559812e-03, -1.08476853e-03,
+	8.96584237e-04, -7.36478608e-04, 6.00684693e-04, -4.86019098e-04,
+	3.89737078e-04, -3.09434711e-04, 2.42982608e-04, -1.88480832e-04,
+	1.44228067e-04, -1.08700226e-04, 8.05351416e-05, -5.85210066e-05,
+	4.15869374e-05, -2.87945494e-05, 1.93298258e-05, -1.24948420e-05,
+	7.69912486e-06, -4.45058079e-06, 2.34604468e-06, -1.06157375e-06,
+	-3.03573409e-07, 9.05453606e-07, -1.97286535e-06, 3.71325262e-06,
+	-6.39020815e-06, 1.03313103e-05, -1.59358845e-05, 2.36825531e-05,
+	-3.41364747e-05, 4.79562400e-05, -6.59004827e-05, 8.88343929e-05,
+	-1.17736497e-04, 1.53706303e-04, -1.97973717e-04, 2.51911574e-04,
+	-3.17053202e-04, 3.95117769e-04, -4.88047365e-04, 5.98061553e-04,
+	-7.27737877e-04, 8.80131174e-04, -1.05895163e-03, 1.26883354e-03,
+	-1.51574779e-03, 1.80764913e-03, -2.15552244e-03, 2.57513751e-03,
+	-3.09013270e-03, 3.73775947e-03, -4.58040431e-03, 5.73102259e-03,
+	-7.41701571e-03, 1.01731886e-02, -1.56227286e-02, 3.20951140e-02,
+	9.98390802e-01, -3.01360720e-02, 1.51280718e-02, -9.94963412e-03,
+	7.28850852e-03, -5.64669504e-03, 4.52026664e-03, -3.69239610e-03,
+	3.05454003e-03, -2.54641513e-03, 2.13187346e-03, -1.78789890e-03,
+	1.49909273e-03, -1.25470127e-03, 1.04691911e-03, -8.69874828e-04,
+	7.19002118e-04, -5.90638474e-04, 4.81763370e-04, -3.89824646e-04,
+	3.12622115e-04, -2.48229004e-04, 1.94938698e-04, -1.51228546e-04,
+	1.15735096e-04, -8.72369181e-05, 6.46423181e-05, -4.69800639e-05,
+	3.33918187e-05, -2.31253919e-05, 1.55282284e-05, -1.00407834e-05,
+	6.18960649e-06, -3.58008027e-06, 1.88885443e-06, -8.56075105e-07,
+	-2.25350562e-07, 6.74862066e-07, -1.47270195e-06, 2.77425647e-06,
+	-4.77700723e-06, 7.72641286e-06, -1.19217353e-05, 1.77217073e-05,
+	-2.55499682e-05, 3.59002413e-05, -4.93412965e-05, 6.65218387e-05,
+	-8.81755938e-05, 1.15127038e-04, -1.48298452e-04, 1.88719303e-04,
+	-2.37539392e-04, 2.96047818e-04, -3.65700726e-04, 4.48162130e-04,
+	-5.45364147e-04, 6.59596270e-04, -7.93638580e-04, 9.50962804e-04,
+	-1.13604081e-03, 1.35482871e-03, -1.61554898e-03, 1.93000200e-03,
+	-2.31586977e-03, 2.80100527e-03, -3.43203025e-03, 4.29329778e-03,
+	-5.55446062e-03, 7.61391125e-03, -1.16776153e-02, 2.38942229e-02,
+	9.99094634e-01, -2.27919563e-02, 1.13992045e-02, -7.48807919e-03,
+	5.48212630e-03, -4.24583092e-03, 3.39817938e-03, -2.77547062e-03,
+	2.29583492e-03, -1.91383437e-03, 1.60223712e-03, -1.34371143e-03,
+	1.12666578e-03, -9.43007823e-04, 7.86865539e-04, -6.53823028e-04,
+	5.40446834e-04, -4.43983718e-04, 3.62163498e-04, -2.93068346e-04,
+	2.35045157e-04, -1.86646405e-04, 1.46590056e-04, -1.13732322e-04,
+	8.70490166e-05, -6.56226297e-05, 4.86330834e-05, -3.53507581e-05,
+	2.51308064e-05, -1.74080852e-05, 1.16922687e-05, -7.56287764e-06,
+	4.66409032e-06, -2.69929506e-06, 1.42541315e-06, -6.47067573e-07,
+	-1.48657795e-07, 4.47009290e-07, -9.76986874e-07, 1.84202945e-06,
+	-3.17362298e-06, 5.13522358e-06, -7.92614419e-06, 1.17853360e-05,
+	-1.69950152e-05, 2.38841177e-05, -3.28316104e-05, 4.42697509e-05,
+	-5.86874786e-05, 7.66342304e-05, -9.87246380e-05, 1.25644769e-04,
+	-1.58160873e-04, 1.97131990e-04, -2.43528412e-04, 2.98458818e-04,
+	-3.63210337e-04, 4.39307904e-04, -5.28602832e-04, 6.33406484e-04,
+	-7.56695334e-04, 9.02432688e-04, -1.07608836e-03, 1.28550978e-03,
+	-1.54245151e-03, 1.86542167e-03, -2.28538364e-03, 2.85832066e-03,
+	-3.69671728e-03, 5.06432415e-03, -7.75743613e-03, 1.58101021e-02,
+	9.99597554e-01, -1.53201088e-02, 7.63364515e-03, -5.00837253e-03,
+	3.66455313e-03, -2.83721392e-03, 2.27033137e-03, -1.85406729e-03,
+	1.53354270e-03, -1.27832058e-03, 1.07016902e-03, -8.97489202e-04,
+	7.52526565e-04, -6.29869166e-04, 5.25591084e-04, -4.36740733e-04,
+	3.61023770e-04, -2.96600816e-04, 2.41955524e-04, -1.95807118e-04,
+	1.57051768e-04, -1.24723020e-04, 9.79649710e-05, -7.60140465e-05,
+	5.81865270e-05, -4.38699026e-05, 3.25166916e-05, -2.36397809e-05,
+	1.68086280e-05, -1.16458789e-05, 7.82410824e-06, -5.06250510e-06,
+	3.12341277e-06, -1.80869677e-06, 9.55959258e-07, -4.34650121e-07,
+	-7.35299573e-08, 2.22016159e-07, -4.85996196e-07, 9.17103206e-07,
+	-1.58098278e-06, 2.55925510e-06, -3.95145912e-06, 5.87694441e-06,
+	-8.47668573e-06, 1.19150116e-05, -1.63812605e-05, 2.20914121e-05,
+	-2.92897809e-05, 3.82509236e-05, -4.92819831e-05, 6.27258025e-05,
+	-7.89652866e-05, 9.84296925e-05, -1.21603831e-04, 1.49041600e-04,
+	-1.81385961e-04, 2.19398533e-04, -2.64003755e-04, 3.16355517e-04,
+	-3.77939380e-04, 4.50732895e-04, -5.37464520e-04, 6.42047469e-04,
+	-7.70341200e-04, 9.31567778e-04, -1.14114721e-03, 1.42694018e-03,
+	-1.84487128e-03, 2.52587569e-03, -3.86422852e-03, 7.84472300e-03,
+	9.99899379e-01, -7.72221014e-03, 3.83327285e-03, -2.51188385e-03,
+	1.83682791e-03, -1.42166194e-03, 1.13738303e-03, -9.28728339e-04,
+	7.68113332e-04, -6.40249631e-04, 5.35984241e-04, -4.49496653e-04,
+	3.76896875e-04, -3.15470922e-04, 2.63250591e-04, -2.18756547e-04,
+	1.80839155e-04, -1.48576959e-04, 1.21210490e-04, -9.80983748e-05,
+	7.86879272e-05, -6.24952958e-05, 4.90920093e-05, -3.80958311e-05,
+	2.91645054e-05, -2.19914200e-05, 1.63025072e-05, -1.18539091e-05,
+	8.43007498e-06, -5.84206970e-06, 3.92594251e-06, -2.54107005e-06,
+	1.56842649e-06, -9.08767560e-07, 4.80737736e-07, -2.18925457e-07,
+	-1.30626217e-20, 7.04218369e-20, 5.79380555e-20, 1.81765854e-20,
+	-2.51455424e-19, 7.63668180e-19, -1.73000834e-18, -2.95576786e-22,
+	-1.18114084e-18, 3.32169146e-18, 2.61119884e-18, -4.41071808e-19,
+	-3.50034913e-18, 9.90745670e-18, -1.96410152e-17, -2.50264867e-18,
+	-7.86713930e-18, 2.35418902e-17, -1.09051312e-17, -8.91848465e-18,
+	-1.44604792e-17, 4.81132232e-17, -1.84175718e-17, -2.52392385e-17,
+	-2.26005060e-17, 8.98684280e-17, -2.67833835e-17, 2.87948780e-17,
+	-3.07085034e-17, 3.24910692e-17, -3.41106302e-17, 3.55373614e-17,
+	-3.67443935e-17, 3.77085816e-17, -3.84111756e-17, 3.88383714e-17,
+	1.00000000e+00, 3.88383714e-17, -3.84111756e-17, 3.77085816e-17,
+	-3.67443935e-17, 3.55373614e-17, -3.41106302e-17, 3.24910692e-17,
+	-3.07085034e-17, 2.87948780e-17, -2.67833835e-17, 8.98684280e-17,
+	-2.26005060e-17, -2.52392385e-17, -1.84175718e-17, 4.81132232e-17,
+	-1.44604792e-17, -8.91848465e-18, -1.09051312e-17, 2.35418902e-17,
+	-7.86713930e-18, -2.50264867e-18, -1.96410152e-17, 9.90745670e-18,
+	-3.50034913e-18, -4.41071808e-19, 2.61119884e-18, 3.32169146e-18,
+	-1.18114084e-18, -2.95576786e-22, -1.73000834e-18, 7.63668180e-19,
+	-2.51455424e-19, 1.81765854e-20, 5.79380555e-20, 7.04218369e-20,
+};
+
+/* 48000 -> 228000, passband: 16750, stopband: 19000, 19 / 4 */
+static const float polyphase_48000_228000_16750[2736]
+__attribute__ ((aligned (16))) = {
+	8.27455073e-07, 2.05419737e-06, -6.41959488e-06, 8.39930666e-06,
+	-3.33302936e-06, -9.62112145e-06, 2.37604849e-05, -2.64165715e-05,
+	7.42863596e-06, 2.97753996e-05, -6.35159835e-05, 6.32392269e-05,
+	-1.15057409e-05, -7.47233496e-05, 1.42182260e-04, -1.28904407e-04,
+	1.07611839e-05, 1.63647620e-04, -2.82644200e-04, 2.34777518e-04,
+	4.80853050e-06, -3.24576025e-04, 5.14585968e-04, -3.92127918e-04,
+	-5.27911549e-05, 5.96147282e-04, -8.74407180e-04, 6.10149271e-04,
+	1.61036587e-04, -1.02930329e-03, 1.40482218e-03, -8.93611329e-04,
+	-3.70662294e-04, 1.68927815e-03, -2.15467961e-03, 1.24042288e-03,
+	7.39764045e-04, -2.65892265e-03, 3.18012938e-03, -1.63940682e-03,
+	-1.34900171e-03, 4.04573717e-03, -4.54935037e-03, 2.06847832e-03,
+	2.31202246e-03, -5.99791511e-03, 6.35542988e-03, -2.49306275e-03,
+	-3.79808198e-03, 8.74206873e-03, -8.74819749e-03, 2.86367229e-03,
+	6.08658501e-03, -1.26770080e-02, 1.20150542e-02, -3.10888200e-03,
+	-9.71472587e-03, 1.86350052e-02, -1.68134129e-02, 3.10986099e-03,
+	1.59556172e-02, -2.87756539e-02, 2.50200553e-02, -2.58832242e-03,
+	-2.89427403e-02, 5.10444894e-02, -4.46248154e-02, 3.01825577e-04,
+	7.46637698e-02, -1.56429509e-01, 2.08968784e-01, 7.44320644e-01,
+	2.48241470e-01, -1.59985035e-01, 6.63254762e-02, 1.00011822e-02,
+	-5.00996814e-02, 5.09023397e-02, -2.49742067e-02, -7.20044503e-03,
+	2.76028273e-02, -2.83723027e-02, 1.34239871e-02, 5.93649615e-03,
+	-1.83027453e-02, 1.82001809e-02, -7.94216150e-03, -4.99137545e-03,
+	1.29293831e-02, -1.22693649e-02, 4.80447168e-03, 4.15399708e-03,
+	-9.31674859e-03, 8.38426929e-03, -2.86555102e-03, -3.38068527e-03,
+	6.70415531e-03, -5.69874945e-03, 1.64016729e-03, 2.67240790e-03,
+	-4.75635128e-03, 3.80634733e-03, -8.74309515e-04, -2.04175547e-03,
+	3.29689916e-03, -2.47556668e-03, 4.13420900e-04, 1.50076889e-03,
+	-2.21587456e-03, 1.55514233e-03, -1.53900407e-04, -1.05599879e-03,
+	1.43355895e-03, -9.35950216e-04, 2.29507576e-05, 7.07012346e-04,
+	-8.85611440e-04, 5.34707392e-04, 3.08615259e-05, -4.46873138e-04,
+	5.17378633e-04, -2.86668136e-04, -4.28640821e-05, 2.63750508e-04,
+	-2.82157421e-04, 1.42003608e-04, 3.59360096e-05, -1.43029920e-04,
+	1.40959046e-04, -6.35184667e-05, -2.35434760e-05, 6.94277747e-05,
+	-6.25586089e-05, 2.46991043e-05, 1.24362085e-05, -2.87507939e-05,
+	2.32697608e-05, -7.74969948e-06, -4.99870469e-06, 9.09160134e-06,
+	-6.27020324e-06, 1.59961630e-06, 1.16634405e-06, -1.40148595e-06,
+	4.94444322e-07, 2.45570575e-06, -6.46415848e-06, 7.60354347e-06,
+	-1.67143561e-06, -1.12892909e-05, 2.38765209e-05, -2.37437981e-05,
+	2.43419444e-06, 3.42800512e-05, -6.34905274e-05, 5.62280704e-05,
+	4.56494803e-07, -8.45758142e-05, 1.41233341e-04, -1.13091663e-04,
+	-1.41281714e-05, 1.82447347e-04, -2.78853849e-04, 2.02726113e-04,
+	5.16626659e-05, -3.57006732e-04, 5.04064196e-04, -3.32247660e-04,
+	-1.34477741e-04, 6.47749609e-04, -8.50149091e-04, 5.05327508e-04,
+	2.94946328e-04, -1.10596325e-03, 1.35522112e-03, -7.19647177e-04,
+	-5.79325031e-04, 1.79639110e-03, -2.06162913e-03, 9.64176435e-04,
+	1.05145723e-03, -2.80021008e-03, 3.01654326e-03, -1.21637873e-03,
+	-1.79859012e-03, 4.22168397e-03, -4.27566352e-03, 1.43910375e-03,
+	2.94259639e-03, -6.20370492e-03, 5.91399270e-03, -1.57602233e-03,
+	-4.66466088e-03, 8.96458360e-03, -8.05281194e-03, 1.54204976e-03,
+	7.26488284e-03, -1.28894662e-02, 1.09280961e-02, -1.19774199e-03,
+	-1.13230967e-02, 1.87842452e-02, -1.50862502e-02, 2.67580891e-04,
+	1.82172454e-02, -2.87403885e-02, 2.20948868e-02, 1.99554224e-03,
+	-3.24116321e-02, 5.04172159e-02, -3.85993880e-02, -9.14435165e-03,
+	8.15998950e-02, -1.50744074e-01, 1.70521142e-01, 7.40558904e-01,
+	2.88031489e-01, -1.61244217e-01, 5.66576783e-02, 1.98148838e-02,
+	-5.49289555e-02, 4.99783883e-02, -2.05580288e-02, -1.17711475e-02,
+	2.97992879e-02, -2.75309612e-02, 1.06576948e-02, 8.70428873e-03,
+	-1.95290272e-02, 1.74834407e-02, -6.03074587e-03, -6.81627390e-03,
+	1.36554958e-02, -1.16708935e-02, 3.43709837e-03, 5.39307374e-03,
+	-9.74862247e-03, 7.89538013e-03, -1.88066618e-03, -4.22508522e-03,
+	6.95398085e-03, -5.30988425e-03, 9.36881175e-04, 3.24143553e-03,
+	-4.89285579e-03, 3.50653732e-03, -3.81504440e-04, -2.41707241e-03,
+	3.36458346e-03, -2.25249696e-03, 7.72540526e-05, 1.74106295e-03,
+	-2.24392238e-03, 1.39572504e-03, 6.77412699e-05, -1.20418822e-03,
+	1.44073740e-03, -8.27124206e-04, -1.17250765e-04, 7.94329216e-04,
+	-8.83414928e-04, 4.64235991e-04, 1.15225498e-04, -4.95568841e-04,
+	5.12283718e-04, -2.43780873e-04, -9.06356090e-05, 2.89149206e-04,
+	-2.77328738e-04, 1.17798946e-04, 6.10134380e-05, -1.55218649e-04,
+	1.37540328e-04, -5.11070656e-05, -3.54718921e-05, 7.46795934e-05,
+	-6.06105781e-05, 1.91163367e-05, 1.73790646e-05, -3.07007067e-05,
+	2.24012067e-05, -5.69827211e-06, -6.64209918e-06, 9.66547200e-06,
+	-6.01406709e-06, 1.09700330e-06, 1.50556629e-06, -1.50530567e-06,
+	1.72471310e-07, 2.80018498e-06, -6.40739879e-06, 6.72035860e-06,
+	-3.93680550e-08, -1.27347968e-05, 2.36266841e-05, -2.07822165e-05,
+	-2.47140851e-06, 3.81581559e-05, -6.25048718e-05, 4.85184934e-05,
+	1.21633740e-05, -9.29534065e-05, 1.38168208e-04, -9.58622660e-05,
+	-3.83603132e-05, 1.98167152e-04, -2.70914907e-04, 1.68130840e-04,
+	9.70023940e-05, -3.83552956e-04, 4.86086505e-04, -2.68211493e-04,
+	-2.12990694e-04, 6.88868174e-04, -8.13377073e-04, 3.94234493e-04,
+	4.22708765e-04, -1.16497748e-03, 1.28575707e-03, -5.36871913e-04,
+	-7.76828875e-04, 1.87516812e-03, -1.93848215e-03, 6.76376469e-04,
+	1.34394712e-03, -2.89773486e-03, 2.80909433e-03, -7.79271805e-04,
+	-2.21653293e-03, 4.33215341e-03, -3.94007205e-03, 7.94035089e-04,
+	3.52275589e-03, -6.31388780e-03, 5.38737480e-03, -6.43685227e-04,
+	-5.45281092e-03, 9.04970031e-03, -7.24225871e-03, 2.09367904e-04,
+	8.32254852e-03, -1.29053678e-02, 9.68654996e-03, 7.12945054e-04,
+	-1.27446561e-02, 1.86485689e-02, -1.31497879e-02, -2.54738799e-03,
+	2.01779940e-02, -2.82724586e-02, 1.88757710e-02, 6.48290230e-03,
+	-3.53371356e-02, 4.90440119e-02, -3.21244255e-02, -1.82057428e-02,
+	8.70828127e-02, -1.43112904e-01, 1.33192422e-01, 7.33069691e-01,
+	3.28020346e-01, -1.60060739e-01, 4.57543640e-02, 2.95986704e-02,
+	-5.90251246e-02, 4.82717589e-02, -1.57538099e-02, -1.62303476e-02,
+	3.15707801e-02, -2.62589065e-02, 7.69605886e-03, 1.13704520e-02,
+	-2.04707668e-02, 1.64927776e-02, -4.00818782e-03, -8.55522171e-03,
+	1.41805204e-02, -1.08888971e-02, 2.00449328e-03, 6.56154638e-03,
+	-1.00359672e-02, 7.28163270e-03, -8.57950130e-04, -5.01298785e-03,
+	7.10016818e-03, -4.83639865e-03, 2.12587991e-04, 3.76654537e-03,
+	-4.95609201e-03, 3.15028222e-03, 1.22075772e-04, -2.75935329e-03,
+	3.38163936e-03, -1.99269990e-03, -2.63708194e-04, 1.95741453e-03,
+	-2.23802390e-03, 1.21317423e-03, 2.90931198e-04, -1.33574435e-03,
+	1.42598515e-03, -7.04297654e-04, -2.57448876e-04, 8.70637942e-04,
+	-8.67671572e-04, 3.85688801e-04, 1.99017313e-04, -5.37380194e-04,
+	4.99261613e-04, -1.96496277e-04, -1.37773573e-04, 3.10524694e-04,
+	-2.68159214e-04, 9.13617217e-05, 8.56052033e-05, -1.65246324e-04,
+	1.31936270e-04, -3.76566953e-05, -4.71039838e-05, 7.88926323e-05,
+	-5.76793338e-05, 1.31017602e-05, 2.21783884e-05, -3.22253663e-05,
+	2.11575668e-05, -3.49366753e-06, -8.23632870e-06, 1.01073388e-05,
+	-5.65095323e-06, 5.52444970e-07, 1.83927197e-06, -1.59025522e-06,
+	-1.33760133e-07, 3.08478163e-06, -6.25429151e-06, 5.76659824e-06,
+	1.53901564e-06, -1.39422526e-05, 2.30251692e-05, -1.75846826e-05,
+	-7.21571554e-06, 4.13656782e-05, -6.05957749e-05, 4.02426385e-05,
+	2.34426428e-05, -9.97585203e-05, 1.33073854e-04, -7.75033164e-05,
+	-6.15800770e-05, 2.10622157e-04, -2.59016672e-04, 1.31556190e-04,
+	1.40165609e-04, -4.03902716e-04, 4.61034964e-04, -2.01047418e-04,
+	-2.87187389e-04, 7.19024258e-04, -7.64813253e-04, 2.78630723e-04,
+	5.42470594e-04, -1.20567209e-03, 1.19771971e-03, -3.48151767e-04,
+	-9.60318179e-04, 1.92473953e-03, -1.78743335e-03, 3.81497355e-04,
+	1.61301926e-03, -2.95048225e-03, 2.56136885e-03, -3.34832630e-04,
+	-2.59683192e-03, 4.37612081e-03, -3.54824644e-03, 1.43166985e-04,
+	4.04421604e-03, -6.32769803e-03, 4.78432378e-03, 2.89727089e-04,
+	-6.15135473e-03, 8.99739923e-03, -6.32983567e-03, -1.11415491e-03,
+	9.24474183e-03, -1.27263185e-02, 8.31061640e-03, 2.59436817e-03,
+	-1.39598242e-02, 1.82329262e-02, -1.10354035e-02, -5.29297261e-03,
+	2.18118577e-02, -2.73842252e-02, 1.54149108e-02, 1.08079341e-02,
+	-3.76842690e-02, 4.69589425e-02, -2.53053726e-02, -2.67596317e-02,
+	9.10831295e-02, -1.33735371e-01, 9.72598017e-02, 7.21921166e-01,
+	3.67881969e-01, -1.56310586e-01, 3.37302613e-02, 3.92047774e-02,
+	-6.23096380e-02, 4.57933024e-02, -1.06279909e-02, -2.05086067e-02,
+	3.28845587e-02, -2.45700396e-02, 4.58182795e-03, 1.38932632e-02,
+	-2.11105664e-02, 1.52404330e-02, -1.90416527e-03, -1.01808930e-02,
+	1.44945219e-02, -9.93354277e-03, 5.27866177e-04, 7.64095398e-03,
+	-1.01730599e-02, 6.55121901e-03, 1.87362722e-04, -5.73185576e-03,
+	7.13951477e-03, -4.28471036e-03, -5.21868347e-04, 4.23930456e-03,
+	-4.94437904e-03, 2.74245804e-03, 6.28855139e-04, -3.06303698e-03,
+	3.34728126e-03, -1.69975456e-03, -6.04310219e-04, 2.14625654e-03,
+	-2.19789007e-03, 1.01001621e-03, 5.12275375e-04, -1.44845755e-03,
+	1.38926104e-03, -5.69175726e-04, -3.95497514e-04, 9.34626246e-04,
+	-8.38441106e-04, 3.00158587e-04, 2.80944200e-04, -5.71566010e-04,
+	4.78393954e-04, -1.45472943e-04, -1.83543671e-04, 3.27482700e-04,
+	-2.54716846e-04, 6.30601737e-05, 1.09323553e-04, -1.72917910e-04,
+	1.24191067e-04, -2.33543853e-05, -5.82534254e-05, 8.19787662e-05,
+	-5.37878187e-05, 6.73858688e-06, 2.67556131e-05, -3.32894205e-05,
+	1.95475947e-05, -1.16597441e-06, -9.75440493e-06, 1.04052692e-05,
+	-5.18238204e-06, -2.69845243e-08, 2.16139642e-06, -1.65339697e-06,
+	-4.20060905e-07, 3.30774491e-06, -6.01114648e-06, 4.75961310e-06,
+	3.04118198e-06, -1.49004142e-05, 2.20911806e-05, -1.42062689e-05,
+	-1.17305521e-05, 4.38698684e-05, -5.78132419e-05, 3.15384129e-05,
+	3.41321216e-05, -1.04919393e-04, 1.26066428e-04, -5.83137663e-05,
+	-8.34539833e-05, 2.19680181e-04, -2.43405310e-04, 9.35875361e-05,
+	1.80533552e-04, -4.17842632e-04, 4.29393127e-04, -1.31816024e-04,
+	-3.56006525e-04, 7.37911591e-04, -7.05348624e-04, 1.60322140e-04,
+	6.52523002e-04, -1.22765867e-03, 1.09266411e-03, -1.56409048e-04,
+	-1.12718226e-03, 1.94468721e-03, -1.61107500e-03, 8.40718514e-05,
+	1.85485829e-03, -2.95812515e-03, 2.27752500e-03, 1.10149750e-04,
+	-2.93411771e-03, 4.35357672e-03, -3.10665203e-03, -5.03613157e-04,
+	4.49965748e-03, -6.24583312e-03, 4.11466035e-03, 1.21010863e-03,
+	-6.75057127e-03, 8.80973583e-03, -5.33025607e-03, -2.40862529e-03,
+	1.00188045e-02, -1.23568497e-02, 6.82233014e-03, 4.41843611e-03,
+	-1.49523235e-02, 1.75464309e-02, -8.77682047e-03, -7.92860440e-03,
+	2.30980373e-02, -2.60941954e-02, 1.17674357e-02, 1.49081789e-02,
+	-3.94271933e-02, 4.42059603e-02, -1.82504841e-02, -3.46936955e-02,
+	9.35928417e-02, -1.22823373e-01, 6.29811058e-02, 7.07214646e-01,
+	4.07286023e-01, -1.49894011e-01, 2.07199734e-02, 4.84839500e-02,
+	-6.47142516e-02, 4.25656541e-02, -5.25296792e-03, -2.45381837e-02,
+	3.37143639e-02, -2.24847580e-02, 1.36057382e-03, 1.62327086e-02,
+	-2.14354308e-02, 1.37427543e-02, 2.50106051e-04, -1.16674173e-02,
+	1.45906817e-02, -8.81773339e-03, -9.70703415e-04, 8.61401984e-03,
+	-1.01564135e-02, 5.71418496e-03, 1.23955185e-03, -6.37008685e-03,
+	7.07041702e-03, -3.66249049e-03, -1.25538535e-03, 4.65199758e-03,
+	-4.85716328e-03, 2.28877618e-03, 1.13113278e-03, -3.32309503e-03,
+	3.26150071e-03, -1.37778418e-03, -9.39346561e-04, 2.30440334e-03,
+	-2.12375212e-03, 7.89121208e-04, 7.28368579e-04, -1.54038033e-03,
+	1.33085984e-03, -4.23673103e-04, -5.29256238e-04, 9.85153597e-04,
+	-7.95990899e-04, 2.08860248e-04, 3.59723808e-04, -5.97491497e-04,
+	4.49884169e-04, -9.14370574e-05, -2.27221060e-04, 3.39690569e-04,
+	-2.37136631e-04, 3.32976947e-05, 1.31787257e-04, -1.78071165e-04,
+	1.14382911e-04, -8.40412810e-06, -6.87374865e-05, 8.38654745e-05,
+	-4.89744708e-05, 1.17476369e-07, 3.10336636e-05, -3.38638171e-05,
+	1.75860848e-05, 1.25184096e-06, -1.11696679e-05, 1.05492316e-05,
+	-4.61167091e-06, -6.33301256e-07, 2.46575822e-06, -1.69202459e-06,
+	-6.82803943e-07, 3.46840776e-06, -5.68545431e-06, 3.71696563e-06,
+	4.44652241e-06, -1.56022321e-05, 2.08484939e-05, -1.07033569e-05,
+	-1.59529673e-05, 4.56494978e-05, -5.42194601e-05, 2.25472572e-05,
+	4.40819713e-05, -1.08390685e-04, 1.17288911e-04, -3.85996510e-05,
+	-1.03674923e-04, 2.25262843e-04, -2.24379175e-04, 5.48219149e-05,
+	2.17539517e-04, -4.25259670e-04, 3.91737196e-04, -6.15939396e-05,
+	-4.18483077e-04, 7.45398653e-04, -6.36027305e-04, 4.11321892e-05,
+	7.51325723e-04, -1.23083664e-03, 9.72384012e-04, 3.54227683e-05,
+	-1.27509210e-03, 1.93504575e-03, -1.41235332e-03, -2.11378124e-04,
+	2.06610135e-03, -2.92102181e-03, 1.96222414e-03, 5.48946939e-04,
+	-3.22372472e-03, 4.26551701e-03, -2.62244349e-03, -1.13657456e-03,
+	4.88282781e-03, -6.07042950e-03, 3.38911990e-03, 2.10368093e-03,
+	-7.24232920e-03, 8.49079047e-03, -4.25941340e-03, -3.65477198e-03,
+	1.06344308e-02, -1.18043224e-02, 5.24521071e-03, 6.15819351e-03,
+	-1.57093917e-02, 1.66021818e-02, -6.40957677e-03, -1.04158114e-02,
+	2.40211913e-02, -2.44266711e-02, 7.99054242e-03, 1.87254218e-02,
+	-4.05494502e-02, 4.08380878e-02, -1.10692069e-02, -4.19073305e-02,
+	9.46248116e-02, -1.10598568e-01, 3.05924019e-02, 6.89083501e-01,
+	4.45901303e-01, -1.40737240e-01, 6.87683930e-03, 5.72875276e-02,
+	-6.61822520e-02, 3.86231189e-02, 2.93891942e-04, -2.82540782e-02,
+	3.40409052e-02, -2.00297295e-02, -1.91996532e-03, 1.83511087e-02,
+	-2.14370115e-02, 1.20199893e-02, 2.42233156e-03, -1.29907872e-02,
+	1.44654313e-02, -7.55693747e-03, -2.46859421e-03, 9.46492579e-03,
+	-9.98485087e-03, 4.78229450e-03, 2.28264569e-03, -6.91719998e-03,
+	6.89290981e-03, -2.97855831e-03, -1.97676891e-03, 4.99775091e-03,
+	-4.69503790e-03, 1.79570444e-03, 1.62119926e-03, -3.53511396e-03,
+	3.12507460e-03, -1.03139888e-03, -1.26364098e-03, 2.42910372e-03,
+	-2.01636379e-03, 5.53663405e-04, 9.35846383e-04, -1.60986029e-03,
+	1.25141179e-03, -2.69887235e-04, -6.56623127e-04, 1.02127094e-03,
+	-7.40794623e-04, 1.13113827e-04, 4.34104061e-04, -6.14639562e-04,
+	4.14056155e-04, -3.51722369e-05, -2.68101682e-04, 3.46883397e-04,
+	-2.15619608e-04, 2.50720638e-06, 1.52627626e-04, -1.80579767e-04,
+	1.02623436e-04, 6.97595091e-06, -7.83799518e-05, 8.44973121e-05,
+	-4.32929743e-05, -6.66470867e-06, 3.49382080e-05, -3.39264302e-05,
+	1.52938081e-05, 3.72437521e-06, -1.24562273e-05, 1.05313269e-05,
+	-3.94394920e-06, -1.25770839e-06, 2.74616398e-06, -1.70372888e-06,
+	-9.18959447e-07, 3.56715056e-06, -5.28571939e-06, 2.65614397e-06,
+	5.73661414e-06, -1.60448336e-05, 1.93249600e-05, -7.13273313e-06,
+	-1.98260710e-05, 4.66949103e-05, -4.98875719e-05, 1.34119079e-05,
+	5.31567242e-05, -1.10153647e-04, 1.06908427e-04, -1.86693025e-05,
+	-1.21966355e-04, 2.27345825e-04, -2.02283404e-04, 1.58587728e-05,
+	2.50676643e-04, -4.26141328e-04, 3.48725917e-04, 8.54272245e-06,
+	-4.73761574e-04, 7.41528281e-04, -5.58028683e-04, -7.71260348e-05,
+	8.37528238e-04, -1.21539123e-03, 8.38881730e-04, 2.24443575e-04,
+	-1.40203233e-03, 1.89629687e-03, -1.19451999e-03, -5.00409806e-04,
+	2.24388416e-03, -2.84020325e-03, 1.62055508e-03, 9.74992349e-04,
+	-3.46175470e-03, 4.11391800e-03, -2.10335001e-03, -1.74628867e-03,
+	5.18862600e-03, -5.80501671e-03, 2.61918181e-03, 2.95719816e-03,
+	-7.62019505e-03, 8.04658824e-03, -3.13413065e-03, -4.83423098e-03,
+	1.10838013e-02, -1.10787899e-02, 3.60389397e-03, 7.78821587e-03,
+	-1.62219386e-02, 1.54170250e-02, -3.97047223e-03, -1.27187726e-02,
+	2.45716034e-02, -2.24113154e-02, 4.14261578e-03, 2.22064957e-02,
+	-4.10440588e-02, 3.69164829e-02, -3.87057764e-03, -4.83127880e-02,
+	9.42119894e-02, -9.72895446e-02, 3.05864300e-04, 6.67691716e-01,
+	4.83399174e-01, -1.28793910e-01, -7.62847120e-03, 6.54695686e-02,
+	-6.66695395e-02, 3.40113821e-02, 5.93132554e-03, -3.15950486e-02,
+	3.38522473e-02, -1.72375677e-02, -5.21058197e-03, 2.02137161e-02,
+	-2.11117832e-02, 1.00960190e-02, 4.57961773e-03, -1.41292415e-02,
+	1.41185375e-02, -6.16897801e-03, -3.94298245e-03, 1.01795666e-02,
+	-9.65954402e-03, 3.76886626e-03, 3.30066277e-03, -7.36400524e-03,
+	6.60868126e-03, -2.24275761e-03, -2.67490318e-03, 5.27064600e-03,
+	-4.45974498e-03, 1.27037578e-03, 2.09145432e-03, -3.69536891e-03,
+	2.93956142e-03, -6.65630292e-04, -1.57212593e-03, 2.51808767e-03,
+	-1.87699561e-03, 3.07075767e-04, 1.13143715e-03, -1.65556892e-03,
+	1.15187697e-03, -1.10068445e-04, -7.75567508e-04, 1.04223778e-03,
+	-6.73527730e-04, 1.43256751e-05, 5.02882824e-04, -6.22620459e-04,
+	3.71351080e-04, 2.24916566e-05, -3.05513440e-04, 3.48869213e-04,
+	-1.90430855e-04, -2.88550226e-05, 1.71494438e-04, -1.80355935e-04,
+	8.90566257e-05, 2.25567015e-05, -8.70140002e-05, 8.38371446e-05,
+	-3.68117660e-05, -1.35062740e-05, 3.83988958e-05, -3.34625939e-05,
+	1.26973500e-05, 6.21428084e-06, -1.35894050e-05, 1.03459925e-05,
+	-3.18614326e-06, -1.89071111e-06, 2.99651831e-06, -1.68646109e-06,
+	-1.12611792e-06, 3.60534873e-06, -4.82128289e-06, 1.59428707e-06,
+	6.89543798e-06, -1.62294421e-05, 1.75519583e-05, -3.55070260e-06,
+	-2.32997563e-05, 4.70078950e-05, -4.49003072e-05, 4.27418811e-06,
+	6.12370523e-05, -1.10215875e-04, 9.51132276e-05, 1.17138507e-06,
+	-1.38085970e-04, 2.25958311e-04, -1.77503896e-04, -2.27091749e-05,
+	2.79504663e-04, -4.20574291e-04, 3.01089364e-04, 7.75346739e-05,
+	-5.21107537e-04, 7.26514637e-04, -4.72647743e-04, -1.92677120e-04,
+	9.09987821e-04, -1.18178711e-03, 6.94335349e-04, 4.07830154e-04,
+	-1.50632812e-03, 1.82935703e-03, -9.61079531e-04, -7.78725946e-04,
+	2.38587905e-03, -2.71735058e-03, 1.25795268e-03, 1.38197888e-03,
+	-3.64512801e-03, 3.90169687e-03, -1.55755282e-03, -2.32376881e-03,
+	5.41316861e-03, -5.45445099e-03, 1.81688903e-03, 3.75814229e-03,
+	-7.87951472e-03, 7.48499005e-03, -1.97189778e-03, -5.92981428e-03,
+	1.13616778e-02, -1.01928210e-02, 1.92375015e-03, 9.28497783e-03,
+	-1.64846475e-02, 1.40112630e-02, -1.49700254e-03, -1.48048265e-02,
+	2.47452636e-02, -2.00826448e-02, 2.82343320e-04, 2.53039999e-02,
+	-4.09134724e-02, 3.25094028e-02, 3.23834372e-03, -5.38361058e-02,
+	9.24063933e-02, -8.31289723e-02, -2.76920678e-02, 6.43232112e-01,
+	5.19456992e-01, -1.14046215e-01, -2.26096145e-02, 7.28889901e-02,
+	-6.61455530e-02, 2.87870490e-02, 1.15753232e-02, -3.45045882e-02,
+	3.31440907e-02, -1.41464148e-02, -8.46132682e-03, 2.17892748e-02,
+	-2.04611493e-02, 7.99803249e-03, 6.68896598e-03, -1.50636183e-02,
+	1.35531389e-02, -4.67378366e-03, -5.37118745e-03, 1.07457809e-02,
+	-9.18401813e-03, 2.68858507e-03, 4.27785522e-03, -7.70275603e-03,
+	6.22106254e-03, -1.46581619e-03, -3.33892100e-03, 5.46581886e-03,
+	-4.15416005e-03, 7.20485934e-04, 2.53452399e-03, -3.80088758e-03,
+	2.70728549e-03, -2.85859075e-04, -1.85992122e-03, 2.56960637e-03,
+	-1.70742124e-03, 5.30004430e-05, 1.31201318e-03, -1.67652580e-03,
+	1.03353465e-03, 5.34126718e-05, -8.84162006e-04, 1.04753619e-03,
+	-5.95059771e-04, -8.60319782e-05, 5.64927087e-04, -6.21179616e-04,
+	3.22322333e-04, 8.06905932e-05, -3.38827058e-04, 3.45533120e-04,
+	-1.61896472e-04, -6.03160249e-05, 1.88061688e-04, -1.77352501e-04,
+	7.38572002e-05, 3.81012893e-05, -9.44849963e-05, 8.18671238e-05,
+	-2.96132996e-05, -2.03021736e-05, 4.13505648e-05, -3.24655311e-05,
+	9.82885194e-06, 8.68280505e-06, -1.45461725e-05, 9.99017546e-06,
+	-2.34693077e-06, -2.52224834e-06, 3.21093698e-06, -1.63859263e-06,
+	-1.30250116e-06, 3.58530580e-06, -4.30213868e-06, 5.47924854e-07,
+	7.90955124e-06, -1.61612338e-05, 1.55638107e-05, -1.22332017e-08,
+	-2.63312992e-05, 4.66013853e-05, -3.93484984e-05, -4.72713959e-06,
+	6.82212532e-05, -1.08610665e-04, 8.21094276e-05, 2.06235648e-05,
+	-1.51828760e-04, 2.21181617e-04, -1.50460765e-04, -6.03048336e-05,
+	3.03655538e-04, -4.08741606e-04, 2.49616810e-04, 1.44355270e-04,
+	-5.59916906e-04, 7.00737623e-04, -3.81273907e-04, -3.03809743e-04,
+	9.67784213e-04, -1.13075794e-03, 5.41063597e-04, 5.82878002e-04,
+	-1.58666657e-03, 1.73555862e-03, -7.15733442e-04, -1.04223826e-03,
+	2.49032437e-03, -2.55476275e-03, 8.80112100e-04, 1.76395169e-03,
+	-3.77162202e-03, 3.63265829e-03, -9.93557105e-04, -2.86060179e-03,
+	5.55383687e-03, -5.02482941e-03, 9.94660874e-04, 4.49490550e-03,
+	-8.01746739e-03, 6.81555709e-03, -7.90601596e-04, -6.92575842e-03,
+	1.14654584e-02, -9.16128706e-03, 2.30494607e-04, 1.06271892e-02,
+	-1.64960176e-02, 1.24083144e-02, 9.73211412e-04, -1.66449268e-02,
+	2.45438636e-02, -1.74794547e-02, -3.53216346e-03, 2.79769231e-02,
+	-4.01693964e-02, 2.76910811e-02, 1.01539822e-02, -5.84178296e-02,
+	8.92778679e-02, -6.83507551e-02, -5.32422215e-02, 6.15924267e-01,
+	5.53761503e-01, -9.65057253e-02, -3.78664670e-02, 7.94116923e-02,
+	-6.45940199e-02, 2.30170158e-02, 1.71403379e-02, -3.69318456e-02,
+	3.19199409e-02, -1.07994353e-02, -1.16222561e-02, 2.30505342e-02,
+	-1.94914740e-02, 5.75614887e-03, 8.71777299e-03, -1.57776721e-02,
+	1.27757297e-02, -3.09310542e-03, -6.73101827e-03, 1.11535543e-02,
+	-8.56411975e-03, 1.55729085e-03, 5.19895093e-03, -7.92728069e-03,
+	5.73499242e-03, -6.59190587e-04, -3.95837200e-03, 5.57954442e-03,
+	-3.78225932e-03, 1.54181443e-04, 2.94337551e-03, -3.84950326e-03,
+	2.43130937e-03, 1.02263664e-04, -2.12241061e-03, 2.58246463e-03,
+	-1.50989584e-03, -2.04764612e-04, 1.47464032e-03, -1.67211772e-03,
+	8.97967460e-04, 2.18100108e-04, -9.80613407e-04, 1.03688172e-03,
+	-5.06443622e-04, -1.86442734e-04, 6.19191336e-04, -6.10203498e-04,
+	2.67628664e-04, 1.38539161e-04, -3.67466450e-04, 3.36840314e-04,
+	-1.30399555e-04, -9.13931568e-05, 2.02033063e-04, -1.71564388e-04,
+	5.72284955e-05, 5.33687231e-05, -1.00653150e-04, 7.85893831e-05,
+	-2.17930725e-05, -2.69455779e-05, 4.37343956e-05, -3.09366685e-05,
+	6.72565582e-06, 1.10903672e-05, -1.53055752e-05, 9.46346955e-06,
+	-1.43666410e-06, -3.14183971e-06, 3.38386159e-06, -1.55896967e-06,
+	-1.44696146e-06, 3.51017362e-06, -3.73874566e-06, -4.67262644e-07,
+	8.76821418e-06, -1.58491364e-05, 1.33971663e-05, 3.42985673e-06,
+	-2.88858296e-05, 4.54989943e-05, -3.33295058e-05, -1.34584272e-05,
+	7.40264339e-05, -1.05395997e-04, 6.81175162e-05, 3.93998542e-05,
+	-1.63029468e-04, 2.13147054e-04, -1.21601390e-04, -9.63752378e-05,
+	3.22837911e-04, -3.90918431e-04, 1.95143874e-04, 2.08025605e-04,
+	-5.89723371e-04, 6.64734851e-04, -2.85368719e-04, -4.08901760e-04,
+	1.01023074e-03, -1.06329186e-03, 3.81489034e-04, 7.47040876e-04,
+	-1.64211240e-03, 1.61662507e-03, -4.62322006e-04, -1.28712700e-03,
+	2.55604518e-03, -2.35531527e-03, 4.92899927e-04, 2.11539465e-03,
+	-3.83989613e-03, 3.31142816e-03, -4.20060272e-04, -3.34906958e-03,
+	5.60930429e-03, -4.52338606e-03, 1.65101836e-04, 5.15695704e-03,
+	-8.03309121e-03, 6.04939076e-03, 3.91747975e-04, -7.80794926e-03,
+	1.13951922e-02, -8.00111605e-03, -1.45020305e-03, 1.17960942e-02,
+	-1.62583492e-02, 1.06343301e-02, 3.40298998e-03, -1.82140392e-02,
+	2.39747065e-02, -1.46441877e-02, -7.24422797e-03, 3.01911638e-02,
+	-3.88324741e-02, 2.25405375e-02, 1.67776774e-02, -6.20135166e-02,
+	8.49126395e-02, -5.31872343e-02, -7.62138948e-02, 5.86012151e-01,
+	5.86012151e-01, -7.62138948e-02, -5.31872343e-02, 8.49126395e-02,
+	-6.20135166e-02, 1.67776774e-02, 2.25405375e-02, -3.88324741e-02,
+	3.01911638e-02, -7.24422797e-03, -1.46441877e-02, 2.39747065e-02,
+	-1.82140392e-02, 3.40298998e-03, 1.06343301e-02, -1.62583492e-02,
+	1.17960942e-02, -1.45020305e-03, -8.00111605e-03, 1.13951922e-02,
+	-7.80794926e-03, 3.91747975e-04, 6.04939076e-03, -8.03309121e-03,
+	5.15695704e-03, 1.65101836e-04, -4.52338606e-03, 5.60930429e-03,
+	-3.34906958e-03, -4.20060272e-04, 3.31142816e-03, -3.83989613e-03,
+	2.11539465e-03, 4.92899927e-04, -2.35531527e-03, 2.55604518e-03,
+	-1.28712700e-03, -4.62322006e-04, 1.61662507e-03, -1.64211240e-03,
+	7.47040876e-04, 3.81489034e-04, -1.06329186e-03, 1.01023074e-03,
+	-4.08901760e-04, -2.85368719e-04, 6.64734851e-04, -5.89723371e-04,
+	2.08025605e-04, 1.95143874e-04, -3.90918431e-04, 3.22837911e-04,
+	-9.63752378e-05, -1.21601390e-04, 2.13147054e-04, -1.63029468e-04,
+	3.93998542e-05, 6.81175162e-05, -1.05395997e-04, 7.40264339e-05,
+	-1.34584272e-05, -3.33295058e-05, 4.54989943e-05, -2.88858296e-05,
+	3.42985673e-06, 1.33971663e-05, -1.58491364e-05, 8.76821418e-06,
+	-4.67262644e-07, -3.73874566e-06, 3.51017362e-06, -1.44696146e-06,
+	-1.55896967e-06, 3.38386159e-06, -3.14183971e-06, -1.43666410e-06,
+	9.46346955e-06, -1.53055752e-05, 1.10903672e-05, 6.72565582e-06,
+	-3.09366685e-05, 4.37343956e-05, -2.69455779e-05, -2.17930725e-05,
+	7.85893831e-05, -1.00653150e-04, 5.33687231e-05, 5.72284955e-05,
+	-1.71564388e-04, 2.02033063e-04, -9.13931568e-05, -1.30399555e-04,
+	3.36840314e-04, -3.67466450e-04, 1.38539161e-04, 2.67628664e-04,
+	-6.10203498e-04, 6.19191336e-04, -1.86442734e-04, -5.06443622e-04,
+	1.03688172e-03, -9.80613407e-04, 2.18100108e-04, 8.97967460e-04,
+	-1.67211772e-03, 1.47464032e-03, -2.04764612e-04, -1.50989584e-03,
+	2.58246463e-03, -2.12241061e-03, 1.02263664e-04, 2.43130937e-03,
+	-3.84950326e-03, 2.94337551e-03, 1.54181443e-04, -3.78225932e-03,
+	5.57954442e-03, -3.95837200e-03, -6.59190587e-04, 5.73499242e-03,
+	-7.92728069e-03, 5.19895093e-03, 1.55729085e-03, -8.56411975e-03,
+	1.11535543e-02, -6.73101827e-03, -3.09310542e-03, 1.27757297e-02,
+	-1.57776721e-02, 8.71777299e-03, 5.75614887e-03, -1.94914740e-02,
+	2.30505342e-02, -1.16222561e-02, -1.07994353e-02, 3.19199409e-02,
+	-3.69318456e-02, 1.71403379e-02, 2.30170158e-02, -6.45940199e-02,
+	7.94116923e-02, -3.78664670e-02, -9.65057253e-02, 5.53761503e-01,
+	6.15924267e-01, -5.32422215e-02, -6.83507551e-02, 8.92778679e-02,
+	-5.84178296e-02, 1.01539822e-02, 2.76910811e-02, -4.01693964e-02,
+	2.79769231e-02, -3.53216346e-03, -1.74794547e-02, 2.45438636e-02,
+	-1.66449268e-02, 9.73211412e-04, 1.24083144e-02, -1.64960176e-02,
+	1.06271892e-02, 2.30494607e-04, -9.16128706e-03, 1.14654584e-02,
+	-6.92575842e-03, -7.90601596e-04, 6.81555709e-03, -8.01746739e-03,
+	4.49490550e-03, 9.94660874e-04, -5.02482941e-03, 5.55383687e-03,
+	-2.86060179e-03, -9.93557105e-04, 3.63265829e-03, -3.77162202e-03,
+	1.76395169e-03, 8.80112100e-04, -2.55476275e-03, 2.49032437e-03,
+	-1.04223826e-03, -7.15733442e-04, 1.73555862e-03, -1.58666657e-03,
+	5.82878002e-04, 5.41063597e-04, -1.13075794e-03, 9.67784213e-04,
+	-3.03809743e-04, -3.81273907e-04, 7.00737623e-04, -5.59916906e-04,
+	1.44355270e-04, 2.49616810e-04, -4.08741606e-04, 3.03655538e-04,
+	-6.03048336e-05, -1.50460765e-04, 2.21181617e-04, -1.51828760e-04,
+	2.06235648e-05, 8.21094276e-05, -1.08610665e-04, 6.82212532e-05,
+	-4.72713959e-06, -3.93484984e-05, 4.66013853e-05, -2.63312992e-05,
+	-1.22332017e-08, 1.55638107e-05, -1.61612338e-05, 7.90955124e-06,
+	5.47924854e-07, -4.30213868e-06, 3.58530580e-06, -1.30250116e-06,
+	-1.63859263e-06, 3.21093698e-06, -2.52224834e-06, -2.34693077e-06,
+	9.99017546e-06, -1.45461725e-05, 8.68280505e-06, 9.82885194e-06,
+	-3.24655311e-05, 4.13505648e-05, -2.03021736e-05, -2.96132996e-05,
+	8.18671238e-05, -9.44849963e-05, 3.81012893e-05, 7.38572002e-05,
+	-1.77352501e-04, 1.88061688e-04, -6.03160249e-05, -1.61896472e-04,
+	3.45533120e-04, -3.38827058e-04, 8.06905932e-05, 3.22322333e-04,
+	-6.21179616e-04, 5.64927087e-04, -8.60319782e-05, -5.95059771e-04,
+	1.04753619e-03, -8.84162006e-04, 5.34126718e-05, 1.03353465e-03,
+	-1.67652580e-03, 1.31201318e-03, 5.30004430e-05, -1.70742124e-03,
+	2.56960637e-03, -1.85992122e-03, -2.85859075e-04, 2.70728549e-03,
+	-3.80088758e-03, 2.53452399e-03, 7.20485934e-04, -4.15416005e-03,
+	5.46581886e-03, -3.33892100e-03, -1.46581619e-03, 6.22106254e-03,
+	-7.70275603e-03, 4.27785522e-03, 2.68858507e-03, -9.18401813e-03,
+	1.07457809e-02, -5.37118745e-03, -4.67378366e-03, 1.35531389e-02,
+	-1.50636183e-02, 6.68896598e-03, 7.99803249e-03, -2.04611493e-02,
+	2.17892748e-02, -8.46132682e-03, -1.41464148e-02, 3.31440907e-02,
+	-3.45045882e-02, 1.15753232e-02, 2.87870490e-02, -6.61455530e-02,
+	7.28889901e-02, -2.26096145e-02, -1.14046215e-01, 5.19456992e-01,
+	6.43232112e-01, -2.76920678e-02, -8.31289723e-02, 9.24063933e-02,
+	-5.38361058e-02, 3.23834372e-03, 3.25094028e-02, -4.09134724e-02,
+	2.53039999e-02, 2.82343320e-04, -2.00826448e-02, 2.47452636e-02,
+	-1.48048265e-02, -1.49700254e-03, 1.40112630e-02, -1.64846475e-02,
+	9.28497783e-03, 1.92375015e-03, -1.01928210e-02, 1.13616778e-02,
+	-5.92981428e-03, -1.97189778e-03, 7.48499005e-03, -7.87951472e-03,
+	3.75814229e-03, 1.81688903e-03, -5.45445099e-03, 5.41316861e-03,
+	-2.32376881e-03, -1.55755282e-03, 3.90169687e-03, -3.64512801e-03,
+	1.38197888e-03, 1.25795268e-03, -2.71735058e-03, 2.38587905e-03,
+	-7.78725946e-04, -9.61079531e-04, 1.82935703e-03, -1.50632812e-03,
+	4.07830154e-04, 6.94335349e-04, -1.18178711e-03, 9.09987821e-04,
+	-1.92677120e-04, -4.72647743e-04, 7.26514637e-04, -5.21107537e-04,
+	7.75346739e-05, 3.01089364e-04, -4.20574291e-04, 2.79504663e-04,
+	-2.27091749e-05, -1.77503896e-04, 2.25958311e-04, -1.38085970e-04,
+	1.17138507e-06, 9.51132276e-05, -1.10215875e-04, 6.12370523e-05,
+	4.27418811e-06, -4.49003072e-05, 4.70078950e-05, -2.32997563e-05,
+	-3.55070260e-06, 1.75519583e-05, -1.62294421e-05, 6.89543798e-06,
+	1.59428707e-06, -4.82128289e-06, 3.60534873e-06, -1.12611792e-06,
+	-1.68646109e-06, 2.99651831e-06, -1.89071111e-06, -3.18614326e-06,
+	1.03459925e-05, -1.35894050e-05, 6.21428084e-06, 1.26973500e-05,
+	-3.34625939e-05, 3.83988958e-05, -1.35062740e-05, -3.68117660e-05,
+	8.38371446e-05, -8.70140002e-05, 2.25567015e-05, 8.90566257e-05,
+	-1.80355935e-04, 1.71494438e-04, -2.88550226e-05, -1.90430855e-04,
+	3.48869213e-04, -3.05513440e-04, 2.24916566e-05, 3.71351080e-04,
+	-6.22620459e-04, 5.02882824e-04, 1.43256751e-05, -6.73527730e-04,
+	1.04223778e-03, -7.75567508e-04, -1.10068445e-04, 1.15187697e-03,
+	-1.65556892e-03, 1.13143715e-03, 3.07075767e-04, -1.87699561e-03,
+	2.51808767e-03, -1.57212593e-03, -6.65630292e-04, 2.93956142e-03,
+	-3.69536891e-03, 2.09145432e-03, 1.27037578e-03, -4.45974498e-03,
+	5.27064600e-03, -2.67490318e-03, -2.24275761e-03, 6.60868126e-03,
+	-7.36400524e-03, 3.30066277e-03, 3.76886626e-03, -9.65954402e-03,
+	1.01795666e-02, -3.94298245e-03, -6.16897801e-03, 1.41185375e-02,
+	-1.41292415e-02, 4.57961773e-03, 1.00960190e-02, -2.11117832e-02,
+	2.02137161e-02, -5.21058197e-03, -1.72375677e-02, 3.38522473e-02,
+	-3.15950486e-02, 5.93132554e-03, 3.40113821e-02, -6.66695395e-02,
+	6.54695686e-02, -7.62847120e-03, -1.28793910e-01, 4.83399174e-01,
+	6.67691716e-01, 3.05864300e-04, -9.72895446e-02, 9.42119894e-02,
+	-4.83127880e-02, -3.87057764e-03, 3.69164829e-02, -4.10440588e-02,
+	2.22064957e-02, 4.14261578e-03, -2.24113154e-02, 2.45716034e-02,
+	-1.27187726e-02, -3.97047223e-03, 1.54170250e-02, -1.62219386e-02,
+	7.78821587e-03, 3.60389397e-03, -1.10787899e-02, 1.10838013e-02,
+	-4.83423098e-03, -3.13413065e-03, 8.04658824e-03, -7.62019505e-03,
+	2.95719816e-03, 2.61918181e-03, -5.80501671e-03, 5.18862600e-03,
+	-1.74628867e-03, -2.10335001e-03, 4.11391800e-03, -3.46175470e-03,
+	9.74992349e-04, 1.62055508e-03, -2.84020325e-03, 2.24388416e-03,
+	-5.00409806e-04, -1.19451999e-03, 1.89629687e-03, -1.40203233e-03,
+	2.24443575e-04, 8.38881730e-04, -1.21539123e-03, 8.37528238e-04,
+	-7.71260348e-05, -5.58028683e-04, 7.41528281e-04, -4.73761574e-04,
+	8.54272245e-06, 3.48725917e-04, -4.26141328e-04, 2.50676643e-04,
+	1.58587728e-05, -2.02283404e-04, 2.27345825e-04, -1.21966355e-04,
+	-1.86693025e-05, 1.06908427e-04, -1.10153647e-04, 5.31567242e-05,
+	1.34119079e-05, -4.98875719e-05, 4.66949103e-05, -1.98260710e-05,
+	-7.13273313e-06, 1.93249600e-05, -1.60448336e-05, 5.73661414e-06,
+	2.65614397e-06, -5.28571939e-06, 3.56715056e-06, -9.18959447e-07,
+	-1.70372888e-06, 2.74616398e-06, -1.25770839e-06, -3.94394920e-06,
+	1.05313269e-05, -1.24562273e-05, 3.72437521e-06, 1.52938081e-05,
+	-3.39264302e-05, 3.49382080e-05, -6.66470867e-06, -4.32929743e-05,
+	8.44973121e-05, -7.83799518e-05, 6.97595091e-06, 1.02623436e-04,
+	-1.80579767e-04, 1.52627626e-04, 2.50720638e-06, -2.15619608e-04,
+	3.46883397e-04, -2.68101682e-04, -3.51722369e-05, 4.14056155e-04,
+	-6.14639562e-04, 4.34104061e-04, 1.13113827e-04, -7.40794623e-04,
+	1.02127094e-03, -6.56623127e-04, -2.69887235e-04, 1.25141179e-03,
+	-1.60986029e-03, 9.35846383e-04, 5.53663405e-04, -2.01636379e-03,
+	2.42910372e-03, -1.26364098e-03, -1.03139888e-03, 3.12507460e-03,
+	-3.53511396e-03, 1.62119926e-03, 1.79570444e-03, -4.69503790e-03,
+	4.99775091e-03, -1.97676891e-03, -2.97855831e-03, 6.89290981e-03,
+	-6.91719998e-03, 2.28264569e-03, 4.78229450e-03, -9.98485087e-03,
+	9.46492579e-03, -2.46859421e-03, -7.55693747e-03, 1.44654313e-02,
+	-1.29907872e-02, 2.42233156e-03, 1.20199893e-02, -2.14370115e-02,
+	1.83511087e-02, -1.91996532e-03, -2.00297295e-02, 3.40409052e-02,
+	-2.82540782e-02, 2.93891942e-04, 3.86231189e-02, -6.61822520e-02,
+	5.72875276e-02, 6.87683930e-03, -1.40737240e-01, 4.45901303e-01,
+	6.89083501e-01, 3.05924019e-02, -1.10598568e-01, 9.46248116e-02,
+	-4.19073305e-02, -1.10692069e-02, 4.08380878e-02, -4.05494502e-02,
+	1.87254218e-02, 7.99054242e-03, -2.44266711e-02, 2.40211913e-02,
+	-1.04158114e-02, -6.40957677e-03, 1.66021818e-02, -1.57093917e-02,
+	6.15819351e-03, 5.24521071e-03, -1.18043224e-02, 1.06344308e-02,
+	-3.65477198e-03, -4.25941340e-03, 8.49079047e-03, -7.24232920e-03,
+	2.10368093e-03, 3.38911990e-03, -6.07042950e-03, 4.88282781e-03,
+	-1.13657456e-03, -2.62244349e-03, 4.26551701e-03, -3.22372472e-03,
+	5.48946939e-04, 1.96222414e-03, -2.92102181e-03, 2.06610135e-03,
+	-2.11378124e-04, -1.41235332e-03, 1.93504575e-03, -1.27509210e-03,
+	3.54227683e-05, 9.72384012e-04, -1.23083664e-03, 7.51325723e-04,
+	4.11321892e-05, -6.36027305e-04, 7.45398653e-04, -4.18483077e-04,
+	-6.15939396e-05, 3.91737196e-04, -4.25259670e-04, 2.17539517e-04,
+	5.48219149e-05, -2.24379175e-04, 2.25262843e-04, -1.03674923e-04,
+	-3.85996510e-05, 1.17288911e-04, -1.08390685e-04, 4.40819713e-05,
+	2.25472572e-05, -5.42194601e-05, 4.56494978e-05, -1.59529673e-05,
+	-1.07033569e-05, 2.08484939e-05, -1.56022321e-05, 4.44652241e-06,
+	3.71696563e-06, -5.68545431e-06, 3.46840776e-06, -6.82803943e-07,
+	-1.69202459e-06, 2.46575822e-06, -6.33301256e-07, -4.61167091e-06,
+	1.05492316e-05, -1.11696679e-05, 1.25184096e-06, 1.75860848e-05,
+	-3.38638171e-05, 3.10336636e-05, 1.17476369e-07, -4.89744708e-05,
+	8.38654745e-05, -6.87374865e-05, -8.40412810e-06, 1.14382911e-04,
+	-1.78071165e-04, 1.31787257e-04, 3.32976947e-05, -2.37136631e-04,
+	3.39690569e-04, -2.27221060e-04, -9.14370574e-05, 4.49884169e-04,
+	-5.97491497e-04, 3.59723808e-04, 2.08860248e-04, -7.95990899e-04,
+	9.85153597e-04, -5.29256238e-04, -4.23673103e-04, 1.33085984e-03,
+	-1.54038033e-03, 7.28368579e-04, 7.89121208e-04, -2.12375212e-03,
+	2.30440334e-03, -9.39346561e-04, -1.37778418e-03, 3.26150071e-03,
+	-3.32309503e-03, 1.13113278e-03, 2.28877618e-03, -4.85716328e-03,
+	4.65199758e-03, -1.25538535e-03, -3.66249049e-03, 7.07041702e-03,
+	-6.37008685e-03, 1.23955185e-03, 5.71418496e-03, -1.01564135e-02,
+	8.61401984e-03, -9.70703415e-04, -8.81773339e-03, 1.45906817e-02,
+	-1.16674173e-02, 2.50106051e-04, 1.37427543e-02, -2.14354308e-02,
+	1.62327086e-02, 1.36057382e-03, -2.24847580e-02, 3.37143639e-02,
+	-2.45381837e-02, -5.25296792e-03, 4.25656541e-02, -6.47142516e-02,
+	4.84839500e-02, 2.07199734e-02, -1.49894011e-01, 4.07286023e-01,
+	7.07214646e-01, 6.29811058e-02, -1.22823373e-01, 9.35928417e-02,
+	-3.46936955e-02, -1.82504841e-02, 4.42059603e-02, -3.94271933e-02,
+	1.49081789e-02, 1.17674357e-02, -2.60941954e-02, 2.30980373e-02,
+	-7.92860440e-03, -8.77682047e-03, 1.75464309e-02, -1.49523235e-02,
+	4.41843611e-03, 6.82233014e-03, -1.23568497e-02, 1.00188045e-02,
+	-2.40862529e-03, -5.33025607e-03, 8.80973583e-03, -6.75057127e-03,
+	1.21010863e-03, 4.11466035e-03, -6.24583312e-03, 4.49965748e-03,
+	-5.03613157e-04, -3.10665203e-03, 4.35357672e-03, -2.93411771e-03,
+	1.10149750e-04, 2.27752500e-03, -2.95812515e-03, 1.85485829e-03,
+	8.40718514e-05, -1.61107500e-03, 1.94468721e-03, -1.12718226e-03,
+	-1.56409048e-04, 1.09266411e-03, -1.22765867e-03, 6.52523002e-04,
+	1.60322140e-04, -7.05348624e-04, 7.37911591e-04, -3.56006525e-04,
+	-1.31816024e-04, 4.29393127e-04, -4.17842632e-04, 1.80533552e-04,
+	9.35875361e-05, -2.43405310e-04, 2.19680181e-04, -8.34539833e-05,
+	-5.83137663e-05, 1.26066428e-04, -1.04919393e-04, 3.41321216e-05,
+	3.15384129e-05, -5.78132419e-05, 4.38698684e-05, -1.17305521e-05,
+	-1.42062689e-05, 2.20911806e-05, -1.49004142e-05, 3.04118198e-06,
+	4.75961310e-06, -6.01114648e-06, 3.30774491e-06, -4.20060905e-07,
+	-1.65339697e-06, 2.16139642e-06, -2.69845243e-08, -5.18238204e-06,
+	1.04052692e-05, -9.75440493e-06, -1.16597441e-06, 1.95475947e-05,
+	-3.32894205e-05, 2.67556131e-05, 6.73858688e-06, -5.37878187e-05,
+	8.19787662e-05, -5.82534254e-05, -2.33543853e-05, 1.24191067e-04,
+	-1.72917910e-04, 1.09323553e-04, 6.30601737e-05, -2.54716846e-04,
+	3.27482700e-04, -1.83543671e-04, -1.45472943e-04, 4.78393954e-04,
+	-5.71566010e-04, 2.80944200e-04, 3.00158587e-04, -8.38441106e-04,
+	9.34626246e-04, -3.95497514e-04, -5.69175726e-04, 1.38926104e-03,
+	-1.44845755e-03, 5.12275375e-04, 1.01001621e-03, -2.19789007e-03,
+	2.14625654e-03, -6.04310219e-04, -1.69975456e-03, 3.34728126e-03,
+	-3.06303698e-03, 6.28855139e-04, 2.74245804e-03, -4.94437904e-03,
+	4.23930456e-03, -5.21868347e-04, -4.28471036e-03, 7.13951477e-03,
+	-5.73185576e-03, 1.87362722e-04, 6.55121901e-03, -1.01730599e-02,
+	7.64095398e-03, 5.27866177e-04, -9.93354277e-03, 1.44945219e-02,
+	-1.01808930e-02, -1.90416527e-03, 1.52404330e-02, -2.11105664e-02,
+	1.38932632e-02, 4.58182795e-03, -2.45700396e-02, 3.28845587e-02,
+	-2.05086067e-02, -1.06279909e-02, 4.57933024e-02, -6.23096380e-02,
+	3.92047774e-02, 3.37302613e-02, -1.56310586e-01, 3.67881969e-01,
+	7.21921166e-01, 9.72598017e-02, -1.33735371e-01, 9.10831295e-02,
+	-2.67596317e-02, -2.53053726e-02, 4.69589425e-02, -3.76842690e-02,
+	1.08079341e-02, 1.54149108e-02, -2.73842252e-02, 2.18118577e-02,
+	-5.29297261e-03, -1.10354035e-02, 1.82329262e-02, -1.39598242e-02,
+	2.59436817e-03, 8.31061640e-03, -1.27263185e-02, 9.24474183e-03,
+	-1.11415491e-03, -6.32983567e-03, 8.99739923e-03, -6.15135473e-03,
+	2.89727089e-04, 4.78432378e-03, -6.32769803e-03, 4.04421604e-03,
+	1.43166985e-04, -3.54824644e-03, 4.37612081e-03, -2.59683192e-03,
+	-3.34832630e-04, 2.56136885e-03, -2.95048225e-03, 1.61301926e-03,
+	3.81497355e-04, -1.78743335e-03, 1.92473953e-03, -9.60318179e-04,
+	-3.48151767e-04, 1.19771971e-03, -1.20567209e-03, 5.42470594e-04,
+	2.78630723e-04, -7.64813253e-04, 7.19024258e-04, -2.87187389e-04,
+	-2.01047418e-04, 4.61034964e-04, -4.03902716e-04, 1.40165609e-04,
+	1.31556190e-04, -2.59016672e-04, 2.10622157e-04, -6.15800770e-05,
+	-7.75033164e-05, 1.33073854e-04, -9.97585203e-05, 2.34426428e-05,
+	4.02426385e-05, -6.05957749e-05, 4.13656782e-05, -7.21571554e-06,
+	-1.75846826e-05, 2.30251692e-05, -1.39422526e-05, 1.53901564e-06,
+	5.76659824e-06, -6.25429151e-06, 3.08478163e-06, -1.33760133e-07,
+	-1.59025522e-06, 1.83927197e-06, 5.52444970e-07, -5.65095323e-06,
+	1.01073388e-05, -8.23632870e-06, -3.49366753e-06, 2.11575668e-05,
+	-3.22253663e-05, 2.21783884e-05, 1.31017602e-05, -5.76793338e-05,
+	7.88926323e-05, -4.71039838e-05, -3.76566953e-05, 1.31936270e-04,
+	-1.65246324e-04, 8.56052033e-05, 9.13617217e-05, -2.68159214e-04,
+	3.10524694e-04, -1.37773573e-04, -1.96496277e-04, 4.99261613e-04,
+	-5.37380194e-04, 1.99017313e-04, 3.85688801e-04, -8.67671572e-04,
+	8.70637942e-04, -2.57448876e-04, -7.04297654e-04, 1.42598515e-03,
+	-1.33574435e-03, 2.90931198e-04, 1.21317423e-03, -2.23802390e-03,
+	1.95741453e-03, -2.63708194e-04, -1.99269990e-03, 3.38163936e-03,
+	-2.75935329e-03, 1.22075772e-04, 3.15028222e-03, -4.95609201e-03,
+	3.76654537e-03, 2.12587991e-04, -4.83639865e-03, 7.10016818e-03,
+	-5.01298785e-03, -8.57950130e-04, 7.28163270e-03, -1.00359672e-02,
+	6.56154638e-03, 2.00449328e-03, -1.08888971e-02, 1.41805204e-02,
+	-8.55522171e-03, -4.00818782e-03, 1.64927776e-02, -2.04707668e-02,
+	1.13704520e-02, 7.69605886e-03, -2.62589065e-02, 3.15707801e-02,
+	-1.62303476e-02, -1.57538099e-02, 4.82717589e-02, -5.90251246e-02,
+	2.95986704e-02, 4.57543640e-02, -1.60060739e-01, 3.28020346e-01,
+	7.33069691e-01, 1.33192422e-01, -1.43112904e-01, 8.70828127e-02,
+	-1.82057428e-02, -3.21244255e-02, 4.90440119e-02, -3.53371356e-02,
+	6.48290230e-03, 1.88757710e-02, -2.82724586e-02, 2.01779940e-02,
+	-2.54738799e-03, -1.31497879e-02, 1.86485689e-02, -1.27446561e-02,
+	7.12945054e-04, 9.68654996e-03, -1.29053678e-02, 8.32254852e-03,
+	2.09367904e-04, -7.24225871e-03, 9.04970031e-03, -5.45281092e-03,
+	-6.43685227e-04, 5.38737480e-03, -6.31388780e-03, 3.52275589e-03,
+	7.94035089e-04, -3.94007205e-03, 4.33215341e-03, -2.21653293e-03,
+	-7.79271805e-04, 2.80909433e-03, -2.89773486e-03, 1.34394712e-03,
+	6.76376469e-04, -1.93848215e-03, 1.87516812e-03, -7.76828875e-04,
+	-5.36871913e-04, 1.28575707e-03, -1.16497748e-03, 4.22708765e-04,
+	3.94234493e-04, -8.13377073e-04, 6.88868174e-04, -2.12990694e-04,
+	-2.68211493e-04, 4.86086505e-04, -3.83552956e-04, 9.70023940e-05,
+	1.68130840e-04, -2.70914907e-04, 1.98167152e-04, -3.83603132e-05,
+	-9.58622660e-05, 1.38168208e-04, -9.29534065e-05, 1.21633740e-05,
+	4.85184934e-05, -6.25048718e-05, 3.81581559e-05, -2.47140851e-06,
+	-2.07822165e-05, 2.36266841e-05, -1.27347968e-05, -3.93680550e-08,
+	6.72035860e-06, -6.40739879e-06, 2.80018498e-06, 1.72471310e-07,
+	-1.50530567e-06, 1.50556629e-06, 1.09700330e-06, -6.01406709e-06,
+	9.66547200e-06, -6.64209918e-06, -5.69827211e-06, 2.24012067e-05,
+	-3.07007067e-05, 1.73790646e-05, 1.91163367e-05, -6.06105781e-05,
+	7.46795934e-05, -3.54718921e-05, -5.11070656e-05, 1.37540328e-04,
+	-1.55218649e-04, 6.10134380e-05, 1.17798946e-04, -2.77328738e-04,
+	2.89149206e-04, -9.06356090e-05, -2.43780873e-04, 5.12283718e-04,
+	-4.95568841e-04, 1.15225498e-04, 4.64235991e-04, -8.83414928e-04,
+	7.94329216e-04, -1.17250765e-04, -8.27124206e-04, 1.44073740e-03,
+	-1.20418822e-03, 6.77412699e-05, 1.39572504e-03, -2.24392238e-03,
+	1.74106295e-03, 7.72540526e-05, -2.25249696e-03, 3.36458346e-03,
+	-2.41707241e-03, -3.81504440e-04, 3.50653732e-03, -4.89285579e-03,
+	3.24143553e-03, 9.36881175e-04, -5.30988425e-03, 6.95398085e-03,
+	-4.22508522e-03, -1.88066618e-03, 7.89538013e-03, -9.74862247e-03,
+	5.39307374e-03, 3.43709837e-03, -1.16708935e-02, 1.36554958e-02,
+	-6.81627390e-03, -6.03074587e-03, 1.74834407e-02, -1.95290272e-02,
+	8.70428873e-03, 1.06576948e-02, -2.75309612e-02, 2.97992879e-02,
+	-1.17711475e-02, -2.05580288e-02, 4.99783883e-02, -5.49289555e-02,
+	1.98148838e-02, 5.66576783e-02, -1.61244217e-01, 2.88031489e-01,
+	7.40558904e-01, 1.70521142e-01, -1.50744074e-01, 8.15998950e-02,
+	-9.14435165e-03, -3.85993880e-02, 5.04172159e-02, -3.24116321e-02,
+	1.99554224e-03, 2.20948868e-02, -2.87403885e-02, 1.82172454e-02,
+	2.67580891e-04, -1.50862502e-02, 1.87842452e-02, -1.13230967e-02,
+	-1.19774199e-03, 1.09280961e-02, -1.28894662e-02, 7.26488284e-03,
+	1.54204976e-03, -8.05281194e-03, 8.96458360e-03, -4.66466088e-03,
+	-1.57602233e-03, 5.91399270e-03, -6.20370492e-03, 2.94259639e-03,
+	1.43910375e-03, -4.27566352e-03, 4.22168397e-03, -1.79859012e-03,
+	-1.21637873e-03, 3.01654326e-03, -2.80021008e-03, 1.05145723e-03,
+	9.64176435e-04, -2.06162913e-03, 1.79639110e-03, -5.79325031e-04,
+	-7.19647177e-04, 1.35522112e-03, -1.10596325e-03, 2.94946328e-04,
+	5.05327508e-04, -8.50149091e-04, 6.47749609e-04, -1.34477741e-04,
+	-3.32247660e-04, 5.04064196e-04, -3.57006732e-04, 5.16626659e-05,
+	2.02726113e-04, -2.78853849e-04, 1.82447347e-04, -1.41281714e-05,
+	-1.13091663e-04, 1.41233341e-04, -8.45758142e-05, 4.56494803e-07,
+	5.62280704e-05, -6.34905274e-05, 3.42800512e-05, 2.43419444e-06,
+	-2.37437981e-05, 2.38765209e-05, -1.12892909e-05, -1.67143561e-06,
+	7.60354347e-06, -6.46415848e-06, 2.45570575e-06, 4.94444322e-07,
+	-1.40148595e-06, 1.16634405e-06, 1.59961630e-06, -6.27020324e-06,
+	9.09160134e-06, -4.99870469e-06, -7.74969948e-06, 2.32697608e-05,
+	-2.87507939e-05, 1.24362085e-05, 2.46991043e-05, -6.25586089e-05,
+	6.94277747e-05, -2.35434760e-05, -6.35184667e-05, 1.40959046e-04,
+	-1.43029920e-04, 3.59360096e-05, 1.42003608e-04, -2.82157421e-04,
+	2.63750508e-04, -4.28640821e-05, -2.86668136e-04, 5.17378633e-04,
+	-4.46873138e-04, 3.08615259e-05, 5.34707392e-04, -8.85611440e-04,
+	7.07012346e-04, 2.29507576e-05, -9.35950216e-04, 1.43355895e-03,
+	-1.05599879e-03, -1.53900407e-04, 1.55514233e-03, -2.21587456e-03,
+	1.50076889e-03, 4.13420900e-04, -2.47556668e-03, 3.29689916e-03,
+	-2.04175547e-03, -8.74309515e-04, 3.80634733e-03, -4.75635128e-03,
+	2.67240790e-03, 1.64016729e-03, -5.69874945e-03, 6.70415531e-03,
+	-3.38068527e-03, -2.86555102e-03, 8.38426929e-03, -9.31674859e-03,
+	4.15399708e-03, 4.80447168e-03, -1.22693649e-02, 1.29293831e-02,
+	-4.99137545e-03, -7.94216150e-03, 1.82001809e-02, -1.83027453e-02,
+	5.93649615e-03, 1.34239871e-02, -2.83723027e-02, 2.76028273e-02,
+	-7.20044503e-03, -2.49742067e-02, 5.09023397e-02, -5.00996814e-02,
+	1.00011822e-02, 6.63254762e-02, -1.59985035e-01, 2.48241470e-01,
+	7.44320644e-01, 2.08968784e-01, -1.56429509e-01, 7.46637698e-02,
+	3.01825577e-04, -4.46248154e-02, 5.10444894e-02, -2.89427403e-02,
+	-2.58832242e-03, 2.50200553e-02, -2.87756539e-02, 1.59556172e-02,
+	3.10986099e-03, -1.68134129e-02, 1.86350052e-02, -9.71472587e-03,
+	-3.10888200e-03, 1.20150542e-02, -1.26770080e-02, 6.08658501e-03,
+	2.86367229e-03, -8.74819749e-03, 8.74206873e-03, -3.79808198e-03,
+	-2.49306275e-03, 6.35542988e-03, -5.99791511e-03, 2.31202246e-03,
+	2.06847832e-03, -4.54935037e-03, 4.04573717e-03, -1.34900171e-03,
+	-1.63940682e-03, 3.18012938e-03, -2.65892265e-03, 7.39764045e-04,
+	1.24042288e-03, -2.15467961e-03, 1.68927815e-03, -3.70662294e-04,
+	-8.93611329e-04, 1.40482218e-03, -1.02930329e-03, 1.61036587e-04,
+	6.10149271e-04, -8.74407180e-04, 5.96147282e-04, -5.27911549e-05,
+	-3.92127918e-04, 5.14585968e-04, -3.24576025e-04, 4.80853050e-06,
+	2.34777518e-04, -2.82644200e-04, 1.63647620e-04, 1.07611839e-05,
+	-1.28904407e-04, 1.42182260e-04, -7.47233496e-05, -1.15057409e-05,
+	6.32392269e-05, -6.35159835e-05, 2.97753996e-05, 7.42863596e-06,
+	-2.64165715e-05, 2.37604849e-05, -9.62112145e-06, -3.33302936e-06,
+	8.39930666e-06, -6.41959488e-06, 2.05419737e-06, 8.27455073e-07,
+};
+
+/* 44100 -> 228000, passband: 16750, stopband: 19000, 760 / 147 (interpolated) */
+static const float polyphase_44100_228000_16750[16512]
+__attribute__ ((aligned (16))) = {
+	-7.35673926e-07, 4.12126879e-06, -8.73857328e-06, 1.18894178e-05,
+	-9.59175593e-06, -1.47510012e-06, 2.12055089e-05, -4.38331086e-05,
+	5.79467594e-05, -4.99587895e-05, 1.07453294e-05, 5.68076708e-05,
+	-1.33174597e-04, 1.84369549e-04, -1.72788163e-04, 7.47100306e-05,
+	1.01831507e-04, -3.07738431e-04, 4.60047594e-04, -4.68262696e-04,
+	2.73970635e-04, 1.10545850e-04, -5.83260780e-04, 9.68238562e-04,
+	-1.07018448e-03, 7.54838157e-04, -2.67057630e-05, -9.31398926e-04,
+	1.78540656e-03, -2.15024414e-03, 1.73943722e-03, -5.12470303e-04,
+	-1.24380808e-03, 2.95090744e-03, -3.90518467e-03, 3.53666618e-03,
+	-1.67413312e-03, -1.29165913e-03, 4.43653732e-03, -6.55388009e-03,
+	6.57448363e-03, -4.02233795e-03, -6.68231111e-04, 6.12833171e-03,
+	-1.03920681e-02, 1.15363563e-02, -8.43485410e-03, 1.35899569e-03,
+	7.83150698e-03, -1.60582091e-02, 1.99216323e-02, -1.68971495e-02,
+	6.45475108e-03, 9.30260062e-03, -2.57794162e-02, 3.68791156e-02,
+	-3.66418575e-02, 2.10861250e-02, 1.03028365e-02, -5.39358947e-02,
+	1.02606968e-01, -1.47047918e-01, 1.78164655e-01, 8.10657596e-01,
+	1.78164655e-01, -1.47047918e-01, 1.02606968e-01, -5.39358947e-02,
+	1.03028365e-02, 2.10861250e-02, -3.66418575e-02, 3.68791156e-02,
+	-2.57794162e-02, 9.30260062e-03, 6.45475108e-03, -1.68971495e-02,
+	1.99216323e-02, -1.60582091e-02, 7.83150698e-03, 1.35899569e-03,
+	-8.43485410e-03, 1.15363563e-02, -1.03920681e-02, 6.12833171e-03,
+	-6.68231111e-04, -4.02233795e-03, 6.57448363e-03, -6.55388009e-03,
+	4.43653732e-03, -1.29165913e-03, -1.67413312e-03, 3.53666618e-03,
+	-3.90518467e-03, 2.95090744e-03, -1.24380808e-03, -5.12470303e-04,
+	1.73943722e-03, -2.15024414e-03, 1.78540656e-03, -9.31398926e-04,
+	-2.67057630e-05, 7.54838157e-04, -1.07018448e-03, 9.68238562e-04,
+	-5.83260780e-04, 1.10545850e-04, 2.73970635e-04, -4.68262696e-04,
+	4.60047594e-04, -3.07738431e-04, 1.01831507e-04, 7.47100306e-05,
+	-1.72788163e-04, 1.84369549e-04, -1.33174597e-04, 5.68076708e-05,
+	1.07453294e-05, -4.99587895e-05, 5.79467594e-05, -4.38331086e-05,
+	2.12055089e-05, -1.47510012e-06, -9.59175593e-06, 1.18894178e-05,
+	-8.73857328e-06, 4.12126879e-06, -7.35673926e-07, -6.03358912e-07,
+	-7.95956187e-07, 4.18117639e-06, -8.73565243e-06, 1.17419757e-05,
+	-9.24545952e-06, -1.98437142e-06, 2.17050596e-05, -4.40241646e-05,
+	5.75006250e-05, -4.86894282e-05, 8.79920263e-06, 5.88434938e-05,
+	-1.34347095e-04, 1.83665092e-04, -1.69614269e-04, 6.93832175e-05,
+	1.07836289e-04, -3.11999015e-04, 4.59945912e-04, -4.62120885e-04,
+	2.62174414e-04, 1.24967888e-04, -5.95058620e-04, 9.71505546e-04,
+	-1.06072837e-03, 7.32549870e-04, 3.12653344e-06, -9.58722323e-04,
+	1.79827001e-03, -2.13928858e-03, 1.70252778e-03, -4.57535769e-04,
+	-1.29939683e-03, 2.98504040e-03, -3.89885117e-03, 3.48244338e-03,
+	-1.58198386e-03, -1.39428024e-03, 4.51161607e-03, -6.56559210e-03,
+	6.50392128e-03, -3.87875923e-03, -8.44847534e-04, 6.27627650e-03,
+	-1.04473282e-02, 1.14570729e-02, -8.22238058e-03, 1.06676776e-03,
+	8.10716164e-03, -1.62055438e-02, 1.98527241e-02, -1.65868753e-02,
+	5.96532130e-03, 9.82323039e-03, -2.61300798e-02, 3.68643957e-02,
+	-3.61441427e-02, 2.01325518e-02, 1.14947334e-02, -5.49378390e-02,
+	1.02756461e-01, -1.45273700e-01, 1.71547013e-01, 8.10604054e-01,
+	1.84815595e-01, -1.48777677e-01, 1.02415907e-01, -5.29084643e-02,
+	9.10290094e-03, 2.20340262e-02, -3.71262731e-02, 3.68792365e-02,
+	-2.54177995e-02, 8.77727412e-03, 6.94251516e-03, -1.72012630e-02,
+	1.99827539e-02, -1.59042628e-02, 7.55230338e-03, 1.65114579e-03,
+	-8.64431302e-03, 1.16111858e-02, -1.03325995e-02, 5.97772648e-03,
+	-4.91075380e-04, -4.16454473e-03, 6.64254803e-03, -6.53954837e-03,
+	4.35957674e-03, -1.18835771e-03, -1.76577062e-03, 3.58957631e-03,
+	-3.90997845e-03, 2.91554292e-03, -1.18762609e-03, -5.67301486e-04,
+	1.77572448e-03, -2.16036627e-03, 1.77180847e-03, -9.03650606e-04,
+	-5.65887512e-05, 7.76873343e-04, -1.07923549e-03, 9.64579138e-04,
+	-5.71203784e-04, 9.60457061e-05, 2.85686554e-04, -4.74233484e-04,
+	4.59966254e-04, -3.03343716e-04, 9.57693615e-05, 8.00224656e-05,
+	-1.75902637e-04, 1.85002571e-04, -1.31945027e-04, 5.47421526e-05,
+	1.26941404e-05, -5.12129168e-05, 5.83714086e-05, -4.36236119e-05,
+	2.06951473e-05, -9.62749206e-07, -9.93599628e-06, 1.20328714e-05,
+	-8.73791971e-06, 4.05918720e-06, -6.74515872e-07, -6.38150164e-07,
+	-8.55344039e-07, 4.23890083e-06, -8.72918142e-06, 1.15906285e-05,
+	-8.89725884e-06, -2.49037169e-06, 2.21936463e-05, -4.41967805e-05,
+	5.70332698e-05, -4.74053991e-05, 6.85652957e-06, 6.08489086e-05,
+	-1.35462241e-04, 1.82889702e-04, -1.66382400e-04, 6.40441911e-05,
+	1.13781473e-04, -3.16124133e-04, 4.59661725e-04, -4.55810924e-04,
+	2.50302778e-04, 1.39306269e-04, -6.06593207e-04, 9.74379663e-04,
+	-1.05087179e-03, 7.10017867e-04, 3.28963948e-05, -9.85610796e-04,
+	1.81039515e-03, -2.12750553e-03, 1.66501196e-03, -4.02519869e-04,
+	-1.35437132e-03, 3.01793042e-03, -3.89098311e-03, 3.42693161e-03,
+	-1.48936022e-03, -1.49618146e-03, 4.58478626e-03, -6.57468390e-03,
+	6.43089286e-03, -3.73386762e-03, -1.02085550e-03, 6.42150635e-03,
+	-1.04983643e-02, 1.13733738e-02, -8.00698133e-03, 7.74577824e-04,
+	8.37916395e-03, -1.63462192e-02, 1.97760698e-02, -1.62705740e-02,
+	5.47442233e-03, 1.03389668e-02, -2.64696746e-02, 3.68351154e-02,
+	-3.56333574e-02, 1.91736971e-02, 1.26781521e-02, -5.59140113e-02,
+	1.02864549e-01, -1.43456019e-01, 1.64963963e-01, 8.10443438e-01,
+	1.91498527e-01, -1.50461991e-01, 1.02183131e-01, -5.18558446e-02,
+	7.89537093e-03, 2.29758662e-02, -3.75971649e-02, 3.68647255e-02,
+	-2.50453501e-02, 8.24744972e-03, 7.42841736e-03, -1.74990847e-02,
+	2.00360515e-02, -1.57437548e-02, 7.26965587e-03, 1.94310207e-03,
+	-8.85066958e-03, 1.16815247e-02, -1.02689394e-02, 5.82451646e-03,
+	-3.13449810e-04, -4.30532099e-03, 6.70808351e-03, -6.52259846e-03,
+	4.28076188e-03, -1.08441589e-03, -1.85685909e-03, 3.64115053e-03,
+	-3.91322797e-03, 2.87895874e-03, -1.13087210e-03, -6.22007334e-04,
+	1.81137398e-03, -2.16964936e-03, 1.75747973e-03, -8.75487550e-04,
+	-8.65106436e-05, 7.98646122e-04, -1.08787691e-03, 9.60527857e-04,
+	-5.58891842e-04, 8.14730499e-05, 2.97317305e-04, -4.80030437e-04,
+	4.59701450e-04, -2.98816265e-04, 8.96521139e-05, 8.53183569e-05,
+	-1.78956269e-04, 1.85563679e-04, -1.30658693e-04, 5.26476669e-05,
+	1.46448619e-05, -5.24512479e-05, 5.87743158e-05, -4.33956811e-05,
+	2.01741331e-05, -4.47512327e-07, -1.02780288e-05, 1.21722543e-05,
+	-8.73366878e-06, 3.99494179e-06, -6.12501200e-07, -6.73089045e-07,
+	-9.13819424e-07, 4.29443393e-06, -8.71918590e-06, 1.14354610e-05,
+	-8.54730564e-06, -2.99291171e-06, 2.26711211e-05, -4.43509644e-05,
+	5.65449657e-05, -4.61072722e-05, 4.91807579e-06, 6.28232169e-05,
+	-1.36519774e-04, 1.82043912e-04, -1.63094020e-04, 5.86951152e-05,
+	1.19664858e-04, -3.20112504e-04, 4.59195618e-04, -4.49335744e-04,
+	2.38360633e-04, 1.53555489e-04, -6.17860559e-04, 9.76860646e-04,
+	-1.04061951e-03, 6.87251610e-04, 6.25921267e-05, -1.01205454e-03,
+	1.82177861e-03, -2.11490123e-03, 1.62690579e-03, -3.47444582e-04,
+	-1.40871084e-03, 3.04956662e-03, -3.88158623e-03, 3.37015507e-03,
+	-1.39629971e-03, -1.59732357e-03, 4.65602195e-03, -6.58115607e-03,
+	6.35543120e-03, -3.58772258e-03, -1.19618622e-03, 6.56396791e-03,
+	-1.05451628e-02, 1.12852990e-02, -7.78874618e-03, 4.82541497e-04,
+	8.64741208e-03, -1.64801907e-02, 1.96917126e-02, -1.59483812e-02,
+	4.98225086e-03, 1.08496156e-02, -2.67980894e-02, 3.67913189e-02,
+	-3.51097352e-02, 1.82099522e-02, 1.38526577e-02, -5.68641365e-02,
+	1.02931411e-01, -1.41595879e-01, 1.58416784e-01, 8.10175789e-01,
+	1.98212133e-01, -1.52099878e-01, 1.01908504e-01, -5.07783433e-02,
+	6.68069498e-03, 2.39112570e-02, -3.80543136e-02, 3.68355554e-02,
+	-2.46621930e-02, 7.71332840e-03, 7.91226185e-03, -1.77904856e-02,
+	2.00814910e-02, -1.55767382e-02, 6.98367096e-03, 2.23474847e-03,
+	-9.05383709e-03, 1.17473382e-02, -1.02011066e-02, 5.66875840e-03,
+	-1.35424162e-04, -4.44460862e-03, 6.77106010e-03, -6.50303292e-03,
+	4.20012103e-03, -9.79873912e-04, -1.94736147e-03, 3.69136611e-03,
+	-3.91492929e-03, 2.84116730e-03, -1.07356767e-03, -6.76565872e-04,
+	1.84637034e-03, -2.17808811e-03, 1.74242460e-03, -8.46920133e-04,
+	-1.16459613e-04, 8.20147275e-04, -1.09610442e-03, 9.56085458e-04,
+	-5.46329273e-04, 6.68335183e-05, 3.08858042e-04, -4.85650804e-04,
+	4.59252810e-04, -2.94157528e-04, 8.34820549e-05, 9.05955395e-05,
+	-1.81947652e-04, 1.86052424e-04, -1.29315925e-04, 5.05249551e-05,
+	1.65967171e-05, -5.36732248e-05, 5.91552320e-05, -4.31493306e-05,
+	1.96426293e-05, 7.04147783e-08, -1.06177020e-05, 1.23074853e-05,
+	-8.72579893e-06, 3.92854374e-06, -5.49649636e-07, -7.08160320e-07,
+	-9.71364854e-07, 4.34776855e-06, -8.70569279e-06, 1.12765586e-05,
+	-8.19575164e-06, -3.49180463e-06, 2.31373412e-05, -4.44867321e-05,
+	5.60359920e-05, -4.47956209e-05, 2.98460239e-06, 6.47657349e-05,
+	-1.37519461e-04, 1.81128278e-04, -1.59750609e-04, 5.33381510e-05,
+	1.25484270e-04, -3.23962907e-04, 4.58548249e-04, -4.42698339e-04,
+	2.26352901e-04, 1.67710092e-04, -6.28856809e-04, 9.78948383e-04,
+	-1.02997648e-03, 6.64260637e-04, 9.22020882e-05, -1.03804394e-03,
+	1.83241732e-03, -2.10148225e-03, 1.58822548e-03, -2.92331868e-04,
+	-1.46239497e-03, 3.07993863e-03, -3.87066689e-03, 3.31213839e-03,
+	-1.30283995e-03, -1.69766771e-03, 4.72529802e-03, -6.58501019e-03,
+	6.27757004e-03, -3.44038398e-03, -1.37077126e-03, 6.70360901e-03,
+	-1.05877117e-02, 1.11928902e-02, -7.56776598e-03, 1.90774165e-04,
+	8.91180587e-03, -1.66074160e-02, 1.95996989e-02, -1.56204344e-02,
+	4.48900378e-03, 1.13549848e-02, -2.71152175e-02, 3.67330558e-02,
+	-3.45735141e-02, 1.72417093e-02, 1.50178203e-02, -5.77879506e-02,
+	1.02957237e-01, -1.39694289e-01, 1.51906744e-01, 8.09801168e-01,
+	2.04955082e-01, -1.53690367e-01, 1.01591909e-01, -4.96762788e-02,
+	5.45932584e-03, 2.48398119e-02, -3.84975043e-02, 3.67917048e-02,
+	-2.42684574e-02, 7.17511326e-03, 8.39385327e-03, -1.80753389e-02,
+	2.01190409e-02, -1.54032684e-02, 6.69445670e-03, 2.52596885e-03,
+	-9.25373000e-03, 1.18085932e-02, -1.01291215e-02, 5.51051018e-03,
+	4.29315341e-05, -4.58235002e-03, 6.83144875e-03, -6.48085537e-03,
+	4.11768329e-03, -8.74772308e-04, -2.03724082e-03, 3.74020081e-03,
+	-3.91507907e-03, 2.80218152e-03, -1.01573457e-03, -7.30955144e-04,
+	1.88069845e-03, -2.18567756e-03, 1.72664765e-03, -8.17958912e-04,
+	-1.46423797e-04, 8.41367672e-04, -1.10391384e-03, 9.51252842e-04,
+	-5.33520509e-04, 5.21327882e-05, 3.20303945e-04, -4.91091901e-04,
+	4.58620036e-04, -2.89369013e-04, 7.72615023e-05, 9.58518495e-05,
+	-1.84875403e-04, 1.86468385e-04, -1.27917078e-04, 4.83747727e-05,
+	1.85489257e-05, -5.48782943e-05, 5.95139161e-05, -4.28845822e-05,
+	1.91008042e-05, 5.90834321e-07, -1.09548644e-05, 1.24384847e-05,
+	-8.71429002e-06, 3.86000528e-06, -4.85981456e-07, -7.43348528e-07,
+	-1.02796340e-06, 4.39889851e-06, -8.68873034e-06, 1.11140083e-05,
+	-7.84274841e-06, -3.98686595e-06, 2.35921691e-05, -4.46041065e-05,
+	5.55066355e-05, -4.34710221e-05, 1.05686575e-06, 6.66757941e-05,
+	-1.38461090e-04, 1.80143384e-04, -1.56353667e-04, 4.79754570e-05,
+	1.31237569e-04, -3.27674181e-04, 4.57720346e-04, -4.35901755e-04,
+	2.14284516e-04, 1.81764674e-04, -6.39578207e-04, 9.80642919e-04,
+	-1.01894776e-03, 6.41054553e-04, 1.21714696e-04, -1.06356959e-03,
+	1.84230851e-03, -2.08725548e-03, 1.54898745e-03, -2.37203665e-04,
+	-1.51540358e-03, 3.10903663e-03, -3.85823202e-03, 3.25290668e-03,
+	-1.20901867e-03, -1.79717538e-03, 4.79259015e-03, -6.58624890e-03,
+	6.19734399e-03, -3.29191206e-03, -1.54454260e-03, 6.84037869e-03,
+	-1.06260006e-02, 1.10961907e-02, -7.34413251e-03, -1.00609079e-04,
+	9.17224681e-03, -1.67278561e-02, 1.95000780e-02, -1.52868735e-02,
+	3.99487799e-03, 1.18548850e-02, -2.74209572e-02, 3.66603817e-02,
+	-3.40249362e-02, 1.62693613e-02, 1.61732147e-02, -5.86852007e-02,
+	1.02942234e-01, -1.37752265e-01, 1.45435096e-01, 8.09319666e-01,
+	2.11726031e-01, -1.55232493e-01, 1.01233240e-01, -4.85499800e-02,
+	4.23172040e-03, 2.57611461e-02, -3.89265274e-02, 3.67331578e-02,
+	-2.38642771e-02, 6.63300938e-03, 8.87299681e-03, -1.83535205e-02,
+	2.01486732e-02, -1.52234037e-02, 6.40212256e-03, 2.81664704e-03,
+	-9.45026389e-03, 1.18652583e-02, -1.00530064e-02, 5.34983074e-03,
+	2.21547010e-04, -4.71848810e-03, 6.88922143e-03, -6.45607045e-03,
+	4.03347848e-03, -7.69151903e-04, -2.12646042e-03, 3.78763290e-03,
+	-3.91367459e-03, 2.76201479e-03, -9.57394866e-04, -7.85153221e-04,
+	1.91434341e-03, -2.19241307e-03, 1.71015376e-03, -7.88614621e-04,
+	-1.76391303e-04, 8.62298273e-04, -1.11130116e-03, 9.46031062e-04,
+	-5.20470089e-04, 3.73765742e-05, 3.31650220e-04, -4.96351107e-04,
+	4.57802902e-04, -2.84452282e-04, 7.09928008e-05, 1.01085125e-04,
+	-1.87738160e-04, 1.86811166e-04, -1.26462528e-04, 4.61978889e-05,
+	2.05007045e-05, -5.60659076e-05, 5.98501351e-05, -4.26014652e-05,
+	1.85488311e-05, 1.11354654e-06, -1.12893648e-05, 1.25651740e-05,
+	-8.69912328e-06, 3.78933961e-06, -4.21517479e-07, -7.78637989e-07,
+	-1.08359873e-06, 4.44781865e-06, -8.66832807e-06, 1.09478979e-05,
+	-7.48844731e-06, -4.47791363e-06, 2.40354724e-05, -4.47031179e-05,
+	5.49571896e-05, -4.21340556e-05, -8.64382738e-07, 6.85527413e-05,
+	-1.39344474e-04, 1.79089841e-04, -1.52904709e-04, 4.26091876e-05,
+	1.36922648e-04, -3.31245220e-04, 4.56712709e-04, -4.28949098e-04,
+	2.02160427e-04, 1.95713883e-04, -6.50021120e-04, 9.81944456e-04,
+	-1.00753857e-03, 6.17643027e-04, 1.51118430e-04, -1.08862228e-03,
+	1.85144970e-03, -2.07222810e-03, 1.50920832e-03, -1.82081874e-04,
+	-1.56771683e-03, 3.13685129e-03, -3.84428915e-03, 3.19248548e-03,
+	-1.11487367e-03, -1.89580850e-03, 4.85787485e-03, -6.58487586e-03,
+	6.11478858e-03, -3.14236744e-03, -1.71743265e-03, 6.97422719e-03,
+	-1.06600210e-02, 1.09952455e-02, -7.11793848e-03, -3.91493474e-04,
+	9.42863814e-03, -1.68414742e-02, 1.93929021e-02, -1.49478402e-02,
+	3.50007042e-03, 1.23491293e-02, -2.77152111e-02, 3.65733574e-02,
+	-3.34642483e-02, 1.52933015e-02, 1.73184213e-02, -5.95556448e-02,
+	1.02886621e-01, -1.35770830e-01, 1.39003077e-01, 8.08731397e-01,
+	2.18523628e-01, -1.56725302e-01, 1.00832408e-01, -4.73997867e-02,
+	2.99833941e-03, 2.66748762e-02, -3.93411781e-02, 3.66599044e-02,
+	-2.34497904e-02, 6.08722377e-03, 9.34949825e-03, -1.86249084e-02,
+	2.01703626e-02, -1.50372047e-02, 6.10677943e-03, 3.10666693e-03,
+	-9.64335560e-03, 1.19173039e-02, -9.97278499e-03, 5.18678007e-03,
+	4.00351785e-04, -4.85296633e-03, 6.94435109e-03, -6.42868386e-03,
+	3.94753721e-03, -6.63053796e-04, -2.21498374e-03, 3.83364118e-03,
+	-3.91071375e-03, 2.72068101e-03, -8.98570826e-04, -8.39138211e-04,
+	1.94729057e-03, -2.19829034e-03, 1.69294807e-03, -7.58898167e-04,
+	-2.06350212e-04, 8.82930138e-04, -1.11826253e-03, 9.40421334e-04,
+	-5.07182657e-04, 2.25706263e-05, 3.42892099e-04, -5.01425866e-04,
+	4.56801255e-04, -2.79408955e-04, 6.46783209e-05, 1.06293208e-04,
+	-1.90534582e-04, 1.87080403e-04, -1.24952678e-04, 4.39950861e-05,
+	2.24512677e-05, -5.72355212e-05, 6.01636641e-05, -4.23000167e-05,
+	1.79868880e-05, 1.63834977e-06, -1.16210524e-05, 1.26874761e-05,
+	-8.68028140e-06, 3.71656098e-06, -3.56279060e-07, -8.14012806e-07,
+	-1.13825504e-06, 4.49452480e-06, -8.64451676e-06, 1.07783159e-05,
+	-7.13299946e-06, -4.96476815e-06, 2.44671242e-05, -4.47838040e-05,
+	5.43879549e-05, -4.07853042e-05, -2.77839698e-06, 7.03959388e-05,
+	-1.40169450e-04, 1.77968282e-04, -1.49405267e-04, 3.72414923e-05,
+	1.42537430e-04, -3.34674979e-04, 4.55526203e-04, -4.21843526e-04,
+	1.89985592e-04, 2.09552420e-04, -6.60182036e-04, 9.82853352e-04,
+	-9.95754262e-04, 5.94035794e-04, 1.80401836e-04, -1.11319301e-03,
+	1.85983873e-03, -2.05640759e-03, 1.46890487e-03, -1.26988355e-04,
+	-1.61931522e-03, 3.16337382e-03, -3.82884640e-03, 3.13090073e-03,
+	-1.02044281e-03, -1.99352938e-03, 4.92112947e-03, -6.58089577e-03,
+	6.02994018e-03, -2.99181105e-03, -1.88937427e-03, 7.10510600e-03,
+	-1.06897659e-02, 1.08901010e-02, -6.88927743e-03, -6.81764639e-04,
+	9.68088487e-03, -1.69482365e-02, 1.92782262e-02, -1.46034779e-02,
+	3.00477788e-03, 1.28375332e-02, -2.79978867e-02, 3.64720492e-02,
+	-3.28917008e-02, 1.43139236e-02, 1.84530253e-02, -6.03990524e-02,
+	1.02790633e-01, -1.33751012e-01, 1.32611914e-01, 8.08036502e-01,
+	2.25346506e-01, -1.58167849e-01, 1.00389340e-01, -4.62260489e-02,
+	1.75964741e-03, 2.75806208e-02, -3.97412569e-02, 3.65719403e-02,
+	-2.30251397e-02, 5.53796532e-03, 9.82316405e-03, -1.88893833e-02,
+	2.01840873e-02, -1.48447350e-02, 5.80853959e-03, 3.39591248e-03,
+	-9.83292315e-03, 1.19647021e-02, -9.88848278e-03, 5.02141920e-03,
+	5.79275193e-04, -4.98572873e-03, 6.99681168e-03, -6.39870233e-03,
+	3.85989080e-03, -5.56519342e-04, -2.30277446e-03, 3.87820497e-03,
+	-3.90619506e-03, 2.67819457e-03, -8.39284968e-04, -8.92888267e-04,
+	1.97952552e-03, -2.20330539e-03, 1.67503605e-03, -7.28820629e-04,
+	-2.36288586e-04, 9.03254424e-04, -1.12479424e-03, 9.34425027e-04,
+	-4.93662966e-04, 7.72072808e-06, 3.54024847e-04, -5.06313690e-04,
+	4.55615016e-04, -2.74240705e-04, 5.83204579e-05, 1.11473943e-04,
+	-1.93263351e-04, 1.87275757e-04, -1.23387952e-04, 4.17671599e-05,
+	2.43998272e-05, -5.83865966e-05, 6.04542866e-05, -4.19802812e-05,
+	1.74151579e-05, 2.16504054e-06, -1.19497766e-05, 1.28053152e-05,
+	-8.65774850e-06, 3.64168463e-06, -2.90288090e-07, -8.49456874e-07,
+	-1.19191715e-06, 4.53901376e-06, -8.61732843e-06, 1.06053523e-05,
+	-6.77655568e-06, -5.44725256e-06, 2.48870026e-05, -4.48462096e-05,
+	5.37992389e-05, -3.94253531e-05, -4.68443644e-06, 7.22047645e-05,
+	-1.40935880e-04, 1.76779368e-04, -1.45856889e-04, 3.18745151e-05,
+	1.48079875e-04, -3.37962473e-04, 4.54161768e-04, -4.14588251e-04,
+	1.77764977e-04, 2.23275044e-04, -6.70057562e-04, 9.83370119e-04,
+	-9.83600337e-04, 5.70242641e-04, 2.09553532e-04, -1.13727299e-03,
+	1.86747375e-03, -2.03980176e-03, 1.42809409e-03, -7.19449183e-05,
+	-1.67017956e-03, 3.18859596e-03, -3.81191247e-03, 3.06817884e-03,
+	-9.25764010e-04, -2.09030078e-03, 4.98233220e-03, -6.57431434e-03,
+	5.94283604e-03, -2.84030413e-03, -2.06030079e-03, 7.23296785e-03,
+	-1.07152303e-02, 1.07808054e-02, -6.65824377e-03, -9.71308612e-04,
+	9.92889375e-03, -1.70481121e-02, 1.91561083e-02, -1.42539323e-02,
+	2.50919705e-03, 1.33199150e-02, -2.82688963e-02, 3.63565290e-02,
+	-3.23075486e-02, 1.33316214e-02, 1.95766178e-02, -6.12152039e-02,
+	1.02654516e-01, -1.31693845e-01, 1.26262815e-01, 8.07235145e-01,
+	2.32193290e-01, -1.59559198e-01, 9.99039758e-02, -4.50291271e-02,
+	5.16112542e-04, 2.84780007e-02, -4.01265693e-02, 3.64692671e-02,
+	-2.25904720e-02, 4.98544467e-03, 1.02938015e-02, -1.91468281e-02,
+	2.01898282e-02, -1.46460605e-02, 5.50751661e-03, 3.68426775e-03,
+	-1.00188859e-02, 1.20074271e-02, -9.80012691e-03, 4.85381018e-03,
+	7.58246414e-04, -5.11671994e-03, 7.04657818e-03, -6.36613364e-03,
+	3.77057131e-03, -4.49590136e-04, -2.38979651e-03, 3.92130414e-03,
+	-3.90011763e-03, 2.63457033e-03, -7.79560032e-04, -9.46381593e-04,
+	2.01103414e-03, -2.20745459e-03, 1.65642344e-03, -6.98393251e-04,
+	-2.66194468e-04, 9.23262394e-04, -1.13089278e-03, 9.28043670e-04,
+	-4.79915869e-04, -7.16730560e-06, 3.65043759e-04, -5.11012162e-04,
+	4.54244179e-04, -2.68949259e-04, 5.19216312e-05, 1.16625179e-04,
+	-1.95923172e-04, 1.87396919e-04, -1.21768798e-04, 3.95149186e-05,
+	2.63455930e-05, -5.95186008e-05, 6.07217944e-05, -4.16423109e-05,
+	1.68338285e-05, 2.69341359e-06, -1.22753875e-05, 1.29186171e-05,
+	-8.63151016e-06, 3.56472685e-06, -2.23566983e-07, -8.84953886e-07,
+	-1.24457044e-06, 4.58128332e-06, -8.58679630e-06, 1.04290974e-05,
+	-6.41926639e-06, -5.92519254e-06, 2.52949913e-05, -4.48903869e-05,
+	5.31913556e-05, -3.80547897e-05, -6.58176645e-06, 7.39786124e-05,
+	-1.41643648e-04, 1.75523786e-04, -1.42261136e-04, 2.65103935e-05,
+	1.53547976e-04, -3.41106774e-04, 4.52620407e-04, -4.07186535e-04,
+	1.65503554e-04, 2.36876573e-04, -6.79644426e-04, 9.83495425e-04,
+	-9.71082421e-04, 5.46273412e-04, 2.38562211e-04, -1.16085364e-03,
+	1.87435318e-03, -2.02241868e-03, 1.38679310e-03, -1.69733128e-05,
+	-1.72029096e-03, 3.21250998e-03, -3.79349663e-03, 3.00434658e-03,
+	-8.30875230e-04, -2.18608588e-03, 5.04146209e-03, -6.56513832e-03,
+	5.85351423e-03, -2.68790820e-03, -2.23014607e-03, 7.35776673e-03,
+	-1.07364105e-02, 1.06674085e-02, -6.42493267e-03, -1.26001190e-03,
+	1.01725734e-02, -1.71410725e-02, 1.90266094e-02, -1.38993506e-02,
+	2.01352433e-03, 1.37960959e-02, -2.85281568e-02, 3.62268741e-02,
+	-3.17120502e-02, 1.23467890e-02, 2.06887951e-02, -6.20038911e-02,
+	1.02478532e-01, -1.29600367e-01, 1.19956976e-01, 8.06327517e-01,
+	2.39062594e-01, -1.60898423e-01, 9.93762723e-02, -4.38093920e-02,
+	-7.31793660e-04, 2.93666386e-02, -4.04969262e-02, 3.63518921e-02,
+	-2.21459382e-02, 4.42987416e-03, 1.07612186e-02, -1.93971288e-02,
+	2.01875698e-02, -1.44412498e-02, 5.20382538e-03, 3.97161701e-03,
+	-1.02011643e-02, 1.20454545e-02, -9.70774616e-03, 4.68401603e-03,
+	9.37194496e-04, -5.24588521e-03, 7.09362659e-03, -6.33098662e-03,
+	3.67961151e-03, -3.42307998e-04, -2.47601404e-03, 3.96291909e-03,
+	-3.89248121e-03, 2.58982364e-03, -7.19418970e-04, -9.99596460e-04,
+	2.04180253e-03, -2.21073463e-03, 1.63711629e-03, -6.67627438e-04,
+	-2.96055891e-04, 9.42945418e-04, -1.13655477e-03, 9.21278948e-04,
+	-4.65946322e-04, -2.20876311e-05, 3.75944166e-04, -5.15518931e-04,
+	4.52688813e-04, -2.63536401e-04, 4.54842832e-05, 1.21744774e-04,
+	-1.98512776e-04, 1.87443610e-04, -1.20095689e-04, 3.72391832e-05,
+	2.82877732e-05, -6.06310067e-05, 6.09659879e-05, -4.12861656e-05,
+	1.62430924e-05, 3.22326203e-06, -1.25977355e-05, 1.30273088e-05,
+	-8.60155343e-06, 3.48570492e-06, -1.56138677e-07, -9.20487336e-07,
+	-1.29620087e-06, 4.62133223e-06, -8.55295481e-06, 1.02496428e-05,
+	-6.06128156e-06, -6.39841648e-06, 2.56909791e-05, -4.49163950e-05,
+	5.25646254e-05, -3.66742038e-05, -8.46965843e-06, 7.57168923e-05,
+	-1.42292663e-04, 1.74202243e-04, -1.38619587e-04, 2.11512578e-05,
+	1.58939760e-04, -3.44107017e-04, 4.50903194e-04, -3.99641693e-04,
+	1.53206300e-04, 2.50351884e-04, -6.88939479e-04, 9.83230094e-04,
+	-9.58206277e-04, 5.22137999e-04, 2.67416647e-04, -1.18392659e-03,
+	1.88047579e-03, -2.00426674e-03, 1.34501921e-03, 3.79047801e-05,
+	-1.76963089e-03, 3.23510869e-03, -3.77360873e-03, 2.93943115e-03,
+	-7.35814441e-04, -2.28084830e-03, 5.09849901e-03, -6.55337546e-03,
+	5.76201363e-03, -2.53468505e-03, -2.39884447e-03, 7.47945795e-03,
+	-1.07533049e-02, 1.05499615e-02, -6.18944008e-03, -1.54776153e-03,
+	1.04118343e-02, -1.72270925e-02, 1.88897929e-02, -1.35398816e-02,
+	1.51795583e-03, 1.42658995e-02, -2.87755902e-02, 3.60831671e-02,
+	-3.11054680e-02, 1.13598201e-02, 2.17891595e-02, -6.27649171e-02,
+	1.02262956e-01, -1.27471622e-01, 1.13695577e-01, 8.05313835e-01,
+	2.45953022e-01, -1.62184606e-01, 9.88062011e-02, -4.25672247e-02,
+	-1.98359639e-03, 3.02461598e-02, -4.08521442e-02, 3.62198283e-02,
+	-2.16916938e-02, 3.87146775e-03, 1.12252244e-02, -1.96401735e-02,
+	2.01772992e-02, -1.42303740e-02, 4.89758201e-03, 4.25784471e-03,
+	-1.03796806e-02, 1.20787621e-02, -9.61137096e-03, 4.51210075e-03,
+	1.11604839e-03, -5.37317041e-03, 7.13793396e-03, -6.29327111e-03,
+	3.58704489e-03, -2.34714956e-04, -2.56139149e-03, 4.00303081e-03,
+	-3.88328616e-03, 2.54397033e-03, -6.58884945e-04, -1.05251121e-03,
+	2.07181709e-03, -2.21314257e-03, 1.61712090e-03, -6.36534754e-04,
+	-3.25860882e-04, 9.62294978e-04, -1.14177702e-03, 9.14132702e-04,
+	-4.51759383e-04, -3.70343782e-05, 3.86721432e-04, -5.19831717e-04,
+	4.50949058e-04, -2.58003966e-04, 3.90108787e-05, 1.26830587e-04,
+	-2.01030914e-04, 1.87415578e-04, -1.18369118e-04, 3.49407868e-05,
+	3.02255746e-05, -6.17232929e-05, 6.11866762e-05, -4.09119127e-05,
+	1.56431469e-05, 3.75437734e-06, -1.29166716e-05, 1.31313191e-05,
+	-8.56786685e-06, 3.40463715e-06, -8.80266217e-08, -9.56040532e-07,
+	-1.34679498e-06, 4.65916022e-06, -8.51583956e-06, 1.00670807e-05,
+	-5.70275069e-06, -6.86675549e-06, 2.60748604e-05, -4.49243003e-05,
+	5.19193753e-05, -3.52841867e-05, -1.03473902e-05, 7.74190307e-05,
+	-1.42882856e-04, 1.72815476e-04, -1.34933831e-04, 1.57992299e-05,
+	1.64253294e-04, -3.46962392e-04, 4.49011271e-04, -3.91957086e-04,
+	1.40878194e-04, 2.63695917e-04, -6.97939696e-04, 9.82575099e-04,
+	-9.44977795e-04, 4.97846339e-04, 2.96105697e-04, -1.20648370e-03,
+	1.88584060e-03, -1.98535461e-03, 1.30278988e-03, 9.26677556e-05,
+	-1.81818116e-03, 3.25638540e-03, -3.75225918e-03, 2.87346011e-03,
+	-6.40619623e-04, -2.37455214e-03, 5.15342373e-03, -6.53903455e-03,
+	5.66837393e-03, -2.38069668e-03, -2.56633093e-03, 7.59799808e-03,
+	-1.07659134e-02, 1.04285172e-02, -5.95186265e-03, -1.83444506e-03,
+	1.06465888e-02, -1.73061492e-02, 1.87457253e-02, -1.31756762e-02,
+	1.02268723e-03, 1.47291526e-02, -2.90111230e-02, 3.59254961e-02,
+	-3.04880682e-02, 1.03711084e-02, 2.28773190e-02, -6.34980962e-02,
+	1.02008074e-01, -1.25308658e-01, 1.07479781e-01, 8.04194339e-01,
+	2.52863168e-01, -1.63416844e-01, 9.81937492e-02, -4.13030162e-02,
+	-3.23881776e-03, 3.11161920e-02, -4.11920448e-02, 3.60730948e-02,
+	-2.12278981e-02, 3.31044094e-03, 1.16856289e-02, -1.98758533e-02,
+	2.01590071e-02, -1.40135068e-02, 4.58890382e-03, 4.54283559e-03,
+	-1.05543578e-02, 1.21073292e-02, -9.51103338e-03, 4.33812928e-03,
+	1.29473697e-03, -5.49852209e-03, 7.17947840e-03, -6.25299802e-03,
+	3.49290561e-03, -1.26853233e-04, -2.64589354e-03, 4.04162082e-03,
+	-3.87253346e-03, 2.49702667e-03, -5.97981312e-04, -1.10510425e-03,
+	2.10106449e-03, -2.21467577e-03, 1.59644390e-03, -6.05126916e-04,
+	-3.55597463e-04, 9.81302670e-04, -1.14655649e-03, 9.06606930e-04,
+	-4.37360206e-04, -5.20016521e-05, 3.97370962e-04, -5.23948315e-04,
+	4.49025132e-04, -2.52353841e-04, 3.25039036e-05, 1.31880490e-04,
+	-2.03476366e-04, 1.87312600e-04, -1.16589605e-04, 3.26205746e-05,
+	3.21582032e-05, -6.27949444e-05, 6.13836771e-05, -4.05196273e-05,
+	1.50341937e-05, 4.28654949e-06, -1.32320474e-05, 1.32305781e-05,
+	-8.53044048e-06, 3.32154286e-06, -1.92547752e-08, -9.91596597e-07,
+	-1.39633991e-06, 4.69476799e-06, -8.47548730e-06, 9.88150400e-06,
+	-5.34382271e-06, -7.33004352e-06, 2.64465349e-05, -4.49141763e-05,
+	5.12559381e-05, -3.38853313e-05, -1.22142463e-05, 7.90844700e-05,
+	-1.43414186e-04, 1.71364240e-04, -1.31205472e-04, 1.04564230e-05,
+	1.69486677e-04, -3.49672153e-04, 4.46945844e-04, -3.84136123e-04,
+	1.28524213e-04, 2.76903677e-04, -7.06642175e-04, 9.81531571e-04,
+	-9.31402996e-04, 4.73408410e-04, 3.24618307e-04, -1.22851705e-03,
+	1.89044698e-03, -1.96569125e-03, 1.26012272e-03, 1.47294094e-04,
+	-1.86592391e-03, 3.27633401e-03, -3.72945896e-03, 2.80646141e-03,
+	-5.45328745e-04, -2.46716198e-03, 5.20621788e-03, -6.52212537e-03,
+	5.57263562e-03, -2.22600532e-03, -2.73254097e-03, 7.71334503e-03,
+	-1.07742375e-02, 1.03031298e-02, -5.71229771e-03, -2.11995067e-03,
+	1.08767512e-02, -1.73782227e-02, 1.85944758e-02, -1.28068866e-02,
+	5.27913769e-04, 1.51856846e-02, -2.92346866e-02, 3.57539542e-02,
+	-2.98601205e-02, 9.38104702e-03, 2.39528875e-02, -6.42032540e-02,
+	1.01714187e-01, -1.23112528e-01, 1.01310736e-01, 8.02969296e-01,
+	2.59791617e-01, -1.64594241e-01, 9.75389194e-02, -4.00171677e-02,
+	-4.49697698e-03, 3.19763656e-02, -4.15164555e-02, 3.59117161e-02,
+	-2.07547146e-02, 2.74701067e-03, 1.21422432e-02, -2.01040619e-02,
+	2.01326871e-02, -1.37907242e-02, 4.27790927e-03, 4.82647467e-03,
+	-1.07251208e-02, 1.21311373e-02, -9.40676708e-03, 4.16216746e-03,
+	1.47318906e-03, -5.62188749e-03, 7.21823906e-03, -6.21017925e-03,
+	3.39722852e-03, -1.87652234e-05, -2.72948519e-03, 4.07867124e-03,
+	-3.86022472e-03, 2.44900943e-03, -5.36731620e-04, -1.15735411e-03,
+	2.12953166e-03, -2.21533197e-03, 1.57509218e-03, -5.73415789e-04,
+	-3.85253663e-04, 9.99960208e-04, -1.15089034e-03, 8.98703786e-04,
+	-4.22754041e-04, -6.69835361e-05, 4.07888199e-04, -5.27866590e-04,
+	4.46917324e-04, -2.46587966e-04, 2.59658641e-05, 1.36892359e-04,
+	-2.05847935e-04, 1.87134486e-04, -1.14757690e-04, 3.02794032e-05,
+	3.40848638e-05, -6.38454524e-05, 6.15568173e-05, -4.01093922e-05,
+	1.44164393e-05, 4.81956704e-06, -1.35437154e-05, 1.33250177e-05,
+	-8.48926587e-06, 3.23644241e-06, 5.01524036e-08, -1.02713848e-06,
+	-1.44482337e-06, 4.72815716e-06, -8.43193590e-06, 9.69300646e-06,
+	-4.98464594e-06, -7.78811738e-06, 2.68059076e-05, -4.48861033e-05,
+	5.05746531e-05, -3.24782322e-05, -1.40695181e-05, 8.07126698e-05,
+	-1.43886632e-04, 1.69849319e-04, -1.27436124e-04, 5.12494040e-06,
+	1.74638048e-04, -3.52235613e-04, 4.44708187e-04, -3.76182261e-04,
+	1.16149336e-04, 2.89970234e-04, -7.15044140e-04, 9.80100790e-04,
+	-9.17488024e-04, 4.48834230e-04, 3.52943517e-04, -1.25001894e-03,
+	1.89429458e-03, -1.94528589e-03, 1.21703549e-03, 2.01762369e-04,
+	-1.91284165e-03, 3.29494892e-03, -3.70521960e-03, 2.73846334e-03,
+	-4.49979753e-04, -2.55864288e-03, 5.25686395e-03, -6.50265869e-03,
+	5.47483993e-03, -2.07067336e-03, -2.89741070e-03, 7.82545803e-03,
+	-1.07782807e-02, 1.01738552e-02, -5.47084322e-03, -2.40416718e-03,
+	1.11022377e-02, -1.74432959e-02, 1.84361162e-02, -1.24336665e-02,
+	3.38301185e-05, 1.56353282e-02, -2.94462173e-02, 3.55686400e-02,
+	-2.92218980e-02, 8.39002852e-03, 2.50154854e-02, -6.48802277e-02,
+	1.01381609e-01, -1.20884288e-01, 9.51895759e-02, 8.01638998e-01,
+	2.66736944e-01, -1.65715914e-01, 9.68417299e-02, -3.87100901e-02,
+	-5.75759051e-03, 3.28263137e-02, -4.18252094e-02, 3.57357229e-02,
+	-2.02723110e-02, 2.18139524e-03, 1.25948796e-02, -2.03246958e-02,
+	2.00983362e-02, -1.35621048e-02, 3.96471795e-03, 5.10864736e-03,
+	-1.08918958e-02, 1.21501694e-02, -9.29860738e-03, 3.98428204e-03,
+	1.65133349e-03, -5.74321454e-03, 7.25419618e-03, -6.16482778e-03,
+	3.30004914e-03, 8.95065172e-05, -2.81213172e-03, 4.11416475e-03,
+	-3.84636215e-03, 2.39993579e-03, -4.75159594e-04, -1.20923937e-03,
+	2.15720584e-03, -2.21510924e-03, 1.55307292e-03, -5.41413384e-04,
+	-4.14817514e-04, 1.01825943e-03, -1.15477586e-03, 8.90425579e-04,
+	-4.07946234e-04, -8.19740936e-05, 4.18268628e-04, -5.31584481e-04,
+	4.44625999e-04, -2.40708334e-04, 1.93992861e-05, 1.41864082e-04,
+	-2.08144452e-04, 1.86881071e-04, -1.12873936e-04, 2.79181408e-05,
+	3.60047612e-05, -6.48743148e-05, 6.17059324e-05, -3.96812977e-05,
+	1.37900946e-05, 5.35321714e-06, -1.38515287e-05, 1.34145711e-05,
+	-8.44433612e-06, 3.14935714e-06, 1.20169963e-07, -1.06264895e-06,
+	-1.49223366e-06, 4.75933033e-06, -8.38522435e-06, 9.50168244e-06,
+	-4.62536801e-06, -8.24081676e-06, 2.71528891e-05, -4.48401685e-05,
+	4.98758650e-05, -3.10634846e-05, -1.59125043e-05, 8.23031061e-05,
+	-1.44300197e-04, 1.68271515e-04, -1.23627416e-04, -1.93125227e-07,
+	1.79705583e-04, -3.54652145e-04, 4.42299639e-04, -3.68098998e-04,
+	1.03758535e-04, 3.02890726e-04, -7.23142941e-04, 9.78284188e-04,
+	-9.03239143e-04, 4.24133845e-04, 3.81070463e-04, -1.27098189e-03,
+	1.89738334e-03, -1.92414805e-03, 1.17354605e-03, 2.56051257e-04,
+	-1.95891722e-03, 3.31222507e-03, -3.67955318e-03, 2.66949456e-03,
+	-3.54610552e-04, -2.64896042e-03, 5.30534532e-03, -6.48064630e-03,
+	5.37502887e-03, -1.91476336e-03, -3.06087687e-03, 7.93429766e-03,
+	-1.07780478e-02, 1.00407505e-02, -5.22759775e-03, -2.68698408e-03,
+	1.13229665e-02, -1.75013545e-02, 1.82707212e-02, -1.20561714e-02,
+	-4.59369670e-04, 1.60779190e-02, -2.96456564e-02, 3.53696572e-02,
+	-2.85736772e-02, 7.39844482e-03, 2.60647388e-02, -6.55288656e-02,
+	1.01010667e-01, -1.18624997e-01, 8.91174152e-02, 8.00203760e-01,
+	2.73697718e-01, -1.66780990e-01, 9.61022146e-02, -3.73822041e-02,
+	-7.02017227e-03, 3.36656723e-02, -4.21181451e-02, 3.55451516e-02,
+	-1.97808589e-02, 1.61381428e-03, 1.30433514e-02, -2.05376542e-02,
+	2.00559542e-02, -1.33277297e-02, 3.64945048e-03, 5.38923943e-03,
+	-1.10546103e-02, 1.21644106e-02, -9.18659114e-03, 3.80454062e-03,
+	1.82909907e-03, -5.86245190e-03, 7.28733108e-03, -6.11695757e-03,
+	3.20140365e-03, 1.97919291e-04, -2.89379876e-03, 4.14808463e-03,
+	-3.83094862e-03, 2.34982343e-03, -4.13289131e-04, -1.26073877e-03,
+	2.18407455e-03, -2.21400599e-03, 1.53039357e-03, -5.09131849e-04,
+	-4.44277063e-04, 1.03619230e-03, -1.15821054e-03, 8.81774771e-04,
+	-3.92942224e-04, -9.69673708e-05, 4.28507779e-04, -5.35100003e-04,
+	4.42151596e-04, -2.34716988e-04, 1.28067136e-05, 1.46793554e-04,
+	-2.10364772e-04, 1.86552222e-04, -1.10938931e-04, 2.55376665e-05,
+	3.79170997e-05, -6.58810365e-05, 6.18308671e-05, -3.92354417e-05,
+	1.31553751e-05, 5.88728570e-06, -1.41553411e-05, 1.34991735e-05,
+	-8.39564586e-06, 3.06030942e-06, 1.90772464e-07, -1.09811063e-06,
+	-1.53855968e-06, 4.78829101e-06, -8.33539271e-06, 9.30762694e-06,
+	-4.26613583e-06, -8.68798436e-06, 2.74873954e-05, -4.47764663e-05,
+	4.91599244e-05, -2.96416847e-05, -1.77425108e-05, 8.38552720e-05,
+	-1.44654909e-04, 1.66631657e-04, -1.19780984e-04, -5.49569258e-06,
+	1.84687498e-04, -3.56921182e-04, 4.39721603e-04, -3.59889877e-04,
+	9.13567772e-05, 3.15660361e-04, -7.30936055e-04, 9.76083346e-04,
+	-8.88662740e-04, 3.99317334e-04, 4.08988383e-04, -1.29139866e-03,
+	1.89971354e-03, -1.90228751e-03, 1.12967242e-03, 3.10139543e-04,
+	-2.00413386e-03, 3.32815797e-03, -3.65247234e-03, 2.59958406e-03,
+	-2.59258992e-04, -2.73808069e-03, 5.35164625e-03, -6.45610098e-03,
+	5.27324517e-03, -1.75833800e-03, -3.22287688e-03, 8.03982585e-03,
+	-1.07735456e-02, 9.90387443e-03, -4.98266040e-03, -2.96829161e-03,
+	1.15388578e-02, -1.75523869e-02, 1.80983680e-02, -1.16745578e-02,
+	-9.51492247e-04, 1.65132955e-02, -2.98329499e-02, 3.51571147e-02,
+	-2.79157379e-02, 6.40668697e-03, 2.71002805e-02, -6.61490277e-02,
+	1.00601699e-01, -1.16335718e-01, 8.30953535e-02, 7.98663924e-01,
+	2.80672496e-01, -1.67788609e-01, 9.53204233e-02, -3.60339401e-02,
+	-8.28423378e-03, 3.44940808e-02, -4.23951072e-02, 3.53400442e-02,
+	-1.92805336e-02, 1.04448856e-03, 1.34874735e-02, -2.07428395e-02,
+	2.00055445e-02, -1.30876823e-02, 3.33222852e-03, 5.66813713e-03,
+	-1.12131935e-02, 1.21738479e-02, -9.07075686e-03, 3.62301167e-03,
+	2.00641468e-03, -5.97954900e-03, 7.31762616e-03, -6.06658363e-03,
+	3.10132885e-03, 3.06430275e-04, -2.97445223e-03, 4.18041477e-03,
+	-3.81398757e-03, 2.29869043e-03, -3.51144288e-04, -1.31183111e-03,
+	2.21012561e-03, -2.21202098e-03, 1.50706188e-03, -4.76583470e-04,
+	-4.73620374e-04, 1.05375091e-03, -1.16119205e-03, 8.72753982e-04,
+	-3.77747539e-04, -1.11957398e-04, 4.38601225e-04, -5.38411247e-04,
+	4.39494628e-04, -2.28616019e-04, 6.19070809e-06, 1.51678685e-04,
+	-2.12507779e-04, 1.86147836e-04, -1.08953282e-04, 2.31388701e-05,
+	3.98210843e-05, -6.68651293e-05, 6.19314755e-05, -3.87719299e-05,
+	1.25125004e-05, 6.42155743e-06, -1.44550077e-05, 1.35787617e-05,
+	-8.34319128e-06, 2.96932262e-06, 2.61933992e-07, -1.13350597e-06,
+	-1.58379091e-06, 4.81504367e-06, -8.28248210e-06, 9.11093555e-06,
+	-3.90709553e-06, -9.12946588e-06, 2.78093478e-05, -4.46950975e-05,
+	4.84271874e-05, -2.82134296e-05, -1.95588515e-05, 8.53686775e-05,
+	-1.44950818e-04, 1.64930592e-04, -1.15898477e-04, -1.07806926e-05,
+	1.89582046e-04, -3.59042218e-04, 4.36975546e-04, -3.51558481e-04,
+	7.89490233e-05, 3.28274418e-04, -7.38421084e-04, 9.73499998e-04,
+	-8.73765316e-04, 3.74394799e-04, 4.36686618e-04, -1.31126224e-03,
+	1.90128572e-03, -1.87971434e-03, 1.08543273e-03, 3.64006130e-04,
+	-2.04847517e-03, 3.34274363e-03, -3.62399024e-03, 2.52876115e-03,
+	-1.63962854e-04, -2.82597030e-03, 5.39575191e-03, -6.42903649e-03,
+	5.16953228e-03, -1.60146009e-03, -3.38334882e-03, 8.14200590e-03,
+	-1.07647825e-02, 9.76328701e-03, -4.73613081e-03, -3.24798075e-03,
+	1.17498340e-02, -1.75963845e-02, 1.79191364e-02, -1.12889839e-02,
+	-1.44234504e-03, 1.69412997e-02, -3.00080487e-02, 3.49311263e-02,
+	-2.72483629e-02, 5.41514497e-03, 2.81217497e-02, -6.67405850e-02,
+	1.00155057e-01, -1.14017516e-01, 7.71244730e-02, 7.97019856e-01,
+	2.87659832e-01, -1.68737923e-01, 9.44964214e-02, -3.46657381e-02,
+	-9.54928436e-03, 3.53111815e-02, -4.26559461e-02, 3.51204489e-02,
+	-1.87715147e-02, 4.73640018e-04, 1.39270620e-02, -2.09401566e-02,
+	1.99471134e-02, -1.28420484e-02, 3.01317470e-03, 5.94522718e-03,
+	-1.13675761e-02, 1.21784700e-02, -8.95114458e-03, 3.43976443e-03,
+	2.18320925e-03, -6.09445601e-03, 7.34506494e-03, -6.01372199e-03,
+	2.99986218e-03, 4.14996538e-04, -3.05405844e-03, 4.21113964e-03,
+	-3.79548311e-03, 2.24655534e-03, -2.88749276e-04, -1.36249536e-03,
+	2.23534714e-03, -2.20915333e-03, 1.48308584e-03, -4.43780665e-04,
+	-5.02835532e-04, 1.07092748e-03, -1.16371820e-03, 8.63365980e-04,
+	-3.62367798e-04, -1.26938195e-04, 4.48544589e-04, -5.41516379e-04,
+	4.36655682e-04, -2.22407569e-04, -4.46152249e-07, 1.56517392e-04,
+	-2.14572385e-04, 1.85667840e-04, -1.06917622e-04, 2.07226519e-05,
+	4.17159201e-05, -6.78261124e-05, 6.20076206e-05, -3.82908755e-05,
+	1.18616946e-05, 6.95581592e-06, -1.47503841e-05, 1.36532741e-05,
+	-8.28697013e-06, 2.87642112e-06, 3.33628161e-07, -1.16881730e-06,
+	-1.62791741e-06, 4.83959367e-06, -8.22653466e-06, 8.91170440e-06,
+	-3.54839238e-06, -9.56511009e-06, 2.81186732e-05, -4.45961698e-05,
+	4.76780156e-05, -2.67793162e-05, -2.13608480e-05, 8.68428502e-05,
+	-1.45188000e-04, 1.63169193e-04, -1.11981553e-04, -1.60460691e-05,
+	1.94387520e-04, -3.61014807e-04, 4.34063000e-04, -3.43108432e-04,
+	6.65402228e-05, 3.40728250e-04, -7.45595762e-04, 9.70536022e-04,
+	-8.58553486e-04, 3.49376365e-04, 4.64154620e-04, -1.33056585e-03,
+	1.90210075e-03, -1.85643885e-03, 1.04084522e-03, 4.17630051e-04,
+	-2.09192510e-03, 3.35597863e-03, -3.59412059e-03, 2.45705546e-03,
+	-6.87598341e-05, -2.91259642e-03, 5.43764834e-03, -6.39946754e-03,
+	5.06393432e-03, -1.44419250e-03, -3.54223147e-03, 8.24080251e-03,
+	-1.07517685e-02, 9.61904965e-03, -4.48810909e-03, -3.52594332e-03,
+	1.19558193e-02, -1.76333412e-02, 1.77331089e-02, -1.08996091e-02,
+	-1.93173631e-03, 1.73617765e-02, -3.01709086e-02, 3.46918110e-02,
+	-2.65718382e-02, 4.42420770e-03, 2.91287923e-02, -6.73034204e-02,
+	9.96711035e-02, -1.11671459e-01, 7.12058387e-02, 7.95271946e-01,
+	2.94658267e-01, -1.69628096e-01, 9.36302903e-02, -3.32780472e-02,
+	-1.08148313e-02, 3.61166204e-02, -4.29005182e-02, 3.48864194e-02,
+	-1.82539851e-02, -9.85084014e-05, 1.43619345e-02, -2.11295135e-02,
+	1.98806705e-02, -1.25909162e-02, 2.69241256e-03, 6.22039686e-03,
+	-1.15176901e-02, 1.21782677e-02, -8.82779592e-03, 3.25486897e-03,
+	2.35941181e-03, -6.20712392e-03, 7.36963203e-03, -5.95838968e-03,
+	2.89704169e-03, 5.23575055e-04, -3.13258402e-03, 4.24024434e-03,
+	-3.77543993e-03, 2.19343712e-03, -2.26128446e-04, -1.41271060e-03,
+	2.25972758e-03, -2.20540250e-03, 1.45847374e-03, -4.10735973e-04,
+	-5.31910649e-04, 1.08771437e-03, -1.16578703e-03, 8.53613691e-04,
+	-3.46808704e-04, -1.41903768e-04, 4.58333542e-04, -5.44413644e-04,
+	4.33635420e-04, -2.16093831e-04, -7.10127392e-06, 1.61307609e-04,
+	-2.16557528e-04, 1.85112190e-04, -1.04832604e-04, 1.82899221e-05,
+	4.36008132e-05, -6.87635127e-05, 6.20591750e-05, -3.77923993e-05,
+	1.12031861e-05, 7.48984374e-06, -1.50413271e-05, 1.37226509e-05,
+	-8.22698174e-06, 2.78163030e-06, 4.05828123e-07, -1.20402677e-06,
+	-1.67092983e-06, 4.86194730e-06, -8.16759357e-06, 8.71003013e-06,
+	-3.19017074e-06, -9.99476887e-06, 2.84153039e-05, -4.44797975e-05,
+	4.69127755e-05, -2.53399420e-05, -2.31478302e-05, 8.82773346e-05,
+	-1.45366551e-04, 1.61348352e-04, -1.08031877e-04, -2.12897799e-05,
+	1.99102255e-04, -3.62838563e-04, 4.30985558e-04, -3.34543394e-04,
+	5.41353141e-05, 3.53017284e-04, -7.52457950e-04, 9.67193446e-04,
+	-8.43033977e-04, 3.24272171e-04, 4.91381955e-04, -1.34930295e-03,
+	1.90215978e-03, -1.83247162e-03, 9.95928225e-04, 4.70990469e-04,
+	-2.13446802e-03, 3.36786009e-03, -3.56287762e-03, 2.38449691e-03,
+	2.63124705e-05, -2.99792676e-03, 5.47732249e-03, -6.36740986e-03,
+	4.95649613e-03, -1.28659815e-03, -3.69946434e-03, 8.33618176e-03,
+	-1.07345154e-02, 9.47122514e-03, -4.23869577e-03, -3.80207198e-03,
+	1.21567403e-02, -1.76632540e-02, 1.75403704e-02, -1.05065938e-02,
+	-2.41947528e-03, 1.77745743e-02, -3.03214903e-02, 3.44392927e-02,
+	-2.58864526e-02, 3.43426272e-03, 3.01210607e-02, -6.78374277e-02,
+	9.91502148e-02, -1.09298616e-01, 6.53404986e-02, 7.93420611e-01,
+	3.01666339e-01, -1.70458304e-01, 9.27221272e-02, -3.18713261e-02,
+	-1.20803801e-02, 3.69100467e-02, -4.31286859e-02, 3.46380152e-02,
+	-1.77281318e-02, -6.71732800e-04, 1.47919101e-02, -2.13108214e-02,
+	1.98062286e-02, -1.23343762e-02, 2.37006653e-03, 6.49353400e-03,
+	-1.16634695e-02, 1.21732334e-02, -8.70075404e-03, 3.06839610e-03,
+	2.53495151e-03, -6.31750451e-03, 7.39131316e-03, -5.90060474e-03,
+	2.79290604e-03, 6.32122728e-04, -3.20999601e-03, 4.26771459e-03,
+	-3.75386337e-03, 2.13935517e-03, -1.63306283e-04, -1.46245604e-03,
+	2.28325566e-03, -2.20076830e-03, 1.43323414e-03, -3.77462060e-04,
+	-5.60833869e-04, 1.10410409e-03, -1.16739671e-03, 8.43500189e-04,
+	-3.31076047e-04, -1.56848117e-04, 4.67963807e-04, -5.47101366e-04,
+	4.30434577e-04, -2.09677042e-04, -1.37720489e-05, 1.66047280e-04,
+	-2.18462178e-04, 1.84480873e-04, -1.02698902e-04, 1.58416008e-05,
+	4.54749711e-05, -6.96768645e-05, 6.20860208e-05, -3.72766296e-05,
+	1.05372071e-05, 8.02342249e-06, -1.53276948e-05, 1.37868342e-05,
+	-8.16322703e-06, 2.68497655e-06, 4.78506578e-07, -1.23911643e-06,
+	-1.71281942e-06, 4.88211175e-06, -8.10570296e-06, 8.50600982e-06,
+	-2.83257405e-06, -1.04182973e-05, 2.86991778e-05, -4.43461016e-05,
+	4.61318388e-05, -2.38959041e-05, -2.49191365e-05, 8.96716929e-05,
+	-1.45486591e-04, 1.59468981e-04, -1.04051124e-04, -2.65097973e-05,
+	2.03724626e-04, -3.64513161e-04, 4.27744873e-04, -3.25867063e-04,
+	4.17392218e-05, 3.65137023e-04, -7.59005636e-04, 9.63474444e-04,
+	-8.27213622e-04, 2.99092370e-04, 5.18358304e-04, -1.36746723e-03,
+	1.90146426e-03, -1.80782349e-03, 9.50700195e-04, 5.24066692e-04,
+	-2.17608867e-03, 3.37838566e-03, -3.53027607e-03, 2.31111572e-03,
+	1.21216577e-04, -3.08192962e-03, 5.51476221e-03, -6.33288011e-03,
+	4.84726318e-03, -1.12874003e-03, -3.85498768e-03, 8.42811114e-03,
+	-1.07130364e-02, 9.31987758e-03, -3.98799179e-03, -4.07626028e-03,
+	1.23525254e-02, -1.76861225e-02, 1.73410085e-02, -1.01101000e-02,
+	-2.90537212e-03, 1.81795446e-02, -3.04597596e-02, 3.41737004e-02,
+	-2.51924975e-02, 2.44569613e-03, 3.10982142e-02, -6.83425125e-02,
+	9.85927781e-02, -1.06900060e-01, 5.95294824e-02, 7.91466290e-01,
+	3.08682579e-01, -1.71227737e-01, 9.17720454e-02, -3.04460425e-02,
+	-1.33454346e-02, 3.76911135e-02, -4.33403175e-02, 3.43753019e-02,
+	-1.71941454e-02, -1.24580842e-03, 1.52168095e-02, -2.14839941e-02,
+	1.97238035e-02, -1.20725212e-02, 2.04626185e-03, 6.76452709e-03,
+	-1.18048496e-02, 1.21633618e-02, -8.57006363e-03, 2.88041738e-03,
+	2.70975768e-03, -6.42555040e-03, 7.41009519e-03, -5.84038622e-03,
+	2.68749445e-03, 7.40596401e-04, -3.28626181e-03, 4.29353671e-03,
+	-3.73075938e-03, 2.08432929e-03, -1.00307398e-04, -1.51171107e-03,
+	2.30592045e-03, -2.19525089e-03, 1.40737584e-03, -3.43971706e-04,
+	-5.89593371e-04, 1.12008927e-03, -1.16854561e-03, 8.33028701e-04,
+	-3.15175698e-04, -1.71765237e-04, 4.77431158e-04, -5.49577949e-04,
+	4.27053964e-04, -2.03159489e-04, -2.04558556e-05, 1.70734365e-04,
+	-2.20285332e-04, 1.83773906e-04, -1.00517215e-04, 1.33786174e-05,
+	4.73376026e-05, -7.05657103e-05, 6.20880494e-05, -3.67437025e-05,
+	9.86399435e-06, 8.55633296e-06, -1.56093462e-05, 1.38457679e-05,
+	-8.09570850e-06, 2.58648723e-06, 5.51635781e-07, -1.27406819e-06,
+	-1.75357801e-06, 4.90009511e-06, -8.04090793e-06, 8.29974097e-06,
+	-2.47574470e-06, -1.08355535e-05, 2.89702379e-05, -4.41952094e-05,
+	4.53355821e-05, -2.24477993e-05, -2.66741139e-05, 9.10255050e-05,
+	-1.45548266e-04, 1.57532016e-04, -1.00040976e-04, -3.17041088e-05,
+	2.08253050e-04, -3.66038337e-04, 4.24342662e-04, -3.17083172e-04,
+	2.93568553e-05, 3.77083048e-04, -7.65236942e-04, 9.59381334e-04,
+	-8.11099359e-04, 2.73847124e-04, 5.45073470e-04, -1.38505263e-03,
+	1.90001596e-03, -1.78250554e-03, 9.05179656e-04, 5.76838180e-04,
+	-2.21677218e-03, 3.38755354e-03, -3.49633122e-03, 2.23694237e-03,
+	2.15915133e-04, -3.16457384e-03, 5.54995625e-03, -6.29589590e-03,
+	4.73628159e-03, -9.70681082e-04, -4.00874251e-03, 8.51655956e-03,
+	-1.06873467e-02, 9.16507237e-03, -3.73609844e-03, -4.34840272e-03,
+	1.25431053e-02, -1.77019492e-02, 1.71351132e-02, -9.71029030e-03,
+	-3.38923811e-03, 1.85765424e-02, -3.05856870e-02, 3.38951675e-02,
+	-2.44902672e-02, 1.45889245e-03, 3.20599192e-02, -6.88185916e-02,
+	9.79991923e-02, -1.04476863e-01, 5.37738025e-02, 7.89409447e-01,
+	3.15705509e-01, -1.71935598e-01, 9.07801740e-02, -2.90026731e-02,
+	-1.46094970e-02, 3.84594778e-02, -4.35352878e-02, 3.40983506e-02,
+	-1.66522200e-02, -1.82050974e-03, 1.56364553e-02, -2.16489488e-02,
+	1.96334146e-02, -1.18054462e-02, 1.72112454e-03, 7.03326528e-03,
+	-1.19417676e-02, 1.21486493e-02, -8.43577089e-03, 2.69100506e-03,
+	2.88375979e-03, -6.53121507e-03, 7.42596611e-03, -5.77775416e-03,
+	2.58084674e-03, 8.48952875e-04, -3.36134924e-03, 4.31769769e-03,
+	-3.70613452e-03, 2.02837971e-03, -3.71565129e-05, -1.56045520e-03,
+	2.32771133e-03, -2.18885080e-03, 1.38090793e-03, -3.10277801e-04,
+	-6.18177377e-04, 1.13566270e-03, -1.16923228e-03, 8.22202602e-04,
+	-2.99113607e-04, -1.86649118e-04, 4.86731426e-04, -5.51841876e-04,
+	4.23494465e-04, -1.96543504e-04, -2.71500601e-05, 1.75366840e-04,
+	-2.22026016e-04, 1.82991337e-04, -9.82882603e-05, 1.09019103e-05,
+	4.91879183e-05, -7.14296009e-05, 6.20651620e-05, -3.61937613e-05,
+	9.18378825e-06, 9.08835513e-06, -1.58861416e-05, 1.38993977e-05,
+	-8.02443027e-06, 2.48619070e-06, 6.25187555e-07, -1.30886386e-06,
+	-1.79319801e-06, 4.91590633e-06, -7.97325451e-06, 8.09132146e-06,
+	-2.11982403e-06, -1.12463991e-05, 2.92284330e-05, -4.40272548e-05,
+	4.45243866e-05, -2.09962237e-05, -2.84121182e-05, 9.23383684e-05,
+	-1.45551741e-04, 1.55538411e-04, -9.60031211e-05, -3.68707181e-05,
+	2.12685983e-04, -3.67413887e-04, 4.20780699e-04, -3.08195489e-04,
+	1.69931063e-05, 3.88851022e-04, -7.71150118e-04, 9.54916577e-04,
+	-7.94698230e-04, 2.48546600e-04, 5.71517382e-04, -1.40205333e-03,
+	1.89781691e-03, -1.75652910e-03, 8.59385219e-04, 6.29284548e-04,
+	-2.25650409e-03, 3.39536247e-03, -3.46105884e-03, 2.16200763e-03,
+	3.10370926e-04, -3.24582889e-03, 5.58289429e-03, -6.25647580e-03,
+	4.62359810e-03, -8.12484274e-04, -4.16067066e-03, 8.60149735e-03,
+	-1.06574629e-02, 9.00687615e-03, -3.48311733e-03, -4.61839476e-03,
+	1.27284130e-02, -1.77107392e-02, 1.69227768e-02, -9.30732871e-03,
+	-3.87088566e-03, 1.89654263e-02, -3.06992480e-02, 3.36038328e-02,
+	-2.37800583e-02, 4.74234446e-04, 3.30058489e-02, -6.92655933e-02,
+	9.73698678e-02, -1.02030099e-01, 4.80744529e-02, 7.87250570e-01,
+	3.22733648e-01, -1.72581103e-01, 8.97466581e-02, -2.75417034e-02,
+	-1.58720684e-02, 3.92148004e-02, -4.37134776e-02, 3.38072382e-02,
+	-1.61025533e-02, -2.39561053e-03, 1.60506714e-02, -2.18056056e-02,
+	1.95350840e-02, -1.15332485e-02, 1.39478138e-03, 7.29963844e-03,
+	-1.20741620e-02, 1.21290941e-02, -8.29792353e-03, 2.50023208e-03,
+	3.05688755e-03, -6.63445288e-03, 7.43891504e-03, -5.71272960e-03,
+	2.47300325e-03, 9.57148929e-04, -3.43522653e-03, 4.34018514e-03,
+	-3.67999596e-03, 1.97152703e-03, 2.61215448e-05, -1.60866814e-03,
+	2.34861803e-03, -2.18156888e-03, 1.35383976e-03, -2.76393345e-04,
+	-6.46574152e-04, 1.15081732e-03, -1.16945546e-03, 8.11025417e-04,
+	-2.82895806e-04, -2.01493751e-04, 4.95860498e-04, -5.53891710e-04,
+	4.19757037e-04, -1.89831465e-04, -3.38520169e-05, 1.79942695e-04,
+	-2.23683288e-04, 1.82133244e-04, -9.60127783e-05, 8.41242670e-06,
+	5.10251311e-05, -7.22680952e-05, 6.20172696e-05, -3.56269572e-05,
+	8.49683324e-06, 9.61926831e-06, -1.61579424e-05, 1.39476712e-05,
+	-7.94939807e-06, 2.38411629e-06, 6.99133294e-07, -1.34348510e-06,
+	-1.83167242e-06, 4.92955527e-06, -7.90278966e-06, 7.88084947e-06,
+	-1.76495227e-06, -1.16506989e-05, 2.94737173e-05, -4.38423779e-05,
+	4.36986380e-05, -1.95417728e-05, -3.01325145e-05, 9.36098983e-05,
+	-1.45497205e-04, 1.53489138e-04, -9.19392538e-05, -4.20076457e-05,
+	2.17021928e-04, -3.68639665e-04, 4.17060820e-04, -2.99207810e-04,
+	4.65284722e-06, 4.00436686e-04, -7.76743543e-04, 9.50082779e-04,
+	-7.78017374e-04, 2.23200963e-04, 5.97680095e-04, -1.41846375e-03,
+	1.89486946e-03, -1.72990574e-03, 8.13335570e-04, 6.81385580e-04,
+	-2.29527034e-03, 3.40181174e-03, -3.42447519e-03, 2.08634248e-03,
+	4.04546906e-04, -3.32566482e-03, 5.61356689e-03, -6.21463931e-03,
+	4.50926005e-03, -6.54212510e-04, -4.31071475e-03, 8.68289628e-03,
+	-1.06234033e-02, 8.84535685e-03, -3.22915033e-03, -4.88613289e-03,
+	1.29083835e-02, -1.77125005e-02, 1.67040941e-02, -8.90138002e-03,
+	-4.35012838e-03, 1.93460579e-02, -3.08004230e-02, 3.32998392e-02,
+	-2.30621700e-02, -5.07896991e-04, 3.39356838e-02, -6.96834572e-02,
+	9.67052263e-02, -9.95608431e-02, 4.24324091e-02, 7.84990172e-01,
+	3.29765509e-01, -1.73163483e-01, 8.86716591e-02, -2.60636276e-02,
+	-1.71326487e-02, 3.99567463e-02, -4.38747740e-02, 3.35020474e-02,
+	-1.55453464e-02, -2.97088398e-03, 1.64592839e-02, -2.19538881e-02,
+	1.94288372e-02, -1.12560276e-02, 1.06735980e-03, 7.56353720e-03,
+	-1.22019734e-02, 1.21046965e-02, -8.15657075e-03, 2.30817204e-03,
+	3.22907090e-03, -6.73521905e-03, 7.44893225e-03, -5.64533454e-03,
+	2.36400490e-03, 1.06514134e-03, -3.50786233e-03, 4.36098730e-03,
+	-3.65235151e-03, 1.91379229e-03, 8.95018526e-05, -1.65632976e-03,
+	2.36863057e-03, -2.17340636e-03, 1.32618091e-03, -2.42331437e-04,
+	-6.74772015e-04, 1.16554622e-03, -1.16921404e-03, 7.99500820e-04,
+	-2.66528399e-04, -2.16293127e-04, 5.04814319e-04, -5.55726100e-04,
+	4.15842712e-04, -1.83025796e-04, -4.05590701e-05, 1.84459939e-04,
+	-2.25256235e-04, 1.81199737e-04, -9.36915300e-05, 5.91112205e-06,
+	5.28484563e-05, -7.30807610e-05, 6.19442927e-05, -3.50434484e-05,
+	7.80337760e-06, 1.01488512e-05, -1.64246117e-05, 1.39905381e-05,
+	-7.87061923e-06, 2.28029433e-06, 7.73443978e-07, -1.37791353e-06,
+	-1.86899481e-06, 4.94105262e-06, -7.82956118e-06, 7.66842350e-06,
+	-1.41126848e-06, -1.20483209e-05, 2.97060504e-05, -4.36407252e-05,
+	4.28587264e-05, -1.80850407e-05, -3.18346772e-05, 9.48397279e-05,
+	-1.45384871e-04, 1.51385192e-04, -8.78510739e-05, -4.71129299e-05,
+	2.21259427e-04, -3.69715589e-04, 4.13184916e-04, -2.90123966e-04,
+	-7.65907077e-06, 4.11835866e-04, -7.82015731e-04, 9.44882684e-04,
+	-7.61064025e-04, 1.97820378e-04, 6.23551798e-04, -1.43427856e-03,
+	1.89117624e-03, -1.70264725e-03, 7.67049460e-04, 7.33121233e-04,
+	-2.33305727e-03, 3.40690117e-03, -3.38659705e-03, 2.00997818e-03,
+	4.98406192e-04, -3.40405229e-03, 5.64196554e-03, -6.17040686e-03,
+	4.39331536e-03, -4.95928631e-04, -4.45881826e-03, 8.76072957e-03,
+	-1.05851879e-02, 8.68058357e-03, -2.97429954e-03, -5.15151465e-03,
+	1.30829540e-02, -1.77072439e-02, 1.64791623e-02, -8.49260996e-03,
+	-4.82678120e-03, 1.97183027e-02, -3.08891973e-02, 3.29833347e-02,
+	-2.23369037e-02, -1.48712300e-03, 3.48491116e-02, -7.00721343e-02,
+	9.60057003e-02, -9.70701703e-02, 3.68486285e-02, 7.82628789e-01,
+	3.36799597e-01, -1.73681981e-01, 8.75553541e-02, -2.45689486e-02,
+	-1.83907370e-02, 4.06849847e-02, -4.40190705e-02, 3.31828666e-02,
+	-1.49808040e-02, -3.54610277e-03, 1.68621208e-02, -2.20937226e-02,
+	1.93147031e-02, -1.09738851e-02, 7.38987865e-04, 7.82485301e-03,
+	-1.23251438e-02, 1.20754587e-02, -8.01176320e-03, 2.11489916e-03,
+	3.40024005e-03, -6.83346974e-03, 7.45600916e-03, -5.57559200e-03,
+	2.25389310e-03, 1.17288688e-03, -3.57922574e-03, 4.38009308e-03,
+	-3.62320957e-03, 1.85519688e-03, 1.52959403e-04, -1.70342011e-03,
+	2.38773935e-03, -2.16436481e-03, 1.29794124e-03, -2.08105276e-04,
+	-7.02759338e-04, 1.17984263e-03, -1.16850714e-03, 7.87632628e-04,
+	-2.50017567e-04, -2.31041241e-04, 5.13588895e-04, -5.57343774e-04,
+	4.11752594e-04, -1.76128962e-04, -4.72685544e-05, 1.88916598e-04,
+	-2.26743977e-04, 1.80190953e-04, -9.13252973e-05, 3.39895985e-06,
+	5.46571121e-05, -7.38671747e-05, 6.18461617e-05, -3.44434010e-05,
+	7.10367336e-06, 1.06768820e-05, -1.66860138e-05, 1.40279498e-05,
+	-7.78810272e-06, 2.17475610e-06, 8.48090182e-07, -1.41213061e-06,
+	-1.90515935e-06, 4.95040994e-06, -7.75361776e-06, 7.45414227e-06,
+	-1.05891048e-06, -1.24391366e-05, 2.99253973e-05, -4.34224492e-05,
+	4.20050460e-05, -1.66266203e-05, -3.35179902e-05, 9.60275084e-05,
+	-1.45214974e-04, 1.49227584e-04, -8.37402857e-05, -5.21846271e-05,
+	2.25397067e-04, -3.70641635e-04, 4.09154938e-04, -2.80947813e-04,
+	-1.99378196e-05, 4.23044471e-04, -7.86965324e-04, 9.39319178e-04,
+	-7.43845512e-04, 1.72415000e-04, 6.49122816e-04, -1.44949268e-03,
+	1.88674019e-03, -1.67476569e-03, 7.20545700e-04, 7.84471646e-04,
+	-2.36985165e-03, 3.41063113e-03, -3.34744165e-03, 1.93294618e-03,
+	5.91912092e-04, -3.48096258e-03, 5.66808266e-03, -6.12379980e-03,
+	4.27581251e-03, -3.37695382e-04, -4.60492551e-03, 8.83497190e-03,
+	-1.05428382e-02, 8.51262662e-03, -2.71866728e-03, -5.41443866e-03,
+	1.32520641e-02, -1.76949830e-02, 1.62480809e-02, -8.08118506e-03,
+	-5.30066036e-03, 2.00820296e-02, -3.09655611e-02, 3.26544718e-02,
+	-2.16045629e-02, -2.46306690e-03, 3.57458273e-02, -7.04315869e-02,
+	9.52717335e-02, -9.45591556e-02, 3.13240491e-02, 7.80166981e-01,
+	3.43834417e-01, -1.74135857e-01, 8.63979367e-02, -2.30581777e-02,
+	-1.96458316e-02, 4.13991894e-02, -4.41462668e-02, 3.28497898e-02,
+	-1.44091339e-02, -4.12103915e-03, 1.72590117e-02, -2.22250389e-02,
+	1.91927133e-02, -1.06869247e-02, 4.09794238e-04, 8.08347815e-03,
+	-1.24436172e-02, 1.20413847e-02, -7.86355299e-03, 1.92048824e-03,
+	3.57032549e-03, -6.92916204e-03, 7.46013833e-03, -5.50352591e-03,
+	2.14270979e-03, 1.28034237e-03, -3.64928632e-03, 4.39749204e-03,
+	-3.59257916e-03, 1.79576259e-03, 2.16469115e-04, -1.74991943e-03,
+	2.40593509e-03, -2.15444616e-03, 1.26913085e-03, -1.73728149e-04,
+	-7.30524553e-04, 1.19369998e-03, -1.16733401e-03, 7.75424808e-04,
+	-2.33369558e-04, -2.45732096e-04, 5.22180292e-04, -5.58743544e-04,
+	4.07487860e-04, -1.69143474e-04, -5.39777963e-05, 1.93310715e-04,
+	-2.28145665e-04, 1.79107064e-04, -8.89148827e-05, 8.76911218e-07,
+	5.64503198e-05, -7.46269220e-05, 6.17228172e-05, -3.38269882e-05,
+	6.39797619e-06, 1.12031385e-05, -1.69420145e-05, 1.40598600e-05,
+	-7.70185916e-06, 2.06753385e-06, 9.23042084e-07, -1.44611777e-06,
+	-1.94016078e-06, 4.95763962e-06, -7.67500892e-06, 7.23810469e-06,
+	-7.08014844e-07, -1.28230210e-05, 3.01317285e-05, -4.31877087e-05,
+	4.11379950e-05, -1.51671031e-05, -3.51818473e-05, 9.71729090e-05,
+	-1.44987770e-04, 1.47017344e-04, -7.96085974e-05, -5.72208128e-05,
+	2.29433480e-04, -3.71417837e-04, 4.04972892e-04, -2.71683235e-04,
+	-3.21785963e-05, 4.34058495e-04, -7.91591097e-04, 9.33395284e-04,
+	-7.26369252e-04, 1.46994973e-04, 6.74383613e-04, -1.46410127e-03,
+	1.88156451e-03, -1.64627329e-03, 6.73843152e-04, 8.35417147e-04,
+	-2.40564064e-03, 3.41300251e-03, -3.30702673e-03, 1.85527817e-03,
+	6.85028113e-04, -3.55636763e-03, 5.69191156e-03, -6.07484038e-03,
+	4.15680054e-03, -1.79575391e-04, -4.74898169e-03, 8.90559938e-03,
+	-1.04963773e-02, 8.34155743e-03, -2.46235598e-03, -5.67480469e-03,
+	1.34156556e-02, -1.76757339e-02, 1.60109515e-02, -7.66727265e-03,
+	-5.77158357e-03, 2.04371113e-02, -3.10295096e-02, 3.23134074e-02,
+	-2.08654532e-02, -3.43535430e-03, 3.66255333e-02, -7.07617885e-02,
+	9.45037799e-02, -9.20288738e-02, 2.58595905e-02, 7.77605332e-01,
+	3.50868465e-01, -1.74524384e-01, 8.51996163e-02, -2.15318341e-02,
+	-2.08974302e-02, 4.20990384e-02, -4.42562694e-02, 3.25029170e-02,
+	-1.38305472e-02, -4.69546506e-03, 1.76497886e-02, -2.23477699e-02,
+	1.90629029e-02, -1.03952522e-02, 7.99081028e-05, 8.33930581e-03,
+	-1.25573393e-02, 1.20024807e-02, -7.71199366e-03, 1.72501467e-03,
+	3.73925805e-03, -7.02225397e-03, 7.46131349e-03, -5.42916122e-03,
+	2.03049739e-03, 1.38746465e-03, -3.71801408e-03, 4.41317440e-03,
+	-3.56046990e-03, 1.73551156e-03, 2.80005839e-04, -1.79580817e-03,
+	2.42320887e-03, -2.14365268e-03, 1.23976010e-03, -1.39213431e-04,
+	-7.58056158e-04, 1.20711180e-03, -1.16569413e-03, 7.62881468e-04,
+	-2.16590693e-04, -2.60359702e-04, 5.30584641e-04, -5.59924308e-04,
+	4.03049762e-04, -1.62071883e-04, -6.06841148e-05, 1.97640354e-04,
+	-2.29460479e-04, 1.77948269e-04, -8.64611089e-05, -1.65404549e-06,
+	5.82273042e-05, -7.53595974e-05, 6.15742093e-05, -3.31943906e-05,
+	5.68654535e-06, 1.17273982e-05, -1.71924810e-05, 1.40862241e-05,
+	-7.61190077e-06, 1.95866078e-06, 9.98269479e-07, -1.47985635e-06,
+	-1.97399442e-06, 4.96275489e-06, -7.59378495e-06, 7.02040985e-06,
+	-3.58716802e-07, -1.31998523e-05, 3.03250199e-05, -4.29366682e-05,
+	4.02579754e-05, -1.37070785e-05, -3.68256522e-05, 9.82756172e-05,
+	-1.44703537e-04, 1.44755521e-04, -7.54577206e-05, -6.22195823e-05,
+	2.33367340e-04, -3.72044293e-04, 4.00640840e-04, -2.62334143e-04,
+	-4.43766245e-05, 4.44874020e-04, -7.95891956e-04, 9.27114162e-04,
+	-7.08642748e-04, 1.21570425e-04, 6.99324795e-04, -1.47809974e-03,
+	1.87565271e-03, -1.61718255e-03, 6.26960723e-04, 8.85938261e-04,
+	-2.44041186e-03, 3.41401676e-03, -3.26537048e-03, 1.77700602e-03,
+	7.77717979e-04, -3.63023998e-03, 5.71344649e-03, -6.02355175e-03,
+	4.03632898e-03, -2.16311458e-05, -4.89093291e-03, 8.97258963e-03,
+	-1.04458301e-02, 8.16744858e-03, -2.20546820e-03, -5.93251367e-03,
+	1.35736724e-02, -1.76495157e-02, 1.57678780e-02, -7.25104073e-03,
+	-6.23937001e-03, 2.07834238e-02, -3.10810428e-02, 3.19603028e-02,
+	-2.01198821e-02, -4.40361327e-03, 3.74879397e-02, -7.10627242e-02,
+	9.37023041e-02, -8.94803991e-02, 2.04561526e-02, 7.74944449e-01,
+	3.57900237e-01, -1.74846851e-01, 8.39606185e-02, -1.99904455e-02,
+	-2.21450303e-02, 4.27842147e-02, -4.43489910e-02, 3.21423535e-02,
+	-1.32452581e-02, -5.26915215e-03, 1.80342855e-02, -2.24618520e-02,
+	1.89253102e-02, -1.00989754e-02, -2.50540871e-04, 8.59223013e-03,
+	-1.26662574e-02, 1.19587544e-02, -7.55714016e-03, 1.52855436e-03,
+	3.90696890e-03, -7.11270453e-03, 7.45952953e-03, -5.35252379e-03,
+	1.91729881e-03, 1.49421066e-03, -3.78537952e-03, 4.42713104e-03,
+	-3.52689201e-03, 1.67446633e-03, 3.43544373e-04, -1.84106697e-03,
+	2.43955210e-03, -2.13198700e-03, 1.20983957e-03, -1.04574580e-04,
+	-7.85342721e-04, 1.22007184e-03, -1.16358714e-03, 7.50006860e-04,
+	-1.99687358e-04, -2.74918081e-04, 5.38798140e-04, -5.60885047e-04,
+	3.98439623e-04, -1.54916783e-04, -6.73848227e-05, 2.01903600e-04,
+	-2.30687636e-04, 1.76714801e-04, -8.39648190e-05, -4.19292501e-06,
+	5.99872938e-05, -7.60648053e-05, 6.14002986e-05, -3.25457964e-05,
+	4.96964358e-06, 1.22494383e-05, -1.74372824e-05, 1.41069998e-05,
+	-7.51824145e-06, 1.84817103e-06, 1.07374179e-06, -1.51332759e-06,
+	-2.00665616e-06, 4.96576979e-06, -7.50999695e-06, 6.80115693e-06,
+	-1.11502254e-08, -1.35695124e-05, 3.05052529e-05, -4.26694984e-05,
+	3.93653929e-05, -1.22471341e-05, -3.84488188e-05, 9.93353386e-05,
+	-1.44362577e-04, 1.42443179e-04, -7.12893690e-05, -6.71790514e-05,
+	2.37197367e-04, -3.72521156e-04, 3.96160897e-04, -2.52904470e-04,
+	-5.65271569e-05, 4.55487217e-04, -7.99866939e-04, 9.20479106e-04,
+	-6.90673588e-04, 9.61514657e-05, 7.23937115e-04, -1.49148377e-03,
+	1.86900858e-03, -1.58750615e-03, 5.79917352e-04, 9.36015717e-04,
+	-2.47415332e-03, 3.41367585e-03, -3.22249156e-03, 1.69816180e-03,
+	8.69945642e-04, -3.70255287e-03, 5.73268260e-03, -5.96995795e-03,
+	3.91444789e-03, 1.36075036e-04, -5.03072618e-03, 9.03592173e-03,
+	-1.03912228e-02, 7.99037373e-03, -1.94810657e-03, -6.18746773e-03,
+	1.37260610e-02, -1.76163500e-02, 1.55189667e-02, -6.83265793e-03,
+	-6.70384042e-03, 2.11208471e-02, -3.11201656e-02, 3.15953240e-02,
+	-1.93681589e-02, -5.36747445e-03, 3.83327641e-02, -7.13343899e-02,
+	9.28677808e-02, -8.69148048e-02, 1.51146163e-02, 7.72184963e-01,
+	3.64928222e-01, -1.75102561e-01, 8.26811848e-02, -1.84345473e-02,
+	-2.33881290e-02, 4.34544059e-02, -4.44243510e-02, 3.17682104e-02,
+	-1.26534841e-02, -5.84187197e-03, 1.84123385e-02, -2.25672248e-02,
+	1.87799763e-02, -9.79820423e-03, -5.81422583e-04, 8.84214622e-03,
+	-1.27703210e-02, 1.19102158e-02, -7.39904883e-03, 1.33118374e-03,
+	4.07338959e-03, -7.20047371e-03, 7.45478251e-03, -5.27364044e-03,
+	1.80315740e-03, 1.60053738e-03, -3.85135364e-03, 4.43935353e-03,
+	-3.49185634e-03, 1.61264975e-03, 4.07059468e-04, -1.88567671e-03,
+	2.45495656e-03, -2.11945212e-03, 1.17938009e-03, -6.98251285e-05,
+	-8.12372882e-04, 1.23257399e-03, -1.16101288e-03, 7.36805377e-04,
+	-1.82666003e-04, -2.89401269e-04, 5.46817050e-04, -5.61624828e-04,
+	3.93658837e-04, -1.47680808e-04, -7.40772278e-05, 2.06098558e-04,
+	-2.31826383e-04, 1.75406921e-04, -8.14268757e-05, -6.73873558e-06,
+	6.17295213e-05, -7.67421594e-05, 6.12010555e-05, -3.18814007e-05,
+	4.24753702e-06, 1.27690358e-05, -1.76762891e-05, 1.41221468e-05,
+	-7.42089671e-06, 1.73609969e-06, 1.14942806e-06, -1.54651272e-06,
+	-2.03814245e-06, 4.96669917e-06, -7.42369675e-06, 6.58044520e-06,
+	3.34552439e-07, -1.39318865e-05, 3.06724140e-05, -4.23863756e-05,
+	3.84606565e-05, -1.07878552e-05, -4.00507715e-05, 1.00351797e-04,
+	-1.43965213e-04, 1.40081401e-04, -6.71052587e-05, -7.20973569e-05,
+	2.40922325e-04, -3.72848642e-04, 3.91535234e-04, -2.43398171e-04,
+	-6.86254765e-05, 4.65894345e-04, -8.03515217e-04, 9.13493546e-04,
+	-6.72469440e-04, 7.07481799e-05, 7.48211478e-04, -1.50424926e-03,
+	1.86163619e-03, -1.55725699e-03, 5.32732013e-04, 9.85630454e-04,
+	-2.50685348e-03, 3.41198230e-03, -3.17840908e-03, 1.61877773e-03,
+	9.61675298e-04, -3.77328016e-03, 5.74961597e-03, -5.91408389e-03,
+	3.79120779e-03, 2.93481026e-04, -5.16830946e-03, 9.09557623e-03,
+	-1.03325834e-02, 7.81040762e-03, -1.69037376e-03, -6.43957028e-03,
+	1.38727700e-02, -1.75762615e-02, 1.52643256e-02, -6.41229343e-03,
+	-7.16481720e-03, 2.14492648e-02, -3.11468879e-02, 3.12186409e-02,
+	-1.86105945e-02, -6.32657121e-03, 3.91597318e-02, -7.15767931e-02,
+	9.20006947e-02, -8.43331626e-02, 9.83584255e-03, 7.69327526e-01,
+	3.71950909e-01, -1.75290833e-01, 8.13615732e-02, -1.68646828e-02,
+	-2.46262237e-02, 4.41093046e-02, -4.44822753e-02, 3.13806043e-02,
+	-1.20554456e-02, -6.41339597e-03, 1.87837861e-02, -2.26638310e-02,
+	1.86269458e-02, -9.49305047e-03, -9.12606553e-04, 9.08895022e-03,
+	-1.28694811e-02, 1.18568766e-02, -7.23777737e-03, 1.13297973e-03,
+	4.23845207e-03, -7.28552249e-03, 7.44706967e-03, -5.19253893e-03,
+	1.68811698e-03, 1.70640191e-03, -3.91590793e-03, 4.44983410e-03,
+	-3.45537429e-03, 1.55008506e-03, 4.70525840e-04, -1.92961848e-03,
+	2.46941438e-03, -2.10605136e-03, 1.14839274e-03, -3.49786802e-05,
+	-8.39135362e-04, 1.24461231e-03, -1.15797136e-03, 7.23281553e-04,
+	-1.65533140e-04, -3.03803317e-04, 5.54637704e-04, -5.62142803e-04,
+	3.88708873e-04, -1.40366630e-04, -8.07586336e-05, 2.10223355e-04,
+	-2.32876000e-04, 1.74024922e-04, -7.88481611e-05, -9.29047928e-06,
+	6.34532239e-05, -7.73912833e-05, 6.09764606e-05, -3.12014061e-05,
+	3.52049509e-06, 1.32859677e-05, -1.79093736e-05, 1.41316269e-05,
+	-7.31988374e-06, 1.62248279e-06, 1.22529702e-06, -1.57939289e-06,
+	-2.06845032e-06, 4.96555868e-06, -7.33493692e-06, 6.35837393e-06,
+	6.78260209e-07, -1.42868634e-05, 3.08264955e-05, -4.20874819e-05,
+	3.75441786e-05, -9.32982455e-06, -4.16309452e-05, 1.01324734e-04,
+	-1.43511788e-04, 1.37671286e-04, -6.29071064e-05, -7.69726578e-05,
+	2.44541026e-04, -3.73027023e-04, 3.86766073e-04, -2.33819224e-04,
+	-8.06668986e-05, 4.76091755e-04, -8.06836091e-04, 9.06161041e-04,
+	-6.54038046e-04, 4.53706255e-05, 7.72138938e-04, -1.51639241e-03,
+	1.85353989e-03, -1.52644817e-03, 4.85423694e-04, 1.03476363e-03,
+	-2.53850124e-03, 3.40893915e-03, -3.13314260e-03, 1.53888621e-03,
+	1.05287140e-03, -3.84239640e-03, 5.76424361e-03, -5.85595535e-03,
+	3.66665967e-03, 4.50524915e-04, -5.30363166e-03, 9.15153518e-03,
+	-1.02699413e-02, 7.62762597e-03, -1.43237239e-03, -6.68872595e-03,
+	1.40137504e-02, -1.75292771e-02, 1.50040653e-02, -5.99011692e-03,
+	-7.62212443e-03, 2.17685643e-02, -3.11612242e-02, 3.08304279e-02,
+	-1.78475015e-02, -7.28053978e-03, 3.99685758e-02, -7.17899522e-02,
+	9.11015403e-02, -8.17365429e-02, 4.62067283e-03, 7.66372816e-01,
+	3.78966783e-01, -1.75411002e-01, 8.00020575e-02, -1.52814027e-02,
+	-2.58588120e-02, 4.47486085e-02, -4.45226966e-02, 3.09796575e-02,
+	-1.14513658e-02, -6.98349564e-03, 1.91484689e-02, -2.27516170e-02,
+	1.84662662e-02, -9.18362784e-03, -1.24396197e-03, 9.33253933e-03,
+	-1.29636907e-02, 1.17987506e-02, -7.07338486e-03, 9.34019667e-04,
+	4.40208875e-03, -7.36781287e-03, 7.43638940e-03, -5.10924793e-03,
+	1.57222177e-03, 1.81176146e-03, -3.97901442e-03, 4.45856565e-03,
+	-3.41745791e-03, 1.48679580e-03, 5.33918179e-04, -1.97287358e-03,
+	2.48291806e-03, -2.09178841e-03, 1.11688881e-03, -4.89047773e-08,
+	-8.65618966e-04, 1.25618104e-03, -1.15446279e-03, 7.09440061e-04,
+	-1.48295340e-04, -3.18118295e-04, 5.62256504e-04, -5.62438213e-04,
+	3.83591268e-04, -1.32976961e-04, -8.74263406e-05, 2.14276141e-04,
+	-2.33835803e-04, 1.72569127e-04, -7.62295769e-05, -1.18471525e-05,
+	6.51576434e-05, -7.80118106e-05, 6.07265047e-05, -3.05060221e-05,
+	2.78879045e-06, 1.38000111e-05, -1.81364099e-05, 1.41354041e-05,
+	-7.21522137e-06, 1.50735725e-06, 1.30131701e-06, -1.61194921e-06,
+	-2.09757738e-06, 4.96236472e-06, -7.24377072e-06, 6.13504242e-06,
+	1.01984362e-06, -1.46343356e-05, 3.09674946e-05, -4.17730050e-05,
+	3.66163747e-05, -7.87362227e-06, -4.31887857e-05, 1.02253911e-04,
+	-1.43002669e-04, 1.35213947e-04, -5.86966295e-05, -8.18031352e-05,
+	2.48052323e-04, -3.73056633e-04, 3.81855686e-04, -2.24171624e-04,
+	-9.26467728e-05, 4.86075889e-04, -8.09828995e-04, 8.98485282e-04,
+	-6.35387224e-04, 2.00288286e-05, 7.95710709e-04, -1.52790963e-03,
+	1.84472432e-03, -1.49509300e-03, 4.38011403e-04, 1.08339664e-03,
+	-2.56908591e-03, 3.40454998e-03, -3.08671210e-03, 1.45851978e-03,
+	1.14349867e-03, -3.90987683e-03, 5.77656343e-03, -5.79559896e-03,
+	3.54085495e-03, 6.07145030e-04, -5.43664266e-03, 9.20378212e-03,
+	-1.02033275e-02, 7.44210556e-03, -1.17420507e-03, -6.93484075e-03,
+	1.41489555e-02, -1.74754266e-02, 1.47382979e-02, -5.56629849e-03,
+	-8.07558794e-03, 2.20786369e-02, -3.11631940e-02, 3.04308634e-02,
+	-1.70791936e-02, -8.22901936e-03, 4.07590371e-02, -7.19738968e-02,
+	9.01708216e-02, -7.91260140e-02, -5.30071513e-04, 7.63321532e-01,
+	3.85974326e-01, -1.75462420e-01, 7.86029275e-02, -1.36852653e-02,
+	-2.70853916e-02, 4.53720205e-02, -4.45455542e-02, 3.05654978e-02,
+	-1.08414709e-02, -7.55194258e-03, 1.95062301e-02, -2.28305325e-02,
+	1.82979882e-02, -8.87005195e-03, -1.57535775e-03, 9.57281188e-03,
+	-1.30529048e-02, 1.17358534e-02, -6.90593169e-03, 7.34381337e-04,
+	4.56423246e-03, -7.44730790e-03, 7.42274128e-03, -5.02379703e-03,
+	1.45551643e-03, 1.91657336e-03, -4.04064564e-03, 4.46554179e-03,
+	-3.37811979e-03, 1.42280587e-03, 5.97211160e-04, -2.01542360e-03,
+	2.49546046e-03, -2.07666730e-03, 1.08487983e-03, 3.49504678e-05,
+	-8.91812584e-04, 1.26727458e-03, -1.15048756e-03, 6.95285708e-04,
+	-1.30959232e-04, -3.32340293e-04, 5.69669924e-04, -5.62510382e-04,
+	3.78307632e-04, -1.25514548e-04, -9.40776474e-05, 2.18255089e-04,
+	-2.34705139e-04, 1.71039890e-04, -7.35720434e-05, -1.44077461e-05,
+	6.68420268e-05, -7.86033851e-05, 6.04511887e-05, -2.97954656e-05,
+	2.05269881e-06, 1.43109432e-05, -1.83572740e-05, 1.41334445e-05,
+	-7.10693008e-06, 1.39076092e-06, 1.37745608e-06, -1.64416278e-06,
+	-2.12552178e-06, 4.95713449e-06, -7.15025206e-06, 5.91054988e-06,
+	1.35917475e-06, -1.49741991e-05, 3.10954143e-05, -4.14431380e-05,
+	3.56776630e-05, -6.41982551e-06, -4.47237496e-05, 1.03139107e-04,
+	-1.42438241e-04, 1.32710515e-04, -5.44755451e-05, -8.65869936e-05,
+	2.51455120e-04, -3.72937860e-04, 3.76806397e-04, -2.14459383e-04,
+	-1.04560484e-04, 4.95843283e-04, -8.12493496e-04, 8.90470088e-04,
+	-6.16524863e-04, -5.26722001e-06, 8.18918162e-04, -1.53879761e-03,
+	1.83519439e-03, -1.46320496e-03, 3.90514148e-04, 1.13151108e-03,
+	-2.59859727e-03, 3.39881888e-03, -3.03913801e-03, 1.37771113e-03,
+	1.23352212e-03, -3.97569737e-03, 5.78657427e-03, -5.73304219e-03,
+	3.41384547e-03, 7.63279964e-04, -5.56729335e-03, 9.25230208e-03,
+	-1.01327744e-02, 7.25392409e-03, -9.15974278e-04, -7.17782200e-03,
+	1.42783410e-02, -1.74147427e-02, 1.44671379e-02, -5.14100860e-03,
+	-8.52503542e-03, 2.23793775e-02, -3.11528218e-02, 3.00201300e-02,
+	-1.63059862e-02, -9.17165228e-03, 4.15308646e-02, -7.21286676e-02,
+	8.92090520e-02, -7.65026419e-02, -5.61558920e-03, 7.60174394e-01,
+	3.92972018e-01, -1.75444454e-01, 7.71644894e-02, -1.20768359e-02,
+	-2.83054612e-02, 4.59792489e-02, -4.45507941e-02, 3.01382583e-02,
+	-1.02259898e-02, -8.11850860e-03, 1.98569152e-02, -2.29005305e-02,
+	1.81221655e-02, -8.55244024e-03, -1.90666256e-03, 9.80966734e-03,
+	-1.31370801e-02, 1.16682025e-02, -6.73547955e-03, 5.34142903e-04,
+	4.72481656e-03, -7.52397166e-03, 7.40612607e-03, -4.93621674e-03,
+	1.33804599e-03, 2.02079510e-03, -4.10077468e-03, 4.47075678e-03,
+	-3.33737313e-03, 1.35813947e-03, 6.60379453e-04, -2.05725032e-03,
+	2.50703481e-03, -2.06069242e-03, 1.05237755e-03, 7.00056525e-05,
+	-9.17705203e-04, 1.27788753e-03, -1.14604624e-03, 6.80823440e-04,
+	-1.13531498e-04, -3.46463426e-04, 5.76874512e-04, -5.62358725e-04,
+	3.72859645e-04, -1.17982179e-04, -1.00709851e-04, 2.22158397e-04,
+	-2.35483392e-04, 1.69437596e-04, -7.08764996e-05, -1.69712461e-05,
+	6.85056266e-05, -7.91656610e-05, 6.01505241e-05, -2.90699604e-05,
+	1.31249894e-06, 1.48185413e-05, -1.85718437e-05, 1.41257164e-05,
+	-6.99503202e-06, 1.27273254e-06, 1.45368194e-06, -1.67601464e-06,
+	-2.15228222e-06, 4.94988595e-06, -7.05443552e-06, 5.68499543e-06,
+	1.69612732e-06, -1.53063534e-05, 3.12102624e-05, -4.10980797e-05,
+	3.47284648e-05, -4.96900825e-06, -4.62353048e-05, 1.03980118e-04,
+	-1.41818912e-04, 1.30162135e-04, -5.02455694e-05, -9.13224616e-05,
+	2.54748365e-04, -3.72671155e-04, 3.71620581e-04, -2.04686529e-04,
+	-1.16403456e-04, 5.05390569e-04, -8.14829291e-04, 8.82119404e-04,
+	-5.97458916e-04, -3.05075688e-05, 8.41752831e-04, -1.54905329e-03,
+	1.82495528e-03, -1.43079773e-03, 3.42950939e-04, 1.17908883e-03,
+	-2.62702554e-03, 3.39175049e-03, -2.99044116e-03, 1.29649303e-03,
+	1.32290705e-03, -4.03983463e-03, 5.79427588e-03, -5.66831335e-03,
+	3.28568348e-03, 9.18868599e-04, -5.69553561e-03, 9.29708161e-03,
+	-1.00583162e-02, 7.06316022e-03, -6.57782388e-04, -7.41757841e-03,
+	1.44018650e-02, -1.73472604e-02, 1.41907016e-02, -4.71441799e-03,
+	-8.97029644e-03, 2.26706851e-02, -3.11301365e-02, 2.95984142e-02,
+	-1.55281956e-02, -1.01080841e-02, 4.22838151e-02, -7.22543161e-02,
+	8.82167538e-02, -7.38674899e-02, -1.06350993e-02, 7.56932148e-01,
+	3.99958339e-01, -1.75356487e-01, 7.56870650e-02, -1.04566870e-02,
+	-2.95185202e-02, 4.65700072e-02, -4.45383691e-02, 2.96980777e-02,
+	-9.60515420e-03, -8.68296580e-03, 2.02003722e-02, -2.29615676e-02,
+	1.79388551e-02, -8.23091194e-03, -2.23774493e-03, 1.00430064e-02,
+	-1.32161754e-02, 1.15958173e-02, -6.56209143e-03, 3.33382889e-04,
+	4.88377489e-03, -7.59776931e-03, 7.38654570e-03, -4.84653845e-03,
+	1.21985587e-03, 2.12438434e-03, -4.15937518e-03, 4.47420561e-03,
+	-3.29523173e-03, 1.29282112e-03, 7.23397731e-04, -2.09833582e-03,
+	2.51763472e-03, -2.04386851e-03, 1.01939393e-03, 1.05102815e-04,
+	-9.43285904e-04, 1.28801466e-03, -1.14113961e-03, 6.66058334e-04,
+	-9.60188716e-05, -3.60481834e-04, 5.83866889e-04, -5.61982744e-04,
+	3.67249056e-04, -1.10382672e-04, -1.07320251e-04, 2.25984288e-04,
+	-2.36169978e-04, 1.67762660e-04, -6.81439030e-05, -1.95366340e-05,
+	7.01477008e-05, -7.96983029e-05, 5.98245324e-05, -2.83297374e-05,
+	5.68472485e-07, 1.53225831e-05, -1.87799988e-05, 1.41121904e-05,
+	-6.87955098e-06, 1.15331176e-06, 1.52996202e-06, -1.70748585e-06,
+	-2.17785797e-06, 4.94063776e-06, -6.95637628e-06, 5.45847808e-06,
+	2.03057665e-06, -1.56307018e-05, 3.13120524e-05, -4.07380338e-05,
+	3.37692036e-05, -3.52174112e-06, -4.77229304e-05, 1.04776761e-04,
+	-1.41145110e-04, 1.27569966e-04, -4.60084169e-05, -9.60077917e-05,
+	2.57931053e-04, -3.72257024e-04, 3.66300658e-04, -1.94857104e-04,
+	-1.28171151e-04, 5.14714473e-04, -8.16836210e-04, 8.73437299e-04,
+	-5.78197403e-04, -5.56823095e-05, 8.64206419e-04, -1.55867387e-03,
+	1.81401245e-03, -1.39788517e-03, 2.95340775e-04, 1.22611198e-03,
+	-2.65436137e-03, 3.38334995e-03, -2.94064280e-03, 1.21489840e-03,
+	1.41161909e-03, -4.10226594e-03, 5.79966894e-03, -5.60144156e-03,
+	3.15642158e-03, 1.07385013e-03, -5.82132236e-03, 9.33810873e-03,
+	-9.97998842e-03, 6.86989350e-03, -3.99731585e-04, -7.65402012e-03,
+	1.45194879e-02, -1.72730174e-02, 1.39091071e-02, -4.28669762e-03,
+	-9.41120253e-03, 2.29524626e-02, -3.10951722e-02, 2.91659064e-02,
+	-1.47461390e-02, -1.10379639e-02, 4.30176535e-02, -7.23509049e-02,
+	8.71944583e-02, -7.12216185e-02, -1.55878412e-02, 7.53595558e-01,
+	4.06931767e-01, -1.75197920e-01, 7.41709924e-02, -8.82539806e-03,
+	-3.07240688e-02, 4.71440149e-02, -4.45082389e-02, 2.92451002e-02,
+	-8.97919825e-03, -9.24508668e-03, 2.05364518e-02, -2.30136038e-02,
+	1.77481167e-02, -7.90558802e-03, -2.56847323e-03, 1.02727309e-02,
+	-1.32901513e-02, 1.15187194e-02, -6.38583158e-03, 1.32180146e-04,
+	5.04104185e-03, -7.66866711e-03, 7.36400328e-03, -4.75479442e-03,
+	1.10099184e-03, 2.22729890e-03, -4.21642133e-03, 4.47588394e-03,
+	-3.25170993e-03, 1.22687564e-03, 7.86240683e-04, -2.13866242e-03,
+	2.52725417e-03, -2.02620064e-03, 9.85941170e-04, 1.40228075e-04,
+	-9.68543873e-04, 1.29765091e-03, -1.13576861e-03, 6.50995601e-04,
+	-7.84281369e-05, -3.74389683e-04, 5.90643756e-04, -5.61382028e-04,
+	3.61477687e-04, -1.02718884e-04, -1.13906144e-04, 2.29731010e-04,
+	-2.36764351e-04, 1.66015527e-04, -6.53752287e-05, -2.21028869e-05,
+	7.17675137e-05, -8.02009864e-05, 5.94732455e-05, -2.75750342e-05,
+	-1.79096111e-07, 1.58228467e-05, -1.89816212e-05, 1.40928393e-05,
+	-6.76051243e-06, 1.03253909e-06, 1.60626343e-06, -1.73855746e-06,
+	-2.20224885e-06, 4.92940935e-06, -6.85613010e-06, 5.23109661e-06,
+	2.36239979e-06, -1.59471512e-05, 3.14008028e-05, -4.03632096e-05,
+	3.28003053e-05, -2.07859116e-06, -4.91861171e-05, 1.05528869e-04,
+	-1.40417284e-04, 1.24935180e-04, -4.17657998e-05, -1.00641262e-04,
+	2.61002225e-04, -3.71696031e-04, 3.60849097e-04, -1.84975164e-04,
+	-1.39859072e-04, 5.23811817e-04, -8.18514211e-04, 8.64427966e-04,
+	-5.58748402e-04, -8.07815810e-05, 8.86270792e-04, -1.56765680e-03,
+	1.80237162e-03, -1.36448131e-03, 2.47702638e-04, 1.27256288e-03,
+	-2.68059587e-03, 3.37362294e-03, -2.88976457e-03, 1.13296023e-03,
+	1.49962416e-03, -4.16296933e-03, 5.80275502e-03, -5.53245673e-03,
+	3.02611274e-03, 1.22816408e-03, -5.94460758e-03, 9.37537299e-03,
+	-9.89782796e-03, 6.67420434e-03, -1.41923840e-04, -7.88705872e-03,
+	1.46311725e-02, -1.71920542e-02, 1.36224745e-02, -3.85801861e-03,
+	-9.84758724e-03, 2.32246166e-02, -3.10479676e-02, 2.87228009e-02,
+	-1.39601349e-02, -1.19609440e-02, 4.37321530e-02, -7.24185076e-02,
+	8.61427055e-02, -6.85660849e-02, -2.04730750e-02, 7.50165414e-01,
+	4.13890779e-01, -1.74968171e-01, 7.26166255e-02, -7.18355499e-03,
+	-3.19216087e-02, 4.77009970e-02, -4.44603698e-02, 2.87794752e-02,
+	-8.34835868e-03, -9.80464420e-03, 2.08650073e-02, -2.30566026e-02,
+	1.75500135e-02, -7.57659118e-03, -2.89871579e-03, 1.04987441e-02,
+	-1.33589705e-02, 1.14369318e-02, -6.20676548e-03, -6.93861765e-05,
+	5.19655242e-03, -7.73663238e-03, 7.33850312e-03, -4.66101781e-03,
+	9.81500015e-04, 2.32949683e-03, -4.27188792e-03, 4.47578813e-03,
+	-3.20682267e-03, 1.16032813e-03, 8.48883022e-04, -2.17821272e-03,
+	2.53588751e-03, -2.00769423e-03, 9.52031654e-04, 1.75367517e-04,
+	-9.93468399e-04, 1.30679143e-03, -1.12993438e-03, 6.35640581e-04,
+	-6.07661236e-05, -3.88181173e-04, 5.97201889e-04, -5.60556256e-04,
+	3.55547424e-04, -9.49937016e-05, -1.20464834e-04, 2.33396840e-04,
+	-2.37265997e-04, 1.64196673e-04, -6.25714697e-05, -2.46689783e-05,
+	7.33643358e-05, -8.06733977e-05, 5.90967057e-05, -2.68060956e-05,
+	-9.29919694e-07, 1.63191107e-05, -1.91765948e-05, 1.40676380e-05,
+	-6.63794347e-06, 9.10455902e-07, 1.68255301e-06, -1.76921050e-06,
+	-2.22545522e-06, 4.91622085e-06, -6.75375332e-06, 5.00294964e-06,
+	2.69147550e-06, -1.62556122e-05, 3.14765374e-05, -3.99738211e-05,
+	3.18221983e-05, -6.40121581e-07, -5.06243673e-05, 1.06236295e-04,
+	-1.39635903e-04, 1.22258965e-04, -3.75194273e-05, -1.05221176e-04,
+	2.63960971e-04, -3.70988797e-04, 3.55268412e-04, -1.75044773e-04,
+	-1.51462766e-04, 5.32679523e-04, -8.19863387e-04, 8.55095719e-04,
+	-5.39120049e-04, -1.05795573e-04, 9.07937991e-04, -1.57599981e-03,
+	1.79003878e-03, -1.33060035e-03, 2.00055488e-04, 1.31842416e-03,
+	-2.70572061e-03, 3.36257565e-03, -2.83782853e-03, 1.05071160e-03,
+	1.58688854e-03, -4.22192357e-03, 5.80353663e-03, -5.46138957e-03,
+	2.89481026e-03, 1.38175034e-03, -6.06534629e-03, 9.40886544e-03,
+	-9.81187332e-03, 6.47617401e-03, 1.15539128e-04, -8.11660729e-03,
+	1.47368841e-02, -1.71044137e-02, 1.33309255e-02, -3.42855216e-03,
+	-1.02792862e-02, 2.34870580e-02, -3.09885660e-02, 2.82692956e-02,
+	-1.31705022e-02, -1.28766805e-02, 4.44270949e-02, -7.24572084e-02,
+	8.50620436e-02, -6.59019428e-02, -2.52900817e-02, 7.46642525e-01,
+	4.20833853e-01, -1.74666674e-01, 7.10243342e-02, -5.53175032e-03,
+	-3.31106427e-02, 4.82406842e-02, -4.43947352e-02, 2.83013575e-02,
+	-7.71287463e-03, -1.03614119e-02, 2.11858945e-02, -2.30905309e-02,
+	1.73446113e-02, -7.24404574e-03, -3.22834089e-03, 1.07209505e-02,
+	-1.34225977e-02, 1.13504798e-02, -6.02495984e-03, -2.71236662e-04,
+	5.35024216e-03, -7.80163359e-03, 7.31005069e-03, -4.56524263e-03,
+	8.61426830e-04, 2.43093637e-03, -4.32575031e-03, 4.47391524e-03,
+	-3.16058545e-03, 1.09320400e-03, 9.11299497e-04, -2.21696958e-03,
+	2.54352948e-03, -1.98835507e-03, 9.17677985e-04, 2.10507189e-04,
+	-1.01804889e-03, 1.31543153e-03, -1.12363825e-03, 6.19998743e-04,
+	-4.30397057e-05, -4.01850534e-04, 6.03538145e-04, -5.59505197e-04,
+	3.49460224e-04, -8.72100462e-05, -1.26993624e-04, 2.36980080e-04,
+	-2.37674441e-04, 1.62306604e-04, -5.97336363e-05, -2.72338782e-05,
+	7.49374445e-05, -8.11152342e-05, 5.86949657e-05, -2.60231730e-05,
+	-1.68370852e-06, 1.68111544e-05, -1.93648057e-05, 1.40365641e-05,
+	-6.51187286e-06, 7.87104432e-07, 1.75879736e-06, -1.79942604e-06,
+	-2.24747798e-06, 4.90109308e-06, -6.64930278e-06, 4.77413550e-06,
+	3.01768432e-06, -1.65559990e-05, 3.15392852e-05, -3.95700877e-05,
+	3.08353126e-05, 7.93108419e-07, -5.20371950e-05, 1.06898911e-04,
+	-1.38801455e-04, 1.19542519e-04, -3.32710050e-05, -1.09745864e-04,
+	2.66806428e-04, -3.70135999e-04, 3.49561163e-04, -1.65070006e-04,
+	-1.62977823e-04, 5.41314610e-04, -8.20883961e-04, 8.45444990e-04,
+	-5.19320534e-04, -1.30714530e-04, 9.29200232e-04, -1.58370087e-03,
+	1.77702019e-03, -1.29625666e-03, 1.52418250e-04, 1.36367870e-03,
+	-2.72972761e-03, 3.35021476e-03, -2.78485709e-03, 9.68185656e-04,
+	1.67337887e-03, -4.27910813e-03, 5.80201718e-03, -5.38827157e-03,
+	2.76256774e-03, 1.53454918e-03, -6.18349459e-03, 9.43857864e-03,
+	-9.72216441e-03, 6.27588456e-03, 3.72555895e-04, -8.34258042e-03,
+	1.48365904e-02, -1.70101414e-02, 1.30345838e-02, -2.99846947e-03,
+	-1.07061372e-02, 2.37397016e-02, -3.09170157e-02, 2.78055921e-02,
+	-1.23775608e-02, -1.37848333e-02, 4.51022686e-02, -7.24671022e-02,
+	8.39530291e-02, -6.32302417e-02, -3.00381629e-02, 7.43027722e-01,
+	4.27759465e-01, -1.74292883e-01, 6.93945042e-02, -3.87058285e-03,
+	-3.42906754e-02, 4.87628134e-02, -4.43113153e-02, 2.78109070e-02,
+	-7.07298757e-03, -1.09151640e-02, 2.14989723e-02, -2.31153593e-02,
+	1.71319791e-02, -6.90807766e-03, -3.55721686e-03, 1.09392559e-02,
+	-1.34809995e-02, 1.12593904e-02, -5.84048253e-03, -4.73291658e-04,
+	5.50204726e-03, -7.86364031e-03, 7.27865265e-03, -4.46750372e-03,
+	7.40819029e-04, 2.53157600e-03, -4.37798446e-03, 4.47026304e-03,
+	-3.11301434e-03, 1.02552892e-03, 9.73464902e-04, -2.25491616e-03,
+	2.55017522e-03, -1.96818925e-03, 8.82892964e-04, 2.45633112e-04,
+	-1.04227485e-03, 1.32356674e-03, -1.11688173e-03, 6.04075681e-04,
+	-2.52557984e-05, -4.15392033e-04, 6.09649462e-04, -5.58228708e-04,
+	3.43218113e-04, -7.93708690e-05, -1.33489824e-04, 2.40479062e-04,
+	-2.37989242e-04, 1.60345856e-04, -5.68627557e-05, -2.97965536e-05,
+	7.64861238e-05, -8.15262045e-05, 5.82680885e-05, -2.52265244e-05,
+	-2.44017037e-06, 1.72987575e-05, -1.95461422e-05, 1.39995971e-05,
+	-6.38233103e-06, 6.62527755e-07, 1.83496279e-06, -1.82918516e-06,
+	-2.26831855e-06, 4.88404755e-06, -6.54283586e-06, 4.54475222e-06,
+	3.34090862e-06, -1.68482296e-05, 3.15890803e-05, -3.91522333e-05,
+	2.98400803e-05, 2.22054388e-06, -5.34241263e-05, 1.07516605e-04,
+	-1.37914448e-04, 1.16787055e-04, -2.90222342e-05, -1.14213683e-04,
+	2.69537779e-04, -3.69138372e-04, 3.43729953e-04, -1.55054944e-04,
+	-1.74399880e-04, 5.49714197e-04, -8.21576284e-04, 8.35480329e-04,
+	-4.99358095e-04, -1.55528754e-04, 9.50049905e-04, -1.59075821e-03,
+	1.76332236e-03, -1.26146474e-03, 1.04809811e-04, 1.40830964e-03,
+	-2.75260935e-03, 3.33654750e-03, -2.73087304e-03, 8.85415587e-04,
+	1.75906214e-03, -4.33450325e-03, 5.79820098e-03, -5.31313499e-03,
+	2.62943909e-03, 1.68650128e-03, -6.29900970e-03, 9.46450666e-03,
+	-9.62874257e-03, 6.07341881e-03, 6.29025373e-04, -8.56489425e-03,
+	1.49302614e-02, -1.69092855e-02, 1.27335745e-02, -2.56794170e-03,
+	-1.11279803e-02, 2.39824660e-02, -3.08333693e-02, 2.73318957e-02,
+	-1.15816307e-02, -1.46850661e-02, 4.57574720e-02, -7.24482948e-02,
+	8.28162265e-02, -6.05520273e-02, -3.47166413e-02, 7.39321857e-01,
+	4.34666094e-01, -1.73846267e-01, 6.77275371e-02, -2.20065747e-03,
+	-3.54612130e-02, 4.92671275e-02, -4.42100972e-02, 2.73082891e-02,
+	-6.42894123e-03, -1.14656754e-02, 2.18041022e-02, -2.31310619e-02,
+	1.69121888e-02, -6.56881444e-03, -3.88521211e-03, 1.11535675e-02,
+	-1.35341445e-02, 1.11636926e-02, -5.65340263e-03, -6.75471311e-04,
+	5.65190455e-03, -7.92262328e-03, 7.24431683e-03, -4.36783677e-03,
+	6.19723644e-04, 2.63137446e-03, -4.42856692e-03, 4.46482998e-03,
+	-3.06412595e-03, 9.57328807e-04, 1.03535408e-03, -2.29203591e-03,
+	2.55582022e-03, -1.94720324e-03, 8.47689589e-04, 2.80731286e-04,
+	-1.06613593e-03, 1.33119275e-03, -1.10966653e-03, 5.87877115e-04,
+	-7.42135562e-06, -4.28799973e-04, 6.15532859e-04, -5.56726735e-04,
+	3.36823182e-04, -7.14791520e-05, -1.39950750e-04, 2.43892145e-04,
+	-2.38209995e-04, 1.58314996e-04, -5.39598717e-05, -3.23559690e-05,
+	7.80096656e-05, -8.19060286e-05, 5.78161477e-05, -2.44164146e-05,
+	-3.19901063e-06, 1.77817007e-05, -1.97204948e-05, 1.39567190e-05,
+	-6.24935004e-06, 5.36769774e-07, 1.91101539e-06, -1.85846899e-06,
+	-2.28797890e-06, 4.86510645e-06, -6.43441038e-06, 4.31489750e-06,
+	3.66103261e-06, -1.71322259e-05, 3.16259619e-05, -3.87204868e-05,
+	2.88369349e-05, 3.64163426e-06, -5.47846996e-05, 1.08089286e-04,
+	-1.36975411e-04, 1.13993795e-04, -2.47748110e-05, -1.18623017e-04,
+	2.72154257e-04, -3.67996706e-04, 3.37777428e-04, -1.45003674e-04,
+	-1.85724622e-04, 5.57875505e-04, -8.21940838e-04, 8.25206398e-04,
+	-4.79241021e-04, -1.80228611e-04, 9.70479583e-04, -1.59717032e-03,
+	1.74895206e-03, -1.22623928e-03, 5.72490120e-05, 1.45230043e-03,
+	-2.77435877e-03, 3.32158158e-03, -2.67589954e-03, 8.02434637e-04,
+	1.84390571e-03, -4.38808989e-03, 5.79209325e-03, -5.23601283e-03,
+	2.49547846e-03, 1.83754774e-03, -6.41184992e-03, 9.48664507e-03,
+	-9.53165052e-03, 5.86886032e-03, 8.84846845e-04, -8.78346649e-03,
+	1.50178698e-02, -1.68018966e-02, 1.24280247e-02, -2.13713990e-03,
+	-1.15446576e-02, 2.42152741e-02, -3.07376845e-02, 2.68484151e-02,
+	-1.07830328e-02, -1.55770467e-02, 4.63925114e-02, -7.24009023e-02,
+	8.16522076e-02, -5.78683405e-02, -3.93248610e-02, 7.35525803e-01,
+	4.41552218e-01, -1.73326314e-01, 6.60238500e-02, -5.22584970e-04,
+	-3.66217639e-02, 4.97533755e-02, -4.40910750e-02, 2.67936742e-02,
+	-5.78098147e-03, -1.20127218e-02, 2.21011487e-02, -2.31376163e-02,
+	1.66853154e-02, -6.22638511e-03, -4.21219519e-03, 1.13637942e-02,
+	-1.35820034e-02, 1.10634171e-02, -5.46379031e-03, -8.77695590e-04,
+	5.79975154e-03, -7.97855437e-03, 7.20705226e-03, -4.26627830e-03,
+	4.98187973e-04, 2.73029076e-03, -4.47747490e-03, 4.45761524e-03,
+	-3.01393747e-03, 8.88629860e-04, 1.09694196e-03, -2.32831258e-03,
+	2.56046040e-03, -1.92540382e-03, 8.12081051e-04, 3.15787691e-04,
+	-1.08962188e-03, 1.33830547e-03, -1.10199452e-03, 5.71408888e-04,
+	1.04566328e-05, -4.42068698e-04, 6.21185442e-04, -5.54999316e-04,
+	3.30277589e-04, -6.35379057e-05, -1.46373722e-04, 2.47217719e-04,
+	-2.38336332e-04, 1.56214620e-04, -5.10260441e-05, -3.49110866e-05,
+	7.95073689e-05, -8.22544381e-05, 5.73392272e-05, -2.35931150e-05,
+	-3.95993244e-06, 1.82597656e-05, -1.98877564e-05, 1.39079142e-05,
+	-6.11296361e-06, 4.09875206e-07, 1.98692102e-06, -1.88725867e-06,
+	-2.30646153e-06, 4.84429263e-06, -6.32408464e-06, 4.08466866e-06,
+	3.97794239e-06, -1.74079132e-05, 3.16499743e-05, -3.82750817e-05,
+	2.78263116e-05, 5.05583371e-06, -5.61184652e-05, 1.08616880e-04,
+	-1.35984890e-04, 1.11163974e-04, -2.05304259e-05, -1.22972279e-04,
+	2.74655143e-04, -3.66711845e-04, 3.31706277e-04, -1.34920288e-04,
+	-1.96947782e-04, 5.65795854e-04, -8.21978236e-04, 8.14627975e-04,
+	-4.58977641e-04, -2.04804531e-04, 9.90482019e-04, -1.60293596e-03,
+	1.73391632e-03, -1.19059508e-03, 9.75463809e-06, 1.49563477e-03,
+	-2.79496926e-03, 3.30532522e-03, -2.61996010e-03, 7.19276070e-04,
+	1.92787732e-03, -4.43984977e-03, 5.78370010e-03, -5.15693881e-03,
+	2.36074026e-03, 1.98763010e-03, -6.52197469e-03, 9.50499096e-03,
+	-9.43093240e-03, 5.66229335e-03, 1.13992001e-03, -8.99821650e-03,
+	1.50993904e-02, -1.66880278e-02, 1.21180626e-02, -1.70623493e-03,
+	-1.19560137e-02, 2.44380528e-02, -3.06300234e-02, 2.63553623e-02,
+	-9.98208793e-03, -1.64604468e-02, 4.70072013e-02, -7.23250516e-02,
+	8.04615522e-02, -5.51802175e-02, -4.38621871e-02, 7.31640455e-01,
+	4.48416318e-01, -1.72732530e-01, 6.42838761e-02, 1.16301818e-03,
+	-3.77718384e-02, 5.02213129e-02, -4.39542498e-02, 2.62672378e-02,
+	-5.12935622e-03, -1.25560801e-02, 2.23899791e-02, -2.31350037e-02,
+	1.64514368e-02, -5.88092017e-03, -4.53803484e-03, 1.15698460e-02,
+	-1.36245491e-02, 1.09585967e-02, -5.27171689e-03, -1.07988433e-03,
+	5.94552645e-03, -8.03140662e-03, 7.16686912e-03, -4.16286562e-03,
+	3.76259566e-04, 2.82828417e-03, -4.52468620e-03, 4.44861871e-03,
+	-2.96246660e-03, 8.19458505e-04, 1.15820351e-03, -2.36373022e-03,
+	2.56409205e-03, -1.90279812e-03, 7.76080725e-04, 3.50788300e-04,
+	-1.11272260e-03, 1.34490098e-03, -1.09386779e-03, 5.54676962e-04,
+	2.83711437e-05, -4.55192594e-04, 6.26604398e-04, -5.53046577e-04,
+	3.23583558e-04, -5.55501686e-05, -1.52756071e-04, 2.50454206e-04,
+	-2.38367923e-04, 1.54045353e-04, -4.80623490e-05, -3.74608671e-05,
+	8.09785410e-05, -8.25711760e-05, 5.68374213e-05, -2.27569034e-05,
+	-4.72263677e-06, 1.87327346e-05, -2.00478221e-05, 1.38531694e-05,
+	-5.97320708e-06, 2.81889571e-07, 2.06264531e-06, -1.91553543e-06,
+	-2.32376943e-06, 4.82162956e-06, -6.21191733e-06, 3.85416261e-06,
+	4.29152600e-06, -1.76752208e-05, 3.16611668e-05, -3.78162560e-05,
+	2.68086467e-05, 6.46260118e-06, -5.74249860e-05, 1.09099331e-04,
+	-1.34943451e-04, 1.08298838e-04, -1.62907633e-05, -1.27259909e-04,
+	2.77039763e-04, -3.65284690e-04, 3.25519225e-04, -1.24808881e-04,
+	-2.08065146e-04, 5.73472668e-04, -8.21689218e-04, 8.03749947e-04,
+	-4.38576324e-04, -2.29247016e-04, 1.01005015e-03, -1.60805414e-03,
+	1.71822241e-03, -1.15454710e-03, -3.76545859e-05, 1.53829668e-03,
+	-2.81443470e-03, 3.28778713e-03, -2.56307857e-03, 6.35973169e-04,
+	2.01094514e-03, -4.48976534e-03, 5.77302856e-03, -5.07594740e-03,
+	2.22527912e-03, 2.13669041e-03, -6.62934458e-03, 9.51954291e-03,
+	-9.32663370e-03, 5.45380283e-03, 1.39414502e-03, -9.20906522e-03,
+	1.51748008e-02, -1.65677346e-02, 1.18038183e-02, -1.27539738e-03,
+	-1.23618957e-02, 2.46507330e-02, -3.05104525e-02, 2.58529528e-02,
+	-9.17911716e-03, -1.73349425e-02, 4.76013650e-02, -7.22208799e-02,
+	7.92448469e-02, -5.24886893e-02, -4.83280063e-02, 7.27666726e-01,
+	4.55256875e-01, -1.72064441e-01, 6.25080637e-02, 2.85553000e-03,
+	-3.89109493e-02, 5.06707015e-02, -4.37996294e-02, 2.57291605e-02,
+	-4.47431539e-03, -1.30955279e-02, 2.26704638e-02, -2.31232090e-02,
+	1.62106335e-02, -5.53255152e-03, -4.86260004e-03, 1.17716346e-02,
+	-1.36617562e-02, 1.08492658e-02, -5.07725477e-03, -1.28195724e-03,
+	6.08916822e-03, -8.08115427e-03, 7.12377879e-03, -4.05763686e-03,
+	2.53986206e-04, 2.92531428e-03, -4.57017927e-03, 4.43784095e-03,
+	-2.90973162e-03, 7.49841406e-04, 1.21911383e-03, -2.39827319e-03,
+	2.56671186e-03, -1.87939360e-03, 7.39702171e-04, 3.85719078e-04,
+	-1.13542812e-03, 1.35097559e-03, -1.08528859e-03, 5.37687417e-04,
+	4.63151236e-05, -4.68166092e-04, 6.31787004e-04, -5.50868737e-04,
+	3.16743378e-04, -4.75190059e-05, -1.59095135e-04, 2.53600056e-04,
+	-2.38304474e-04, 1.51807852e-04, -4.50698775e-05, -4.00042695e-05,
+	8.24224972e-05, -8.28559976e-05, 5.63108349e-05, -2.19080639e-05,
+	-5.48682256e-06, 1.92003912e-05, -2.02005898e-05, 1.37924737e-05,
+	-5.83011745e-06, 1.52859173e-07, 2.13815373e-06, -1.94328053e-06,
+	-2.33990613e-06, 4.79714135e-06, -6.09796756e-06, 3.62347581e-06,
+	4.60167343e-06, -1.79340818e-05, 3.16595938e-05, -3.73442520e-05,
+	2.57843777e-05, 7.86140071e-06, -5.87038376e-05, 1.09536602e-04,
+	-1.33851678e-04, 1.05399643e-04, -1.20575003e-05, -1.31484379e-04,
+	2.79307495e-04, -3.63716195e-04, 3.19219040e-04, -1.14673546e-04,
+	-2.19072551e-04, 5.80903474e-04, -8.21074652e-04, 7.92577309e-04,
+	-4.18045479e-04, -2.53546638e-04, 1.02917711e-03, -1.61252413e-03,
+	1.70187785e-03, -1.11811041e-03, -8.49600044e-05, 1.58027045e-03,
+	-2.83274941e-03, 3.26897653e-03, -2.50527913e-03, 5.52559214e-04,
+	2.09307773e-03, -4.53781985e-03, 5.76008653e-03, -4.99307375e-03,
+	2.08914987e-03, 2.28467119e-03, -6.73392134e-03, 9.53030104e-03,
+	-9.21880127e-03, 5.24347431e-03, 1.64742250e-03, -9.41593531e-03,
+	1.52440807e-02, -1.64410751e-02, 1.14854234e-02, -8.44797536e-04,
+	-1.27621528e-02, 2.48532500e-02, -3.03790433e-02, 2.53414050e-02,
+	-8.37444161e-03, -1.82002143e-02, 4.81748339e-02, -7.20885346e-02,
+	7.80026853e-02, -4.97947813e-02, -5.27217266e-02, 7.23605552e-01,
+	4.62072373e-01, -1.71321590e-01, 6.06968771e-02, 4.55432325e-03,
+	-4.00386119e-02, 5.11013096e-02, -4.36272291e-02, 2.51796279e-02,
+	-3.81611074e-03, -1.36308440e-02, 2.29424763e-02, -2.31022205e-02,
+	1.59629893e-02, -5.18141244e-03, -5.18576005e-03, 1.19690733e-02,
+	-1.36936017e-02, 1.07354608e-02, -4.88047738e-03, -1.48383398e-03,
+	6.23061654e-03, -8.12777273e-03, 7.07779381e-03, -3.95063090e-03,
+	1.31415889e-04, 3.02134100e-03, -4.61393320e-03, 4.42528327e-03,
+	-2.85575131e-03, 6.79805450e-04, 1.27964806e-03, -2.43192618e-03,
+	2.56831691e-03, -1.85519806e-03, 7.02959124e-04, 4.20565990e-04,
+	-1.15772857e-03, 1.35652579e-03, -1.07625936e-03, 5.20446451e-04,
+	6.42814909e-05, -4.80983671e-04, 6.36730623e-04, -5.48466103e-04,
+	3.09759402e-04, -3.94475081e-05, -1.65388263e-04, 2.56653753e-04,
+	-2.38145726e-04, 1.49502800e-04, -4.20497361e-05, -4.25402521e-05,
+	8.38385616e-05, -8.31086698e-05, 5.57595832e-05, -2.10468871e-05,
+	-6.25218683e-06, 1.96625202e-05, -2.03459594e-05, 1.37258187e-05,
+	-5.68373335e-06, 2.28310898e-08, 2.21341154e-06, -1.97047532e-06,
+	-2.35487565e-06, 4.77085273e-06, -5.98229480e-06, 3.39270422e-06,
+	4.90827668e-06, -1.81844328e-05, 3.16453145e-05, -3.68593166e-05,
+	2.47539429e-05, 9.25170157e-06, -5.99546078e-05, 1.09928674e-04,
+	-1.32710173e-04, 1.02467653e-04, -7.83230645e-06, -1.35644187e-04,
+	2.81457764e-04, -3.62007368e-04, 3.12808527e-04, -1.04518378e-04,
+	-2.29965888e-04, 5.88085903e-04, -8.20135534e-04, 7.81115162e-04,
+	-3.97393544e-04, -2.77694049e-04, 1.04785620e-03, -1.61634547e-03,
+	1.68489043e-03, -1.08130023e-03, -1.32143038e-04, 1.62154070e-03,
+	-2.84990819e-03, 3.24890310e-03, -2.44658631e-03, 4.69067475e-04,
+	2.17424407e-03, -4.58399727e-03, 5.74488281e-03, -4.90835372e-03,
+	1.95240753e-03, 2.43151547e-03, -6.83566785e-03, 9.53726693e-03,
+	-9.10748327e-03, 5.03139393e-03, 1.89965364e-03, -9.61875110e-03,
+	1.53072126e-02, -1.63081098e-02, 1.11630106e-02, -4.14605294e-04,
+	-1.31566371e-02, 2.50455428e-02, -3.02358713e-02, 2.48209407e-02,
+	-7.56838229e-03, -1.90559470e-02, 4.87274482e-02, -7.19281734e-02,
+	7.67356679e-02, -4.70995136e-02, -5.70427777e-02, 7.19457886e-01,
+	4.68861300e-01, -1.70503539e-01, 5.88507959e-02, 6.25876562e-03,
+	-4.11543444e-02, 5.15129122e-02, -4.34370707e-02, 2.46188304e-02,
+	-3.15499584e-03, -1.41618085e-02, 2.32058931e-02, -2.30720302e-02,
+	1.57085907e-02, -4.82763753e-03, -5.50738451e-03, 1.21620768e-02,
+	-1.37200645e-02, 1.06172199e-02, -4.68145923e-03, -1.68543413e-03,
+	6.36981187e-03, -8.17123862e-03, 7.02892788e-03, -3.84188742e-03,
+	8.59680601e-06, 3.11632456e-03, -4.65592776e-03, 4.41094768e-03,
+	-2.80054499e-03, 6.09377738e-04, 1.33978150e-03, -2.46467421e-03,
+	2.56890469e-03, -1.83021962e-03, 6.65865491e-04, 4.55315006e-04,
+	-1.17961428e-03, 1.36154827e-03, -1.06678273e-03, 5.02960374e-04,
+	8.22631394e-05, -4.93639856e-04, 6.41432708e-04, -5.45839073e-04,
+	3.02634047e-04, -3.13387904e-05, -1.71632814e-04, 2.59613812e-04,
+	-2.37891462e-04, 1.47130912e-04, -3.90030457e-05, -4.50677727e-05,
+	8.52260669e-05, -8.33289717e-05, 5.51837918e-05, -2.01736696e-05,
+	-7.01842476e-06, 2.01189075e-05, -2.04838338e-05, 1.36531983e-05,
+	-5.53409500e-06, -1.08146847e-07, 2.28838383e-06, -1.99710124e-06,
+	-2.36868252e-06, 4.74278901e-06, -5.86495882e-06, 3.16194327e-06,
+	5.21122980e-06, -1.84262146e-05, 3.16183930e-05, -3.63617006e-05,
+	2.37177813e-05, 1.06329785e-05, -6.11768976e-05, 1.10275547e-04,
+	-1.31519558e-04, 9.95041428e-05, -3.61684317e-06, -1.39737865e-04,
+	2.83490043e-04, -3.60159270e-04, 3.06290527e-04, -9.43474671e-05,
+	-2.40741104e-04, 5.95017690e-04, -8.18872989e-04, 7.69368710e-04,
+	-3.76628990e-04, -3.01679978e-04, 1.06608094e-03, -1.61951793e-03,
+	1.66726813e-03, -1.04413188e-03, -1.79185190e-04, 1.66209234e-03,
+	-2.86590631e-03, 3.22757704e-03, -2.38702490e-03, 3.85531195e-04,
+	2.25441359e-03, -4.62828239e-03, 5.72742708e-03, -4.82182383e-03,
+	1.81510724e-03, 2.57716684e-03, -6.93454818e-03, 9.54044369e-03,
+	-8.99272919e-03, 4.81764842e-03, 2.15074017e-03, -9.81743865e-03,
+	1.53641811e-02, -1.61689016e-02, 1.08367142e-02, 1.50099068e-05,
+	-1.35452027e-02, 2.52275549e-02, -3.00810170e-02, 2.42917846e-02,
+	-6.76125998e-03, -1.99018300e-02, 4.92590566e-02, -7.17399643e-02,
+	7.54444015e-02, -4.44038998e-02, -6.12906111e-02, 7.15224704e-01,
+	4.75622145e-01, -1.69609868e-01, 5.69703149e-02, 7.96821993e-03,
+	-4.22576676e-02, 5.19052910e-02, -4.32291833e-02, 2.40469635e-02,
+	-2.49122590e-03, -1.46882026e-02, 2.34605939e-02, -2.30326340e-02,
+	1.54475269e-02, -4.47136264e-03, -5.82734343e-03, 1.23505616e-02,
+	-1.37411258e-02, 1.04945831e-02, -4.48027579e-03, -1.88667728e-03,
+	6.50669550e-03, -8.21152979e-03, 6.97719589e-03, -3.73144682e-03,
+	-1.14422677e-04, 3.21022554e-03, -4.69614335e-03, 4.39483688e-03,
+	-2.74413251e-03, 5.38585573e-04, 1.39948953e-03, -2.49650261e-03,
+	2.56847308e-03, -1.80446673e-03, 6.28435345e-04, 4.89952109e-04,
+	-1.20107569e-03, 1.36603993e-03, -1.05686151e-03, 4.85235609e-04,
+	1.00252940e-04, -5.06129227e-04, 6.45890800e-04, -5.42988137e-04,
+	2.95369793e-04, -2.31959907e-05, -1.77826160e-04, 2.62478784e-04,
+	-2.37541498e-04, 1.44692931e-04, -3.59309417e-05, -4.75857889e-05,
+	8.65843552e-05, -8.35166948e-05, 5.45835968e-05, -1.92887142e-05,
+	-7.78522987e-06, 2.05693404e-05, -2.06141181e-05, 1.35746090e-05,
+	-5.38124428e-06, -2.40026063e-07, 2.36303553e-06, -2.02313979e-06,
+	-2.38133177e-06, 4.71297609e-06, -5.74601976e-06, 2.93128783e-06,
+	5.51042889e-06, -1.86593714e-05, 3.15788984e-05, -3.58516590e-05,
+	2.26763326e-05, 1.20047118e-05, -6.23703208e-05, 1.10577238e-04,
+	-1.30280469e-04, 9.65103961e-05, 5.87237218e-07, -1.43763973e-04,
+	2.85403855e-04, -3.58173017e-04, 2.99667916e-04, -8.41649019e-05,
+	-2.51394203e-04, 6.01696675e-04, -8.17288265e-04, 7.57343262e-04,
+	-3.55760313e-04, -3.25495241e-04, 1.08384502e-03, -1.62204157e-03,
+	1.64901920e-03, -1.00662080e-03, -2.26068056e-04, 1.70191059e-03,
+	-2.88073950e-03, 3.20500901e-03, -2.32662004e-03, 3.01983579e-04,
+	2.33355615e-03, -4.67066073e-03, 5.70772989e-03, -4.73352127e-03,
+	1.67730432e-03, 2.72156943e-03, -7.03052761e-03, 9.53983592e-03,
+	-8.87458978e-03, 4.60232500e-03, 2.40058443e-03, -1.00119258e-02,
+	1.54149737e-02, -1.60235156e-02, 1.05066698e-02, 4.43879143e-04,
+	-1.39277069e-02, 2.53992338e-02, -2.99145650e-02, 2.37541643e-02,
+	-5.95339513e-03, -2.07375574e-02, 4.97695165e-02, -7.15240852e-02,
+	7.41294991e-02, -4.17089473e-02, -6.54646999e-02, 7.10906999e-01,
+	4.82353401e-01, -1.68640178e-01, 5.50559444e-02, 9.68204437e-03,
+	-4.33481058e-02, 5.22782347e-02, -4.30036030e-02, 2.34642273e-02,
+	-1.82505776e-03, -1.52098091e-02, 2.37064618e-02, -2.29840309e-02,
+	1.51798900e-02, -4.11272485e-03, -6.14550726e-03, 1.25344458e-02,
+	-1.37567687e-02, 1.03675922e-02, -4.27700353e-03, -2.08748303e-03,
+	6.64120951e-03, -8.24862530e-03, 6.92261386e-03, -3.61935027e-03,
+	-2.37594035e-04, 3.30300491e-03, -4.73456108e-03, 4.37695430e-03,
+	-2.68653423e-03, 4.67456452e-04, 1.45874767e-03, -2.52739708e-03,
+	2.56702037e-03, -1.77794817e-03, 5.90682922e-04, 5.24463298e-04,
+	-1.22210339e-03, 1.36999786e-03, -1.04649871e-03, 4.67278688e-04,
+	1.18243746e-04, -5.18446416e-04, 6.50102536e-04, -5.39913874e-04,
+	2.87969180e-04, -1.50222694e-05, -1.83965686e-04, 2.65247252e-04,
+	-2.37095692e-04, 1.42189629e-04, -3.28345732e-05, -5.00932587e-05,
+	8.79127780e-05, -8.36716429e-05, 5.39591448e-05, -1.83923298e-05,
+	-8.55229408e-06, 2.10136076e-05, -2.07367203e-05, 1.34900495e-05,
+	-5.22522464e-06, -3.72757261e-07, 2.43733144e-06, -2.04857259e-06,
+	-2.39282890e-06, 4.68144044e-06, -5.62553799e-06, 2.70083216e-06,
+	5.80577215e-06, -1.88838515e-05, 3.15269043e-05, -3.53294507e-05,
+	2.16300368e-05, 1.33663876e-05, -6.35345040e-05, 1.10833784e-04,
+	-1.28993563e-04, 9.34877036e-05, 4.77829189e-06, -1.47721103e-04,
+	2.87198769e-04, -3.56049773e-04, 2.92943606e-04, -7.39747637e-05,
+	-2.61921248e-04, 6.08120805e-04, -8.15382736e-04, 7.45044222e-04,
+	-3.34796031e-04, -3.49130740e-04, 1.10114235e-03, -1.62391669e-03,
+	1.63015213e-03, -9.68782546e-04, -2.72773328e-04, 1.74098099e-03,
+	-2.89440396e-03, 3.18121013e-03, -2.26539715e-03, 2.18457782e-04,
+	2.41164208e-03, -4.71111863e-03, 5.68580268e-03, -4.64348387e-03,
+	1.53905417e-03, 2.86466798e-03, -7.12357261e-03, 9.53544970e-03,
+	-8.75311707e-03, 4.38551140e-03, 2.64908942e-03, -1.02021420e-02,
+	1.54595799e-02, -1.58720194e-02, 1.01730143e-02, 8.71834080e-04,
+	-1.43040093e-02, 2.55605312e-02, -2.97366043e-02, 2.32083104e-02,
+	-5.14510770e-03, -2.15628281e-02, 5.02586938e-02, -7.12807240e-02,
+	7.27915800e-02, -3.90156570e-02, -6.95645392e-02, 7.06505783e-01,
+	4.89053566e-01, -1.67594090e-01, 5.31082097e-02, 1.13995927e-02,
+	-4.44251864e-02, 5.26315387e-02, -4.27603728e-02, 2.28708268e-02,
+	-1.15674972e-03, -1.57264121e-02, 2.39433828e-02, -2.29262240e-02,
+	1.49057748e-02, -3.75186240e-03, -6.46174699e-03, 1.27136492e-02,
+	-1.37669786e-02, 1.02362909e-02, -4.07171986e-03, -2.28777102e-03,
+	6.77329686e-03, -8.28250544e-03, 6.86519900e-03, -3.50563964e-03,
+	-3.60868607e-04, 3.39462398e-03, -4.77116273e-03, 4.35730407e-03,
+	-2.62777099e-03, 3.96018051e-04, 1.51753157e-03, -2.55734363e-03,
+	2.56454525e-03, -1.75067303e-03, 5.52622611e-04, 5.58834593e-04,
+	-1.24268813e-03, 1.37341939e-03, -1.03569749e-03, 4.49096249e-04,
+	1.36228391e-04, -5.30586113e-04, 6.54065640e-04, -5.36616955e-04,
+	2.80434812e-04, -6.82080721e-06, -1.90048791e-04, 2.67917832e-04,
+	-2.36553937e-04, 1.39621807e-04, -2.97151029e-05, -5.25891407e-05,
+	8.92106964e-05, -8.37936322e-05, 5.33105925e-05, -1.74848310e-05,
+	-9.31930786e-06, 2.14514994e-05, -2.08515510e-05, 1.33995213e-05,
+	-5.06608117e-06, -5.06290435e-07, 2.51123624e-06, -2.07338137e-06,
+	-2.40317991e-06, 4.64820906e-06, -5.50357416e-06, 2.47066988e-06,
+	6.09715992e-06, -1.90996068e-05, 3.14624895e-05, -3.47953384e-05,
+	2.05793340e-05, 1.47174983e-05, -6.46690871e-05, 1.11045236e-04,
+	-1.27659511e-04, 9.04373640e-05, 8.95468822e-06, -1.51607880e-04,
+	2.88874407e-04, -3.53790757e-04, 2.86120541e-04, -6.37811267e-05,
+	-2.72318359e-04, 6.14288131e-04, -8.13157902e-04, 7.32477092e-04,
+	-3.13744684e-04, -3.72577468e-04, 1.11796701e-03, -1.62514387e-03,
+	1.61067561e-03, -9.30632759e-04, -3.19282803e-04, 1.77928942e-03,
+	-2.90689638e-03, 3.15619202e-03, -2.20338190e-03, 1.34986891e-04,
+	2.48864217e-03, -4.74964318e-03, 5.66165773e-03, -4.55175008e-03,
+	1.40041230e-03, 3.00640781e-03, -7.21365085e-03, 9.52729262e-03,
+	-8.62836433e-03, 4.16729580e-03, 2.89615879e-03, -1.03880188e-02,
+	1.54979920e-02, -1.57144830e-02, 9.83588562e-03, 1.29870703e-03,
+	-1.46739722e-02, 2.57114030e-02, -2.95472284e-02, 2.26544560e-02,
+	-4.33671705e-03, -2.23773460e-02, 5.07264631e-02, -7.10100783e-02,
+	7.14312686e-02, -3.63250228e-02, -7.35896460e-02, 7.02022089e-01,
+	4.95721141e-01, -1.66471241e-01, 5.11276514e-02, 1.31202145e-02,
+	-4.54884404e-02, 5.29650058e-02, -4.24995428e-02, 2.22669715e-02,
+	-4.86561472e-04, -1.62377974e-02, 2.41712466e-02, -2.28592199e-02,
+	1.46252789e-02, -3.38891463e-03, -6.77593414e-03, 1.28880934e-02,
+	-1.37717428e-02, 1.01007245e-02, -3.86450312e-03, -2.48746098e-03,
+	6.90290137e-03, -8.31315177e-03, 6.80496964e-03, -3.39035752e-03,
+	-4.84197612e-04, 3.48504451e-03, -4.80593075e-03, 4.33589104e-03,
+	-2.56786416e-03, 3.24298219e-04, 1.57581703e-03, -2.58632866e-03,
+	2.56104680e-03, -1.72265072e-03, 5.14268955e-04, 5.93052043e-04,
+	-1.26282083e-03, 1.37630203e-03, -1.02446122e-03, 4.30695036e-04,
+	1.54199697e-04, -5.42543063e-04, 6.57777935e-04, -5.33098141e-04,
+	2.72769351e-04, 1.40519541e-06, -1.96072891e-04, 2.70489179e-04,
+	-2.35916165e-04, 1.36990293e-04, -2.65737064e-05, -5.50723949e-05,
+	9.04774816e-05, -8.38824916e-05, 5.26381073e-05, -1.65665385e-05,
+	-1.00859604e-05, 2.18828076e-05, -2.09585236e-05, 1.33030281e-05,
+	-4.90386051e-06, -6.40574888e-07, 2.58471449e-06, -2.09754799e-06,
+	-2.41239126e-06, 4.61330950e-06, -5.38018913e-06, 2.24089396e-06,
+	6.38449471e-06, -1.93065931e-05, 3.13857370e-05, -3.42495886e-05,
+	1.95246644e-05, 1.60575420e-05, -6.57737231e-05, 1.11211667e-04,
+	-1.26279004e-04, 8.73606828e-05, 1.31148044e-05, -1.55422958e-04,
+	2.90430436e-04, -3.51397237e-04, 2.79201695e-04, -5.35880564e-05,
+	-2.82581722e-04, 6.20196814e-04, -8.10615387e-04, 7.19647470e-04,
+	-2.92614826e-04, -3.95826511e-04, 1.13431332e-03, -1.62572390e-03,
+	1.59059858e-03, -8.92187180e-04, -3.65578390e-04, 1.81682207e-03,
+	-2.91821390e-03, 3.12996675e-03, -2.14060028e-03, 5.16039190e-05,
+	2.56452770e-03, -4.78622228e-03, 5.63530820e-03, -4.45835898e-03,
+	1.26143428e-03, 3.14673487e-03, -7.30073126e-03, 9.51537373e-03,
+	-8.50038604e-03, 3.94776681e-03, 3.14169693e-03, -1.05694893e-02,
+	1.55302047e-02, -1.55509784e-02, 9.49542295e-03, 1.72433102e-03,
+	-1.50374607e-02, 2.58518092e-02, -2.93465350e-02, 2.20928370e-02,
+	-3.52854184e-03, -2.31808196e-02, 5.11727078e-02, -7.07123556e-02,
+	7.00491954e-02, -3.36380313e-02, -7.75395594e-02, 6.97456966e-01,
+	5.02354632e-01, -1.65271292e-01, 4.91148248e-02, 1.48432554e-02,
+	-4.65374024e-02, 5.32784455e-02, -4.22211702e-02, 2.16528757e-02,
+	1.85245982e-04, -1.67437521e-02, 2.43899461e-02, -2.27830287e-02,
+	1.43385026e-02, -3.02402194e-03, -7.08794084e-03, 1.30577015e-02,
+	-1.37710510e-02, 9.96094018e-03, -3.65543251e-03, -2.68647277e-03,
+	7.02996776e-03, -8.34054708e-03, 6.74194529e-03, -3.27354718e-03,
+	-6.07532169e-04, 3.57422863e-03, -4.83884832e-03, 4.31272076e-03,
+	-2.50683559e-03, 2.52324965e-04, 1.63358001e-03, -2.61433890e-03,
+	2.55652453e-03, -1.69389098e-03, 4.75636639e-04, 6.27101732e-04,
+	-1.28249254e-03, 1.37864350e-03, -1.01279343e-03, 4.12081894e-04,
+	1.72150475e-04, -5.54312076e-04, 6.61237335e-04, -5.29358283e-04,
+	2.64975518e-04, 9.65251972e-06, -2.02035416e-04, 2.72959981e-04,
+	-2.35182347e-04, 1.34295944e-04, -2.34115718e-05, -5.75419828e-05,
+	9.17125154e-05, -8.39380628e-05, 5.19418667e-05, -1.56377783e-05,
+	-1.08519395e-05, 2.23073259e-05, -2.10575542e-05, 1.32005762e-05,
+	-4.73861091e-06, -7.75559250e-07, 2.65773064e-06, -2.12105443e-06,
+	-2.42046988e-06, 4.57676982e-06, -5.25544398e-06, 2.01159663e-06,
+	6.66768120e-06, -1.95047700e-05, 3.12967347e-05, -3.36924713e-05,
+	1.84664680e-05, 1.73860236e-05, -6.68480784e-05, 1.11333166e-04,
+	-1.24852745e-04, 8.42589720e-05, 1.72570300e-05, -1.59165026e-04,
+	2.91866572e-04, -3.48870532e-04, 2.72190075e-04, -4.33996074e-05,
+	-2.92707582e-04, 6.25845121e-04, -8.07756934e-04, 7.06561044e-04,
+	-2.71415023e-04, -4.18869054e-04, 1.15017575e-03, -1.62565788e-03,
+	1.56993019e-03, -8.53461638e-04, -4.11642117e-04, 1.85356548e-03,
+	-2.92835414e-03, 3.10254684e-03, -2.07707850e-03, -3.16582149e-05,
+	2.63927043e-03, -4.82084461e-03, 5.60676810e-03, -4.36335022e-03,
+	1.12217571e-03, 3.28559575e-03, -7.38478397e-03, 9.49970356e-03,
+	-8.36923787e-03, 3.72701340e-03, 3.38560899e-03, -1.07464887e-02,
+	1.55562150e-02, -1.53815800e-02, 9.15176655e-03, 2.14853986e-03,
+	-1.53943428e-02, 2.59817142e-02, -2.91346262e-02, 2.15236917e-02,
+	-2.72089986e-03, -2.39729630e-02, 5.15973198e-02, -7.03877729e-02,
+	6.86459958e-02, -3.09556617e-02, -8.14138403e-02, 6.92811483e-01,
+	5.08952550e-01, -1.63993922e-01, 4.70703003e-02, 1.65680572e-02,
+	-4.75716110e-02, 5.35716749e-02, -4.19253191e-02, 2.10287579e-02,
+	8.58410465e-04, -1.72440654e-02, 2.45993776e-02, -2.26976643e-02,
+	1.40455487e-02, -2.65732574e-03, -7.39763987e-03, 1.32223986e-02,
+	-1.37648948e-02, 9.81698681e-03, -3.44458811e-03, -2.88472636e-03,
+	7.15444167e-03, -8.36467544e-03, 6.67614656e-03, -3.15525258e-03,
+	-7.30823316e-04, 3.66213891e-03, -4.86989932e-03, 4.28779948e-03,
+	-2.44470761e-03, 1.80126447e-04, 1.69079661e-03, -2.64136145e-03,
+	2.55097834e-03, -1.66440384e-03, 4.36740489e-04, 6.60969780e-04,
+	-1.30169451e-03, 1.38044175e-03, -1.00069785e-03, 3.93263768e-04,
+	1.90073528e-04, -5.65888022e-04, 6.64441852e-04, -5.25398323e-04,
+	2.57056094e-04, 1.79179299e-05, -2.07933815e-04, 2.75328965e-04,
+	-2.34352491e-04, 1.31539645e-04, -2.02298996e-05, -5.99968677e-05,
+	9.29151899e-05, -8.39602004e-05, 5.12220585e-05, -1.46988825e-05,
+	-1.16169320e-05, 2.27248495e-05, -2.11485618e-05, 1.30921746e-05,
+	-4.57038216e-06, -9.11191496e-07, 2.73024909e-06, -2.14388280e-06,
+	-2.42742318e-06, 4.53861859e-06, -5.12939994e-06, 1.78286939e-06,
+	6.94662631e-06, -1.96941008e-05, 3.11955751e-05, -3.31242599e-05,
+	1.74051845e-05, 1.87024544e-05, -6.78918328e-05, 1.11409840e-04,
+	-1.23381458e-04, 8.11335494e-05, 2.13797668e-05, -1.62832806e-04,
+	2.93182581e-04, -3.46212011e-04, 2.65088715e-04, -3.32198226e-05,
+	-3.02692249e-04, 6.31231425e-04, -8.04584413e-04, 6.93223592e-04,
+	-2.50153852e-04, -4.41696383e-04, 1.16554902e-03, -1.62494712e-03,
+	1.54867981e-03, -8.14472042e-04, -4.57456137e-04, 1.88950650e-03,
+	-2.93731519e-03, 3.07394528e-03, -2.01284303e-03, -1.14766694e-04,
+	2.71284262e-03, -4.85349965e-03, 5.57605228e-03, -4.26676406e-03,
+	9.82692245e-04, 3.42293772e-03, -7.46578039e-03, 9.48029414e-03,
+	-8.23497667e-03, 3.50512491e-03, 3.62780089e-03, -1.09189537e-02,
+	1.55760225e-02, -1.52063645e-02, 8.80505771e-03, 2.57116821e-03,
+	-1.57444892e-02, 2.61010864e-02, -2.89116081e-02, 2.09472611e-02,
+	-1.91410797e-03, -2.47534951e-02, 5.20002000e-02, -7.00365566e-02,
+	6.72223100e-02, -2.82788855e-02, -8.52120721e-02, 6.88086725e-01,
+	5.15513413e-01, -1.62638828e-01, 4.49946629e-02, 1.82939581e-02,
+	-4.85906089e-02, 5.38445184e-02, -4.16120607e-02, 2.03948414e-02,
+	1.53266871e-03, -1.77385282e-02, 2.47994410e-02, -2.26031443e-02,
+	1.37465228e-02, -2.28896838e-03, -7.70490473e-03, 1.33821118e-02,
+	-1.37532683e-02, 9.66891503e-03, -3.23205083e-03, -3.08214192e-03,
+	7.27626969e-03, -8.38552218e-03, 6.60759522e-03, -3.03551833e-03,
+	-8.54022031e-04, 3.74873839e-03, -4.89906833e-03, 4.26113418e-03,
+	-2.38150304e-03, 1.07730963e-04, 1.74744314e-03, -2.66738379e-03,
+	2.54440855e-03, -1.63419967e-03, 3.97595463e-04, 6.94642356e-04,
+	-1.32041814e-03, 1.38169492e-03, -9.88178368e-04, 3.74247701e-04,
+	2.07961652e-04, -5.77265836e-04, 6.67389595e-04, -5.21219293e-04,
+	2.49013916e-04, 2.61981744e-05, -2.13765557e-04, 2.77594891e-04,
+	-2.33426645e-04, 1.28722308e-04, -1.70299017e-05, -6.24360157e-05,
+	9.40849082e-05, -8.39487717e-05, 5.04788809e-05, -1.37501881e-05,
+	-1.23806239e-05, 2.31351760e-05, -2.12314683e-05, 1.29778344e-05,
+	-4.39922564e-06, -1.04741896e-06, 2.80223415e-06, -2.16601538e-06,
+	-2.43325899e-06, 4.49888486e-06, -5.00211839e-06, 1.55480295e-06,
+	7.22123919e-06, -1.98745527e-05, 3.10823551e-05, -3.25452312e-05,
+	1.63412529e-05, 2.00063524e-05, -6.89046793e-05, 1.11441814e-04,
+	-1.21865877e-04, 7.79857384e-05, 2.54814290e-05, -1.66425053e-04,
+	2.94378278e-04, -3.43423090e-04, 2.57900680e-04, -2.30527309e-05,
+	-3.12532099e-04, 6.36354210e-04, -8.01099810e-04, 6.79640979e-04,
+	-2.28839895e-04, -4.64299887e-04, 1.18042803e-03, -1.62359322e-03,
+	1.52685701e-03, -7.75234375e-04, -5.03002738e-04, 1.92463235e-03,
+	-2.94509562e-03, 3.04417548e-03, -1.94792059e-03, -1.97688818e-04,
+	2.78521706e-03, -4.88417769e-03, 5.54317644e-03, -4.16864128e-03,
+	8.43039516e-04, 3.55870872e-03, -7.54369316e-03, 9.45715892e-03,
+	-8.09766043e-03, 3.28219097e-03, 3.86817940e-03, -1.10868234e-02,
+	1.55896292e-02, -1.50254107e-02, 8.45543869e-03, 2.99205163e-03,
+	-1.60877735e-02, 2.62098986e-02, -2.86775911e-02, 2.03637882e-02,
+	-1.10848191e-03, -2.55221402e-02, 5.23812576e-02, -6.96589429e-02,
+	6.57787833e-02, -2.56086660e-02, -8.89338602e-02, 6.83283798e-01,
+	5.22035741e-01, -1.61205732e-01, 4.28885122e-02, 2.00202934e-02,
+	-4.95939429e-02, 5.40968076e-02, -4.12814732e-02, 1.97513537e-02,
+	2.20775644e-03, -1.82269332e-02, 2.49900395e-02, -2.24994898e-02,
+	1.34415331e-02, -1.91909311e-03, -8.00960967e-03, 1.35367696e-02,
+	-1.37361673e-02, 9.51677717e-03, -3.01790236e-03, -3.27863983e-03,
+	7.39539937e-03, -8.40307392e-03, 6.53631418e-03, -2.91438968e-03,
+	-9.77079251e-04, 3.83399054e-03, -4.92634068e-03, 4.23273253e-03,
+	-2.31724514e-03, 3.51669346e-05, 1.80349608e-03, -2.69239377e-03,
+	2.53681587e-03, -1.60328910e-03, 3.58216648e-04, 7.28105675e-04,
+	-1.33865500e-03, 1.38240138e-03, -9.75239068e-04, 3.55040829e-04,
+	2.25807642e-04, -5.88440522e-04, 6.70078769e-04, -5.16822316e-04,
+	2.40851878e-04, 3.44899871e-05, -2.19528128e-04, 2.79756562e-04,
+	-2.32404896e-04, 1.25844873e-04, -1.38128014e-05, -6.48583955e-05,
+	9.52210846e-05, -8.39036573e-05, 4.97125423e-05, -1.27920379e-05,
+	-1.31427001e-05, 2.35381044e-05, -2.13061985e-05, 1.28575697e-05,
+	-4.22519424e-06, -1.18418837e-06, 2.87365009e-06, -2.18743459e-06,
+	-2.43798562e-06, 4.45759813e-06, -4.87366083e-06, 1.32748723e-06,
+	7.49143127e-06, -2.00460968e-05, 3.09571762e-05, -3.19556651e-05,
+	1.52751117e-05, 2.12972424e-05, -6.98863247e-05, 1.11429230e-04,
+	-1.20306758e-04, 7.48168667e-05, 2.95604442e-05, -1.69940555e-04,
+	2.95453524e-04, -3.40505236e-04, 2.50629057e-04, -1.29023461e-05,
+	-3.22223573e-04, 6.41212068e-04, -7.97305233e-04, 6.65819154e-04,
+	-2.07481736e-04, -4.86671063e-04, 1.19480790e-03, -1.62159800e-03,
+	1.50447160e-03, -7.35764690e-04, -5.48264344e-04, 1.95893059e-03,
+	-2.95169445e-03, 3.01325131e-03, -1.88233812e-03, -2.80392016e-04,
+	2.85636702e-03, -4.91286978e-03, 5.50815709e-03, -4.06902324e-03,
+	7.03273146e-04, 3.69285740e-03, -7.61849619e-03, 9.43031284e-03,
+	-7.95734827e-03, 3.05830152e-03, 4.10665214e-03, -1.12500383e-02,
+	1.55970397e-02, -1.48387994e-02, 8.10305264e-03, 3.41102665e-03,
+	-1.64240724e-02, 2.63081276e-02, -2.84326897e-02, 1.97735186e-02,
+	-3.04336237e-04, -2.62786281e-02, 5.27404111e-02, -6.92551767e-02,
+	6.43160652e-02, -2.29459582e-02, -9.25788320e-02, 6.78403822e-01,
+	5.28518065e-01, -1.59694372e-01, 4.07524624e-02, 2.17463948e-02,
+	-5.05811644e-02, 5.43283819e-02, -4.09336416e-02, 1.90985265e-02,
+	2.88340853e-03, -1.87090751e-02, 2.51710800e-02, -2.23867257e-02,
+	1.31306901e-02, -1.54784400e-03, -8.31162978e-03, 1.36863029e-02,
+	-1.37135902e-02, 9.36062726e-03, -2.80222517e-03, -3.47414071e-03,
+	7.51177927e-03, -8.41731856e-03, 6.46232744e-03, -2.79191251e-03,
+	-1.09994589e-03, 3.91785933e-03, -4.95170240e-03, 4.20260290e-03,
+	-2.25195765e-03, -3.75370961e-05, 1.85893208e-03, -2.71637961e-03,
+	2.52820144e-03, -1.57168310e-03, 3.18619255e-04, 7.61346011e-04,
+	-1.35639686e-03, 1.38255970e-03, -9.61884197e-04, 3.35650380e-04,
+	2.43604294e-04, -5.99407152e-04, 6.72507682e-04, -5.12208603e-04,
+	2.32572929e-04, 4.27900883e-05, -2.25219036e-04, 2.81812816e-04,
+	-2.31287367e-04, 1.22908307e-04, -1.05798329e-05, -6.72629792e-05,
+	9.63231450e-05, -8.38247509e-05, 4.89232612e-05, -1.18247798e-05,
+	-1.39028449e-05, 2.39334363e-05, -2.13726803e-05, 1.27313968e-05,
+	-4.04834241e-06, -1.32144583e-06, 2.94446115e-06, -2.20812305e-06,
+	-2.44161179e-06, 4.41478838e-06, -4.74408886e-06, 1.10101129e-06,
+	7.75711628e-06, -2.02087076e-05, 3.08201441e-05, -3.13558447e-05,
+	1.42071984e-05, 2.25746564e-05, -7.08364894e-05, 1.11372247e-04,
+	-1.18704865e-04, 7.16282666e-05, 3.36152538e-05, -1.73378136e-04,
+	2.96408232e-04, -3.37459960e-04, 2.43276961e-04, -2.77266495e-06,
+	-3.31763182e-04, 6.45803698e-04, -7.93202909e-04, 6.51764148e-04,
+	-1.86087958e-04, -5.08801518e-04, 1.20868394e-03, -1.61896356e-03,
+	1.48153356e-03, -6.96079098e-04, -5.93223527e-04, 1.99238912e-03,
+	-2.95711119e-03, 2.98118707e-03, -1.81612276e-03, -3.62843859e-04,
+	2.92626635e-03, -4.93956783e-03, 5.47101159e-03, -3.96795182e-03,
+	5.63448709e-04, 3.82533313e-03, -7.69016468e-03, 9.39977226e-03,
+	-7.81410040e-03, 2.83354670e-03, 4.34312762e-03, -1.14085412e-02,
+	1.55982607e-02, -1.46466136e-02, 7.74804361e-03, 3.82793084e-03,
+	-1.67532653e-02, 2.63957546e-02, -2.81770224e-02, 1.91766998e-02,
+	4.98015820e-04, -2.70226938e-02, 5.30775872e-02, -6.88255123e-02,
+	6.28348095e-02, -2.02917087e-02, -9.61466376e-02, 6.73447936e-01,
+	5.34958919e-01, -1.58104509e-01, 3.85871419e-02, 2.34715916e-02,
+	-5.15518294e-02, 5.45390880e-02, -4.05686582e-02, 1.84365960e-02,
+	3.55935902e-03, -1.91847508e-02, 2.53424730e-02, -2.22648804e-02,
+	1.28141070e-02, -1.17536592e-03, -8.61084096e-03, 1.38306441e-02,
+	-1.36855372e-02, 9.20052101e-03, -2.58510245e-03, -3.66856543e-03,
+	7.62535894e-03, -8.42824531e-03, 6.38566012e-03, -2.66813330e-03,
+	-1.22257285e-03, 4.00030919e-03, -4.97514027e-03, 4.17075436e-03,
+	-2.18566475e-03, -1.10352484e-04, 1.91372804e-03, -2.73932992e-03,
+	2.51856678e-03, -1.53939292e-03, 2.78818608e-04, 7.94349698e-04,
+	-1.37363563e-03, 1.38216868e-03, -9.48118183e-04, 3.16083671e-04,
+	2.61344406e-04, -6.10160870e-04, 6.74674737e-04, -5.07379456e-04,
+	2.24180071e-04, 5.10951868e-05, -2.30835811e-04, 2.83762530e-04,
+	-2.30074222e-04, 1.19913604e-04, -7.33224049e-06, -6.96487427e-05,
+	9.73905267e-05, -8.37119595e-05, 4.81112663e-05, -1.08487669e-05,
+	-1.46607421e-05, 2.43209751e-05, -2.14308444e-05, 1.25993346e-05,
+	-3.86872611e-06, -1.45913688e-06, 3.01463155e-06, -2.22806354e-06,
+	-2.44414666e-06, 4.37048600e-06, -4.61346410e-06, 8.75463307e-07,
+	8.01821026e-06, -2.03623639e-05, 3.06713690e-05, -3.07460559e-05,
+	1.31379495e-05, 2.38381337e-05, -7.17549073e-05, 1.11271043e-04,
+	-1.17060982e-04, 6.84212741e-05, 3.76443135e-05, -1.76736652e-04,
+	2.97242360e-04, -3.34288824e-04, 2.35847532e-04, 7.33233399e-06,
+	-3.41147505e-04, 6.50127910e-04, -7.88795180e-04, 6.37482073e-04,
+	-1.64667139e-04, -5.30682973e-04, 1.22205169e-03, -1.61569223e-03,
+	1.45805308e-03, -6.56193767e-04, -6.37863013e-04, 2.02499622e-03,
+	-2.96134582e-03, 2.94799749e-03, -1.74930187e-03, -4.45012074e-04,
+	2.99488940e-03, -4.96426450e-03, 5.43175810e-03, -3.86546940e-03,
+	4.23621720e-04, 3.95608603e-03, -7.75867509e-03, 9.36555499e-03,
+	-7.66797808e-03, 2.60801687e-03, 4.57751530e-03, -1.15622766e-02,
+	1.55933018e-02, -1.44489386e-02, 7.39055641e-03, 4.24260287e-03,
+	-1.70752350e-02, 2.64727649e-02, -2.79107118e-02, 1.85735812e-02,
+	1.29826248e-03, -2.77540780e-02, 5.33927217e-02, -6.83702131e-02,
+	6.13356738e-02, -1.76468551e-02, -9.96369490e-02, 6.68417294e-01,
+	5.41356848e-01, -1.56435923e-01, 3.63931934e-02, 2.51952102e-02,
+	-5.25054988e-02, 5.47287805e-02, -4.01866221e-02, 1.77658022e-02,
+	4.23534130e-03, -1.96537593e-02, 2.55041327e-02, -2.21339861e-02,
+	1.24918995e-02, -8.01804462e-04, -8.90712008e-03, 1.39697277e-02,
+	-1.36520110e-02, 9.03651577e-03, -2.36661811e-03, -3.86183520e-03,
+	7.73608896e-03, -8.43584465e-03, 6.30633845e-03, -2.54309915e-03,
+	-1.34491107e-03, 4.08130510e-03, -4.99664182e-03, 4.13719669e-03,
+	-2.11839108e-03, -1.83250489e-04, 1.96786105e-03, -2.76123372e-03,
+	2.50791385e-03, -1.50643011e-03, 2.38830144e-04, 8.27103139e-04,
+	-1.39036345e-03, 1.38122733e-03, -9.33945624e-04, 2.96348107e-04,
+	2.79020783e-04, -6.20696894e-04, 6.76578440e-04, -5.02336267e-04,
+	2.15676363e-04, 5.94019804e-05, -2.36376007e-04, 2.85604621e-04,
+	-2.28765663e-04, 1.16861782e-04, -4.07127849e-06, -7.20146659e-05,
+	9.84226793e-05, -8.35652033e-05, 4.72767963e-05, -9.86435707e-06,
+	-1.54160747e-05, 2.47005267e-05, -2.14806248e-05, 1.24614046e-05,
+	-3.68640279e-06, -1.59720651e-06, 3.08412549e-06, -2.24723902e-06,
+	-2.44559981e-06, 4.32472182e-06, -4.48184826e-06, 6.50930560e-07,
+	8.27463161e-06, -2.05070478e-05, 3.05109653e-05, -3.01265875e-05,
+	1.20678003e-05, 2.50872207e-05, -7.26413261e-05, 1.11125810e-04,
+	-1.15375905e-04, 6.51972280e-05, 4.16460943e-05, -1.80014996e-04,
+	2.97955917e-04, -3.30993431e-04, 2.28343930e-04, 1.74086922e-05,
+	-3.50373191e-04, 6.54183623e-04, -7.84084508e-04, 6.22979114e-04,
+	-1.43227850e-04, -5.52307265e-04, 1.23490690e-03, -1.61178659e-03,
+	1.43404057e-03, -6.16124914e-04, -6.82165685e-04, 2.05674050e-03,
+	-2.96439878e-03, 2.91369772e-03, -1.68190300e-03, -5.26864554e-04,
+	3.06221109e-03, -4.98695329e-03, 5.39041558e-03, -3.76161885e-03,
+	2.83847602e-04, 4.08506697e-03, -7.82400517e-03, 9.32768029e-03,
+	-7.51904365e-03, 2.38180257e-03, 4.80972560e-03, -1.17111913e-02,
+	1.55821746e-02, -1.42458613e-02, 7.03073660e-03, 4.65488255e-03,
+	-1.73898669e-02, 2.65391481e-02, -2.76338844e-02, 1.79644146e-02,
+	2.09609354e-03, -2.84725272e-02, 5.36857590e-02, -6.78895512e-02,
+	5.98193195e-02, -1.50123258e-02, -1.03049461e-01, 6.63313069e-01,
+	5.47710400e-01, -1.54688418e-01, 3.41712735e-02, 2.69165750e-02,
+	-5.34417383e-02, 5.48973216e-02, -3.97876392e-02, 1.70863894e-02,
+	4.91108817e-03, -2.01159016e-02, 2.56559768e-02, -2.19940784e-02,
+	1.21641856e-02, -4.27305890e-04, -9.20034492e-03, 1.41034904e-02,
+	-1.36130162e-02, 8.86867053e-03, -2.14685671e-03, -4.05387154e-03,
+	7.84392098e-03, -8.44010840e-03, 6.22438976e-03, -2.41685769e-03,
+	-1.46691151e-03, 4.16081251e-03, -5.01619531e-03, 4.10194036e-03,
+	-2.05016167e-03, -2.56202290e-04, 2.02130841e-03, -2.78208040e-03,
+	2.49624501e-03, -1.47280650e-03, 1.98669403e-04, 8.59592808e-04,
+	-1.40657261e-03, 1.37973487e-03, -9.19371291e-04, 2.76451174e-04,
+	2.96626239e-04, -6.31010517e-04, 6.78217400e-04, -4.97080515e-04,
+	2.07064912e-04, 6.77071573e-05, -2.41837199e-04, 2.87338048e-04,
+	-2.27361932e-04, 1.13753888e-04, -7.98210547e-07, -7.43597333e-05,
+	9.94190646e-05, -8.33844159e-05, 4.64200999e-05, -8.87191331e-06,
+	-1.61685258e-05, 2.50718993e-05, -2.15219585e-05, 1.23176310e-05,
+	-3.50143139e-06, -1.73559914e-06, 3.15290722e-06, -2.26563268e-06,
+	-2.44598124e-06, 4.27752706e-06, -4.34930302e-06, 4.27499383e-07,
+	8.52630106e-06, -2.06427455e-05, 3.03390517e-05, -2.94977309e-05,
+	1.09971846e-05, 2.63214715e-05, -7.34955075e-05, 1.10936761e-04,
+	-1.13650443e-04, 6.19574700e-05, 4.56190824e-05, -1.83212097e-04,
+	2.98548959e-04, -3.27575435e-04, 2.20769337e-04, 2.74524727e-05,
+	-3.59436960e-04, 6.57969865e-04, -7.79073465e-04, 6.08261534e-04,
+	-1.21778650e-04, -5.73666352e-04, 1.24724552e-03, -1.60724948e-03,
+	1.40950659e-03, -5.75888795e-04, -7.26114594e-04, 2.08761096e-03,
+	-2.96627098e-03, 2.87830331e-03, -1.61395388e-03, -6.08369370e-04,
+	3.12820689e-03, -5.00762850e-03, 5.34700381e-03, -3.65644352e-03,
+	1.44181674e-04, 4.21222760e-03, -7.88613398e-03, 9.28616879e-03,
+	-7.36736045e-03, 2.15499445e-03, 5.03966993e-03, -1.18552338e-02,
+	1.55648935e-02, -1.40374710e-02, 6.66873043e-03, 5.06461093e-03,
+	-1.76970498e-02, 2.65948980e-02, -2.73466705e-02, 1.73494533e-02,
+	2.89120044e-03, -2.91777933e-02, 5.39566524e-02, -6.73838074e-02,
+	5.82864115e-02, -1.23890401e-02, -1.06383890e-01, 6.58136447e-01,
+	5.54018134e-01, -1.52861815e-01, 3.19220531e-02, 2.86350078e-02,
+	-5.43601191e-02, 5.50445815e-02, -3.93718226e-02, 1.63986056e-02,
+	5.58633196e-03, -2.05709813e-02, 2.57979270e-02, -2.18451969e-02,
+	1.18310857e-02, -5.20170743e-05, -9.49039431e-03, 1.42318705e-02,
+	-1.35685598e-02, 8.69704592e-03, -1.92590346e-03, -4.24459636e-03,
+	7.94880773e-03, -8.44102966e-03, 6.13984245e-03, -2.28945713e-03,
+	-1.58852519e-03, 4.23879746e-03, -5.03378978e-03, 4.06499652e-03,
+	-1.98100201e-03, -3.29178993e-04, 2.07404767e-03, -2.80185978e-03,
+	2.48356300e-03, -1.43853421e-03, 1.58352026e-04, 8.91805258e-04,
+	-1.42225562e-03, 1.37769075e-03, -9.04400127e-04, 2.56400441e-04,
+	3.14153600e-04, -6.41097110e-04, 6.79590325e-04, -4.91613768e-04,
+	1.98348877e-04, 7.60073979e-05, -2.47216990e-04, 2.88961807e-04,
+	-2.25863308e-04, 1.10590993e-04, 2.48569077e-06, -7.66829345e-05,
+	1.00379157e-04, -8.31695447e-05, 4.55414360e-05, -7.87180325e-06,
+	-1.69177780e-05, 2.54349036e-05, -2.15547857e-05, 1.21680402e-05,
+	-3.31387233e-06, -1.87425870e-06, 3.22094100e-06, -2.28322789e-06,
+	-2.44530136e-06, 4.22893332e-06, -4.21589006e-06, 2.05255136e-07,
+	8.77314177e-06, -2.07694466e-05, 3.01557508e-05, -2.88597802e-05,
+	9.92653472e-06, 2.75404479e-05, -7.43172267e-05, 1.10704122e-04,
+	-1.11885421e-04, 5.87033437e-05, 4.95617802e-05, -1.86326916e-04,
+	2.99021588e-04, -3.24036528e-04, 2.13126957e-04, 3.74597614e-05,
+	-3.68335607e-04, 6.61485773e-04, -7.73764741e-04, 5.93335664e-04,
+	-1.00328083e-04, -5.94752313e-04, 1.25906372e-03, -1.60208397e-03,
+	1.38446192e-03, -5.35501704e-04, -7.69692962e-04, 2.11759694e-03,
+	-2.96696381e-03, 2.84183024e-03, -1.54548242e-03, -6.89494790e-04,
+	3.19285284e-03, -5.02628523e-03, 5.30154334e-03, -3.54998723e-03,
+	4.67912153e-06, 4.33752038e-03, -7.94504187e-03, 9.24104259e-03,
+	-7.21299280e-03, 1.92768327e-03, 5.26726076e-03, -1.19943547e-02,
+	1.55414749e-02, -1.38238587e-02, 6.30468476e-03, 5.47163034e-03,
+	-1.79966757e-02, 2.66400125e-02, -2.70492043e-02, 1.67289524e-02,
+	3.68327646e-03, -2.98696342e-02, 5.42053636e-02, -6.68532713e-02,
+	5.67376176e-02, -9.77790745e-03, -1.09639975e-01, 6.52888632e-01,
+	5.60278616e-01, -1.50955959e-01, 2.96462163e-02, 3.03498290e-02,
+	-5.52602175e-02, 5.51704382e-02, -3.89392920e-02, 1.57027029e-02,
+	6.26080461e-03, -2.10188044e-02, 2.59299084e-02, -2.16873844e-02,
+	1.14927227e-02, 3.23914554e-04, -9.77714813e-03, 1.43548087e-02,
+	-1.35186508e-02, 8.52170412e-03, -1.70384417e-03, -4.43393194e-03,
+	8.05070301e-03, -8.43860286e-03, 6.05272601e-03, -2.16094622e-03,
+	-1.70970320e-03, 4.31522648e-03, -5.04941500e-03, 4.02637704e-03,
+	-1.91093800e-03, -4.02151643e-04, 2.12605662e-03, -2.82056205e-03,
+	2.46987102e-03, -1.40362566e-03, 1.17893744e-04, 9.23727125e-04,
+	-1.43740516e-03, 1.37509464e-03, -8.89037241e-04, 2.36203554e-04,
+	3.31595708e-04, -6.50952123e-04, 6.80696029e-04, -4.85937683e-04,
+	1.89531470e-04, 8.42993757e-05, -2.52513007e-04, 2.90474938e-04,
+	-2.24270111e-04, 1.07374194e-04, 5.77914449e-06, -7.89832643e-05,
+	1.01302443e-04, -8.29205502e-05, 4.46410730e-05, -6.86439915e-06,
+	-1.76635140e-05, 2.57893525e-05, -2.15790498e-05, 1.20126615e-05,
+	-3.12378749e-06, -2.01312861e-06, 3.28819112e-06, -2.30000827e-06,
+	-2.44357095e-06, 4.17897258e-06, -4.08167101e-06, -1.57178215e-08,
+	9.01507927e-06, -2.08871449e-05, 2.99611896e-05, -2.82130318e-05,
+	8.85628120e-06, 2.87437195e-05, -7.51062729e-05, 1.10428139e-04,
+	-1.10081675e-04, 5.54361943e-05, 5.34727071e-05, -1.89358454e-04,
+	2.99373958e-04, -3.20378451e-04, 2.05420009e-04, 4.74266686e-05,
+	-3.77065998e-04, 6.64730597e-04, -7.68161136e-04, 5.78207905e-04,
+	-7.88846755e-05, -6.15557354e-04, 1.27035789e-03, -1.59629338e-03,
+	1.35891751e-03, -4.94979962e-04, -8.12884189e-04, 2.14668818e-03,
+	-2.96647910e-03, 2.80429488e-03, -1.47651668e-03, -7.70209280e-04,
+	3.25612555e-03, -5.04291939e-03, 5.25405551e-03, -3.44229421e-03,
+	-1.34605019e-04, 4.46089858e-03, -8.00071050e-03, 9.19232514e-03,
+	-7.05600600e-03, 1.69995985e-03, 5.49241160e-03, -1.21285065e-02,
+	1.55119380e-02, -1.36051174e-02, 5.93874702e-03, 5.87578443e-03,
+	-1.82886395e-02, 2.66744938e-02, -2.67416239e-02, 1.61031685e-02,
+	4.47201676e-03, -3.05478137e-02, 5.44318634e-02, -6.62982408e-02,
+	5.51736089e-02, -7.17982748e-03, -1.12817477e-01, 6.47570842e-01,
+	5.66490422e-01, -1.48970715e-01, 2.73444613e-02, 3.20603572e-02,
+	-5.61416155e-02, 5.52747776e-02, -3.84901741e-02, 1.49989372e-02,
+	6.93423782e-03, -2.14591792e-02, 2.60518503e-02, -2.15206877e-02,
+	1.11492215e-02, 7.00341066e-04, -1.00604874e-02, 1.44722475e-02,
+	-1.34633004e-02, 8.34270892e-03, -1.48076523e-03, -4.62180103e-03,
+	8.14956176e-03, -8.43282377e-03, 5.96307099e-03, -2.03137421e-03,
+	-1.83039673e-03, 4.39006673e-03, -5.06306154e-03, 3.98609444e-03,
+	-1.83999593e-03, -4.75091240e-04, 2.17731330e-03, -2.83817784e-03,
+	2.45517262e-03, -1.36809351e-03, 7.73103761e-05, 9.55345136e-04,
+	-1.45201413e-03, 1.37194641e-03, -8.73287911e-04, 2.15868235e-04,
+	3.48945421e-04, -6.60571091e-04, 6.81533428e-04, -4.80054005e-04,
+	1.80615947e-04, 9.25797586e-05, -2.57722905e-04, 2.91876520e-04,
+	-2.22582698e-04, 1.04104614e-04, 9.08086167e-06, -8.12597235e-05,
+	1.02188423e-04, -8.26374069e-05, 4.37192894e-05, -5.85007778e-06,
+	-1.84054162e-05, 2.61350621e-05, -2.15946973e-05, 1.18515265e-05,
+	-2.93124017e-06, -2.15215179e-06, 3.35462197e-06, -2.31595764e-06,
+	-2.44080120e-06, 4.12767716e-06, -3.94670742e-06, -2.35336161e-07,
+	9.25204153e-06, -2.09958373e-05, 2.97554987e-05, -2.75577843e-05,
+	7.78685269e-06, 2.99308639e-05, -7.58624492e-05, 1.10109072e-04,
+	-1.08240054e-04, 5.21573678e-05, 5.73503993e-05, -1.92305746e-04,
+	2.99606268e-04, -3.16602986e-04, 1.97651732e-04, 5.73493309e-05,
+	-3.85625074e-04, 6.67703691e-04, -7.62265560e-04, 5.62884724e-04,
+	-5.74569317e-05, -6.36073807e-04, 1.28112462e-03, -1.58988128e-03,
+	1.33288448e-03, -4.54339913e-04, -8.55671863e-04, 2.17487477e-03,
+	-2.96481918e-03, 2.76571398e-03, -1.40708486e-03, -8.50481528e-04,
+	3.31800223e-03, -5.05752772e-03, 5.20456241e-03, -3.33340913e-03,
+	-2.73615887e-04, 4.58231629e-03, -8.05312283e-03, 9.14004130e-03,
+	-6.89646629e-03, 1.47191501e-03, 5.71503709e-03, -1.22576441e-02,
+	1.54763041e-02, -1.33813420e-02, 5.57106514e-03, 6.27691828e-03,
+	-1.85728396e-02, 2.66983483e-02, -2.64240708e-02, 1.54723600e-02,
+	5.25711854e-03, -3.12121014e-02, 5.46361311e-02, -6.57190222e-02,
+	5.35950587e-02, -4.59568976e-03, -1.15916181e-01, 6.42184311e-01,
+	5.72652135e-01, -1.46905969e-01, 2.50174993e-02, 3.37659094e-02,
+	-5.70039007e-02, 5.53574938e-02, -3.80246026e-02, 1.42875678e-02,
+	7.60636310e-03, -2.18919167e-02, 2.61636855e-02, -2.13451568e-02,
+	1.08007095e-02, 1.07711409e-03, -1.03402942e-02, 1.45841317e-02,
+	-1.34025222e-02, 8.16012563e-03, -1.25675355e-03, -4.80812681e-03,
+	8.24534004e-03, -8.42368945e-03, 5.87090899e-03, -1.90079086e-03,
+	-1.95055708e-03, 4.46328588e-03, -5.07472071e-03, 3.94416194e-03,
+	-1.76820248e-03, -5.47968743e-04, 2.22779600e-03, -2.85469819e-03,
+	2.43947181e-03, -1.33195073e-03, 3.66178205e-05, 9.86646110e-04,
+	-1.46607561e-03, 1.36824616e-03, -8.57157580e-04, 1.95402276e-04,
+	3.66195617e-04, -6.69949628e-04, 6.82101544e-04, -4.73964565e-04,
+	1.71605615e-04, 1.00845210e-04, -2.62844367e-04, 2.93165677e-04,
+	-2.20801465e-04, 1.00783397e-04, 1.23895459e-05, -8.35113193e-05,
+	1.03036611e-04, -8.23201029e-05, 4.27763735e-05, -4.82922022e-06,
+	-1.91431677e-05, 2.64718508e-05, -2.16016783e-05, 1.16846697e-05,
+	-2.73629509e-06, -2.29127074e-06, 3.42019800e-06, -2.33106008e-06,
+	-2.43700369e-06, 4.07507973e-06, -3.81106077e-06, -4.53517616e-07,
+	9.48395894e-06, -2.10955250e-05, 2.95388131e-05, -2.68943387e-05,
+	6.71867579e-06, 3.11014667e-05, -7.65855727e-05, 1.09747199e-04,
+	-1.06361421e-04, 4.88682107e-05, 6.11934109e-05, -1.95167863e-04,
+	2.99718763e-04, -3.12711956e-04, 1.89825381e-04, 6.72239120e-05,
+	-3.94009854e-04, 6.70404525e-04, -7.56081036e-04, 5.47372652e-04,
+	-3.60533317e-05, -6.56294137e-04, 1.29136073e-03, -1.58285147e-03,
+	1.30637412e-03, -4.13597916e-04, -8.98039759e-04, 2.20214720e-03,
+	-2.96198680e-03, 2.72610469e-03, -1.33721531e-03, -9.30280447e-04,
+	3.37846066e-03, -5.07010773e-03, 5.15308693e-03, -3.22337705e-03,
+	-4.12298814e-04, 4.70172845e-03, -8.10226317e-03, 9.08421729e-03,
+	-6.73444081e-03, 1.24363959e-03, 5.93505297e-03, -1.23817241e-02,
+	1.54345970e-02, -1.31526292e-02, 5.20178750e-03, 6.67487840e-03,
+	-1.88491774e-02, 2.67115866e-02, -2.60966904e-02, 1.48367866e-02,
+	6.03828114e-03, -3.18622731e-02, 5.48181546e-02, -6.51159298e-02,
+	5.20026432e-02, -2.02637347e-03, -1.18935892e-01, 6.36730287e-01,
+	5.78762350e-01, -1.44761630e-01, 2.26660552e-02, 3.54658017e-02,
+	-5.78466667e-02, 5.54184889e-02, -3.75427176e-02, 1.35688578e-02,
+	8.27691192e-03, -2.23168304e-02, 2.62653509e-02, -2.11608457e-02,
+	1.04473162e-02, 1.45408488e-03, -1.06164519e-02, 1.46904081e-02,
+	-1.33363316e-02, 7.97402109e-03, -1.03189656e-03, -4.99283297e-03,
+	8.33799508e-03, -8.41119831e-03, 5.77627268e-03, -1.76924642e-03,
+	-2.07013570e-03, 4.53485225e-03, -5.08438461e-03, 3.90059344e-03,
+	-1.69558473e-03, -6.20755087e-04, 2.27748331e-03, -2.87011455e-03,
+	2.42277296e-03, -1.29521052e-03, -4.16794958e-06, 1.01761697e-03,
+	-1.47958289e-03, 1.36399423e-03, -8.40651854e-04, 1.74813540e-04,
+	3.83339202e-04, -6.79083438e-04, 6.82399502e-04, -4.67671281e-04,
+	1.62503826e-04, 1.09092392e-04, -2.67875104e-04, 2.94341573e-04,
+	-2.18926848e-04, 9.74117166e-05, 1.57038940e-05, -8.57370652e-05,
+	1.03846533e-04, -8.19686399e-05, 4.18126229e-05, -3.80221181e-06,
+	-1.98764515e-05, 2.67995398e-05, -2.15999458e-05, 1.15121277e-05,
+	-2.53901838e-06, -2.43042751e-06, 3.48488376e-06, -2.34529990e-06,
+	-2.43219035e-06, 4.02121325e-06, -3.67479239e-06, -6.70181010e-07,
+	9.71076437e-06, -2.11862126e-05, 2.93112712e-05, -2.62229978e-05,
+	5.65217485e-06, 3.22551218e-05, -7.72754743e-05, 1.09342814e-04,
+	-1.04446650e-04, 4.55700694e-05, 6.50003144e-05, -1.97943915e-04,
+	2.99711738e-04, -3.08707225e-04, 1.81944223e-04, 7.70466048e-05,
+	-4.02217431e-04, 6.72832675e-04, -7.49610692e-04, 5.31678280e-04,
+	-1.46823272e-05, -6.76210942e-04, 1.30106327e-03, -1.57520799e-03,
+	1.27939792e-03, -3.72770339e-04, -9.39971853e-04, 2.22849632e-03,
+	-2.95798521e-03, 2.68548455e-03, -1.26693650e-03, -1.00957519e-03,
+	3.43747924e-03, -5.08065777e-03, 5.09965266e-03, -3.11224343e-03,
+	-5.50599350e-04, 4.81909089e-03, -8.14811711e-03, 9.02488072e-03,
+	-6.56999758e-03, 1.01522435e-03, 6.15237616e-03, -1.25007053e-02,
+	1.53868429e-02, -1.29190775e-02, 4.83106284e-03, 7.06951283e-03,
+	-1.91175577e-02, 2.67142232e-02, -2.57596317e-02, 1.41967091e-02,
+	6.81520614e-03, -3.24981106e-02, 5.49779308e-02, -6.44892862e-02,
+	5.03970403e-02, 5.27252809e-04, -1.21876439e-01, 6.31210032e-01,
+	5.84819671e-01, -1.42537627e-01, 2.02908666e-02, 3.71593493e-02,
+	-5.86695133e-02, 5.54576731e-02, -3.70446663e-02, 1.28430739e-02,
+	8.94561579e-03, -2.27337366e-02, 2.63567872e-02, -2.09678115e-02,
+	1.00891732e-02, 1.83110435e-03, -1.08888452e-02, 1.47910255e-02,
+	-1.32647464e-02, 7.78446366e-03, -8.06282165e-04, -5.17584372e-03,
+	8.42748527e-03, -8.39535008e-03, 5.67919573e-03, -1.63679158e-03,
+	-2.18908416e-03, 4.60473473e-03, -5.09204612e-03, 3.85540351e-03,
+	-1.62217013e-03, -6.93421194e-04, 2.32635405e-03, -2.88441880e-03,
+	2.40508089e-03, -1.25788637e-03, -4.50308931e-05, 1.04824474e-03,
+	-1.49252948e-03, 1.35919115e-03, -8.23776500e-04, 1.54109957e-04,
+	4.00369103e-04, -6.87968310e-04, 6.82426536e-04, -4.61176157e-04,
+	1.53313977e-04, 1.17317963e-04, -2.72812859e-04, 2.95403416e-04,
+	-2.16959320e-04, 9.39907656e-05, 1.90225962e-05, -8.79359822e-05,
+	1.04617731e-04, -8.15830336e-05, 4.08283452e-05, -2.76944192e-06,
+	-2.06049512e-05, 2.71179534e-05, -2.15894564e-05, 1.13339400e-05,
+	-2.33947754e-06, -2.56956373e-06, 3.54864391e-06, -2.35866171e-06,
+	-2.42637348e-06, 3.96611100e-06, -3.53796348e-06, -8.85246281e-07,
+	9.93239314e-06, -2.12679082e-05, 2.90730154e-05, -2.55440664e-05,
+	4.58777180e-06, 3.33914316e-05, -7.79319990e-05, 1.08896226e-04,
+	-1.02496625e-04, 4.22642894e-05, 6.87697009e-05, -2.00633047e-04,
+	2.99585534e-04, -3.04590700e-04, 1.74011542e-04, 8.68136324e-05,
+	-4.10244978e-04, 6.74987826e-04, -7.42857763e-04, 5.15808254e-04,
+	6.64766161e-06, -6.95816958e-04, 1.31022948e-03, -1.56695511e-03,
+	1.25196749e-03, -3.31873554e-04, -9.81452321e-04, 2.25391337e-03,
+	-2.95281810e-03, 2.64387144e-03, -1.19627702e-03, -1.08833517e-03,
+	3.49503696e-03, -5.08917699e-03, 5.04428396e-03, -3.00005408e-03,
+	-6.88463283e-04, 4.93436029e-03, -8.19067160e-03, 8.96206051e-03,
+	-6.40320548e-03, 7.86759997e-04, 6.36692479e-03, -1.26145486e-02,
+	1.53330704e-02, -1.26807873e-02, 4.45904026e-03, 7.46067118e-03,
+	-1.93778886e-02, 2.67062772e-02, -2.54130469e-02, 1.35523899e-02,
+	7.58759751e-03, -3.31194020e-02, 5.51154648e-02, -6.38394216e-02,
+	4.87789301e-02, 3.06433130e-03, -1.24737672e-01, 6.25624824e-01,
+	5.90822711e-01, -1.40233912e-01, 1.78926841e-02, 3.88458667e-02,
+	-5.94720463e-02, 5.54749651e-02, -3.65306024e-02, 1.21104860e-02,
+	9.61220637e-03, -2.31424545e-02, 2.64379389e-02, -2.07661154e-02,
+	9.72641435e-03, 2.20802317e-03, -1.11573600e-02, 1.48859352e-02,
+	-1.31877867e-02, 7.59152315e-03, -5.79998686e-04, -5.35708382e-03,
+	8.51377019e-03, -8.37614583e-03, 5.57971285e-03, -1.50347749e-03,
+	-2.30735425e-03, 4.67290284e-03, -5.09769890e-03, 3.80860739e-03,
+	-1.54798649e-03, -7.65937982e-04, 2.37438738e-03, -2.89760325e-03,
+	2.38640079e-03, -1.21999202e-03, -8.59549074e-05, 1.07851656e-03,
+	-1.50490909e-03, 1.35383769e-03, -8.06537447e-04, 1.33299518e-04,
+	4.17278280e-04, -6.96600123e-04, 6.82181984e-04, -4.54481285e-04,
+	1.44039510e-04, 1.25518582e-04, -2.77655403e-04, 2.96350458e-04,
+	-2.14899396e-04, 9.05217624e-05, 2.23443367e-05, -9.01070986e-05,
+	1.05349758e-04, -8.11633133e-05, 3.98238572e-05, -1.73130386e-06,
+	-2.13283509e-05, 2.74269188e-05, -2.15701702e-05, 1.11501487e-05,
+	-2.13774143e-06, -2.70862065e-06, 3.61144323e-06, -2.37113034e-06,
+	-2.41956573e-06, 3.90980654e-06, -3.40063505e-06, -1.09863451e-06,
+	1.01487831e-05, -2.13406238e-05, 2.88241918e-05, -2.48578511e-05,
+	3.52588604e-06, 3.45100070e-05, -7.85550058e-05, 1.08407760e-04,
+	-1.00512243e-04, 3.89522154e-05, 7.25001808e-05, -2.03234442e-04,
+	2.99340537e-04, -3.00364324e-04, 1.66030631e-04, 9.65212499e-05,
+	-4.18089745e-04, 6.76869776e-04, -7.35825590e-04, 4.99769280e-04,
+	2.79282492e-05, -7.15105057e-04, 1.31885683e-03, -1.55809734e-03,
+	1.22409461e-03, -2.90923927e-04, -1.02246555e-03, 2.27838998e-03,
+	-2.94648961e-03, 2.60128363e-03, -1.12526555e-03, -1.16653006e-03,
+	3.55111343e-03, -5.09566535e-03, 4.98700592e-03, -2.88685515e-03,
+	-8.25836658e-04, 5.04749425e-03, -8.22991489e-03, 8.89578695e-03,
+	-6.23413421e-03, 5.58337091e-04, 6.57861818e-03, -1.27232170e-02,
+	1.52733101e-02, -1.24378604e-02, 4.08586911e-03, 7.84820469e-03,
+	-1.96300816e-02, 2.66877714e-02, -2.50570921e-02, 1.29040922e-02,
+	8.35516167e-03, -3.37259414e-02, 5.52307707e-02, -6.31666741e-02,
+	4.71489942e-02, 5.58401528e-03, -1.27519464e-01, 6.19975953e-01,
+	5.96770094e-01, -1.37850456e-01, 1.54722711e-02, 4.05246680e-02,
+	-6.02538781e-02, 5.54702915e-02, -3.60006863e-02, 1.13713674e-02,
+	1.02764156e-02, -2.35428060e-02, 2.65087548e-02, -2.05558216e-02,
+	9.35917543e-03, 2.58469178e-03, -1.14218835e-02, 1.49750904e-02,
+	-1.31054744e-02, 7.39527083e-03, -3.53134861e-04, -5.53647863e-03,
+	8.59681064e-03, -8.35358795e-03, 5.47785976e-03, -1.36935571e-03,
+	-2.42489790e-03, 4.73932673e-03, -5.10133740e-03, 3.76022098e-03,
+	-1.47306196e-03, -8.38276378e-04, 2.42156272e-03, -2.90966064e-03,
+	2.36673826e-03, -1.18154146e-03, -1.26923834e-04, 1.10841968e-03,
+	-1.51671564e-03, 1.34793483e-03, -7.88940779e-04, 1.12390276e-04,
+	4.34059724e-04, -7.04974849e-04, 6.81665291e-04, -4.47588838e-04,
+	1.34683908e-04, 1.33690910e-04, -2.82400543e-04, 2.97181993e-04,
+	-2.12747624e-04, 8.70059480e-05, 2.56677944e-05, -9.22494506e-05,
+	1.06042184e-04, -8.07095223e-05, 3.87994852e-05, -6.88194746e-07,
+	-2.20463354e-05, 2.77262662e-05, -2.15420504e-05, 1.09607981e-05,
+	-1.93388026e-06, -2.84753915e-06, 3.67324668e-06, -2.38269092e-06,
+	-2.41178011e-06, 3.85233369e-06, -3.26286793e-06, -1.31026796e-06,
+	1.03598744e-05, -2.14043749e-05, 2.85649501e-05, -2.41646600e-05,
+	2.46693425e-06, 3.56104674e-05, -7.91443677e-05, 1.07877759e-04,
+	-9.84944117e-05, 3.56351899e-05, 7.61903845e-05, -2.05747320e-04,
+	2.98977183e-04, -2.96030082e-04, 1.58004795e-04, 1.06165745e-04,
+	-4.25749064e-04, 6.78478428e-04, -7.28517617e-04, 4.83568112e-04,
+	4.91510881e-05, -7.34068256e-04, 1.32694302e-03, -1.54863943e-03,
+	1.19579124e-03, -2.49937815e-04, -1.06299614e-03, 2.30191817e-03,
+	-2.93900434e-03, 2.55773972e-03, -1.05393087e-03, -1.24412979e-03,
+	3.60568888e-03, -5.10012360e-03, 4.92784432e-03, -2.77269313e-03,
+	-9.62665799e-04, 5.15845127e-03, -8.26583657e-03, 8.82609163e-03,
+	-6.06285426e-03, 3.30046048e-04, 6.78737694e-03, -1.28266755e-02,
+	1.52075954e-02, -1.21904005e-02, 3.71169895e-03, 8.23196630e-03,
+	-1.98740515e-02, 2.66587330e-02, -2.46919264e-02, 1.22520804e-02,
+	9.11760763e-03, -3.43175294e-02, 5.53238710e-02, -6.24713894e-02,
+	4.55079155e-02, 8.08546933e-03, -1.30221710e-01, 6.14264722e-01,
+	6.02660457e-01, -1.35387256e-01, 1.30304035e-02, 4.21950671e-02,
+	-6.10146275e-02, 5.54435876e-02, -3.54550853e-02, 1.06259945e-02,
+	1.09379757e-02, -2.39346160e-02, 2.65691874e-02, -2.03369981e-02,
+	8.98759428e-03, 2.96096047e-03, -1.16823044e-02, 1.50584467e-02,
+	-1.30178338e-02, 7.19577940e-03, -1.25779791e-04, -5.71395412e-03,
+	8.67656864e-03, -8.32768018e-03, 5.37367318e-03, -1.23447821e-03,
+	-2.54166729e-03, 4.80397719e-03, -5.10295686e-03, 3.71026084e-03,
+	-1.39742506e-03, -9.10407330e-04, 2.46785980e-03, -2.92058413e-03,
+	2.34609931e-03, -1.14254893e-03, -1.67921467e-04, 1.13794147e-03,
+	-1.52794327e-03, 1.34148378e-03, -7.70992736e-04, 9.13903394e-05,
+	4.50706461e-04, -7.13088551e-04, 6.80876008e-04, -4.40501077e-04,
+	1.25250697e-04, 1.41831609e-04, -2.87046116e-04, 2.97897362e-04,
+	-2.10504596e-04, 8.34445862e-05, 2.89916435e-05, -9.43620830e-05,
+	1.06694591e-04, -8.02217180e-05, 3.77555649e-05, 3.59484689e-07,
+	-2.27585905e-05, 2.80158289e-05, -2.15050638e-05, 1.07659354e-05,
+	-1.72796554e-06, -2.98625977e-06, 3.73401935e-06, -2.39332888e-06,
+	-2.40302994e-06, 3.79372652e-06, -3.12472272e-06, -1.52007008e-06,
+	1.05656101e-05, -2.14591807e-05, 2.82954436e-05, -2.34648028e-05,
+	1.41133021e-06, 3.66924409e-05, -7.96999714e-05, 1.07306579e-04,
+	-9.64440492e-05, 3.23145534e-05, 7.98389625e-05, -2.08170940e-04,
+	2.98495949e-04, -2.91589993e-04, 1.49937347e-04, 1.15743441e-04,
+	-4.33220343e-04, 6.79813798e-04, -7.20937388e-04, 4.67211555e-04,
+	7.03078721e-05, -7.52699714e-04, 1.33448596e-03, -1.53858634e-03,
+	1.16706945e-03, -2.08931556e-04, -1.10302892e-03, 2.32449035e-03,
+	-2.93036735e-03, 2.51325868e-03, -9.82301818e-04, -1.32110462e-03,
+	3.65874419e-03, -5.10255331e-03, 4.86682568e-03, -2.65761482e-03,
+	-1.09889733e-03, 5.26719079e-03, -8.29842758e-03, 8.75300747e-03,
+	-5.88943689e-03, 1.01977089e-04, 6.99312295e-03, -1.29248913e-02,
+	1.51359617e-02, -1.19385129e-02, 3.33667947e-03, 8.61181067e-03,
+	-2.01097165e-02, 2.66191932e-02, -2.43177125e-02, 1.15966195e-02,
+	9.87464709e-03, -3.48939729e-02, 5.53947968e-02, -6.17539205e-02,
+	4.38563782e-02, 1.05678695e-02, -1.32844328e-01, 6.08492447e-01,
+	6.08492447e-01, -1.32844328e-01, 1.05678695e-02, 4.38563782e-02,
+	-6.17539205e-02, 5.53947968e-02, -3.48939729e-02, 9.87464709e-03,
+	1.15966195e-02, -2.43177125e-02, 2.66191932e-02, -2.01097165e-02,
+	8.61181067e-03, 3.33667947e-03, -1.19385129e-02, 1.51359617e-02,
+	-1.29248913e-02, 6.99312295e-03, 1.01977089e-04, -5.88943689e-03,
+	8.75300747e-03, -8.29842758e-03, 5.26719079e-03, -1.09889733e-03,
+	-2.65761482e-03, 4.86682568e-03, -5.10255331e-03, 3.65874419e-03,
+	-1.32110462e-03, -9.82301818e-04, 2.51325868e-03, -2.93036735e-03,
+	2.32449035e-03, -1.10302892e-03, -2.08931556e-04, 1.16706945e-03,
+	-1.53858634e-03, 1.33448596e-03, -7.52699714e-04, 7.03078721e-05,
+	4.67211555e-04, -7.20937388e-04, 6.79813798e-04, -4.33220343e-04,
+	1.15743441e-04, 1.49937347e-04, -2.91589993e-04, 2.98495949e-04,
+	-2.08170940e-04, 7.98389625e-05, 3.23145534e-05, -9.64440492e-05,
+	1.07306579e-04, -7.96999714e-05, 3.66924409e-05, 1.41133021e-06,
+	-2.34648028e-05, 2.82954436e-05, -2.14591807e-05, 1.05656101e-05,
+	-1.52007008e-06, -3.12472272e-06, 3.79372652e-06, -2.40302994e-06,
+	-2.39332888e-06, 3.73401935e-06, -2.98625977e-06, -1.72796554e-06,
+	1.07659354e-05, -2.15050638e-05, 2.80158289e-05, -2.27585905e-05,
+	3.59484689e-07, 3.77555649e-05, -8.02217180e-05, 1.06694591e-04,
+	-9.43620830e-05, 2.89916435e-05, 8.34445862e-05, -2.10504596e-04,
+	2.97897362e-04, -2.87046116e-04, 1.41831609e-04, 1.25250697e-04,
+	-4.40501077e-04, 6.80876008e-04, -7.13088551e-04, 4.50706461e-04,
+	9.13903394e-05, -7.70992736e-04, 1.34148378e-03, -1.52794327e-03,
+	1.13794147e-03, -1.67921467e-04, -1.14254893e-03, 2.34609931e-03,
+	-2.92058413e-03, 2.46785980e-03, -9.10407330e-04, -1.39742506e-03,
+	3.71026084e-03, -5.10295686e-03, 4.80397719e-03, -2.54166729e-03,
+	-1.23447821e-03, 5.37367318e-03, -8.32768018e-03, 8.67656864e-03,
+	-5.71395412e-03, -1.25779791e-04, 7.19577940e-03, -1.30178338e-02,
+	1.50584467e-02, -1.16823044e-02, 2.96096047e-03, 8.98759428e-03,
+	-2.03369981e-02, 2.65691874e-02, -2.39346160e-02, 1.09379757e-02,
+	1.06259945e-02, -3.54550853e-02, 5.54435876e-02, -6.10146275e-02,
+	4.21950671e-02, 1.30304035e-02, -1.35387256e-01, 6.02660457e-01,
+	6.14264722e-01, -1.30221710e-01, 8.08546933e-03, 4.55079155e-02,
+	-6.24713894e-02, 5.53238710e-02, -3.43175294e-02, 9.11760763e-03,
+	1.22520804e-02, -2.46919264e-02, 2.66587330e-02, -1.98740515e-02,
+	8.23196630e-03, 3.71169895e-03, -1.21904005e-02, 1.52075954e-02,
+	-1.28266755e-02, 6.78737694e-03, 3.30046048e-04, -6.06285426e-03,
+	8.82609163e-03, -8.26583657e-03, 5.15845127e-03, -9.62665799e-04,
+	-2.77269313e-03, 4.92784432e-03, -5.10012360e-03, 3.60568888e-03,
+	-1.24412979e-03, -1.05393087e-03, 2.55773972e-03, -2.93900434e-03,
+	2.30191817e-03, -1.06299614e-03, -2.49937815e-04, 1.19579124e-03,
+	-1.54863943e-03, 1.32694302e-03, -7.34068256e-04, 4.91510881e-05,
+	4.83568112e-04, -7.28517617e-04, 6.78478428e-04, -4.25749064e-04,
+	1.06165745e-04, 1.58004795e-04, -2.96030082e-04, 2.98977183e-04,
+	-2.05747320e-04, 7.61903845e-05, 3.56351899e-05, -9.84944117e-05,
+	1.07877759e-04, -7.91443677e-05, 3.56104674e-05, 2.46693425e-06,
+	-2.41646600e-05, 2.85649501e-05, -2.14043749e-05, 1.03598744e-05,
+	-1.31026796e-06, -3.26286793e-06, 3.85233369e-06, -2.41178011e-06,
+	-2.38269092e-06, 3.67324668e-06, -2.84753915e-06, -1.93388026e-06,
+	1.09607981e-05, -2.15420504e-05, 2.77262662e-05, -2.20463354e-05,
+	-6.88194746e-07, 3.87994852e-05, -8.07095223e-05, 1.06042184e-04,
+	-9.22494506e-05, 2.56677944e-05, 8.70059480e-05, -2.12747624e-04,
+	2.97181993e-04, -2.82400543e-04, 1.33690910e-04, 1.34683908e-04,
+	-4.47588838e-04, 6.81665291e-04, -7.04974849e-04, 4.34059724e-04,
+	1.12390276e-04, -7.88940779e-04, 1.34793483e-03, -1.51671564e-03,
+	1.10841968e-03, -1.26923834e-04, -1.18154146e-03, 2.36673826e-03,
+	-2.90966064e-03, 2.42156272e-03, -8.38276378e-04, -1.47306196e-03,
+	3.76022098e-03, -5.10133740e-03, 4.73932673e-03, -2.42489790e-03,
+	-1.36935571e-03, 5.47785976e-03, -8.35358795e-03, 8.59681064e-03,
+	-5.53647863e-03, -3.53134861e-04, 7.39527083e-03, -1.31054744e-02,
+	1.49750904e-02, -1.14218835e-02, 2.58469178e-03, 9.35917543e-03,
+	-2.05558216e-02, 2.65087548e-02, -2.35428060e-02, 1.02764156e-02,
+	1.13713674e-02, -3.60006863e-02, 5.54702915e-02, -6.02538781e-02,
+	4.05246680e-02, 1.54722711e-02, -1.37850456e-01, 5.96770094e-01,
+	6.19975953e-01, -1.27519464e-01, 5.58401528e-03, 4.71489942e-02,
+	-6.31666741e-02, 5.52307707e-02, -3.37259414e-02, 8.35516167e-03,
+	1.29040922e-02, -2.50570921e-02, 2.66877714e-02, -1.96300816e-02,
+	7.84820469e-03, 4.08586911e-03, -1.24378604e-02, 1.52733101e-02,
+	-1.27232170e-02, 6.57861818e-03, 5.58337091e-04, -6.23413421e-03,
+	8.89578695e-03, -8.22991489e-03, 5.04749425e-03, -8.25836658e-04,
+	-2.88685515e-03, 4.98700592e-03, -5.09566535e-03, 3.55111343e-03,
+	-1.16653006e-03, -1.12526555e-03, 2.60128363e-03, -2.94648961e-03,
+	2.27838998e-03, -1.02246555e-03, -2.90923927e-04, 1.22409461e-03,
+	-1.55809734e-03, 1.31885683e-03, -7.15105057e-04, 2.79282492e-05,
+	4.99769280e-04, -7.35825590e-04, 6.76869776e-04, -4.18089745e-04,
+	9.65212499e-05, 1.66030631e-04, -3.00364324e-04, 2.99340537e-04,
+	-2.03234442e-04, 7.25001808e-05, 3.89522154e-05, -1.00512243e-04,
+	1.08407760e-04, -7.85550058e-05, 3.45100070e-05, 3.52588604e-06,
+	-2.48578511e-05, 2.88241918e-05, -2.13406238e-05, 1.01487831e-05,
+	-1.09863451e-06, -3.40063505e-06, 3.90980654e-06, -2.41956573e-06,
+	-2.37113034e-06, 3.61144323e-06, -2.70862065e-06, -2.13774143e-06,
+	1.11501487e-05, -2.15701702e-05, 2.74269188e-05, -2.13283509e-05,
+	-1.73130386e-06, 3.98238572e-05, -8.11633133e-05, 1.05349758e-04,
+	-9.01070986e-05, 2.23443367e-05, 9.05217624e-05, -2.14899396e-04,
+	2.96350458e-04, -2.77655403e-04, 1.25518582e-04, 1.44039510e-04,
+	-4.54481285e-04, 6.82181984e-04, -6.96600123e-04, 4.17278280e-04,
+	1.33299518e-04, -8.06537447e-04, 1.35383769e-03, -1.50490909e-03,
+	1.07851656e-03, -8.59549074e-05, -1.21999202e-03, 2.38640079e-03,
+	-2.89760325e-03, 2.37438738e-03, -7.65937982e-04, -1.54798649e-03,
+	3.80860739e-03, -5.09769890e-03, 4.67290284e-03, -2.30735425e-03,
+	-1.50347749e-03, 5.57971285e-03, -8.37614583e-03, 8.51377019e-03,
+	-5.35708382e-03, -5.79998686e-04, 7.59152315e-03, -1.31877867e-02,
+	1.48859352e-02, -1.11573600e-02, 2.20802317e-03, 9.72641435e-03,
+	-2.07661154e-02, 2.64379389e-02, -2.31424545e-02, 9.61220637e-03,
+	1.21104860e-02, -3.65306024e-02, 5.54749651e-02, -5.94720463e-02,
+	3.88458667e-02, 1.78926841e-02, -1.40233912e-01, 5.90822711e-01,
+	6.25624824e-01, -1.24737672e-01, 3.06433130e-03, 4.87789301e-02,
+	-6.38394216e-02, 5.51154648e-02, -3.31194020e-02, 7.58759751e-03,
+	1.35523899e-02, -2.54130469e-02, 2.67062772e-02, -1.93778886e-02,
+	7.46067118e-03, 4.45904026e-03, -1.26807873e-02, 1.53330704e-02,
+	-1.26145486e-02, 6.36692479e-03, 7.86759997e-04, -6.40320548e-03,
+	8.96206051e-03, -8.19067160e-03, 4.93436029e-03, -6.88463283e-04,
+	-3.00005408e-03, 5.04428396e-03, -5.08917699e-03, 3.49503696e-03,
+	-1.08833517e-03, -1.19627702e-03, 2.64387144e-03, -2.95281810e-03,
+	2.25391337e-03, -9.81452321e-04, -3.31873554e-04, 1.25196749e-03,
+	-1.56695511e-03, 1.31022948e-03, -6.95816958e-04, 6.64766161e-06,
+	5.15808254e-04, -7.42857763e-04, 6.74987826e-04, -4.10244978e-04,
+	8.68136324e-05, 1.74011542e-04, -3.04590700e-04, 2.99585534e-04,
+	-2.00633047e-04, 6.87697009e-05, 4.22642894e-05, -1.02496625e-04,
+	1.08896226e-04, -7.79319990e-05, 3.33914316e-05, 4.58777180e-06,
+	-2.55440664e-05, 2.90730154e-05, -2.12679082e-05, 9.93239314e-06,
+	-8.85246281e-07, -3.53796348e-06, 3.96611100e-06, -2.42637348e-06,
+	-2.35866171e-06, 3.54864391e-06, -2.56956373e-06, -2.33947754e-06,
+	1.13339400e-05, -2.15894564e-05, 2.71179534e-05, -2.06049512e-05,
+	-2.76944192e-06, 4.08283452e-05, -8.15830336e-05, 1.04617731e-04,
+	-8.79359822e-05, 1.90225962e-05, 9.39907656e-05, -2.16959320e-04,
+	2.95403416e-04, -2.72812859e-04, 1.17317963e-04, 1.53313977e-04,
+	-4.61176157e-04, 6.82426536e-04, -6.87968310e-04, 4.00369103e-04,
+	1.54109957e-04, -8.23776500e-04, 1.35919115e-03, -1.49252948e-03,
+	1.04824474e-03, -4.50308931e-05, -1.25788637e-03, 2.40508089e-03,
+	-2.88441880e-03, 2.32635405e-03, -6.93421194e-04, -1.62217013e-03,
+	3.85540351e-03, -5.09204612e-03, 4.60473473e-03, -2.18908416e-03,
+	-1.63679158e-03, 5.67919573e-03, -8.39535008e-03, 8.42748527e-03,
+	-5.17584372e-03, -8.06282165e-04, 7.78446366e-03, -1.32647464e-02,
+	1.47910255e-02, -1.08888452e-02, 1.83110435e-03, 1.00891732e-02,
+	-2.09678115e-02, 2.63567872e-02, -2.27337366e-02, 8.94561579e-03,
+	1.28430739e-02, -3.70446663e-02, 5.54576731e-02, -5.86695133e-02,
+	3.71593493e-02, 2.02908666e-02, -1.42537627e-01, 5.84819671e-01,
+	6.31210032e-01, -1.21876439e-01, 5.27252809e-04, 5.03970403e-02,
+	-6.44892862e-02, 5.49779308e-02, -3.24981106e-02, 6.81520614e-03,
+	1.41967091e-02, -2.57596317e-02, 2.67142232e-02, -1.91175577e-02,
+	7.06951283e-03, 4.83106284e-03, -1.29190775e-02, 1.53868429e-02,
+	-1.25007053e-02, 6.15237616e-03, 1.01522435e-03, -6.56999758e-03,
+	9.02488072e-03, -8.14811711e-03, 4.81909089e-03, -5.50599350e-04,
+	-3.11224343e-03, 5.09965266e-03, -5.08065777e-03, 3.43747924e-03,
+	-1.00957519e-03, -1.26693650e-03, 2.68548455e-03, -2.95798521e-03,
+	2.22849632e-03, -9.39971853e-04, -3.72770339e-04, 1.27939792e-03,
+	-1.57520799e-03, 1.30106327e-03, -6.76210942e-04, -1.46823272e-05,
+	5.31678280e-04, -7.49610692e-04, 6.72832675e-04, -4.02217431e-04,
+	7.70466048e-05, 1.81944223e-04, -3.08707225e-04, 2.99711738e-04,
+	-1.97943915e-04, 6.50003144e-05, 4.55700694e-05, -1.04446650e-04,
+	1.09342814e-04, -7.72754743e-05, 3.22551218e-05, 5.65217485e-06,
+	-2.62229978e-05, 2.93112712e-05, -2.11862126e-05, 9.71076437e-06,
+	-6.70181010e-07, -3.67479239e-06, 4.02121325e-06, -2.43219035e-06,
+	-2.34529990e-06, 3.48488376e-06, -2.43042751e-06, -2.53901838e-06,
+	1.15121277e-05, -2.15999458e-05, 2.67995398e-05, -1.98764515e-05,
+	-3.80221181e-06, 4.18126229e-05, -8.19686399e-05, 1.03846533e-04,
+	-8.57370652e-05, 1.57038940e-05, 9.74117166e-05, -2.18926848e-04,
+	2.94341573e-04, -2.67875104e-04, 1.09092392e-04, 1.62503826e-04,
+	-4.67671281e-04, 6.82399502e-04, -6.79083438e-04, 3.83339202e-04,
+	1.74813540e-04, -8.40651854e-04, 1.36399423e-03, -1.47958289e-03,
+	1.01761697e-03, -4.16794958e-06, -1.29521052e-03, 2.42277296e-03,
+	-2.87011455e-03, 2.27748331e-03, -6.20755087e-04, -1.69558473e-03,
+	3.90059344e-03, -5.08438461e-03, 4.53485225e-03, -2.07013570e-03,
+	-1.76924642e-03, 5.77627268e-03, -8.41119831e-03, 8.33799508e-03,
+	-4.99283297e-03, -1.03189656e-03, 7.97402109e-03, -1.33363316e-02,
+	1.46904081e-02, -1.06164519e-02, 1.45408488e-03, 1.04473162e-02,
+	-2.11608457e-02, 2.62653509e-02, -2.23168304e-02, 8.27691192e-03,
+	1.35688578e-02, -3.75427176e-02, 5.54184889e-02, -5.78466667e-02,
+	3.54658017e-02, 2.26660552e-02, -1.44761630e-01, 5.78762350e-01,
+	6.36730287e-01, -1.18935892e-01, -2.02637347e-03, 5.20026432e-02,
+	-6.51159298e-02, 5.48181546e-02, -3.18622731e-02, 6.03828114e-03,
+	1.48367866e-02, -2.60966904e-02, 2.67115866e-02, -1.88491774e-02,
+	6.67487840e-03, 5.20178750e-03, -1.31526292e-02, 1.54345970e-02,
+	-1.23817241e-02, 5.93505297e-03, 1.24363959e-03, -6.73444081e-03,
+	9.08421729e-03, -8.10226317e-03, 4.70172845e-03, -4.12298814e-04,
+	-3.22337705e-03, 5.15308693e-03, -5.07010773e-03, 3.37846066e-03,
+	-9.30280447e-04, -1.33721531e-03, 2.72610469e-03, -2.96198680e-03,
+	2.20214720e-03, -8.98039759e-04, -4.13597916e-04, 1.30637412e-03,
+	-1.58285147e-03, 1.29136073e-03, -6.56294137e-04, -3.60533317e-05,
+	5.47372652e-04, -7.56081036e-04, 6.70404525e-04, -3.94009854e-04,
+	6.72239120e-05, 1.89825381e-04, -3.12711956e-04, 2.99718763e-04,
+	-1.95167863e-04, 6.11934109e-05, 4.88682107e-05, -1.06361421e-04,
+	1.09747199e-04, -7.65855727e-05, 3.11014667e-05, 6.71867579e-06,
+	-2.68943387e-05, 2.95388131e-05, -2.10955250e-05, 9.48395894e-06,
+	-4.53517616e-07, -3.81106077e-06, 4.07507973e-06, -2.43700369e-06,
+	-2.33106008e-06, 3.42019800e-06, -2.29127074e-06, -2.73629509e-06,
+	1.16846697e-05, -2.16016783e-05, 2.64718508e-05, -1.91431677e-05,
+	-4.82922022e-06, 4.27763735e-05, -8.23201029e-05, 1.03036611e-04,
+	-8.35113193e-05, 1.23895459e-05, 1.00783397e-04, -2.20801465e-04,
+	2.93165677e-04, -2.62844367e-04, 1.00845210e-04, 1.71605615e-04,
+	-4.73964565e-04, 6.82101544e-04, -6.69949628e-04, 3.66195617e-04,
+	1.95402276e-04, -8.57157580e-04, 1.36824616e-03, -1.46607561e-03,
+	9.86646110e-04, 3.66178205e-05, -1.33195073e-03, 2.43947181e-03,
+	-2.85469819e-03, 2.22779600e-03, -5.47968743e-04, -1.76820248e-03,
+	3.94416194e-03, -5.07472071e-03, 4.46328588e-03, -1.95055708e-03,
+	-1.90079086e-03, 5.87090899e-03, -8.42368945e-03, 8.24534004e-03,
+	-4.80812681e-03, -1.25675355e-03, 8.16012563e-03, -1.34025222e-02,
+	1.45841317e-02, -1.03402942e-02, 1.07711409e-03, 1.08007095e-02,
+	-2.13451568e-02, 2.61636855e-02, -2.18919167e-02, 7.60636310e-03,
+	1.42875678e-02, -3.80246026e-02, 5.53574938e-02, -5.70039007e-02,
+	3.37659094e-02, 2.50174993e-02, -1.46905969e-01, 5.72652135e-01,
+	6.42184311e-01, -1.15916181e-01, -4.59568976e-03, 5.35950587e-02,
+	-6.57190222e-02, 5.46361311e-02, -3.12121014e-02, 5.25711854e-03,
+	1.54723600e-02, -2.64240708e-02, 2.66983483e-02, -1.85728396e-02,
+	6.27691828e-03, 5.57106514e-03, -1.33813420e-02, 1.54763041e-02,
+	-1.22576441e-02, 5.71503709e-03, 1.47191501e-03, -6.89646629e-03,
+	9.14004130e-03, -8.05312283e-03, 4.58231629e-03, -2.73615887e-04,
+	-3.33340913e-03, 5.20456241e-03, -5.05752772e-03, 3.31800223e-03,
+	-8.50481528e-04, -1.40708486e-03, 2.76571398e-03, -2.96481918e-03,
+	2.17487477e-03, -8.55671863e-04, -4.54339913e-04, 1.33288448e-03,
+	-1.58988128e-03, 1.28112462e-03, -6.36073807e-04, -5.74569317e-05,
+	5.62884724e-04, -7.62265560e-04, 6.67703691e-04, -3.85625074e-04,
+	5.73493309e-05, 1.97651732e-04, -3.16602986e-04, 2.99606268e-04,
+	-1.92305746e-04, 5.73503993e-05, 5.21573678e-05, -1.08240054e-04,
+	1.10109072e-04, -7.58624492e-05, 2.99308639e-05, 7.78685269e-06,
+	-2.75577843e-05, 2.97554987e-05, -2.09958373e-05, 9.25204153e-06,
+	-2.35336161e-07, -3.94670742e-06, 4.12767716e-06, -2.44080120e-06,
+	-2.31595764e-06, 3.35462197e-06, -2.15215179e-06, -2.93124017e-06,
+	1.18515265e-05, -2.15946973e-05, 2.61350621e-05, -1.84054162e-05,
+	-5.85007778e-06, 4.37192894e-05, -8.26374069e-05, 1.02188423e-04,
+	-8.12597235e-05, 9.08086167e-06, 1.04104614e-04, -2.22582698e-04,
+	2.91876520e-04, -2.57722905e-04, 9.25797586e-05, 1.80615947e-04,
+	-4.80054005e-04, 6.81533428e-04, -6.60571091e-04, 3.48945421e-04,
+	2.15868235e-04, -8.73287911e-04, 1.37194641e-03, -1.45201413e-03,
+	9.55345136e-04, 7.73103761e-05, -1.36809351e-03, 2.45517262e-03,
+	-2.83817784e-03, 2.17731330e-03, -4.75091240e-04, -1.83999593e-03,
+	3.98609444e-03, -5.06306154e-03, 4.39006673e-03, -1.83039673e-03,
+	-2.03137421e-03, 5.96307099e-03, -8.43282377e-03, 8.14956176e-03,
+	-4.62180103e-03, -1.48076523e-03, 8.34270892e-03, -1.34633004e-02,
+	1.44722475e-02, -1.00604874e-02, 7.00341066e-04, 1.11492215e-02,
+	-2.15206877e-02, 2.60518503e-02, -2.14591792e-02, 6.93423782e-03,
+	1.49989372e-02, -3.84901741e-02, 5.52747776e-02, -5.61416155e-02,
+	3.20603572e-02, 2.73444613e-02, -1.48970715e-01, 5.66490422e-01,
+	6.47570842e-01, -1.12817477e-01, -7.17982748e-03, 5.51736089e-02,
+	-6.62982408e-02, 5.44318634e-02, -3.05478137e-02, 4.47201676e-03,
+	1.61031685e-02, -2.67416239e-02, 2.66744938e-02, -1.82886395e-02,
+	5.87578443e-03, 5.93874702e-03, -1.36051174e-02, 1.55119380e-02,
+	-1.21285065e-02, 5.49241160e-03, 1.69995985e-03, -7.05600600e-03,
+	9.19232514e-03, -8.00071050e-03, 4.46089858e-03, -1.34605019e-04,
+	-3.44229421e-03, 5.25405551e-03, -5.04291939e-03, 3.25612555e-03,
+	-7.70209280e-04, -1.47651668e-03, 2.80429488e-03, -2.96647910e-03,
+	2.14668818e-03, -8.12884189e-04, -4.94979962e-04, 1.35891751e-03,
+	-1.59629338e-03, 1.27035789e-03, -6.15557354e-04, -7.88846755e-05,
+	5.78207905e-04, -7.68161136e-04, 6.64730597e-04, -3.77065998e-04,
+	4.74266686e-05, 2.05420009e-04, -3.20378451e-04, 2.99373958e-04,
+	-1.89358454e-04, 5.34727071e-05, 5.54361943e-05, -1.10081675e-04,
+	1.10428139e-04, -7.51062729e-05, 2.87437195e-05, 8.85628120e-06,
+	-2.82130318e-05, 2.99611896e-05, -2.08871449e-05, 9.01507927e-06,
+	-1.57178215e-08, -4.08167101e-06, 4.17897258e-06, -2.44357095e-06,
+	-2.30000827e-06, 3.28819112e-06, -2.01312861e-06, -3.12378749e-06,
+	1.20126615e-05, -2.15790498e-05, 2.57893525e-05, -1.76635140e-05,
+	-6.86439915e-06, 4.46410730e-05, -8.29205502e-05, 1.01302443e-04,
+	-7.89832643e-05, 5.77914449e-06, 1.07374194e-04, -2.24270111e-04,
+	2.90474938e-04, -2.52513007e-04, 8.42993757e-05, 1.89531470e-04,
+	-4.85937683e-04, 6.80696029e-04, -6.50952123e-04, 3.31595708e-04,
+	2.36203554e-04, -8.89037241e-04, 1.37509464e-03, -1.43740516e-03,
+	9.23727125e-04, 1.17893744e-04, -1.40362566e-03, 2.46987102e-03,
+	-2.82056205e-03, 2.12605662e-03, -4.02151643e-04, -1.91093800e-03,
+	4.02637704e-03, -5.04941500e-03, 4.31522648e-03, -1.70970320e-03,
+	-2.16094622e-03, 6.05272601e-03, -8.43860286e-03, 8.05070301e-03,
+	-4.43393194e-03, -1.70384417e-03, 8.52170412e-03, -1.35186508e-02,
+	1.43548087e-02, -9.77714813e-03, 3.23914554e-04, 1.14927227e-02,
+	-2.16873844e-02, 2.59299084e-02, -2.10188044e-02, 6.26080461e-03,
+	1.57027029e-02, -3.89392920e-02, 5.51704382e-02, -5.52602175e-02,
+	3.03498290e-02, 2.96462163e-02, -1.50955959e-01, 5.60278616e-01,
+	6.52888632e-01, -1.09639975e-01, -9.77790745e-03, 5.67376176e-02,
+	-6.68532713e-02, 5.42053636e-02, -2.98696342e-02, 3.68327646e-03,
+	1.67289524e-02, -2.70492043e-02, 2.66400125e-02, -1.79966757e-02,
+	5.47163034e-03, 6.30468476e-03, -1.38238587e-02, 1.55414749e-02,
+	-1.19943547e-02, 5.26726076e-03, 1.92768327e-03, -7.21299280e-03,
+	9.24104259e-03, -7.94504187e-03, 4.33752038e-03, 4.67912153e-06,
+	-3.54998723e-03, 5.30154334e-03, -5.02628523e-03, 3.19285284e-03,
+	-6.89494790e-04, -1.54548242e-03, 2.84183024e-03, -2.96696381e-03,
+	2.11759694e-03, -7.69692962e-04, -5.35501704e-04, 1.38446192e-03,
+	-1.60208397e-03, 1.25906372e-03, -5.94752313e-04, -1.00328083e-04,
+	5.93335664e-04, -7.73764741e-04, 6.61485773e-04, -3.68335607e-04,
+	3.74597614e-05, 2.13126957e-04, -3.24036528e-04, 2.99021588e-04,
+	-1.86326916e-04, 4.95617802e-05, 5.87033437e-05, -1.11885421e-04,
+	1.10704122e-04, -7.43172267e-05, 2.75404479e-05, 9.92653472e-06,
+	-2.88597802e-05, 3.01557508e-05, -2.07694466e-05, 8.77314177e-06,
+	2.05255136e-07, -4.21589006e-06, 4.22893332e-06, -2.44530136e-06,
+	-2.28322789e-06, 3.22094100e-06, -1.87425870e-06, -3.31387233e-06,
+	1.21680402e-05, -2.15547857e-05, 2.54349036e-05, -1.69177780e-05,
+	-7.87180325e-06, 4.55414360e-05, -8.31695447e-05, 1.00379157e-04,
+	-7.66829345e-05, 2.48569077e-06, 1.10590993e-04, -2.25863308e-04,
+	2.88961807e-04, -2.47216990e-04, 7.60073979e-05, 1.98348877e-04,
+	-4.91613768e-04, 6.79590325e-04, -6.41097110e-04, 3.14153600e-04,
+	2.56400441e-04, -9.04400127e-04, 1.37769075e-03, -1.42225562e-03,
+	8.91805258e-04, 1.58352026e-04, -1.43853421e-03, 2.48356300e-03,
+	-2.80185978e-03, 2.07404767e-03, -3.29178993e-04, -1.98100201e-03,
+	4.06499652e-03, -5.03378978e-03, 4.23879746e-03, -1.58852519e-03,
+	-2.28945713e-03, 6.13984245e-03, -8.44102966e-03, 7.94880773e-03,
+	-4.24459636e-03, -1.92590346e-03, 8.69704592e-03, -1.35685598e-02,
+	1.42318705e-02, -9.49039431e-03, -5.20170743e-05, 1.18310857e-02,
+	-2.18451969e-02, 2.57979270e-02, -2.05709813e-02, 5.58633196e-03,
+	1.63986056e-02, -3.93718226e-02, 5.50445815e-02, -5.43601191e-02,
+	2.86350078e-02, 3.19220531e-02, -1.52861815e-01, 5.54018134e-01,
+	6.58136447e-01, -1.06383890e-01, -1.23890401e-02, 5.82864115e-02,
+	-6.73838074e-02, 5.39566524e-02, -2.91777933e-02, 2.89120044e-03,
+	1.73494533e-02, -2.73466705e-02, 2.65948980e-02, -1.76970498e-02,
+	5.06461093e-03, 6.66873043e-03, -1.40374710e-02, 1.55648935e-02,
+	-1.18552338e-02, 5.03966993e-03, 2.15499445e-03, -7.36736045e-03,
+	9.28616879e-03, -7.88613398e-03, 4.21222760e-03, 1.44181674e-04,
+	-3.65644352e-03, 5.34700381e-03, -5.00762850e-03, 3.12820689e-03,
+	-6.08369370e-04, -1.61395388e-03, 2.87830331e-03, -2.96627098e-03,
+	2.08761096e-03, -7.26114594e-04, -5.75888795e-04, 1.40950659e-03,
+	-1.60724948e-03, 1.24724552e-03, -5.73666352e-04, -1.21778650e-04,
+	6.08261534e-04, -7.79073465e-04, 6.57969865e-04, -3.59436960e-04,
+	2.74524727e-05, 2.20769337e-04, -3.27575435e-04, 2.98548959e-04,
+	-1.83212097e-04, 4.56190824e-05, 6.19574700e-05, -1.13650443e-04,
+	1.10936761e-04, -7.34955075e-05, 2.63214715e-05, 1.09971846e-05,
+	-2.94977309e-05, 3.03390517e-05, -2.06427455e-05, 8.52630106e-06,
+	4.27499383e-07, -4.34930302e-06, 4.27752706e-06, -2.44598124e-06,
+	-2.26563268e-06, 3.15290722e-06, -1.73559914e-06, -3.50143139e-06,
+	1.23176310e-05, -2.15219585e-05, 2.50718993e-05, -1.61685258e-05,
+	-8.87191331e-06, 4.64200999e-05, -8.33844159e-05, 9.94190646e-05,
+	-7.43597333e-05, -7.98210547e-07, 1.13753888e-04, -2.27361932e-04,
+	2.87338048e-04, -2.41837199e-04, 6.77071573e-05, 2.07064912e-04,
+	-4.97080515e-04, 6.78217400e-04, -6.31010517e-04, 2.96626239e-04,
+	2.76451174e-04, -9.19371291e-04, 1.37973487e-03, -1.40657261e-03,
+	8.59592808e-04, 1.98669403e-04, -1.47280650e-03, 2.49624501e-03,
+	-2.78208040e-03, 2.02130841e-03, -2.56202290e-04, -2.05016167e-03,
+	4.10194036e-03, -5.01619531e-03, 4.16081251e-03, -1.46691151e-03,
+	-2.41685769e-03, 6.22438976e-03, -8.44010840e-03, 7.84392098e-03,
+	-4.05387154e-03, -2.14685671e-03, 8.86867053e-03, -1.36130162e-02,
+	1.41034904e-02, -9.20034492e-03, -4.27305890e-04, 1.21641856e-02,
+	-2.19940784e-02, 2.56559768e-02, -2.01159016e-02, 4.91108817e-03,
+	1.70863894e-02, -3.97876392e-02, 5.48973216e-02, -5.34417383e-02,
+	2.69165750e-02, 3.41712735e-02, -1.54688418e-01, 5.47710400e-01,
+	6.63313069e-01, -1.03049461e-01, -1.50123258e-02, 5.98193195e-02,
+	-6.78895512e-02, 5.36857590e-02, -2.84725272e-02, 2.09609354e-03,
+	1.79644146e-02, -2.76338844e-02, 2.65391481e-02, -1.73898669e-02,
+	4.65488255e-03, 7.03073660e-03, -1.42458613e-02, 1.55821746e-02,
+	-1.17111913e-02, 4.80972560e-03, 2.38180257e-03, -7.51904365e-03,
+	9.32768029e-03, -7.82400517e-03, 4.08506697e-03, 2.83847602e-04,
+	-3.76161885e-03, 5.39041558e-03, -4.98695329e-03, 3.06221109e-03,
+	-5.26864554e-04, -1.68190300e-03, 2.91369772e-03, -2.96439878e-03,
+	2.05674050e-03, -6.82165685e-04, -6.16124914e-04, 1.43404057e-03,
+	-1.61178659e-03, 1.23490690e-03, -5.52307265e-04, -1.43227850e-04,
+	6.22979114e-04, -7.84084508e-04, 6.54183623e-04, -3.50373191e-04,
+	1.74086922e-05, 2.28343930e-04, -3.30993431e-04, 2.97955917e-04,
+	-1.80014996e-04, 4.16460943e-05, 6.51972280e-05, -1.15375905e-04,
+	1.11125810e-04, -7.26413261e-05, 2.50872207e-05, 1.20678003e-05,
+	-3.01265875e-05, 3.05109653e-05, -2.05070478e-05, 8.27463161e-06,
+	6.50930560e-07, -4.48184826e-06, 4.32472182e-06, -2.44559981e-06,
+	-2.24723902e-06, 3.08412549e-06, -1.59720651e-06, -3.68640279e-06,
+	1.24614046e-05, -2.14806248e-05, 2.47005267e-05, -1.54160747e-05,
+	-9.86435707e-06, 4.72767963e-05, -8.35652033e-05, 9.84226793e-05,
+	-7.20146659e-05, -4.07127849e-06, 1.16861782e-04, -2.28765663e-04,
+	2.85604621e-04, -2.36376007e-04, 5.94019804e-05, 2.15676363e-04,
+	-5.02336267e-04, 6.76578440e-04, -6.20696894e-04, 2.79020783e-04,
+	2.96348107e-04, -9.33945624e-04, 1.38122733e-03, -1.39036345e-03,
+	8.27103139e-04, 2.38830144e-04, -1.50643011e-03, 2.50791385e-03,
+	-2.76123372e-03, 1.96786105e-03, -1.83250489e-04, -2.11839108e-03,
+	4.13719669e-03, -4.99664182e-03, 4.08130510e-03, -1.34491107e-03,
+	-2.54309915e-03, 6.30633845e-03, -8.43584465e-03, 7.73608896e-03,
+	-3.86183520e-03, -2.36661811e-03, 9.03651577e-03, -1.36520110e-02,
+	1.39697277e-02, -8.90712008e-03, -8.01804462e-04, 1.24918995e-02,
+	-2.21339861e-02, 2.55041327e-02, -1.96537593e-02, 4.23534130e-03,
+	1.77658022e-02, -4.01866221e-02, 5.47287805e-02, -5.25054988e-02,
+	2.51952102e-02, 3.63931934e-02, -1.56435923e-01, 5.41356848e-01,
+	6.68417294e-01, -9.96369490e-02, -1.76468551e-02, 6.13356738e-02,
+	-6.83702131e-02, 5.33927217e-02, -2.77540780e-02, 1.29826248e-03,
+	1.85735812e-02, -2.79107118e-02, 2.64727649e-02, -1.70752350e-02,
+	4.24260287e-03, 7.39055641e-03, -1.44489386e-02, 1.55933018e-02,
+	-1.15622766e-02, 4.57751530e-03, 2.60801687e-03, -7.66797808e-03,
+	9.36555499e-03, -7.75867509e-03, 3.95608603e-03, 4.23621720e-04,
+	-3.86546940e-03, 5.43175810e-03, -4.96426450e-03, 2.99488940e-03,
+	-4.45012074e-04, -1.74930187e-03, 2.94799749e-03, -2.96134582e-03,
+	2.02499622e-03, -6.37863013e-04, -6.56193767e-04, 1.45805308e-03,
+	-1.61569223e-03, 1.22205169e-03, -5.30682973e-04, -1.64667139e-04,
+	6.37482073e-04, -7.88795180e-04, 6.50127910e-04, -3.41147505e-04,
+	7.33233399e-06, 2.35847532e-04, -3.34288824e-04, 2.97242360e-04,
+	-1.76736652e-04, 3.76443135e-05, 6.84212741e-05, -1.17060982e-04,
+	1.11271043e-04, -7.17549073e-05, 2.38381337e-05, 1.31379495e-05,
+	-3.07460559e-05, 3.06713690e-05, -2.03623639e-05, 8.01821026e-06,
+	8.75463307e-07, -4.61346410e-06, 4.37048600e-06, -2.44414666e-06,
+	-2.22806354e-06, 3.01463155e-06, -1.45913688e-06, -3.86872611e-06,
+	1.25993346e-05, -2.14308444e-05, 2.43209751e-05, -1.46607421e-05,
+	-1.08487669e-05, 4.81112663e-05, -8.37119595e-05, 9.73905267e-05,
+	-6.96487427e-05, -7.33224049e-06, 1.19913604e-04, -2.30074222e-04,
+	2.83762530e-04, -2.30835811e-04, 5.10951868e-05, 2.24180071e-04,
+	-5.07379456e-04, 6.74674737e-04, -6.10160870e-04, 2.61344406e-04,
+	3.16083671e-04, -9.48118183e-04, 1.38216868e-03, -1.37363563e-03,
+	7.94349698e-04, 2.78818608e-04, -1.53939292e-03, 2.51856678e-03,
+	-2.73932992e-03, 1.91372804e-03, -1.10352484e-04, -2.18566475e-03,
+	4.17075436e-03, -4.97514027e-03, 4.00030919e-03, -1.22257285e-03,
+	-2.66813330e-03, 6.38566012e-03, -8.42824531e-03, 7.62535894e-03,
+	-3.66856543e-03, -2.58510245e-03, 9.20052101e-03, -1.36855372e-02,
+	1.38306441e-02, -8.61084096e-03, -1.17536592e-03, 1.28141070e-02,
+	-2.22648804e-02, 2.53424730e-02, -1.91847508e-02, 3.55935902e-03,
+	1.84365960e-02, -4.05686582e-02, 5.45390880e-02, -5.15518294e-02,
+	2.34715916e-02, 3.85871419e-02, -1.58104509e-01, 5.34958919e-01,
+	6.73447936e-01, -9.61466376e-02, -2.02917087e-02, 6.28348095e-02,
+	-6.88255123e-02, 5.30775872e-02, -2.70226938e-02, 4.98015820e-04,
+	1.91766998e-02, -2.81770224e-02, 2.63957546e-02, -1.67532653e-02,
+	3.82793084e-03, 7.74804361e-03, -1.46466136e-02, 1.55982607e-02,
+	-1.14085412e-02, 4.34312762e-03, 2.83354670e-03, -7.81410040e-03,
+	9.39977226e-03, -7.69016468e-03, 3.82533313e-03, 5.63448709e-04,
+	-3.96795182e-03, 5.47101159e-03, -4.93956783e-03, 2.92626635e-03,
+	-3.62843859e-04, -1.81612276e-03, 2.98118707e-03, -2.95711119e-03,
+	1.99238912e-03, -5.93223527e-04, -6.96079098e-04, 1.48153356e-03,
+	-1.61896356e-03, 1.20868394e-03, -5.08801518e-04, -1.86087958e-04,
+	6.51764148e-04, -7.93202909e-04, 6.45803698e-04, -3.31763182e-04,
+	-2.77266495e-06, 2.43276961e-04, -3.37459960e-04, 2.96408232e-04,
+	-1.73378136e-04, 3.36152538e-05, 7.16282666e-05, -1.18704865e-04,
+	1.11372247e-04, -7.08364894e-05, 2.25746564e-05, 1.42071984e-05,
+	-3.13558447e-05, 3.08201441e-05, -2.02087076e-05, 7.75711628e-06,
+	1.10101129e-06, -4.74408886e-06, 4.41478838e-06, -2.44161179e-06,
+	-2.20812305e-06, 2.94446115e-06, -1.32144583e-06, -4.04834241e-06,
+	1.27313968e-05, -2.13726803e-05, 2.39334363e-05, -1.39028449e-05,
+	-1.18247798e-05, 4.89232612e-05, -8.38247509e-05, 9.63231450e-05,
+	-6.72629792e-05, -1.05798329e-05, 1.22908307e-04, -2.31287367e-04,
+	2.81812816e-04, -2.25219036e-04, 4.27900883e-05, 2.32572929e-04,
+	-5.12208603e-04, 6.72507682e-04, -5.99407152e-04, 2.43604294e-04,
+	3.35650380e-04, -9.61884197e-04, 1.38255970e-03, -1.35639686e-03,
+	7.61346011e-04, 3.18619255e-04, -1.57168310e-03, 2.52820144e-03,
+	-2.71637961e-03, 1.85893208e-03, -3.75370961e-05, -2.25195765e-03,
+	4.20260290e-03, -4.95170240e-03, 3.91785933e-03, -1.09994589e-03,
+	-2.79191251e-03, 6.46232744e-03, -8.41731856e-03, 7.51177927e-03,
+	-3.47414071e-03, -2.80222517e-03, 9.36062726e-03, -1.37135902e-02,
+	1.36863029e-02, -8.31162978e-03, -1.54784400e-03, 1.31306901e-02,
+	-2.23867257e-02, 2.51710800e-02, -1.87090751e-02, 2.88340853e-03,
+	1.90985265e-02, -4.09336416e-02, 5.43283819e-02, -5.05811644e-02,
+	2.17463948e-02, 4.07524624e-02, -1.59694372e-01, 5.28518065e-01,
+	6.78403822e-01, -9.25788320e-02, -2.29459582e-02, 6.43160652e-02,
+	-6.92551767e-02, 5.27404111e-02, -2.62786281e-02, -3.04336237e-04,
+	1.97735186e-02, -2.84326897e-02, 2.63081276e-02, -1.64240724e-02,
+	3.41102665e-03, 8.10305264e-03, -1.48387994e-02, 1.55970397e-02,
+	-1.12500383e-02, 4.10665214e-03, 3.05830152e-03, -7.95734827e-03,
+	9.43031284e-03, -7.61849619e-03, 3.69285740e-03, 7.03273146e-04,
+	-4.06902324e-03, 5.50815709e-03, -4.91286978e-03, 2.85636702e-03,
+	-2.80392016e-04, -1.88233812e-03, 3.01325131e-03, -2.95169445e-03,
+	1.95893059e-03, -5.48264344e-04, -7.35764690e-04, 1.50447160e-03,
+	-1.62159800e-03, 1.19480790e-03, -4.86671063e-04, -2.07481736e-04,
+	6.65819154e-04, -7.97305233e-04, 6.41212068e-04, -3.22223573e-04,
+	-1.29023461e-05, 2.50629057e-04, -3.40505236e-04, 2.95453524e-04,
+	-1.69940555e-04, 2.95604442e-05, 7.48168667e-05, -1.20306758e-04,
+	1.11429230e-04, -6.98863247e-05, 2.12972424e-05, 1.52751117e-05,
+	-3.19556651e-05, 3.09571762e-05, -2.00460968e-05, 7.49143127e-06,
+	1.32748723e-06, -4.87366083e-06, 4.45759813e-06, -2.43798562e-06,
+	-2.18743459e-06, 2.87365009e-06, -1.18418837e-06, -4.22519424e-06,
+	1.28575697e-05, -2.13061985e-05, 2.35381044e-05, -1.31427001e-05,
+	-1.27920379e-05, 4.97125423e-05, -8.39036573e-05, 9.52210846e-05,
+	-6.48583955e-05, -1.38128014e-05, 1.25844873e-04, -2.32404896e-04,
+	2.79756562e-04, -2.19528128e-04, 3.44899871e-05, 2.40851878e-04,
+	-5.16822316e-04, 6.70078769e-04, -5.88440522e-04, 2.25807642e-04,
+	3.55040829e-04, -9.75239068e-04, 1.38240138e-03, -1.33865500e-03,
+	7.28105675e-04, 3.58216648e-04, -1.60328910e-03, 2.53681587e-03,
+	-2.69239377e-03, 1.80349608e-03, 3.51669346e-05, -2.31724514e-03,
+	4.23273253e-03, -4.92634068e-03, 3.83399054e-03, -9.77079251e-04,
+	-2.91438968e-03, 6.53631418e-03, -8.40307392e-03, 7.39539937e-03,
+	-3.27863983e-03, -3.01790236e-03, 9.51677717e-03, -1.37361673e-02,
+	1.35367696e-02, -8.00960967e-03, -1.91909311e-03, 1.34415331e-02,
+	-2.24994898e-02, 2.49900395e-02, -1.82269332e-02, 2.20775644e-03,
+	1.97513537e-02, -4.12814732e-02, 5.40968076e-02, -4.95939429e-02,
+	2.00202934e-02, 4.28885122e-02, -1.61205732e-01, 5.22035741e-01,
+	6.83283798e-01, -8.89338602e-02, -2.56086660e-02, 6.57787833e-02,
+	-6.96589429e-02, 5.23812576e-02, -2.55221402e-02, -1.10848191e-03,
+	2.03637882e-02, -2.86775911e-02, 2.62098986e-02, -1.60877735e-02,
+	2.99205163e-03, 8.45543869e-03, -1.50254107e-02, 1.55896292e-02,
+	-1.10868234e-02, 3.86817940e-03, 3.28219097e-03, -8.09766043e-03,
+	9.45715892e-03, -7.54369316e-03, 3.55870872e-03, 8.43039516e-04,
+	-4.16864128e-03, 5.54317644e-03, -4.88417769e-03, 2.78521706e-03,
+	-1.97688818e-04, -1.94792059e-03, 3.04417548e-03, -2.94509562e-03,
+	1.92463235e-03, -5.03002738e-04, -7.75234375e-04, 1.52685701e-03,
+	-1.62359322e-03, 1.18042803e-03, -4.64299887e-04, -2.28839895e-04,
+	6.79640979e-04, -8.01099810e-04, 6.36354210e-04, -3.12532099e-04,
+	-2.30527309e-05, 2.57900680e-04, -3.43423090e-04, 2.94378278e-04,
+	-1.66425053e-04, 2.54814290e-05, 7.79857384e-05, -1.21865877e-04,
+	1.11441814e-04, -6.89046793e-05, 2.00063524e-05, 1.63412529e-05,
+	-3.25452312e-05, 3.10823551e-05, -1.98745527e-05, 7.22123919e-06,
+	1.55480295e-06, -5.00211839e-06, 4.49888486e-06, -2.43325899e-06,
+	-2.16601538e-06, 2.80223415e-06, -1.04741896e-06, -4.39922564e-06,
+	1.29778344e-05, -2.12314683e-05, 2.31351760e-05, -1.23806239e-05,
+	-1.37501881e-05, 5.04788809e-05, -8.39487717e-05, 9.40849082e-05,
+	-6.24360157e-05, -1.70299017e-05, 1.28722308e-04, -2.33426645e-04,
+	2.77594891e-04, -2.13765557e-04, 2.61981744e-05, 2.49013916e-04,
+	-5.21219293e-04, 6.67389595e-04, -5.77265836e-04, 2.07961652e-04,
+	3.74247701e-04, -9.88178368e-04, 1.38169492e-03, -1.32041814e-03,
+	6.94642356e-04, 3.97595463e-04, -1.63419967e-03, 2.54440855e-03,
+	-2.66738379e-03, 1.74744314e-03, 1.07730963e-04, -2.38150304e-03,
+	4.26113418e-03, -4.89906833e-03, 3.74873839e-03, -8.54022031e-04,
+	-3.03551833e-03, 6.60759522e-03, -8.38552218e-03, 7.27626969e-03,
+	-3.08214192e-03, -3.23205083e-03, 9.66891503e-03, -1.37532683e-02,
+	1.33821118e-02, -7.70490473e-03, -2.28896838e-03, 1.37465228e-02,
+	-2.26031443e-02, 2.47994410e-02, -1.77385282e-02, 1.53266871e-03,
+	2.03948414e-02, -4.16120607e-02, 5.38445184e-02, -4.85906089e-02,
+	1.82939581e-02, 4.49946629e-02, -1.62638828e-01, 5.15513413e-01,
+	6.88086725e-01, -8.52120721e-02, -2.82788855e-02, 6.72223100e-02,
+	-7.00365566e-02, 5.20002000e-02, -2.47534951e-02, -1.91410797e-03,
+	2.09472611e-02, -2.89116081e-02, 2.61010864e-02, -1.57444892e-02,
+	2.57116821e-03, 8.80505771e-03, -1.52063645e-02, 1.55760225e-02,
+	-1.09189537e-02, 3.62780089e-03, 3.50512491e-03, -8.23497667e-03,
+	9.48029414e-03, -7.46578039e-03, 3.42293772e-03, 9.82692245e-04,
+	-4.26676406e-03, 5.57605228e-03, -4.85349965e-03, 2.71284262e-03,
+	-1.14766694e-04, -2.01284303e-03, 3.07394528e-03, -2.93731519e-03,
+	1.88950650e-03, -4.57456137e-04, -8.14472042e-04, 1.54867981e-03,
+	-1.62494712e-03, 1.16554902e-03, -4.41696383e-04, -2.50153852e-04,
+	6.93223592e-04, -8.04584413e-04, 6.31231425e-04, -3.02692249e-04,
+	-3.32198226e-05, 2.65088715e-04, -3.46212011e-04, 2.93182581e-04,
+	-1.62832806e-04, 2.13797668e-05, 8.11335494e-05, -1.23381458e-04,
+	1.11409840e-04, -6.78918328e-05, 1.87024544e-05, 1.74051845e-05,
+	-3.31242599e-05, 3.11955751e-05, -1.96941008e-05, 6.94662631e-06,
+	1.78286939e-06, -5.12939994e-06, 4.53861859e-06, -2.42742318e-06,
+	-2.14388280e-06, 2.73024909e-06, -9.11191496e-07, -4.57038216e-06,
+	1.30921746e-05, -2.11485618e-05, 2.27248495e-05, -1.16169320e-05,
+	-1.46988825e-05, 5.12220585e-05, -8.39602004e-05, 9.29151899e-05,
+	-5.99968677e-05, -2.02298996e-05, 1.31539645e-04, -2.34352491e-04,
+	2.75328965e-04, -2.07933815e-04, 1.79179299e-05, 2.57056094e-04,
+	-5.25398323e-04, 6.64441852e-04, -5.65888022e-04, 1.90073528e-04,
+	3.93263768e-04, -1.00069785e-03, 1.38044175e-03, -1.30169451e-03,
+	6.60969780e-04, 4.36740489e-04, -1.66440384e-03, 2.55097834e-03,
+	-2.64136145e-03, 1.69079661e-03, 1.80126447e-04, -2.44470761e-03,
+	4.28779948e-03, -4.86989932e-03, 3.66213891e-03, -7.30823316e-04,
+	-3.15525258e-03, 6.67614656e-03, -8.36467544e-03, 7.15444167e-03,
+	-2.88472636e-03, -3.44458811e-03, 9.81698681e-03, -1.37648948e-02,
+	1.32223986e-02, -7.39763987e-03, -2.65732574e-03, 1.40455487e-02,
+	-2.26976643e-02, 2.45993776e-02, -1.72440654e-02, 8.58410465e-04,
+	2.10287579e-02, -4.19253191e-02, 5.35716749e-02, -4.75716110e-02,
+	1.65680572e-02, 4.70703003e-02, -1.63993922e-01, 5.08952550e-01,
+	6.92811483e-01, -8.14138403e-02, -3.09556617e-02, 6.86459958e-02,
+	-7.03877729e-02, 5.15973198e-02, -2.39729630e-02, -2.72089986e-03,
+	2.15236917e-02, -2.91346262e-02, 2.59817142e-02, -1.53943428e-02,
+	2.14853986e-03, 9.15176655e-03, -1.53815800e-02, 1.55562150e-02,
+	-1.07464887e-02, 3.38560899e-03, 3.72701340e-03, -8.36923787e-03,
+	9.49970356e-03, -7.38478397e-03, 3.28559575e-03, 1.12217571e-03,
+	-4.36335022e-03, 5.60676810e-03, -4.82084461e-03, 2.63927043e-03,
+	-3.16582149e-05, -2.07707850e-03, 3.10254684e-03, -2.92835414e-03,
+	1.85356548e-03, -4.11642117e-04, -8.53461638e-04, 1.56993019e-03,
+	-1.62565788e-03, 1.15017575e-03, -4.18869054e-04, -2.71415023e-04,
+	7.06561044e-04, -8.07756934e-04, 6.25845121e-04, -2.92707582e-04,
+	-4.33996074e-05, 2.72190075e-04, -3.48870532e-04, 2.91866572e-04,
+	-1.59165026e-04, 1.72570300e-05, 8.42589720e-05, -1.24852745e-04,
+	1.11333166e-04, -6.68480784e-05, 1.73860236e-05, 1.84664680e-05,
+	-3.36924713e-05, 3.12967347e-05, -1.95047700e-05, 6.66768120e-06,
+	2.01159663e-06, -5.25544398e-06, 4.57676982e-06, -2.42046988e-06,
+	-2.12105443e-06, 2.65773064e-06, -7.75559250e-07, -4.73861091e-06,
+	1.32005762e-05, -2.10575542e-05, 2.23073259e-05, -1.08519395e-05,
+	-1.56377783e-05, 5.19418667e-05, -8.39380628e-05, 9.17125154e-05,
+	-5.75419828e-05, -2.34115718e-05, 1.34295944e-04, -2.35182347e-04,
+	2.72959981e-04, -2.02035416e-04, 9.65251972e-06, 2.64975518e-04,
+	-5.29358283e-04, 6.61237335e-04, -5.54312076e-04, 1.72150475e-04,
+	4.12081894e-04, -1.01279343e-03, 1.37864350e-03, -1.28249254e-03,
+	6.27101732e-04, 4.75636639e-04, -1.69389098e-03, 2.55652453e-03,
+	-2.61433890e-03, 1.63358001e-03, 2.52324965e-04, -2.50683559e-03,
+	4.31272076e-03, -4.83884832e-03, 3.57422863e-03, -6.07532169e-04,
+	-3.27354718e-03, 6.74194529e-03, -8.34054708e-03, 7.02996776e-03,
+	-2.68647277e-03, -3.65543251e-03, 9.96094018e-03, -1.37710510e-02,
+	1.30577015e-02, -7.08794084e-03, -3.02402194e-03, 1.43385026e-02,
+	-2.27830287e-02, 2.43899461e-02, -1.67437521e-02, 1.85245982e-04,
+	2.16528757e-02, -4.22211702e-02, 5.32784455e-02, -4.65374024e-02,
+	1.48432554e-02, 4.91148248e-02, -1.65271292e-01, 5.02354632e-01,
+	6.97456966e-01, -7.75395594e-02, -3.36380313e-02, 7.00491954e-02,
+	-7.07123556e-02, 5.11727078e-02, -2.31808196e-02, -3.52854184e-03,
+	2.20928370e-02, -2.93465350e-02, 2.58518092e-02, -1.50374607e-02,
+	1.72433102e-03, 9.49542295e-03, -1.55509784e-02, 1.55302047e-02,
+	-1.05694893e-02, 3.14169693e-03, 3.94776681e-03, -8.50038604e-03,
+	9.51537373e-03, -7.30073126e-03, 3.14673487e-03, 1.26143428e-03,
+	-4.45835898e-03, 5.63530820e-03, -4.78622228e-03, 2.56452770e-03,
+	5.16039190e-05, -2.14060028e-03, 3.12996675e-03, -2.91821390e-03,
+	1.81682207e-03, -3.65578390e-04, -8.92187180e-04, 1.59059858e-03,
+	-1.62572390e-03, 1.13431332e-03, -3.95826511e-04, -2.92614826e-04,
+	7.19647470e-04, -8.10615387e-04, 6.20196814e-04, -2.82581722e-04,
+	-5.35880564e-05, 2.79201695e-04, -3.51397237e-04, 2.90430436e-04,
+	-1.55422958e-04, 1.31148044e-05, 8.73606828e-05, -1.26279004e-04,
+	1.11211667e-04, -6.57737231e-05, 1.60575420e-05, 1.95246644e-05,
+	-3.42495886e-05, 3.13857370e-05, -1.93065931e-05, 6.38449471e-06,
+	2.24089396e-06, -5.38018913e-06, 4.61330950e-06, -2.41239126e-06,
+	-2.09754799e-06, 2.58471449e-06, -6.40574888e-07, -4.90386051e-06,
+	1.33030281e-05, -2.09585236e-05, 2.18828076e-05, -1.00859604e-05,
+	-1.65665385e-05, 5.26381073e-05, -8.38824916e-05, 9.04774816e-05,
+	-5.50723949e-05, -2.65737064e-05, 1.36990293e-04, -2.35916165e-04,
+	2.70489179e-04, -1.96072891e-04, 1.40519541e-06, 2.72769351e-04,
+	-5.33098141e-04, 6.57777935e-04, -5.42543063e-04, 1.54199697e-04,
+	4.30695036e-04, -1.02446122e-03, 1.37630203e-03, -1.26282083e-03,
+	5.93052043e-04, 5.14268955e-04, -1.72265072e-03, 2.56104680e-03,
+	-2.58632866e-03, 1.57581703e-03, 3.24298219e-04, -2.56786416e-03,
+	4.33589104e-03, -4.80593075e-03, 3.48504451e-03, -4.84197612e-04,
+	-3.39035752e-03, 6.80496964e-03, -8.31315177e-03, 6.90290137e-03,
+	-2.48746098e-03, -3.86450312e-03, 1.01007245e-02, -1.37717428e-02,
+	1.28880934e-02, -6.77593414e-03, -3.38891463e-03, 1.46252789e-02,
+	-2.28592199e-02, 2.41712466e-02, -1.62377974e-02, -4.86561472e-04,
+	2.22669715e-02, -4.24995428e-02, 5.29650058e-02, -4.54884404e-02,
+	1.31202145e-02, 5.11276514e-02, -1.66471241e-01, 4.95721141e-01,
+	7.02022089e-01, -7.35896460e-02, -3.63250228e-02, 7.14312686e-02,
+	-7.10100783e-02, 5.07264631e-02, -2.23773460e-02, -4.33671705e-03,
+	2.26544560e-02, -2.95472284e-02, 2.57114030e-02, -1.46739722e-02,
+	1.29870703e-03, 9.83588562e-03, -1.57144830e-02, 1.54979920e-02,
+	-1.03880188e-02, 2.89615879e-03, 4.16729580e-03, -8.62836433e-03,
+	9.52729262e-03, -7.21365085e-03, 3.00640781e-03, 1.40041230e-03,
+	-4.55175008e-03, 5.66165773e-03, -4.74964318e-03, 2.48864217e-03,
+	1.34986891e-04, -2.20338190e-03, 3.15619202e-03, -2.90689638e-03,
+	1.77928942e-03, -3.19282803e-04, -9.30632759e-04, 1.61067561e-03,
+	-1.62514387e-03, 1.11796701e-03, -3.72577468e-04, -3.13744684e-04,
+	7.32477092e-04, -8.13157902e-04, 6.14288131e-04, -2.72318359e-04,
+	-6.37811267e-05, 2.86120541e-04, -3.53790757e-04, 2.88874407e-04,
+	-1.51607880e-04, 8.95468822e-06, 9.04373640e-05, -1.27659511e-04,
+	1.11045236e-04, -6.46690871e-05, 1.47174983e-05, 2.05793340e-05,
+	-3.47953384e-05, 3.14624895e-05, -1.90996068e-05, 6.09715992e-06,
+	2.47066988e-06, -5.50357416e-06, 4.64820906e-06, -2.40317991e-06,
+	-2.07338137e-06, 2.51123624e-06, -5.06290435e-07, -5.06608117e-06,
+	1.33995213e-05, -2.08515510e-05, 2.14514994e-05, -9.31930786e-06,
+	-1.74848310e-05, 5.33105925e-05, -8.37936322e-05, 8.92106964e-05,
+	-5.25891407e-05, -2.97151029e-05, 1.39621807e-04, -2.36553937e-04,
+	2.67917832e-04, -1.90048791e-04, -6.82080721e-06, 2.80434812e-04,
+	-5.36616955e-04, 6.54065640e-04, -5.30586113e-04, 1.36228391e-04,
+	4.49096249e-04, -1.03569749e-03, 1.37341939e-03, -1.24268813e-03,
+	5.58834593e-04, 5.52622611e-04, -1.75067303e-03, 2.56454525e-03,
+	-2.55734363e-03, 1.51753157e-03, 3.96018051e-04, -2.62777099e-03,
+	4.35730407e-03, -4.77116273e-03, 3.39462398e-03, -3.60868607e-04,
+	-3.50563964e-03, 6.86519900e-03, -8.28250544e-03, 6.77329686e-03,
+	-2.28777102e-03, -4.07171986e-03, 1.02362909e-02, -1.37669786e-02,
+	1.27136492e-02, -6.46174699e-03, -3.75186240e-03, 1.49057748e-02,
+	-2.29262240e-02, 2.39433828e-02, -1.57264121e-02, -1.15674972e-03,
+	2.28708268e-02, -4.27603728e-02, 5.26315387e-02, -4.44251864e-02,
+	1.13995927e-02, 5.31082097e-02, -1.67594090e-01, 4.89053566e-01,
+	7.06505783e-01, -6.95645392e-02, -3.90156570e-02, 7.27915800e-02,
+	-7.12807240e-02, 5.02586938e-02, -2.15628281e-02, -5.14510770e-03,
+	2.32083104e-02, -2.97366043e-02, 2.55605312e-02, -1.43040093e-02,
+	8.71834080e-04, 1.01730143e-02, -1.58720194e-02, 1.54595799e-02,
+	-1.02021420e-02, 2.64908942e-03, 4.38551140e-03, -8.75311707e-03,
+	9.53544970e-03, -7.12357261e-03, 2.86466798e-03, 1.53905417e-03,
+	-4.64348387e-03, 5.68580268e-03, -4.71111863e-03, 2.41164208e-03,
+	2.18457782e-04, -2.26539715e-03, 3.18121013e-03, -2.89440396e-03,
+	1.74098099e-03, -2.72773328e-04, -9.68782546e-04, 1.63015213e-03,
+	-1.62391669e-03, 1.10114235e-03, -3.49130740e-04, -3.34796031e-04,
+	7.45044222e-04, -8.15382736e-04, 6.08120805e-04, -2.61921248e-04,
+	-7.39747637e-05, 2.92943606e-04, -3.56049773e-04, 2.87198769e-04,
+	-1.47721103e-04, 4.77829189e-06, 9.34877036e-05, -1.28993563e-04,
+	1.10833784e-04, -6.35345040e-05, 1.33663876e-05, 2.16300368e-05,
+	-3.53294507e-05, 3.15269043e-05, -1.88838515e-05, 5.80577215e-06,
+	2.70083216e-06, -5.62553799e-06, 4.68144044e-06, -2.39282890e-06,
+	-2.04857259e-06, 2.43733144e-06, -3.72757261e-07, -5.22522464e-06,
+	1.34900495e-05, -2.07367203e-05, 2.10136076e-05, -8.55229408e-06,
+	-1.83923298e-05, 5.39591448e-05, -8.36716429e-05, 8.79127780e-05,
+	-5.00932587e-05, -3.28345732e-05, 1.42189629e-04, -2.37095692e-04,
+	2.65247252e-04, -1.83965686e-04, -1.50222694e-05, 2.87969180e-04,
+	-5.39913874e-04, 6.50102536e-04, -5.18446416e-04, 1.18243746e-04,
+	4.67278688e-04, -1.04649871e-03, 1.36999786e-03, -1.22210339e-03,
+	5.24463298e-04, 5.90682922e-04, -1.77794817e-03, 2.56702037e-03,
+	-2.52739708e-03, 1.45874767e-03, 4.67456452e-04, -2.68653423e-03,
+	4.37695430e-03, -4.73456108e-03, 3.30300491e-03, -2.37594035e-04,
+	-3.61935027e-03, 6.92261386e-03, -8.24862530e-03, 6.64120951e-03,
+	-2.08748303e-03, -4.27700353e-03, 1.03675922e-02, -1.37567687e-02,
+	1.25344458e-02, -6.14550726e-03, -4.11272485e-03, 1.51798900e-02,
+	-2.29840309e-02, 2.37064618e-02, -1.52098091e-02, -1.82505776e-03,
+	2.34642273e-02, -4.30036030e-02, 5.22782347e-02, -4.33481058e-02,
+	9.68204437e-03, 5.50559444e-02, -1.68640178e-01, 4.82353401e-01,
+	7.10906999e-01, -6.54646999e-02, -4.17089473e-02, 7.41294991e-02,
+	-7.15240852e-02, 4.97695165e-02, -2.07375574e-02, -5.95339513e-03,
+	2.37541643e-02, -2.99145650e-02, 2.53992338e-02, -1.39277069e-02,
+	4.43879143e-04, 1.05066698e-02, -1.60235156e-02, 1.54149737e-02,
+	-1.00119258e-02, 2.40058443e-03, 4.60232500e-03, -8.87458978e-03,
+	9.53983592e-03, -7.03052761e-03, 2.72156943e-03, 1.67730432e-03,
+	-4.73352127e-03, 5.70772989e-03, -4.67066073e-03, 2.33355615e-03,
+	3.01983579e-04, -2.32662004e-03, 3.20500901e-03, -2.88073950e-03,
+	1.70191059e-03, -2.26068056e-04, -1.00662080e-03, 1.64901920e-03,
+	-1.62204157e-03, 1.08384502e-03, -3.25495241e-04, -3.55760313e-04,
+	7.57343262e-04, -8.17288265e-04, 6.01696675e-04, -2.51394203e-04,
+	-8.41649019e-05, 2.99667916e-04, -3.58173017e-04, 2.85403855e-04,
+	-1.43763973e-04, 5.87237218e-07, 9.65103961e-05, -1.30280469e-04,
+	1.10577238e-04, -6.23703208e-05, 1.20047118e-05, 2.26763326e-05,
+	-3.58516590e-05, 3.15788984e-05, -1.86593714e-05, 5.51042889e-06,
+	2.93128783e-06, -5.74601976e-06, 4.71297609e-06, -2.38133177e-06,
+	-2.02313979e-06, 2.36303553e-06, -2.40026063e-07, -5.38124428e-06,
+	1.35746090e-05, -2.06141181e-05, 2.05693404e-05, -7.78522987e-06,
+	-1.92887142e-05, 5.45835968e-05, -8.35166948e-05, 8.65843552e-05,
+	-4.75857889e-05, -3.59309417e-05, 1.44692931e-04, -2.37541498e-04,
+	2.62478784e-04, -1.77826160e-04, -2.31959907e-05, 2.95369793e-04,
+	-5.42988137e-04, 6.45890800e-04, -5.06129227e-04, 1.00252940e-04,
+	4.85235609e-04, -1.05686151e-03, 1.36603993e-03, -1.20107569e-03,
+	4.89952109e-04, 6.28435345e-04, -1.80446673e-03, 2.56847308e-03,
+	-2.49650261e-03, 1.39948953e-03, 5.38585573e-04, -2.74413251e-03,
+	4.39483688e-03, -4.69614335e-03, 3.21022554e-03, -1.14422677e-04,
+	-3.73144682e-03, 6.97719589e-03, -8.21152979e-03, 6.50669550e-03,
+	-1.88667728e-03, -4.48027579e-03, 1.04945831e-02, -1.37411258e-02,
+	1.23505616e-02, -5.82734343e-03, -4.47136264e-03, 1.54475269e-02,
+	-2.30326340e-02, 2.34605939e-02, -1.46882026e-02, -2.49122590e-03,
+	2.40469635e-02, -4.32291833e-02, 5.19052910e-02, -4.22576676e-02,
+	7.96821993e-03, 5.69703149e-02, -1.69609868e-01, 4.75622145e-01,
+	7.15224704e-01, -6.12906111e-02, -4.44038998e-02, 7.54444015e-02,
+	-7.17399643e-02, 4.92590566e-02, -1.99018300e-02, -6.76125998e-03,
+	2.42917846e-02, -3.00810170e-02, 2.52275549e-02, -1.35452027e-02,
+	1.50099068e-05, 1.08367142e-02, -1.61689016e-02, 1.53641811e-02,
+	-9.81743865e-03, 2.15074017e-03, 4.81764842e-03, -8.99272919e-03,
+	9.54044369e-03, -6.93454818e-03, 2.57716684e-03, 1.81510724e-03,
+	-4.82182383e-03, 5.72742708e-03, -4.62828239e-03, 2.25441359e-03,
+	3.85531195e-04, -2.38702490e-03, 3.22757704e-03, -2.86590631e-03,
+	1.66209234e-03, -1.79185190e-04, -1.04413188e-03, 1.66726813e-03,
+	-1.61951793e-03, 1.06608094e-03, -3.01679978e-04, -3.76628990e-04,
+	7.69368710e-04, -8.18872989e-04, 5.95017690e-04, -2.40741104e-04,
+	-9.43474671e-05, 3.06290527e-04, -3.60159270e-04, 2.83490043e-04,
+	-1.39737865e-04, -3.61684317e-06, 9.95041428e-05, -1.31519558e-04,
+	1.10275547e-04, -6.11768976e-05, 1.06329785e-05, 2.37177813e-05,
+	-3.63617006e-05, 3.16183930e-05, -1.84262146e-05, 5.21122980e-06,
+	3.16194327e-06, -5.86495882e-06, 4.74278901e-06, -2.36868252e-06,
+	-1.99710124e-06, 2.28838383e-06, -1.08146847e-07, -5.53409500e-06,
+	1.36531983e-05, -2.04838338e-05, 2.01189075e-05, -7.01842476e-06,
+	-2.01736696e-05, 5.51837918e-05, -8.33289717e-05, 8.52260669e-05,
+	-4.50677727e-05, -3.90030457e-05, 1.47130912e-04, -2.37891462e-04,
+	2.59613812e-04, -1.71632814e-04, -3.13387904e-05, 3.02634047e-04,
+	-5.45839073e-04, 6.41432708e-04, -4.93639856e-04, 8.22631394e-05,
+	5.02960374e-04, -1.06678273e-03, 1.36154827e-03, -1.17961428e-03,
+	4.55315006e-04, 6.65865491e-04, -1.83021962e-03, 2.56890469e-03,
+	-2.46467421e-03, 1.33978150e-03, 6.09377738e-04, -2.80054499e-03,
+	4.41094768e-03, -4.65592776e-03, 3.11632456e-03, 8.59680601e-06,
+	-3.84188742e-03, 7.02892788e-03, -8.17123862e-03, 6.36981187e-03,
+	-1.68543413e-03, -4.68145923e-03, 1.06172199e-02, -1.37200645e-02,
+	1.21620768e-02, -5.50738451e-03, -4.82763753e-03, 1.57085907e-02,
+	-2.30720302e-02, 2.32058931e-02, -1.41618085e-02, -3.15499584e-03,
+	2.46188304e-02, -4.34370707e-02, 5.15129122e-02, -4.11543444e-02,
+	6.25876562e-03, 5.88507959e-02, -1.70503539e-01, 4.68861300e-01,
+	7.19457886e-01, -5.70427777e-02, -4.70995136e-02, 7.67356679e-02,
+	-7.19281734e-02, 4.87274482e-02, -1.90559470e-02, -7.56838229e-03,
+	2.48209407e-02, -3.02358713e-02, 2.50455428e-02, -1.31566371e-02,
+	-4.14605294e-04, 1.11630106e-02, -1.63081098e-02, 1.53072126e-02,
+	-9.61875110e-03, 1.89965364e-03, 5.03139393e-03, -9.10748327e-03,
+	9.53726693e-03, -6.83566785e-03, 2.43151547e-03, 1.95240753e-03,
+	-4.90835372e-03, 5.74488281e-03, -4.58399727e-03, 2.17424407e-03,
+	4.69067475e-04, -2.44658631e-03, 3.24890310e-03, -2.84990819e-03,
+	1.62154070e-03, -1.32143038e-04, -1.08130023e-03, 1.68489043e-03,
+	-1.61634547e-03, 1.04785620e-03, -2.77694049e-04, -3.97393544e-04,
+	7.81115162e-04, -8.20135534e-04, 5.88085903e-04, -2.29965888e-04,
+	-1.04518378e-04, 3.12808527e-04, -3.62007368e-04, 2.81457764e-04,
+	-1.35644187e-04, -7.83230645e-06, 1.02467653e-04, -1.32710173e-04,
+	1.09928674e-04, -5.99546078e-05, 9.25170157e-06, 2.47539429e-05,
+	-3.68593166e-05, 3.16453145e-05, -1.81844328e-05, 4.90827668e-06,
+	3.39270422e-06, -5.98229480e-06, 4.77085273e-06, -2.35487565e-06,
+	-1.97047532e-06, 2.21341154e-06, 2.28310898e-08, -5.68373335e-06,
+	1.37258187e-05, -2.03459594e-05, 1.96625202e-05, -6.25218683e-06,
+	-2.10468871e-05, 5.57595832e-05, -8.31086698e-05, 8.38385616e-05,
+	-4.25402521e-05, -4.20497361e-05, 1.49502800e-04, -2.38145726e-04,
+	2.56653753e-04, -1.65388263e-04, -3.94475081e-05, 3.09759402e-04,
+	-5.48466103e-04, 6.36730623e-04, -4.80983671e-04, 6.42814909e-05,
+	5.20446451e-04, -1.07625936e-03, 1.35652579e-03, -1.15772857e-03,
+	4.20565990e-04, 7.02959124e-04, -1.85519806e-03, 2.56831691e-03,
+	-2.43192618e-03, 1.27964806e-03, 6.79805450e-04, -2.85575131e-03,
+	4.42528327e-03, -4.61393320e-03, 3.02134100e-03, 1.31415889e-04,
+	-3.95063090e-03, 7.07779381e-03, -8.12777273e-03, 6.23061654e-03,
+	-1.48383398e-03, -4.88047738e-03, 1.07354608e-02, -1.36936017e-02,
+	1.19690733e-02, -5.18576005e-03, -5.18141244e-03, 1.59629893e-02,
+	-2.31022205e-02, 2.29424763e-02, -1.36308440e-02, -3.81611074e-03,
+	2.51796279e-02, -4.36272291e-02, 5.11013096e-02, -4.00386119e-02,
+	4.55432325e-03, 6.06968771e-02, -1.71321590e-01, 4.62072373e-01,
+	7.23605552e-01, -5.27217266e-02, -4.97947813e-02, 7.80026853e-02,
+	-7.20885346e-02, 4.81748339e-02, -1.82002143e-02, -8.37444161e-03,
+	2.53414050e-02, -3.03790433e-02, 2.48532500e-02, -1.27621528e-02,
+	-8.44797536e-04, 1.14854234e-02, -1.64410751e-02, 1.52440807e-02,
+	-9.41593531e-03, 1.64742250e-03, 5.24347431e-03, -9.21880127e-03,
+	9.53030104e-03, -6.73392134e-03, 2.28467119e-03, 2.08914987e-03,
+	-4.99307375e-03, 5.76008653e-03, -4.53781985e-03, 2.09307773e-03,
+	5.52559214e-04, -2.50527913e-03, 3.26897653e-03, -2.83274941e-03,
+	1.58027045e-03, -8.49600044e-05, -1.11811041e-03, 1.70187785e-03,
+	-1.61252413e-03, 1.02917711e-03, -2.53546638e-04, -4.18045479e-04,
+	7.92577309e-04, -8.21074652e-04, 5.80903474e-04, -2.19072551e-04,
+	-1.14673546e-04, 3.19219040e-04, -3.63716195e-04, 2.79307495e-04,
+	-1.31484379e-04, -1.20575003e-05, 1.05399643e-04, -1.33851678e-04,
+	1.09536602e-04, -5.87038376e-05, 7.86140071e-06, 2.57843777e-05,
+	-3.73442520e-05, 3.16595938e-05, -1.79340818e-05, 4.60167343e-06,
+	3.62347581e-06, -6.09796756e-06, 4.79714135e-06, -2.33990613e-06,
+	-1.94328053e-06, 2.13815373e-06, 1.52859173e-07, -5.83011745e-06,
+	1.37924737e-05, -2.02005898e-05, 1.92003912e-05, -5.48682256e-06,
+	-2.19080639e-05, 5.63108349e-05, -8.28559976e-05, 8.24224972e-05,
+	-4.00042695e-05, -4.50698775e-05, 1.51807852e-04, -2.38304474e-04,
+	2.53600056e-04, -1.59095135e-04, -4.75190059e-05, 3.16743378e-04,
+	-5.50868737e-04, 6.31787004e-04, -4.68166092e-04, 4.63151236e-05,
+	5.37687417e-04, -1.08528859e-03, 1.35097559e-03, -1.13542812e-03,
+	3.85719078e-04, 7.39702171e-04, -1.87939360e-03, 2.56671186e-03,
+	-2.39827319e-03, 1.21911383e-03, 7.49841406e-04, -2.90973162e-03,
+	4.43784095e-03, -4.57017927e-03, 2.92531428e-03, 2.53986206e-04,
+	-4.05763686e-03, 7.12377879e-03, -8.08115427e-03, 6.08916822e-03,
+	-1.28195724e-03, -5.07725477e-03, 1.08492658e-02, -1.36617562e-02,
+	1.17716346e-02, -4.86260004e-03, -5.53255152e-03, 1.62106335e-02,
+	-2.31232090e-02, 2.26704638e-02, -1.30955279e-02, -4.47431539e-03,
+	2.57291605e-02, -4.37996294e-02, 5.06707015e-02, -3.89109493e-02,
+	2.85553000e-03, 6.25080637e-02, -1.72064441e-01, 4.55256875e-01,
+	7.27666726e-01, -4.83280063e-02, -5.24886893e-02, 7.92448469e-02,
+	-7.22208799e-02, 4.76013650e-02, -1.73349425e-02, -9.17911716e-03,
+	2.58529528e-02, -3.05104525e-02, 2.46507330e-02, -1.23618957e-02,
+	-1.27539738e-03, 1.18038183e-02, -1.65677346e-02, 1.51748008e-02,
+	-9.20906522e-03, 1.39414502e-03, 5.45380283e-03, -9.32663370e-03,
+	9.51954291e-03, -6.62934458e-03, 2.13669041e-03, 2.22527912e-03,
+	-5.07594740e-03, 5.77302856e-03, -4.48976534e-03, 2.01094514e-03,
+	6.35973169e-04, -2.56307857e-03, 3.28778713e-03, -2.81443470e-03,
+	1.53829668e-03, -3.76545859e-05, -1.15454710e-03, 1.71822241e-03,
+	-1.60805414e-03, 1.01005015e-03, -2.29247016e-04, -4.38576324e-04,
+	8.03749947e-04, -8.21689218e-04, 5.73472668e-04, -2.08065146e-04,
+	-1.24808881e-04, 3.25519225e-04, -3.65284690e-04, 2.77039763e-04,
+	-1.27259909e-04, -1.62907633e-05, 1.08298838e-04, -1.34943451e-04,
+	1.09099331e-04, -5.74249860e-05, 6.46260118e-06, 2.68086467e-05,
+	-3.78162560e-05, 3.16611668e-05, -1.76752208e-05, 4.29152600e-06,
+	3.85416261e-06, -6.21191733e-06, 4.82162956e-06, -2.32376943e-06,
+	-1.91553543e-06, 2.06264531e-06, 2.81889571e-07, -5.97320708e-06,
+	1.38531694e-05, -2.00478221e-05, 1.87327346e-05, -4.72263677e-06,
+	-2.27569034e-05, 5.68374213e-05, -8.25711760e-05, 8.09785410e-05,
+	-3.74608671e-05, -4.80623490e-05, 1.54045353e-04, -2.38367923e-04,
+	2.50454206e-04, -1.52756071e-04, -5.55501686e-05, 3.23583558e-04,
+	-5.53046577e-04, 6.26604398e-04, -4.55192594e-04, 2.83711437e-05,
+	5.54676962e-04, -1.09386779e-03, 1.34490098e-03, -1.11272260e-03,
+	3.50788300e-04, 7.76080725e-04, -1.90279812e-03, 2.56409205e-03,
+	-2.36373022e-03, 1.15820351e-03, 8.19458505e-04, -2.96246660e-03,
+	4.44861871e-03, -4.52468620e-03, 2.82828417e-03, 3.76259566e-04,
+	-4.16286562e-03, 7.16686912e-03, -8.03140662e-03, 5.94552645e-03,
+	-1.07988433e-03, -5.27171689e-03, 1.09585967e-02, -1.36245491e-02,
+	1.15698460e-02, -4.53803484e-03, -5.88092017e-03, 1.64514368e-02,
+	-2.31350037e-02, 2.23899791e-02, -1.25560801e-02, -5.12935622e-03,
+	2.62672378e-02, -4.39542498e-02, 5.02213129e-02, -3.77718384e-02,
+	1.16301818e-03, 6.42838761e-02, -1.72732530e-01, 4.48416318e-01,
+	7.31640455e-01, -4.38621871e-02, -5.51802175e-02, 8.04615522e-02,
+	-7.23250516e-02, 4.70072013e-02, -1.64604468e-02, -9.98208793e-03,
+	2.63553623e-02, -3.06300234e-02, 2.44380528e-02, -1.19560137e-02,
+	-1.70623493e-03, 1.21180626e-02, -1.66880278e-02, 1.50993904e-02,
+	-8.99821650e-03, 1.13992001e-03, 5.66229335e-03, -9.43093240e-03,
+	9.50499096e-03, -6.52197469e-03, 1.98763010e-03, 2.36074026e-03,
+	-5.15693881e-03, 5.78370010e-03, -4.43984977e-03, 1.92787732e-03,
+	7.19276070e-04, -2.61996010e-03, 3.30532522e-03, -2.79496926e-03,
+	1.49563477e-03, 9.75463809e-06, -1.19059508e-03, 1.73391632e-03,
+	-1.60293596e-03, 9.90482019e-04, -2.04804531e-04, -4.58977641e-04,
+	8.14627975e-04, -8.21978236e-04, 5.65795854e-04, -1.96947782e-04,
+	-1.34920288e-04, 3.31706277e-04, -3.66711845e-04, 2.74655143e-04,
+	-1.22972279e-04, -2.05304259e-05, 1.11163974e-04, -1.35984890e-04,
+	1.08616880e-04, -5.61184652e-05, 5.05583371e-06, 2.78263116e-05,
+	-3.82750817e-05, 3.16499743e-05, -1.74079132e-05, 3.97794239e-06,
+	4.08466866e-06, -6.32408464e-06, 4.84429263e-06, -2.30646153e-06,
+	-1.88725867e-06, 1.98692102e-06, 4.09875206e-07, -6.11296361e-06,
+	1.39079142e-05, -1.98877564e-05, 1.82597656e-05, -3.95993244e-06,
+	-2.35931150e-05, 5.73392272e-05, -8.22544381e-05, 7.95073689e-05,
+	-3.49110866e-05, -5.10260441e-05, 1.56214620e-04, -2.38336332e-04,
+	2.47217719e-04, -1.46373722e-04, -6.35379057e-05, 3.30277589e-04,
+	-5.54999316e-04, 6.21185442e-04, -4.42068698e-04, 1.04566328e-05,
+	5.71408888e-04, -1.10199452e-03, 1.33830547e-03, -1.08962188e-03,
+	3.15787691e-04, 8.12081051e-04, -1.92540382e-03, 2.56046040e-03,
+	-2.32831258e-03, 1.09694196e-03, 8.88629860e-04, -3.01393747e-03,
+	4.45761524e-03, -4.47747490e-03, 2.73029076e-03, 4.98187973e-04,
+	-4.26627830e-03, 7.20705226e-03, -7.97855437e-03, 5.79975154e-03,
+	-8.77695590e-04, -5.46379031e-03, 1.10634171e-02, -1.35820034e-02,
+	1.13637942e-02, -4.21219519e-03, -6.22638511e-03, 1.66853154e-02,
+	-2.31376163e-02, 2.21011487e-02, -1.20127218e-02, -5.78098147e-03,
+	2.67936742e-02, -4.40910750e-02, 4.97533755e-02, -3.66217639e-02,
+	-5.22584970e-04, 6.60238500e-02, -1.73326314e-01, 4.41552218e-01,
+	7.35525803e-01, -3.93248610e-02, -5.78683405e-02, 8.16522076e-02,
+	-7.24009023e-02, 4.63925114e-02, -1.55770467e-02, -1.07830328e-02,
+	2.68484151e-02, -3.07376845e-02, 2.42152741e-02, -1.15446576e-02,
+	-2.13713990e-03, 1.24280247e-02, -1.68018966e-02, 1.50178698e-02,
+	-8.78346649e-03, 8.84846845e-04, 5.86886032e-03, -9.53165052e-03,
+	9.48664507e-03, -6.41184992e-03, 1.83754774e-03, 2.49547846e-03,
+	-5.23601283e-03, 5.79209325e-03, -4.38808989e-03, 1.84390571e-03,
+	8.02434637e-04, -2.67589954e-03, 3.32158158e-03, -2.77435877e-03,
+	1.45230043e-03, 5.72490120e-05, -1.22623928e-03, 1.74895206e-03,
+	-1.59717032e-03, 9.70479583e-04, -1.80228611e-04, -4.79241021e-04,
+	8.25206398e-04, -8.21940838e-04, 5.57875505e-04, -1.85724622e-04,
+	-1.45003674e-04, 3.37777428e-04, -3.67996706e-04, 2.72154257e-04,
+	-1.18623017e-04, -2.47748110e-05, 1.13993795e-04, -1.36975411e-04,
+	1.08089286e-04, -5.47846996e-05, 3.64163426e-06, 2.88369349e-05,
+	-3.87204868e-05, 3.16259619e-05, -1.71322259e-05, 3.66103261e-06,
+	4.31489750e-06, -6.43441038e-06, 4.86510645e-06, -2.28797890e-06,
+	-1.85846899e-06, 1.91101539e-06, 5.36769774e-07, -6.24935004e-06,
+	1.39567190e-05, -1.97204948e-05, 1.77817007e-05, -3.19901063e-06,
+	-2.44164146e-05, 5.78161477e-05, -8.19060286e-05, 7.80096656e-05,
+	-3.23559690e-05, -5.39598717e-05, 1.58314996e-04, -2.38209995e-04,
+	2.43892145e-04, -1.39950750e-04, -7.14791520e-05, 3.36823182e-04,
+	-5.56726735e-04, 6.15532859e-04, -4.28799973e-04, -7.42135562e-06,
+	5.87877115e-04, -1.10966653e-03, 1.33119275e-03, -1.06613593e-03,
+	2.80731286e-04, 8.47689589e-04, -1.94720324e-03, 2.55582022e-03,
+	-2.29203591e-03, 1.03535408e-03, 9.57328807e-04, -3.06412595e-03,
+	4.46482998e-03, -4.42856692e-03, 2.63137446e-03, 6.19723644e-04,
+	-4.36783677e-03, 7.24431683e-03, -7.92262328e-03, 5.65190455e-03,
+	-6.75471311e-04, -5.65340263e-03, 1.11636926e-02, -1.35341445e-02,
+	1.11535675e-02, -3.88521211e-03, -6.56881444e-03, 1.69121888e-02,
+	-2.31310619e-02, 2.18041022e-02, -1.14656754e-02, -6.42894123e-03,
+	2.73082891e-02, -4.42100972e-02, 4.92671275e-02, -3.54612130e-02,
+	-2.20065747e-03, 6.77275371e-02, -1.73846267e-01, 4.34666094e-01,
+	7.39321857e-01, -3.47166413e-02, -6.05520273e-02, 8.28162265e-02,
+	-7.24482948e-02, 4.57574720e-02, -1.46850661e-02, -1.15816307e-02,
+	2.73318957e-02, -3.08333693e-02, 2.39824660e-02, -1.11279803e-02,
+	-2.56794170e-03, 1.27335745e-02, -1.69092855e-02, 1.49302614e-02,
+	-8.56489425e-03, 6.29025373e-04, 6.07341881e-03, -9.62874257e-03,
+	9.46450666e-03, -6.29900970e-03, 1.68650128e-03, 2.62943909e-03,
+	-5.31313499e-03, 5.79820098e-03, -4.33450325e-03, 1.75906214e-03,
+	8.85415587e-04, -2.73087304e-03, 3.33654750e-03, -2.75260935e-03,
+	1.40830964e-03, 1.04809811e-04, -1.26146474e-03, 1.76332236e-03,
+	-1.59075821e-03, 9.50049905e-04, -1.55528754e-04, -4.99358095e-04,
+	8.35480329e-04, -8.21576284e-04, 5.49714197e-04, -1.74399880e-04,
+	-1.55054944e-04, 3.43729953e-04, -3.69138372e-04, 2.69537779e-04,
+	-1.14213683e-04, -2.90222342e-05, 1.16787055e-04, -1.37914448e-04,
+	1.07516605e-04, -5.34241263e-05, 2.22054388e-06, 2.98400803e-05,
+	-3.91522333e-05, 3.15890803e-05, -1.68482296e-05, 3.34090862e-06,
+	4.54475222e-06, -6.54283586e-06, 4.88404755e-06, -2.26831855e-06,
+	-1.82918516e-06, 1.83496279e-06, 6.62527755e-07, -6.38233103e-06,
+	1.39995971e-05, -1.95461422e-05, 1.72987575e-05, -2.44017037e-06,
+	-2.52265244e-05, 5.82680885e-05, -8.15262045e-05, 7.64861238e-05,
+	-2.97965536e-05, -5.68627557e-05, 1.60345856e-04, -2.37989242e-04,
+	2.40479062e-04, -1.33489824e-04, -7.93708690e-05, 3.43218113e-04,
+	-5.58228708e-04, 6.09649462e-04, -4.15392033e-04, -2.52557984e-05,
+	6.04075681e-04, -1.11688173e-03, 1.32356674e-03, -1.04227485e-03,
+	2.45633112e-04, 8.82892964e-04, -1.96818925e-03, 2.55017522e-03,
+	-2.25491616e-03, 9.73464902e-04, 1.02552892e-03, -3.11301434e-03,
+	4.47026304e-03, -4.37798446e-03, 2.53157600e-03, 7.40819029e-04,
+	-4.46750372e-03, 7.27865265e-03, -7.86364031e-03, 5.50204726e-03,
+	-4.73291658e-04, -5.84048253e-03, 1.12593904e-02, -1.34809995e-02,
+	1.09392559e-02, -3.55721686e-03, -6.90807766e-03, 1.71319791e-02,
+	-2.31153593e-02, 2.14989723e-02, -1.09151640e-02, -7.07298757e-03,
+	2.78109070e-02, -4.43113153e-02, 4.87628134e-02, -3.42906754e-02,
+	-3.87058285e-03, 6.93945042e-02, -1.74292883e-01, 4.27759465e-01,
+	7.43027722e-01, -3.00381629e-02, -6.32302417e-02, 8.39530291e-02,
+	-7.24671022e-02, 4.51022686e-02, -1.37848333e-02, -1.23775608e-02,
+	2.78055921e-02, -3.09170157e-02, 2.37397016e-02, -1.07061372e-02,
+	-2.99846947e-03, 1.30345838e-02, -1.70101414e-02, 1.48365904e-02,
+	-8.34258042e-03, 3.72555895e-04, 6.27588456e-03, -9.72216441e-03,
+	9.43857864e-03, -6.18349459e-03, 1.53454918e-03, 2.76256774e-03,
+	-5.38827157e-03, 5.80201718e-03, -4.27910813e-03, 1.67337887e-03,
+	9.68185656e-04, -2.78485709e-03, 3.35021476e-03, -2.72972761e-03,
+	1.36367870e-03, 1.52418250e-04, -1.29625666e-03, 1.77702019e-03,
+	-1.58370087e-03, 9.29200232e-04, -1.30714530e-04, -5.19320534e-04,
+	8.45444990e-04, -8.20883961e-04, 5.41314610e-04, -1.62977823e-04,
+	-1.65070006e-04, 3.49561163e-04, -3.70135999e-04, 2.66806428e-04,
+	-1.09745864e-04, -3.32710050e-05, 1.19542519e-04, -1.38801455e-04,
+	1.06898911e-04, -5.20371950e-05, 7.93108419e-07, 3.08353126e-05,
+	-3.95700877e-05, 3.15392852e-05, -1.65559990e-05, 3.01768432e-06,
+	4.77413550e-06, -6.64930278e-06, 4.90109308e-06, -2.24747798e-06,
+	-1.79942604e-06, 1.75879736e-06, 7.87104432e-07, -6.51187286e-06,
+	1.40365641e-05, -1.93648057e-05, 1.68111544e-05, -1.68370852e-06,
+	-2.60231730e-05, 5.86949657e-05, -8.11152342e-05, 7.49374445e-05,
+	-2.72338782e-05, -5.97336363e-05, 1.62306604e-04, -2.37674441e-04,
+	2.36980080e-04, -1.26993624e-04, -8.72100462e-05, 3.49460224e-04,
+	-5.59505197e-04, 6.03538145e-04, -4.01850534e-04, -4.30397057e-05,
+	6.19998743e-04, -1.12363825e-03, 1.31543153e-03, -1.01804889e-03,
+	2.10507189e-04, 9.17677985e-04, -1.98835507e-03, 2.54352948e-03,
+	-2.21696958e-03, 9.11299497e-04, 1.09320400e-03, -3.16058545e-03,
+	4.47391524e-03, -4.32575031e-03, 2.43093637e-03, 8.61426830e-04,
+	-4.56524263e-03, 7.31005069e-03, -7.80163359e-03, 5.35024216e-03,
+	-2.71236662e-04, -6.02495984e-03, 1.13504798e-02, -1.34225977e-02,
+	1.07209505e-02, -3.22834089e-03, -7.24404574e-03, 1.73446113e-02,
+	-2.30905309e-02, 2.11858945e-02, -1.03614119e-02, -7.71287463e-03,
+	2.83013575e-02, -4.43947352e-02, 4.82406842e-02, -3.31106427e-02,
+	-5.53175032e-03, 7.10243342e-02, -1.74666674e-01, 4.20833853e-01,
+	7.46642525e-01, -2.52900817e-02, -6.59019428e-02, 8.50620436e-02,
+	-7.24572084e-02, 4.44270949e-02, -1.28766805e-02, -1.31705022e-02,
+	2.82692956e-02, -3.09885660e-02, 2.34870580e-02, -1.02792862e-02,
+	-3.42855216e-03, 1.33309255e-02, -1.71044137e-02, 1.47368841e-02,
+	-8.11660729e-03, 1.15539128e-04, 6.47617401e-03, -9.81187332e-03,
+	9.40886544e-03, -6.06534629e-03, 1.38175034e-03, 2.89481026e-03,
+	-5.46138957e-03, 5.80353663e-03, -4.22192357e-03, 1.58688854e-03,
+	1.05071160e-03, -2.83782853e-03, 3.36257565e-03, -2.70572061e-03,
+	1.31842416e-03, 2.00055488e-04, -1.33060035e-03, 1.79003878e-03,
+	-1.57599981e-03, 9.07937991e-04, -1.05795573e-04, -5.39120049e-04,
+	8.55095719e-04, -8.19863387e-04, 5.32679523e-04, -1.51462766e-04,
+	-1.75044773e-04, 3.55268412e-04, -3.70988797e-04, 2.63960971e-04,
+	-1.05221176e-04, -3.75194273e-05, 1.22258965e-04, -1.39635903e-04,
+	1.06236295e-04, -5.06243673e-05, -6.40121581e-07, 3.18221983e-05,
+	-3.99738211e-05, 3.14765374e-05, -1.62556122e-05, 2.69147550e-06,
+	5.00294964e-06, -6.75375332e-06, 4.91622085e-06, -2.22545522e-06,
+	-1.76921050e-06, 1.68255301e-06, 9.10455902e-07, -6.63794347e-06,
+	1.40676380e-05, -1.91765948e-05, 1.63191107e-05, -9.29919694e-07,
+	-2.68060956e-05, 5.90967057e-05, -8.06733977e-05, 7.33643358e-05,
+	-2.46689783e-05, -6.25714697e-05, 1.64196673e-04, -2.37265997e-04,
+	2.33396840e-04, -1.20464834e-04, -9.49937016e-05, 3.55547424e-04,
+	-5.60556256e-04, 5.97201889e-04, -3.88181173e-04, -6.07661236e-05,
+	6.35640581e-04, -1.12993438e-03, 1.30679143e-03, -9.93468399e-04,
+	1.75367517e-04, 9.52031654e-04, -2.00769423e-03, 2.53588751e-03,
+	-2.17821272e-03, 8.48883022e-04, 1.16032813e-03, -3.20682267e-03,
+	4.47578813e-03, -4.27188792e-03, 2.32949683e-03, 9.81500015e-04,
+	-4.66101781e-03, 7.33850312e-03, -7.73663238e-03, 5.19655242e-03,
+	-6.93861765e-05, -6.20676548e-03, 1.14369318e-02, -1.33589705e-02,
+	1.04987441e-02, -2.89871579e-03, -7.57659118e-03, 1.75500135e-02,
+	-2.30566026e-02, 2.08650073e-02, -9.80464420e-03, -8.34835868e-03,
+	2.87794752e-02, -4.44603698e-02, 4.77009970e-02, -3.19216087e-02,
+	-7.18355499e-03, 7.26166255e-02, -1.74968171e-01, 4.13890779e-01,
+	7.50165414e-01, -2.04730750e-02, -6.85660849e-02, 8.61427055e-02,
+	-7.24185076e-02, 4.37321530e-02, -1.19609440e-02, -1.39601349e-02,
+	2.87228009e-02, -3.10479676e-02, 2.32246166e-02, -9.84758724e-03,
+	-3.85801861e-03, 1.36224745e-02, -1.71920542e-02, 1.46311725e-02,
+	-7.88705872e-03, -1.41923840e-04, 6.67420434e-03, -9.89782796e-03,
+	9.37537299e-03, -5.94460758e-03, 1.22816408e-03, 3.02611274e-03,
+	-5.53245673e-03, 5.80275502e-03, -4.16296933e-03, 1.49962416e-03,
+	1.13296023e-03, -2.88976457e-03, 3.37362294e-03, -2.68059587e-03,
+	1.27256288e-03, 2.47702638e-04, -1.36448131e-03, 1.80237162e-03,
+	-1.56765680e-03, 8.86270792e-04, -8.07815810e-05, -5.58748402e-04,
+	8.64427966e-04, -8.18514211e-04, 5.23811817e-04, -1.39859072e-04,
+	-1.84975164e-04, 3.60849097e-04, -3.71696031e-04, 2.61002225e-04,
+	-1.00641262e-04, -4.17657998e-05, 1.24935180e-04, -1.40417284e-04,
+	1.05528869e-04, -4.91861171e-05, -2.07859116e-06, 3.28003053e-05,
+	-4.03632096e-05, 3.14008028e-05, -1.59471512e-05, 2.36239979e-06,
+	5.23109661e-06, -6.85613010e-06, 4.92940935e-06, -2.20224885e-06,
+	-1.73855746e-06, 1.60626343e-06, 1.03253909e-06, -6.76051243e-06,
+	1.40928393e-05, -1.89816212e-05, 1.58228467e-05, -1.79096111e-07,
+	-2.75750342e-05, 5.94732455e-05, -8.02009864e-05, 7.17675137e-05,
+	-2.21028869e-05, -6.53752287e-05, 1.66015527e-04, -2.36764351e-04,
+	2.29731010e-04, -1.13906144e-04, -1.02718884e-04, 3.61477687e-04,
+	-5.61382028e-04, 5.90643756e-04, -3.74389683e-04, -7.84281369e-05,
+	6.50995601e-04, -1.13576861e-03, 1.29765091e-03, -9.68543873e-04,
+	1.40228075e-04, 9.85941170e-04, -2.02620064e-03, 2.52725417e-03,
+	-2.13866242e-03, 7.86240683e-04, 1.22687564e-03, -3.25170993e-03,
+	4.47588394e-03, -4.21642133e-03, 2.22729890e-03, 1.10099184e-03,
+	-4.75479442e-03, 7.36400328e-03, -7.66866711e-03, 5.04104185e-03,
+	1.32180146e-04, -6.38583158e-03, 1.15187194e-02, -1.32901513e-02,
+	1.02727309e-02, -2.56847323e-03, -7.90558802e-03, 1.77481167e-02,
+	-2.30136038e-02, 2.05364518e-02, -9.24508668e-03, -8.97919825e-03,
+	2.92451002e-02, -4.45082389e-02, 4.71440149e-02, -3.07240688e-02,
+	-8.82539806e-03, 7.41709924e-02, -1.75197920e-01, 4.06931767e-01,
+	7.53595558e-01, -1.55878412e-02, -7.12216185e-02, 8.71944583e-02,
+	-7.23509049e-02, 4.30176535e-02, -1.10379639e-02, -1.47461390e-02,
+	2.91659064e-02, -3.10951722e-02, 2.29524626e-02, -9.41120253e-03,
+	-4.28669762e-03, 1.39091071e-02, -1.72730174e-02, 1.45194879e-02,
+	-7.65402012e-03, -3.99731585e-04, 6.86989350e-03, -9.97998842e-03,
+	9.33810873e-03, -5.82132236e-03, 1.07385013e-03, 3.15642158e-03,
+	-5.60144156e-03, 5.79966894e-03, -4.10226594e-03, 1.41161909e-03,
+	1.21489840e-03, -2.94064280e-03, 3.38334995e-03, -2.65436137e-03,
+	1.22611198e-03, 2.95340775e-04, -1.39788517e-03, 1.81401245e-03,
+	-1.55867387e-03, 8.64206419e-04, -5.56823095e-05, -5.78197403e-04,
+	8.73437299e-04, -8.16836210e-04, 5.14714473e-04, -1.28171151e-04,
+	-1.94857104e-04, 3.66300658e-04, -3.72257024e-04, 2.57931053e-04,
+	-9.60077917e-05, -4.60084169e-05, 1.27569966e-04, -1.41145110e-04,
+	1.04776761e-04, -4.77229304e-05, -3.52174112e-06, 3.37692036e-05,
+	-4.07380338e-05, 3.13120524e-05, -1.56307018e-05, 2.03057665e-06,
+	5.45847808e-06, -6.95637628e-06, 4.94063776e-06, -2.17785797e-06,
+	-1.70748585e-06, 1.52996202e-06, 1.15331176e-06, -6.87955098e-06,
+	1.41121904e-05, -1.87799988e-05, 1.53225831e-05, 5.68472485e-07,
+	-2.83297374e-05, 5.98245324e-05, -7.96983029e-05, 7.01477008e-05,
+	-1.95366340e-05, -6.81439030e-05, 1.67762660e-04, -2.36169978e-04,
+	2.25984288e-04, -1.07320251e-04, -1.10382672e-04, 3.67249056e-04,
+	-5.61982744e-04, 5.83866889e-04, -3.60481834e-04, -9.60188716e-05,
+	6.66058334e-04, -1.14113961e-03, 1.28801466e-03, -9.43285904e-04,
+	1.05102815e-04, 1.01939393e-03, -2.04386851e-03, 2.51763472e-03,
+	-2.09833582e-03, 7.23397731e-04, 1.29282112e-03, -3.29523173e-03,
+	4.47420561e-03, -4.15937518e-03, 2.12438434e-03, 1.21985587e-03,
+	-4.84653845e-03, 7.38654570e-03, -7.59776931e-03, 4.88377489e-03,
+	3.33382889e-04, -6.56209143e-03, 1.15958173e-02, -1.32161754e-02,
+	1.00430064e-02, -2.23774493e-03, -8.23091194e-03, 1.79388551e-02,
+	-2.29615676e-02, 2.02003722e-02, -8.68296580e-03, -9.60515420e-03,
+	2.96980777e-02, -4.45383691e-02, 4.65700072e-02, -2.95185202e-02,
+	-1.04566870e-02, 7.56870650e-02, -1.75356487e-01, 3.99958339e-01,
+	7.56932148e-01, -1.06350993e-02, -7.38674899e-02, 8.82167538e-02,
+	-7.22543161e-02, 4.22838151e-02, -1.01080841e-02, -1.55281956e-02,
+	2.95984142e-02, -3.11301365e-02, 2.26706851e-02, -8.97029644e-03,
+	-4.71441799e-03, 1.41907016e-02, -1.73472604e-02, 1.44018650e-02,
+	-7.41757841e-03, -6.57782388e-04, 7.06316022e-03, -1.00583162e-02,
+	9.29708161e-03, -5.69553561e-03, 9.18868599e-04, 3.28568348e-03,
+	-5.66831335e-03, 5.79427588e-03, -4.03983463e-03, 1.32290705e-03,
+	1.29649303e-03, -2.99044116e-03, 3.39175049e-03, -2.62702554e-03,
+	1.17908883e-03, 3.42950939e-04, -1.43079773e-03, 1.82495528e-03,
+	-1.54905329e-03, 8.41752831e-04, -3.05075688e-05, -5.97458916e-04,
+	8.82119404e-04, -8.14829291e-04, 5.05390569e-04, -1.16403456e-04,
+	-2.04686529e-04, 3.71620581e-04, -3.72671155e-04, 2.54748365e-04,
+	-9.13224616e-05, -5.02455694e-05, 1.30162135e-04, -1.41818912e-04,
+	1.03980118e-04, -4.62353048e-05, -4.96900825e-06, 3.47284648e-05,
+	-4.10980797e-05, 3.12102624e-05, -1.53063534e-05, 1.69612732e-06,
+	5.68499543e-06, -7.05443552e-06, 4.94988595e-06, -2.15228222e-06,
+	-1.67601464e-06, 1.45368194e-06, 1.27273254e-06, -6.99503202e-06,
+	1.41257164e-05, -1.85718437e-05, 1.48185413e-05, 1.31249894e-06,
+	-2.90699604e-05, 6.01505241e-05, -7.91656610e-05, 6.85056266e-05,
+	-1.69712461e-05, -7.08764996e-05, 1.69437596e-04, -2.35483392e-04,
+	2.22158397e-04, -1.00709851e-04, -1.17982179e-04, 3.72859645e-04,
+	-5.62358725e-04, 5.76874512e-04, -3.46463426e-04, -1.13531498e-04,
+	6.80823440e-04, -1.14604624e-03, 1.27788753e-03, -9.17705203e-04,
+	7.00056525e-05, 1.05237755e-03, -2.06069242e-03, 2.50703481e-03,
+	-2.05725032e-03, 6.60379453e-04, 1.35813947e-03, -3.33737313e-03,
+	4.47075678e-03, -4.10077468e-03, 2.02079510e-03, 1.33804599e-03,
+	-4.93621674e-03, 7.40612607e-03, -7.52397166e-03, 4.72481656e-03,
+	5.34142903e-04, -6.73547955e-03, 1.16682025e-02, -1.31370801e-02,
+	9.80966734e-03, -1.90666256e-03, -8.55244024e-03, 1.81221655e-02,
+	-2.29005305e-02, 1.98569152e-02, -8.11850860e-03, -1.02259898e-02,
+	3.01382583e-02, -4.45507941e-02, 4.59792489e-02, -2.83054612e-02,
+	-1.20768359e-02, 7.71644894e-02, -1.75444454e-01, 3.92972018e-01,
+	7.60174394e-01, -5.61558920e-03, -7.65026419e-02, 8.92090520e-02,
+	-7.21286676e-02, 4.15308646e-02, -9.17165228e-03, -1.63059862e-02,
+	3.00201300e-02, -3.11528218e-02, 2.23793775e-02, -8.52503542e-03,
+	-5.14100860e-03, 1.44671379e-02, -1.74147427e-02, 1.42783410e-02,
+	-7.17782200e-03, -9.15974278e-04, 7.25392409e-03, -1.01327744e-02,
+	9.25230208e-03, -5.56729335e-03, 7.63279964e-04, 3.41384547e-03,
+	-5.73304219e-03, 5.78657427e-03, -3.97569737e-03, 1.23352212e-03,
+	1.37771113e-03, -3.03913801e-03, 3.39881888e-03, -2.59859727e-03,
+	1.13151108e-03, 3.90514148e-04, -1.46320496e-03, 1.83519439e-03,
+	-1.53879761e-03, 8.18918162e-04, -5.26722001e-06, -6.16524863e-04,
+	8.90470088e-04, -8.12493496e-04, 4.95843283e-04, -1.04560484e-04,
+	-2.14459383e-04, 3.76806397e-04, -3.72937860e-04, 2.51455120e-04,
+	-8.65869936e-05, -5.44755451e-05, 1.32710515e-04, -1.42438241e-04,
+	1.03139107e-04, -4.47237496e-05, -6.41982551e-06, 3.56776630e-05,
+	-4.14431380e-05, 3.10954143e-05, -1.49741991e-05, 1.35917475e-06,
+	5.91054988e-06, -7.15025206e-06, 4.95713449e-06, -2.12552178e-06,
+	-1.64416278e-06, 1.37745608e-06, 1.39076092e-06, -7.10693008e-06,
+	1.41334445e-05, -1.83572740e-05, 1.43109432e-05, 2.05269881e-06,
+	-2.97954656e-05, 6.04511887e-05, -7.86033851e-05, 6.68420268e-05,
+	-1.44077461e-05, -7.35720434e-05, 1.71039890e-04, -2.34705139e-04,
+	2.18255089e-04, -9.40776474e-05, -1.25514548e-04, 3.78307632e-04,
+	-5.62510382e-04, 5.69669924e-04, -3.32340293e-04, -1.30959232e-04,
+	6.95285708e-04, -1.15048756e-03, 1.26727458e-03, -8.91812584e-04,
+	3.49504678e-05, 1.08487983e-03, -2.07666730e-03, 2.49546046e-03,
+	-2.01542360e-03, 5.97211160e-04, 1.42280587e-03, -3.37811979e-03,
+	4.46554179e-03, -4.04064564e-03, 1.91657336e-03, 1.45551643e-03,
+	-5.02379703e-03, 7.42274128e-03, -7.44730790e-03, 4.56423246e-03,
+	7.34381337e-04, -6.90593169e-03, 1.17358534e-02, -1.30529048e-02,
+	9.57281188e-03, -1.57535775e-03, -8.87005195e-03, 1.82979882e-02,
+	-2.28305325e-02, 1.95062301e-02, -7.55194258e-03, -1.08414709e-02,
+	3.05654978e-02, -4.45455542e-02, 4.53720205e-02, -2.70853916e-02,
+	-1.36852653e-02, 7.86029275e-02, -1.75462420e-01, 3.85974326e-01,
+	7.63321532e-01, -5.30071513e-04, -7.91260140e-02, 9.01708216e-02,
+	-7.19738968e-02, 4.07590371e-02, -8.22901936e-03, -1.70791936e-02,
+	3.04308634e-02, -3.11631940e-02, 2.20786369e-02, -8.07558794e-03,
+	-5.56629849e-03, 1.47382979e-02, -1.74754266e-02, 1.41489555e-02,
+	-6.93484075e-03, -1.17420507e-03, 7.44210556e-03, -1.02033275e-02,
+	9.20378212e-03, -5.43664266e-03, 6.07145030e-04, 3.54085495e-03,
+	-5.79559896e-03, 5.77656343e-03, -3.90987683e-03, 1.14349867e-03,
+	1.45851978e-03, -3.08671210e-03, 3.40454998e-03, -2.56908591e-03,
+	1.08339664e-03, 4.38011403e-04, -1.49509300e-03, 1.84472432e-03,
+	-1.52790963e-03, 7.95710709e-04, 2.00288286e-05, -6.35387224e-04,
+	8.98485282e-04, -8.09828995e-04, 4.86075889e-04, -9.26467728e-05,
+	-2.24171624e-04, 3.81855686e-04, -3.73056633e-04, 2.48052323e-04,
+	-8.18031352e-05, -5.86966295e-05, 1.35213947e-04, -1.43002669e-04,
+	1.02253911e-04, -4.31887857e-05, -7.87362227e-06, 3.66163747e-05,
+	-4.17730050e-05, 3.09674946e-05, -1.46343356e-05, 1.01984362e-06,
+	6.13504242e-06, -7.24377072e-06, 4.96236472e-06, -2.09757738e-06,
+	-1.61194921e-06, 1.30131701e-06, 1.50735725e-06, -7.21522137e-06,
+	1.41354041e-05, -1.81364099e-05, 1.38000111e-05, 2.78879045e-06,
+	-3.05060221e-05, 6.07265047e-05, -7.80118106e-05, 6.51576434e-05,
+	-1.18471525e-05, -7.62295769e-05, 1.72569127e-04, -2.33835803e-04,
+	2.14276141e-04, -8.74263406e-05, -1.32976961e-04, 3.83591268e-04,
+	-5.62438213e-04, 5.62256504e-04, -3.18118295e-04, -1.48295340e-04,
+	7.09440061e-04, -1.15446279e-03, 1.25618104e-03, -8.65618966e-04,
+	-4.89047773e-08, 1.11688881e-03, -2.09178841e-03, 2.48291806e-03,
+	-1.97287358e-03, 5.33918179e-04, 1.48679580e-03, -3.41745791e-03,
+	4.45856565e-03, -3.97901442e-03, 1.81176146e-03, 1.57222177e-03,
+	-5.10924793e-03, 7.43638940e-03, -7.36781287e-03, 4.40208875e-03,
+	9.34019667e-04, -7.07338486e-03, 1.17987506e-02, -1.29636907e-02,
+	9.33253933e-03, -1.24396197e-03, -9.18362784e-03, 1.84662662e-02,
+	-2.27516170e-02, 1.91484689e-02, -6.98349564e-03, -1.14513658e-02,
+	3.09796575e-02, -4.45226966e-02, 4.47486085e-02, -2.58588120e-02,
+	-1.52814027e-02, 8.00020575e-02, -1.75411002e-01, 3.78966783e-01,
+	7.66372816e-01, 4.62067283e-03, -8.17365429e-02, 9.11015403e-02,
+	-7.17899522e-02, 3.99685758e-02, -7.28053978e-03, -1.78475015e-02,
+	3.08304279e-02, -3.11612242e-02, 2.17685643e-02, -7.62212443e-03,
+	-5.99011692e-03, 1.50040653e-02, -1.75292771e-02, 1.40137504e-02,
+	-6.68872595e-03, -1.43237239e-03, 7.62762597e-03, -1.02699413e-02,
+	9.15153518e-03, -5.30363166e-03, 4.50524915e-04, 3.66665967e-03,
+	-5.85595535e-03, 5.76424361e-03, -3.84239640e-03, 1.05287140e-03,
+	1.53888621e-03, -3.13314260e-03, 3.40893915e-03, -2.53850124e-03,
+	1.03476363e-03, 4.85423694e-04, -1.52644817e-03, 1.85353989e-03,
+	-1.51639241e-03, 7.72138938e-04, 4.53706255e-05, -6.54038046e-04,
+	9.06161041e-04, -8.06836091e-04, 4.76091755e-04, -8.06668986e-05,
+	-2.33819224e-04, 3.86766073e-04, -3.73027023e-04, 2.44541026e-04,
+	-7.69726578e-05, -6.29071064e-05, 1.37671286e-04, -1.43511788e-04,
+	1.01324734e-04, -4.16309452e-05, -9.32982455e-06, 3.75441786e-05,
+	-4.20874819e-05, 3.08264955e-05, -1.42868634e-05, 6.78260209e-07,
+	6.35837393e-06, -7.33493692e-06, 4.96555868e-06, -2.06845032e-06,
+	-1.57939289e-06, 1.22529702e-06, 1.62248279e-06, -7.31988374e-06,
+	1.41316269e-05, -1.79093736e-05, 1.32859677e-05, 3.52049509e-06,
+	-3.12014061e-05, 6.09764606e-05, -7.73912833e-05, 6.34532239e-05,
+	-9.29047928e-06, -7.88481611e-05, 1.74024922e-04, -2.32876000e-04,
+	2.10223355e-04, -8.07586336e-05, -1.40366630e-04, 3.88708873e-04,
+	-5.62142803e-04, 5.54637704e-04, -3.03803317e-04, -1.65533140e-04,
+	7.23281553e-04, -1.15797136e-03, 1.24461231e-03, -8.39135362e-04,
+	-3.49786802e-05, 1.14839274e-03, -2.10605136e-03, 2.46941438e-03,
+	-1.92961848e-03, 4.70525840e-04, 1.55008506e-03, -3.45537429e-03,
+	4.44983410e-03, -3.91590793e-03, 1.70640191e-03, 1.68811698e-03,
+	-5.19253893e-03, 7.44706967e-03, -7.28552249e-03, 4.23845207e-03,
+	1.13297973e-03, -7.23777737e-03, 1.18568766e-02, -1.28694811e-02,
+	9.08895022e-03, -9.12606553e-04, -9.49305047e-03, 1.86269458e-02,
+	-2.26638310e-02, 1.87837861e-02, -6.41339597e-03, -1.20554456e-02,
+	3.13806043e-02, -4.44822753e-02, 4.41093046e-02, -2.46262237e-02,
+	-1.68646828e-02, 8.13615732e-02, -1.75290833e-01, 3.71950909e-01,
+	7.69327526e-01, 9.83584255e-03, -8.43331626e-02, 9.20006947e-02,
+	-7.15767931e-02, 3.91597318e-02, -6.32657121e-03, -1.86105945e-02,
+	3.12186409e-02, -3.11468879e-02, 2.14492648e-02, -7.16481720e-03,
+	-6.41229343e-03, 1.52643256e-02, -1.75762615e-02, 1.38727700e-02,
+	-6.43957028e-03, -1.69037376e-03, 7.81040762e-03, -1.03325834e-02,
+	9.09557623e-03, -5.16830946e-03, 2.93481026e-04, 3.79120779e-03,
+	-5.91408389e-03, 5.74961597e-03, -3.77328016e-03, 9.61675298e-04,
+	1.61877773e-03, -3.17840908e-03, 3.41198230e-03, -2.50685348e-03,
+	9.85630454e-04, 5.32732013e-04, -1.55725699e-03, 1.86163619e-03,
+	-1.50424926e-03, 7.48211478e-04, 7.07481799e-05, -6.72469440e-04,
+	9.13493546e-04, -8.03515217e-04, 4.65894345e-04, -6.86254765e-05,
+	-2.43398171e-04, 3.91535234e-04, -3.72848642e-04, 2.40922325e-04,
+	-7.20973569e-05, -6.71052587e-05, 1.40081401e-04, -1.43965213e-04,
+	1.00351797e-04, -4.00507715e-05, -1.07878552e-05, 3.84606565e-05,
+	-4.23863756e-05, 3.06724140e-05, -1.39318865e-05, 3.34552439e-07,
+	6.58044520e-06, -7.42369675e-06, 4.96669917e-06, -2.03814245e-06,
+	-1.54651272e-06, 1.14942806e-06, 1.73609969e-06, -7.42089671e-06,
+	1.41221468e-05, -1.76762891e-05, 1.27690358e-05, 4.24753702e-06,
+	-3.18814007e-05, 6.12010555e-05, -7.67421594e-05, 6.17295213e-05,
+	-6.73873558e-06, -8.14268757e-05, 1.75406921e-04, -2.31826383e-04,
+	2.06098558e-04, -7.40772278e-05, -1.47680808e-04, 3.93658837e-04,
+	-5.61624828e-04, 5.46817050e-04, -2.89401269e-04, -1.82666003e-04,
+	7.36805377e-04, -1.16101288e-03, 1.23257399e-03, -8.12372882e-04,
+	-6.98251285e-05, 1.17938009e-03, -2.11945212e-03, 2.45495656e-03,
+	-1.88567671e-03, 4.07059468e-04, 1.61264975e-03, -3.49185634e-03,
+	4.43935353e-03, -3.85135364e-03, 1.60053738e-03, 1.80315740e-03,
+	-5.27364044e-03, 7.45478251e-03, -7.20047371e-03, 4.07338959e-03,
+	1.33118374e-03, -7.39904883e-03, 1.19102158e-02, -1.27703210e-02,
+	8.84214622e-03, -5.81422583e-04, -9.79820423e-03, 1.87799763e-02,
+	-2.25672248e-02, 1.84123385e-02, -5.84187197e-03, -1.26534841e-02,
+	3.17682104e-02, -4.44243510e-02, 4.34544059e-02, -2.33881290e-02,
+	-1.84345473e-02, 8.26811848e-02, -1.75102561e-01, 3.64928222e-01,
+	7.72184963e-01, 1.51146163e-02, -8.69148048e-02, 9.28677808e-02,
+	-7.13343899e-02, 3.83327641e-02, -5.36747445e-03, -1.93681589e-02,
+	3.15953240e-02, -3.11201656e-02, 2.11208471e-02, -6.70384042e-03,
+	-6.83265793e-03, 1.55189667e-02, -1.76163500e-02, 1.37260610e-02,
+	-6.18746773e-03, -1.94810657e-03, 7.99037373e-03, -1.03912228e-02,
+	9.03592173e-03, -5.03072618e-03, 1.36075036e-04, 3.91444789e-03,
+	-5.96995795e-03, 5.73268260e-03, -3.70255287e-03, 8.69945642e-04,
+	1.69816180e-03, -3.22249156e-03, 3.41367585e-03, -2.47415332e-03,
+	9.36015717e-04, 5.79917352e-04, -1.58750615e-03, 1.86900858e-03,
+	-1.49148377e-03, 7.23937115e-04, 9.61514657e-05, -6.90673588e-04,
+	9.20479106e-04, -7.99866939e-04, 4.55487217e-04, -5.65271569e-05,
+	-2.52904470e-04, 3.96160897e-04, -3.72521156e-04, 2.37197367e-04,
+	-6.71790514e-05, -7.12893690e-05, 1.42443179e-04, -1.44362577e-04,
+	9.93353386e-05, -3.84488188e-05, -1.22471341e-05, 3.93653929e-05,
+	-4.26694984e-05, 3.05052529e-05, -1.35695124e-05, -1.11502254e-08,
+	6.80115693e-06, -7.50999695e-06, 4.96576979e-06, -2.00665616e-06,
+	-1.51332759e-06, 1.07374179e-06, 1.84817103e-06, -7.51824145e-06,
+	1.41069998e-05, -1.74372824e-05, 1.22494383e-05, 4.96964358e-06,
+	-3.25457964e-05, 6.14002986e-05, -7.60648053e-05, 5.99872938e-05,
+	-4.19292501e-06, -8.39648190e-05, 1.76714801e-04, -2.30687636e-04,
+	2.01903600e-04, -6.73848227e-05, -1.54916783e-04, 3.98439623e-04,
+	-5.60885047e-04, 5.38798140e-04, -2.74918081e-04, -1.99687358e-04,
+	7.50006860e-04, -1.16358714e-03, 1.22007184e-03, -7.85342721e-04,
+	-1.04574580e-04, 1.20983957e-03, -2.13198700e-03, 2.43955210e-03,
+	-1.84106697e-03, 3.43544373e-04, 1.67446633e-03, -3.52689201e-03,
+	4.42713104e-03, -3.78537952e-03, 1.49421066e-03, 1.91729881e-03,
+	-5.35252379e-03, 7.45952953e-03, -7.11270453e-03, 3.90696890e-03,
+	1.52855436e-03, -7.55714016e-03, 1.19587544e-02, -1.26662574e-02,
+	8.59223013e-03, -2.50540871e-04, -1.00989754e-02, 1.89253102e-02,
+	-2.24618520e-02, 1.80342855e-02, -5.26915215e-03, -1.32452581e-02,
+	3.21423535e-02, -4.43489910e-02, 4.27842147e-02, -2.21450303e-02,
+	-1.99904455e-02, 8.39606185e-02, -1.74846851e-01, 3.57900237e-01,
+	7.74944449e-01, 2.04561526e-02, -8.94803991e-02, 9.37023041e-02,
+	-7.10627242e-02, 3.74879397e-02, -4.40361327e-03, -2.01198821e-02,
+	3.19603028e-02, -3.10810428e-02, 2.07834238e-02, -6.23937001e-03,
+	-7.25104073e-03, 1.57678780e-02, -1.76495157e-02, 1.35736724e-02,
+	-5.93251367e-03, -2.20546820e-03, 8.16744858e-03, -1.04458301e-02,
+	8.97258963e-03, -4.89093291e-03, -2.16311458e-05, 4.03632898e-03,
+	-6.02355175e-03, 5.71344649e-03, -3.63023998e-03, 7.77717979e-04,
+	1.77700602e-03, -3.26537048e-03, 3.41401676e-03, -2.44041186e-03,
+	8.85938261e-04, 6.26960723e-04, -1.61718255e-03, 1.87565271e-03,
+	-1.47809974e-03, 6.99324795e-04, 1.21570425e-04, -7.08642748e-04,
+	9.27114162e-04, -7.95891956e-04, 4.44874020e-04, -4.43766245e-05,
+	-2.62334143e-04, 4.00640840e-04, -3.72044293e-04, 2.33367340e-04,
+	-6.22195823e-05, -7.54577206e-05, 1.44755521e-04, -1.44703537e-04,
+	9.82756172e-05, -3.68256522e-05, -1.37070785e-05, 4.02579754e-05,
+	-4.29366682e-05, 3.03250199e-05, -1.31998523e-05, -3.58716802e-07,
+	7.02040985e-06, -7.59378495e-06, 4.96275489e-06, -1.97399442e-06,
+	-1.47985635e-06, 9.98269479e-07, 1.95866078e-06, -7.61190077e-06,
+	1.40862241e-05, -1.71924810e-05, 1.17273982e-05, 5.68654535e-06,
+	-3.31943906e-05, 6.15742093e-05, -7.53595974e-05, 5.82273042e-05,
+	-1.65404549e-06, -8.64611089e-05, 1.77948269e-04, -2.29460479e-04,
+	1.97640354e-04, -6.06841148e-05, -1.62071883e-04, 4.03049762e-04,
+	-5.59924308e-04, 5.30584641e-04, -2.60359702e-04, -2.16590693e-04,
+	7.62881468e-04, -1.16569413e-03, 1.20711180e-03, -7.58056158e-04,
+	-1.39213431e-04, 1.23976010e-03, -2.14365268e-03, 2.42320887e-03,
+	-1.79580817e-03, 2.80005839e-04, 1.73551156e-03, -3.56046990e-03,
+	4.41317440e-03, -3.71801408e-03, 1.38746465e-03, 2.03049739e-03,
+	-5.42916122e-03, 7.46131349e-03, -7.02225397e-03, 3.73925805e-03,
+	1.72501467e-03, -7.71199366e-03, 1.20024807e-02, -1.25573393e-02,
+	8.33930581e-03, 7.99081028e-05, -1.03952522e-02, 1.90629029e-02,
+	-2.23477699e-02, 1.76497886e-02, -4.69546506e-03, -1.38305472e-02,
+	3.25029170e-02, -4.42562694e-02, 4.20990384e-02, -2.08974302e-02,
+	-2.15318341e-02, 8.51996163e-02, -1.74524384e-01, 3.50868465e-01,
+	7.77605332e-01, 2.58595905e-02, -9.20288738e-02, 9.45037799e-02,
+	-7.07617885e-02, 3.66255333e-02, -3.43535430e-03, -2.08654532e-02,
+	3.23134074e-02, -3.10295096e-02, 2.04371113e-02, -5.77158357e-03,
+	-7.66727265e-03, 1.60109515e-02, -1.76757339e-02, 1.34156556e-02,
+	-5.67480469e-03, -2.46235598e-03, 8.34155743e-03, -1.04963773e-02,
+	8.90559938e-03, -4.74898169e-03, -1.79575391e-04, 4.15680054e-03,
+	-6.07484038e-03, 5.69191156e-03, -3.55636763e-03, 6.85028113e-04,
+	1.85527817e-03, -3.30702673e-03, 3.41300251e-03, -2.40564064e-03,
+	8.35417147e-04, 6.73843152e-04, -1.64627329e-03, 1.88156451e-03,
+	-1.46410127e-03, 6.74383613e-04, 1.46994973e-04, -7.26369252e-04,
+	9.33395284e-04, -7.91591097e-04, 4.34058495e-04, -3.21785963e-05,
+	-2.71683235e-04, 4.04972892e-04, -3.71417837e-04, 2.29433480e-04,
+	-5.72208128e-05, -7.96085974e-05, 1.47017344e-04, -1.44987770e-04,
+	9.71729090e-05, -3.51818473e-05, -1.51671031e-05, 4.11379950e-05,
+	-4.31877087e-05, 3.01317285e-05, -1.28230210e-05, -7.08014844e-07,
+	7.23810469e-06, -7.67500892e-06, 4.95763962e-06, -1.94016078e-06,
+	-1.44611777e-06, 9.23042084e-07, 2.06753385e-06, -7.70185916e-06,
+	1.40598600e-05, -1.69420145e-05, 1.12031385e-05, 6.39797619e-06,
+	-3.38269882e-05, 6.17228172e-05, -7.46269220e-05, 5.64503198e-05,
+	8.76911218e-07, -8.89148827e-05, 1.79107064e-04, -2.28145665e-04,
+	1.93310715e-04, -5.39777963e-05, -1.69143474e-04, 4.07487860e-04,
+	-5.58743544e-04, 5.22180292e-04, -2.45732096e-04, -2.33369558e-04,
+	7.75424808e-04, -1.16733401e-03, 1.19369998e-03, -7.30524553e-04,
+	-1.73728149e-04, 1.26913085e-03, -2.15444616e-03, 2.40593509e-03,
+	-1.74991943e-03, 2.16469115e-04, 1.79576259e-03, -3.59257916e-03,
+	4.39749204e-03, -3.64928632e-03, 1.28034237e-03, 2.14270979e-03,
+	-5.50352591e-03, 7.46013833e-03, -6.92916204e-03, 3.57032549e-03,
+	1.92048824e-03, -7.86355299e-03, 1.20413847e-02, -1.24436172e-02,
+	8.08347815e-03, 4.09794238e-04, -1.06869247e-02, 1.91927133e-02,
+	-2.22250389e-02, 1.72590117e-02, -4.12103915e-03, -1.44091339e-02,
+	3.28497898e-02, -4.41462668e-02, 4.13991894e-02, -1.96458316e-02,
+	-2.30581777e-02, 8.63979367e-02, -1.74135857e-01, 3.43834417e-01,
+	7.80166981e-01, 3.13240491e-02, -9.45591556e-02, 9.52717335e-02,
+	-7.04315869e-02, 3.57458273e-02, -2.46306690e-03, -2.16045629e-02,
+	3.26544718e-02, -3.09655611e-02, 2.00820296e-02, -5.30066036e-03,
+	-8.08118506e-03, 1.62480809e-02, -1.76949830e-02, 1.32520641e-02,
+	-5.41443866e-03, -2.71866728e-03, 8.51262662e-03, -1.05428382e-02,
+	8.83497190e-03, -4.60492551e-03, -3.37695382e-04, 4.27581251e-03,
+	-6.12379980e-03, 5.66808266e-03, -3.48096258e-03, 5.91912092e-04,
+	1.93294618e-03, -3.34744165e-03, 3.41063113e-03, -2.36985165e-03,
+	7.84471646e-04, 7.20545700e-04, -1.67476569e-03, 1.88674019e-03,
+	-1.44949268e-03, 6.49122816e-04, 1.72415000e-04, -7.43845512e-04,
+	9.39319178e-04, -7.86965324e-04, 4.23044471e-04, -1.99378196e-05,
+	-2.80947813e-04, 4.09154938e-04, -3.70641635e-04, 2.25397067e-04,
+	-5.21846271e-05, -8.37402857e-05, 1.49227584e-04, -1.45214974e-04,
+	9.60275084e-05, -3.35179902e-05, -1.66266203e-05, 4.20050460e-05,
+	-4.34224492e-05, 2.99253973e-05, -1.24391366e-05, -1.05891048e-06,
+	7.45414227e-06, -7.75361776e-06, 4.95040994e-06, -1.90515935e-06,
+	-1.41213061e-06, 8.48090182e-07, 2.17475610e-06, -7.78810272e-06,
+	1.40279498e-05, -1.66860138e-05, 1.06768820e-05, 7.10367336e-06,
+	-3.44434010e-05, 6.18461617e-05, -7.38671747e-05, 5.46571121e-05,
+	3.39895985e-06, -9.13252973e-05, 1.80190953e-04, -2.26743977e-04,
+	1.88916598e-04, -4.72685544e-05, -1.76128962e-04, 4.11752594e-04,
+	-5.57343774e-04, 5.13588895e-04, -2.31041241e-04, -2.50017567e-04,
+	7.87632628e-04, -1.16850714e-03, 1.17984263e-03, -7.02759338e-04,
+	-2.08105276e-04, 1.29794124e-03, -2.16436481e-03, 2.38773935e-03,
+	-1.70342011e-03, 1.52959403e-04, 1.85519688e-03, -3.62320957e-03,
+	4.38009308e-03, -3.57922574e-03, 1.17288688e-03, 2.25389310e-03,
+	-5.57559200e-03, 7.45600916e-03, -6.83346974e-03, 3.40024005e-03,
+	2.11489916e-03, -8.01176320e-03, 1.20754587e-02, -1.23251438e-02,
+	7.82485301e-03, 7.38987865e-04, -1.09738851e-02, 1.93147031e-02,
+	-2.20937226e-02, 1.68621208e-02, -3.54610277e-03, -1.49808040e-02,
+	3.31828666e-02, -4.40190705e-02, 4.06849847e-02, -1.83907370e-02,
+	-2.45689486e-02, 8.75553541e-02, -1.73681981e-01, 3.36799597e-01,
+	7.82628789e-01, 3.68486285e-02, -9.70701703e-02, 9.60057003e-02,
+	-7.00721343e-02, 3.48491116e-02, -1.48712300e-03, -2.23369037e-02,
+	3.29833347e-02, -3.08891973e-02, 1.97183027e-02, -4.82678120e-03,
+	-8.49260996e-03, 1.64791623e-02, -1.77072439e-02, 1.30829540e-02,
+	-5.15151465e-03, -2.97429954e-03, 8.68058357e-03, -1.05851879e-02,
+	8.76072957e-03, -4.45881826e-03, -4.95928631e-04, 4.39331536e-03,
+	-6.17040686e-03, 5.64196554e-03, -3.40405229e-03, 4.98406192e-04,
+	2.00997818e-03, -3.38659705e-03, 3.40690117e-03, -2.33305727e-03,
+	7.33121233e-04, 7.67049460e-04, -1.70264725e-03, 1.89117624e-03,
+	-1.43427856e-03, 6.23551798e-04, 1.97820378e-04, -7.61064025e-04,
+	9.44882684e-04, -7.82015731e-04, 4.11835866e-04, -7.65907077e-06,
+	-2.90123966e-04, 4.13184916e-04, -3.69715589e-04, 2.21259427e-04,
+	-4.71129299e-05, -8.78510739e-05, 1.51385192e-04, -1.45384871e-04,
+	9.48397279e-05, -3.18346772e-05, -1.80850407e-05, 4.28587264e-05,
+	-4.36407252e-05, 2.97060504e-05, -1.20483209e-05, -1.41126848e-06,
+	7.66842350e-06, -7.82956118e-06, 4.94105262e-06, -1.86899481e-06,
+	-1.37791353e-06, 7.73443978e-07, 2.28029433e-06, -7.87061923e-06,
+	1.39905381e-05, -1.64246117e-05, 1.01488512e-05, 7.80337760e-06,
+	-3.50434484e-05, 6.19442927e-05, -7.30807610e-05, 5.28484563e-05,
+	5.91112205e-06, -9.36915300e-05, 1.81199737e-04, -2.25256235e-04,
+	1.84459939e-04, -4.05590701e-05, -1.83025796e-04, 4.15842712e-04,
+	-5.55726100e-04, 5.04814319e-04, -2.16293127e-04, -2.66528399e-04,
+	7.99500820e-04, -1.16921404e-03, 1.16554622e-03, -6.74772015e-04,
+	-2.42331437e-04, 1.32618091e-03, -2.17340636e-03, 2.36863057e-03,
+	-1.65632976e-03, 8.95018526e-05, 1.91379229e-03, -3.65235151e-03,
+	4.36098730e-03, -3.50786233e-03, 1.06514134e-03, 2.36400490e-03,
+	-5.64533454e-03, 7.44893225e-03, -6.73521905e-03, 3.22907090e-03,
+	2.30817204e-03, -8.15657075e-03, 1.21046965e-02, -1.22019734e-02,
+	7.56353720e-03, 1.06735980e-03, -1.12560276e-02, 1.94288372e-02,
+	-2.19538881e-02, 1.64592839e-02, -2.97088398e-03, -1.55453464e-02,
+	3.35020474e-02, -4.38747740e-02, 3.99567463e-02, -1.71326487e-02,
+	-2.60636276e-02, 8.86716591e-02, -1.73163483e-01, 3.29765509e-01,
+	7.84990172e-01, 4.24324091e-02, -9.95608431e-02, 9.67052263e-02,
+	-6.96834572e-02, 3.39356838e-02, -5.07896991e-04, -2.30621700e-02,
+	3.32998392e-02, -3.08004230e-02, 1.93460579e-02, -4.35012838e-03,
+	-8.90138002e-03, 1.67040941e-02, -1.77125005e-02, 1.29083835e-02,
+	-4.88613289e-03, -3.22915033e-03, 8.84535685e-03, -1.06234033e-02,
+	8.68289628e-03, -4.31071475e-03, -6.54212510e-04, 4.50926005e-03,
+	-6.21463931e-03, 5.61356689e-03, -3.32566482e-03, 4.04546906e-04,
+	2.08634248e-03, -3.42447519e-03, 3.40181174e-03, -2.29527034e-03,
+	6.81385580e-04, 8.13335570e-04, -1.72990574e-03, 1.89486946e-03,
+	-1.41846375e-03, 5.97680095e-04, 2.23200963e-04, -7.78017374e-04,
+	9.50082779e-04, -7.76743543e-04, 4.00436686e-04, 4.65284722e-06,
+	-2.99207810e-04, 4.17060820e-04, -3.68639665e-04, 2.17021928e-04,
+	-4.20076457e-05, -9.19392538e-05, 1.53489138e-04, -1.45497205e-04,
+	9.36098983e-05, -3.01325145e-05, -1.95417728e-05, 4.36986380e-05,
+	-4.38423779e-05, 2.94737173e-05, -1.16506989e-05, -1.76495227e-06,
+	7.88084947e-06, -7.90278966e-06, 4.92955527e-06, -1.83167242e-06,
+	-1.34348510e-06, 6.99133294e-07, 2.38411629e-06, -7.94939807e-06,
+	1.39476712e-05, -1.61579424e-05, 9.61926831e-06, 8.49683324e-06,
+	-3.56269572e-05, 6.20172696e-05, -7.22680952e-05, 5.10251311e-05,
+	8.41242670e-06, -9.60127783e-05, 1.82133244e-04, -2.23683288e-04,
+	1.79942695e-04, -3.38520169e-05, -1.89831465e-04, 4.19757037e-04,
+	-5.53891710e-04, 4.95860498e-04, -2.01493751e-04, -2.82895806e-04,
+	8.11025417e-04, -1.16945546e-03, 1.15081732e-03, -6.46574152e-04,
+	-2.76393345e-04, 1.35383976e-03, -2.18156888e-03, 2.34861803e-03,
+	-1.60866814e-03, 2.61215448e-05, 1.97152703e-03, -3.67999596e-03,
+	4.34018514e-03, -3.43522653e-03, 9.57148929e-04, 2.47300325e-03,
+	-5.71272960e-03, 7.43891504e-03, -6.63445288e-03, 3.05688755e-03,
+	2.50023208e-03, -8.29792353e-03, 1.21290941e-02, -1.20741620e-02,
+	7.29963844e-03, 1.39478138e-03, -1.15332485e-02, 1.95350840e-02,
+	-2.18056056e-02, 1.60506714e-02, -2.39561053e-03, -1.61025533e-02,
+	3.38072382e-02, -4.37134776e-02, 3.92148004e-02, -1.58720684e-02,
+	-2.75417034e-02, 8.97466581e-02, -1.72581103e-01, 3.22733648e-01,
+	7.87250570e-01, 4.80744529e-02, -1.02030099e-01, 9.73698678e-02,
+	-6.92655933e-02, 3.30058489e-02, 4.74234446e-04, -2.37800583e-02,
+	3.36038328e-02, -3.06992480e-02, 1.89654263e-02, -3.87088566e-03,
+	-9.30732871e-03, 1.69227768e-02, -1.77107392e-02, 1.27284130e-02,
+	-4.61839476e-03, -3.48311733e-03, 9.00687615e-03, -1.06574629e-02,
+	8.60149735e-03, -4.16067066e-03, -8.12484274e-04, 4.62359810e-03,
+	-6.25647580e-03, 5.58289429e-03, -3.24582889e-03, 3.10370926e-04,
+	2.16200763e-03, -3.46105884e-03, 3.39536247e-03, -2.25650409e-03,
+	6.29284548e-04, 8.59385219e-04, -1.75652910e-03, 1.89781691e-03,
+	-1.40205333e-03, 5.71517382e-04, 2.48546600e-04, -7.94698230e-04,
+	9.54916577e-04, -7.71150118e-04, 3.88851022e-04, 1.69931063e-05,
+	-3.08195489e-04, 4.20780699e-04, -3.67413887e-04, 2.12685983e-04,
+	-3.68707181e-05, -9.60031211e-05, 1.55538411e-04, -1.45551741e-04,
+	9.23383684e-05, -2.84121182e-05, -2.09962237e-05, 4.45243866e-05,
+	-4.40272548e-05, 2.92284330e-05, -1.12463991e-05, -2.11982403e-06,
+	8.09132146e-06, -7.97325451e-06, 4.91590633e-06, -1.79319801e-06,
+	-1.30886386e-06, 6.25187555e-07, 2.48619070e-06, -8.02443027e-06,
+	1.38993977e-05, -1.58861416e-05, 9.08835513e-06, 9.18378825e-06,
+	-3.61937613e-05, 6.20651620e-05, -7.14296009e-05, 4.91879183e-05,
+	1.09019103e-05, -9.82882603e-05, 1.82991337e-04, -2.22026016e-04,
+	1.75366840e-04, -2.71500601e-05, -1.96543504e-04, 4.23494465e-04,
+	-5.51841876e-04, 4.86731426e-04, -1.86649118e-04, -2.99113607e-04,
+	8.22202602e-04, -1.16923228e-03, 1.13566270e-03, -6.18177377e-04,
+	-3.10277801e-04, 1.38090793e-03, -2.18885080e-03, 2.32771133e-03,
+	-1.56045520e-03, -3.71565129e-05, 2.02837971e-03, -3.70613452e-03,
+	4.31769769e-03, -3.36134924e-03, 8.48952875e-04, 2.58084674e-03,
+	-5.77775416e-03, 7.42596611e-03, -6.53121507e-03, 2.88375979e-03,
+	2.69100506e-03, -8.43577089e-03, 1.21486493e-02, -1.19417676e-02,
+	7.03326528e-03, 1.72112454e-03, -1.18054462e-02, 1.96334146e-02,
+	-2.16489488e-02, 1.56364553e-02, -1.82050974e-03, -1.66522200e-02,
+	3.40983506e-02, -4.35352878e-02, 3.84594778e-02, -1.46094970e-02,
+	-2.90026731e-02, 9.07801740e-02, -1.71935598e-01, 3.15705509e-01,
+	7.89409447e-01, 5.37738025e-02, -1.04476863e-01, 9.79991923e-02,
+	-6.88185916e-02, 3.20599192e-02, 1.45889245e-03, -2.44902672e-02,
+	3.38951675e-02, -3.05856870e-02, 1.85765424e-02, -3.38923811e-03,
+	-9.71029030e-03, 1.71351132e-02, -1.77019492e-02, 1.25431053e-02,
+	-4.34840272e-03, -3.73609844e-03, 9.16507237e-03, -1.06873467e-02,
+	8.51655956e-03, -4.00874251e-03, -9.70681082e-04, 4.73628159e-03,
+	-6.29589590e-03, 5.54995625e-03, -3.16457384e-03, 2.15915133e-04,
+	2.23694237e-03, -3.49633122e-03, 3.38755354e-03, -2.21677218e-03,
+	5.76838180e-04, 9.05179656e-04, -1.78250554e-03, 1.90001596e-03,
+	-1.38505263e-03, 5.45073470e-04, 2.73847124e-04, -8.11099359e-04,
+	9.59381334e-04, -7.65236942e-04, 3.77083048e-04, 2.93568553e-05,
+	-3.17083172e-04, 4.24342662e-04, -3.66038337e-04, 2.08253050e-04,
+	-3.17041088e-05, -1.00040976e-04, 1.57532016e-04, -1.45548266e-04,
+	9.10255050e-05, -2.66741139e-05, -2.24477993e-05, 4.53355821e-05,
+	-4.41952094e-05, 2.89702379e-05, -1.08355535e-05, -2.47574470e-06,
+	8.29974097e-06, -8.04090793e-06, 4.90009511e-06, -1.75357801e-06,
+	-1.27406819e-06, 5.51635781e-07, 2.58648723e-06, -8.09570850e-06,
+	1.38457679e-05, -1.56093462e-05, 8.55633296e-06, 9.86399435e-06,
+	-3.67437025e-05, 6.20880494e-05, -7.05657103e-05, 4.73376026e-05,
+	1.33786174e-05, -1.00517215e-04, 1.83773906e-04, -2.20285332e-04,
+	1.70734365e-04, -2.04558556e-05, -2.03159489e-04, 4.27053964e-04,
+	-5.49577949e-04, 4.77431158e-04, -1.71765237e-04, -3.15175698e-04,
+	8.33028701e-04, -1.16854561e-03, 1.12008927e-03, -5.89593371e-04,
+	-3.43971706e-04, 1.40737584e-03, -2.19525089e-03, 2.30592045e-03,
+	-1.51171107e-03, -1.00307398e-04, 2.08432929e-03, -3.73075938e-03,
+	4.29353671e-03, -3.28626181e-03, 7.40596401e-04, 2.68749445e-03,
+	-5.84038622e-03, 7.41009519e-03, -6.42555040e-03, 2.70975768e-03,
+	2.88041738e-03, -8.57006363e-03, 1.21633618e-02, -1.18048496e-02,
+	6.76452709e-03, 2.04626185e-03, -1.20725212e-02, 1.97238035e-02,
+	-2.14839941e-02, 1.52168095e-02, -1.24580842e-03, -1.71941454e-02,
+	3.43753019e-02, -4.33403175e-02, 3.76911135e-02, -1.33454346e-02,
+	-3.04460425e-02, 9.17720454e-02, -1.71227737e-01, 3.08682579e-01,
+	7.91466290e-01, 5.95294824e-02, -1.06900060e-01, 9.85927781e-02,
+	-6.83425125e-02, 3.10982142e-02, 2.44569613e-03, -2.51924975e-02,
+	3.41737004e-02, -3.04597596e-02, 1.81795446e-02, -2.90537212e-03,
+	-1.01101000e-02, 1.73410085e-02, -1.76861225e-02, 1.23525254e-02,
+	-4.07626028e-03, -3.98799179e-03, 9.31987758e-03, -1.07130364e-02,
+	8.42811114e-03, -3.85498768e-03, -1.12874003e-03, 4.84726318e-03,
+	-6.33288011e-03, 5.51476221e-03, -3.08192962e-03, 1.21216577e-04,
+	2.31111572e-03, -3.53027607e-03, 3.37838566e-03, -2.17608867e-03,
+	5.24066692e-04, 9.50700195e-04, -1.80782349e-03, 1.90146426e-03,
+	-1.36746723e-03, 5.18358304e-04, 2.99092370e-04, -8.27213622e-04,
+	9.63474444e-04, -7.59005636e-04, 3.65137023e-04, 4.17392218e-05,
+	-3.25867063e-04, 4.27744873e-04, -3.64513161e-04, 2.03724626e-04,
+	-2.65097973e-05, -1.04051124e-04, 1.59468981e-04, -1.45486591e-04,
+	8.96716929e-05, -2.49191365e-05, -2.38959041e-05, 4.61318388e-05,
+	-4.43461016e-05, 2.86991778e-05, -1.04182973e-05, -2.83257405e-06,
+	8.50600982e-06, -8.10570296e-06, 4.88211175e-06, -1.71281942e-06,
+	-1.23911643e-06, 4.78506578e-07, 2.68497655e-06, -8.16322703e-06,
+	1.37868342e-05, -1.53276948e-05, 8.02342249e-06, 1.05372071e-05,
+	-3.72766296e-05, 6.20860208e-05, -6.96768645e-05, 4.54749711e-05,
+	1.58416008e-05, -1.02698902e-04, 1.84480873e-04, -2.18462178e-04,
+	1.66047280e-04, -1.37720489e-05, -2.09677042e-04, 4.30434577e-04,
+	-5.47101366e-04, 4.67963807e-04, -1.56848117e-04, -3.31076047e-04,
+	8.43500189e-04, -1.16739671e-03, 1.10410409e-03, -5.60833869e-04,
+	-3.77462060e-04, 1.43323414e-03, -2.20076830e-03, 2.28325566e-03,
+	-1.46245604e-03, -1.63306283e-04, 2.13935517e-03, -3.75386337e-03,
+	4.26771459e-03, -3.20999601e-03, 6.32122728e-04, 2.79290604e-03,
+	-5.90060474e-03, 7.39131316e-03, -6.31750451e-03, 2.53495151e-03,
+	3.06839610e-03, -8.70075404e-03, 1.21732334e-02, -1.16634695e-02,
+	6.49353400e-03, 2.37006653e-03, -1.23343762e-02, 1.98062286e-02,
+	-2.13108214e-02, 1.47919101e-02, -6.71732800e-04, -1.77281318e-02,
+	3.46380152e-02, -4.31286859e-02, 3.69100467e-02, -1.20803801e-02,
+	-3.18713261e-02, 9.27221272e-02, -1.70458304e-01, 3.01666339e-01,
+	7.93420611e-01, 6.53404986e-02, -1.09298616e-01, 9.91502148e-02,
+	-6.78374277e-02, 3.01210607e-02, 3.43426272e-03, -2.58864526e-02,
+	3.44392927e-02, -3.03214903e-02, 1.77745743e-02, -2.41947528e-03,
+	-1.05065938e-02, 1.75403704e-02, -1.76632540e-02, 1.21567403e-02,
+	-3.80207198e-03, -4.23869577e-03, 9.47122514e-03, -1.07345154e-02,
+	8.33618176e-03, -3.69946434e-03, -1.28659815e-03, 4.95649613e-03,
+	-6.36740986e-03, 5.47732249e-03, -2.99792676e-03, 2.63124705e-05,
+	2.38449691e-03, -3.56287762e-03, 3.36786009e-03, -2.13446802e-03,
+	4.70990469e-04, 9.95928225e-04, -1.83247162e-03, 1.90215978e-03,
+	-1.34930295e-03, 4.91381955e-04, 3.24272171e-04, -8.43033977e-04,
+	9.67193446e-04, -7.52457950e-04, 3.53017284e-04, 5.41353141e-05,
+	-3.34543394e-04, 4.30985558e-04, -3.62838563e-04, 1.99102255e-04,
+	-2.12897799e-05, -1.08031877e-04, 1.61348352e-04, -1.45366551e-04,
+	8.82773346e-05, -2.31478302e-05, -2.53399420e-05, 4.69127755e-05,
+	-4.44797975e-05, 2.84153039e-05, -9.99476887e-06, -3.19017074e-06,
+	8.71003013e-06, -8.16759357e-06, 4.86194730e-06, -1.67092983e-06,
+	-1.20402677e-06, 4.05828123e-07, 2.78163030e-06, -8.22698174e-06,
+	1.37226509e-05, -1.50413271e-05, 7.48984374e-06, 1.12031861e-05,
+	-3.77923993e-05, 6.20591750e-05, -6.87635127e-05, 4.36008132e-05,
+	1.82899221e-05, -1.04832604e-04, 1.85112190e-04, -2.16557528e-04,
+	1.61307609e-04, -7.10127392e-06, -2.16093831e-04, 4.33635420e-04,
+	-5.44413644e-04, 4.58333542e-04, -1.41903768e-04, -3.46808704e-04,
+	8.53613691e-04, -1.16578703e-03, 1.08771437e-03, -5.31910649e-04,
+	-4.10735973e-04, 1.45847374e-03, -2.20540250e-03, 2.25972758e-03,
+	-1.41271060e-03, -2.26128446e-04, 2.19343712e-03, -3.77543993e-03,
+	4.24024434e-03, -3.13258402e-03, 5.23575055e-04, 2.89704169e-03,
+	-5.95838968e-03, 7.36963203e-03, -6.20712392e-03, 2.35941181e-03,
+	3.25486897e-03, -8.82779592e-03, 1.21782677e-02, -1.15176901e-02,
+	6.22039686e-03, 2.69241256e-03, -1.25909162e-02, 1.98806705e-02,
+	-2.11295135e-02, 1.43619345e-02, -9.85084014e-05, -1.82539851e-02,
+	3.48864194e-02, -4.29005182e-02, 3.61166204e-02, -1.08148313e-02,
+	-3.32780472e-02, 9.36302903e-02, -1.69628096e-01, 2.94658267e-01,
+	7.95271946e-01, 7.12058387e-02, -1.11671459e-01, 9.96711035e-02,
+	-6.73034204e-02, 2.91287923e-02, 4.42420770e-03, -2.65718382e-02,
+	3.46918110e-02, -3.01709086e-02, 1.73617765e-02, -1.93173631e-03,
+	-1.08996091e-02, 1.77331089e-02, -1.76333412e-02, 1.19558193e-02,
+	-3.52594332e-03, -4.48810909e-03, 9.61904965e-03, -1.07517685e-02,
+	8.24080251e-03, -3.54223147e-03, -1.44419250e-03, 5.06393432e-03,
+	-6.39946754e-03, 5.43764834e-03, -2.91259642e-03, -6.87598341e-05,
+	2.45705546e-03, -3.59412059e-03, 3.35597863e-03, -2.09192510e-03,
+	4.17630051e-04, 1.04084522e-03, -1.85643885e-03, 1.90210075e-03,
+	-1.33056585e-03, 4.64154620e-04, 3.49376365e-04, -8.58553486e-04,
+	9.70536022e-04, -7.45595762e-04, 3.40728250e-04, 6.65402228e-05,
+	-3.43108432e-04, 4.34063000e-04, -3.61014807e-04, 1.94387520e-04,
+	-1.60460691e-05, -1.11981553e-04, 1.63169193e-04, -1.45188000e-04,
+	8.68428502e-05, -2.13608480e-05, -2.67793162e-05, 4.76780156e-05,
+	-4.45961698e-05, 2.81186732e-05, -9.56511009e-06, -3.54839238e-06,
+	8.91170440e-06, -8.22653466e-06, 4.83959367e-06, -1.62791741e-06,
+	-1.16881730e-06, 3.33628161e-07, 2.87642112e-06, -8.28697013e-06,
+	1.36532741e-05, -1.47503841e-05, 6.95581592e-06, 1.18616946e-05,
+	-3.82908755e-05, 6.20076206e-05, -6.78261124e-05, 4.17159201e-05,
+	2.07226519e-05, -1.06917622e-04, 1.85667840e-04, -2.14572385e-04,
+	1.56517392e-04, -4.46152249e-07, -2.22407569e-04, 4.36655682e-04,
+	-5.41516379e-04, 4.48544589e-04, -1.26938195e-04, -3.62367798e-04,
+	8.63365980e-04, -1.16371820e-03, 1.07092748e-03, -5.02835532e-04,
+	-4.43780665e-04, 1.48308584e-03, -2.20915333e-03, 2.23534714e-03,
+	-1.36249536e-03, -2.88749276e-04, 2.24655534e-03, -3.79548311e-03,
+	4.21113964e-03, -3.05405844e-03, 4.14996538e-04, 2.99986218e-03,
+	-6.01372199e-03, 7.34506494e-03, -6.09445601e-03, 2.18320925e-03,
+	3.43976443e-03, -8.95114458e-03, 1.21784700e-02, -1.13675761e-02,
+	5.94522718e-03, 3.01317470e-03, -1.28420484e-02, 1.99471134e-02,
+	-2.09401566e-02, 1.39270620e-02, 4.73640018e-04, -1.87715147e-02,
+	3.51204489e-02, -4.26559461e-02, 3.53111815e-02, -9.54928436e-03,
+	-3.46657381e-02, 9.44964214e-02, -1.68737923e-01, 2.87659832e-01,
+	7.97019856e-01, 7.71244730e-02, -1.14017516e-01, 1.00155057e-01,
+	-6.67405850e-02, 2.81217497e-02, 5.41514497e-03, -2.72483629e-02,
+	3.49311263e-02, -3.00080487e-02, 1.69412997e-02, -1.44234504e-03,
+	-1.12889839e-02, 1.79191364e-02, -1.75963845e-02, 1.17498340e-02,
+	-3.24798075e-03, -4.73613081e-03, 9.76328701e-03, -1.07647825e-02,
+	8.14200590e-03, -3.38334882e-03, -1.60146009e-03, 5.16953228e-03,
+	-6.42903649e-03, 5.39575191e-03, -2.82597030e-03, -1.63962854e-04,
+	2.52876115e-03, -3.62399024e-03, 3.34274363e-03, -2.04847517e-03,
+	3.64006130e-04, 1.08543273e-03, -1.87971434e-03, 1.90128572e-03,
+	-1.31126224e-03, 4.36686618e-04, 3.74394799e-04, -8.73765316e-04,
+	9.73499998e-04, -7.38421084e-04, 3.28274418e-04, 7.89490233e-05,
+	-3.51558481e-04, 4.36975546e-04, -3.59042218e-04, 1.89582046e-04,
+	-1.07806926e-05, -1.15898477e-04, 1.64930592e-04, -1.44950818e-04,
+	8.53686775e-05, -1.95588515e-05, -2.82134296e-05, 4.84271874e-05,
+	-4.46950975e-05, 2.78093478e-05, -9.12946588e-06, -3.90709553e-06,
+	9.11093555e-06, -8.28248210e-06, 4.81504367e-06, -1.58379091e-06,
+	-1.13350597e-06, 2.61933992e-07, 2.96932262e-06, -8.34319128e-06,
+	1.35787617e-05, -1.44550077e-05, 6.42155743e-06, 1.25125004e-05,
+	-3.87719299e-05, 6.19314755e-05, -6.68651293e-05, 3.98210843e-05,
+	2.31388701e-05, -1.08953282e-04, 1.86147836e-04, -2.12507779e-04,
+	1.51678685e-04, 6.19070809e-06, -2.28616019e-04, 4.39494628e-04,
+	-5.38411247e-04, 4.38601225e-04, -1.11957398e-04, -3.77747539e-04,
+	8.72753982e-04, -1.16119205e-03, 1.05375091e-03, -4.73620374e-04,
+	-4.76583470e-04, 1.50706188e-03, -2.21202098e-03, 2.21012561e-03,
+	-1.31183111e-03, -3.51144288e-04, 2.29869043e-03, -3.81398757e-03,
+	4.18041477e-03, -2.97445223e-03, 3.06430275e-04, 3.10132885e-03,
+	-6.06658363e-03, 7.31762616e-03, -5.97954900e-03, 2.00641468e-03,
+	3.62301167e-03, -9.07075686e-03, 1.21738479e-02, -1.12131935e-02,
+	5.66813713e-03, 3.33222852e-03, -1.30876823e-02, 2.00055445e-02,
+	-2.07428395e-02, 1.34874735e-02, 1.04448856e-03, -1.92805336e-02,
+	3.53400442e-02, -4.23951072e-02, 3.44940808e-02, -8.28423378e-03,
+	-3.60339401e-02, 9.53204233e-02, -1.67788609e-01, 2.80672496e-01,
+	7.98663924e-01, 8.30953535e-02, -1.16335718e-01, 1.00601699e-01,
+	-6.61490277e-02, 2.71002805e-02, 6.40668697e-03, -2.79157379e-02,
+	3.51571147e-02, -2.98329499e-02, 1.65132955e-02, -9.51492247e-04,
+	-1.16745578e-02, 1.80983680e-02, -1.75523869e-02, 1.15388578e-02,
+	-2.96829161e-03, -4.98266040e-03, 9.90387443e-03, -1.07735456e-02,
+	8.03982585e-03, -3.22287688e-03, -1.75833800e-03, 5.27324517e-03,
+	-6.45610098e-03, 5.35164625e-03, -2.73808069e-03, -2.59258992e-04,
+	2.59958406e-03, -3.65247234e-03, 3.32815797e-03, -2.00413386e-03,
+	3.10139543e-04, 1.12967242e-03, -1.90228751e-03, 1.89971354e-03,
+	-1.29139866e-03, 4.08988383e-04, 3.99317334e-04, -8.88662740e-04,
+	9.76083346e-04, -7.30936055e-04, 3.15660361e-04, 9.13567772e-05,
+	-3.59889877e-04, 4.39721603e-04, -3.56921182e-04, 1.84687498e-04,
+	-5.49569258e-06, -1.19780984e-04, 1.66631657e-04, -1.44654909e-04,
+	8.38552720e-05, -1.77425108e-05, -2.96416847e-05, 4.91599244e-05,
+	-4.47764663e-05, 2.74873954e-05, -8.68798436e-06, -4.26613583e-06,
+	9.30762694e-06, -8.33539271e-06, 4.78829101e-06, -1.53855968e-06,
+	-1.09811063e-06, 1.90772464e-07, 3.06030942e-06, -8.39564586e-06,
+	1.34991735e-05, -1.41553411e-05, 5.88728570e-06, 1.31553751e-05,
+	-3.92354417e-05, 6.18308671e-05, -6.58810365e-05, 3.79170997e-05,
+	2.55376665e-05, -1.10938931e-04, 1.86552222e-04, -2.10364772e-04,
+	1.46793554e-04, 1.28067136e-05, -2.34716988e-04, 4.42151596e-04,
+	-5.35100003e-04, 4.28507779e-04, -9.69673708e-05, -3.92942224e-04,
+	8.81774771e-04, -1.15821054e-03, 1.03619230e-03, -4.44277063e-04,
+	-5.09131849e-04, 1.53039357e-03, -2.21400599e-03, 2.18407455e-03,
+	-1.26073877e-03, -4.13289131e-04, 2.34982343e-03, -3.83094862e-03,
+	4.14808463e-03, -2.89379876e-03, 1.97919291e-04, 3.20140365e-03,
+	-6.11695757e-03, 7.28733108e-03, -5.86245190e-03, 1.82909907e-03,
+	3.80454062e-03, -9.18659114e-03, 1.21644106e-02, -1.10546103e-02,
+	5.38923943e-03, 3.64945048e-03, -1.33277297e-02, 2.00559542e-02,
+	-2.05376542e-02, 1.30433514e-02, 1.61381428e-03, -1.97808589e-02,
+	3.55451516e-02, -4.21181451e-02, 3.36656723e-02, -7.02017227e-03,
+	-3.73822041e-02, 9.61022146e-02, -1.66780990e-01, 2.73697718e-01,
+	8.00203760e-01, 8.91174152e-02, -1.18624997e-01, 1.01010667e-01,
+	-6.55288656e-02, 2.60647388e-02, 7.39844482e-03, -2.85736772e-02,
+	3.53696572e-02, -2.96456564e-02, 1.60779190e-02, -4.59369670e-04,
+	-1.20561714e-02, 1.82707212e-02, -1.75013545e-02, 1.13229665e-02,
+	-2.68698408e-03, -5.22759775e-03, 1.00407505e-02, -1.07780478e-02,
+	7.93429766e-03, -3.06087687e-03, -1.91476336e-03, 5.37502887e-03,
+	-6.48064630e-03, 5.30534532e-03, -2.64896042e-03, -3.54610552e-04,
+	2.66949456e-03, -3.67955318e-03, 3.31222507e-03, -1.95891722e-03,
+	2.56051257e-04, 1.17354605e-03, -1.92414805e-03, 1.89738334e-03,
+	-1.27098189e-03, 3.81070463e-04, 4.24133845e-04, -9.03239143e-04,
+	9.78284188e-04, -7.23142941e-04, 3.02890726e-04, 1.03758535e-04,
+	-3.68098998e-04, 4.42299639e-04, -3.54652145e-04, 1.79705583e-04,
+	-1.93125227e-07, -1.23627416e-04, 1.68271515e-04, -1.44300197e-04,
+	8.23031061e-05, -1.59125043e-05, -3.10634846e-05, 4.98758650e-05,
+	-4.48401685e-05, 2.71528891e-05, -8.24081676e-06, -4.62536801e-06,
+	9.50168244e-06, -8.38522435e-06, 4.75933033e-06, -1.49223366e-06,
+	-1.06264895e-06, 1.20169963e-07, 3.14935714e-06, -8.44433612e-06,
+	1.34145711e-05, -1.38515287e-05, 5.35321714e-06, 1.37900946e-05,
+	-3.96812977e-05, 6.17059324e-05, -6.48743148e-05, 3.60047612e-05,
+	2.79181408e-05, -1.12873936e-04, 1.86881071e-04, -2.08144452e-04,
+	1.41864082e-04, 1.93992861e-05, -2.40708334e-04, 4.44625999e-04,
+	-5.31584481e-04, 4.18268628e-04, -8.19740936e-05, -4.07946234e-04,
+	8.90425579e-04, -1.15477586e-03, 1.01825943e-03, -4.14817514e-04,
+	-5.41413384e-04, 1.55307292e-03, -2.21510924e-03, 2.15720584e-03,
+	-1.20923937e-03, -4.75159594e-04, 2.39993579e-03, -3.84636215e-03,
+	4.11416475e-03, -2.81213172e-03, 8.95065172e-05, 3.30004914e-03,
+	-6.16482778e-03, 7.25419618e-03, -5.74321454e-03, 1.65133349e-03,
+	3.98428204e-03, -9.29860738e-03, 1.21501694e-02, -1.08918958e-02,
+	5.10864736e-03, 3.96471795e-03, -1.35621048e-02, 2.00983362e-02,
+	-2.03246958e-02, 1.25948796e-02, 2.18139524e-03, -2.02723110e-02,
+	3.57357229e-02, -4.18252094e-02, 3.28263137e-02, -5.75759051e-03,
+	-3.87100901e-02, 9.68417299e-02, -1.65715914e-01, 2.66736944e-01,
+	8.01638998e-01, 9.51895759e-02, -1.20884288e-01, 1.01381609e-01,
+	-6.48802277e-02, 2.50154854e-02, 8.39002852e-03, -2.92218980e-02,
+	3.55686400e-02, -2.94462173e-02, 1.56353282e-02, 3.38301185e-05,
+	-1.24336665e-02, 1.84361162e-02, -1.74432959e-02, 1.11022377e-02,
+	-2.40416718e-03, -5.47084322e-03, 1.01738552e-02, -1.07782807e-02,
+	7.82545803e-03, -2.89741070e-03, -2.07067336e-03, 5.47483993e-03,
+	-6.50265869e-03, 5.25686395e-03, -2.55864288e-03, -4.49979753e-04,
+	2.73846334e-03, -3.70521960e-03, 3.29494892e-03, -1.91284165e-03,
+	2.01762369e-04, 1.21703549e-03, -1.94528589e-03, 1.89429458e-03,
+	-1.25001894e-03, 3.52943517e-04, 4.48834230e-04, -9.17488024e-04,
+	9.80100790e-04, -7.15044140e-04, 2.89970234e-04, 1.16149336e-04,
+	-3.76182261e-04, 4.44708187e-04, -3.52235613e-04, 1.74638048e-04,
+	5.12494040e-06, -1.27436124e-04, 1.69849319e-04, -1.43886632e-04,
+	8.07126698e-05, -1.40695181e-05, -3.24782322e-05, 5.05746531e-05,
+	-4.48861033e-05, 2.68059076e-05, -7.78811738e-06, -4.98464594e-06,
+	9.69300646e-06, -8.43193590e-06, 4.72815716e-06, -1.44482337e-06,
+	-1.02713848e-06, 5.01524036e-08, 3.23644241e-06, -8.48926587e-06,
+	1.33250177e-05, -1.35437154e-05, 4.81956704e-06, 1.44164393e-05,
+	-4.01093922e-05, 6.15568173e-05, -6.38454524e-05, 3.40848638e-05,
+	3.02794032e-05, -1.14757690e-04, 1.87134486e-04, -2.05847935e-04,
+	1.36892359e-04, 2.59658641e-05, -2.46587966e-04, 4.46917324e-04,
+	-5.27866590e-04, 4.07888199e-04, -6.69835361e-05, -4.22754041e-04,
+	8.98703786e-04, -1.15089034e-03, 9.99960208e-04, -3.85253663e-04,
+	-5.73415789e-04, 1.57509218e-03, -2.21533197e-03, 2.12953166e-03,
+	-1.15735411e-03, -5.36731620e-04, 2.44900943e-03, -3.86022472e-03,
+	4.07867124e-03, -2.72948519e-03, -1.87652234e-05, 3.39722852e-03,
+	-6.21017925e-03, 7.21823906e-03, -5.62188749e-03, 1.47318906e-03,
+	4.16216746e-03, -9.40676708e-03, 1.21311373e-02, -1.07251208e-02,
+	4.82647467e-03, 4.27790927e-03, -1.37907242e-02, 2.01326871e-02,
+	-2.01040619e-02, 1.21422432e-02, 2.74701067e-03, -2.07547146e-02,
+	3.59117161e-02, -4.15164555e-02, 3.19763656e-02, -4.49697698e-03,
+	-4.00171677e-02, 9.75389194e-02, -1.64594241e-01, 2.59791617e-01,
+	8.02969296e-01, 1.01310736e-01, -1.23112528e-01, 1.01714187e-01,
+	-6.42032540e-02, 2.39528875e-02, 9.38104702e-03, -2.98601205e-02,
+	3.57539542e-02, -2.92346866e-02, 1.51856846e-02, 5.27913769e-04,
+	-1.28068866e-02, 1.85944758e-02, -1.73782227e-02, 1.08767512e-02,
+	-2.11995067e-03, -5.71229771e-03, 1.03031298e-02, -1.07742375e-02,
+	7.71334503e-03, -2.73254097e-03, -2.22600532e-03, 5.57263562e-03,
+	-6.52212537e-03, 5.20621788e-03, -2.46716198e-03, -5.45328745e-04,
+	2.80646141e-03, -3.72945896e-03, 3.27633401e-03, -1.86592391e-03,
+	1.47294094e-04, 1.26012272e-03, -1.96569125e-03, 1.89044698e-03,
+	-1.22851705e-03, 3.24618307e-04, 4.73408410e-04, -9.31402996e-04,
+	9.81531571e-04, -7.06642175e-04, 2.76903677e-04, 1.28524213e-04,
+	-3.84136123e-04, 4.46945844e-04, -3.49672153e-04, 1.69486677e-04,
+	1.04564230e-05, -1.31205472e-04, 1.71364240e-04, -1.43414186e-04,
+	7.90844700e-05, -1.22142463e-05, -3.38853313e-05, 5.12559381e-05,
+	-4.49141763e-05, 2.64465349e-05, -7.33004352e-06, -5.34382271e-06,
+	9.88150400e-06, -8.47548730e-06, 4.69476799e-06, -1.39633991e-06,
+	-9.91596597e-07, -1.92547752e-08, 3.32154286e-06, -8.53044048e-06,
+	1.32305781e-05, -1.32320474e-05, 4.28654949e-06, 1.50341937e-05,
+	-4.05196273e-05, 6.13836771e-05, -6.27949444e-05, 3.21582032e-05,
+	3.26205746e-05, -1.16589605e-04, 1.87312600e-04, -2.03476366e-04,
+	1.31880490e-04, 3.25039036e-05, -2.52353841e-04, 4.49025132e-04,
+	-5.23948315e-04, 3.97370962e-04, -5.20016521e-05, -4.37360206e-04,
+	9.06606930e-04, -1.14655649e-03, 9.81302670e-04, -3.55597463e-04,
+	-6.05126916e-04, 1.59644390e-03, -2.21467577e-03, 2.10106449e-03,
+	-1.10510425e-03, -5.97981312e-04, 2.49702667e-03, -3.87253346e-03,
+	4.04162082e-03, -2.64589354e-03, -1.26853233e-04, 3.49290561e-03,
+	-6.25299802e-03, 7.17947840e-03, -5.49852209e-03, 1.29473697e-03,
+	4.33812928e-03, -9.51103338e-03, 1.21073292e-02, -1.05543578e-02,
+	4.54283559e-03, 4.58890382e-03, -1.40135068e-02, 2.01590071e-02,
+	-1.98758533e-02, 1.16856289e-02, 3.31044094e-03, -2.12278981e-02,
+	3.60730948e-02, -4.11920448e-02, 3.11161920e-02, -3.23881776e-03,
+	-4.13030162e-02, 9.81937492e-02, -1.63416844e-01, 2.52863168e-01,
+	8.04194339e-01, 1.07479781e-01, -1.25308658e-01, 1.02008074e-01,
+	-6.34980962e-02, 2.28773190e-02, 1.03711084e-02, -3.04880682e-02,
+	3.59254961e-02, -2.90111230e-02, 1.47291526e-02, 1.02268723e-03,
+	-1.31756762e-02, 1.87457253e-02, -1.73061492e-02, 1.06465888e-02,
+	-1.83444506e-03, -5.95186265e-03, 1.04285172e-02, -1.07659134e-02,
+	7.59799808e-03, -2.56633093e-03, -2.38069668e-03, 5.66837393e-03,
+	-6.53903455e-03, 5.15342373e-03, -2.37455214e-03, -6.40619623e-04,
+	2.87346011e-03, -3.75225918e-03, 3.25638540e-03, -1.81818116e-03,
+	9.26677556e-05, 1.30278988e-03, -1.98535461e-03, 1.88584060e-03,
+	-1.20648370e-03, 2.96105697e-04, 4.97846339e-04, -9.44977795e-04,
+	9.82575099e-04, -6.97939696e-04, 2.63695917e-04, 1.40878194e-04,
+	-3.91957086e-04, 4.49011271e-04, -3.46962392e-04, 1.64253294e-04,
+	1.57992299e-05, -1.34933831e-04, 1.72815476e-04, -1.42882856e-04,
+	7.74190307e-05, -1.03473902e-05, -3.52841867e-05, 5.19193753e-05,
+	-4.49243003e-05, 2.60748604e-05, -6.86675549e-06, -5.70275069e-06,
+	1.00670807e-05, -8.51583956e-06, 4.65916022e-06, -1.34679498e-06,
+	-9.56040532e-07, -8.80266217e-08, 3.40463715e-06, -8.56786685e-06,
+	1.31313191e-05, -1.29166716e-05, 3.75437734e-06, 1.56431469e-05,
+	-4.09119127e-05, 6.11866762e-05, -6.17232929e-05, 3.02255746e-05,
+	3.49407868e-05, -1.18369118e-04, 1.87415578e-04, -2.01030914e-04,
+	1.26830587e-04, 3.90108787e-05, -2.58003966e-04, 4.50949058e-04,
+	-5.19831717e-04, 3.86721432e-04, -3.70343782e-05, -4.51759383e-04,
+	9.14132702e-04, -1.14177702e-03, 9.62294978e-04, -3.25860882e-04,
+	-6.36534754e-04, 1.61712090e-03, -2.21314257e-03, 2.07181709e-03,
+	-1.05251121e-03, -6.58884945e-04, 2.54397033e-03, -3.88328616e-03,
+	4.00303081e-03, -2.56139149e-03, -2.34714956e-04, 3.58704489e-03,
+	-6.29327111e-03, 7.13793396e-03, -5.37317041e-03, 1.11604839e-03,
+	4.51210075e-03, -9.61137096e-03, 1.20787621e-02, -1.03796806e-02,
+	4.25784471e-03, 4.89758201e-03, -1.42303740e-02, 2.01772992e-02,
+	-1.96401735e-02, 1.12252244e-02, 3.87146775e-03, -2.16916938e-02,
+	3.62198283e-02, -4.08521442e-02, 3.02461598e-02, -1.98359639e-03,
+	-4.25672247e-02, 9.88062011e-02, -1.62184606e-01, 2.45953022e-01,
+	8.05313835e-01, 1.13695577e-01, -1.27471622e-01, 1.02262956e-01,
+	-6.27649171e-02, 2.17891595e-02, 1.13598201e-02, -3.11054680e-02,
+	3.60831671e-02, -2.87755902e-02, 1.42658995e-02, 1.51795583e-03,
+	-1.35398816e-02, 1.88897929e-02, -1.72270925e-02, 1.04118343e-02,
+	-1.54776153e-03, -6.18944008e-03, 1.05499615e-02, -1.07533049e-02,
+	7.47945795e-03, -2.39884447e-03, -2.53468505e-03, 5.76201363e-03,
+	-6.55337546e-03, 5.09849901e-03, -2.28084830e-03, -7.35814441e-04,
+	2.93943115e-03, -3.77360873e-03, 3.23510869e-03, -1.76963089e-03,
+	3.79047801e-05, 1.34501921e-03, -2.00426674e-03, 1.88047579e-03,
+	-1.18392659e-03, 2.67416647e-04, 5.22137999e-04, -9.58206277e-04,
+	9.83230094e-04, -6.88939479e-04, 2.50351884e-04, 1.53206300e-04,
+	-3.99641693e-04, 4.50903194e-04, -3.44107017e-04, 1.58939760e-04,
+	2.11512578e-05, -1.38619587e-04, 1.74202243e-04, -1.42292663e-04,
+	7.57168923e-05, -8.46965843e-06, -3.66742038e-05, 5.25646254e-05,
+	-4.49163950e-05, 2.56909791e-05, -6.39841648e-06, -6.06128156e-06,
+	1.02496428e-05, -8.55295481e-06, 4.62133223e-06, -1.29620087e-06,
+	-9.20487336e-07, -1.56138677e-07, 3.48570492e-06, -8.60155343e-06,
+	1.30273088e-05, -1.25977355e-05, 3.22326203e-06, 1.62430924e-05,
+	-4.12861656e-05, 6.09659879e-05, -6.06310067e-05, 2.82877732e-05,
+	3.72391832e-05, -1.20095689e-04, 1.87443610e-04, -1.98512776e-04,
+	1.21744774e-04, 4.54842832e-05, -2.63536401e-04, 4.52688813e-04,
+	-5.15518931e-04, 3.75944166e-04, -2.20876311e-05, -4.65946322e-04,
+	9.21278948e-04, -1.13655477e-03, 9.42945418e-04, -2.96055891e-04,
+	-6.67627438e-04, 1.63711629e-03, -2.21073463e-03, 2.04180253e-03,
+	-9.99596460e-04, -7.19418970e-04, 2.58982364e-03, -3.89248121e-03,
+	3.96291909e-03, -2.47601404e-03, -3.42307998e-04, 3.67961151e-03,
+	-6.33098662e-03, 7.09362659e-03, -5.24588521e-03, 9.37194496e-04,
+	4.68401603e-03, -9.70774616e-03, 1.20454545e-02, -1.02011643e-02,
+	3.97161701e-03, 5.20382538e-03, -1.44412498e-02, 2.01875698e-02,
+	-1.93971288e-02, 1.07612186e-02, 4.42987416e-03, -2.21459382e-02,
+	3.63518921e-02, -4.04969262e-02, 2.93666386e-02, -7.31793660e-04,
+	-4.38093920e-02, 9.93762723e-02, -1.60898423e-01, 2.39062594e-01,
+	8.06327517e-01, 1.19956976e-01, -1.29600367e-01, 1.02478532e-01,
+	-6.20038911e-02, 2.06887951e-02, 1.23467890e-02, -3.17120502e-02,
+	3.62268741e-02, -2.85281568e-02, 1.37960959e-02, 2.01352433e-03,
+	-1.38993506e-02, 1.90266094e-02, -1.71410725e-02, 1.01725734e-02,
+	-1.26001190e-03, -6.42493267e-03, 1.06674085e-02, -1.07364105e-02,
+	7.35776673e-03, -2.23014607e-03, -2.68790820e-03, 5.85351423e-03,
+	-6.56513832e-03, 5.04146209e-03, -2.18608588e-03, -8.30875230e-04,
+	3.00434658e-03, -3.79349663e-03, 3.21250998e-03, -1.72029096e-03,
+	-1.69733128e-05, 1.38679310e-03, -2.02241868e-03, 1.87435318e-03,
+	-1.16085364e-03, 2.38562211e-04, 5.46273412e-04, -9.71082421e-04,
+	9.83495425e-04, -6.79644426e-04, 2.36876573e-04, 1.65503554e-04,
+	-4.07186535e-04, 4.52620407e-04, -3.41106774e-04, 1.53547976e-04,
+	2.65103935e-05, -1.42261136e-04, 1.75523786e-04, -1.41643648e-04,
+	7.39786124e-05, -6.58176645e-06, -3.80547897e-05, 5.31913556e-05,
+	-4.48903869e-05, 2.52949913e-05, -5.92519254e-06, -6.41926639e-06,
+	1.04290974e-05, -8.58679630e-06, 4.58128332e-06, -1.24457044e-06,
+	-8.84953886e-07, -2.23566983e-07, 3.56472685e-06, -8.63151016e-06,
+	1.29186171e-05, -1.22753875e-05, 2.69341359e-06, 1.68338285e-05,
+	-4.16423109e-05, 6.07217944e-05, -5.95186008e-05, 2.63455930e-05,
+	3.95149186e-05, -1.21768798e-04, 1.87396919e-04, -1.95923172e-04,
+	1.16625179e-04, 5.19216312e-05, -2.68949259e-04, 4.54244179e-04,
+	-5.11012162e-04, 3.65043759e-04, -7.16730560e-06, -4.79915869e-04,
+	9.28043670e-04, -1.13089278e-03, 9.23262394e-04, -2.66194468e-04,
+	-6.98393251e-04, 1.65642344e-03, -2.20745459e-03, 2.01103414e-03,
+	-9.46381593e-04, -7.79560032e-04, 2.63457033e-03, -3.90011763e-03,
+	3.92130414e-03, -2.38979651e-03, -4.49590136e-04, 3.77057131e-03,
+	-6.36613364e-03, 7.04657818e-03, -5.11671994e-03, 7.58246414e-04,
+	4.85381018e-03, -9.80012691e-03, 1.20074271e-02, -1.00188859e-02,
+	3.68426775e-03, 5.50751661e-03, -1.46460605e-02, 2.01898282e-02,
+	-1.91468281e-02, 1.02938015e-02, 4.98544467e-03, -2.25904720e-02,
+	3.64692671e-02, -4.01265693e-02, 2.84780007e-02, 5.16112542e-04,
+	-4.50291271e-02, 9.99039758e-02, -1.59559198e-01, 2.32193290e-01,
+	8.07235145e-01, 1.26262815e-01, -1.31693845e-01, 1.02654516e-01,
+	-6.12152039e-02, 1.95766178e-02, 1.33316214e-02, -3.23075486e-02,
+	3.63565290e-02, -2.82688963e-02, 1.33199150e-02, 2.50919705e-03,
+	-1.42539323e-02, 1.91561083e-02, -1.70481121e-02, 9.92889375e-03,
+	-9.71308612e-04, -6.65824377e-03, 1.07808054e-02, -1.07152303e-02,
+	7.23296785e-03, -2.06030079e-03, -2.84030413e-03, 5.94283604e-03,
+	-6.57431434e-03, 4.98233220e-03, -2.09030078e-03, -9.25764010e-04,
+	3.06817884e-03, -3.81191247e-03, 3.18859596e-03, -1.67017956e-03,
+	-7.19449183e-05, 1.42809409e-03, -2.03980176e-03, 1.86747375e-03,
+	-1.13727299e-03, 2.09553532e-04, 5.70242641e-04, -9.83600337e-04,
+	9.83370119e-04, -6.70057562e-04, 2.23275044e-04, 1.77764977e-04,
+	-4.14588251e-04, 4.54161768e-04, -3.37962473e-04, 1.48079875e-04,
+	3.18745151e-05, -1.45856889e-04, 1.76779368e-04, -1.40935880e-04,
+	7.22047645e-05, -4.68443644e-06, -3.94253531e-05, 5.37992389e-05,
+	-4.48462096e-05, 2.48870026e-05, -5.44725256e-06, -6.77655568e-06,
+	1.06053523e-05, -8.61732843e-06, 4.53901376e-06, -1.19191715e-06,
+	-8.49456874e-07, -2.90288090e-07, 3.64168463e-06, -8.65774850e-06,
+	1.28053152e-05, -1.19497766e-05, 2.16504054e-06, 1.74151579e-05,
+	-4.19802812e-05, 6.04542866e-05, -5.83865966e-05, 2.43998272e-05,
+	4.17671599e-05, -1.23387952e-04, 1.87275757e-04, -1.93263351e-04,
+	1.11473943e-04, 5.83204579e-05, -2.74240705e-04, 4.55615016e-04,
+	-5.06313690e-04, 3.54024847e-04, 7.72072808e-06, -4.93662966e-04,
+	9.34425027e-04, -1.12479424e-03, 9.03254424e-04, -2.36288586e-04,
+	-7.28820629e-04, 1.67503605e-03, -2.20330539e-03, 1.97952552e-03,
+	-8.92888267e-04, -8.39284968e-04, 2.67819457e-03, -3.90619506e-03,
+	3.87820497e-03, -2.30277446e-03, -5.56519342e-04, 3.85989080e-03,
+	-6.39870233e-03, 6.99681168e-03, -4.98572873e-03, 5.79275193e-04,
+	5.02141920e-03, -9.88848278e-03, 1.19647021e-02, -9.83292315e-03,
+	3.39591248e-03, 5.80853959e-03, -1.48447350e-02, 2.01840873e-02,
+	-1.88893833e-02, 9.82316405e-03, 5.53796532e-03, -2.30251397e-02,
+	3.65719403e-02, -3.97412569e-02, 2.75806208e-02, 1.75964741e-03,
+	-4.62260489e-02, 1.00389340e-01, -1.58167849e-01, 2.25346506e-01,
+	8.08036502e-01, 1.32611914e-01, -1.33751012e-01, 1.02790633e-01,
+	-6.03990524e-02, 1.84530253e-02, 1.43139236e-02, -3.28917008e-02,
+	3.64720492e-02, -2.79978867e-02, 1.28375332e-02, 3.00477788e-03,
+	-1.46034779e-02, 1.92782262e-02, -1.69482365e-02, 9.68088487e-03,
+	-6.81764639e-04, -6.88927743e-03, 1.08901010e-02, -1.06897659e-02,
+	7.10510600e-03, -1.88937427e-03, -2.99181105e-03, 6.02994018e-03,
+	-6.58089577e-03, 4.92112947e-03, -1.99352938e-03, -1.02044281e-03,
+	3.13090073e-03, -3.82884640e-03, 3.16337382e-03, -1.61931522e-03,
+	-1.26988355e-04, 1.46890487e-03, -2.05640759e-03, 1.85983873e-03,
+	-1.11319301e-03, 1.80401836e-04, 5.94035794e-04, -9.95754262e-04,
+	9.82853352e-04, -6.60182036e-04, 2.09552420e-04, 1.89985592e-04,
+	-4.21843526e-04, 4.55526203e-04, -3.34674979e-04, 1.42537430e-04,
+	3.72414923e-05, -1.49405267e-04, 1.77968282e-04, -1.40169450e-04,
+	7.03959388e-05, -2.77839698e-06, -4.07853042e-05, 5.43879549e-05,
+	-4.47838040e-05, 2.44671242e-05, -4.96476815e-06, -7.13299946e-06,
+	1.07783159e-05, -8.64451676e-06, 4.49452480e-06, -1.13825504e-06,
+	-8.14012806e-07, -3.56279060e-07, 3.71656098e-06, -8.68028140e-06,
+	1.26874761e-05, -1.16210524e-05, 1.63834977e-06, 1.79868880e-05,
+	-4.23000167e-05, 6.01636641e-05, -5.72355212e-05, 2.24512677e-05,
+	4.39950861e-05, -1.24952678e-04, 1.87080403e-04, -1.90534582e-04,
+	1.06293208e-04, 6.46783209e-05, -2.79408955e-04, 4.56801255e-04,
+	-5.01425866e-04, 3.42892099e-04, 2.25706263e-05, -5.07182657e-04,
+	9.40421334e-04, -1.11826253e-03, 8.82930138e-04, -2.06350212e-04,
+	-7.58898167e-04, 1.69294807e-03, -2.19829034e-03, 1.94729057e-03,
+	-8.39138211e-04, -8.98570826e-04, 2.72068101e-03, -3.91071375e-03,
+	3.83364118e-03, -2.21498374e-03, -6.63053796e-04, 3.94753721e-03,
+	-6.42868386e-03, 6.94435109e-03, -4.85296633e-03, 4.00351785e-04,
+	5.18678007e-03, -9.97278499e-03, 1.19173039e-02, -9.64335560e-03,
+	3.10666693e-03, 6.10677943e-03, -1.50372047e-02, 2.01703626e-02,
+	-1.86249084e-02, 9.34949825e-03, 6.08722377e-03, -2.34497904e-02,
+	3.66599044e-02, -3.93411781e-02, 2.66748762e-02, 2.99833941e-03,
+	-4.73997867e-02, 1.00832408e-01, -1.56725302e-01, 2.18523628e-01,
+	8.08731397e-01, 1.39003077e-01, -1.35770830e-01, 1.02886621e-01,
+	-5.95556448e-02, 1.73184213e-02, 1.52933015e-02, -3.34642483e-02,
+	3.65733574e-02, -2.77152111e-02, 1.23491293e-02, 3.50007042e-03,
+	-1.49478402e-02, 1.93929021e-02, -1.68414742e-02, 9.42863814e-03,
+	-3.91493474e-04, -7.11793848e-03, 1.09952455e-02, -1.06600210e-02,
+	6.97422719e-03, -1.71743265e-03, -3.14236744e-03, 6.11478858e-03,
+	-6.58487586e-03, 4.85787485e-03, -1.89580850e-03, -1.11487367e-03,
+	3.19248548e-03, -3.84428915e-03, 3.13685129e-03, -1.56771683e-03,
+	-1.82081874e-04, 1.50920832e-03, -2.07222810e-03, 1.85144970e-03,
+	-1.08862228e-03, 1.51118430e-04, 6.17643027e-04, -1.00753857e-03,
+	9.81944456e-04, -6.50021120e-04, 1.95713883e-04, 2.02160427e-04,
+	-4.28949098e-04, 4.56712709e-04, -3.31245220e-04, 1.36922648e-04,
+	4.26091876e-05, -1.52904709e-04, 1.79089841e-04, -1.39344474e-04,
+	6.85527413e-05, -8.64382738e-07, -4.21340556e-05, 5.49571896e-05,
+	-4.47031179e-05, 2.40354724e-05, -4.47791363e-06, -7.48844731e-06,
+	1.09478979e-05, -8.66832807e-06, 4.44781865e-06, -1.08359873e-06,
+	-7.78637989e-07, -4.21517479e-07, 3.78933961e-06, -8.69912328e-06,
+	1.25651740e-05, -1.12893648e-05, 1.11354654e-06, 1.85488311e-05,
+	-4.26014652e-05, 5.98501351e-05, -5.60659076e-05, 2.05007045e-05,
+	4.61978889e-05, -1.26462528e-04, 1.86811166e-04, -1.87738160e-04,
+	1.01085125e-04, 7.09928008e-05, -2.84452282e-04, 4.57802902e-04,
+	-4.96351107e-04, 3.31650220e-04, 3.73765742e-05, -5.20470089e-04,
+	9.46031062e-04, -1.11130116e-03, 8.62298273e-04, -1.76391303e-04,
+	-7.88614621e-04, 1.71015376e-03, -2.19241307e-03, 1.91434341e-03,
+	-7.85153221e-04, -9.57394866e-04, 2.76201479e-03, -3.91367459e-03,
+	3.78763290e-03, -2.12646042e-03, -7.69151903e-04, 4.03347848e-03,
+	-6.45607045e-03, 6.88922143e-03, -4.71848810e-03, 2.21547010e-04,
+	5.34983074e-03, -1.00530064e-02, 1.18652583e-02, -9.45026389e-03,
+	2.81664704e-03, 6.40212256e-03, -1.52234037e-02, 2.01486732e-02,
+	-1.83535205e-02, 8.87299681e-03, 6.63300938e-03, -2.38642771e-02,
+	3.67331578e-02, -3.89265274e-02, 2.57611461e-02, 4.23172040e-03,
+	-4.85499800e-02, 1.01233240e-01, -1.55232493e-01, 2.11726031e-01,
+	8.09319666e-01, 1.45435096e-01, -1.37752265e-01, 1.02942234e-01,
+	-5.86852007e-02, 1.61732147e-02, 1.62693613e-02, -3.40249362e-02,
+	3.66603817e-02, -2.74209572e-02, 1.18548850e-02, 3.99487799e-03,
+	-1.52868735e-02, 1.95000780e-02, -1.67278561e-02, 9.17224681e-03,
+	-1.00609079e-04, -7.34413251e-03, 1.10961907e-02, -1.06260006e-02,
+	6.84037869e-03, -1.54454260e-03, -3.29191206e-03, 6.19734399e-03,
+	-6.58624890e-03, 4.79259015e-03, -1.79717538e-03, -1.20901867e-03,
+	3.25290668e-03, -3.85823202e-03, 3.10903663e-03, -1.51540358e-03,
+	-2.37203665e-04, 1.54898745e-03, -2.08725548e-03, 1.84230851e-03,
+	-1.06356959e-03, 1.21714696e-04, 6.41054553e-04, -1.01894776e-03,
+	9.80642919e-04, -6.39578207e-04, 1.81764674e-04, 2.14284516e-04,
+	-4.35901755e-04, 4.57720346e-04, -3.27674181e-04, 1.31237569e-04,
+	4.79754570e-05, -1.56353667e-04, 1.80143384e-04, -1.38461090e-04,
+	6.66757941e-05, 1.05686575e-06, -4.34710221e-05, 5.55066355e-05,
+	-4.46041065e-05, 2.35921691e-05, -3.98686595e-06, -7.84274841e-06,
+	1.11140083e-05, -8.68873034e-06, 4.39889851e-06, -1.02796340e-06,
+	-7.43348528e-07, -4.85981456e-07, 3.86000528e-06, -8.71429002e-06,
+	1.24384847e-05, -1.09548644e-05, 5.90834321e-07, 1.91008042e-05,
+	-4.28845822e-05, 5.95139161e-05, -5.48782943e-05, 1.85489257e-05,
+	4.83747727e-05, -1.27917078e-04, 1.86468385e-04, -1.84875403e-04,
+	9.58518495e-05, 7.72615023e-05, -2.89369013e-04, 4.58620036e-04,
+	-4.91091901e-04, 3.20303945e-04, 5.21327882e-05, -5.33520509e-04,
+	9.51252842e-04, -1.10391384e-03, 8.41367672e-04, -1.46423797e-04,
+	-8.17958912e-04, 1.72664765e-03, -2.18567756e-03, 1.88069845e-03,
+	-7.30955144e-04, -1.01573457e-03, 2.80218152e-03, -3.91507907e-03,
+	3.74020081e-03, -2.03724082e-03, -8.74772308e-04, 4.11768329e-03,
+	-6.48085537e-03, 6.83144875e-03, -4.58235002e-03, 4.29315341e-05,
+	5.51051018e-03, -1.01291215e-02, 1.18085932e-02, -9.25373000e-03,
+	2.52596885e-03, 6.69445670e-03, -1.54032684e-02, 2.01190409e-02,
+	-1.80753389e-02, 8.39385327e-03, 7.17511326e-03, -2.42684574e-02,
+	3.67917048e-02, -3.84975043e-02, 2.48398119e-02, 5.45932584e-03,
+	-4.96762788e-02, 1.01591909e-01, -1.53690367e-01, 2.04955082e-01,
+	8.09801168e-01, 1.51906744e-01, -1.39694289e-01, 1.02957237e-01,
+	-5.77879506e-02, 1.50178203e-02, 1.72417093e-02, -3.45735141e-02,
+	3.67330558e-02, -2.71152175e-02, 1.13549848e-02, 4.48900378e-03,
+	-1.56204344e-02, 1.95996989e-02, -1.66074160e-02, 8.91180587e-03,
+	1.90774165e-04, -7.56776598e-03, 1.11928902e-02, -1.05877117e-02,
+	6.70360901e-03, -1.37077126e-03, -3.44038398e-03, 6.27757004e-03,
+	-6.58501019e-03, 4.72529802e-03, -1.69766771e-03, -1.30283995e-03,
+	3.31213839e-03, -3.87066689e-03, 3.07993863e-03, -1.46239497e-03,
+	-2.92331868e-04, 1.58822548e-03, -2.10148225e-03, 1.83241732e-03,
+	-1.03804394e-03, 9.22020882e-05, 6.64260637e-04, -1.02997648e-03,
+	9.78948383e-04, -6.28856809e-04, 1.67710092e-04, 2.26352901e-04,
+	-4.42698339e-04, 4.58548249e-04, -3.23962907e-04, 1.25484270e-04,
+	5.33381510e-05, -1.59750609e-04, 1.81128278e-04, -1.37519461e-04,
+	6.47657349e-05, 2.98460239e-06, -4.47956209e-05, 5.60359920e-05,
+	-4.44867321e-05, 2.31373412e-05, -3.49180463e-06, -8.19575164e-06,
+	1.12765586e-05, -8.70569279e-06, 4.34776855e-06, -9.71364854e-07,
+	-7.08160320e-07, -5.49649636e-07, 3.92854374e-06, -8.72579893e-06,
+	1.23074853e-05, -1.06177020e-05, 7.04147783e-08, 1.96426293e-05,
+	-4.31493306e-05, 5.91552320e-05, -5.36732248e-05, 1.65967171e-05,
+	5.05249551e-05, -1.29315925e-04, 1.86052424e-04, -1.81947652e-04,
+	9.05955395e-05, 8.34820549e-05, -2.94157528e-04, 4.59252810e-04,
+	-4.85650804e-04, 3.08858042e-04, 6.68335183e-05, -5.46329273e-04,
+	9.56085458e-04, -1.09610442e-03, 8.20147275e-04, -1.16459613e-04,
+	-8.46920133e-04, 1.74242460e-03, -2.17808811e-03, 1.84637034e-03,
+	-6.76565872e-04, -1.07356767e-03, 2.84116730e-03, -3.91492929e-03,
+	3.69136611e-03, -1.94736147e-03, -9.79873912e-04, 4.20012103e-03,
+	-6.50303292e-03, 6.77106010e-03, -4.44460862e-03, -1.35424162e-04,
+	5.66875840e-03, -1.02011066e-02, 1.17473382e-02, -9.05383709e-03,
+	2.23474847e-03, 6.98367096e-03, -1.55767382e-02, 2.00814910e-02,
+	-1.77904856e-02, 7.91226185e-03, 7.71332840e-03, -2.46621930e-02,
+	3.68355554e-02, -3.80543136e-02, 2.39112570e-02, 6.68069498e-03,
+	-5.07783433e-02, 1.01908504e-01, -1.52099878e-01, 1.98212133e-01,
+	8.10175789e-01, 1.58416784e-01, -1.41595879e-01, 1.02931411e-01,
+	-5.68641365e-02, 1.38526577e-02, 1.82099522e-02, -3.51097352e-02,
+	3.67913189e-02, -2.67980894e-02, 1.08496156e-02, 4.98225086e-03,
+	-1.59483812e-02, 1.96917126e-02, -1.64801907e-02, 8.64741208e-03,
+	4.82541497e-04, -7.78874618e-03, 1.12852990e-02, -1.05451628e-02,
+	6.56396791e-03, -1.19618622e-03, -3.58772258e-03, 6.35543120e-03,
+	-6.58115607e-03, 4.65602195e-03, -1.59732357e-03, -1.39629971e-03,
+	3.37015507e-03, -3.88158623e-03, 3.04956662e-03, -1.40871084e-03,
+	-3.47444582e-04, 1.62690579e-03, -2.11490123e-03, 1.82177861e-03,
+	-1.01205454e-03, 6.25921267e-05, 6.87251610e-04, -1.04061951e-03,
+	9.76860646e-04, -6.17860559e-04, 1.53555489e-04, 2.38360633e-04,
+	-4.49335744e-04, 4.59195618e-04, -3.20112504e-04, 1.19664858e-04,
+	5.86951152e-05, -1.63094020e-04, 1.82043912e-04, -1.36519774e-04,
+	6.28232169e-05, 4.91807579e-06, -4.61072722e-05, 5.65449657e-05,
+	-4.43509644e-05, 2.26711211e-05, -2.99291171e-06, -8.54730564e-06,
+	1.14354610e-05, -8.71918590e-06, 4.29443393e-06, -9.13819424e-07,
+	-6.73089045e-07, -6.12501200e-07, 3.99494179e-06, -8.73366878e-06,
+	1.21722543e-05, -1.02780288e-05, -4.47512327e-07, 2.01741331e-05,
+	-4.33956811e-05, 5.87743158e-05, -5.24512479e-05, 1.46448619e-05,
+	5.26476669e-05, -1.30658693e-04, 1.85563679e-04, -1.78956269e-04,
+	8.53183569e-05, 8.96521139e-05, -2.98816265e-04, 4.59701450e-04,
+	-4.80030437e-04, 2.97317305e-04, 8.14730499e-05, -5.58891842e-04,
+	9.60527857e-04, -1.08787691e-03, 7.98646122e-04, -8.65106436e-05,
+	-8.75487550e-04, 1.75747973e-03, -2.16964936e-03, 1.81137398e-03,
+	-6.22007334e-04, -1.13087210e-03, 2.87895874e-03, -3.91322797e-03,
+	3.64115053e-03, -1.85685909e-03, -1.08441589e-03, 4.28076188e-03,
+	-6.52259846e-03, 6.70808351e-03, -4.30532099e-03, -3.13449810e-04,
+	5.82451646e-03, -1.02689394e-02, 1.16815247e-02, -8.85066958e-03,
+	1.94310207e-03, 7.26965587e-03, -1.57437548e-02, 2.00360515e-02,
+	-1.74990847e-02, 7.42841736e-03, 8.24744972e-03, -2.50453501e-02,
+	3.68647255e-02, -3.75971649e-02, 2.29758662e-02, 7.89537093e-03,
+	-5.18558446e-02, 1.02183131e-01, -1.50461991e-01, 1.91498527e-01,
+	8.10443438e-01, 1.64963963e-01, -1.43456019e-01, 1.02864549e-01,
+	-5.59140113e-02, 1.26781521e-02, 1.91736971e-02, -3.56333574e-02,
+	3.68351154e-02, -2.64696746e-02, 1.03389668e-02, 5.47442233e-03,
+	-1.62705740e-02, 1.97760698e-02, -1.63462192e-02, 8.37916395e-03,
+	7.74577824e-04, -8.00698133e-03, 1.13733738e-02, -1.04983643e-02,
+	6.42150635e-03, -1.02085550e-03, -3.73386762e-03, 6.43089286e-03,
+	-6.57468390e-03, 4.58478626e-03, -1.49618146e-03, -1.48936022e-03,
+	3.42693161e-03, -3.89098311e-03, 3.01793042e-03, -1.35437132e-03,
+	-4.02519869e-04, 1.66501196e-03, -2.12750553e-03, 1.81039515e-03,
+	-9.85610796e-04, 3.28963948e-05, 7.10017867e-04, -1.05087179e-03,
+	9.74379663e-04, -6.06593207e-04, 1.39306269e-04, 2.50302778e-04,
+	-4.55810924e-04, 4.59661725e-04, -3.16124133e-04, 1.13781473e-04,
+	6.40441911e-05, -1.66382400e-04, 1.82889702e-04, -1.35462241e-04,
+	6.08489086e-05, 6.85652957e-06, -4.74053991e-05, 5.70332698e-05,
+	-4.41967805e-05, 2.21936463e-05, -2.49037169e-06, -8.89725884e-06,
+	1.15906285e-05, -8.72918142e-06, 4.23890083e-06, -8.55344039e-07,
+	-6.38150164e-07, -6.74515872e-07, 4.05918720e-06, -8.73791971e-06,
+	1.20328714e-05, -9.93599628e-06, -9.62749206e-07, 2.06951473e-05,
+	-4.36236119e-05, 5.83714086e-05, -5.12129168e-05, 1.26941404e-05,
+	5.47421526e-05, -1.31945027e-04, 1.85002571e-04, -1.75902637e-04,
+	8.00224656e-05, 9.57693615e-05, -3.03343716e-04, 4.59966254e-04,
+	-4.74233484e-04, 2.85686554e-04, 9.60457061e-05, -5.71203784e-04,
+	9.64579138e-04, -1.07923549e-03, 7.76873343e-04, -5.65887512e-05,
+	-9.03650606e-04, 1.77180847e-03, -2.16036627e-03, 1.77572448e-03,
+	-5.67301486e-04, -1.18762609e-03, 2.91554292e-03, -3.90997845e-03,
+	3.58957631e-03, -1.76577062e-03, -1.18835771e-03, 4.35957674e-03,
+	-6.53954837e-03, 6.64254803e-03, -4.16454473e-03, -4.91075380e-04,
+	5.97772648e-03, -1.03325995e-02, 1.16111858e-02, -8.64431302e-03,
+	1.65114579e-03, 7.55230338e-03, -1.59042628e-02, 1.99827539e-02,
+	-1.72012630e-02, 6.94251516e-03, 8.77727412e-03, -2.54177995e-02,
+	3.68792365e-02, -3.71262731e-02, 2.20340262e-02, 9.10290094e-03,
+	-5.29084643e-02, 1.02415907e-01, -1.48777677e-01, 1.84815595e-01,
+	8.10604054e-01, 1.71547013e-01, -1.45273700e-01, 1.02756461e-01,
+	-5.49378390e-02, 1.14947334e-02, 2.01325518e-02, -3.61441427e-02,
+	3.68643957e-02, -2.61300798e-02, 9.82323039e-03, 5.96532130e-03,
+	-1.65868753e-02, 1.98527241e-02, -1.62055438e-02, 8.10716164e-03,
+	1.06676776e-03, -8.22238058e-03, 1.14570729e-02, -1.04473282e-02,
+	6.27627650e-03, -8.44847534e-04, -3.87875923e-03, 6.50392128e-03,
+	-6.56559210e-03, 4.51161607e-03, -1.39428024e-03, -1.58198386e-03,
+	3.48244338e-03, -3.89885117e-03, 2.98504040e-03, -1.29939683e-03,
+	-4.57535769e-04, 1.70252778e-03, -2.13928858e-03, 1.79827001e-03,
+	-9.58722323e-04, 3.12653344e-06, 7.32549870e-04, -1.06072837e-03,
+	9.71505546e-04, -5.95058620e-04, 1.24967888e-04, 2.62174414e-04,
+	-4.62120885e-04, 4.59945912e-04, -3.11999015e-04, 1.07836289e-04,
+	6.93832175e-05, -1.69614269e-04, 1.83665092e-04, -1.34347095e-04,
+	5.88434938e-05, 8.79920263e-06, -4.86894282e-05, 5.75006250e-05,
+	-4.40241646e-05, 2.17050596e-05, -1.98437142e-06, -9.24545952e-06,
+	1.17419757e-05, -8.73565243e-06, 4.18117639e-06, -7.95956187e-07,
+	-6.03358912e-07, -7.35673926e-07, 4.12126879e-06, -8.73857328e-06,
+	1.18894178e-05, -9.59175593e-06, -1.47510012e-06, 2.12055089e-05,
+	-4.38331086e-05, 5.79467594e-05, -4.99587895e-05, 1.07453294e-05,
+	5.68076708e-05, -1.33174597e-04, 1.84369549e-04, -1.72788163e-04,
+	7.47100306e-05, 1.01831507e-04, -3.07738431e-04, 4.60047594e-04,
+	-4.68262696e-04, 2.73970635e-04, 1.10545850e-04, -5.83260780e-04,
+	9.68238562e-04, -1.07018448e-03, 7.54838157e-04, -2.67057630e-05,
+	-9.31398926e-04, 1.78540656e-03, -2.15024414e-03, 1.73943722e-03,
+	-5.12470303e-04, -1.24380808e-03, 2.95090744e-03, -3.90518467e-03,
+	3.53666618e-03, -1.67413312e-03, -1.29165913e-03, 4.43653732e-03,
+	-6.55388009e-03, 6.57448363e-03, -4.02233795e-03, -6.68231111e-04,
+	6.12833171e-03, -1.03920681e-02, 1.15363563e-02, -8.43485410e-03,
+	1.35899569e-03, 7.83150698e-03, -1.60582091e-02, 1.99216323e-02,
+	-1.68971495e-02, 6.45475108e-03, 9.30260062e-03, -2.57794162e-02,
+	3.68791156e-02, -3.66418575e-02, 2.10861250e-02, 1.03028365e-02,
+	-5.39358947e-02, 1.02606968e-01, -1.47047918e-01, 1.78164655e-01,
+	8.10657596e-01, 1.78164655e-01, -1.47047918e-01, 1.02606968e-01,
+	-5.39358947e-02, 1.03028365e-02, 2.10861250e-02, -3.66418575e-02,
+	3.68791156e-02, -2.57794162e-02, 9.30260062e-03, 6.45475108e-03,
+	-1.68971495e-02, 1.99216323e-02, -1.60582091e-02, 7.83150698e-03,
+	1.35899569e-03, -8.43485410e-03, 1.15363563e-02, -1.03920681e-02,
+	6.12833171e-03, -6.68231111e-04, -4.02233795e-03, 6.57448363e-03,
+	-6.55388009e-03, 4.43653732e-03, -1.29165913e-03, -1.67413312e-03,
+	3.53666618e-03, -3.90518467e-03, 2.95090744e-03, -1.24380808e-03,
+	-5.12470303e-04, 1.73943722e-03, -2.15024414e-03, 1.78540656e-03,
+	-9.31398926e-04, -2.67057630e-05, 7.54838157e-04, -1.07018448e-03,
+	9.68238562e-04, -5.83260780e-04, 1.10545850e-04, 2.73970635e-04,
+	-4.68262696e-04, 4.60047594e-04, -3.07738431e-04, 1.01831507e-04,
+	7.47100306e-05, -1.72788163e-04, 1.84369549e-04, -1.33174597e-04,
+	5.68076708e-05, 1.07453294e-05, -4.99587895e-05, 5.79467594e-05,
+	-4.38331086e-05, 2.12055089e-05, -1.47510012e-06, -9.59175593e-06,
+	1.18894178e-05, -8.73857328e-06, 4.12126879e-06, -7.35673926e-07,
+};
+
+/* 228000 -> 192000, passband: 60000, stopband: 62500, 16 / 19 */
+static const float polyphase_228000_192000_60000[9472]
+__attribute__ ((aligned (16))) = {
+	4.21321327e-07, -3.50908773e-08, -5.59909500e-07, 1.96580118e-07,
+	6.78478935e-07, -4.32414669e-07, -7.49438422e-07, 7.40369634e-07,
+	7.41865128e-07, -1.10813503e-06, -6.24252438e-07, 1.51186838e-06,
+	3.68014559e-07, -1.91566934e-06, 4.84595083e-08, 2.27223709e-06,
+	-6.35508636e-07, -2.52490211e-06, 1.38805079e-06, 2.61112291e-06,
+	-2.28203754e-06, -2.46741027e-06, 3.27199613e-06, 2.03549352e-06,
+	-4.29013171e-06, -1.26938714e-06, 5.24740278e-06, 1.42864063e-07,
+	-6.03687435e-06, 1.34329017e-06, 6.53949694e-06, -3.15496541e-06,
+	-6.63226193e-06, 5.22012769e-06, 6.19845714e-06, -7.42668881e-06,
+	-5.13950550e-06, 9.62351627e-06, 3.38763472e-06, -1.16250953e-05,
+	-9.18417426e-07, 1.32201242e-05, -2.23793634e-06, -1.41840312e-05,
+	5.98773960e-06, 1.42950581e-05, -1.01686441e-05, -1.33531940e-05,
+	1.45492067e-05, 1.12008761e-05, -1.88340874e-05, -7.74404853e-06,
+	2.26754326e-05, 2.97190467e-06, -2.56905817e-05, 3.02652330e-06,
+	2.74857319e-05, -1.00508044e-05, -2.76846585e-05, 1.77843450e-05,
+	2.59610336e-05, -2.57979194e-05, -2.20723712e-05, 3.35625642e-05,
+	1.58931930e-05, -4.04723274e-05, -7.44470398e-06, 4.58766647e-05,
+	-3.08186926e-06, -4.91214889e-05, 1.53110538e-05, 4.95970607e-05,
+	-2.86805008e-05, -4.67901204e-05, 4.24519029e-05, 4.03369548e-05,
+	-5.57366566e-05, -3.00735538e-05, 6.75365210e-05, 1.60786888e-05,
+	-7.67984290e-05, 1.29430540e-06, 8.24814291e-05, -2.14010020e-05,
+	-8.36325581e-05, 4.33079663e-05, 7.94673461e-05, -6.58158923e-05,
+	-6.94497445e-05, 8.75050095e-05, 5.33656157e-05, -1.06802508e-04,
+	-3.13836281e-05, 1.22070098e-04, 4.09751913e-06, -1.31708125e-04,
+	2.74557402e-05, 1.34271004e-04, -6.18063064e-05, -1.28587281e-04,
+	9.70932885e-05, 1.13876465e-04, -1.31139104e-04, -8.98540196e-05,
+	1.61555252e-04, 5.68157340e-05, -1.85876058e-04, -1.56930385e-05,
+	2.01714532e-04, -3.19280938e-05, -2.06932296e-04, 8.38303674e-05,
+	1.99813564e-04, -1.37233945e-04, -1.79231758e-04, 1.88911467e-04,
+	1.44796520e-04, -2.35346881e-04, -9.69688567e-05, 2.72932379e-04,
+	3.71329618e-05, -2.98194470e-04, 3.23850594e-05, 3.08037292e-04,
+	-1.08358786e-04, -2.99988738e-04, 1.86767332e-04, 2.72433273e-04,
+	-2.62965451e-04, -2.24814469e-04, 3.31913595e-04, 1.57790522e-04,
+	-3.88459130e-04, -7.33274271e-05, 4.27655599e-04, -2.52829611e-05,
+	-4.45103019e-04, 1.33489064e-04, 4.37289075e-04, -2.45634329e-04,
+	-4.01908995e-04, 3.55199620e-04, 3.38141025e-04, -4.55126397e-04,
+	-2.46855122e-04, 5.38207861e-04, 1.30734594e-04, -5.97529548e-04,
+	5.70582165e-06, 6.26935835e-04, -1.56216824e-04, -6.21494887e-04,
+	3.13031356e-04, 5.77932069e-04, -4.67199083e-04, -4.95001065e-04,
+	6.09028442e-04, 3.73763093e-04, -7.28618346e-04, -2.17747772e-04,
+	8.16454226e-04, 3.29743516e-05, -8.64036658e-04, 1.72181007e-04,
+	8.64505934e-04, -3.87277706e-04, -8.13222877e-04, 6.00259148e-04,
+	7.08265475e-04, -7.98043138e-04, -5.50802678e-04, 9.67230111e-04,
+	3.45311056e-04, -1.09489553e-03, -9.96069066e-05, 1.16942471e-03,
+	-1.75324387e-04, -1.18134200e-03, 4.65708897e-04, 1.12408270e-03,
+	-7.55569271e-04, -9.94655317e-04, 1.02749604e-03, 7.94143931e-04,
+	-1.26357373e-03, -5.28006641e-04, 1.44641827e-03, 2.06134512e-04,
+	-1.56027188e-03, 1.57352495e-04, 1.59209389e-03, -5.44582096e-04,
+	-1.53258093e-03, 9.34672450e-04, 1.37704955e-03, -1.30471820e-03,
+	-1.12611674e-03, 1.63098046e-03, 7.86121374e-04, -1.89022611e-03,
+	-3.69240719e-04, 2.06114869e-03, -1.06729483e-04, -2.12579312e-03,
+	6.18944867e-04, 2.07090056e-03, -1.14042631e-03, -1.88908792e-03,
+	1.64129115e-03, 1.57978024e-03, -2.09025451e-03, -1.14982240e-03,
+	2.45633432e-03, 6.13710069e-04, -2.71067716e-03, 6.60262321e-06,
+	2.82840892e-03, -6.82339604e-04, -2.79040639e-03, 1.37898082e-03,
+	2.58488308e-03, -2.05775342e-03, -2.20868566e-03, 2.67748267e-03,
+	1.66820704e-03, -3.19672553e-03, -9.79837026e-04, 3.57608851e-03,
+	1.69892274e-04, -3.78061561e-03, 7.26007802e-04, 3.78212013e-03,
+	-1.66412418e-03, -3.56133043e-03, 2.59431532e-03, 3.10972108e-03,
+	-3.46223262e-03, -2.43091099e-03, 4.21191002e-03, 1.54152635e-03,
+	-4.78863765e-03, -4.71449117e-04, 5.14198856e-03, -7.36599745e-04,
+	-5.22885318e-03, 2.02816027e-03, 5.01632859e-03, -3.33879999e-03,
+	-4.48431079e-03, 4.59649409e-03, 3.62764754e-03, -5.72453174e-03,
+	-2.45772748e-03, 6.64482964e-03, 1.00340753e-03, -7.28150724e-03,
+	6.88785437e-04, 7.56455796e-03, -2.55520257e-03, -7.43343830e-03,
+	4.51634780e-03, 6.84039359e-03, -6.47880562e-03, -5.75334378e-03,
+	8.33769100e-03, 4.15816765e-03, -9.97942612e-03, -2.06024553e-03,
+	1.12845709e-02, -5.14850403e-04, -1.21303301e-02, 3.52159655e-03,
+	1.23922038e-02, -6.89573440e-03, -1.19439799e-02, 1.05564817e-02,
+	1.06547646e-02, -1.44097476e-02, -8.38072336e-03, 1.83523945e-02,
+	4.94694212e-03, -2.22777213e-02, -1.09419841e-04, 2.60827407e-02,
+	-6.52705756e-03, -2.96789930e-02, 1.57021583e-02, 3.30124905e-02,
+	-2.90236483e-02, -3.61137949e-02, 5.07380185e-02, 3.92834333e-02,
+	-9.65028958e-02, -4.43482245e-02, 3.04203917e-01, 5.37031563e-01,
+	3.27880611e-01, -2.91771951e-02, -1.02425924e-01, 3.23636681e-02,
+	5.51065328e-02, -3.22106632e-02, -3.27970421e-02, 3.07873424e-02,
+	1.90521268e-02, -2.85642967e-02, -9.48427231e-03, 2.57630990e-02,
+	2.45154190e-03, -2.25431945e-02, 2.79124429e-03, 1.90450138e-02,
+	-6.63480671e-03, -1.54011219e-02, 9.31473337e-03, 1.17377986e-02,
+	-1.09961571e-02, -8.17329004e-03, 1.18130914e-02, 4.81494089e-03,
+	-1.18873851e-02, -1.75616464e-03, 1.13375315e-02, -9.26259701e-04,
+	-1.02820140e-02, 3.17428477e-03, 8.83955399e-03, -4.94992386e-03,
+	-7.12757957e-03, 6.23572896e-03, 5.25972842e-03, -7.03439775e-03,
+	-3.34292654e-03, 7.36754217e-03, 1.47443188e-03, -7.27369629e-03,
+	2.60870661e-04, 6.80567887e-03, -1.79271137e-03, -6.02745495e-03,
+	3.06706639e-03, 5.01066156e-03, -4.04708395e-03, -3.83097331e-03,
+	4.71326446e-03, 2.56448517e-03, -5.06289969e-03, -1.28428207e-03,
+	5.10881826e-03, 5.73489832e-05, -4.87752087e-03, 1.05804853e-03,
+	4.40681816e-03, -2.01441185e-03, -3.74310520e-03, 2.77641703e-03,
+	2.93842031e-03, -3.32164952e-03, -2.04744027e-03, 3.64066832e-03,
+	1.12456024e-03, -3.73643538e-03, -2.21195802e-04, 3.62317634e-03,
+	-6.16573927e-04, -3.32476392e-03, 1.34992646e-03, 2.87273480e-03,
+	-1.94871097e-03, -2.30406309e-03, 2.39231959e-03, 1.65881935e-03,
+	-2.67000627e-03, -9.77842137e-04, 2.78067379e-03, 3.00541252e-04,
+	-2.73217558e-03, 3.37062584e-04, 2.54020176e-03, -9.03975419e-04,
+	-2.22683616e-03, 1.37548150e-03, 1.81888295e-03, -1.73396926e-03,
+	-1.34606765e-03, 1.96931774e-03, 8.39216816e-04, -2.07885398e-03,
+	-3.28515388e-04, 2.06691389e-03, -1.58070375e-04, -1.94405878e-03,
+	5.96131076e-04, 1.72601451e-03, -9.65858280e-04, -1.43241099e-03,
+	1.25275906e-03, 1.08540524e-03, -1.44802604e-03, -7.08271777e-04,
+	1.54856802e-03, 3.24040317e-04, -1.55672456e-03, 4.57479190e-05,
+	1.47970379e-03, -3.82105240e-04, -1.32879530e-03, 6.69438313e-04,
+	1.11841883e-03, -8.96134971e-04, -8.65074109e-04, 1.05488361e-03,
+	5.86258093e-04, -1.14272776e-03, -2.99412749e-04, 1.16087334e-03,
+	2.09601337e-05, -1.11427836e-03, 2.34527732e-04, 1.01106563e-03,
+	-4.54987883e-04, -8.61805163e-04, 6.31330561e-04, 6.78717677e-04,
+	-7.57697668e-04, -4.74850447e-04, 8.31517326e-04, 2.63274837e-04,
+	-8.53367899e-04, -5.63494721e-05, 8.26674759e-04, -1.34914133e-04,
+	-7.57270872e-04, 3.01355565e-04, 6.52857695e-04, -4.36020973e-04,
+	-5.22405681e-04, 5.34361952e-04, 3.75534036e-04, -5.94279571e-04,
+	-2.21907315e-04, 6.16024152e-04, 7.06823598e-05, -6.01968965e-04,
+	6.99666640e-05, 5.56281880e-04, -1.93224276e-04, -4.84522969e-04,
+	2.93897487e-04, 3.93198041e-04, -3.68561889e-04, -2.89298116e-04,
+	4.15591946e-04, 1.79853059e-04, -4.35084105e-04, -7.15243293e-05,
+	4.28686941e-04, -2.97427716e-05, -3.99356833e-04, 1.18992289e-04,
+	3.51060451e-04, -1.92447005e-04, -2.88446595e-04, 2.47610631e-04,
+	2.16509721e-04, -2.83284957e-04, -1.40265932e-04, 2.99509018e-04,
+	6.44595433e-05, -2.97431390e-04, 6.68521702e-06, 2.79129719e-04,
+	-6.96568983e-05, -2.47393462e-04, 1.21787823e-04, 2.05486501e-04,
+	-1.61321626e-04, -1.56905931e-04, 1.87419619e-04, 1.05151960e-04,
+	-2.00111778e-04, -5.35217043e-05, 2.00200982e-04, 4.93693746e-06,
+	-1.89131114e-04, 3.81872530e-05, 1.68830838e-04, -7.40291731e-05,
+	-1.41545125e-04, 1.01402009e-04, 1.09666146e-04, -1.19752371e-04,
+	-7.55739858e-05, 1.29120620e-04, 4.14958984e-05, -1.30069564e-04,
+	-9.39078806e-06, 1.23589432e-04, -1.91367382e-05, -1.10987636e-04,
+	4.28907020e-05, 9.37718964e-05, -6.11066527e-05, -7.35347634e-05,
+	7.34452857e-05, 5.18466223e-05, -7.99605531e-05, -3.01629051e-05,
+	8.10472422e-05, 9.74970432e-06, -7.73737488e-05, 8.36968462e-06,
+	6.98060652e-05, -2.34463994e-05, -5.93288748e-05, 3.50164453e-05,
+	4.69691446e-05, -4.28918507e-05, -3.37268073e-05, 4.71354914e-05,
+	2.05161153e-05, -4.80232485e-05, -8.12011958e-06, 4.59975481e-05,
+	-2.84043659e-06, -4.16164098e-05, 1.19236301e-05, 3.55019120e-05,
+	-1.88690878e-05, -2.82915383e-05, 2.35885622e-05, 2.05952360e-05,
+	-2.61465916e-05, -1.29602742e-05, 2.67338609e-05, 5.84519357e-06,
+	-2.56360369e-05, 3.96646647e-07, 2.32007966e-05, -5.52413927e-06,
+	-1.98055306e-05, 9.40694913e-06, 1.58278250e-05, -1.20167917e-05,
+	-1.16203494e-05, 1.34131055e-05, 7.49124921e-06, -1.37249207e-05,
+	-3.69060207e-06, 1.31307436e-05, 4.02992630e-07, -1.18381634e-05,
+	2.25418255e-06, 1.00646639e-05, -4.22742365e-06, -8.02082471e-06,
+	5.51984562e-06, 5.89675315e-06, -6.18104685e-06, -3.85222788e-06,
+	6.29531073e-06, 2.01069170e-06, -5.96926982e-06, -4.56925589e-07,
+	5.32003313e-06, -7.62014966e-07, -4.46459058e-06, 1.63320205e-06,
+	3.51108720e-06, -2.17228742e-06, -2.55232502e-06, 2.41675568e-06,
+	1.66162246e-06, -2.41870484e-06, -8.90956330e-07, 2.23780328e-06,
+	2.71143383e-07, -1.93495389e-06, 1.86305835e-07, 1.56705463e-06,
+	-4.86103424e-07, -1.18309176e-06, 6.45342069e-07, 8.21654454e-07,
+	-6.89350937e-07, -5.09825847e-07, 6.47655836e-07, 2.63297515e-07,
+	-5.50373413e-07, -8.74749215e-08, 4.25276578e-07, -2.07052627e-08,
+	4.12744989e-07, 1.67093094e-08, -5.63046576e-07, 1.28775887e-07,
+	7.01276675e-07, -3.51352659e-07, -8.00342497e-07, 6.51975439e-07,
+	8.28877445e-07, -1.02182918e-06, -7.53771828e-07, 1.44055891e-06,
+	5.43536663e-07, -1.87534211e-06, -1.72325160e-07, 2.28109004e-06,
+	-3.75666916e-07, -2.60200535e-06, 1.10179517e-06, 2.77463156e-06,
+	-1.98900250e-06, -2.73240770e-06, 2.99878902e-06, 2.41159578e-06,
+	-4.06961250e-06, -1.75829028e-06, 5.11717382e-06, 7.36058767e-07,
+	-6.03694922e-06, 6.66382142e-07, 6.70918870e-06, -2.42816684e-06,
+	-7.00641164e-06, 4.49073807e-06, 6.80320796e-06, -6.75455358e-06,
+	-5.98790883e-06, 9.07877571e-06, 4.47544461e-06, -1.12845430e-05,
+	-2.22048082e-06, 1.31622146e-05, -7.70262311e-07, -1.44826984e-05,
+	4.42772103e-06, 1.50126433e-05, -8.61347918e-06, -1.45329051e-05,
+	1.31172223e-05, 1.28593195e-05, -1.76596599e-05, -9.86446160e-06,
+	2.19016331e-05, 5.49876879e-06, -2.54597276e-05, 1.90806228e-07,
+	2.79282331e-05, -7.04654094e-06, -2.89067460e-05, 1.47919649e-05,
+	2.80321456e-05, -2.30318274e-05, -2.50131258e-05, 3.12613046e-05,
+	1.96649801e-05, -3.88852074e-05, -1.19419651e-05, 4.52472798e-05,
+	1.96435662e-06, -4.96689032e-05, 9.96270651e-06, 5.14956902e-05,
+	-2.33412869e-05, -5.01496242e-05, 3.74858727e-05, 4.51836359e-05,
+	-5.15433320e-05, -3.63348781e-05, 6.45282729e-05, 2.35725337e-05,
+	-7.53734209e-05, -7.13581892e-06, 8.29934438e-05, -1.24420206e-05,
+	-8.63594391e-05, 3.43274550e-05, 8.45801304e-05, -5.74010826e-05,
+	-7.69847989e-05, 8.02945085e-05, 6.32021854e-05, -1.01450080e-04,
+	-4.32291450e-05, 1.19202259e-04, 1.74827683e-05, -1.31877695e-04,
+	1.31699205e-05, 1.37909329e-04, -4.74097171e-05, -1.35958285e-04,
+	8.34941357e-05, 1.25035953e-04, -1.19319384e-04, -1.04617746e-04,
+	1.52515240e-04, 7.47395353e-05, -1.80570326e-04, -3.60679383e-05,
+	2.00982809e-04, -1.00636104e-05, -2.11429238e-04, 6.16596191e-05,
+	2.09942071e-04, -1.16112684e-04, -1.95084777e-04, 1.70300957e-04,
+	1.66112265e-04, -2.20731823e-04, -1.23104063e-04, 2.63727392e-04,
+	6.70580609e-05, -2.95644043e-04, 6.59618148e-08, 3.13115094e-04,
+	-7.53616143e-05, -3.13302896e-04, 1.55055495e-04, 2.94144552e-04,
+	-2.34652888e-04, -2.54574181e-04, 3.09147066e-04, 1.94704419e-04,
+	-3.73285182e-04, -1.15950798e-04, 4.21879235e-04, 2.10846933e-05,
+	-4.50146374e-04, 8.57961201e-05, 4.54059283e-04, -1.99385960e-04,
+	-4.30684759e-04, 3.13380213e-04, 3.78487185e-04, -4.20770409e-04,
+	-2.97573599e-04, 5.14214941e-04, 1.89858602e-04, -5.86468983e-04,
+	-5.91304565e-05, 6.30851757e-04, -8.89956131e-05, -6.41724708e-04,
+	2.47244958e-04, 6.14951015e-04, -4.06972823e-04, -5.48305205e-04,
+	5.58568657e-04, 4.41802023e-04, -6.91960590e-04, -2.97915972e-04,
+	7.97197465e-04, 1.21667383e-04, -8.65078839e-04, 7.94428420e-05,
+	8.87797581e-04, -2.95659633e-04, -8.59555804e-04, 5.15361785e-04,
+	7.77113040e-04, -7.25601926e-04, -6.40226231e-04, 9.12778331e-04,
+	4.51944441e-04, -1.06340844e-03, -2.18727043e-04, 1.16496504e-03,
+	-4.96374492e-05, -1.20672874e-03, 3.40324280e-04, 1.18060564e-03,
+	-6.37977352e-04, -1.08185672e-03, 9.25413290e-04, 9.09686688e-04,
+	-1.18449850e-03, -6.67644382e-04, 1.39716026e-03, 3.63794347e-04,
+	-1.54648159e-03, -1.06300624e-05, 1.61782034e-03, -3.75287369e-04,
+	-1.59988690e-03, 7.73965903e-04, 1.48571212e-03, -1.16287882e-03,
+	-1.27343839e-03, 1.51808795e-03, 9.66872097e-04, -1.81554504e-03,
+	-5.75745547e-04, 2.03250817e-03, 1.15649300e-04, -2.14899830e-03,
+	3.92387011e-04, 2.14921330e-03, -9.22668492e-04, -2.02281279e-03,
+	1.44594579e-03, 1.76598864e-03, -1.93082420e-03, -1.38224217e-03,
+	2.34541226e-03, 8.82800305e-04, -2.65913278e-03, -2.86619118e-04,
+	2.84460454e-03, -3.80056660e-04, -2.87949227e-03, 1.08458657e-03,
+	2.74821734e-03, -1.78926287e-03, -2.44342192e-03, 2.45303193e-03,
+	1.96708633e-03, -3.03354090e-03, -1.33121189e-03, 3.48941967e-03,
+	5.57999819e-04, -3.78268888e-03, 3.20519238e-04, 3.88117137e-03,
+	-1.26342395e-03, -3.76077616e-03, 2.22239777e-03, 3.40752370e-03,
+	-3.14373917e-03, -2.81918681e-03, 3.97081442e-03, 2.00643580e-03,
+	-4.64685329e-03, -9.93396161e-04, 5.11796440e-03, -1.82446113e-04,
+	-5.33622930e-03, 1.47102547e-03, 5.26272354e-03, -2.81116330e-03,
+	-4.87031010e-03, 4.13268313e-03, 4.14605621e-03, -5.35910174e-03,
+	-3.09313928e-03, 6.41078983e-03, 1.73213024e-03, -7.20846614e-03,
+	-1.01574296e-04, 7.67686529e-03, -1.74217278e-03, -7.74840264e-03,
+	3.72584968e-03, 7.36665103e-03, -5.76088157e-03, -6.48944382e-03,
+	7.74554741e-03, 5.09142703e-03, -9.56754550e-03, -3.16589802e-03,
+	1.11067005e-02, 7.25788251e-04, -1.22374500e-02, 2.19633199e-03,
+	1.28305919e-02, -5.54933591e-03, -1.27535093e-02, 9.26582618e-03,
+	1.18675981e-02, -1.32657994e-02, -1.00206269e-02, 1.74620390e-02,
+	7.02957187e-03, -2.17680440e-02, -2.64427171e-03, 2.61105060e-02,
+	-3.53143589e-03, -3.04517664e-02, 1.22252451e-02, 3.48387856e-02,
+	-2.49972137e-02, -3.95390937e-02, 4.59197284e-02, 4.55613844e-02,
+	-8.97679943e-02, -5.81346964e-02, 2.80043967e-01, 5.35040946e-01,
+	3.50925863e-01, -1.26758144e-02, -1.07440450e-01, 2.48564284e-02,
+	5.89660320e-02, -2.78626100e-02, -3.62710726e-02, 2.81816846e-02,
+	2.22361659e-02, -2.71157174e-02, -1.23697494e-02, 2.51520327e-02,
+	5.01036857e-03, -2.25592713e-02, 5.85853127e-04, 1.95305897e-02,
+	-4.80151272e-03, -1.62277801e-02, 7.86155611e-03, 1.27959041e-02,
+	-9.91973214e-03, -9.36736007e-03, 1.10988936e-02, 6.06178212e-03,
+	-1.15105937e-02, -2.98433190e-03, 1.12643664e-02, 2.23566732e-04,
+	-1.04714233e-02, 2.15050448e-03, 9.24514350e-03, -4.08783912e-03,
+	-7.69968388e-03, 5.55906602e-03, 5.94752104e-03, -6.55539103e-03,
+	-4.09647326e-03, 7.08768861e-03, 2.24659779e-03, -7.18482262e-03,
+	-4.87261070e-04, 6.89128567e-03, -1.10539306e-03, -6.26428213e-03,
+	2.47041195e-03, 5.37040668e-03, -3.56332880e-03, -4.28208644e-03,
+	4.35672285e-03, 3.07396127e-03, -4.84003171e-03, -1.81937405e-03,
+	5.01864575e-03, 5.87130693e-04, -4.91235241e-03, 5.61330124e-04,
+	4.55323044e-03, -1.57424362e-03, -3.98311861e-03, 2.41121930e-03,
+	3.25080036e-03, -3.04428634e-03, -2.40905408e-03, 3.45827023e-03,
+	1.51171893e-03, -3.65052147e-03, -6.10917942e-04, 3.63004828e-03,
+	-2.45434520e-04, -3.41613303e-03, 1.01573516e-03, 3.03653386e-03,
+	-1.66632354e-03, -2.52538859e-03, 2.17259146e-03, 1.92094654e-03,
+	-2.51954769e-03, -1.26325544e-03, 2.70184553e-03, 5.91925630e-04,
+	-2.72330777e-03, 5.59180795e-05, 2.59600806e-03, -6.47402788e-04,
+	-2.33898702e-03, 1.15531892e-03, 1.97669609e-03, -1.55912685e-03,
+	-1.53727016e-03, 1.84553375e-03, 1.05073319e-03, -2.00864003e-03,
+	-5.47237100e-04, 2.04967827e-03, 5.54264635e-05, -1.97638762e-03,
+	3.98992080e-04, 1.80208379e-03, -7.94412811e-04, -1.54449708e-03,
+	1.11418255e-03, 1.22445872e-03, -1.34711712e-03, -8.64518321e-04,
+	1.48767908e-03, 4.87573588e-04, -1.53583182e-03, -1.15586752e-04,
+	1.49660236e-03, -2.31547813e-04, -1.37939869e-03, 5.36933349e-04,
+	1.19713817e-03, -7.87361478e-04, -9.65249811e-04, 9.73743644e-04,
+	7.00615762e-04, -1.09127896e-03, -4.20516027e-04, 1.13936939e-03,
+	1.41635370e-04, -1.12130664e-03, 1.20816494e-04, 1.04376627e-03,
+	-3.53830655e-04, -9.16152813e-04, 5.47141803e-04, 7.49844803e-04,
+	-6.93571840e-04, -5.57390617e-04, 7.89170725e-04, 3.51704842e-04,
+	-8.33162914e-04, -1.45311015e-04, 8.27718267e-04, -5.03297448e-05,
+	-7.77574933e-04, 2.25372799e-04, 6.89548086e-04, -3.72004636e-04,
+	-5.71962292e-04, 4.84705884e-04, 4.34046606e-04, -5.60360276e-04,
+	-2.85330537e-04, 5.98216378e-04, 1.35075752e-04, -5.99716871e-04,
+	8.22657311e-06, 5.68216776e-04, -1.37269213e-04, -5.08616662e-04,
+	2.46236879e-04, 4.26939716e-04, -3.31000037e-04, -3.29882366e-04,
+	3.89193379e-04, 2.24367131e-04, -4.20184678e-04, -1.17123773e-04,
+	4.24945788e-04, 1.43207951e-05, -4.05842312e-04, 7.87355819e-05,
+	3.66361838e-04, -1.57823432e-04, -3.10802540e-04, 2.19942346e-04,
+	2.43944310e-04, -2.63365705e-04, -1.70723616e-04, 2.87612971e-04,
+	9.59310975e-05, -2.93351322e-04, -2.39477555e-05, 2.82239343e-04,
+	-4.14682405e-05, -2.56727800e-04, 9.73363053e-05, 2.19833703e-04,
+	-1.41546247e-04, -1.74903892e-04, 1.72889737e-04, 1.25383488e-04,
+	-1.91034737e-04, -7.46026980e-05, 1.96450252e-04, 2.55930334e-05,
+	-1.90291091e-04, 1.90589421e-05, 1.74253818e-04, -5.73153358e-05,
+	-1.50415698e-04, 8.77462770e-05, 1.21068318e-04, -1.09545988e-04,
+	-8.85566374e-05, 1.22509251e-04, 5.51328165e-05, -1.26974028e-04,
+	-2.28322007e-05, 1.23737499e-04, -6.62329043e-06, -1.13953690e-04,
+	3.18914377e-05, 9.90210967e-05, -5.20449504e-05, -8.04684819e-05,
+	6.65769846e-05, 5.98461763e-05, -7.53800267e-05, -3.86290926e-05,
+	7.87025699e-05, 1.81361865e-05, -7.70889316e-05, 5.30482735e-07,
+	7.13080291e-05, -1.65255657e-05, -6.22769702e-05, 2.92791247e-05,
+	5.09849688e-05, -3.84956048e-05, -3.84224223e-05, 4.41355771e-05,
+	2.55190759e-05, -4.63835800e-05, -1.30941313e-05, 4.56058980e-05,
+	1.82002385e-06, -4.23023074e-05, 7.79952344e-06, 3.70557240e-05,
+	-1.54375816e-05, -3.04833325e-05, 2.09395211e-05, 2.31922293e-05,
+	-2.43079064e-05, -1.57419193e-05, 2.56792080e-05, 8.61524396e-06,
+	-2.52950016e-05, -2.19853859e-06, 2.34703469e-05, -3.22891519e-06,
+	-2.05618786e-05, 7.49672586e-06, 1.69378205e-05, -1.05376221e-05,
+	-1.29517048e-05, 1.23755604e-05, 8.92107433e-06, -1.31094188e-05,
+	-5.11192268e-06, 1.28940572e-05, 1.72911377e-06, -1.19204654e-05,
+	1.08743356e-06, 1.03965352e-05, -3.26139464e-06, -8.52973569e-06,
+	4.77440569e-06, 6.51264118e-06, -5.65721521e-06, -4.51191918e-06,
+	5.97876559e-06, 2.66103936e-06, -5.83433355e-06, -1.05665025e-06,
+	5.33375855e-06, -2.41695697e-07, -4.59062619e-06, 1.20899248e-06,
+	3.71306835e-06, -1.85006461e-06, -2.79661594e-06, 2.19340775e-06,
+	1.91931359e-06, -2.28430740e-06, -1.13909566e-06, 2.17790016e-06,
+	4.93244970e-07, -1.93274016e-06, 3.82361363e-10, 1.60530241e-06,
+	-3.40773674e-07, -1.24570856e-06, 5.40270618e-07, 8.94813446e-07,
+	-6.20627052e-07, -5.82654595e-07, 6.09030062e-07, 3.28151699e-07,
+	-5.34434010e-07, -1.39855093e-07, 4.24471986e-07, 1.74850733e-08,
+	3.99735995e-07, 6.73552721e-08, -5.59860922e-07, 6.06607443e-08,
+	7.15919820e-07, -2.67598509e-07, -8.41626614e-07, 5.57553911e-07,
+	9.05535473e-07, -9.25279096e-07, -8.73326686e-07, 1.35411146e-06,
+	7.10991932e-07, -1.81465706e-06, -3.88777349e-07, 2.26453645e-06,
+	-1.14364157e-07, -2.64945344e-06, 8.06161570e-07, 2.90576514e-06,
+	-1.67669104e-06, -2.96461733e-06, 2.69481174e-06, 2.75756706e-06,
+	-3.80588705e-06, -2.22345539e-06, 4.93128155e-06, 1.31612742e-06,
+	-5.97004845e-06, -1.24403190e-08, 6.80309508e-06, -1.68013240e-06,
+	-7.29993757e-06, 3.71708307e-06, 7.32793896e-06, -6.01245757e-06,
+	-6.76368052e-06, 8.43723542e-06, 5.50586137e-06, -1.08211818e-05,
+	-3.48887818e-06, 1.29586656e-05, 6.96026909e-07, -1.46186788e-05,
+	2.82888318e-06, 1.55589686e-05, -6.97278500e-06, -1.55438300e-05,
+	1.15487348e-05, 1.43647163e-05, -1.62965383e-05, -1.18624497e-05,
+	2.08894900e-05, 7.94948001e-06, -2.49477285e-05, -2.63038040e-06,
+	2.80582501e-05, -3.98137756e-06, -2.98010892e-05, 1.16523368e-05,
+	2.97805930e-05, -2.00254768e-05, -2.76601489e-05, 2.86256474e-05,
+	2.31981886e-05, -3.68750354e-05, -1.62828640e-05, 4.41190502e-05,
+	6.96249927e-06, -4.96622581e-05, 4.53117848e-06, 5.28131609e-05,
+	-1.77699109e-05, -5.29357580e-05, 3.21284055e-05, 4.95050125e-05,
+	-4.67983822e-05, -4.21626323e-05, 6.08182611e-05, 3.07690509e-05,
+	-7.31185588e-05, -1.54471994e-05, 8.25818933e-05, -3.38633113e-06,
+	-8.81152557e-05, 2.50067993e-05, 8.87309849e-05, -4.83868764e-05,
+	-8.36317592e-05, 7.22246166e-05, 7.22940062e-05, -9.49948636e-05,
+	-5.45435142e-05, 1.15023550e-04, 3.06167911e-05, -1.30582618e-04,
+	-1.20191788e-06, 1.40001525e-04, -3.25466711e-05, -1.41789585e-04,
+	6.90238840e-05, 1.34761928e-04, -1.06222918e-04, -1.18160698e-04,
+	1.41818222e-04, 9.17624453e-05, -1.73280917e-04, -5.59625360e-05,
+	1.98022683e-04, 1.18279295e-05, -2.13561613e-04, 3.88891331e-05,
+	2.17701291e-04, -9.37821447e-05, -2.08712383e-04, 1.49869215e-04,
+	1.85504659e-04, -2.03720044e-04, -1.47776633e-04, 2.51627936e-04,
+	9.61301238e-05, -2.89820373e-04, -3.21380010e-05, 3.14698336e-04,
+	-4.16446837e-05, -3.23091533e-04, 1.21733248e-04, 3.12514225e-04,
+	-2.03833115e-04, -2.81404668e-04, 2.83026087e-04, 2.29330500e-04,
+	-3.54017999e-04, -1.57142816e-04, 4.11437926e-04, 6.70633151e-05,
+	-4.50174702e-04, 3.73082400e-05, 4.65732548e-04, -1.51075050e-04,
+	-4.54584519e-04, 2.68216604e-04, 4.14500492e-04, -3.81852445e-04,
+	-3.44825776e-04, 4.84588375e-04, 2.46687306e-04, -5.68930947e-04,
+	-1.23106893e-04, 6.27750253e-04, -2.09949489e-05, -6.54765970e-04,
+	1.78915529e-04, 6.45027751e-04, -3.42411052e-04, -5.95358666e-04,
+	5.02058778e-04, 5.04729903e-04, -6.47728716e-04, -3.74536377e-04,
+	7.69145215e-04, 2.08746495e-04, -8.56511277e-04, -1.39049000e-05,
+	9.01161987e-04, -2.01025518e-04, -8.96208597e-04, 4.24987084e-04,
+	8.37131974e-04, -6.45310997e-04, -7.22283721e-04, 8.48345330e-04,
+	5.53255431e-04, -1.02020110e-03, -3.35081420e-04, 1.14758049e-03,
+	7.62476972e-05, -1.21864308e-03, 2.11510263e-04, 1.22385996e-03,
+	-5.13626782e-04, -1.15680205e-03, 8.13335124e-04, 1.01480859e-03,
+	-1.09248587e-03, -7.99484798e-04, 1.33252050e-03, 5.16983877e-04,
+	-1.51555404e-03, -1.78038210e-04, 1.62550993e-03, -2.02282962e-04,
+	-1.64924305e-03, 6.05097313e-04, 1.57758204e-03, -1.00850618e-03,
+	-1.40622181e-03, 1.38863867e-03, 1.13640059e-03, -1.72090079e-03,
+	-7.75303905e-04, 1.98137155e-03, 3.36149663e-04, -2.14827517e-03,
+	1.62076142e-04, 2.20344834e-03, -6.95244893e-04, -2.13371585e-03,
+	1.23506370e-03, 1.93208706e-03, -1.75037687e-03, -1.59868950e-03,
+	2.20873986e-03, 1.14136519e-03, -2.57819550e-03, -5.75869585e-04,
+	2.82916572e-03, -7.43684936e-05, -2.93635928e-03, 7.78945271e-04,
+	2.88058798e-03, -1.50163341e-03, -2.65038202e-03, 2.20195503e-03,
+	2.24329880e-03, -2.83711915e-03, -1.66682970e-03, 3.36424237e-03,
+	9.38825616e-04, -3.74275052e-03, -8.73834289e-05, 3.93684262e-03,
+	-8.49838365e-04, -3.91788784e-03, 1.82687754e-03, 3.66662181e-03,
+	-2.79127131e-03, -3.17501189e-03, 3.68634557e-03, 2.44767118e-03,
+	-4.45390203e-03, -1.50271868e-03, 5.03718891e-03, 3.72007020e-04,
+	-5.38402056e-03, 8.99331401e-04, 5.44989680e-03, -2.25403538e-03,
+	-5.20096657e-03, 3.62454240e-03, 4.61668179e-03, -4.93543537e-03,
+	-3.69199860e-03, 6.10641598e-03, 2.43900230e-03, -7.05567968e-03,
+	-8.87860514e-04, 7.70354001e-03, -9.12954825e-04, -7.97612921e-03,
+	2.89719273e-03, 7.80898801e-03, -4.98206165e-03, -7.15035246e-03,
+	7.07008988e-03, 5.96394660e-03, -9.05145053e-03, -4.23109852e-03,
+	1.08065133e-02, 1.95200729e-03, -1.22082802e-02, 8.54002917e-04,
+	1.31242055e-02, -4.14941141e-03, -1.34166424e-02, 7.88082291e-03,
+	1.29406820e-02, -1.19830159e-02, -1.15371906e-02, 1.63853582e-02,
+	9.01676071e-03, -2.10219927e-02, -5.12532889e-03, 2.58491458e-02,
+	-5.30779515e-04, -3.08784035e-02, 8.66121349e-03, 3.62524715e-02,
+	-2.07659613e-02, -4.24593672e-02, 4.07141459e-02, 5.11511701e-02,
+	-8.23216514e-02, -7.04938647e-02, 2.55550457e-01, 5.31072995e-01,
+	3.73194129e-01, 5.09049815e-03, -1.11454570e-01, 1.68237300e-02,
+	6.22612037e-02, -2.31080311e-02, -3.94018475e-02, 2.52183193e-02,
+	2.52165697e-02, -2.53450803e-02, -1.51505662e-02, 2.42532244e-02,
+	7.53856145e-03, -2.23234780e-02, -1.64510484e-03, 1.98020398e-02,
+	-2.90058972e-03, -1.68793236e-02, 6.31063880e-03, 1.37182045e-02,
+	-8.72588731e-03, -1.04641425e-02, 1.02567847e-02, 7.24797379e-03,
+	-1.10034341e-02, -4.18560437e-03, 1.10652574e-02, 1.37650403e-03,
+	-1.05450094e-02, 1.09804616e-03, 9.54951144e-03, -3.17643531e-03,
+	-8.18842045e-03, 4.81764172e-03, 6.57183956e-03, -6.00143470e-03,
+	-4.80731722e-03, 6.72779728e-03, 2.99663316e-03, -7.01557723e-03,
+	-1.23267631e-03, 6.90042853e-03, -4.03348534e-04, -6.43214748e-03,
+	1.84420579e-03, 5.67154044e-03, -3.03827817e-03, -4.68698136e-03,
+	3.95050116e-03, 3.55082929e-03, -4.56255102e-03, -2.33587767e-03,
+	4.87229856e-03, 1.11199962e-03, -4.89258005e-03, 5.68624192e-05,
+	4.64937153e-03, -1.11523753e-03, -4.17947996e-03, 2.01810126e-03,
+	3.52788492e-03, -2.73222070e-03, -2.74487676e-03, 3.23684019e-03,
+	1.88314051e-03, -3.52371285e-03, -9.94930697e-04, 3.59651549e-03,
+	1.29470413e-04, -3.46971386e-03, 6.69310492e-04, 3.16696943e-03,
+	-1.36460636e-03, -2.71919716e-03, 1.92807137e-03, 2.16239542e-03,
+	-2.34062453e-03, -1.53537408e-03, 2.59271794e-03, 8.77504241e-04,
+	-2.68409075e-03, -2.26604916e-04, 2.62305644e-03, -3.82932758e-04,
+	-2.42539279e-03, 9.21701585e-04, 2.11292031e-03, -1.36645486e-03,
+	-1.71186609e-03, 1.70086757e-03, 1.25111520e-03, -1.91587084e-03,
+	-7.60450807e-04, 2.00957213e-03, 2.68878593e-04, -1.98679492e-03,
+	1.96880487e-04, 1.85829019e-03, -6.13659414e-04, -1.63968621e-03,
+	9.62824645e-04, 1.35025282e-03, -1.23093363e-03, -1.01156154e-03,
+	1.41005795e-03, 6.46122557e-04, -1.49777900e-03, -2.76075397e-04,
+	1.49688088e-03, -7.79982679e-05, -1.41478010e-03, 3.98083182e-04,
+	1.26274361e-03, -6.69517782e-04, -1.05495476e-03, 8.81533158e-04,
+	8.07490964e-04, -1.02753256e-03, -5.37277057e-04, 1.10511580e-03,
+	2.61075097e-04, -1.11586698e-03, 5.43546255e-06, 1.06493597e-03,
+	-2.48442321e-04, -9.60453642e-04, 4.56615918e-04, 8.12827031e-04,
+	-6.21534583e-04, -6.33964148e-04, 7.37910334e-04, 4.36478199e-04,
+	-8.03618547e-04, -2.32918289e-04, 8.19545763e-04, 3.50684615e-05,
+	-7.89279261e-04, 1.46650377e-04, 7.18669269e-04, -3.03649817e-04,
+	-6.15299604e-04, 4.29498315e-04, 4.87904945e-04, -5.20094078e-04,
+	-3.45772904e-04, 5.73689322e-04, 1.98166816e-04, -5.90777231e-04,
+	-5.38009546e-05, 5.73860025e-04, -7.96058664e-05, -5.27121992e-04,
+	1.95679133e-04, 4.56034897e-04, -2.89628158e-04, -3.66924810e-04,
+	3.58371983e-04, 2.66529189e-04, -4.00554479e-04, -1.61571079e-04,
+	4.16457757e-04, 5.83739307e-05, -4.07828290e-04, 3.74639703e-05,
+	3.77634032e-04, -1.21321754e-04, -3.29773310e-04, 1.89726784e-04,
+	2.68757277e-04, -2.40441586e-04, -1.99387277e-04, 2.72469681e-04,
+	1.26446838e-04, -2.85987746e-04, -5.44252466e-05, 2.82215304e-04,
+	-1.27138111e-05, -2.63235832e-04, 7.17091082e-05, 2.31784829e-04,
+	-1.20118999e-04, -1.91020886e-04, 1.56377723e-04, 1.44295269e-04,
+	-1.79793638e-04, -9.49341067e-05, 1.90495408e-04, 4.60451019e-05,
+	-1.89334769e-04, -3.57960601e-07, 1.77756314e-04, -3.98952430e-05,
+	-1.57645702e-04, 7.30566788e-05, 1.31167870e-04, -9.80762404e-05,
+	-1.00606246e-04, 1.14504478e-04, 6.82127468e-05, -1.22449833e-04,
+	-3.60766467e-05, 1.22506735e-04, 6.01834183e-06, -1.15662262e-04,
+	2.04881664e-05, 1.03189560e-04, -4.23624793e-05, -8.65361893e-05,
+	5.89352030e-05, 6.72149505e-05, -6.99378847e-05, -4.67037687e-05,
+	7.54693110e-05, 2.63598861e-05, -7.59430751e-05, -7.35209649e-06,
+	7.20219613e-05, -9.38683069e-06, -6.45449032e-05, 2.31869424e-05,
+	5.44520802e-05, -3.36479342e-05, -4.27131835e-05, 4.06280455e-05,
+	3.02630739e-05, -4.42179733e-05, -1.79480644e-05, 4.47033824e-05,
+	6.48496655e-06, -4.25199067e-05, 3.56606413e-06, 3.82045514e-05,
+	-1.18148959e-05, -3.23471570e-05, 1.80419277e-05, 2.55451208e-05,
+	-2.21874088e-05, -1.83639452e-05, 2.43317811e-05, 1.13054583e-05,
+	-2.46695781e-05, -4.78479051e-06, 2.34795187e-05, -8.83547601e-07,
+	-2.10933486e-05, 5.49081347e-06, 1.78657246e-05, -8.93129381e-06,
+	-1.41470555e-05, 1.11929945e-05, 1.02607492e-05, -1.23433532e-05,
+	-6.48580077e-06, 1.25116970e-05, 3.04515577e-06, -1.18701584e-05,
+	-9.98061168e-08, 1.06146279e-05, -2.25182484e-06, -8.94709604e-06,
+	3.96997061e-06, 7.06043726e-06, -5.06606329e-06, -5.12636161e-06,
+	5.59282442e-06, 3.28691538e-06, -5.63301938e-06, -1.64959474e-06,
+	5.28792171e-06, 2.85855577e-07, -4.66639764e-06, 7.67420268e-07,
+	3.87533444e-06, -1.50409979e-06, -3.01192199e-06, 1.94330082e-06,
+	2.15807407e-06, -2.12292969e-06, -1.37706396e-06, 2.09292702e-06,
+	7.12262000e-07, -1.90880950e-06, -1.87713538e-07, 1.62597775e-06,
+	-1.89811067e-07, -1.29512136e-06, 4.27722589e-07, 9.58908203e-07,
+	-5.43919591e-07, -6.50007436e-07, 5.62916653e-07, 3.90374741e-07,
+	-5.12160263e-07, -1.91632779e-07, 4.18821064e-07, 5.63128330e-08,
+	3.82529342e-07, 1.16300177e-07, -5.50498708e-07, -6.99858914e-09,
+	7.22372594e-07, -1.82126831e-07, -8.72968029e-07, 4.58239675e-07,
+	9.71122361e-07, -8.19689946e-07, -9.81709604e-07, 1.25366828e-06,
+	8.68611736e-07, -1.73451805e-06, -5.98538612e-07, 2.22303159e-06,
+	1.45480880e-07, -2.66702088e-06, 5.04527478e-07, 3.00338192e-06,
+	-1.34875563e-06, -3.16176613e-06, 2.36372161e-06, 3.06983583e-06,
+	-3.50226453e-06, -2.65992279e-06, 4.69226341e-06, 1.87673933e-06,
+	-5.83746568e-06, -6.85625268e-07, 6.82077738e-06, -9.19333175e-07,
+	-7.51020442e-06, 2.90808849e-06, 7.76742605e-06, -5.20915690e-06,
+	-7.45873952e-06, 7.70671474e-06, 6.46785510e-06, -1.02410176e-05,
+	-4.70976326e-06, 1.26127345e-05, 2.14466444e-06, -1.45915510e-05,
+	1.20923006e-06, 1.59290885e-05, -5.26532591e-06, -1.63758252e-05,
+	9.86201690e-06, 1.57013124e-05, -1.47610198e-05, -1.37165834e-05,
+	1.96516810e-05, 1.02972911e-05, -2.41619349e-05, -5.40580600e-06,
+	2.78761564e-05, -8.89689181e-07, -3.03596294e-05, 8.40114354e-06,
+	3.11887729e-05, -1.68135715e-05, -2.99856706e-05, 2.56866700e-05,
+	2.64548847e-05, -3.44663876e-05, -2.04200422e-05, 4.25071212e-05,
+	1.18573257e-05, -4.91044889e-05, -9.22809256e-07, 5.35377991e-05,
+	-1.20293903e-05, -5.51204571e-05, 2.64409150e-05, 5.32556943e-05,
+	-4.15571723e-05, -4.74942183e-05, 5.64510408e-05, 3.75897651e-05,
+	-7.00627978e-05, -2.35481236e-05, 8.12556461e-05, 5.66508601e-06,
+	-8.88849690e-05, 1.54510242e-05, 9.18781746e-05, -3.88760383e-05,
+	-8.93207870e-05, 6.33887271e-05, 8.05434099e-05, -8.75133355e-05,
+	-6.52034206e-05, 1.09586001e-04, 4.33548414e-05, -1.27843486e-04,
+	-1.54998490e-05, 1.40530833e-04, -1.73841261e-05, -1.46022798e-04,
+	5.38467660e-05, 1.42952246e-04, -9.20002857e-05, -1.30337419e-04,
+	1.29589589e-04, 1.07699035e-04, -1.64096594e-04, -7.51578217e-05,
+	1.92875705e-04, 3.35033529e-05, -2.13314847e-04, 1.57740337e-05,
+	2.23014077e-04, -7.04948438e-05, -2.19971621e-04, 1.27849908e-04,
+	2.02765513e-04, -1.84509284e-04, -1.70717975e-04, 2.36778920e-04,
+	1.24029431e-04, -2.80799928e-04, -6.38696486e-05, 3.12781897e-04,
+	-7.58494285e-06, -3.29258385e-04, 8.71762551e-05, 3.27349961e-04,
+	-1.70857058e-04, -3.05018099e-04, 2.53852225e-04, 2.61292067e-04,
+	-3.30885426e-04, -1.96450893e-04, 3.96463286e-04, 1.12143627e-04,
+	-4.45204359e-04, -1.14335013e-05, 4.72196012e-04, -1.01244836e-04,
+	-4.73358754e-04, 2.20221172e-04, 4.45794996e-04, -3.38819332e-04,
+	-3.88097989e-04, 4.49675082e-04, 3.00596881e-04, -5.45130605e-04,
+	-1.85515712e-04, 6.17687665e-04, 4.70275806e-05, -6.60496075e-04,
+	1.08809723e-04, 6.67849540e-04, -2.74243988e-04, -6.35657887e-04,
+	4.40144678e-04, 5.61863281e-04, -5.96436669e-04, -4.46768672e-04,
+	7.32635183e-04, 2.93249401e-04, -8.38457483e-04, -1.06823733e-04,
+	9.04479805e-04, -1.04435145e-04, -9.22802333e-04, 3.30154593e-04,
+	8.87681191e-04, -5.58084620e-04, -7.96084929e-04, 7.74675192e-04,
+	6.48134018e-04, -9.65786614e-04, -4.47385629e-04, 1.11750057e-03,
+	2.00932415e-04, -1.21699043e-03, 8.07070345e-05, 1.25340222e-03,
+	-3.83917368e-04, -1.21869289e-03, 6.92533888e-04, 1.10837085e-03,
+	-9.88593274e-04, -9.22085029e-04, 1.25325894e-03, 6.64013963e-04,
+	-1.46787936e-03, -3.43014260e-04, 1.61512614e-03, -2.75003143e-05,
+	-1.68014971e-03, 4.29964159e-04, 1.65168423e-03, -8.43348440e-04,
+	-1.52303137e-03, 1.24411470e-03, 1.29285413e-03, -1.60739790e-03,
+	-9.65718090e-04, 1.90836687e-03, 5.52327770e-04, -2.12369566e-03,
+	-6.94199303e-05, 2.23306761e-03, -4.60707021e-04, -2.22062636e-03,
+	1.01102835e-03, 2.07628459e-03, -1.55097266e-03, -1.79680334e-03,
+	2.04790388e-03, 1.38656147e-03, -2.46884304e-03, -8.57947242e-04,
+	2.78234910e-03, 2.31320996e-04, -2.96046299e-03, 4.65481552e-04,
+	2.98060913e-03, -1.19811125e-03, -2.82734363e-03, 1.92711308e-03,
+	2.49383958e-03, -2.60973318e-03, -1.98300735e-03, 3.20205380e-03,
+	1.30816133e-03, -3.66136200e-03, -4.93164137e-04, 3.94863888e-03,
+	-4.27996431e-04, -4.03104260e-03, 1.41221435e-03, 3.88425130e-03,
+	-2.40884195e-03, -3.49453151e-03, 3.36179082e-03, 2.86040492e-03,
+	-4.21208085e-03, -1.99380097e-03, 4.90073379e-03, 9.20603749e-04,
+	-5.37188391e-03, 3.19470386e-04, 5.57596129e-03, -1.67369619e-03,
+	-5.47279264e-03, 3.07785977e-03, 5.03446285e-03, -4.45843449e-03,
+	-4.24778700e-03, 5.73533476e-03, 3.11625857e-03, -6.82513502e-03,
+	-1.66136433e-03, 7.64461115e-03, -7.68106088e-05, -8.11443621e-03,
+	2.03972254e-03, 8.16284435e-03, -4.15124026e-03, -7.72906553e-03,
+	6.31917743e-03, 6.76632906e-03, -8.43735020e-03, -5.24423482e-03,
+	1.03879438e-02, 3.15029282e-03, -1.20438668e-02, -4.90427771e-04,
+	1.32706188e-02, -2.71177867e-03, -1.39269445e-02, 6.41740811e-03,
+	1.38630922e-02, -1.05765701e-02, -1.29145779e-02, 1.51357260e-02,
+	1.08873748e-02, -2.00499258e-02, -7.52576393e-03, 2.53045506e-02,
+	2.44186111e-03, -3.09585156e-02, 5.05029167e-03, 3.72444579e-02,
+	-1.63794734e-02, -4.48533135e-02, 3.51862968e-02, 5.60146610e-02,
+	-7.42671630e-02, -8.13945922e-02, 2.30873450e-01, 5.25154173e-01,
+	3.94543632e-01, 2.40454532e-02, -1.14381998e-01, 8.33487422e-03,
+	6.49413216e-02, -1.79905114e-02, -4.21484178e-02, 2.19243297e-02,
+	2.79573395e-02, -2.32679143e-02, -1.77945749e-02, 2.30735815e-02,
+	1.00076801e-02, -2.18361118e-02, -3.87701184e-03, 1.98546020e-02,
+	-9.52688171e-04, -1.73472241e-02, 4.67857988e-03, 1.44935334e-02,
+	-7.42718078e-03, -1.14508343e-02, 9.29540310e-03, 8.35996545e-03,
+	-1.03708539e-02, -5.34646217e-03, 1.07417884e-02, 2.51972584e-03,
+	-1.05014042e-02, 2.84999232e-05, 9.74881423e-03, -2.22564790e-03,
+	-8.58799070e-03, 4.01944398e-03, 7.12547240e-03, -5.37839963e-03,
+	-5.46737506e-03, 6.29156989e-03, 3.71610185e-03, -6.76754842e-03,
+	-1.96706383e-03, 6.83273285e-03, 3.05655687e-04, -6.52894308e-03,
+	1.19532071e-03, 5.91051230e-03, -2.47764201e-03, -5.04099774e-03,
+	3.49896218e-03, 3.98967458e-03, -4.23337473e-03, -2.82798310e-03,
+	4.67123218e-03, 1.62609596e-03, -4.81825781e-03, -4.49760480e-04,
+	4.69402049e-03, -6.42448885e-04, -4.32987413e-03, 1.60135877e-03,
+	3.76648609e-03, -2.38882743e-03, -3.05109489e-03, 2.97873261e-03,
+	2.23464450e-03, -3.35730621e-03, -1.36894200e-03, 3.52283845e-03,
+	5.03976728e-04, -3.48480508e-03, 3.14476181e-04, 3.26249734e-03,
+	-1.04686609e-03, -2.88325550e-03, 1.66141452e-03, 2.38042122e-03,
+	-2.13515192e-03, -1.79113198e-03, 2.45442433e-03, 1.15408145e-03,
+	-2.61487949e-03, -5.07364141e-04, 2.62096850e-03, -1.13489099e-04,
+	-2.48502230e-03, 6.77194880e-04, 2.22598089e-03, -1.15805106e-03,
+	-1.86786679e-03, 1.53687426e-03, 1.43810168e-03, -1.80151907e-03,
+	-9.65767492e-04, 1.94698079e-03, 4.79908950e-04, -1.97510596e-03,
+	-7.96638298e-06, 1.89395442e-03, -4.25585884e-04, -1.71687280e-03,
+	8.00336378e-04, 1.46135082e-03, -1.10072804e-03, -1.14773898e-03,
+	1.31652356e-03, 7.97908001e-04, -1.44294304e-03, -4.33928430e-04,
+	1.48049070e-03, 7.68415965e-05, -1.43450360e-03, 2.54416635e-04,
+	1.31446823e-03, -5.43891129e-04, -1.13316080e-03, 7.79248212e-04,
+	9.05672485e-04, -9.52164005e-04, -6.48383220e-04, 1.05845806e-03,
+	3.77945564e-04, -1.09798452e-03, -1.10335055e-04, 1.07430595e-03,
+	-1.39984526e-04, -9.94185293e-04, 3.60742856e-04, 8.66939228e-04,
+	-5.42365218e-04, -7.03700703e-04, 6.78280953e-04, 5.16639894e-04,
+	-7.65036257e-04, -3.18191447e-04, 8.02220801e-04, 1.20331684e-04,
+	-7.92227634e-04, 6.60569258e-05, 7.39873912e-04, -2.31704732e-04,
+	-6.51915850e-04, 3.69337183e-04, 5.36494735e-04, -4.73909865e-04,
+	-4.02551817e-04, 5.42695206e-04, 2.59248620e-04, -5.75228529e-04,
+	-1.15425822e-04, 5.73128714e-04, -2.08711722e-05, -5.39814822e-04,
+	1.42778143e-04, 4.80144341e-04, -2.44894744e-04, -4.00001130e-04,
+	3.23456571e-04, 3.05861689e-04, -3.76396465e-04, -2.04367164e-04,
+	4.03301445e-04, 1.01925753e-04, -4.05277336e-04, -4.36614914e-06,
+	3.84737581e-04, -8.33422069e-05, -3.45135751e-04, 1.57291737e-04,
+	2.90662913e-04, -2.14757438e-04, -2.25931127e-04, 2.54236299e-04,
+	1.55663265e-04, -2.75410855e-04, -8.44070416e-05, 2.79046414e-04,
+	1.62880126e-05, -2.66834572e-04, 4.51874734e-05, 2.41197714e-04,
+	-9.72724772e-05, -2.05070156e-04, 1.38060062e-04, 1.61671452e-04,
+	-1.66505429e-04, -1.14286398e-04, 1.82394218e-04, 6.60643652e-05,
+	-1.86264437e-04, -1.98481584e-05, 1.79291588e-04, -2.19602412e-05,
+	-1.63147878e-04, 5.74927530e-05, 1.39846854e-04, -8.54657705e-05,
+	-1.11584584e-04, 1.05189701e-04, 8.05875034e-05, -1.16541348e-04,
+	-4.89756081e-05, 1.19904919e-04, 1.86477549e-05, -1.16088803e-04,
+	8.80626762e-06, 1.06226009e-04, -3.21644420e-05, -9.16663231e-05,
+	5.06016584e-05, 7.38678849e-05, -6.36908597e-05, -5.42950612e-05,
+	7.13793792e-05, 3.43283118e-05, -7.39448788e-05, -1.51903340e-05,
+	7.19361043e-05, -2.10877109e-06, -6.61040471e-05, 1.68061133e-05,
+	5.73290715e-05, -2.84006612e-05, -4.65491731e-05, 3.66494465e-05,
+	3.46938457e-05, -4.15478684e-05, -2.26271270e-05, 4.32973802e-05,
+	1.11023558e-05, -4.22642673e-05, -7.30091182e-07, 3.89333604e-05,
+	-8.04041251e-06, -3.38603834e-05, 1.49267319e-05, 2.76262613e-05,
+	-1.98071597e-05, -2.07961564e-05, 2.27049166e-05, 1.38853282e-05,
+	-2.37650577e-05, -7.33317488e-06, 2.32266279e-05, 1.48607746e-06,
+	-2.13926097e-05, 3.41101755e-06, 1.86000176e-05, -7.21493666e-06,
+	-1.51921654e-05, 9.87766986e-06, 1.14947065e-05, -1.14342742e-05,
+	-7.79656005e-06, 1.19869347e-05, 4.33633815e-06, -1.16868697e-05,
+	-1.29440966e-06, 1.07156802e-05, -1.20968410e-06, -9.26755747e-06,
+	3.11509293e-06, 7.53349281e-06, -4.41368212e-06, -5.68832357e-06,
+	5.14125098e-06, 3.88111583e-06, -5.36703264e-06, -2.22906349e-06,
+	5.18252720e-06, 8.14793037e-07, -4.69061133e-06, 3.13276663e-07,
+	3.99570199e-06, -1.13804879e-06, -3.19555166e-06, 1.66897874e-06,
+	2.37503601e-06, -1.93610731e-06, -1.60208297e-06, 1.98356941e-06,
+	9.25699408e-07, -1.86318537e-06, -3.75891325e-07, 1.62863729e-06,
+	-3.48461859e-08, -1.33060425e-06, 3.08868542e-07, 1.01309008e-06,
+	-4.59981272e-07, -7.11039772e-07, 5.09720840e-07, 4.49216098e-07,
+	-4.83694886e-07, -2.42205211e-07, 4.08291622e-07, 9.53442130e-08,
+	3.61403001e-07, 1.63026511e-07, -5.35173136e-07, -7.34531035e-08,
+	7.20691643e-07, -9.59169677e-08, -8.94159812e-07, 3.55206504e-07,
+	1.02505432e-06, -7.06352422e-07, -1.07785261e-06, 1.14051400e-06,
+	1.01475749e-06, -1.63603547e-06, -7.99350814e-07, 2.15730358e-06,
+	4.00996030e-07, -2.65481688e-06, 2.00303566e-07, 3.06672400e-06,
+	-1.00898768e-06, -3.32199204e-06, 2.00944396e-06, 3.34523721e-06,
+	-3.16246842e-06, -3.06309466e-06, 4.40322560e-06, 2.41183288e-06,
+	-5.64121369e-06, -1.34574450e-06, 6.76264723e-06, -1.54315612e-07,
+	-7.63552216e-06, 2.07300470e-06, 8.11743122e-06, -4.35402270e-06,
+	-8.06596029e-06, 6.89596493e-06, 7.35123431e-06, -9.55131166e-06,
+	-5.86991349e-06, 1.21292372e-05, 3.55968949e-06, -1.44027074e-05,
+	-4.13122163e-07, 1.61200463e-05, -3.51048648e-06, -1.70207989e-05,
+	8.07653876e-06, 1.68553267e-05, -1.30712152e-05, -1.54071621e-05,
+	1.82033128e-05, 1.25167578e-05, -2.31126942e-05, -8.10493147e-06,
+	2.73857888e-05, 2.19405265e-06, -3.05780825e-05, 5.07510504e-06,
+	3.22429586e-05, -1.34329051e-05, -3.19656433e-05, 2.24786487e-05,
+	2.94004095e-05, -3.16881333e-05, -2.43086544e-05, 4.04319289e-05,
+	1.65950377e-05, -4.80046353e-05, -6.33859730e-06, 5.36645730e-05,
+	-6.18430326e-06, -5.66824752e-05, 2.04881753e-05, 5.63968509e-05,
+	-3.58803077e-05, -5.22728502e-05, 5.14782507e-05, 4.39607472e-05,
+	-6.62438491e-05, -3.13496462e-05, 7.90336864e-05, 1.46117644e-05,
+	-8.86645587e-05, 5.76728717e-06, 9.39912979e-05, -2.89763864e-05,
+	-9.39929917e-05, 5.38883262e-05, 8.78625116e-05, -7.90930340e-05,
+	-7.50933502e-05, 1.02955398e-04, 5.55571884e-05, -1.23696837e-04,
+	-2.95654414e-05, 1.39497920e-04, -2.09167163e-06, -1.48617524e-04,
+	3.81341902e-05, 1.49522231e-04, -7.68139585e-05, -1.41018211e-04,
+	1.15971239e-04, 1.22376676e-04, -1.53126813e-04, -9.34434103e-05,
+	1.85607549e-04, 5.47228289e-05, -2.10700839e-04, -7.42770418e-06,
+	2.25830743e-04, -4.65129698e-05, -2.28746375e-04, 1.04493460e-04,
+	2.17711085e-04, -1.63320973e-04, -1.91679705e-04, 2.19355258e-04,
+	1.50450445e-04, -2.68694402e-04, -9.47783267e-05, 3.07399539e-04,
+	2.64381891e-05, -3.31747747e-04, 5.17725747e-05, 3.38499348e-04,
+	-1.36098375e-04, -3.25163362e-04, 2.21959915e-04, 2.90243299e-04,
+	-3.04157465e-04, -2.33444894e-04, 3.77136835e-04, 1.55828031e-04,
+	-4.35307160e-04, -5.98869992e-05, 4.73395048e-04, -5.04536503e-05,
+	-4.86815682e-04, 1.69936086e-04, 4.72038400e-04, -2.92162169e-04,
+	-4.26922416e-04, 4.09879592e-04, 3.50997893e-04, -5.15351992e-04,
+	-2.45668765e-04, 6.00797469e-04, 1.14316497e-04, -6.58874002e-04,
+	3.77115584e-05, 6.83185180e-04, -2.03239660e-04, -6.68775855e-04,
+	3.73530297e-04, 6.12585122e-04, -5.38675259e-04, -5.13823785e-04,
+	6.88098007e-04, 3.74245276e-04, -8.11145965e-04, -1.98282989e-04,
+	8.97743619e-04, -6.96693319e-06, -9.39070913e-04, 2.31930417e-04,
+	9.28226629e-04, -4.64911463e-04, -8.60833888e-04, 6.92612470e-04,
+	7.35544794e-04, -9.00801089e-04, -5.54403874e-04, 1.07509512e-03,
+	3.23035329e-04, -1.20182715e-03, -5.06271469e-05, 1.26894250e-03,
+	-2.50304549e-04, -1.26687803e-03, 5.64375301e-04, 1.18936619e-03,
+	-8.74007207e-04, -1.03410879e-03, 1.16029585e-03, 8.03268483e-04,
+	-1.40403263e-03, -5.03732582e-04, 1.58683333e-03, 1.47114611e-04,
+	-1.69231348e-03, 2.50528378e-04, 1.70724354e-03, -6.69268860e-04,
+	-1.62261267e-03, 1.08616155e-03, 1.43453020e-03, -1.47634742e-03,
+	-1.14489783e-03, 1.81436338e-03, 7.61794317e-04, -2.07559644e-03,
+	-2.99527084e-04, 2.23780786e-03, -2.21678585e-04, -2.28264315e-03,
+	7.76362934e-04, 2.19703833e-03, -1.33487674e-03, -1.97443258e-03,
+	1.86475516e-03, 1.61570195e-03, -2.33236607e-03, -1.12973881e-03,
+	2.70475906e-03, 5.33617076e-04, -2.95162429e-03, 1.47697613e-04,
+	3.04725793e-03, -8.82110216e-04, -2.97242356e-03, 1.63162321e-03,
+	2.71599712e-03, -2.35399341e-03, -2.27628776e-03, 3.00475789e-03,
+	1.66193795e-03, -3.53954348e-03, -8.92323190e-04, 3.91655369e-03,
+	-2.60561216e-06, -4.09911029e-03, 9.83067544e-04, 4.05811650e-03,
+	-2.00078487e-03, -3.77430534e-03, 3.00087269e-03, 3.24014030e-03,
+	-3.92422223e-03, -2.46124692e-03, 4.71028543e-03, 1.45727233e-03,
+	-5.30014254e-03, -2.62094938e-04, 5.63971415e-03, -1.07666284e-03,
+	-5.68296501e-03, 2.49883144e-03, 5.39494142e-03, -3.93357588e-03,
+	-4.75448657e-03, 5.30190000e-03, 3.75649033e-03, -6.51967457e-03,
+	-2.41355105e-03, 7.50105699e-03, 7.56956964e-04, -8.16214196e-03,
+	1.16306653e-03, 8.42465947e-03, -3.27785073e-03, -8.21952007e-03,
+	5.50147041e-03, 7.48999689e-03, -7.73251019e-03, -6.19432717e-03,
+	9.85621769e-03, 4.30750933e-03, -1.17467472e-02, -1.82205599e-03,
+	1.32690481e-02, -1.25257880e-03, -1.42797098e-02, 4.89228153e-03,
+	1.46256425e-02, -9.06289214e-03, -1.41386054e-02, 1.37283156e-02,
+	1.26217410e-02, -1.88645934e-02, -9.81989196e-03, 2.44856538e-02,
+	5.35411301e-03, -3.06954970e-02, 1.43267122e-03, 3.78103476e-02,
+	-1.18881447e-02, -4.67056300e-02, 2.94030367e-02, 6.01221024e-02,
+	-6.57097411e-02, -9.08174020e-02, 2.06162242e-01, 5.17323908e-01,
+	4.14837452e-01, 4.41023292e-02, -1.16142931e-01, -5.34018208e-04,
+	6.69608715e-02, -1.25584704e-02, -4.44732686e-02, 1.83308528e-02,
+	3.04245999e-02, -2.09033286e-02, -2.02707645e-02, 2.16231940e-02,
+	1.23896565e-02, -2.11002630e-02, -6.08502702e-03, 1.96859061e-02,
+	1.02086137e-03, -1.76249324e-02, 2.98299431e-03, 1.51122853e-02,
+	-6.03741591e-03, -1.23157798e-02, 8.22476431e-03, 9.38495659e-03,
+	-9.61922279e-03, -6.45376486e-03, 1.02969353e-02, 3.64045140e-03,
+	-1.03405374e-02, -1.04630055e-03, 9.84036045e-03, -1.24589412e-03,
+	-8.89356380e-03, 3.17312596e-03, 7.60196545e-03, -4.69294904e-03,
+	-6.06909718e-03, 5.78357215e-03, 4.39687634e-03, -6.44320742e-03,
+	-2.68220503e-03, 6.68867814e-03, 1.01374833e-03, -6.55334492e-03,
+	5.30905441e-04, 6.08445184e-03, -1.88754538e-03, -5.34002643e-03,
+	3.00698739e-03, 4.38548847e-03, -3.85600472e-03, -3.29013396e-03,
+	4.41751587e-03, 2.12366188e-03, -4.69004726e-03, -9.52903595e-04,
+	4.68652606e-03, -1.61101454e-04, -4.43249100e-03, 1.16556327e-03,
+	3.96383517e-03, -2.01783986e-03, -3.32421372e-03, 2.68671696e-03,
+	2.56226034e-03, -3.15304279e-03, -1.72875909e-03, 3.40972538e-03,
+	8.73913135e-04, -3.46113198e-03, -4.48398668e-05, 3.32195783e-03,
+	-7.16596877e-04, -3.01565547e-03, 1.37552982e-03, 2.57253250e-03,
+	-1.90534583e-03, -2.02763697e-03, 2.28842585e-03, 1.41855324e-03,
+	-2.51636393e-03, -7.83228525e-04, 2.58968924e-03, 1.57941193e-04,
+	-2.51713977e-03, 4.24492306e-04, 2.31455685e-03, -9.36194001e-04,
+	-2.00348534e-03, 1.35532825e-03, 1.60957460e-03, -1.66680031e-03,
+	-1.16087967e-03, 1.86254100e-03, 6.86161068e-04, -1.94139161e-03,
+	-2.13274741e-04, 1.90862408e-03, -2.32266888e-04, -1.77514878e-03,
+	6.28497176e-04, 1.55647581e-03, -9.57912369e-04, -1.27150465e-03,
+	1.20807431e-03, 9.41221176e-04, -1.37188885e-03, -5.87380723e-04,
+	1.44756869e-03, 2.31250937e-04, -1.43830642e-03, 1.07520391e-04,
+	1.35169758e-03, -4.11859017e-04, -1.19896496e-03, 6.67999854e-04,
+	9.94042546e-04, -8.65980081e-04, -7.52581183e-04, 9.99880789e-04,
+	4.90937858e-04, -1.06782309e-03, -2.25206764e-04, 1.07173811e-03,
+	-2.96564396e-05, -1.01694162e-03, 2.60574992e-04, 9.11552957e-04,
+	-4.56924777e-04, -7.65803558e-04, 6.10922200e-04, 5.91283468e-04,
+	-7.17819073e-04, -4.00173734e-04, 7.75909082e-04, 2.04509784e-04,
+	-7.86360898e-04, -1.55154668e-05, 7.52901824e-04, -1.56959870e-04,
+	-6.81382605e-04, 3.04877446e-04, 5.79258458e-04, -4.22303788e-04,
+	-4.55023370e-04, 5.05559091e-04, 3.17634397e-04, -5.53223133e-04,
+	-1.75960229e-04, 5.66010690e-04, 3.82839578e-05, -5.46535053e-04,
+	8.81157010e-05, 4.98983256e-04, -1.97287208e-04, -4.28729806e-04,
+	2.84822655e-04, 3.41917030e-04, -3.47964719e-04, -2.45029675e-04,
+	3.85607732e-04, 1.44489307e-04, -3.98202447e-04, -4.62905959e-05,
+	3.87579006e-04, -4.43028826e-05, -3.56706146e-04, 1.22990878e-04,
+	3.09406907e-04, -1.86589720e-04, -2.50051843e-04, 2.33104975e-04,
+	1.83250126e-04, -2.61726911e-04, -1.13557214e-04, 2.72756497e-04,
+	4.52149254e-05, -2.67473156e-04, 1.80636579e-05, 2.47957953e-04,
+	-7.32559738e-05, -2.16887284e-04, 1.18134040e-04, 1.77312477e-04,
+	-1.51310326e-04, -1.32440066e-04, 1.72228601e-04, 8.54259718e-05,
+	-1.81105961e-04, -3.91946809e-05, 1.78834649e-04, -3.70818917e-06,
+	-1.66853878e-04, 4.12244389e-05, 1.47002672e-04, -7.18504488e-05,
+	-1.21364792e-04, 9.46632797e-05, 9.21161380e-05, -1.09308567e-04,
+	-6.13837837e-05, 1.15955152e-04, 3.11240718e-05, -1.15222955e-04,
+	-3.02521984e-06, 1.08091567e-04, -2.15622612e-05, -9.57974566e-05,
+	4.16661546e-05, 7.97275162e-05, -5.67049237e-05, -6.13160645e-05,
+	6.64743939e-05, 4.19513849e-05, -7.11125924e-05, -2.28965866e-05,
+	7.10475671e-05, 5.22810056e-06, -6.69335440e-05, 1.02063990e-05,
+	5.95809145e-05, -2.28103269e-05, -4.98852960e-05, 3.22417728e-05,
+	3.87603448e-05, -3.84004470e-05, -2.70781933e-05, 4.14009293e-05,
+	1.56204101e-05, -4.15357055e-05, -5.04133361e-06, 3.92317244e-05,
+	-4.15542497e-06, -3.50041722e-05, 1.16274868e-05, 2.94108795e-05,
+	-1.71922465e-05, -2.30103028e-05, 2.08151494e-05, 1.63253982e-05,
+	-2.25898808e-05, -9.81500664e-06, 2.27129081e-05, 3.85364417e-06,
+	-2.14548801e-05, 1.28010590e-06, 1.91312710e-05, -5.40701979e-06,
+	-1.60743853e-05, 8.44341261e-06, 1.26084575e-05, -1.03913811e-05,
+	-9.02912354e-06, 1.13246570e-05, 5.58805563e-06, -1.13717115e-05,
+	-2.48307423e-06, 1.06977159e-05, -1.46387076e-07, -9.48681622e-06,
+	2.21895416e-06, 7.92594502e-06, -3.70689541e-06, -6.19110416e-06,
+	4.62857407e-06, 4.43673305e-06, -5.03881720e-06, -2.78845576e-06,
+	5.01824711e-06, 1.33920459e-06, -4.66254030e-06, -1.48462988e-07,
+	4.07243750e-06, -7.55827033e-07, -3.34514334e-06, 1.37328210e-06,
+	2.56754778e-06, -1.72567742e-06, -1.81149104e-06, 1.85079452e-06,
+	1.13109754e-06, -1.79613579e-06, -5.62035288e-07, 1.61303550e-06,
+	1.22425109e-07, -1.35157944e-06, 1.84965816e-07, 1.05661106e-06,
+	-3.69657559e-07, -7.64966231e-07, 4.49934816e-07, 5.03951508e-07,
+	-4.49253965e-07, -2.90972361e-07, 3.92907192e-07, 1.34133804e-07,
+	3.36673900e-07, 2.07051435e-07, -5.14160871e-07, -1.37979668e-07,
+	7.11023963e-07, -9.94191347e-09, -9.05111530e-07, 2.49653628e-07,
+	1.06688541e-06, -5.86627226e-07, -1.16083740e-06, 1.01605958e-06,
+	1.14793742e-06, -1.52051147e-06, -9.89080215e-07, 2.06834236e-06,
+	6.49387254e-07, -2.61328076e-06, -1.03104626e-07, 3.09542208e-06,
+	-6.61274069e-07, -3.44386094e-06, 1.63612590e-06, 3.58104458e-06,
+	-2.79059140e-06, -3.42878303e-06, 4.06780373e-06, 2.91568078e-06,
+	-5.38399612e-06, -1.98557514e-06, 6.62995520e-06, 6.06394106e-07,
+	-7.67515749e-06, 1.22130134e-06, 8.37474230e-06, -3.45693234e-06,
+	-8.57924502e-06, 6.01456520e-06, 8.14675321e-06, -8.76049067e-06,
+	-6.95687259e-06, 1.15144845e-05, 4.92562266e-06, -1.40553272e-05,
+	-2.02014715e-06, 1.61308943e-05, -1.72805217e-06, -1.74727876e-05,
+	6.21274405e-06, 1.78150918e-05, -1.12468365e-05, -1.69164216e-05,
+	1.65617386e-05, 1.45840134e-05, -2.18132174e-05, -1.06982444e-05,
+	2.65943850e-05, 5.23566324e-06, -3.04559651e-05, 1.71156491e-06,
+	3.29334314e-05, -9.92194139e-06, -3.35799885e-05, 1.90386603e-05,
+	3.20037464e-05, -2.85730913e-05, -2.79068531e-05, 3.79189464e-05,
+	2.11238621e-05, -4.63777094e-05, -1.16562612e-05, 5.31951150e-05,
+	-3.00063590e-07, -5.76075860e-05, 1.43375844e-05, 5.88966110e-05,
+	-2.98329355e-05, -5.64481568e-05, 4.59580056e-05, 4.98134145e-05,
+	-6.17077196e-05, -3.87665638e-05, 7.59448554e-05, 2.33548652e-05,
+	-8.74610172e-05, -3.93632164e-06, 9.50515730e-05, -1.87995723e-05,
+	-9.76010359e-05, 4.38318294e-05, 9.41741428e-05, -6.98315403e-05,
+	-8.41068398e-05, 9.52104914e-05, 6.70906467e-05, -1.18194684e-04,
+	-4.32435116e-05, 1.36920795e-04, 1.31603655e-05, -1.49551725e-04,
+	2.20628075e-05, 1.54405547e-04, -6.08364535e-05, -1.50090507e-04,
+	1.01119936e-04, 1.35637406e-04, -1.40500422e-04, -1.10619844e-04,
+	1.76307187e-04, 7.52525187e-05, -2.05757733e-04, -3.04581307e-05,
+	2.26129515e-04, -2.21054327e-05, -2.34948552e-04, 8.00642100e-05,
+	2.30184025e-04, -1.40397683e-04, -2.10436339e-04, 1.99559818e-04,
+	1.75105156e-04, -2.53649348e-04, -1.24523778e-04, 2.98623394e-04,
+	6.00470454e-05, -3.30544952e-04, 1.59183077e-05, 3.45851441e-04,
+	-9.99492227e-05, -3.41628725e-04, 1.87712634e-04, 3.15872987e-04,
+	-2.74143127e-04, -2.67721834e-04, 3.53687811e-04, 1.97636093e-04,
+	-4.20609401e-04, -1.07515144e-04, 4.69333676e-04, 7.31330181e-07,
+	-4.94823198e-04, 1.17927186e-04, 4.92955574e-04, -2.42410724e-04,
+	-4.60882127e-04, 3.65659367e-04, 3.97341740e-04, -4.79944645e-04,
+	-3.02905115e-04, 5.77288553e-04, 1.80126819e-04, -6.49940513e-04,
+	-3.35863359e-05, 6.90887318e-04, -1.30195263e-04, -6.94366608e-04,
+	3.02969650e-04, 6.56351458e-04, -4.75105378e-04, -5.74972506e-04,
+	6.36052197e-04, 4.50845005e-04, -7.74907374e-04, -2.87271240e-04,
+	8.81057699e-04, 9.02940955e-05, -9.44863687e-04, 1.31415242e-04,
+	9.58346874e-04, -3.66843401e-04, -9.15837448e-04, 6.03092516e-04,
+	8.14538239e-04, -8.25996246e-04, -6.54962563e-04, 1.02086983e-03,
+	4.41207620e-04, -1.17335948e-03, -1.81032198e-04, 1.27034721e-03,
+	-1.14283074e-04, -1.30086028e-03, 4.30303022e-04, 1.25692970e-03,
+	-7.50029653e-04, -1.13434094e-03, 1.05470117e-03, 9.33222083e-04,
+	-1.32476698e-03, -6.58419797e-04, 1.54099427e-03, 3.19622982e-04,
+	-1.68564992e-03, 6.87944016e-05, 1.74369289e-03, -4.88224770e-04,
+	-1.70390604e-03, 9.16569497e-04, 1.55989494e-03, -1.32925178e-03,
+	-1.31088322e-03, 1.70046119e-03, 9.62240919e-04, -2.00457449e-03,
+	-5.25693495e-04, 2.21768285e-03, 1.91738374e-05, -2.31914393e-03,
+	5.33701942e-04, 2.29306983e-03, -1.10453359e-03, -2.12965933e-03,
+	1.66138739e-03, 1.82628497e-03, -2.17035298e-03, -1.38825361e-03,
+	2.59734008e-03, 8.29171850e-04, -2.91003035e-03, -1.70865852e-04,
+	3.07988486e-03, -5.57173428e-04, -3.08409781e-03, 1.31882328e-03,
+	2.90738250e-03, -2.07281793e-03, -2.54347770e-03, 2.77464312e-03,
+	1.99627060e-03, -3.37876111e-03, -1.28044710e-03, 3.84106780e-03,
+	4.21600663e-04, -4.12146454e-03, 5.44243835e-04, 4.18641424e-03,
+	-1.57170566e-03, -4.01134444e-03, 2.60770632e-03, 3.58276038e-03,
+	-3.59366111e-03, -2.89993926e-03, 4.46812432e-03, 1.97609229e-03,
+	-5.16978012e-03, -8.38903549e-04, 5.64064792e-03, -4.69616493e-04,
+	-5.82935386e-03, 1.89399189e-03, 5.69431042e-03, -3.36684852e-03,
+	-5.20664498e-03, 4.81114190e-03, 4.35272617e-03, -6.14296130e-03,
+	-3.13615412e-03, 7.27479061e-03, 1.57910726e-03, -8.11907404e-03,
+	2.77026092e-04, 8.59190779e-03, -2.37175853e-03, -8.61665738e-03,
+	4.62633107e-03, 8.12728362e-03, -6.94516748e-03, -7.07114677e-03,
+	9.21778808e-03, 5.41104311e-03, -1.13209143e-02, -3.12620084e-03,
+	1.31203510e-02, 2.11903901e-04, -1.44720029e-02, 3.32271743e-03,
+	1.52209735e-02, -7.45947925e-03, -1.51968864e-02, 1.21799196e-02,
+	1.42018502e-02, -1.74809774e-02, -1.19834406e-02, 2.34043032e-02,
+	8.17462524e-03, -3.00964418e-02, -2.15192538e-03, 3.79504140e-02,
+	-7.34263633e-03, -4.80070591e-02, 2.34323346e-02, 6.34521854e-02,
+	-5.67555651e-02, -9.87544308e-02, 1.81564245e-01, 5.07634286e-01,
+	4.33944596e-01, 6.51645013e-02, -1.16664864e-01, -9.70054537e-03,
+	6.82801391e-02, -6.86475131e-03, -4.63427809e-02, 1.44728067e-02,
+	3.25869980e-02, -1.82738486e-02, -2.25496144e-02, 1.99152574e-02,
+	1.46571090e-02, -2.01218063e-02, -8.24435935e-03, 1.92960195e-02,
+	2.99827942e-03, -1.77079654e-02, 1.24232517e-03, 1.55665319e-02,
+	-4.57149576e-03, -1.30486071e-02, 7.05615724e-03, 1.03110431e-02,
+	-8.75626940e-03, -7.49489946e-03, 9.73503982e-03, 4.72608780e-03,
+	-1.00636435e-02, -2.11440854e-03, 9.82264599e-03, -2.47959226e-04,
+	-9.10133462e-03, 2.28791253e-03, 7.99569701e-03, -3.95246757e-03,
+	-6.60555391e-03, 5.20918619e-03, 5.03122929e-03, -6.04588412e-03,
+	-3.37006573e-03, 6.46959571e-03, 1.71304059e-03, -6.50483039e-03,
+	-1.41694013e-04, 6.19120300e-03, -1.27446169e-03, -5.58055699e-03,
+	2.47992424e-03, 4.73372536e-03, -3.43449056e-03, -3.71708995e-03,
+	4.11381148e-03, 2.59910587e-03, -4.50921193e-03, -1.44695369e-03,
+	4.62681556e-03, 3.23470198e-04, -4.48604707e-03, 7.15511723e-04,
+	4.11761474e-03, -1.62330935e-03, -3.56109704e-03, 2.36394815e-03,
+	2.86227221e-03, -2.91309023e-03, -2.07033548e-03, 3.25832557e-03,
+	1.23514762e-03, -3.39885070e-03, -4.04648995e-04, 3.34458955e-03,
+	-3.77441958e-04, -3.11483622e-03, 1.07354823e-03, 2.73651959e-03,
+	-1.65369917e-03, -2.24220338e-03, 2.09649608e-03, 1.66794201e-03,
+	-2.38956216e-03, -1.05111309e-03, 2.52948856e-03, 4.28340988e-04,
+	-2.52131382e-03, 1.66385843e-04, 2.37759630e-03, -7.03318153e-04,
+	-2.11715705e-03, 1.15820417e-03, 1.76358298e-03, -1.51316022e-03,
+	-1.34358733e-03, 1.75713451e-03, 8.85325372e-04, -1.88596820e-03,
+	-4.16759553e-04, 1.90207936e-03, -3.58410884e-05, -1.81381423e-03,
+	4.49195404e-04, 1.63452530e-03, -8.04042891e-04, -1.38144663e-03,
+	1.08587738e-03, 1.07444304e-03, -1.28536346e-03, -7.34711335e-04,
+	1.39843619e-03, 3.83508980e-04, -1.42610241e-03, -4.09785183e-05,
+	1.37397694e-03, -2.74874103e-04, -1.25159989e-03, 5.49002060e-04,
+	1.07158952e-03, -7.69910292e-04, -8.48691030e-04, 9.30002745e-04,
+	5.98782557e-04, -1.02568373e-03, -3.37897710e-04, 1.05722691e-03,
+	8.13184976e-05, -1.02843758e-03, 1.57215578e-04, 9.46143761e-04,
+	-3.66146652e-04, -8.19558690e-04, 5.36561669e-04, 6.59561263e-04,
+	-6.62467401e-04, -4.77942212e-04, 7.40876908e-04, 2.86661869e-04,
+	-7.71717920e-04, -9.71611143e-05, 7.57583111e-04, -8.02393165e-05,
+	-7.03349778e-04, 2.36823960e-04, 6.15701782e-04, -3.65833935e-04,
+	-5.02589637e-04, 4.62675478e-04, 3.72665260e-04, -5.24985821e-04,
+	-2.34726347e-04, 5.52564915e-04, 9.72018451e-05, -5.47188618e-04,
+	3.22951024e-05, 5.12324649e-04, -1.47326574e-04, -4.52776509e-04,
+	2.42888417e-04, 3.74282646e-04, -3.15561793e-04, -2.83098417e-04,
+	3.63558499e-04, 1.85587002e-04, -3.86667076e-04, -8.78425519e-05,
+	3.86112005e-04, -4.63512536e-06, -3.64342397e-04, 8.71999104e-05,
+	3.24769291e-04, -1.56243548e-04, -2.71472031e-04, 2.09300844e-04,
+	2.08894145e-04, -2.45077188e-04, -1.41547887e-04, 2.63404247e-04,
+	7.37442726e-05, -2.65133527e-04, -9.36228256e-06, 2.51980281e-04,
+	-4.83327593e-05, -2.26332112e-04, 9.68156225e-05, 1.91037362e-04,
+	-1.34370347e-04, -1.49188112e-04, 1.60103813e-04, 1.03911519e-04,
+	-1.73908590e-04, -5.81812962e-05, 1.76382614e-04, 1.46587222e-05,
+	-1.68715106e-04, 2.44302231e-05, 1.52549293e-04, -5.73779115e-05,
+	-1.29832844e-04, 8.30374947e-05, 1.02666543e-04, -1.00826505e-04,
+	-7.31607242e-05, 1.10695669e-04, 4.33075122e-05, -1.13068727e-04,
+	-1.48750211e-05, 1.08760243e-04, -1.06723645e-05, -9.88790295e-05,
+	3.22256168e-05, 8.47248768e-05, -4.90545943e-05, -6.76858328e-05,
+	6.08052610e-05, 4.91424566e-05, -6.74738578e-05, -3.03842653e-05,
+	6.93624008e-05, 1.25422253e-05, -6.70205753e-05, 3.46034742e-06,
+	6.11793831e-05, -1.69375837e-05, -5.26818082e-05, 2.74520196e-05,
+	4.24153283e-05, -3.48083591e-05, -3.12504047e-05, 3.90326107e-05,
+	1.99881819e-05, -4.03398183e-05, -9.31962850e-06, 3.90939657e-05,
+	-2.02687893e-07, -3.57637039e-05, 8.17998910e-06, 3.08773749e-05,
+	-1.43705208e-05, -2.49804068e-05, 1.86820470e-05, 1.85976008e-05,
+	-2.11555612e-05, -1.22021719e-05, 2.19425142e-05, 6.19269841e-06,
+	-2.12779961e-05, -8.78439971e-07, 1.94522650e-05, -3.52715382e-06,
+	-1.67828047e-05, 6.90546893e-06, 1.35887615e-05, -9.22543130e-06,
+	-1.01691863e-05, 1.05313218e-05, 6.78604273e-06, -1.09272784e-05,
+	-3.65246855e-06, 1.05600758e-05, 9.26331316e-07, -9.60166902e-06,
+	1.29126665e-06, 8.23278847e-06, -2.95318875e-06, -6.62861240e-06,
+	4.06004287e-06, 4.94723552e-06, -4.65153419e-06, -3.32134047e-06,
+	4.79641917e-06, 1.85317763e-06, -4.58203741e-06, -6.12693417e-07,
+	4.10428104e-06, -3.61568002e-07, -3.45869495e-06, 1.05931917e-06,
+	2.73320604e-06, -1.49376121e-06, -2.00277428e-06, 1.69584328e-06,
+	1.32606026e-06, -1.70817306e-06, -7.44028140e-07, 1.57912988e-06,
+	2.80260059e-07, -1.35762570e-06, 5.73454064e-08, 1.08883364e-06,
+	-2.73878361e-07, -8.11070504e-07, 3.84133449e-07, 5.53891717e-07,
+	-4.09125723e-07, -3.37343922e-07, 3.72747843e-07, 1.72229570e-07,
+	3.08693539e-07, 2.47931638e-07, -4.87797817e-07, -1.99888774e-07,
+	6.93603841e-07, 7.48425295e-08, -9.05848600e-07, 1.42791949e-07,
+	1.09631071e-06, -4.61928956e-07, -1.22990374e-06, 8.81825067e-07,
+	1.26682157e-06, -1.38942330e-06, -1.16573991e-06, 1.95738589e-06,
+	8.87968955e-07, -2.54317370e-06, -4.02334564e-07, 3.08949570e-06,
+	-3.09552926e-07, -3.52637855e-06, 1.24808823e-06, 3.77499592e-06,
+	-2.39104658e-06, -3.75325279e-06, 3.69011789e-06, 3.38295089e-06,
+	-5.06917173e-06, -2.59817830e-06, 6.42477027e-06, 1.35438467e-06,
+	-7.62933461e-06, 3.62560402e-07, 8.53720088e-06, -2.52815596e-06,
+	-8.99358386e-06, 5.07281030e-06, 8.84620768e-06, -7.87804506e-06,
+	-7.95908366e-06, 1.07762015e-05, 6.22763462e-06, -1.35543289e-05,
+	-3.59410807e-06, 1.59626913e-05, 6.20130735e-08, -1.77280094e-05,
+	4.29181688e-06, 1.85711702e-05, -9.30896823e-06, -1.82287200e-05,
+	1.47463518e-05, 1.64770245e-05, -2.02794159e-05, -1.31575807e-05,
+	2.55124831e-05, 8.20162273e-06, -2.99965782e-05, -1.65192806e-06,
+	3.32545652e-05, -6.32037719e-06, -3.48127979e-05, 1.54061555e-05,
+	3.42378458e-05, -2.51576443e-05, -3.11762375e-05, 3.49983736e-05,
+	2.53946153e-05, -4.42444979e-05, -1.68172734e-05, 5.21376693e-05,
+	5.55781009e-06, -5.78887067e-05, 8.05840278e-06, 6.07303819e-05,
+	-2.34839987e-05, -5.99767100e-05, 3.99542198e-05, 5.50852664e-05,
+	-5.65081622e-05, -4.57183437e-05, 7.20274857e-05, 3.17982671e-05,
+	-8.52922214e-05, -1.35519839e-05, 9.50519937e-05, -8.45982357e-06,
+	-1.00109610e-04, 3.33333476e-05, 9.94126610e-05, -5.98353501e-05,
+	-9.21476193e-05, 8.64420643e-05, 7.78300280e-05, -1.11403872e-04,
+	-5.63838334e-05, 1.32834542e-04, 2.82028159e-05, -1.48821895e-04,
+	5.81252787e-06, 1.57554857e-04, -4.42483736e-05, -1.57460056e-04,
+	8.52055062e-05, 1.47339622e-04, -1.26364160e-04, -1.26500765e-04,
+	1.65085812e-04, 9.48671501e-05, -1.98549388e-04, -5.30621862e-05,
+	2.23916659e-04, 2.45514768e-06, -2.38518964e-04, 5.48374219e-05,
+	2.40055027e-04, -1.16000358e-04, -2.26787704e-04, 1.77621067e-04,
+	1.97726213e-04, -2.35842436e-04, -1.52779884e-04, 2.86563025e-04,
+	9.28699000e-05, -3.25676385e-04, -1.99868311e-05, 3.49337856e-04,
+	-6.28158397e-05, -3.54244057e-04, 1.51498766e-04, 3.37907872e-04,
+	-2.41186873e-04, -2.98910268e-04, 3.26390468e-04, 2.37109825e-04,
+	-4.01290267e-04, -1.53791769e-04, 4.60074321e-04, 5.17404148e-05,
+	-4.97310150e-04, 6.47776175e-05, 5.08331432e-04, -1.90127430e-04,
+	-4.89615554e-04, 3.17519559e-04, 4.39126619e-04, -4.39319512e-04,
+	-3.56598294e-04, 5.47442661e-04, 2.43732300e-04, -6.33817446e-04,
+	-1.04291556e-04, 6.90893835e-04, -5.59282185e-05, -7.12168839e-04,
+	2.29258296e-04, 6.92697209e-04, -4.06450444e-04, -6.29553401e-04,
+	5.77098111e-04, 5.22210935e-04, -7.30170534e-04, -3.72807480e-04,
+	8.54636515e-04, 1.86268388e-04, -9.40146792e-04, 2.97320105e-05,
+	9.77737518e-04, -2.64983647e-04, -9.60512685e-04, 5.07130836e-04,
+	8.84261025e-04, -7.42230729e-04, -7.47963166e-04, 9.55460269e-04,
+	5.54147914e-04, -1.13194087e-03, -3.09062432e-04, 1.25764013e-03,
+	2.26297034e-05, -1.32030158e-03, 2.91822403e-04, 1.31034803e-03,
+	-6.18063327e-04, -1.22170062e-03, 9.37682176e-04, 1.05245687e-03,
+	-1.23100473e-03, -8.05374326e-04, 1.47816566e-03, 4.88114611e-04,
+	-1.66028393e-03, -1.13213220e-04, 1.76067894e-03, -3.02245587e-04,
+	-1.76605775e-03, 7.37253244e-04, 1.66759977e-03, -1.16778758e-03,
+	-1.46186613e-03, 1.56797850e-03, 1.15146553e-03, -1.91147979e-03,
+	-7.45417915e-04, 2.17298245e-03, 2.59170527e-04, -2.32979143e-03,
+	2.85761640e-04, 2.36337865e-03, -8.62539385e-04, -2.26081962e-03,
+	1.44011321e-03, 2.01602164e-03, -1.98467153e-03, -1.63065642e-03,
+	2.46136538e-03, 1.11472131e-03, -2.83623159e-03, -4.86669081e-04,
+	3.07821998e-03, -2.26933580e-04, -3.16121747e-03, 9.92234250e-04,
+	3.06595503e-03, -1.76939919e-03, -2.78168245e-03, 2.51435598e-03,
+	2.30750116e-03, -3.18090958e-03, -1.65325737e-03, 3.72314246e-03,
+	8.39915616e-04, -4.09798830e-03, 1.00643467e-04, 4.26785250e-03,
+	-1.12642981e-03, -4.20314311e-03, 2.18675259e-03, 3.88457257e-03,
+	-3.22419635e-03, -3.30509548e-03, 4.17709792e-03, 2.47135966e-03,
+	-4.98242785e-03, -1.40456773e-03, 5.57895391e-03, 1.40672270e-04,
+	-5.91054416e-03, 1.27014018e-03, 5.92945367e-03, -2.76468543e-03,
+	-5.59943393e-03, 4.26870882e-03, 4.89850775e-03, -5.69943517e-03,
+	-3.82126583e-03, 6.96863516e-03, 2.38056408e-03, -7.98606719e-03,
+	-6.08532693e-04, 8.66312245e-03, -1.44315020e-03, -8.91647480e-03,
+	3.70371680e-03, 8.67151459e-03, -6.08443465e-03, -7.86532542e-03,
+	8.48025763e-03, 6.44893906e-03, -1.07717645e-02, -4.38856568e-03,
+	1.28270077e-02, 1.66542263e-03, -1.45026800e-02, 1.72637027e-03,
+	1.56436217e-02, -5.78469568e-03, -1.60789543e-02, 1.05087522e-02,
+	1.56115418e-02, -1.59161066e-02, -1.39938023e-02, 2.20751022e-02,
+	1.08733986e-02, -2.91720234e-02, -5.66466657e-03, 3.76695304e-02,
+	-2.79333469e-03, -4.87543713e-02, 1.73425596e-02, 6.59920399e-02,
+	-4.75108418e-02, -1.05209286e-01, 1.57223883e-01, 4.96149631e-01,
+	4.51741018e-01, 8.71260588e-02, -1.15883359e-01, -1.90766309e-02,
+	6.88657533e-02, -9.66156923e-04, -4.77276616e-02, 1.03885721e-02,
+	3.44160797e-02, -1.54052129e-02, -2.46034362e-02, 1.79659603e-02,
+	1.67836506e-02, -1.89093618e-02, -1.03305423e-02, 1.86874665e-02,
+	4.95757546e-03, -1.75939702e-02, -5.24355263e-04, 1.58501217e-02,
+	-3.04526457e-03, -1.36403508e-02, 5.80202636e-03, 1.11273543e-02,
+	-7.79100268e-03, -8.45792343e-03, 9.06176805e-03, 5.76437098e-03,
+	-9.67325413e-03, -3.16389659e-03, 9.69537609e-03, 7.57121923e-04,
+	-9.20857041e-03, 1.37350006e-03, 8.30194367e-03, -3.16498194e-03,
+	-7.07051498e-03, 4.57455389e-03, 5.61192104e-03, -5.57973324e-03,
+	-4.02288627e-03, 6.17765690e-03, 2.39571389e-03, -6.38368684e-03,
+	-8.15015419e-04, 6.22935048e-03, -6.45141810e-04, -5.75971877e-03,
+	1.92352822e-03, 5.03035476e-03, -2.97338612e-03, -4.10398619e-03,
+	3.76334568e-03, 3.04706555e-03, -4.27760516e-03, -1.92638181e-03,
+	4.51539747e-03, 8.05879761e-04, -4.48980128e-03, 2.56173860e-04,
+	4.22598572e-03, -1.20956110e-03, -3.75900307e-03, 2.01393250e-03,
+	3.13126105e-03, -2.64001970e-03, -2.38981642e-03, 3.07021780e-03,
+	1.58363355e-03, -3.29854770e-03, -7.60946044e-04, 3.33003913e-03,
+	-3.31534905e-05, -3.17960250e-03, 7.58788452e-04, 2.87047998e-03,
+	-1.38295482e-03, -2.43238260e-03, 1.88070212e-03, 1.89943009e-03,
+	-2.23580997e-03, -1.30801340e-03, 2.44095915e-03, 6.94696537e-04,
+	-2.49742307e-03, -9.42648764e-05, 2.41432890e-03, -4.61987195e-04,
+	-2.20755738e-03, 9.47655418e-04, 1.89836514e-03, -1.34225902e-03,
+	-1.51182269e-03, 1.63187892e-03, 1.07516502e-03, -1.80939467e-03,
+	-6.16149953e-04, 1.87433612e-03, 1.61512497e-04, -1.83238573e-03,
+	2.64407632e-04, 1.69458397e-03, -6.40803194e-04, -1.47630310e-03,
+	9.51256250e-04, 1.19606252e-03, -1.18428827e-03, -8.74262797e-04,
+	1.33359597e-03, 5.31914187e-04, -1.39798341e-03, -1.89430726e-04,
+	1.38101686e-03, -1.34448235e-04, -1.29044279e-03, 4.23558503e-04,
+	1.13741950e-03, -6.64996859e-04, -9.35619608e-04, 8.49570291e-04,
+	7.00263978e-04, -9.72001742e-04, -4.47146574e-04, 1.03089982e-03,
+	1.91706129e-04, -1.02851269e-03, 5.18066060e-05, 9.70297302e-04,
+	-2.71026408e-04, -8.64342978e-04, 4.56007078e-04, 7.20694031e-04,
+	-5.99573736e-04, -5.50618146e-04, 6.97488514e-04, 3.65866802e-04,
+	-7.48435446e-04, -1.77970783e-04, 7.53840349e-04, -2.39167237e-06,
+	-7.17549758e-04, 1.65923778e-04, 6.45399263e-04, -3.05114307e-04,
+	-5.44705484e-04, 4.14504133e-04, 4.23717631e-04, -4.90811514e-04,
+	-2.91063900e-04, 5.32921041e-04, 1.55225351e-04, -5.41748738e-04,
+	-2.40655034e-05, 5.20002041e-04, -9.55617868e-05, -4.71857983e-04,
+	1.98110192e-04, 4.02585719e-04, -2.79535493e-04, -3.18140559e-04,
+	3.37384774e-04, 2.24755967e-04, -3.70784597e-04, -1.28557755e-04,
+	3.80338127e-04, 3.52212273e-05, -3.67945757e-04, 5.03124520e-05,
+	3.36567007e-04, -1.24049392e-04, -2.89943409e-04, 1.83079634e-04,
+	2.32302573e-04, -2.25636525e-04, -1.68062916e-04, 2.51082709e-04,
+	1.01556646e-04, -2.59830757e-04, -3.67858093e-05, 2.53209632e-04,
+	-2.27772020e-05, -2.33290398e-04, 7.43371199e-05, 2.02685791e-04,
+	-1.15867584e-04, -1.64338406e-04, 1.46147358e-04, 1.21311512e-04,
+	-1.64744497e-04, -7.65949253e-05, 1.71954834e-04, 3.29362071e-05,
+	-1.68703334e-04, 7.29518409e-06, 1.56418269e-04, -4.22059636e-05,
+	-1.36888870e-04, 7.04373578e-05, 1.12116962e-04, -9.11844291e-05,
+	-8.41724185e-05, 1.04179475e-04, 5.50609556e-05, -1.09644515e-04,
+	-2.66110797e-05, 1.08219278e-04, 3.85091943e-07, -1.00871961e-04,
+	2.23830415e-05, 8.88003027e-05, -4.08221426e-05, -7.33303099e-05,
+	5.44316484e-05, 5.58192899e-05, -6.30654443e-05, -3.75688066e-05,
+	6.68955734e-05, 1.97519027e-05, -6.63605443e-05, -3.35750358e-06,
+	6.21034022e-05, -1.08465389e-05, -5.49047869e-05, 2.23316852e-05,
+	4.56159036e-05, -3.08093864e-05, -3.50957499e-05, 3.62163699e-05,
+	2.41561306e-05, -3.86874497e-05, -1.35170495e-05, 3.85192443e-05,
+	3.77405253e-06, -3.61283672e-05, 4.62189114e-06, 3.20075772e-05,
+	-1.13723026e-05, -2.66830662e-05, 1.63280084e-05, 2.06755786e-05,
+	-1.94765754e-05, -1.44674457e-05, 2.09224935e-05, 8.47694255e-06,
+	-2.08624529e-05, -3.04068284e-06, 1.95580841e-05, -1.59587884e-06,
+	-1.73083850e-05, 5.28034364e-06, 1.44237816e-05, -7.94862963e-06,
+	-1.12033807e-05, 9.61489662e-06, 7.91653577e-06, -1.03576292e-05,
+	-4.78938192e-06, 1.03034351e-05, 1.99654490e-06, -9.61005708e-06,
+	3.42168879e-07, 8.44993775e-06, -2.16063090e-06, -6.99544027e-06,
+	3.44157391e-06, 5.40654410e-06, -4.20903243e-06, -3.82152971e-06,
+	4.51903743e-06, 2.35086535e-06, -4.44954208e-06, -1.07423558e-06,
+	4.09046478e-06, 4.04211820e-08, -3.53458991e-06, 7.30433516e-07,
+	2.86988519e-06, -1.24274287e-06, -2.17359640e-06, 1.52021925e-06,
+	1.50828264e-06, -1.60005075e-06, -9.19774897e-07, 1.52708384e-06,
+	4.36888147e-07, -1.34848509e-06, -7.26021599e-08, 1.10923952e-06,
+	-1.73648643e-07, -8.48714519e-07, 3.12968990e-07, 5.98390945e-07,
+	-3.63668443e-07, -3.80746312e-07, 3.47950333e-07, 2.09178009e-07,
+	2.77843288e-07, 2.85267657e-07, -4.56474281e-07, -2.58531773e-07,
+	6.68748855e-07, 1.57508243e-07, -8.96510359e-07, 3.58303038e-08,
+	1.11316790e-06, -3.33709599e-07, -1.28445603e-06, 7.39421283e-07,
+	1.37025471e-06, -1.24440489e-06, -1.32751036e-06, 1.82590370e-06,
+	1.11419278e-06, -2.44556697e-06, -6.94103744e-07, 3.04934933e-06,
+	4.22306904e-08, -3.56899745e-06, 8.49775722e-07, 3.92531486e-06,
+	-1.96851559e-06, -4.03325937e-06, 3.27472269e-06, 3.80876222e-06,
+	-4.70071165e-06, -3.17697390e-06, 6.14995027e-06, 2.08145225e-06,
+	-7.49922531e-06, -4.93631149e-07, 8.60371842e-06, -1.57823940e-06,
+	-9.30510266e-06, 4.08159090e-06, 9.44251907e-06, -6.91441604e-06,
+	-8.86601134e-06, 9.92343235e-06, 7.45170650e-06, -1.29063038e-05,
+	-5.11775271e-06, 1.56184772e-05, 1.83978978e-06, -1.77848912e-05,
+	2.33544169e-06, 1.91164453e-05, -7.27982424e-06, -1.93306984e-05,
+	1.27783585e-05, 1.81758249e-05, -1.85297083e-05, -1.54564298e-05,
+	2.41537855e-05, 1.10594447e-05, -2.92069489e-05, -4.97803808e-06,
+	3.32048668e-05, -2.66869497e-06, -3.56524871e-05, 1.16225074e-05,
+	3.60799041e-05, -2.14813158e-05, -3.40822615e-05, 3.17047771e-05,
+	2.93612354e-05, -4.16313018e-05, -2.17651459e-05, 5.05069672e-05,
+	1.13244224e-05, -5.75259402e-05, 1.72097509e-06, 6.18810868e-05,
+	-1.69054520e-05, -6.28224736e-05, 3.35358695e-05, 5.97205498e-05,
+	-5.07060419e-05, -5.21299965e-05, 6.73289312e-05, 3.98496216e-05,
+	-8.21866839e-05, -2.29733495e-05, 9.39973541e-05, 1.92733615e-06,
+	-1.01495770e-04, 2.25113937e-05, 1.03524628e-04, -4.92186524e-05,
+	-9.91306375e-05, 7.67518761e-05, 8.76594967e-05, -1.03405270e-04,
+	-6.88427857e-05, 1.27290853e-04, 4.28695416e-05, -1.46443018e-04,
+	-1.04354910e-05, 1.58942272e-04, -2.72363701e-05, -1.63051896e-04,
+	6.84089041e-05, 1.57359595e-04, -1.10880951e-04, -1.40914932e-04,
+	1.52075515e-04, 1.13352486e-04, -1.89164574e-04, -7.49905224e-05,
+	2.19226309e-04, 2.68954836e-05, -2.39427865e-04, 2.90961868e-05,
+	2.47224159e-04, -9.04053474e-05, -2.40561078e-04, 1.53790437e-04,
+	2.18069820e-04, -2.15481367e-04, -1.79238237e-04, 2.71364076e-04,
+	1.24545075e-04, -3.17209050e-04, -5.55439652e-05, 3.48933377e-04,
+	-2.51139844e-05, -3.62882569e-04, 1.13727200e-04, 3.56115552e-04,
+	-2.05664665e-04, -3.26674302e-04, 2.95560873e-04, 2.73818696e-04,
+	-3.77579676e-04, -1.98207461e-04, 4.45736933e-04, 1.02007733e-04,
+	-4.94266927e-04, 1.10813060e-05, 5.18013122e-04, -1.35901030e-04,
+	-5.12820326e-04, 2.66007241e-04, 4.75902946e-04, -3.93944196e-04,
+	-4.06163147e-04, 5.11611035e-04, 3.04433440e-04, -6.10706110e-04,
+	-1.73620722e-04, 6.83228269e-04, 1.87329720e-05, -7.22008534e-04,
+	1.53224377e-04, 7.21241117e-04, -3.33488180e-04, -6.76979958e-04,
+	5.11911048e-04, 5.87566027e-04, -6.77457387e-04, -4.53951925e-04,
+	8.18802033e-04, 2.79893833e-04, -9.25003190e-04, -7.19866172e-05,
+	9.86214198e-04, -1.60474352e-04, -9.94393059e-04, 4.05811579e-04,
+	9.43965217e-04, -6.50460266e-04, -8.32394205e-04, 8.79624403e-04,
+	6.60616607e-04, -1.07806762e-03, -4.33302580e-04, 1.23100169e-03,
+	1.58910749e-04, -1.32502629e-03, 1.50483599e-04, 1.34906688e-03,
+	-4.79595819e-04, -1.29525291e-03, 8.10569760e-04, 1.15967788e-03,
+	-1.12382669e-03, -9.42985099e-04, 1.39909136e-03, 6.50729094e-04,
+	-1.61654776e-03, -2.93472362e-04, 1.75806550e-03, -1.13410079e-04,
+	-1.80842899e-03, 5.50230377e-04, 1.75649585e-03, -9.93786504e-04,
+	-1.59620988e-03, 1.41843630e-03, 1.32739663e-03, -1.79740518e-03,
+	-9.56277315e-04, 2.10426867e-03, 4.95648418e-04, -2.31453641e-03,
+	3.53096697e-05, 2.40725265e-03, -6.11612743e-04, -2.36652121e-03,
+	1.20343788e-03, 2.18286071e-03, -1.77744726e-03, -1.85429857e-03,
+	2.29842182e-03, 1.38712137e-03, -2.73113456e-03, -7.96212551e-04,
+	3.04237486e-03, 1.04927634e-04, -3.20302048e-03, 6.55520523e-04,
+	3.19004402e-03, -1.44716782e-03, -2.98833716e-03, 2.22687065e-03,
+	2.59223822e-03, -2.94828981e-03, -2.00665757e-03, 3.56420739e-03,
+	1.24771130e-03, -4.02907369e-03, -3.42794422e-04, 4.30166321e-03,
+	-6.69948482e-04, -4.34770521e-03, 1.74276760e-03, 4.14234831e-03,
+	-2.82004718e-03, -3.67231987e-03, 3.84058731e-03, 2.93764962e-03,
+	-4.74034435e-03, -1.95284371e-03, 5.45551786e-03, 7.47418865e-04,
+	-5.92584901e-03, 6.34263755e-04, 6.09797812e-03, -2.13389074e-03,
+	-5.92870057e-03, 3.68080245e-03, 5.38795954e-03, -5.19426105e-03,
+	-4.46142360e-03, 6.58628913e-03, 3.15251568e-03, -7.76495018e-03,
+	-1.48378867e-03, 8.63790724e-03, -5.02419124e-04, -9.11606545e-03,
+	2.74406723e-03, 9.11707633e-03, -5.16019494e-03, -8.56845501e-03,
+	7.65228900e-03, 7.41002958e-03, -1.01060306e-02, -5.59539405e-03,
+	1.23930846e-02, 3.09194726e-03, -1.43723906e-02, 1.21077641e-04,
+	1.58900673e-02, -4.05756436e-03, -1.67763632e-02, 8.73423824e-03,
+	1.68366654e-02, -1.41888528e-02, -1.58302657e-02, 2.05152223e-02,
+	1.34220973e-02, -2.79363355e-02, -9.06801856e-03, 3.69770500e-02,
+	1.71017727e-03, -4.89502859e-02, 1.12017775e-02, 6.77371474e-02,
+	-3.80808807e-02, -1.10196811e-01, 1.33281534e-01, 4.82946002e-01,
+	4.68110588e-01, 1.09872505e-01, -1.13742754e-01, -2.85691943e-02,
+	6.86911780e-02, 5.07706440e-03, -4.86033339e-02, 6.11963279e-03,
+	3.58866413e-02, -1.23261332e-02, -2.64066991e-02, 1.57943388e-02,
+	1.87441902e-02, -1.74742246e-02, -1.23197073e-02, 1.78652196e-02,
+	6.87679003e-03, -1.72827663e-02, -2.29755274e-03, 1.59587597e-02,
+	-1.47533776e-03, -1.40835600e-02, 4.47584011e-03, 1.18241801e-02,
+	-6.73361877e-03, -9.33170088e-03, 8.28405411e-03, 6.74350370e-03,
+	-9.17317606e-03, -4.18298929e-03, 9.45947401e-03, 1.75818648e-03,
+	-9.21364576e-03, 4.39950476e-04, 8.51693658e-03, -2.33907425e-03,
+	-7.45852158e-03, 3.88651138e-03, 6.13228203e-03, -5.04969110e-03,
+	-4.63326881e-03, 5.81585193e-03, 3.05410711e-03, -6.19101119e-03,
+	-1.48156300e-03, 6.19823799e-03, -6.53980254e-06, -5.87531490e-03,
+	1.34390003e-03, 5.27190785e-03, -2.47770050e-03, -4.44638855e-03,
+	3.36987580e-03, 3.46246803e-03, -3.99765116e-03, -2.38580510e-03,
+	4.35335753e-03, 1.28074899e-03, -4.44356490e-03, -2.07362650e-04,
+	4.28760929e-03, -7.81146752e-04, -3.91561614e-03, 1.64048974e-03,
+	3.36614355e-03, -2.33677835e-03, -2.68358233e-03, 2.84739400e-03,
+	1.91545500e-03, -3.16123441e-03, -1.10975389e-03, 3.27836623e-03,
+	3.12448911e-04, -3.20913901e-03, 4.34720536e-04, 2.97284033e-03,
+	-1.09607572e-03, -2.59599091e-03, 1.64338241e-03, 2.11039152e-03,
+	-2.05674687e-03, -1.55103929e-03, 2.32501071e-03, 9.54031037e-04,
+	-2.44565831e-03, -3.54564228e-04, 2.42427518e-03, -2.14865820e-04,
+	-2.27361742e-03, 7.25990634e-04, 2.01236873e-03, -1.15595359e-03,
+	-1.66367358e-03, 1.48811586e-03, 1.25354102e-03, -1.71246698e-03,
+	-8.09214575e-04, 1.82564632e-03, 3.57598654e-04, -1.83060231e-03,
+	7.61768549e-05, 1.73593438e-03, -4.69985773e-04, -1.55497680e-03,
+	8.05676337e-04, 1.30469366e-03, -1.06974920e-03, -1.00445975e-03,
+	1.25372710e-03, 6.74803258e-04, -1.35421879e-03, -3.36182834e-04,
+	1.37269677e-03, 7.86422705e-06, -1.31502272e-03, 2.93048276e-04,
+	1.19076656e-03, -5.52383420e-04, -1.01237295e-03, 7.59449453e-04,
+	7.94233872e-04, -9.07342241e-04, -5.51726781e-04, 9.93016282e-04,
+	3.00275300e-04, -1.01713326e-03, -5.44838073e-05, 9.83714300e-04,
+	-1.72610870e-04, -8.99631403e-04, 3.70137511e-04, 7.73979824e-04,
+	-5.29816337e-04, -6.17376920e-04, 6.46202304e-04, 4.41233518e-04,
+	-7.16746878e-04, -2.57041810e-04, 7.41689719e-04, 7.57193248e-05,
+	-7.23800644e-04, 9.29579597e-05, 6.67999298e-04, -2.40808151e-04,
+	-5.80884802e-04, 3.61565170e-04, 4.70210301e-04, -4.51062207e-04,
+	-3.44337579e-04, 5.07278189e-04, 2.11705200e-04, -5.30256443e-04,
+	-8.03399549e-05, 5.21911526e-04, -4.25636809e-05, -4.85745368e-04,
+	1.50977507e-04, 4.26497462e-04, -2.40275159e-04, -3.49755547e-04,
+	3.07364319e-04, 2.61553261e-04, -3.50717210e-04, -1.67979683e-04,
+	3.70306922e-04, 7.48227182e-05, -3.67462077e-04, 1.27357156e-05,
+	3.44656084e-04, -9.03594829e-05, -3.05249679e-04, 1.54724922e-04,
+	2.53206528e-04, -2.03611500e-04, -1.92801455e-04, 2.35918358e-04,
+	1.28339455e-04, -2.51613000e-04, -6.39012791e-05, 2.51621868e-04,
+	3.12825006e-06, -2.37675183e-04, 5.09446571e-05, 2.12119982e-04,
+	-9.60022506e-05, -1.77715887e-04, 1.30507660e-04, 1.37427737e-04,
+	-1.53708067e-04, -9.42280303e-05, 1.65592766e-04, 5.09201544e-05,
+	-1.66811104e-04, -9.99104445e-06, 1.58559583e-04, -2.65008610e-05,
+	-1.42448330e-04, 5.69992686e-05, 1.20357390e-04, -8.04849199e-05,
+	-9.42928170e-05, 9.64738167e-05, 6.62514827e-05, -1.04982958e-04,
+	-3.81020274e-05, 1.06469352e-04, 1.14875476e-05, -1.01749138e-04,
+	1.22463761e-05, 9.19041420e-05, -3.20967108e-05, -7.81831882e-05,
+	4.74213609e-05, 6.19049989e-05, -5.79328824e-05, -4.43686258e-05,
+	6.36708461e-05, 2.67762021e-05, -6.49571675e-05, -1.01714482e-05,
+	6.23393178e-05, -4.60405662e-06, -5.65265387e-05, 1.69362189e-05,
+	4.83240299e-05, -2.64460471e-05, -3.85696155e-05, 3.29812783e-05,
+	2.80766835e-05, -3.65945973e-05, -1.75863142e-05, 3.75115941e-05,
+	7.73054156e-06, -3.60919007e-05, 9.92291276e-07, 3.27869687e-05,
+	-8.23005580e-06, -2.80977310e-05, 1.37780307e-05, 2.25349884e-05,
+	-1.75702190e-05, -1.65848013e-05, 1.96627248e-05, 1.06805303e-05,
+	-2.02114152e-05, -5.18249450e-06, 1.94461860e-05, 3.65559223e-07,
+	-1.76440728e-05, 3.58562394e-06, 1.51032269e-05, -6.57450198e-06,
+	-1.21194321e-05, 8.58478013e-06, 8.96643031e-06, -9.66825178e-06,
+	-5.88087289e-06, 9.92980477e-06, 3.05226834e-06, -9.51109767e-06,
+	-6.17884912e-07, 8.57428026e-06, -1.33778795e-06, -7.28692863e-06,
+	2.77969005e-06, 5.80910379e-06, -3.71581095e-06, -4.28315018e-06,
+	4.18873545e-06, 2.82655291e-06, -4.26608051e-06, -1.52789413e-06,
+	4.03072603e-06, 4.45706513e-07, -3.57161892e-06, 3.90168772e-07,
+	2.97576405e-06, -9.75245451e-07, -2.32182686e-06, 1.32567457e-06,
+	1.67557799e-06, -1.47275787e-06, -1.08722678e-06, 1.45726723e-06,
+	5.90530776e-07, -1.32406795e-06, -2.03441807e-07, 1.11743716e-06,
+	-7.00380595e-08, -8.77346869e-07, 2.37164815e-07, 6.36854988e-07,
+	-3.13307532e-07, -4.20629600e-07, 3.18707612e-07, 2.44529428e-07,
+	2.44529428e-07, 3.18707612e-07, -4.20629600e-07, -3.13307532e-07,
+	6.36854988e-07, 2.37164815e-07, -8.77346869e-07, -7.00380595e-08,
+	1.11743716e-06, -2.03441807e-07, -1.32406795e-06, 5.90530776e-07,
+	1.45726723e-06, -1.08722678e-06, -1.47275787e-06, 1.67557799e-06,
+	1.32567457e-06, -2.32182686e-06, -9.75245451e-07, 2.97576405e-06,
+	3.90168772e-07, -3.57161892e-06, 4.45706513e-07, 4.03072603e-06,
+	-1.52789413e-06, -4.26608051e-06, 2.82655291e-06, 4.18873545e-06,
+	-4.28315018e-06, -3.71581095e-06, 5.80910379e-06, 2.77969005e-06,
+	-7.28692863e-06, -1.33778795e-06, 8.57428026e-06, -6.17884912e-07,
+	-9.51109767e-06, 3.05226834e-06, 9.92980477e-06, -5.88087289e-06,
+	-9.66825178e-06, 8.96643031e-06, 8.58478013e-06, -1.21194321e-05,
+	-6.57450198e-06, 1.51032269e-05, 3.58562394e-06, -1.76440728e-05,
+	3.65559223e-07, 1.94461860e-05, -5.18249450e-06, -2.02114152e-05,
+	1.06805303e-05, 1.96627248e-05, -1.65848013e-05, -1.75702190e-05,
+	2.25349884e-05, 1.37780307e-05, -2.80977310e-05, -8.23005580e-06,
+	3.27869687e-05, 9.92291276e-07, -3.60919007e-05, 7.73054156e-06,
+	3.75115941e-05, -1.75863142e-05, -3.65945973e-05, 2.80766835e-05,
+	3.29812783e-05, -3.85696155e-05, -2.64460471e-05, 4.83240299e-05,
+	1.69362189e-05, -5.65265387e-05, -4.60405662e-06, 6.23393178e-05,
+	-1.01714482e-05, -6.49571675e-05, 2.67762021e-05, 6.36708461e-05,
+	-4.43686258e-05, -5.79328824e-05, 6.19049989e-05, 4.74213609e-05,
+	-7.81831882e-05, -3.20967108e-05, 9.19041420e-05, 1.22463761e-05,
+	-1.01749138e-04, 1.14875476e-05, 1.06469352e-04, -3.81020274e-05,
+	-1.04982958e-04, 6.62514827e-05, 9.64738167e-05, -9.42928170e-05,
+	-8.04849199e-05, 1.20357390e-04, 5.69992686e-05, -1.42448330e-04,
+	-2.65008610e-05, 1.58559583e-04, -9.99104445e-06, -1.66811104e-04,
+	5.09201544e-05, 1.65592766e-04, -9.42280303e-05, -1.53708067e-04,
+	1.37427737e-04, 1.30507660e-04, -1.77715887e-04, -9.60022506e-05,
+	2.12119982e-04, 5.09446571e-05, -2.37675183e-04, 3.12825006e-06,
+	2.51621868e-04, -6.39012791e-05, -2.51613000e-04, 1.28339455e-04,
+	2.35918358e-04, -1.92801455e-04, -2.03611500e-04, 2.53206528e-04,
+	1.54724922e-04, -3.05249679e-04, -9.03594829e-05, 3.44656084e-04,
+	1.27357156e-05, -3.67462077e-04, 7.48227182e-05, 3.70306922e-04,
+	-1.67979683e-04, -3.50717210e-04, 2.61553261e-04, 3.07364319e-04,
+	-3.49755547e-04, -2.40275159e-04, 4.26497462e-04, 1.50977507e-04,
+	-4.85745368e-04, -4.25636809e-05, 5.21911526e-04, -8.03399549e-05,
+	-5.30256443e-04, 2.11705200e-04, 5.07278189e-04, -3.44337579e-04,
+	-4.51062207e-04, 4.70210301e-04, 3.61565170e-04, -5.80884802e-04,
+	-2.40808151e-04, 6.67999298e-04, 9.29579597e-05, -7.23800644e-04,
+	7.57193248e-05, 7.41689719e-04, -2.57041810e-04, -7.16746878e-04,
+	4.41233518e-04, 6.46202304e-04, -6.17376920e-04, -5.29816337e-04,
+	7.73979824e-04, 3.70137511e-04, -8.99631403e-04, -1.72610870e-04,
+	9.83714300e-04, -5.44838073e-05, -1.01713326e-03, 3.00275300e-04,
+	9.93016282e-04, -5.51726781e-04, -9.07342241e-04, 7.94233872e-04,
+	7.59449453e-04, -1.01237295e-03, -5.52383420e-04, 1.19076656e-03,
+	2.93048276e-04, -1.31502272e-03, 7.86422705e-06, 1.37269677e-03,
+	-3.36182834e-04, -1.35421879e-03, 6.74803258e-04, 1.25372710e-03,
+	-1.00445975e-03, -1.06974920e-03, 1.30469366e-03, 8.05676337e-04,
+	-1.55497680e-03, -4.69985773e-04, 1.73593438e-03, 7.61768549e-05,
+	-1.83060231e-03, 3.57598654e-04, 1.82564632e-03, -8.09214575e-04,
+	-1.71246698e-03, 1.25354102e-03, 1.48811586e-03, -1.66367358e-03,
+	-1.15595359e-03, 2.01236873e-03, 7.25990634e-04, -2.27361742e-03,
+	-2.14865820e-04, 2.42427518e-03, -3.54564228e-04, -2.44565831e-03,
+	9.54031037e-04, 2.32501071e-03, -1.55103929e-03, -2.05674687e-03,
+	2.11039152e-03, 1.64338241e-03, -2.59599091e-03, -1.09607572e-03,
+	2.97284033e-03, 4.34720536e-04, -3.20913901e-03, 3.12448911e-04,
+	3.27836623e-03, -1.10975389e-03, -3.16123441e-03, 1.91545500e-03,
+	2.84739400e-03, -2.68358233e-03, -2.33677835e-03, 3.36614355e-03,
+	1.64048974e-03, -3.91561614e-03, -7.81146752e-04, 4.28760929e-03,
+	-2.07362650e-04, -4.44356490e-03, 1.28074899e-03, 4.35335753e-03,
+	-2.38580510e-03, -3.99765116e-03, 3.46246803e-03, 3.36987580e-03,
+	-4.44638855e-03, -2.47770050e-03, 5.27190785e-03, 1.34390003e-03,
+	-5.87531490e-03, -6.53980254e-06, 6.19823799e-03, -1.48156300e-03,
+	-6.19101119e-03, 3.05410711e-03, 5.81585193e-03, -4.63326881e-03,
+	-5.04969110e-03, 6.13228203e-03, 3.88651138e-03, -7.45852158e-03,
+	-2.33907425e-03, 8.51693658e-03, 4.39950476e-04, -9.21364576e-03,
+	1.75818648e-03, 9.45947401e-03, -4.18298929e-03, -9.17317606e-03,
+	6.74350370e-03, 8.28405411e-03, -9.33170088e-03, -6.73361877e-03,
+	1.18241801e-02, 4.47584011e-03, -1.40835600e-02, -1.47533776e-03,
+	1.59587597e-02, -2.29755274e-03, -1.72827663e-02, 6.87679003e-03,
+	1.78652196e-02, -1.23197073e-02, -1.74742246e-02, 1.87441902e-02,
+	1.57943388e-02, -2.64066991e-02, -1.23261332e-02, 3.58866413e-02,
+	6.11963279e-03, -4.86033339e-02, 5.07706440e-03, 6.86911780e-02,
+	-2.85691943e-02, -1.13742754e-01, 1.09872505e-01, 4.68110588e-01,
+	4.82946002e-01, 1.33281534e-01, -1.10196811e-01, -3.80808807e-02,
+	6.77371474e-02, 1.12017775e-02, -4.89502859e-02, 1.71017727e-03,
+	3.69770500e-02, -9.06801856e-03, -2.79363355e-02, 1.34220973e-02,
+	2.05152223e-02, -1.58302657e-02, -1.41888528e-02, 1.68366654e-02,
+	8.73423824e-03, -1.67763632e-02, -4.05756436e-03, 1.58900673e-02,
+	1.21077641e-04, -1.43723906e-02, 3.09194726e-03, 1.23930846e-02,
+	-5.59539405e-03, -1.01060306e-02, 7.41002958e-03, 7.65228900e-03,
+	-8.56845501e-03, -5.16019494e-03, 9.11707633e-03, 2.74406723e-03,
+	-9.11606545e-03, -5.02419124e-04, 8.63790724e-03, -1.48378867e-03,
+	-7.76495018e-03, 3.15251568e-03, 6.58628913e-03, -4.46142360e-03,
+	-5.19426105e-03, 5.38795954e-03, 3.68080245e-03, -5.92870057e-03,
+	-2.13389074e-03, 6.09797812e-03, 6.34263755e-04, -5.92584901e-03,
+	7.47418865e-04, 5.45551786e-03, -1.95284371e-03, -4.74034435e-03,
+	2.93764962e-03, 3.84058731e-03, -3.67231987e-03, -2.82004718e-03,
+	4.14234831e-03, 1.74276760e-03, -4.34770521e-03, -6.69948482e-04,
+	4.30166321e-03, -3.42794422e-04, -4.02907369e-03, 1.24771130e-03,
+	3.56420739e-03, -2.00665757e-03, -2.94828981e-03, 2.59223822e-03,
+	2.22687065e-03, -2.98833716e-03, -1.44716782e-03, 3.19004402e-03,
+	6.55520523e-04, -3.20302048e-03, 1.04927634e-04, 3.04237486e-03,
+	-7.96212551e-04, -2.73113456e-03, 1.38712137e-03, 2.29842182e-03,
+	-1.85429857e-03, -1.77744726e-03, 2.18286071e-03, 1.20343788e-03,
+	-2.36652121e-03, -6.11612743e-04, 2.40725265e-03, 3.53096697e-05,
+	-2.31453641e-03, 4.95648418e-04, 2.10426867e-03, -9.56277315e-04,
+	-1.79740518e-03, 1.32739663e-03, 1.41843630e-03, -1.59620988e-03,
+	-9.93786504e-04, 1.75649585e-03, 5.50230377e-04, -1.80842899e-03,
+	-1.13410079e-04, 1.75806550e-03, -2.93472362e-04, -1.61654776e-03,
+	6.50729094e-04, 1.39909136e-03, -9.42985099e-04, -1.12382669e-03,
+	1.15967788e-03, 8.10569760e-04, -1.29525291e-03, -4.79595819e-04,
+	1.34906688e-03, 1.50483599e-04, -1.32502629e-03, 1.58910749e-04,
+	1.23100169e-03, -4.33302580e-04, -1.07806762e-03, 6.60616607e-04,
+	8.79624403e-04, -8.32394205e-04, -6.50460266e-04, 9.43965217e-04,
+	4.05811579e-04, -9.94393059e-04, -1.60474352e-04, 9.86214198e-04,
+	-7.19866172e-05, -9.25003190e-04, 2.79893833e-04, 8.18802033e-04,
+	-4.53951925e-04, -6.77457387e-04, 5.87566027e-04, 5.11911048e-04,
+	-6.76979958e-04, -3.33488180e-04, 7.21241117e-04, 1.53224377e-04,
+	-7.22008534e-04, 1.87329720e-05, 6.83228269e-04, -1.73620722e-04,
+	-6.10706110e-04, 3.04433440e-04, 5.11611035e-04, -4.06163147e-04,
+	-3.93944196e-04, 4.75902946e-04, 2.66007241e-04, -5.12820326e-04,
+	-1.35901030e-04, 5.18013122e-04, 1.10813060e-05, -4.94266927e-04,
+	1.02007733e-04, 4.45736933e-04, -1.98207461e-04, -3.77579676e-04,
+	2.73818696e-04, 2.95560873e-04, -3.26674302e-04, -2.05664665e-04,
+	3.56115552e-04, 1.13727200e-04, -3.62882569e-04, -2.51139844e-05,
+	3.48933377e-04, -5.55439652e-05, -3.17209050e-04, 1.24545075e-04,
+	2.71364076e-04, -1.79238237e-04, -2.15481367e-04, 2.18069820e-04,
+	1.53790437e-04, -2.40561078e-04, -9.04053474e-05, 2.47224159e-04,
+	2.90961868e-05, -2.39427865e-04, 2.68954836e-05, 2.19226309e-04,
+	-7.49905224e-05, -1.89164574e-04, 1.13352486e-04, 1.52075515e-04,
+	-1.40914932e-04, -1.10880951e-04, 1.57359595e-04, 6.84089041e-05,
+	-1.63051896e-04, -2.72363701e-05, 1.58942272e-04, -1.04354910e-05,
+	-1.46443018e-04, 4.28695416e-05, 1.27290853e-04, -6.88427857e-05,
+	-1.03405270e-04, 8.76594967e-05, 7.67518761e-05, -9.91306375e-05,
+	-4.92186524e-05, 1.03524628e-04, 2.25113937e-05, -1.01495770e-04,
+	1.92733615e-06, 9.39973541e-05, -2.29733495e-05, -8.21866839e-05,
+	3.98496216e-05, 6.73289312e-05, -5.21299965e-05, -5.07060419e-05,
+	5.97205498e-05, 3.35358695e-05, -6.28224736e-05, -1.69054520e-05,
+	6.18810868e-05, 1.72097509e-06, -5.75259402e-05, 1.13244224e-05,
+	5.05069672e-05, -2.17651459e-05, -4.16313018e-05, 2.93612354e-05,
+	3.17047771e-05, -3.40822615e-05, -2.14813158e-05, 3.60799041e-05,
+	1.16225074e-05, -3.56524871e-05, -2.66869497e-06, 3.32048668e-05,
+	-4.97803808e-06, -2.92069489e-05, 1.10594447e-05, 2.41537855e-05,
+	-1.54564298e-05, -1.85297083e-05, 1.81758249e-05, 1.27783585e-05,
+	-1.93306984e-05, -7.27982424e-06, 1.91164453e-05, 2.33544169e-06,
+	-1.77848912e-05, 1.83978978e-06, 1.56184772e-05, -5.11775271e-06,
+	-1.29063038e-05, 7.45170650e-06, 9.92343235e-06, -8.86601134e-06,
+	-6.91441604e-06, 9.44251907e-06, 4.08159090e-06, -9.30510266e-06,
+	-1.57823940e-06, 8.60371842e-06, -4.93631149e-07, -7.49922531e-06,
+	2.08145225e-06, 6.14995027e-06, -3.17697390e-06, -4.70071165e-06,
+	3.80876222e-06, 3.27472269e-06, -4.03325937e-06, -1.96851559e-06,
+	3.92531486e-06, 8.49775722e-07, -3.56899745e-06, 4.22306904e-08,
+	3.04934933e-06, -6.94103744e-07, -2.44556697e-06, 1.11419278e-06,
+	1.82590370e-06, -1.32751036e-06, -1.24440489e-06, 1.37025471e-06,
+	7.39421283e-07, -1.28445603e-06, -3.33709599e-07, 1.11316790e-06,
+	3.58303038e-08, -8.96510359e-07, 1.57508243e-07, 6.68748855e-07,
+	-2.58531773e-07, -4.56474281e-07, 2.85267657e-07, 2.77843288e-07,
+	2.09178009e-07, 3.47950333e-07, -3.80746312e-07, -3.63668443e-07,
+	5.98390945e-07, 3.12968990e-07, -8.48714519e-07, -1.73648643e-07,
+	1.10923952e-06, -7.26021599e-08, -1.34848509e-06, 4.36888147e-07,
+	1.52708384e-06, -9.19774897e-07, -1.60005075e-06, 1.50828264e-06,
+	1.52021925e-06, -2.17359640e-06, -1.24274287e-06, 2.86988519e-06,
+	7.30433516e-07, -3.53458991e-06, 4.04211820e-08, 4.09046478e-06,
+	-1.07423558e-06, -4.44954208e-06, 2.35086535e-06, 4.51903743e-06,
+	-3.82152971e-06, -4.20903243e-06, 5.40654410e-06, 3.44157391e-06,
+	-6.99544027e-06, -2.16063090e-06, 8.44993775e-06, 3.42168879e-07,
+	-9.61005708e-06, 1.99654490e-06, 1.03034351e-05, -4.78938192e-06,
+	-1.03576292e-05, 7.91653577e-06, 9.61489662e-06, -1.12033807e-05,
+	-7.94862963e-06, 1.44237816e-05, 5.28034364e-06, -1.73083850e-05,
+	-1.59587884e-06, 1.95580841e-05, -3.04068284e-06, -2.08624529e-05,
+	8.47694255e-06, 2.09224935e-05, -1.44674457e-05, -1.94765754e-05,
+	2.06755786e-05, 1.63280084e-05, -2.66830662e-05, -1.13723026e-05,
+	3.20075772e-05, 4.62189114e-06, -3.61283672e-05, 3.77405253e-06,
+	3.85192443e-05, -1.35170495e-05, -3.86874497e-05, 2.41561306e-05,
+	3.62163699e-05, -3.50957499e-05, -3.08093864e-05, 4.56159036e-05,
+	2.23316852e-05, -5.49047869e-05, -1.08465389e-05, 6.21034022e-05,
+	-3.35750358e-06, -6.63605443e-05, 1.97519027e-05, 6.68955734e-05,
+	-3.75688066e-05, -6.30654443e-05, 5.58192899e-05, 5.44316484e-05,
+	-7.33303099e-05, -4.08221426e-05, 8.88003027e-05, 2.23830415e-05,
+	-1.00871961e-04, 3.85091943e-07, 1.08219278e-04, -2.66110797e-05,
+	-1.09644515e-04, 5.50609556e-05, 1.04179475e-04, -8.41724185e-05,
+	-9.11844291e-05, 1.12116962e-04, 7.04373578e-05, -1.36888870e-04,
+	-4.22059636e-05, 1.56418269e-04, 7.29518409e-06, -1.68703334e-04,
+	3.29362071e-05, 1.71954834e-04, -7.65949253e-05, -1.64744497e-04,
+	1.21311512e-04, 1.46147358e-04, -1.64338406e-04, -1.15867584e-04,
+	2.02685791e-04, 7.43371199e-05, -2.33290398e-04, -2.27772020e-05,
+	2.53209632e-04, -3.67858093e-05, -2.59830757e-04, 1.01556646e-04,
+	2.51082709e-04, -1.68062916e-04, -2.25636525e-04, 2.32302573e-04,
+	1.83079634e-04, -2.89943409e-04, -1.24049392e-04, 3.36567007e-04,
+	5.03124520e-05, -3.67945757e-04, 3.52212273e-05, 3.80338127e-04,
+	-1.28557755e-04, -3.70784597e-04, 2.24755967e-04, 3.37384774e-04,
+	-3.18140559e-04, -2.79535493e-04, 4.02585719e-04, 1.98110192e-04,
+	-4.71857983e-04, -9.55617868e-05, 5.20002041e-04, -2.40655034e-05,
+	-5.41748738e-04, 1.55225351e-04, 5.32921041e-04, -2.91063900e-04,
+	-4.90811514e-04, 4.23717631e-04, 4.14504133e-04, -5.44705484e-04,
+	-3.05114307e-04, 6.45399263e-04, 1.65923778e-04, -7.17549758e-04,
+	-2.39167237e-06, 7.53840349e-04, -1.77970783e-04, -7.48435446e-04,
+	3.65866802e-04, 6.97488514e-04, -5.50618146e-04, -5.99573736e-04,
+	7.20694031e-04, 4.56007078e-04, -8.64342978e-04, -2.71026408e-04,
+	9.70297302e-04, 5.18066060e-05, -1.02851269e-03, 1.91706129e-04,
+	1.03089982e-03, -4.47146574e-04, -9.72001742e-04, 7.00263978e-04,
+	8.49570291e-04, -9.35619608e-04, -6.64996859e-04, 1.13741950e-03,
+	4.23558503e-04, -1.29044279e-03, -1.34448235e-04, 1.38101686e-03,
+	-1.89430726e-04, -1.39798341e-03, 5.31914187e-04, 1.33359597e-03,
+	-8.74262797e-04, -1.18428827e-03, 1.19606252e-03, 9.51256250e-04,
+	-1.47630310e-03, -6.40803194e-04, 1.69458397e-03, 2.64407632e-04,
+	-1.83238573e-03, 1.61512497e-04, 1.87433612e-03, -6.16149953e-04,
+	-1.80939467e-03, 1.07516502e-03, 1.63187892e-03, -1.51182269e-03,
+	-1.34225902e-03, 1.89836514e-03, 9.47655418e-04, -2.20755738e-03,
+	-4.61987195e-04, 2.41432890e-03, -9.42648764e-05, -2.49742307e-03,
+	6.94696537e-04, 2.44095915e-03, -1.30801340e-03, -2.23580997e-03,
+	1.89943009e-03, 1.88070212e-03, -2.43238260e-03, -1.38295482e-03,
+	2.87047998e-03, 7.58788452e-04, -3.17960250e-03, -3.31534905e-05,
+	3.33003913e-03, -7.60946044e-04, -3.29854770e-03, 1.58363355e-03,
+	3.07021780e-03, -2.38981642e-03, -2.64001970e-03, 3.13126105e-03,
+	2.01393250e-03, -3.75900307e-03, -1.20956110e-03, 4.22598572e-03,
+	2.56173860e-04, -4.48980128e-03, 8.05879761e-04, 4.51539747e-03,
+	-1.92638181e-03, -4.27760516e-03, 3.04706555e-03, 3.76334568e-03,
+	-4.10398619e-03, -2.97338612e-03, 5.03035476e-03, 1.92352822e-03,
+	-5.75971877e-03, -6.45141810e-04, 6.22935048e-03, -8.15015419e-04,
+	-6.38368684e-03, 2.39571389e-03, 6.17765690e-03, -4.02288627e-03,
+	-5.57973324e-03, 5.61192104e-03, 4.57455389e-03, -7.07051498e-03,
+	-3.16498194e-03, 8.30194367e-03, 1.37350006e-03, -9.20857041e-03,
+	7.57121923e-04, 9.69537609e-03, -3.16389659e-03, -9.67325413e-03,
+	5.76437098e-03, 9.06176805e-03, -8.45792343e-03, -7.79100268e-03,
+	1.11273543e-02, 5.80202636e-03, -1.36403508e-02, -3.04526457e-03,
+	1.58501217e-02, -5.24355263e-04, -1.75939702e-02, 4.95757546e-03,
+	1.86874665e-02, -1.03305423e-02, -1.89093618e-02, 1.67836506e-02,
+	1.79659603e-02, -2.46034362e-02, -1.54052129e-02, 3.44160797e-02,
+	1.03885721e-02, -4.77276616e-02, -9.66156923e-04, 6.88657533e-02,
+	-1.90766309e-02, -1.15883359e-01, 8.71260588e-02, 4.51741018e-01,
+	4.96149631e-01, 1.57223883e-01, -1.05209286e-01, -4.75108418e-02,
+	6.59920399e-02, 1.73425596e-02, -4.87543713e-02, -2.79333469e-03,
+	3.76695304e-02, -5.66466657e-03, -2.91720234e-02, 1.08733986e-02,
+	2.20751022e-02, -1.39938023e-02, -1.59161066e-02, 1.56115418e-02,
+	1.05087522e-02, -1.60789543e-02, -5.78469568e-03, 1.56436217e-02,
+	1.72637027e-03, -1.45026800e-02, 1.66542263e-03, 1.28270077e-02,
+	-4.38856568e-03, -1.07717645e-02, 6.44893906e-03, 8.48025763e-03,
+	-7.86532542e-03, -6.08443465e-03, 8.67151459e-03, 3.70371680e-03,
+	-8.91647480e-03, -1.44315020e-03, 8.66312245e-03, -6.08532693e-04,
+	-7.98606719e-03, 2.38056408e-03, 6.96863516e-03, -3.82126583e-03,
+	-5.69943517e-03, 4.89850775e-03, 4.26870882e-03, -5.59943393e-03,
+	-2.76468543e-03, 5.92945367e-03, 1.27014018e-03, -5.91054416e-03,
+	1.40672270e-04, 5.57895391e-03, -1.40456773e-03, -4.98242785e-03,
+	2.47135966e-03, 4.17709792e-03, -3.30509548e-03, -3.22419635e-03,
+	3.88457257e-03, 2.18675259e-03, -4.20314311e-03, -1.12642981e-03,
+	4.26785250e-03, 1.00643467e-04, -4.09798830e-03, 8.39915616e-04,
+	3.72314246e-03, -1.65325737e-03, -3.18090958e-03, 2.30750116e-03,
+	2.51435598e-03, -2.78168245e-03, -1.76939919e-03, 3.06595503e-03,
+	9.92234250e-04, -3.16121747e-03, -2.26933580e-04, 3.07821998e-03,
+	-4.86669081e-04, -2.83623159e-03, 1.11472131e-03, 2.46136538e-03,
+	-1.63065642e-03, -1.98467153e-03, 2.01602164e-03, 1.44011321e-03,
+	-2.26081962e-03, -8.62539385e-04, 2.36337865e-03, 2.85761640e-04,
+	-2.32979143e-03, 2.59170527e-04, 2.17298245e-03, -7.45417915e-04,
+	-1.91147979e-03, 1.15146553e-03, 1.56797850e-03, -1.46186613e-03,
+	-1.16778758e-03, 1.66759977e-03, 7.37253244e-04, -1.76605775e-03,
+	-3.02245587e-04, 1.76067894e-03, -1.13213220e-04, -1.66028393e-03,
+	4.88114611e-04, 1.47816566e-03, -8.05374326e-04, -1.23100473e-03,
+	1.05245687e-03, 9.37682176e-04, -1.22170062e-03, -6.18063327e-04,
+	1.31034803e-03, 2.91822403e-04, -1.32030158e-03, 2.26297034e-05,
+	1.25764013e-03, -3.09062432e-04, -1.13194087e-03, 5.54147914e-04,
+	9.55460269e-04, -7.47963166e-04, -7.42230729e-04, 8.84261025e-04,
+	5.07130836e-04, -9.60512685e-04, -2.64983647e-04, 9.77737518e-04,
+	2.97320105e-05, -9.40146792e-04, 1.86268388e-04, 8.54636515e-04,
+	-3.72807480e-04, -7.30170534e-04, 5.22210935e-04, 5.77098111e-04,
+	-6.29553401e-04, -4.06450444e-04, 6.92697209e-04, 2.29258296e-04,
+	-7.12168839e-04, -5.59282185e-05, 6.90893835e-04, -1.04291556e-04,
+	-6.33817446e-04, 2.43732300e-04, 5.47442661e-04, -3.56598294e-04,
+	-4.39319512e-04, 4.39126619e-04, 3.17519559e-04, -4.89615554e-04,
+	-1.90127430e-04, 5.08331432e-04, 6.47776175e-05, -4.97310150e-04,
+	5.17404148e-05, 4.60074321e-04, -1.53791769e-04, -4.01290267e-04,
+	2.37109825e-04, 3.26390468e-04, -2.98910268e-04, -2.41186873e-04,
+	3.37907872e-04, 1.51498766e-04, -3.54244057e-04, -6.28158397e-05,
+	3.49337856e-04, -1.99868311e-05, -3.25676385e-04, 9.28699000e-05,
+	2.86563025e-04, -1.52779884e-04, -2.35842436e-04, 1.97726213e-04,
+	1.77621067e-04, -2.26787704e-04, -1.16000358e-04, 2.40055027e-04,
+	5.48374219e-05, -2.38518964e-04, 2.45514768e-06, 2.23916659e-04,
+	-5.30621862e-05, -1.98549388e-04, 9.48671501e-05, 1.65085812e-04,
+	-1.26500765e-04, -1.26364160e-04, 1.47339622e-04, 8.52055062e-05,
+	-1.57460056e-04, -4.42483736e-05, 1.57554857e-04, 5.81252787e-06,
+	-1.48821895e-04, 2.82028159e-05, 1.32834542e-04, -5.63838334e-05,
+	-1.11403872e-04, 7.78300280e-05, 8.64420643e-05, -9.21476193e-05,
+	-5.98353501e-05, 9.94126610e-05, 3.33333476e-05, -1.00109610e-04,
+	-8.45982357e-06, 9.50519937e-05, -1.35519839e-05, -8.52922214e-05,
+	3.17982671e-05, 7.20274857e-05, -4.57183437e-05, -5.65081622e-05,
+	5.50852664e-05, 3.99542198e-05, -5.99767100e-05, -2.34839987e-05,
+	6.07303819e-05, 8.05840278e-06, -5.78887067e-05, 5.55781009e-06,
+	5.21376693e-05, -1.68172734e-05, -4.42444979e-05, 2.53946153e-05,
+	3.49983736e-05, -3.11762375e-05, -2.51576443e-05, 3.42378458e-05,
+	1.54061555e-05, -3.48127979e-05, -6.32037719e-06, 3.32545652e-05,
+	-1.65192806e-06, -2.99965782e-05, 8.20162273e-06, 2.55124831e-05,
+	-1.31575807e-05, -2.02794159e-05, 1.64770245e-05, 1.47463518e-05,
+	-1.82287200e-05, -9.30896823e-06, 1.85711702e-05, 4.29181688e-06,
+	-1.77280094e-05, 6.20130735e-08, 1.59626913e-05, -3.59410807e-06,
+	-1.35543289e-05, 6.22763462e-06, 1.07762015e-05, -7.95908366e-06,
+	-7.87804506e-06, 8.84620768e-06, 5.07281030e-06, -8.99358386e-06,
+	-2.52815596e-06, 8.53720088e-06, 3.62560402e-07, -7.62933461e-06,
+	1.35438467e-06, 6.42477027e-06, -2.59817830e-06, -5.06917173e-06,
+	3.38295089e-06, 3.69011789e-06, -3.75325279e-06, -2.39104658e-06,
+	3.77499592e-06, 1.24808823e-06, -3.52637855e-06, -3.09552926e-07,
+	3.08949570e-06, -4.02334564e-07, -2.54317370e-06, 8.87968955e-07,
+	1.95738589e-06, -1.16573991e-06, -1.38942330e-06, 1.26682157e-06,
+	8.81825067e-07, -1.22990374e-06, -4.61928956e-07, 1.09631071e-06,
+	1.42791949e-07, -9.05848600e-07, 7.48425295e-08, 6.93603841e-07,
+	-1.99888774e-07, -4.87797817e-07, 2.47931638e-07, 3.08693539e-07,
+	1.72229570e-07, 3.72747843e-07, -3.37343922e-07, -4.09125723e-07,
+	5.53891717e-07, 3.84133449e-07, -8.11070504e-07, -2.73878361e-07,
+	1.08883364e-06, 5.73454064e-08, -1.35762570e-06, 2.80260059e-07,
+	1.57912988e-06, -7.44028140e-07, -1.70817306e-06, 1.32606026e-06,
+	1.69584328e-06, -2.00277428e-06, -1.49376121e-06, 2.73320604e-06,
+	1.05931917e-06, -3.45869495e-06, -3.61568002e-07, 4.10428104e-06,
+	-6.12693417e-07, -4.58203741e-06, 1.85317763e-06, 4.79641917e-06,
+	-3.32134047e-06, -4.65153419e-06, 4.94723552e-06, 4.06004287e-06,
+	-6.62861240e-06, -2.95318875e-06, 8.23278847e-06, 1.29126665e-06,
+	-9.60166902e-06, 9.26331316e-07, 1.05600758e-05, -3.65246855e-06,
+	-1.09272784e-05, 6.78604273e-06, 1.05313218e-05, -1.01691863e-05,
+	-9.22543130e-06, 1.35887615e-05, 6.90546893e-06, -1.67828047e-05,
+	-3.52715382e-06, 1.94522650e-05, -8.78439971e-07, -2.12779961e-05,
+	6.19269841e-06, 2.19425142e-05, -1.22021719e-05, -2.11555612e-05,
+	1.85976008e-05, 1.86820470e-05, -2.49804068e-05, -1.43705208e-05,
+	3.08773749e-05, 8.17998910e-06, -3.57637039e-05, -2.02687893e-07,
+	3.90939657e-05, -9.31962850e-06, -4.03398183e-05, 1.99881819e-05,
+	3.90326107e-05, -3.12504047e-05, -3.48083591e-05, 4.24153283e-05,
+	2.74520196e-05, -5.26818082e-05, -1.69375837e-05, 6.11793831e-05,
+	3.46034742e-06, -6.70205753e-05, 1.25422253e-05, 6.93624008e-05,
+	-3.03842653e-05, -6.74738578e-05, 4.91424566e-05, 6.08052610e-05,
+	-6.76858328e-05, -4.90545943e-05, 8.47248768e-05, 3.22256168e-05,
+	-9.88790295e-05, -1.06723645e-05, 1.08760243e-04, -1.48750211e-05,
+	-1.13068727e-04, 4.33075122e-05, 1.10695669e-04, -7.31607242e-05,
+	-1.00826505e-04, 1.02666543e-04, 8.30374947e-05, -1.29832844e-04,
+	-5.73779115e-05, 1.52549293e-04, 2.44302231e-05, -1.68715106e-04,
+	1.46587222e-05, 1.76382614e-04, -5.81812962e-05, -1.73908590e-04,
+	1.03911519e-04, 1.60103813e-04, -1.49188112e-04, -1.34370347e-04,
+	1.91037362e-04, 9.68156225e-05, -2.26332112e-04, -4.83327593e-05,
+	2.51980281e-04, -9.36228256e-06, -2.65133527e-04, 7.37442726e-05,
+	2.63404247e-04, -1.41547887e-04, -2.45077188e-04, 2.08894145e-04,
+	2.09300844e-04, -2.71472031e-04, -1.56243548e-04, 3.24769291e-04,
+	8.71999104e-05, -3.64342397e-04, -4.63512536e-06, 3.86112005e-04,
+	-8.78425519e-05, -3.86667076e-04, 1.85587002e-04, 3.63558499e-04,
+	-2.83098417e-04, -3.15561793e-04, 3.74282646e-04, 2.42888417e-04,
+	-4.52776509e-04, -1.47326574e-04, 5.12324649e-04, 3.22951024e-05,
+	-5.47188618e-04, 9.72018451e-05, 5.52564915e-04, -2.34726347e-04,
+	-5.24985821e-04, 3.72665260e-04, 4.62675478e-04, -5.02589637e-04,
+	-3.65833935e-04, 6.15701782e-04, 2.36823960e-04, -7.03349778e-04,
+	-8.02393165e-05, 7.57583111e-04, -9.71611143e-05, -7.71717920e-04,
+	2.86661869e-04, 7.40876908e-04, -4.77942212e-04, -6.62467401e-04,
+	6.59561263e-04, 5.36561669e-04, -8.19558690e-04, -3.66146652e-04,
+	9.46143761e-04, 1.57215578e-04, -1.02843758e-03, 8.13184976e-05,
+	1.05722691e-03, -3.37897710e-04, -1.02568373e-03, 5.98782557e-04,
+	9.30002745e-04, -8.48691030e-04, -7.69910292e-04, 1.07158952e-03,
+	5.49002060e-04, -1.25159989e-03, -2.74874103e-04, 1.37397694e-03,
+	-4.09785183e-05, -1.42610241e-03, 3.83508980e-04, 1.39843619e-03,
+	-7.34711335e-04, -1.28536346e-03, 1.07444304e-03, 1.08587738e-03,
+	-1.38144663e-03, -8.04042891e-04, 1.63452530e-03, 4.49195404e-04,
+	-1.81381423e-03, -3.58410884e-05, 1.90207936e-03, -4.16759553e-04,
+	-1.88596820e-03, 8.85325372e-04, 1.75713451e-03, -1.34358733e-03,
+	-1.51316022e-03, 1.76358298e-03, 1.15820417e-03, -2.11715705e-03,
+	-7.03318153e-04, 2.37759630e-03, 1.66385843e-04, -2.52131382e-03,
+	4.28340988e-04, 2.52948856e-03, -1.05111309e-03, -2.38956216e-03,
+	1.66794201e-03, 2.09649608e-03, -2.24220338e-03, -1.65369917e-03,
+	2.73651959e-03, 1.07354823e-03, -3.11483622e-03, -3.77441958e-04,
+	3.34458955e-03, -4.04648995e-04, -3.39885070e-03, 1.23514762e-03,
+	3.25832557e-03, -2.07033548e-03, -2.91309023e-03, 2.86227221e-03,
+	2.36394815e-03, -3.56109704e-03, -1.62330935e-03, 4.11761474e-03,
+	7.15511723e-04, -4.48604707e-03, 3.23470198e-04, 4.62681556e-03,
+	-1.44695369e-03, -4.50921193e-03, 2.59910587e-03, 4.11381148e-03,
+	-3.71708995e-03, -3.43449056e-03, 4.73372536e-03, 2.47992424e-03,
+	-5.58055699e-03, -1.27446169e-03, 6.19120300e-03, -1.41694013e-04,
+	-6.50483039e-03, 1.71304059e-03, 6.46959571e-03, -3.37006573e-03,
+	-6.04588412e-03, 5.03122929e-03, 5.20918619e-03, -6.60555391e-03,
+	-3.95246757e-03, 7.99569701e-03, 2.28791253e-03, -9.10133462e-03,
+	-2.47959226e-04, 9.82264599e-03, -2.11440854e-03, -1.00636435e-02,
+	4.72608780e-03, 9.73503982e-03, -7.49489946e-03, -8.75626940e-03,
+	1.03110431e-02, 7.05615724e-03, -1.30486071e-02, -4.57149576e-03,
+	1.55665319e-02, 1.24232517e-03, -1.77079654e-02, 2.99827942e-03,
+	1.92960195e-02, -8.24435935e-03, -2.01218063e-02, 1.46571090e-02,
+	1.99152574e-02, -2.25496144e-02, -1.82738486e-02, 3.25869980e-02,
+	1.44728067e-02, -4.63427809e-02, -6.86475131e-03, 6.82801391e-02,
+	-9.70054537e-03, -1.16664864e-01, 6.51645013e-02, 4.33944596e-01,
+	5.07634286e-01, 1.81564245e-01, -9.87544308e-02, -5.67555651e-02,
+	6.34521854e-02, 2.34323346e-02, -4.80070591e-02, -7.34263633e-03,
+	3.79504140e-02, -2.15192538e-03, -3.00964418e-02, 8.17462524e-03,
+	2.34043032e-02, -1.19834406e-02, -1.74809774e-02, 1.42018502e-02,
+	1.21799196e-02, -1.51968864e-02, -7.45947925e-03, 1.52209735e-02,
+	3.32271743e-03, -1.44720029e-02, 2.11903901e-04, 1.31203510e-02,
+	-3.12620084e-03, -1.13209143e-02, 5.41104311e-03, 9.21778808e-03,
+	-7.07114677e-03, -6.94516748e-03, 8.12728362e-03, 4.62633107e-03,
+	-8.61665738e-03, -2.37175853e-03, 8.59190779e-03, 2.77026092e-04,
+	-8.11907404e-03, 1.57910726e-03, 7.27479061e-03, -3.13615412e-03,
+	-6.14296130e-03, 4.35272617e-03, 4.81114190e-03, -5.20664498e-03,
+	-3.36684852e-03, 5.69431042e-03, 1.89399189e-03, -5.82935386e-03,
+	-4.69616493e-04, 5.64064792e-03, -8.38903549e-04, -5.16978012e-03,
+	1.97609229e-03, 4.46812432e-03, -2.89993926e-03, -3.59366111e-03,
+	3.58276038e-03, 2.60770632e-03, -4.01134444e-03, -1.57170566e-03,
+	4.18641424e-03, 5.44243835e-04, -4.12146454e-03, 4.21600663e-04,
+	3.84106780e-03, -1.28044710e-03, -3.37876111e-03, 1.99627060e-03,
+	2.77464312e-03, -2.54347770e-03, -2.07281793e-03, 2.90738250e-03,
+	1.31882328e-03, -3.08409781e-03, -5.57173428e-04, 3.07988486e-03,
+	-1.70865852e-04, -2.91003035e-03, 8.29171850e-04, 2.59734008e-03,
+	-1.38825361e-03, -2.17035298e-03, 1.82628497e-03, 1.66138739e-03,
+	-2.12965933e-03, -1.10453359e-03, 2.29306983e-03, 5.33701942e-04,
+	-2.31914393e-03, 1.91738374e-05, 2.21768285e-03, -5.25693495e-04,
+	-2.00457449e-03, 9.62240919e-04, 1.70046119e-03, -1.31088322e-03,
+	-1.32925178e-03, 1.55989494e-03, 9.16569497e-04, -1.70390604e-03,
+	-4.88224770e-04, 1.74369289e-03, 6.87944016e-05, -1.68564992e-03,
+	3.19622982e-04, 1.54099427e-03, -6.58419797e-04, -1.32476698e-03,
+	9.33222083e-04, 1.05470117e-03, -1.13434094e-03, -7.50029653e-04,
+	1.25692970e-03, 4.30303022e-04, -1.30086028e-03, -1.14283074e-04,
+	1.27034721e-03, -1.81032198e-04, -1.17335948e-03, 4.41207620e-04,
+	1.02086983e-03, -6.54962563e-04, -8.25996246e-04, 8.14538239e-04,
+	6.03092516e-04, -9.15837448e-04, -3.66843401e-04, 9.58346874e-04,
+	1.31415242e-04, -9.44863687e-04, 9.02940955e-05, 8.81057699e-04,
+	-2.87271240e-04, -7.74907374e-04, 4.50845005e-04, 6.36052197e-04,
+	-5.74972506e-04, -4.75105378e-04, 6.56351458e-04, 3.02969650e-04,
+	-6.94366608e-04, -1.30195263e-04, 6.90887318e-04, -3.35863359e-05,
+	-6.49940513e-04, 1.80126819e-04, 5.77288553e-04, -3.02905115e-04,
+	-4.79944645e-04, 3.97341740e-04, 3.65659367e-04, -4.60882127e-04,
+	-2.42410724e-04, 4.92955574e-04, 1.17927186e-04, -4.94823198e-04,
+	7.31330181e-07, 4.69333676e-04, -1.07515144e-04, -4.20609401e-04,
+	1.97636093e-04, 3.53687811e-04, -2.67721834e-04, -2.74143127e-04,
+	3.15872987e-04, 1.87712634e-04, -3.41628725e-04, -9.99492227e-05,
+	3.45851441e-04, 1.59183077e-05, -3.30544952e-04, 6.00470454e-05,
+	2.98623394e-04, -1.24523778e-04, -2.53649348e-04, 1.75105156e-04,
+	1.99559818e-04, -2.10436339e-04, -1.40397683e-04, 2.30184025e-04,
+	8.00642100e-05, -2.34948552e-04, -2.21054327e-05, 2.26129515e-04,
+	-3.04581307e-05, -2.05757733e-04, 7.52525187e-05, 1.76307187e-04,
+	-1.10619844e-04, -1.40500422e-04, 1.35637406e-04, 1.01119936e-04,
+	-1.50090507e-04, -6.08364535e-05, 1.54405547e-04, 2.20628075e-05,
+	-1.49551725e-04, 1.31603655e-05, 1.36920795e-04, -4.32435116e-05,
+	-1.18194684e-04, 6.70906467e-05, 9.52104914e-05, -8.41068398e-05,
+	-6.98315403e-05, 9.41741428e-05, 4.38318294e-05, -9.76010359e-05,
+	-1.87995723e-05, 9.50515730e-05, -3.93632164e-06, -8.74610172e-05,
+	2.33548652e-05, 7.59448554e-05, -3.87665638e-05, -6.17077196e-05,
+	4.98134145e-05, 4.59580056e-05, -5.64481568e-05, -2.98329355e-05,
+	5.88966110e-05, 1.43375844e-05, -5.76075860e-05, -3.00063590e-07,
+	5.31951150e-05, -1.16562612e-05, -4.63777094e-05, 2.11238621e-05,
+	3.79189464e-05, -2.79068531e-05, -2.85730913e-05, 3.20037464e-05,
+	1.90386603e-05, -3.35799885e-05, -9.92194139e-06, 3.29334314e-05,
+	1.71156491e-06, -3.04559651e-05, 5.23566324e-06, 2.65943850e-05,
+	-1.06982444e-05, -2.18132174e-05, 1.45840134e-05, 1.65617386e-05,
+	-1.69164216e-05, -1.12468365e-05, 1.78150918e-05, 6.21274405e-06,
+	-1.74727876e-05, -1.72805217e-06, 1.61308943e-05, -2.02014715e-06,
+	-1.40553272e-05, 4.92562266e-06, 1.15144845e-05, -6.95687259e-06,
+	-8.76049067e-06, 8.14675321e-06, 6.01456520e-06, -8.57924502e-06,
+	-3.45693234e-06, 8.37474230e-06, 1.22130134e-06, -7.67515749e-06,
+	6.06394106e-07, 6.62995520e-06, -1.98557514e-06, -5.38399612e-06,
+	2.91568078e-06, 4.06780373e-06, -3.42878303e-06, -2.79059140e-06,
+	3.58104458e-06, 1.63612590e-06, -3.44386094e-06, -6.61274069e-07,
+	3.09542208e-06, -1.03104626e-07, -2.61328076e-06, 6.49387254e-07,
+	2.06834236e-06, -9.89080215e-07, -1.52051147e-06, 1.14793742e-06,
+	1.01605958e-06, -1.16083740e-06, -5.86627226e-07, 1.06688541e-06,
+	2.49653628e-07, -9.05111530e-07, -9.94191347e-09, 7.11023963e-07,
+	-1.37979668e-07, -5.14160871e-07, 2.07051435e-07, 3.36673900e-07,
+	1.34133804e-07, 3.92907192e-07, -2.90972361e-07, -4.49253965e-07,
+	5.03951508e-07, 4.49934816e-07, -7.64966231e-07, -3.69657559e-07,
+	1.05661106e-06, 1.84965816e-07, -1.35157944e-06, 1.22425109e-07,
+	1.61303550e-06, -5.62035288e-07, -1.79613579e-06, 1.13109754e-06,
+	1.85079452e-06, -1.81149104e-06, -1.72567742e-06, 2.56754778e-06,
+	1.37328210e-06, -3.34514334e-06, -7.55827033e-07, 4.07243750e-06,
+	-1.48462988e-07, -4.66254030e-06, 1.33920459e-06, 5.01824711e-06,
+	-2.78845576e-06, -5.03881720e-06, 4.43673305e-06, 4.62857407e-06,
+	-6.19110416e-06, -3.70689541e-06, 7.92594502e-06, 2.21895416e-06,
+	-9.48681622e-06, -1.46387076e-07, 1.06977159e-05, -2.48307423e-06,
+	-1.13717115e-05, 5.58805563e-06, 1.13246570e-05, -9.02912354e-06,
+	-1.03913811e-05, 1.26084575e-05, 8.44341261e-06, -1.60743853e-05,
+	-5.40701979e-06, 1.91312710e-05, 1.28010590e-06, -2.14548801e-05,
+	3.85364417e-06, 2.27129081e-05, -9.81500664e-06, -2.25898808e-05,
+	1.63253982e-05, 2.08151494e-05, -2.30103028e-05, -1.71922465e-05,
+	2.94108795e-05, 1.16274868e-05, -3.50041722e-05, -4.15542497e-06,
+	3.92317244e-05, -5.04133361e-06, -4.15357055e-05, 1.56204101e-05,
+	4.14009293e-05, -2.70781933e-05, -3.84004470e-05, 3.87603448e-05,
+	3.22417728e-05, -4.98852960e-05, -2.28103269e-05, 5.95809145e-05,
+	1.02063990e-05, -6.69335440e-05, 5.22810056e-06, 7.10475671e-05,
+	-2.28965866e-05, -7.11125924e-05, 4.19513849e-05, 6.64743939e-05,
+	-6.13160645e-05, -5.67049237e-05, 7.97275162e-05, 4.16661546e-05,
+	-9.57974566e-05, -2.15622612e-05, 1.08091567e-04, -3.02521984e-06,
+	-1.15222955e-04, 3.11240718e-05, 1.15955152e-04, -6.13837837e-05,
+	-1.09308567e-04, 9.21161380e-05, 9.46632797e-05, -1.21364792e-04,
+	-7.18504488e-05, 1.47002672e-04, 4.12244389e-05, -1.66853878e-04,
+	-3.70818917e-06, 1.78834649e-04, -3.91946809e-05, -1.81105961e-04,
+	8.54259718e-05, 1.72228601e-04, -1.32440066e-04, -1.51310326e-04,
+	1.77312477e-04, 1.18134040e-04, -2.16887284e-04, -7.32559738e-05,
+	2.47957953e-04, 1.80636579e-05, -2.67473156e-04, 4.52149254e-05,
+	2.72756497e-04, -1.13557214e-04, -2.61726911e-04, 1.83250126e-04,
+	2.33104975e-04, -2.50051843e-04, -1.86589720e-04, 3.09406907e-04,
+	1.22990878e-04, -3.56706146e-04, -4.43028826e-05, 3.87579006e-04,
+	-4.62905959e-05, -3.98202447e-04, 1.44489307e-04, 3.85607732e-04,
+	-2.45029675e-04, -3.47964719e-04, 3.41917030e-04, 2.84822655e-04,
+	-4.28729806e-04, -1.97287208e-04, 4.98983256e-04, 8.81157010e-05,
+	-5.46535053e-04, 3.82839578e-05, 5.66010690e-04, -1.75960229e-04,
+	-5.53223133e-04, 3.17634397e-04, 5.05559091e-04, -4.55023370e-04,
+	-4.22303788e-04, 5.79258458e-04, 3.04877446e-04, -6.81382605e-04,
+	-1.56959870e-04, 7.52901824e-04, -1.55154668e-05, -7.86360898e-04,
+	2.04509784e-04, 7.75909082e-04, -4.00173734e-04, -7.17819073e-04,
+	5.91283468e-04, 6.10922200e-04, -7.65803558e-04, -4.56924777e-04,
+	9.11552957e-04, 2.60574992e-04, -1.01694162e-03, -2.96564396e-05,
+	1.07173811e-03, -2.25206764e-04, -1.06782309e-03, 4.90937858e-04,
+	9.99880789e-04, -7.52581183e-04, -8.65980081e-04, 9.94042546e-04,
+	6.67999854e-04, -1.19896496e-03, -4.11859017e-04, 1.35169758e-03,
+	1.07520391e-04, -1.43830642e-03, 2.31250937e-04, 1.44756869e-03,
+	-5.87380723e-04, -1.37188885e-03, 9.41221176e-04, 1.20807431e-03,
+	-1.27150465e-03, -9.57912369e-04, 1.55647581e-03, 6.28497176e-04,
+	-1.77514878e-03, -2.32266888e-04, 1.90862408e-03, -2.13274741e-04,
+	-1.94139161e-03, 6.86161068e-04, 1.86254100e-03, -1.16087967e-03,
+	-1.66680031e-03, 1.60957460e-03, 1.35532825e-03, -2.00348534e-03,
+	-9.36194001e-04, 2.31455685e-03, 4.24492306e-04, -2.51713977e-03,
+	1.57941193e-04, 2.58968924e-03, -7.83228525e-04, -2.51636393e-03,
+	1.41855324e-03, 2.28842585e-03, -2.02763697e-03, -1.90534583e-03,
+	2.57253250e-03, 1.37552982e-03, -3.01565547e-03, -7.16596877e-04,
+	3.32195783e-03, -4.48398668e-05, -3.46113198e-03, 8.73913135e-04,
+	3.40972538e-03, -1.72875909e-03, -3.15304279e-03, 2.56226034e-03,
+	2.68671696e-03, -3.32421372e-03, -2.01783986e-03, 3.96383517e-03,
+	1.16556327e-03, -4.43249100e-03, -1.61101454e-04, 4.68652606e-03,
+	-9.52903595e-04, -4.69004726e-03, 2.12366188e-03, 4.41751587e-03,
+	-3.29013396e-03, -3.85600472e-03, 4.38548847e-03, 3.00698739e-03,
+	-5.34002643e-03, -1.88754538e-03, 6.08445184e-03, 5.30905441e-04,
+	-6.55334492e-03, 1.01374833e-03, 6.68867814e-03, -2.68220503e-03,
+	-6.44320742e-03, 4.39687634e-03, 5.78357215e-03, -6.06909718e-03,
+	-4.69294904e-03, 7.60196545e-03, 3.17312596e-03, -8.89356380e-03,
+	-1.24589412e-03, 9.84036045e-03, -1.04630055e-03, -1.03405374e-02,
+	3.64045140e-03, 1.02969353e-02, -6.45376486e-03, -9.61922279e-03,
+	9.38495659e-03, 8.22476431e-03, -1.23157798e-02, -6.03741591e-03,
+	1.51122853e-02, 2.98299431e-03, -1.76249324e-02, 1.02086137e-03,
+	1.96859061e-02, -6.08502702e-03, -2.11002630e-02, 1.23896565e-02,
+	2.16231940e-02, -2.02707645e-02, -2.09033286e-02, 3.04245999e-02,
+	1.83308528e-02, -4.44732686e-02, -1.25584704e-02, 6.69608715e-02,
+	-5.34018208e-04, -1.16142931e-01, 4.41023292e-02, 4.14837452e-01,
+	5.17323908e-01, 2.06162242e-01, -9.08174020e-02, -6.57097411e-02,
+	6.01221024e-02, 2.94030367e-02, -4.67056300e-02, -1.18881447e-02,
+	3.78103476e-02, 1.43267122e-03, -3.06954970e-02, 5.35411301e-03,
+	2.44856538e-02, -9.81989196e-03, -1.88645934e-02, 1.26217410e-02,
+	1.37283156e-02, -1.41386054e-02, -9.06289214e-03, 1.46256425e-02,
+	4.89228153e-03, -1.42797098e-02, -1.25257880e-03, 1.32690481e-02,
+	-1.82205599e-03, -1.17467472e-02, 4.30750933e-03, 9.85621769e-03,
+	-6.19432717e-03, -7.73251019e-03, 7.48999689e-03, 5.50147041e-03,
+	-8.21952007e-03, -3.27785073e-03, 8.42465947e-03, 1.16306653e-03,
+	-8.16214196e-03, 7.56956964e-04, 7.50105699e-03, -2.41355105e-03,
+	-6.51967457e-03, 3.75649033e-03, 5.30190000e-03, -4.75448657e-03,
+	-3.93357588e-03, 5.39494142e-03, 2.49883144e-03, -5.68296501e-03,
+	-1.07666284e-03, 5.63971415e-03, -2.62094938e-04, -5.30014254e-03,
+	1.45727233e-03, 4.71028543e-03, -2.46124692e-03, -3.92422223e-03,
+	3.24014030e-03, 3.00087269e-03, -3.77430534e-03, -2.00078487e-03,
+	4.05811650e-03, 9.83067544e-04, -4.09911029e-03, -2.60561216e-06,
+	3.91655369e-03, -8.92323190e-04, -3.53954348e-03, 1.66193795e-03,
+	3.00475789e-03, -2.27628776e-03, -2.35399341e-03, 2.71599712e-03,
+	1.63162321e-03, -2.97242356e-03, -8.82110216e-04, 3.04725793e-03,
+	1.47697613e-04, -2.95162429e-03, 5.33617076e-04, 2.70475906e-03,
+	-1.12973881e-03, -2.33236607e-03, 1.61570195e-03, 1.86475516e-03,
+	-1.97443258e-03, -1.33487674e-03, 2.19703833e-03, 7.76362934e-04,
+	-2.28264315e-03, -2.21678585e-04, 2.23780786e-03, -2.99527084e-04,
+	-2.07559644e-03, 7.61794317e-04, 1.81436338e-03, -1.14489783e-03,
+	-1.47634742e-03, 1.43453020e-03, 1.08616155e-03, -1.62261267e-03,
+	-6.69268860e-04, 1.70724354e-03, 2.50528378e-04, -1.69231348e-03,
+	1.47114611e-04, 1.58683333e-03, -5.03732582e-04, -1.40403263e-03,
+	8.03268483e-04, 1.16029585e-03, -1.03410879e-03, -8.74007207e-04,
+	1.18936619e-03, 5.64375301e-04, -1.26687803e-03, -2.50304549e-04,
+	1.26894250e-03, -5.06271469e-05, -1.20182715e-03, 3.23035329e-04,
+	1.07509512e-03, -5.54403874e-04, -9.00801089e-04, 7.35544794e-04,
+	6.92612470e-04, -8.60833888e-04, -4.64911463e-04, 9.28226629e-04,
+	2.31930417e-04, -9.39070913e-04, -6.96693319e-06, 8.97743619e-04,
+	-1.98282989e-04, -8.11145965e-04, 3.74245276e-04, 6.88098007e-04,
+	-5.13823785e-04, -5.38675259e-04, 6.12585122e-04, 3.73530297e-04,
+	-6.68775855e-04, -2.03239660e-04, 6.83185180e-04, 3.77115584e-05,
+	-6.58874002e-04, 1.14316497e-04, 6.00797469e-04, -2.45668765e-04,
+	-5.15351992e-04, 3.50997893e-04, 4.09879592e-04, -4.26922416e-04,
+	-2.92162169e-04, 4.72038400e-04, 1.69936086e-04, -4.86815682e-04,
+	-5.04536503e-05, 4.73395048e-04, -5.98869992e-05, -4.35307160e-04,
+	1.55828031e-04, 3.77136835e-04, -2.33444894e-04, -3.04157465e-04,
+	2.90243299e-04, 2.21959915e-04, -3.25163362e-04, -1.36098375e-04,
+	3.38499348e-04, 5.17725747e-05, -3.31747747e-04, 2.64381891e-05,
+	3.07399539e-04, -9.47783267e-05, -2.68694402e-04, 1.50450445e-04,
+	2.19355258e-04, -1.91679705e-04, -1.63320973e-04, 2.17711085e-04,
+	1.04493460e-04, -2.28746375e-04, -4.65129698e-05, 2.25830743e-04,
+	-7.42770418e-06, -2.10700839e-04, 5.47228289e-05, 1.85607549e-04,
+	-9.34434103e-05, -1.53126813e-04, 1.22376676e-04, 1.15971239e-04,
+	-1.41018211e-04, -7.68139585e-05, 1.49522231e-04, 3.81341902e-05,
+	-1.48617524e-04, -2.09167163e-06, 1.39497920e-04, -2.95654414e-05,
+	-1.23696837e-04, 5.55571884e-05, 1.02955398e-04, -7.50933502e-05,
+	-7.90930340e-05, 8.78625116e-05, 5.38883262e-05, -9.39929917e-05,
+	-2.89763864e-05, 9.39912979e-05, 5.76728717e-06, -8.86645587e-05,
+	1.46117644e-05, 7.90336864e-05, -3.13496462e-05, -6.62438491e-05,
+	4.39607472e-05, 5.14782507e-05, -5.22728502e-05, -3.58803077e-05,
+	5.63968509e-05, 2.04881753e-05, -5.66824752e-05, -6.18430326e-06,
+	5.36645730e-05, -6.33859730e-06, -4.80046353e-05, 1.65950377e-05,
+	4.04319289e-05, -2.43086544e-05, -3.16881333e-05, 2.94004095e-05,
+	2.24786487e-05, -3.19656433e-05, -1.34329051e-05, 3.22429586e-05,
+	5.07510504e-06, -3.05780825e-05, 2.19405265e-06, 2.73857888e-05,
+	-8.10493147e-06, -2.31126942e-05, 1.25167578e-05, 1.82033128e-05,
+	-1.54071621e-05, -1.30712152e-05, 1.68553267e-05, 8.07653876e-06,
+	-1.70207989e-05, -3.51048648e-06, 1.61200463e-05, -4.13122163e-07,
+	-1.44027074e-05, 3.55968949e-06, 1.21292372e-05, -5.86991349e-06,
+	-9.55131166e-06, 7.35123431e-06, 6.89596493e-06, -8.06596029e-06,
+	-4.35402270e-06, 8.11743122e-06, 2.07300470e-06, -7.63552216e-06,
+	-1.54315612e-07, 6.76264723e-06, -1.34574450e-06, -5.64121369e-06,
+	2.41183288e-06, 4.40322560e-06, -3.06309466e-06, -3.16246842e-06,
+	3.34523721e-06, 2.00944396e-06, -3.32199204e-06, -1.00898768e-06,
+	3.06672400e-06, 2.00303566e-07, -2.65481688e-06, 4.00996030e-07,
+	2.15730358e-06, -7.99350814e-07, -1.63603547e-06, 1.01475749e-06,
+	1.14051400e-06, -1.07785261e-06, -7.06352422e-07, 1.02505432e-06,
+	3.55206504e-07, -8.94159812e-07, -9.59169677e-08, 7.20691643e-07,
+	-7.34531035e-08, -5.35173136e-07, 1.63026511e-07, 3.61403001e-07,
+	9.53442130e-08, 4.08291622e-07, -2.42205211e-07, -4.83694886e-07,
+	4.49216098e-07, 5.09720840e-07, -7.11039772e-07, -4.59981272e-07,
+	1.01309008e-06, 3.08868542e-07, -1.33060425e-06, -3.48461859e-08,
+	1.62863729e-06, -3.75891325e-07, -1.86318537e-06, 9.25699408e-07,
+	1.98356941e-06, -1.60208297e-06, -1.93610731e-06, 2.37503601e-06,
+	1.66897874e-06, -3.19555166e-06, -1.13804879e-06, 3.99570199e-06,
+	3.13276663e-07, -4.69061133e-06, 8.14793037e-07, 5.18252720e-06,
+	-2.22906349e-06, -5.36703264e-06, 3.88111583e-06, 5.14125098e-06,
+	-5.68832357e-06, -4.41368212e-06, 7.53349281e-06, 3.11509293e-06,
+	-9.26755747e-06, -1.20968410e-06, 1.07156802e-05, -1.29440966e-06,
+	-1.16868697e-05, 4.33633815e-06, 1.19869347e-05, -7.79656005e-06,
+	-1.14342742e-05, 1.14947065e-05, 9.87766986e-06, -1.51921654e-05,
+	-7.21493666e-06, 1.86000176e-05, 3.41101755e-06, -2.13926097e-05,
+	1.48607746e-06, 2.32266279e-05, -7.33317488e-06, -2.37650577e-05,
+	1.38853282e-05, 2.27049166e-05, -2.07961564e-05, -1.98071597e-05,
+	2.76262613e-05, 1.49267319e-05, -3.38603834e-05, -8.04041251e-06,
+	3.89333604e-05, -7.30091182e-07, -4.22642673e-05, 1.11023558e-05,
+	4.32973802e-05, -2.26271270e-05, -4.15478684e-05, 3.46938457e-05,
+	3.66494465e-05, -4.65491731e-05, -2.84006612e-05, 5.73290715e-05,
+	1.68061133e-05, -6.61040471e-05, -2.10877109e-06, 7.19361043e-05,
+	-1.51903340e-05, -7.39448788e-05, 3.43283118e-05, 7.13793792e-05,
+	-5.42950612e-05, -6.36908597e-05, 7.38678849e-05, 5.06016584e-05,
+	-9.16663231e-05, -3.21644420e-05, 1.06226009e-04, 8.80626762e-06,
+	-1.16088803e-04, 1.86477549e-05, 1.19904919e-04, -4.89756081e-05,
+	-1.16541348e-04, 8.05875034e-05, 1.05189701e-04, -1.11584584e-04,
+	-8.54657705e-05, 1.39846854e-04, 5.74927530e-05, -1.63147878e-04,
+	-2.19602412e-05, 1.79291588e-04, -1.98481584e-05, -1.86264437e-04,
+	6.60643652e-05, 1.82394218e-04, -1.14286398e-04, -1.66505429e-04,
+	1.61671452e-04, 1.38060062e-04, -2.05070156e-04, -9.72724772e-05,
+	2.41197714e-04, 4.51874734e-05, -2.66834572e-04, 1.62880126e-05,
+	2.79046414e-04, -8.44070416e-05, -2.75410855e-04, 1.55663265e-04,
+	2.54236299e-04, -2.25931127e-04, -2.14757438e-04, 2.90662913e-04,
+	1.57291737e-04, -3.45135751e-04, -8.33422069e-05, 3.84737581e-04,
+	-4.36614914e-06, -4.05277336e-04, 1.01925753e-04, 4.03301445e-04,
+	-2.04367164e-04, -3.76396465e-04, 3.05861689e-04, 3.23456571e-04,
+	-4.00001130e-04, -2.44894744e-04, 4.80144341e-04, 1.42778143e-04,
+	-5.39814822e-04, -2.08711722e-05, 5.73128714e-04, -1.15425822e-04,
+	-5.75228529e-04, 2.59248620e-04, 5.42695206e-04, -4.02551817e-04,
+	-4.73909865e-04, 5.36494735e-04, 3.69337183e-04, -6.51915850e-04,
+	-2.31704732e-04, 7.39873912e-04, 6.60569258e-05, -7.92227634e-04,
+	1.20331684e-04, 8.02220801e-04, -3.18191447e-04, -7.65036257e-04,
+	5.16639894e-04, 6.78280953e-04, -7.03700703e-04, -5.42365218e-04,
+	8.66939228e-04, 3.60742856e-04, -9.94185293e-04, -1.39984526e-04,
+	1.07430595e-03, -1.10335055e-04, -1.09798452e-03, 3.77945564e-04,
+	1.05845806e-03, -6.48383220e-04, -9.52164005e-04, 9.05672485e-04,
+	7.79248212e-04, -1.13316080e-03, -5.43891129e-04, 1.31446823e-03,
+	2.54416635e-04, -1.43450360e-03, 7.68415965e-05, 1.48049070e-03,
+	-4.33928430e-04, -1.44294304e-03, 7.97908001e-04, 1.31652356e-03,
+	-1.14773898e-03, -1.10072804e-03, 1.46135082e-03, 8.00336378e-04,
+	-1.71687280e-03, -4.25585884e-04, 1.89395442e-03, -7.96638298e-06,
+	-1.97510596e-03, 4.79908950e-04, 1.94698079e-03, -9.65767492e-04,
+	-1.80151907e-03, 1.43810168e-03, 1.53687426e-03, -1.86786679e-03,
+	-1.15805106e-03, 2.22598089e-03, 6.77194880e-04, -2.48502230e-03,
+	-1.13489099e-04, 2.62096850e-03, -5.07364141e-04, -2.61487949e-03,
+	1.15408145e-03, 2.45442433e-03, -1.79113198e-03, -2.13515192e-03,
+	2.38042122e-03, 1.66141452e-03, -2.88325550e-03, -1.04686609e-03,
+	3.26249734e-03, 3.14476181e-04, -3.48480508e-03, 5.03976728e-04,
+	3.52283845e-03, -1.36894200e-03, -3.35730621e-03, 2.23464450e-03,
+	2.97873261e-03, -3.05109489e-03, -2.38882743e-03, 3.76648609e-03,
+	1.60135877e-03, -4.32987413e-03, -6.42448885e-04, 4.69402049e-03,
+	-4.49760480e-04, -4.81825781e-03, 1.62609596e-03, 4.67123218e-03,
+	-2.82798310e-03, -4.23337473e-03, 3.98967458e-03, 3.49896218e-03,
+	-5.04099774e-03, -2.47764201e-03, 5.91051230e-03, 1.19532071e-03,
+	-6.52894308e-03, 3.05655687e-04, 6.83273285e-03, -1.96706383e-03,
+	-6.76754842e-03, 3.71610185e-03, 6.29156989e-03, -5.46737506e-03,
+	-5.37839963e-03, 7.12547240e-03, 4.01944398e-03, -8.58799070e-03,
+	-2.22564790e-03, 9.74881423e-03, 2.84999232e-05, -1.05014042e-02,
+	2.51972584e-03, 1.07417884e-02, -5.34646217e-03, -1.03708539e-02,
+	8.35996545e-03, 9.29540310e-03, -1.14508343e-02, -7.42718078e-03,
+	1.44935334e-02, 4.67857988e-03, -1.73472241e-02, -9.52688171e-04,
+	1.98546020e-02, -3.87701184e-03, -2.18361118e-02, 1.00076801e-02,
+	2.30735815e-02, -1.77945749e-02, -2.32679143e-02, 2.79573395e-02,
+	2.19243297e-02, -4.21484178e-02, -1.79905114e-02, 6.49413216e-02,
+	8.33487422e-03, -1.14381998e-01, 2.40454532e-02, 3.94543632e-01,
+	5.25154173e-01, 2.30873450e-01, -8.13945922e-02, -7.42671630e-02,
+	5.60146610e-02, 3.51862968e-02, -4.48533135e-02, -1.63794734e-02,
+	3.72444579e-02, 5.05029167e-03, -3.09585156e-02, 2.44186111e-03,
+	2.53045506e-02, -7.52576393e-03, -2.00499258e-02, 1.08873748e-02,
+	1.51357260e-02, -1.29145779e-02, -1.05765701e-02, 1.38630922e-02,
+	6.41740811e-03, -1.39269445e-02, -2.71177867e-03, 1.32706188e-02,
+	-4.90427771e-04, -1.20438668e-02, 3.15029282e-03, 1.03879438e-02,
+	-5.24423482e-03, -8.43735020e-03, 6.76632906e-03, 6.31917743e-03,
+	-7.72906553e-03, -4.15124026e-03, 8.16284435e-03, 2.03972254e-03,
+	-8.11443621e-03, -7.68106088e-05, 7.64461115e-03, -1.66136433e-03,
+	-6.82513502e-03, 3.11625857e-03, 5.73533476e-03, -4.24778700e-03,
+	-4.45843449e-03, 5.03446285e-03, 3.07785977e-03, -5.47279264e-03,
+	-1.67369619e-03, 5.57596129e-03, 3.19470386e-04, -5.37188391e-03,
+	9.20603749e-04, 4.90073379e-03, -1.99380097e-03, -4.21208085e-03,
+	2.86040492e-03, 3.36179082e-03, -3.49453151e-03, -2.40884195e-03,
+	3.88425130e-03, 1.41221435e-03, -4.03104260e-03, -4.27996431e-04,
+	3.94863888e-03, -4.93164137e-04, -3.66136200e-03, 1.30816133e-03,
+	3.20205380e-03, -1.98300735e-03, -2.60973318e-03, 2.49383958e-03,
+	1.92711308e-03, -2.82734363e-03, -1.19811125e-03, 2.98060913e-03,
+	4.65481552e-04, -2.96046299e-03, 2.31320996e-04, 2.78234910e-03,
+	-8.57947242e-04, -2.46884304e-03, 1.38656147e-03, 2.04790388e-03,
+	-1.79680334e-03, -1.55097266e-03, 2.07628459e-03, 1.01102835e-03,
+	-2.22062636e-03, -4.60707021e-04, 2.23306761e-03, -6.94199303e-05,
+	-2.12369566e-03, 5.52327770e-04, 1.90836687e-03, -9.65718090e-04,
+	-1.60739790e-03, 1.29285413e-03, 1.24411470e-03, -1.52303137e-03,
+	-8.43348440e-04, 1.65168423e-03, 4.29964159e-04, -1.68014971e-03,
+	-2.75003143e-05, 1.61512614e-03, -3.43014260e-04, -1.46787936e-03,
+	6.64013963e-04, 1.25325894e-03, -9.22085029e-04, -9.88593274e-04,
+	1.10837085e-03, 6.92533888e-04, -1.21869289e-03, -3.83917368e-04,
+	1.25340222e-03, 8.07070345e-05, -1.21699043e-03, 2.00932415e-04,
+	1.11750057e-03, -4.47385629e-04, -9.65786614e-04, 6.48134018e-04,
+	7.74675192e-04, -7.96084929e-04, -5.58084620e-04, 8.87681191e-04,
+	3.30154593e-04, -9.22802333e-04, -1.04435145e-04, 9.04479805e-04,
+	-1.06823733e-04, -8.38457483e-04, 2.93249401e-04, 7.32635183e-04,
+	-4.46768672e-04, -5.96436669e-04, 5.61863281e-04, 4.40144678e-04,
+	-6.35657887e-04, -2.74243988e-04, 6.67849540e-04, 1.08809723e-04,
+	-6.60496075e-04, 4.70275806e-05, 6.17687665e-04, -1.85515712e-04,
+	-5.45130605e-04, 3.00596881e-04, 4.49675082e-04, -3.88097989e-04,
+	-3.38819332e-04, 4.45794996e-04, 2.20221172e-04, -4.73358754e-04,
+	-1.01244836e-04, 4.72196012e-04, -1.14335013e-05, -4.45204359e-04,
+	1.12143627e-04, 3.96463286e-04, -1.96450893e-04, -3.30885426e-04,
+	2.61292067e-04, 2.53852225e-04, -3.05018099e-04, -1.70857058e-04,
+	3.27349961e-04, 8.71762551e-05, -3.29258385e-04, -7.58494285e-06,
+	3.12781897e-04, -6.38696486e-05, -2.80799928e-04, 1.24029431e-04,
+	2.36778920e-04, -1.70717975e-04, -1.84509284e-04, 2.02765513e-04,
+	1.27849908e-04, -2.19971621e-04, -7.04948438e-05, 2.23014077e-04,
+	1.57740337e-05, -2.13314847e-04, 3.35033529e-05, 1.92875705e-04,
+	-7.51578217e-05, -1.64096594e-04, 1.07699035e-04, 1.29589589e-04,
+	-1.30337419e-04, -9.20002857e-05, 1.42952246e-04, 5.38467660e-05,
+	-1.46022798e-04, -1.73841261e-05, 1.40530833e-04, -1.54998490e-05,
+	-1.27843486e-04, 4.33548414e-05, 1.09586001e-04, -6.52034206e-05,
+	-8.75133355e-05, 8.05434099e-05, 6.33887271e-05, -8.93207870e-05,
+	-3.88760383e-05, 9.18781746e-05, 1.54510242e-05, -8.88849690e-05,
+	5.66508601e-06, 8.12556461e-05, -2.35481236e-05, -7.00627978e-05,
+	3.75897651e-05, 5.64510408e-05, -4.74942183e-05, -4.15571723e-05,
+	5.32556943e-05, 2.64409150e-05, -5.51204571e-05, -1.20293903e-05,
+	5.35377991e-05, -9.22809256e-07, -4.91044889e-05, 1.18573257e-05,
+	4.25071212e-05, -2.04200422e-05, -3.44663876e-05, 2.64548847e-05,
+	2.56866700e-05, -2.99856706e-05, -1.68135715e-05, 3.11887729e-05,
+	8.40114354e-06, -3.03596294e-05, -8.89689181e-07, 2.78761564e-05,
+	-5.40580600e-06, -2.41619349e-05, 1.02972911e-05, 1.96516810e-05,
+	-1.37165834e-05, -1.47610198e-05, 1.57013124e-05, 9.86201690e-06,
+	-1.63758252e-05, -5.26532591e-06, 1.59290885e-05, 1.20923006e-06,
+	-1.45915510e-05, 2.14466444e-06, 1.26127345e-05, -4.70976326e-06,
+	-1.02410176e-05, 6.46785510e-06, 7.70671474e-06, -7.45873952e-06,
+	-5.20915690e-06, 7.76742605e-06, 2.90808849e-06, -7.51020442e-06,
+	-9.19333175e-07, 6.82077738e-06, -6.85625268e-07, -5.83746568e-06,
+	1.87673933e-06, 4.69226341e-06, -2.65992279e-06, -3.50226453e-06,
+	3.06983583e-06, 2.36372161e-06, -3.16176613e-06, -1.34875563e-06,
+	3.00338192e-06, 5.04527478e-07, -2.66702088e-06, 1.45480880e-07,
+	2.22303159e-06, -5.98538612e-07, -1.73451805e-06, 8.68611736e-07,
+	1.25366828e-06, -9.81709604e-07, -8.19689946e-07, 9.71122361e-07,
+	4.58239675e-07, -8.72968029e-07, -1.82126831e-07, 7.22372594e-07,
+	-6.99858914e-09, -5.50498708e-07, 1.16300177e-07, 3.82529342e-07,
+	5.63128330e-08, 4.18821064e-07, -1.91632779e-07, -5.12160263e-07,
+	3.90374741e-07, 5.62916653e-07, -6.50007436e-07, -5.43919591e-07,
+	9.58908203e-07, 4.27722589e-07, -1.29512136e-06, -1.89811067e-07,
+	1.62597775e-06, -1.87713538e-07, -1.90880950e-06, 7.12262000e-07,
+	2.09292702e-06, -1.37706396e-06, -2.12292969e-06, 2.15807407e-06,
+	1.94330082e-06, -3.01192199e-06, -1.50409979e-06, 3.87533444e-06,
+	7.67420268e-07, -4.66639764e-06, 2.85855577e-07, 5.28792171e-06,
+	-1.64959474e-06, -5.63301938e-06, 3.28691538e-06, 5.59282442e-06,
+	-5.12636161e-06, -5.06606329e-06, 7.06043726e-06, 3.96997061e-06,
+	-8.94709604e-06, -2.25182484e-06, 1.06146279e-05, -9.98061168e-08,
+	-1.18701584e-05, 3.04515577e-06, 1.25116970e-05, -6.48580077e-06,
+	-1.23433532e-05, 1.02607492e-05, 1.11929945e-05, -1.41470555e-05,
+	-8.93129381e-06, 1.78657246e-05, 5.49081347e-06, -2.10933486e-05,
+	-8.83547601e-07, 2.34795187e-05, -4.78479051e-06, -2.46695781e-05,
+	1.13054583e-05, 2.43317811e-05, -1.83639452e-05, -2.21874088e-05,
+	2.55451208e-05, 1.80419277e-05, -3.23471570e-05, -1.18148959e-05,
+	3.82045514e-05, 3.56606413e-06, -4.25199067e-05, 6.48496655e-06,
+	4.47033824e-05, -1.79480644e-05, -4.42179733e-05, 3.02630739e-05,
+	4.06280455e-05, -4.27131835e-05, -3.36479342e-05, 5.44520802e-05,
+	2.31869424e-05, -6.45449032e-05, -9.38683069e-06, 7.20219613e-05,
+	-7.35209649e-06, -7.59430751e-05, 2.63598861e-05, 7.54693110e-05,
+	-4.67037687e-05, -6.99378847e-05, 6.72149505e-05, 5.89352030e-05,
+	-8.65361893e-05, -4.23624793e-05, 1.03189560e-04, 2.04881664e-05,
+	-1.15662262e-04, 6.01834183e-06, 1.22506735e-04, -3.60766467e-05,
+	-1.22449833e-04, 6.82127468e-05, 1.14504478e-04, -1.00606246e-04,
+	-9.80762404e-05, 1.31167870e-04, 7.30566788e-05, -1.57645702e-04,
+	-3.98952430e-05, 1.77756314e-04, -3.57960601e-07, -1.89334769e-04,
+	4.60451019e-05, 1.90495408e-04, -9.49341067e-05, -1.79793638e-04,
+	1.44295269e-04, 1.56377723e-04, -1.91020886e-04, -1.20118999e-04,
+	2.31784829e-04, 7.17091082e-05, -2.63235832e-04, -1.27138111e-05,
+	2.82215304e-04, -5.44252466e-05, -2.85987746e-04, 1.26446838e-04,
+	2.72469681e-04, -1.99387277e-04, -2.40441586e-04, 2.68757277e-04,
+	1.89726784e-04, -3.29773310e-04, -1.21321754e-04, 3.77634032e-04,
+	3.74639703e-05, -4.07828290e-04, 5.83739307e-05, 4.16457757e-04,
+	-1.61571079e-04, -4.00554479e-04, 2.66529189e-04, 3.58371983e-04,
+	-3.66924810e-04, -2.89628158e-04, 4.56034897e-04, 1.95679133e-04,
+	-5.27121992e-04, -7.96058664e-05, 5.73860025e-04, -5.38009546e-05,
+	-5.90777231e-04, 1.98166816e-04, 5.73689322e-04, -3.45772904e-04,
+	-5.20094078e-04, 4.87904945e-04, 4.29498315e-04, -6.15299604e-04,
+	-3.03649817e-04, 7.18669269e-04, 1.46650377e-04, -7.89279261e-04,
+	3.50684615e-05, 8.19545763e-04, -2.32918289e-04, -8.03618547e-04,
+	4.36478199e-04, 7.37910334e-04, -6.33964148e-04, -6.21534583e-04,
+	8.12827031e-04, 4.56615918e-04, -9.60453642e-04, -2.48442321e-04,
+	1.06493597e-03, 5.43546255e-06, -1.11586698e-03, 2.61075097e-04,
+	1.10511580e-03, -5.37277057e-04, -1.02753256e-03, 8.07490964e-04,
+	8.81533158e-04, -1.05495476e-03, -6.69517782e-04, 1.26274361e-03,
+	3.98083182e-04, -1.41478010e-03, -7.79982679e-05, 1.49688088e-03,
+	-2.76075397e-04, -1.49777900e-03, 6.46122557e-04, 1.41005795e-03,
+	-1.01156154e-03, -1.23093363e-03, 1.35025282e-03, 9.62824645e-04,
+	-1.63968621e-03, -6.13659414e-04, 1.85829019e-03, 1.96880487e-04,
+	-1.98679492e-03, 2.68878593e-04, 2.00957213e-03, -7.60450807e-04,
+	-1.91587084e-03, 1.25111520e-03, 1.70086757e-03, -1.71186609e-03,
+	-1.36645486e-03, 2.11292031e-03, 9.21701585e-04, -2.42539279e-03,
+	-3.82932758e-04, 2.62305644e-03, -2.26604916e-04, -2.68409075e-03,
+	8.77504241e-04, 2.59271794e-03, -1.53537408e-03, -2.34062453e-03,
+	2.16239542e-03, 1.92807137e-03, -2.71919716e-03, -1.36460636e-03,
+	3.16696943e-03, 6.69310492e-04, -3.46971386e-03, 1.29470413e-04,
+	3.59651549e-03, -9.94930697e-04, -3.52371285e-03, 1.88314051e-03,
+	3.23684019e-03, -2.74487676e-03, -2.73222070e-03, 3.52788492e-03,
+	2.01810126e-03, -4.17947996e-03, -1.11523753e-03, 4.64937153e-03,
+	5.68624192e-05, -4.89258005e-03, 1.11199962e-03, 4.87229856e-03,
+	-2.33587767e-03, -4.56255102e-03, 3.55082929e-03, 3.95050116e-03,
+	-4.68698136e-03, -3.03827817e-03, 5.67154044e-03, 1.84420579e-03,
+	-6.43214748e-03, -4.03348534e-04, 6.90042853e-03, -1.23267631e-03,
+	-7.01557723e-03, 2.99663316e-03, 6.72779728e-03, -4.80731722e-03,
+	-6.00143470e-03, 6.57183956e-03, 4.81764172e-03, -8.18842045e-03,
+	-3.17643531e-03, 9.54951144e-03, 1.09804616e-03, -1.05450094e-02,
+	1.37650403e-03, 1.10652574e-02, -4.18560437e-03, -1.10034341e-02,
+	7.24797379e-03, 1.02567847e-02, -1.04641425e-02, -8.72588731e-03,
+	1.37182045e-02, 6.31063880e-03, -1.68793236e-02, -2.90058972e-03,
+	1.98020398e-02, -1.64510484e-03, -2.23234780e-02, 7.53856145e-03,
+	2.42532244e-02, -1.51505662e-02, -2.53450803e-02, 2.52165697e-02,
+	2.52183193e-02, -3.94018475e-02, -2.31080311e-02, 6.22612037e-02,
+	1.68237300e-02, -1.11454570e-01, 5.09049815e-03, 3.73194129e-01,
+	5.31072995e-01, 2.55550457e-01, -7.04938647e-02, -8.23216514e-02,
+	5.11511701e-02, 4.07141459e-02, -4.24593672e-02, -2.07659613e-02,
+	3.62524715e-02, 8.66121349e-03, -3.08784035e-02, -5.30779515e-04,
+	2.58491458e-02, -5.12532889e-03, -2.10219927e-02, 9.01676071e-03,
+	1.63853582e-02, -1.15371906e-02, -1.19830159e-02, 1.29406820e-02,
+	7.88082291e-03, -1.34166424e-02, -4.14941141e-03, 1.31242055e-02,
+	8.54002917e-04, -1.22082802e-02, 1.95200729e-03, 1.08065133e-02,
+	-4.23109852e-03, -9.05145053e-03, 5.96394660e-03, 7.07008988e-03,
+	-7.15035246e-03, -4.98206165e-03, 7.80898801e-03, 2.89719273e-03,
+	-7.97612921e-03, -9.12954825e-04, 7.70354001e-03, -8.87860514e-04,
+	-7.05567968e-03, 2.43900230e-03, 6.10641598e-03, -3.69199860e-03,
+	-4.93543537e-03, 4.61668179e-03, 3.62454240e-03, -5.20096657e-03,
+	-2.25403538e-03, 5.44989680e-03, 8.99331401e-04, -5.38402056e-03,
+	3.72007020e-04, 5.03718891e-03, -1.50271868e-03, -4.45390203e-03,
+	2.44767118e-03, 3.68634557e-03, -3.17501189e-03, -2.79127131e-03,
+	3.66662181e-03, 1.82687754e-03, -3.91788784e-03, -8.49838365e-04,
+	3.93684262e-03, -8.73834289e-05, -3.74275052e-03, 9.38825616e-04,
+	3.36424237e-03, -1.66682970e-03, -2.83711915e-03, 2.24329880e-03,
+	2.20195503e-03, -2.65038202e-03, -1.50163341e-03, 2.88058798e-03,
+	7.78945271e-04, -2.93635928e-03, -7.43684936e-05, 2.82916572e-03,
+	-5.75869585e-04, -2.57819550e-03, 1.14136519e-03, 2.20873986e-03,
+	-1.59868950e-03, -1.75037687e-03, 1.93208706e-03, 1.23506370e-03,
+	-2.13371585e-03, -6.95244893e-04, 2.20344834e-03, 1.62076142e-04,
+	-2.14827517e-03, 3.36149663e-04, 1.98137155e-03, -7.75303905e-04,
+	-1.72090079e-03, 1.13640059e-03, 1.38863867e-03, -1.40622181e-03,
+	-1.00850618e-03, 1.57758204e-03, 6.05097313e-04, -1.64924305e-03,
+	-2.02282962e-04, 1.62550993e-03, -1.78038210e-04, -1.51555404e-03,
+	5.16983877e-04, 1.33252050e-03, -7.99484798e-04, -1.09248587e-03,
+	1.01480859e-03, 8.13335124e-04, -1.15680205e-03, -5.13626782e-04,
+	1.22385996e-03, 2.11510263e-04, -1.21864308e-03, 7.62476972e-05,
+	1.14758049e-03, -3.35081420e-04, -1.02020110e-03, 5.53255431e-04,
+	8.48345330e-04, -7.22283721e-04, -6.45310997e-04, 8.37131974e-04,
+	4.24987084e-04, -8.96208597e-04, -2.01025518e-04, 9.01161987e-04,
+	-1.39049000e-05, -8.56511277e-04, 2.08746495e-04, 7.69145215e-04,
+	-3.74536377e-04, -6.47728716e-04, 5.04729903e-04, 5.02058778e-04,
+	-5.95358666e-04, -3.42411052e-04, 6.45027751e-04, 1.78915529e-04,
+	-6.54765970e-04, -2.09949489e-05, 6.27750253e-04, -1.23106893e-04,
+	-5.68930947e-04, 2.46687306e-04, 4.84588375e-04, -3.44825776e-04,
+	-3.81852445e-04, 4.14500492e-04, 2.68216604e-04, -4.54584519e-04,
+	-1.51075050e-04, 4.65732548e-04, 3.73082400e-05, -4.50174702e-04,
+	6.70633151e-05, 4.11437926e-04, -1.57142816e-04, -3.54017999e-04,
+	2.29330500e-04, 2.83026087e-04, -2.81404668e-04, -2.03833115e-04,
+	3.12514225e-04, 1.21733248e-04, -3.23091533e-04, -4.16446837e-05,
+	3.14698336e-04, -3.21380010e-05, -2.89820373e-04, 9.61301238e-05,
+	2.51627936e-04, -1.47776633e-04, -2.03720044e-04, 1.85504659e-04,
+	1.49869215e-04, -2.08712383e-04, -9.37821447e-05, 2.17701291e-04,
+	3.88891331e-05, -2.13561613e-04, 1.18279295e-05, 1.98022683e-04,
+	-5.59625360e-05, -1.73280917e-04, 9.17624453e-05, 1.41818222e-04,
+	-1.18160698e-04, -1.06222918e-04, 1.34761928e-04, 6.90238840e-05,
+	-1.41789585e-04, -3.25466711e-05, 1.40001525e-04, -1.20191788e-06,
+	-1.30582618e-04, 3.06167911e-05, 1.15023550e-04, -5.45435142e-05,
+	-9.49948636e-05, 7.22940062e-05, 7.22246166e-05, -8.36317592e-05,
+	-4.83868764e-05, 8.87309849e-05, 2.50067993e-05, -8.81152557e-05,
+	-3.38633113e-06, 8.25818933e-05, -1.54471994e-05, -7.31185588e-05,
+	3.07690509e-05, 6.08182611e-05, -4.21626323e-05, -4.67983822e-05,
+	4.95050125e-05, 3.21284055e-05, -5.29357580e-05, -1.77699109e-05,
+	5.28131609e-05, 4.53117848e-06, -4.96622581e-05, 6.96249927e-06,
+	4.41190502e-05, -1.62828640e-05, -3.68750354e-05, 2.31981886e-05,
+	2.86256474e-05, -2.76601489e-05, -2.00254768e-05, 2.97805930e-05,
+	1.16523368e-05, -2.98010892e-05, -3.98137756e-06, 2.80582501e-05,
+	-2.63038040e-06, -2.49477285e-05, 7.94948001e-06, 2.08894900e-05,
+	-1.18624497e-05, -1.62965383e-05, 1.43647163e-05, 1.15487348e-05,
+	-1.55438300e-05, -6.97278500e-06, 1.55589686e-05, 2.82888318e-06,
+	-1.46186788e-05, 6.96026909e-07, 1.29586656e-05, -3.48887818e-06,
+	-1.08211818e-05, 5.50586137e-06, 8.43723542e-06, -6.76368052e-06,
+	-6.01245757e-06, 7.32793896e-06, 3.71708307e-06, -7.29993757e-06,
+	-1.68013240e-06, 6.80309508e-06, -1.24403190e-08, -5.97004845e-06,
+	1.31612742e-06, 4.93128155e-06, -2.22345539e-06, -3.80588705e-06,
+	2.75756706e-06, 2.69481174e-06, -2.96461733e-06, -1.67669104e-06,
+	2.90576514e-06, 8.06161570e-07, -2.64945344e-06, -1.14364157e-07,
+	2.26453645e-06, -3.88777349e-07, -1.81465706e-06, 7.10991932e-07,
+	1.35411146e-06, -8.73326686e-07, -9.25279096e-07, 9.05535473e-07,
+	5.57553911e-07, -8.41626614e-07, -2.67598509e-07, 7.15919820e-07,
+	6.06607443e-08, -5.59860922e-07, 6.73552721e-08, 3.99735995e-07,
+	1.74850733e-08, 4.24471986e-07, -1.39855093e-07, -5.34434010e-07,
+	3.28151699e-07, 6.09030062e-07, -5.82654595e-07, -6.20627052e-07,
+	8.94813446e-07, 5.40270618e-07, -1.24570856e-06, -3.40773674e-07,
+	1.60530241e-06, 3.82361363e-10, -1.93274016e-06, 4.93244970e-07,
+	2.17790016e-06, -1.13909566e-06, -2.28430740e-06, 1.91931359e-06,
+	2.19340775e-06, -2.79661594e-06, -1.85006461e-06, 3.71306835e-06,
+	1.20899248e-06, -4.59062619e-06, -2.41695697e-07, 5.33375855e-06,
+	-1.05665025e-06, -5.83433355e-06, 2.66103936e-06, 5.97876559e-06,
+	-4.51191918e-06, -5.65721521e-06, 6.51264118e-06, 4.77440569e-06,
+	-8.52973569e-06, -3.26139464e-06, 1.03965352e-05, 1.08743356e-06,
+	-1.19204654e-05, 1.72911377e-06, 1.28940572e-05, -5.11192268e-06,
+	-1.31094188e-05, 8.92107433e-06, 1.23755604e-05, -1.29517048e-05,
+	-1.05376221e-05, 1.69378205e-05, 7.49672586e-06, -2.05618786e-05,
+	-3.22891519e-06, 2.34703469e-05, -2.19853859e-06, -2.52950016e-05,
+	8.61524396e-06, 2.56792080e-05, -1.57419193e-05, -2.43079064e-05,
+	2.31922293e-05, 2.09395211e-05, -3.04833325e-05, -1.54375816e-05,
+	3.70557240e-05, 7.79952344e-06, -4.23023074e-05, 1.82002385e-06,
+	4.56058980e-05, -1.30941313e-05, -4.63835800e-05, 2.55190759e-05,
+	4.41355771e-05, -3.84224223e-05, -3.84956048e-05, 5.09849688e-05,
+	2.92791247e-05, -6.22769702e-05, -1.65255657e-05, 7.13080291e-05,
+	5.30482735e-07, -7.70889316e-05, 1.81361865e-05, 7.87025699e-05,
+	-3.86290926e-05, -7.53800267e-05, 5.98461763e-05, 6.65769846e-05,
+	-8.04684819e-05, -5.20449504e-05, 9.90210967e-05, 3.18914377e-05,
+	-1.13953690e-04, -6.62329043e-06, 1.23737499e-04, -2.28322007e-05,
+	-1.26974028e-04, 5.51328165e-05, 1.22509251e-04, -8.85566374e-05,
+	-1.09545988e-04, 1.21068318e-04, 8.77462770e-05, -1.50415698e-04,
+	-5.73153358e-05, 1.74253818e-04, 1.90589421e-05, -1.90291091e-04,
+	2.55930334e-05, 1.96450252e-04, -7.46026980e-05, -1.91034737e-04,
+	1.25383488e-04, 1.72889737e-04, -1.74903892e-04, -1.41546247e-04,
+	2.19833703e-04, 9.73363053e-05, -2.56727800e-04, -4.14682405e-05,
+	2.82239343e-04, -2.39477555e-05, -2.93351322e-04, 9.59310975e-05,
+	2.87612971e-04, -1.70723616e-04, -2.63365705e-04, 2.43944310e-04,
+	2.19942346e-04, -3.10802540e-04, -1.57823432e-04, 3.66361838e-04,
+	7.87355819e-05, -4.05842312e-04, 1.43207951e-05, 4.24945788e-04,
+	-1.17123773e-04, -4.20184678e-04, 2.24367131e-04, 3.89193379e-04,
+	-3.29882366e-04, -3.31000037e-04, 4.26939716e-04, 2.46236879e-04,
+	-5.08616662e-04, -1.37269213e-04, 5.68216776e-04, 8.22657311e-06,
+	-5.99716871e-04, 1.35075752e-04, 5.98216378e-04, -2.85330537e-04,
+	-5.60360276e-04, 4.34046606e-04, 4.84705884e-04, -5.71962292e-04,
+	-3.72004636e-04, 6.89548086e-04, 2.25372799e-04, -7.77574933e-04,
+	-5.03297448e-05, 8.27718267e-04, -1.45311015e-04, -8.33162914e-04,
+	3.51704842e-04, 7.89170725e-04, -5.57390617e-04, -6.93571840e-04,
+	7.49844803e-04, 5.47141803e-04, -9.16152813e-04, -3.53830655e-04,
+	1.04376627e-03, 1.20816494e-04, -1.12130664e-03, 1.41635370e-04,
+	1.13936939e-03, -4.20516027e-04, -1.09127896e-03, 7.00615762e-04,
+	9.73743644e-04, -9.65249811e-04, -7.87361478e-04, 1.19713817e-03,
+	5.36933349e-04, -1.37939869e-03, -2.31547813e-04, 1.49660236e-03,
+	-1.15586752e-04, -1.53583182e-03, 4.87573588e-04, 1.48767908e-03,
+	-8.64518321e-04, -1.34711712e-03, 1.22445872e-03, 1.11418255e-03,
+	-1.54449708e-03, -7.94412811e-04, 1.80208379e-03, 3.98992080e-04,
+	-1.97638762e-03, 5.54264635e-05, 2.04967827e-03, -5.47237100e-04,
+	-2.00864003e-03, 1.05073319e-03, 1.84553375e-03, -1.53727016e-03,
+	-1.55912685e-03, 1.97669609e-03, 1.15531892e-03, -2.33898702e-03,
+	-6.47402788e-04, 2.59600806e-03, 5.59180795e-05, -2.72330777e-03,
+	5.91925630e-04, 2.70184553e-03, -1.26325544e-03, -2.51954769e-03,
+	1.92094654e-03, 2.17259146e-03, -2.52538859e-03, -1.66632354e-03,
+	3.03653386e-03, 1.01573516e-03, -3.41613303e-03, -2.45434520e-04,
+	3.63004828e-03, -6.10917942e-04, -3.65052147e-03, 1.51171893e-03,
+	3.45827023e-03, -2.40905408e-03, -3.04428634e-03, 3.25080036e-03,
+	2.41121930e-03, -3.98311861e-03, -1.57424362e-03, 4.55323044e-03,
+	5.61330124e-04, -4.91235241e-03, 5.87130693e-04, 5.01864575e-03,
+	-1.81937405e-03, -4.84003171e-03, 3.07396127e-03, 4.35672285e-03,
+	-4.28208644e-03, -3.56332880e-03, 5.37040668e-03, 2.47041195e-03,
+	-6.26428213e-03, -1.10539306e-03, 6.89128567e-03, -4.87261070e-04,
+	-7.18482262e-03, 2.24659779e-03, 7.08768861e-03, -4.09647326e-03,
+	-6.55539103e-03, 5.94752104e-03, 5.55906602e-03, -7.69968388e-03,
+	-4.08783912e-03, 9.24514350e-03, 2.15050448e-03, -1.04714233e-02,
+	2.23566732e-04, 1.12643664e-02, -2.98433190e-03, -1.15105937e-02,
+	6.06178212e-03, 1.10988936e-02, -9.36736007e-03, -9.91973214e-03,
+	1.27959041e-02, 7.86155611e-03, -1.62277801e-02, -4.80151272e-03,
+	1.95305897e-02, 5.85853127e-04, -2.25592713e-02, 5.01036857e-03,
+	2.51520327e-02, -1.23697494e-02, -2.71157174e-02, 2.22361659e-02,
+	2.81816846e-02, -3.62710726e-02, -2.78626100e-02, 5.89660320e-02,
+	2.48564284e-02, -1.07440450e-01, -1.26758144e-02, 3.50925863e-01,
+	5.35040946e-01, 2.80043967e-01, -5.81346964e-02, -8.97679943e-02,
+	4.55613844e-02, 4.59197284e-02, -3.95390937e-02, -2.49972137e-02,
+	3.48387856e-02, 1.22252451e-02, -3.04517664e-02, -3.53143589e-03,
+	2.61105060e-02, -2.64427171e-03, -2.17680440e-02, 7.02957187e-03,
+	1.74620390e-02, -1.00206269e-02, -1.32657994e-02, 1.18675981e-02,
+	9.26582618e-03, -1.27535093e-02, -5.54933591e-03, 1.28305919e-02,
+	2.19633199e-03, -1.22374500e-02, 7.25788251e-04, 1.11067005e-02,
+	-3.16589802e-03, -9.56754550e-03, 5.09142703e-03, 7.74554741e-03,
+	-6.48944382e-03, -5.76088157e-03, 7.36665103e-03, 3.72584968e-03,
+	-7.74840264e-03, -1.74217278e-03, 7.67686529e-03, -1.01574296e-04,
+	-7.20846614e-03, 1.73213024e-03, 6.41078983e-03, -3.09313928e-03,
+	-5.35910174e-03, 4.14605621e-03, 4.13268313e-03, -4.87031010e-03,
+	-2.81116330e-03, 5.26272354e-03, 1.47102547e-03, -5.33622930e-03,
+	-1.82446113e-04, 5.11796440e-03, -9.93396161e-04, -4.64685329e-03,
+	2.00643580e-03, 3.97081442e-03, -2.81918681e-03, -3.14373917e-03,
+	3.40752370e-03, 2.22239777e-03, -3.76077616e-03, -1.26342395e-03,
+	3.88117137e-03, 3.20519238e-04, -3.78268888e-03, 5.57999819e-04,
+	3.48941967e-03, -1.33121189e-03, -3.03354090e-03, 1.96708633e-03,
+	2.45303193e-03, -2.44342192e-03, -1.78926287e-03, 2.74821734e-03,
+	1.08458657e-03, -2.87949227e-03, -3.80056660e-04, 2.84460454e-03,
+	-2.86619118e-04, -2.65913278e-03, 8.82800305e-04, 2.34541226e-03,
+	-1.38224217e-03, -1.93082420e-03, 1.76598864e-03, 1.44594579e-03,
+	-2.02281279e-03, -9.22668492e-04, 2.14921330e-03, 3.92387011e-04,
+	-2.14899830e-03, 1.15649300e-04, 2.03250817e-03, -5.75745547e-04,
+	-1.81554504e-03, 9.66872097e-04, 1.51808795e-03, -1.27343839e-03,
+	-1.16287882e-03, 1.48571212e-03, 7.73965903e-04, -1.59988690e-03,
+	-3.75287369e-04, 1.61782034e-03, -1.06300624e-05, -1.54648159e-03,
+	3.63794347e-04, 1.39716026e-03, -6.67644382e-04, -1.18449850e-03,
+	9.09686688e-04, 9.25413290e-04, -1.08185672e-03, -6.37977352e-04,
+	1.18060564e-03, 3.40324280e-04, -1.20672874e-03, -4.96374492e-05,
+	1.16496504e-03, -2.18727043e-04, -1.06340844e-03, 4.51944441e-04,
+	9.12778331e-04, -6.40226231e-04, -7.25601926e-04, 7.77113040e-04,
+	5.15361785e-04, -8.59555804e-04, -2.95659633e-04, 8.87797581e-04,
+	7.94428420e-05, -8.65078839e-04, 1.21667383e-04, 7.97197465e-04,
+	-2.97915972e-04, -6.91960590e-04, 4.41802023e-04, 5.58568657e-04,
+	-5.48305205e-04, -4.06972823e-04, 6.14951015e-04, 2.47244958e-04,
+	-6.41724708e-04, -8.89956131e-05, 6.30851757e-04, -5.91304565e-05,
+	-5.86468983e-04, 1.89858602e-04, 5.14214941e-04, -2.97573599e-04,
+	-4.20770409e-04, 3.78487185e-04, 3.13380213e-04, -4.30684759e-04,
+	-1.99385960e-04, 4.54059283e-04, 8.57961201e-05, -4.50146374e-04,
+	2.10846933e-05, 4.21879235e-04, -1.15950798e-04, -3.73285182e-04,
+	1.94704419e-04, 3.09147066e-04, -2.54574181e-04, -2.34652888e-04,
+	2.94144552e-04, 1.55055495e-04, -3.13302896e-04, -7.53616143e-05,
+	3.13115094e-04, 6.59618148e-08, -2.95644043e-04, 6.70580609e-05,
+	2.63727392e-04, -1.23104063e-04, -2.20731823e-04, 1.66112265e-04,
+	1.70300957e-04, -1.95084777e-04, -1.16112684e-04, 2.09942071e-04,
+	6.16596191e-05, -2.11429238e-04, -1.00636104e-05, 2.00982809e-04,
+	-3.60679383e-05, -1.80570326e-04, 7.47395353e-05, 1.52515240e-04,
+	-1.04617746e-04, -1.19319384e-04, 1.25035953e-04, 8.34941357e-05,
+	-1.35958285e-04, -4.74097171e-05, 1.37909329e-04, 1.31699205e-05,
+	-1.31877695e-04, 1.74827683e-05, 1.19202259e-04, -4.32291450e-05,
+	-1.01450080e-04, 6.32021854e-05, 8.02945085e-05, -7.69847989e-05,
+	-5.74010826e-05, 8.45801304e-05, 3.43274550e-05, -8.63594391e-05,
+	-1.24420206e-05, 8.29934438e-05, -7.13581892e-06, -7.53734209e-05,
+	2.35725337e-05, 6.45282729e-05, -3.63348781e-05, -5.15433320e-05,
+	4.51836359e-05, 3.74858727e-05, -5.01496242e-05, -2.33412869e-05,
+	5.14956902e-05, 9.96270651e-06, -4.96689032e-05, 1.96435662e-06,
+	4.52472798e-05, -1.19419651e-05, -3.88852074e-05, 1.96649801e-05,
+	3.12613046e-05, -2.50131258e-05, -2.30318274e-05, 2.80321456e-05,
+	1.47919649e-05, -2.89067460e-05, -7.04654094e-06, 2.79282331e-05,
+	1.90806228e-07, -2.54597276e-05, 5.49876879e-06, 2.19016331e-05,
+	-9.86446160e-06, -1.76596599e-05, 1.28593195e-05, 1.31172223e-05,
+	-1.45329051e-05, -8.61347918e-06, 1.50126433e-05, 4.42772103e-06,
+	-1.44826984e-05, -7.70262311e-07, 1.31622146e-05, -2.22048082e-06,
+	-1.12845430e-05, 4.47544461e-06, 9.07877571e-06, -5.98790883e-06,
+	-6.75455358e-06, 6.80320796e-06, 4.49073807e-06, -7.00641164e-06,
+	-2.42816684e-06, 6.70918870e-06, 6.66382142e-07, -6.03694922e-06,
+	7.36058767e-07, 5.11717382e-06, -1.75829028e-06, -4.06961250e-06,
+	2.41159578e-06, 2.99878902e-06, -2.73240770e-06, -1.98900250e-06,
+	2.77463156e-06, 1.10179517e-06, -2.60200535e-06, -3.75666916e-07,
+	2.28109004e-06, -1.72325160e-07, -1.87534211e-06, 5.43536663e-07,
+	1.44055891e-06, -7.53771828e-07, -1.02182918e-06, 8.28877445e-07,
+	6.51975439e-07, -8.00342497e-07, -3.51352659e-07, 7.01276675e-07,
+	1.28775887e-07, -5.63046576e-07, 1.67093094e-08, 4.12744989e-07,
+	-2.07052627e-08, 4.25276578e-07, -8.74749215e-08, -5.50373413e-07,
+	2.63297515e-07, 6.47655836e-07, -5.09825847e-07, -6.89350937e-07,
+	8.21654454e-07, 6.45342069e-07, -1.18309176e-06, -4.86103424e-07,
+	1.56705463e-06, 1.86305835e-07, -1.93495389e-06, 2.71143383e-07,
+	2.23780328e-06, -8.90956330e-07, -2.41870484e-06, 1.66162246e-06,
+	2.41675568e-06, -2.55232502e-06, -2.17228742e-06, 3.51108720e-06,
+	1.63320205e-06, -4.46459058e-06, -7.62014966e-07, 5.32003313e-06,
+	-4.56925589e-07, -5.96926982e-06, 2.01069170e-06, 6.29531073e-06,
+	-3.85222788e-06, -6.18104685e-06, 5.89675315e-06, 5.51984562e-06,
+	-8.02082471e-06, -4.22742365e-06, 1.00646639e-05, 2.25418255e-06,
+	-1.18381634e-05, 4.02992630e-07, 1.31307436e-05, -3.69060207e-06,
+	-1.37249207e-05, 7.49124921e-06, 1.34131055e-05, -1.16203494e-05,
+	-1.20167917e-05, 1.58278250e-05, 9.40694913e-06, -1.98055306e-05,
+	-5.52413927e-06, 2.32007966e-05, 3.96646647e-07, -2.56360369e-05,
+	5.84519357e-06, 2.67338609e-05, -1.29602742e-05, -2.61465916e-05,
+	2.05952360e-05, 2.35885622e-05, -2.82915383e-05, -1.88690878e-05,
+	3.55019120e-05, 1.19236301e-05, -4.16164098e-05, -2.84043659e-06,
+	4.59975481e-05, -8.12011958e-06, -4.80232485e-05, 2.05161153e-05,
+	4.71354914e-05, -3.37268073e-05, -4.28918507e-05, 4.69691446e-05,
+	3.50164453e-05, -5.93288748e-05, -2.34463994e-05, 6.98060652e-05,
+	8.36968462e-06, -7.73737488e-05, 9.74970432e-06, 8.10472422e-05,
+	-3.01629051e-05, -7.99605531e-05, 5.18466223e-05, 7.34452857e-05,
+	-7.35347634e-05, -6.11066527e-05, 9.37718964e-05, 4.28907020e-05,
+	-1.10987636e-04, -1.91367382e-05, 1.23589432e-04, -9.39078806e-06,
+	-1.30069564e-04, 4.14958984e-05, 1.29120620e-04, -7.55739858e-05,
+	-1.19752371e-04, 1.09666146e-04, 1.01402009e-04, -1.41545125e-04,
+	-7.40291731e-05, 1.68830838e-04, 3.81872530e-05, -1.89131114e-04,
+	4.93693746e-06, 2.00200982e-04, -5.35217043e-05, -2.00111778e-04,
+	1.05151960e-04, 1.87419619e-04, -1.56905931e-04, -1.61321626e-04,
+	2.05486501e-04, 1.21787823e-04, -2.47393462e-04, -6.96568983e-05,
+	2.79129719e-04, 6.68521702e-06, -2.97431390e-04, 6.44595433e-05,
+	2.99509018e-04, -1.40265932e-04, -2.83284957e-04, 2.16509721e-04,
+	2.47610631e-04, -2.88446595e-04, -1.92447005e-04, 3.51060451e-04,
+	1.18992289e-04, -3.99356833e-04, -2.97427716e-05, 4.28686941e-04,
+	-7.15243293e-05, -4.35084105e-04, 1.79853059e-04, 4.15591946e-04,
+	-2.89298116e-04, -3.68561889e-04, 3.93198041e-04, 2.93897487e-04,
+	-4.84522969e-04, -1.93224276e-04, 5.56281880e-04, 6.99666640e-05,
+	-6.01968965e-04, 7.06823598e-05, 6.16024152e-04, -2.21907315e-04,
+	-5.94279571e-04, 3.75534036e-04, 5.34361952e-04, -5.22405681e-04,
+	-4.36020973e-04, 6.52857695e-04, 3.01355565e-04, -7.57270872e-04,
+	-1.34914133e-04, 8.26674759e-04, -5.63494721e-05, -8.53367899e-04,
+	2.63274837e-04, 8.31517326e-04, -4.74850447e-04, -7.57697668e-04,
+	6.78717677e-04, 6.31330561e-04, -8.61805163e-04, -4.54987883e-04,
+	1.01106563e-03, 2.34527732e-04, -1.11427836e-03, 2.09601337e-05,
+	1.16087334e-03, -2.99412749e-04, -1.14272776e-03, 5.86258093e-04,
+	1.05488361e-03, -8.65074109e-04, -8.96134971e-04, 1.11841883e-03,
+	6.69438313e-04, -1.32879530e-03, -3.82105240e-04, 1.47970379e-03,
+	4.57479190e-05, -1.55672456e-03, 3.24040317e-04, 1.54856802e-03,
+	-7.08271777e-04, -1.44802604e-03, 1.08540524e-03, 1.25275906e-03,
+	-1.43241099e-03, -9.65858280e-04, 1.72601451e-03, 5.96131076e-04,
+	-1.94405878e-03, -1.58070375e-04, 2.06691389e-03, -3.28515388e-04,
+	-2.07885398e-03, 8.39216816e-04, 1.96931774e-03, -1.34606765e-03,
+	-1.73396926e-03, 1.81888295e-03, 1.37548150e-03, -2.22683616e-03,
+	-9.03975419e-04, 2.54020176e-03, 3.37062584e-04, -2.73217558e-03,
+	3.00541252e-04, 2.78067379e-03, -9.77842137e-04, -2.67000627e-03,
+	1.65881935e-03, 2.39231959e-03, -2.30406309e-03, -1.94871097e-03,
+	2.87273480e-03, 1.34992646e-03, -3.32476392e-03, -6.16573927e-04,
+	3.62317634e-03, -2.21195802e-04, -3.73643538e-03, 1.12456024e-03,
+	3.64066832e-03, -2.04744027e-03, -3.32164952e-03, 2.93842031e-03,
+	2.77641703e-03, -3.74310520e-03, -2.01441185e-03, 4.40681816e-03,
+	1.05804853e-03, -4.87752087e-03, 5.73489832e-05, 5.10881826e-03,
+	-1.28428207e-03, -5.06289969e-03, 2.56448517e-03, 4.71326446e-03,
+	-3.83097331e-03, -4.04708395e-03, 5.01066156e-03, 3.06706639e-03,
+	-6.02745495e-03, -1.79271137e-03, 6.80567887e-03, 2.60870661e-04,
+	-7.27369629e-03, 1.47443188e-03, 7.36754217e-03, -3.34292654e-03,
+	-7.03439775e-03, 5.25972842e-03, 6.23572896e-03, -7.12757957e-03,
+	-4.94992386e-03, 8.83955399e-03, 3.17428477e-03, -1.02820140e-02,
+	-9.26259701e-04, 1.13375315e-02, -1.75616464e-03, -1.18873851e-02,
+	4.81494089e-03, 1.18130914e-02, -8.17329004e-03, -1.09961571e-02,
+	1.17377986e-02, 9.31473337e-03, -1.54011219e-02, -6.63480671e-03,
+	1.90450138e-02, 2.79124429e-03, -2.25431945e-02, 2.45154190e-03,
+	2.57630990e-02, -9.48427231e-03, -2.85642967e-02, 1.90521268e-02,
+	3.07873424e-02, -3.27970421e-02, -3.22106632e-02, 5.51065328e-02,
+	3.23636681e-02, -1.02425924e-01, -2.91771951e-02, 3.27880611e-01,
+	5.37031563e-01, 3.04203917e-01, -4.43482245e-02, -9.65028958e-02,
+	3.92834333e-02, 5.07380185e-02, -3.61137949e-02, -2.90236483e-02,
+	3.30124905e-02, 1.57021583e-02, -2.96789930e-02, -6.52705756e-03,
+	2.60827407e-02, -1.09419841e-04, -2.22777213e-02, 4.94694212e-03,
+	1.83523945e-02, -8.38072336e-03, -1.44097476e-02, 1.06547646e-02,
+	1.05564817e-02, -1.19439799e-02, -6.89573440e-03, 1.23922038e-02,
+	3.52159655e-03, -1.21303301e-02, -5.14850403e-04, 1.12845709e-02,
+	-2.06024553e-03, -9.97942612e-03, 4.15816765e-03, 8.33769100e-03,
+	-5.75334378e-03, -6.47880562e-03, 6.84039359e-03, 4.51634780e-03,
+	-7.43343830e-03, -2.55520257e-03, 7.56455796e-03, 6.88785437e-04,
+	-7.28150724e-03, 1.00340753e-03, 6.64482964e-03, -2.45772748e-03,
+	-5.72453174e-03, 3.62764754e-03, 4.59649409e-03, -4.48431079e-03,
+	-3.33879999e-03, 5.01632859e-03, 2.02816027e-03, -5.22885318e-03,
+	-7.36599745e-04, 5.14198856e-03, -4.71449117e-04, -4.78863765e-03,
+	1.54152635e-03, 4.21191002e-03, -2.43091099e-03, -3.46223262e-03,
+	3.10972108e-03, 2.59431532e-03, -3.56133043e-03, -1.66412418e-03,
+	3.78212013e-03, 7.26007802e-04, -3.78061561e-03, 1.69892274e-04,
+	3.57608851e-03, -9.79837026e-04, -3.19672553e-03, 1.66820704e-03,
+	2.67748267e-03, -2.20868566e-03, -2.05775342e-03, 2.58488308e-03,
+	1.37898082e-03, -2.79040639e-03, -6.82339604e-04, 2.82840892e-03,
+	6.60262321e-06, -2.71067716e-03, 6.13710069e-04, 2.45633432e-03,
+	-1.14982240e-03, -2.09025451e-03, 1.57978024e-03, 1.64129115e-03,
+	-1.88908792e-03, -1.14042631e-03, 2.07090056e-03, 6.18944867e-04,
+	-2.12579312e-03, -1.06729483e-04, 2.06114869e-03, -3.69240719e-04,
+	-1.89022611e-03, 7.86121374e-04, 1.63098046e-03, -1.12611674e-03,
+	-1.30471820e-03, 1.37704955e-03, 9.34672450e-04, -1.53258093e-03,
+	-5.44582096e-04, 1.59209389e-03, 1.57352495e-04, -1.56027188e-03,
+	2.06134512e-04, 1.44641827e-03, -5.28006641e-04, -1.26357373e-03,
+	7.94143931e-04, 1.02749604e-03, -9.94655317e-04, -7.55569271e-04,
+	1.12408270e-03, 4.65708897e-04, -1.18134200e-03, -1.75324387e-04,
+	1.16942471e-03, -9.96069066e-05, -1.09489553e-03, 3.45311056e-04,
+	9.67230111e-04, -5.50802678e-04, -7.98043138e-04, 7.08265475e-04,
+	6.00259148e-04, -8.13222877e-04, -3.87277706e-04, 8.64505934e-04,
+	1.72181007e-04, -8.64036658e-04, 3.29743516e-05, 8.16454226e-04,
+	-2.17747772e-04, -7.28618346e-04, 3.73763093e-04, 6.09028442e-04,
+	-4.95001065e-04, -4.67199083e-04, 5.77932069e-04, 3.13031356e-04,
+	-6.21494887e-04, -1.56216824e-04, 6.26935835e-04, 5.70582165e-06,
+	-5.97529548e-04, 1.30734594e-04, 5.38207861e-04, -2.46855122e-04,
+	-4.55126397e-04, 3.38141025e-04, 3.55199620e-04, -4.01908995e-04,
+	-2.45634329e-04, 4.37289075e-04, 1.33489064e-04, -4.45103019e-04,
+	-2.52829611e-05, 4.27655599e-04, -7.33274271e-05, -3.88459130e-04,
+	1.57790522e-04, 3.31913595e-04, -2.24814469e-04, -2.62965451e-04,
+	2.72433273e-04, 1.86767332e-04, -2.99988738e-04, -1.08358786e-04,
+	3.08037292e-04, 3.23850594e-05, -2.98194470e-04, 3.71329618e-05,
+	2.72932379e-04, -9.69688567e-05, -2.35346881e-04, 1.44796520e-04,
+	1.88911467e-04, -1.79231758e-04, -1.37233945e-04, 1.99813564e-04,
+	8.38303674e-05, -2.06932296e-04, -3.19280938e-05, 2.01714532e-04,
+	-1.56930385e-05, -1.85876058e-04, 5.68157340e-05, 1.61555252e-04,
+	-8.98540196e-05, -1.31139104e-04, 1.13876465e-04, 9.70932885e-05,
+	-1.28587281e-04, -6.18063064e-05, 1.34271004e-04, 2.74557402e-05,
+	-1.31708125e-04, 4.09751913e-06, 1.22070098e-04, -3.13836281e-05,
+	-1.06802508e-04, 5.33656157e-05, 8.75050095e-05, -6.94497445e-05,
+	-6.58158923e-05, 7.94673461e-05, 4.33079663e-05, -8.36325581e-05,
+	-2.14010020e-05, 8.24814291e-05, 1.29430540e-06, -7.67984290e-05,
+	1.60786888e-05, 6.75365210e-05, -3.00735538e-05, -5.57366566e-05,
+	4.03369548e-05, 4.24519029e-05, -4.67901204e-05, -2.86805008e-05,
+	4.95970607e-05, 1.53110538e-05, -4.91214889e-05, -3.08186926e-06,
+	4.58766647e-05, -7.44470398e-06, -4.04723274e-05, 1.58931930e-05,
+	3.35625642e-05, -2.20723712e-05, -2.57979194e-05, 2.59610336e-05,
+	1.77843450e-05, -2.76846585e-05, -1.00508044e-05, 2.74857319e-05,
+	3.02652330e-06, -2.56905817e-05, 2.97190467e-06, 2.26754326e-05,
+	-7.74404853e-06, -1.88340874e-05, 1.12008761e-05, 1.45492067e-05,
+	-1.33531940e-05, -1.01686441e-05, 1.42950581e-05, 5.98773960e-06,
+	-1.41840312e-05, -2.23793634e-06, 1.32201242e-05, -9.18417426e-07,
+	-1.16250953e-05, 3.38763472e-06, 9.62351627e-06, -5.13950550e-06,
+	-7.42668881e-06, 6.19845714e-06, 5.22012769e-06, -6.63226193e-06,
+	-3.15496541e-06, 6.53949694e-06, 1.34329017e-06, -6.03687435e-06,
+	1.42864063e-07, 5.24740278e-06, -1.26938714e-06, -4.29013171e-06,
+	2.03549352e-06, 3.27199613e-06, -2.46741027e-06, -2.28203754e-06,
+	2.61112291e-06, 1.38805079e-06, -2.52490211e-06, -6.35508636e-07,
+	2.27223709e-06, 4.84595083e-08, -1.91566934e-06, 3.68014559e-07,
+	1.51186838e-06, -6.24252438e-07, -1.10813503e-06, 7.41865128e-07,
+	7.40369634e-07, -7.49438422e-07, -4.32414669e-07, 6.78478935e-07,
+	1.96580118e-07, -5.59909500e-07, -3.50908773e-08, 4.21321327e-07,
+};
+
+#define POLYPHASE_NUM_KERNELS	5
+
+static const struct polyphase_kernel polyphase_kernels[POLYPHASE_NUM_KERNELS] = {
+	{48000, 228000, 20000, 28000, 19, 4, 19, 40,
+	 polyphase_48000_228000_20000},
+	{44100, 228000, 20000, 24100, 760, 147, 128, 72,
+	 polyphase_44100_228000_20000},
+	{48000, 228000, 16750, 19000, 19, 4, 19, 144,
+	 polyphase_48000_228000_16750},
+	{44100, 228000, 16750, 19000, 760, 147, 128, 128,
+	 polyphase_44100_228000_16750},
+	{228000, 192000, 60000, 62500, 16, 19, 16, 592,
+	 polyphase_228000_192000_60000},
+};
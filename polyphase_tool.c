@@ -0,0 +1,368 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - Polyphase kernel tool
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "utils.h"
+#include "fmmod.h"
+#include <stdlib.h>		/* For malloc / free */
+#include <stdio.h>		/* For fopen / fprintf */
+#include <string.h>		/* For memset */
+#include <math.h>		/* For sin() / ceil() */
+#include <time.h>		/* For clock_gettime() */
+#include <unistd.h>		/* For getopt() */
+
+/* Ratios with more phases than this get an interpolated table */
+#define MAX_EXACT_PHASES	64
+
+/* Length of the benchmark (in seconds of input) and of each period */
+#define BENCH_SECS		10
+#define BENCH_PERIOD		1024
+
+struct kernel_spec {
+	uint32_t in_rate;
+	uint32_t out_rate;
+	uint32_t passband_end;
+	uint32_t stopband_begin;
+};
+
+/* Keep this in sync with resampler_init() */
+static const struct kernel_spec kernel_specs[] = {
+	/* Plain audio upsamplers, their stopband begins
+	 * where the passband's image does */
+	{48000, OSC_SAMPLE_RATE, RESAMPLER_AUDIO_PASSBAND_END,
+	 48000 - RESAMPLER_AUDIO_PASSBAND_END},
+	{44100, OSC_SAMPLE_RATE, RESAMPLER_AUDIO_PASSBAND_END,
+	 44100 - RESAMPLER_AUDIO_PASSBAND_END},
+	/* Band-limiting audio upsamplers, with the default audio LPF */
+	{48000, OSC_SAMPLE_RATE, AFLT_CUTOFF_FREQ, AFLT_STOPBAND_FREQ},
+	{44100, OSC_SAMPLE_RATE, AFLT_CUTOFF_FREQ, AFLT_STOPBAND_FREQ},
+	/* MPX downsampler, when the MPX ends at 60KHz, with the
+	 * same transition band as SoXr's */
+	{OSC_SAMPLE_RATE, FMMOD_OUTPUT_SAMPLERATE, FMMOD_MPX_PASSBAND_END,
+	 FMMOD_MPX_STOPBAND_BEGIN},
+};
+
+#define NUM_SPECS	(int) (sizeof(kernel_specs) / sizeof(struct kernel_spec))
+
+static void
+usage(char *name)
+{
+	utils_ann("Polyphase kernel tool for JMPXRDS\n");
+	utils_info("Usage: %s -g <file> or -b\n", name);
+	utils_info("\nParameters:\n"
+		"\t-g   <file>\tGenerate the kernel tables (polyphase_tables.h)\n"
+		"\t-b\t\tBenchmark the kernels against SoXr\n");
+}
+
+static uint32_t
+gcd(uint32_t a, uint32_t b)
+{
+	uint32_t tmp = 0;
+
+	while (b) {
+		tmp = a % b;
+		a = b;
+		b = tmp;
+	}
+
+	return a;
+}
+
+
+/************\
+* GENERATION *
+\************/
+
+static int
+generate_kernel(FILE *out, const struct kernel_spec *spec,
+		struct polyphase_kernel *kernel)
+{
+	double *coeffs = NULL;
+	double proto_rate = 0.0;
+	double fc = 0.0;
+	double df = 0.0;
+	uint32_t num_rows = 0;
+	uint32_t len = 0;
+	uint32_t div = 0;
+	uint32_t i = 0;
+	int interpolated = 0;
+
+	memset(kernel, 0, sizeof(struct polyphase_kernel));
+	kernel->in_rate = spec->in_rate;
+	kernel->out_rate = spec->out_rate;
+	kernel->passband_end = spec->passband_end;
+	kernel->stopband_begin = spec->stopband_begin;
+
+	div = gcd(spec->in_rate, spec->out_rate);
+	kernel->interp = spec->out_rate / div;
+	kernel->decim = spec->in_rate / div;
+
+	interpolated = (kernel->interp > MAX_EXACT_PHASES);
+	kernel->num_phases = interpolated ? POLYPHASE_KERNEL_INTERP_PHASES :
+					    kernel->interp;
+	num_rows = interpolated ? kernel->num_phases + 1 : kernel->num_phases;
+
+	/* Same as polyphase_q15_init() */
+	proto_rate = (double) spec->in_rate * (double) kernel->num_phases;
+	fc = ((double) spec->passband_end + (double) spec->stopband_begin) /
+	     (2.0 * proto_rate);
+	df = ((double) spec->stopband_begin - (double) spec->passband_end) /
+	     proto_rate;
+	len = polyphase_kaiser_len(POLYPHASE_KERNEL_ATTEN, df);
+	kernel->num_taps = (len + kernel->num_phases - 1) / kernel->num_phases;
+	kernel->num_taps = ((kernel->num_taps + POLYPHASE_KERNEL_TAP_ALIGN - 1) /
+			    POLYPHASE_KERNEL_TAP_ALIGN) *
+			   POLYPHASE_KERNEL_TAP_ALIGN;
+
+	coeffs = (double *) malloc(num_rows * kernel->num_taps *
+				   sizeof(double));
+	if (!coeffs)
+		return -1;
+
+	polyphase_design(kernel->num_phases, kernel->num_taps, fc,
+			 POLYPHASE_KERNEL_ATTEN, interpolated, coeffs);
+
+	fprintf(out, "/* %u -> %u, passband: %u, stopband: %u, %u / %u",
+		spec->in_rate, spec->out_rate, spec->passband_end,
+		spec->stopband_begin, kernel->interp, kernel->decim);
+	if (interpolated)
+		fprintf(out, " (interpolated)");
+	fprintf(out, " */\nstatic const float polyphase_%u_%u_%u[%u]\n"
+		"__attribute__ ((aligned (16))) = {",
+		spec->in_rate, spec->out_rate, spec->passband_end,
+		num_rows * kernel->num_taps);
+	for (i = 0; i < num_rows * kernel->num_taps; i++)
+		fprintf(out, "%s%.8e,", (i % 4) ? " " : "\n\t", coeffs[i]);
+	fprintf(out, "\n};\n\n");
+
+	utils_info("%u -> %u (%u / %u): %u taps per phase, %u rows\n",
+		   spec->in_rate, spec->out_rate, kernel->interp,
+		   kernel->decim, kernel->num_taps, num_rows);
+
+	free(coeffs);
+	return 0;
+}
+
+static int
+generate_tables(const char *path)
+{
+	struct polyphase_kernel kernels[NUM_SPECS];
+	FILE *out = NULL;
+	int ret = 0;
+	int i = 0;
+
+	out = fopen(path, "w");
+	if (!out) {
+		utils_perr("Could not open output file");
+		return -1;
+	}
+
+	fprintf(out, "/* Generated by polyphase_tool -g, do not edit */\n\n"
+		"/* Only include this from polyphase.c */\n\n");
+
+	for (i = 0; i < NUM_SPECS; i++) {
+		ret = generate_kernel(out, &kernel_specs[i], &kernels[i]);
+		if (ret < 0) {
+			utils_err("Kernel generation failed\n");
+			goto cleanup;
+		}
+	}
+
+	fprintf(out, "#define POLYPHASE_NUM_KERNELS\t%i\n\n"
+		"static const struct polyphase_kernel "
+		"polyphase_kernels[POLYPHASE_NUM_KERNELS] = {\n", NUM_SPECS);
+	for (i = 0; i < NUM_SPECS; i++)
+		fprintf(out, "\t{%u, %u, %u, %u, %u, %u, %u, %u,\n"
+			"\t polyphase_%u_%u_%u},\n",
+			kernels[i].in_rate, kernels[i].out_rate,
+			kernels[i].passband_end, kernels[i].stopband_begin,
+			kernels[i].interp, kernels[i].decim,
+			kernels[i].num_phases, kernels[i].num_taps,
+			kernels[i].in_rate, kernels[i].out_rate,
+			kernels[i].passband_end);
+	fprintf(out, "};\n");
+
+ cleanup:
+	fclose(out);
+	return ret;
+}
+
+
+/************\
+* BENCHMARKS *
+\************/
+
+static double
+elapsed_secs(const struct timespec *start, const struct timespec *end)
+{
+	return (double) (end->tv_sec - start->tv_sec) +
+	       (double) (end->tv_nsec - start->tv_nsec) / 1000000000.0;
+}
+
+/* Run the same input through the kernel and through a SoXr resampler
+ * with the same passband / stopband and attenuation (SoXr's precision
+ * in bits maps to (bits + 1) * 6.02dB), in periods of BENCH_PERIOD
+ * frames, as the resampler would */
+static int
+bench_kernel(const struct polyphase_kernel *kernel)
+{
+	struct polyphase pp;
+	struct timespec start;
+	struct timespec end;
+	soxr_t soxr = NULL;
+	soxr_error_t error;
+	soxr_io_spec_t io_spec;
+	soxr_runtime_spec_t runtime_spec;
+	soxr_quality_spec_t q_spec;
+	float *in = NULL;
+	float *out = NULL;
+	double nyquist = 0.0;
+	double pp_secs = 0.0;
+	double soxr_secs = 0.0;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+	uint32_t in_len = kernel->in_rate * BENCH_SECS;
+	uint32_t max_out = 0;
+	uint32_t i = 0;
+	int ret = 0;
+
+	memset(&pp, 0, sizeof(struct polyphase));
+	max_out = (uint32_t) (((uint64_t) BENCH_PERIOD * kernel->out_rate) /
+			      kernel->in_rate) + 2;
+
+	in = (float *) malloc(in_len * sizeof(float));
+	out = (float *) malloc(max_out * sizeof(float));
+	if (!in || !out) {
+		ret = -1;
+		goto cleanup;
+	}
+
+	/* A few tones within the passband */
+	for (i = 0; i < in_len; i++)
+		in[i] = 0.3 * sin(2.0 * M_PI * 1000.0 * i / kernel->in_rate) +
+			0.3 * sin(2.0 * M_PI * 0.9 * kernel->passband_end * i /
+				  kernel->in_rate);
+
+	ret = polyphase_init(&pp, kernel, BENCH_PERIOD);
+	if (ret < 0) {
+		ret = -2;
+		goto cleanup;
+	}
+
+	/* Single channel, so we can pass plain buffers around */
+	io_spec = soxr_io_spec(SOXR_FLOAT32_I, SOXR_FLOAT32_I);
+	runtime_spec = soxr_runtime_spec(1);
+	q_spec = soxr_quality_spec(SOXR_HQ, 0);
+	q_spec.precision = POLYPHASE_KERNEL_ATTEN / 6.0206 - 1.0;
+	nyquist = (double) ((kernel->in_rate < kernel->out_rate) ?
+			    kernel->in_rate : kernel->out_rate) / 2.0;
+	q_spec.passband_end = (double) kernel->passband_end / nyquist;
+	q_spec.stopband_begin = (double) kernel->stopband_begin / nyquist;
+	soxr = soxr_create(kernel->in_rate, kernel->out_rate, 1, &error,
+			   &io_spec, &q_spec, &runtime_spec);
+	if (error) {
+		utils_err("SoXr init failed: %s\n", error);
+		ret = -3;
+		goto cleanup;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i + BENCH_PERIOD <= in_len; i += BENCH_PERIOD)
+		polyphase_process(&pp, in + i, out, BENCH_PERIOD, max_out);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	pp_secs = elapsed_secs(&start, &end);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i + BENCH_PERIOD <= in_len; i += BENCH_PERIOD)
+		soxr_process(soxr, in + i, BENCH_PERIOD, &frames_used,
+			     out, max_out, &frames_generated);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	soxr_secs = elapsed_secs(&start, &end);
+
+	utils_info("%u -> %u (%u/%uHz, %u taps): kernel %.1fms "
+		   "(%.0fx realtime), SoXr %.1fms (%.0fx realtime)\n",
+		   kernel->in_rate, kernel->out_rate, kernel->passband_end,
+		   kernel->stopband_begin, kernel->num_taps,
+		   pp_secs * 1000.0, BENCH_SECS / pp_secs,
+		   soxr_secs * 1000.0, BENCH_SECS / soxr_secs);
+
+ cleanup:
+	soxr_delete(soxr);
+	polyphase_destroy(&pp);
+	free(in);
+	free(out);
+	return ret;
+}
+
+static int
+bench_kernels(void)
+{
+	const struct polyphase_kernel *kernel = NULL;
+	int ret = 0;
+	int i = 0;
+
+	for (i = 0; i < NUM_SPECS; i++) {
+		kernel = polyphase_find_kernel(kernel_specs[i].in_rate,
+					       kernel_specs[i].out_rate,
+					       kernel_specs[i].passband_end,
+					       kernel_specs[i].stopband_begin);
+		if (!kernel) {
+			utils_err("No kernel for %u -> %u, regenerate the tables\n",
+				  kernel_specs[i].in_rate,
+				  kernel_specs[i].out_rate);
+			return -1;
+		}
+
+		ret = bench_kernel(kernel);
+		if (ret < 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	const char *path = NULL;
+	int bench = 0;
+	int opt = 0;
+
+	while ((opt = getopt(argc, argv, "g:b")) != -1)
+		switch (opt) {
+		case 'g':
+			path = optarg;
+			break;
+		case 'b':
+			bench = 1;
+			break;
+		default:
+			usage(argv[0]);
+			return -1;
+		}
+
+	if (!path && !bench) {
+		usage(argv[0]);
+		return -1;
+	}
+
+	if (path)
+		return generate_tables(path);
+
+	return bench_kernels();
+}
@@ -20,6 +20,7 @@
 #include "resampler.h"
 #include "utils.h"
 #include "rds_encoder.h"
+#include "fixed_point.h"
 #include <time.h>		/* For gmtime, localtime etc (group 4A) */
 #include <arpa/inet.h>		/* For htons() */
 #include <string.h>		/* For memset/memcpy/strnlen */
@@ -33,20 +34,6 @@
 #include <jack/thread.h>	/* For thread handling through jack */
 #include <signal.h>		/* For raise() */
 
-/*********\
-* HELPERS *
-\*********/
-
-static inline int
-num_resampled_samples(int in_srate, int out_srate, int num_samples)
-{
-	float ratio = (float) out_srate / (float) in_srate;
-	float olenf = ratio * ((float) num_samples);
-	/* Also cover the case where out_srate < in_srate */
-	olenf = fmax(olenf, num_samples - 1.0);
-	return (int) olenf;
-}
-
 /************\
 * MODULATION *
 \************/
@@ -137,6 +124,18 @@ float symbol_waveforms[8][40] = {
 	 -0.519913, -0.380444, -0.231941, -0.077944}
 };
 
+/* The above at the main oscilator's sample rate, see
+ * rds_init_osc_waveforms(), plus a Q15 copy for the
+ * fixed-point path */
+static float osc_symbol_waveforms[8][RDS_OSC_SAMPLES_PER_SYMBOL];
+static int16_t osc_symbol_waveforms_q15[8][RDS_OSC_SAMPLES_PER_SYMBOL];
+
+/* Subcarrier of each stream, stream 0 is modulated by the
+ * 57KHz carrier of the main oscilator */
+static const float rds_stream_freqs[RDS_MAX_STREAMS] = {
+	57000.0, 66500.0, 71250.0, 76000.0
+};
+
 /* Offset words used for calculating checkwords(Anex A, table A.1) */
 static uint16_t offset_words[] = { 0x0FC,	//      A
 	0x198,			//      B
@@ -176,39 +175,121 @@ rds_generate_block(struct rds_block *block)
 	return encoded_block;
 }
 
-/* Get a group and generate its waveform (this is
+/* Get a group and generate its symbols (this is
  * where the modulation happens as described on
- * section 4 of the standard) */
-static int
-rds_generate_group_samples(struct rds_group *group)
+ * section 4 of the standard), the waveform of each
+ * one is picked up from osc_symbol_waveforms when
+ * it's time to send it out */
+static void
+rds_generate_group_symbols(struct rds_stream *stream, struct rds_group *group,
+			   struct rds_group_symbols *out)
 {
-	static uint8_t moving_window = 0;
 	uint8_t current_bit = 0;
 	uint8_t previous_bit = 0;
 	uint32_t current_block = 0;
-	float *buffer = group->samples_buffer;
-	uint16_t buffer_offset = 0;
+	int num_symbols = 0;
 	int i = 0;
 	int j = 0;
 
 	for (i = 0; i < RDS_BLOCKS_PER_GROUP; i++) {
 		current_block = rds_generate_block(&group->blocks[i]);
 		for (j = RDS_BLOCK_SIZE_BITS - 1; j >= 0; j--) {
-			previous_bit = (moving_window & 1);
+			previous_bit = (stream->moving_window & 1);
 			current_bit = (current_block & (1 << j)) ? 1 : 0;
 			/* Differential coding (Section 4.7) */
 			current_bit ^= previous_bit;
 			/* Put current bit on the window and
-			 * append the waveform */
-			moving_window <<= 1;
-			moving_window |= current_bit;
-			memcpy(buffer + buffer_offset,
-			       &symbol_waveforms[moving_window & 0x7][0],
-			       RDS_SAMPLES_PER_SYMBOL * sizeof(float));
-			buffer_offset += RDS_SAMPLES_PER_SYMBOL;
+			 * append its symbol */
+			stream->moving_window <<= 1;
+			stream->moving_window |= current_bit;
+			out->windows[num_symbols++] =
+					stream->moving_window & 0x7;
 		}
 	}
 
+	out->num_symbols = num_symbols;
+}
+
+/* Build the symbol waveforms at the main oscilator's sample rate
+ * through Catmull-Rom interpolation, the waveforms are smooth enough
+ * (the symbols' spectrum ends at 2.4KHz) for that to be accurate.
+ * The samples beyond the edges come from the waveforms before / after
+ * each one, since the window moves by one bit they all share the
+ * same edges (e.g. 010 may only be followed by 100 or 101). */
+static void
+rds_init_osc_waveforms(void)
+{
+	float p[RDS_SAMPLES_PER_SYMBOL + 3] = { 0 };
+	const float *prev = NULL;
+	const float *next = NULL;
+	double x = 0.0;
+	float t = 0.0;
+	int w = 0;
+	int i = 0;
+	int j = 0;
+
+	for (w = 0; w < 8; w++) {
+		prev = symbol_waveforms[w >> 1];
+		next = symbol_waveforms[(w & 0x3) << 1];
+		p[0] = prev[RDS_SAMPLES_PER_SYMBOL - 1];
+		memcpy(p + 1, symbol_waveforms[w],
+		       RDS_SAMPLES_PER_SYMBOL * sizeof(float));
+		p[RDS_SAMPLES_PER_SYMBOL + 1] = next[0];
+		p[RDS_SAMPLES_PER_SYMBOL + 2] = next[1];
+
+		for (i = 0; i < RDS_OSC_SAMPLES_PER_SYMBOL; i++) {
+			x = (double) i * RDS_SAMPLES_PER_SYMBOL /
+			    RDS_OSC_SAMPLES_PER_SYMBOL;
+			j = (int) x;
+			t = (float) (x - j);
+			/* The j-th sample is at p[j + 1] */
+			osc_symbol_waveforms[w][i] = p[j + 1] + 0.5 * t *
+				(p[j + 2] - p[j] + t *
+				 (2.0 * p[j] - 5.0 * p[j + 1] +
+				  4.0 * p[j + 2] - p[j + 3] + t *
+				  (3.0 * (p[j + 1] - p[j + 2]) +
+				   p[j + 3] - p[j])));
+			osc_symbol_waveforms_q15[w][i] =
+				fxp_q15_from_float(osc_symbol_waveforms[w][i]);
+		}
+	}
+}
+
+/* Fill in the subcarrier tables of the RDS2 streams, phase-locked
+ * to the pilot as long as they are indexed by the sample within
+ * the current second (see rds_get_upper_samples()) */
+static int
+rds_init_carriers(struct rds_encoder *enc, uint32_t osc_samplerate)
+{
+	struct rds_stream *stream = NULL;
+	double cycles = 0.0;
+	uint32_t period = 0;
+	int i = 0;
+	int j = 0;
+
+	for (i = 1; i < enc->num_streams; i++) {
+		stream = &enc->streams[i];
+		stream->freq = rds_stream_freqs[i];
+
+		/* Shortest number of samples with a whole
+		 * number of cycles */
+		for (period = 1; period <= RDS2_CARRIER_MAX_PERIOD; period++) {
+			cycles = (double) stream->freq * period /
+				 (double) osc_samplerate;
+			if (fabs(cycles - round(cycles)) < 1e-9)
+				break;
+		}
+		if (period > RDS2_CARRIER_MAX_PERIOD)
+			return -1;
+		stream->carrier_period = period;
+
+		for (j = 0; j < RDS2_CARRIER_TABLE_LEN; j++)
+			stream->carrier[j] = (float) sin(2.0L * M_PI *
+						(double) stream->freq *
+						(double) j /
+						(double) osc_samplerate);
+	}
+
 	return 0;
 }
 
@@ -219,10 +300,10 @@ rds_generate_group_samples(struct rds_group *group)
 /* Group 0A/0B: Basic tuning and switching information
  * (Section 6.1.5.1) */
 static int
-rds_generate_group_0(const struct rds_encoder *enc, struct rds_group *group,
-		     uint8_t version)
+rds_generate_group_0(const struct rds_encoder *enc, struct rds_stream *stream,
+		     struct rds_group *group, uint8_t version)
 {
-	struct rds_encoder_state *st = enc->state;
+	const struct rds_encoder_state *st = enc->state;
 	uint16_t temp_infoword = 0;
 
 	/*
@@ -231,7 +312,8 @@ rds_generate_group_0(const struct rds_encoder *enc, struct rds_group *group,
 	 *              (bit number maps to the idx so it's 0 - 3), and
 	 *              2 bits for the ps index.
 	 */
-	temp_infoword = st->ps_idx | ((st->di >> (3 - st->ps_idx)) & 1) << 2 |
+	temp_infoword = stream->ps_idx |
+			((st->di >> (3 - stream->ps_idx)) & 1) << 2 |
 			(st->ms & 1) << 3 | (st->ta & 1) << 4;
 	group->blocks[1].infoword |= temp_infoword;
 
@@ -239,12 +321,12 @@ rds_generate_group_0(const struct rds_encoder *enc, struct rds_group *group,
 	 * the data on the af array are properly formatted according to
 	 * section 6.2.1.6 We only support method A */
 	if (version == RDS_GROUP_VERSION_A) {
-		group->blocks[2].infoword = (st->af_data[st->af_idx] << 8) |
-					     st->af_data[st->af_idx + 1];
-		if (st->af_idx >= 10)
-			st->af_idx = 0;
+		group->blocks[2].infoword = (st->af_data[stream->af_idx] << 8) |
+					     st->af_data[stream->af_idx + 1];
+		if (stream->af_idx >= 10)
+			stream->af_idx = 0;
 		else
-			st->af_idx += 2;
+			stream->af_idx += 2;
 		group->blocks[2].infoword = temp_infoword;
 	}
 
@@ -253,12 +335,12 @@ rds_generate_group_0(const struct rds_encoder *enc, struct rds_group *group,
 	 *              (It takes 4 0A/0B groups to transmit the
 	 *              full DI and PS fields)
 	 */
-	group->blocks[3].infoword = (st->ps[2 * st->ps_idx] << 8) |
-				     st->ps[2 * st->ps_idx + 1];
-	if (st->ps_idx >= 3)
-		st->ps_idx = 0;
+	group->blocks[3].infoword = (st->ps[2 * stream->ps_idx] << 8) |
+				     st->ps[2 * stream->ps_idx + 1];
+	if (stream->ps_idx >= 3)
+		stream->ps_idx = 0;
 	else
-		st->ps_idx++;
+		stream->ps_idx++;
 
 	return 0;
 }
@@ -266,11 +348,10 @@ rds_generate_group_0(const struct rds_encoder *enc, struct rds_group *group,
 /* Group 1A/B PIN and Slow labeling codes
  * (Section 6.1.5.2) */
 static int
-rds_generate_group_1(const struct rds_encoder *enc, struct rds_group *group,
-		     uint8_t version)
+rds_generate_group_1(const struct rds_encoder *enc, struct rds_stream *stream,
+		     struct rds_group *group, uint8_t version)
 {
 	const struct rds_encoder_state *st = enc->state;
-	static int vcode = 0;
 
 	/*
 	 * We only do this for Extended Country Code (ECC) and
@@ -289,9 +370,9 @@ rds_generate_group_1(const struct rds_encoder *enc, struct rds_group *group,
 	 *              then comes the variant code (it's 0 for ECC
 	 *              and 3 for LIC)
 	 */
-	vcode = (vcode == 0) ? 3 : 0;
-	group->blocks[2].infoword = (vcode == 0 ? st->ecc & 0xFF :
-				     st->lic & 0xFFF) | (vcode << 12);
+	stream->vcode = (stream->vcode == 0) ? 3 : 0;
+	group->blocks[2].infoword = (stream->vcode == 0 ? st->ecc & 0xFF :
+				     st->lic & 0xFFF) | (stream->vcode << 12);
 
 	return 0;
 }
@@ -299,10 +380,10 @@ rds_generate_group_1(const struct rds_encoder *enc, struct rds_group *group,
 /* Group 2A/2B: RadioText
  * (Section 6.1.5.3) */
 static int
-rds_generate_group_2(const struct rds_encoder *enc, struct rds_group *group,
-		     uint8_t version)
+rds_generate_group_2(const struct rds_encoder *enc, struct rds_stream *stream,
+		     struct rds_group *group, uint8_t version)
 {
-	struct rds_encoder_state *st = enc->state;
+	const struct rds_encoder_state *st = enc->state;
 	uint16_t temp_infoword = 0;
 
 	/*
@@ -310,7 +391,7 @@ rds_generate_group_2(const struct rds_encoder *enc, struct rds_group *group,
 	 *              the RT buffer on the receiver) next 4 bits is the
 	 *              index (0 - 14)
 	 */
-	temp_infoword = (st->rt_idx & 0xF) | (st->rt_flush & 1) << 4;
+	temp_infoword = (stream->rt_idx & 0xF) | (st->rt_flush & 1) << 4;
 	group->blocks[1].infoword |= temp_infoword;
 
 	/*
@@ -333,16 +414,16 @@ rds_generate_group_2(const struct rds_encoder *enc, struct rds_group *group,
 	if (version != RDS_GROUP_VERSION_A)
 		return -1;
 
-	group->blocks[2].infoword = st->rt[4 * st->rt_idx] << 8 |
-				    st->rt[4 * st->rt_idx + 1];
+	group->blocks[2].infoword = st->rt[4 * stream->rt_idx] << 8 |
+				    st->rt[4 * stream->rt_idx + 1];
 
-	group->blocks[3].infoword = st->rt[4 * st->rt_idx + 2] << 8 |
-				    st->rt[4 * st->rt_idx + 3];
+	group->blocks[3].infoword = st->rt[4 * stream->rt_idx + 2] << 8 |
+				    st->rt[4 * stream->rt_idx + 3];
 
-	st->rt_idx++;
+	stream->rt_idx++;
 
-	if (st->rt_idx >= st->rt_segments)
-		st->rt_idx = 0;
+	if (stream->rt_idx >= st->rt_segments)
+		stream->rt_idx = 0;
 
 	return 0;
 }
@@ -351,6 +432,7 @@ rds_generate_group_2(const struct rds_encoder *enc, struct rds_group *group,
  * (Section 6.1.5.6) */
 static int
 rds_generate_group_4(__attribute__((unused)) const struct rds_encoder *enc,
+		     __attribute__((unused)) struct rds_stream *stream,
 		     struct rds_group *group, uint8_t version)
 {
 	struct tm utc;
@@ -418,10 +500,10 @@ rds_generate_group_4(__attribute__((unused)) const struct rds_encoder *enc,
 /* Group 10A: Programme type name (PTYN)
  * (Section 6.1.5.14) */
 static int
-rds_generate_group_10(const struct rds_encoder *enc, struct rds_group *group,
-		      uint8_t version)
+rds_generate_group_10(const struct rds_encoder *enc, struct rds_stream *stream,
+		      struct rds_group *group, uint8_t version)
 {
-	struct rds_encoder_state *st = enc->state;
+	const struct rds_encoder_state *st = enc->state;
 	int temp_infoword = 0;
 
 	/* Group 10B is Open Data and it's not supported */
@@ -431,22 +513,22 @@ rds_generate_group_10(const struct rds_encoder *enc, struct rds_group *group,
 	/*
 	 * Block 2 end -> A/B (flush) flag, 3 zeroes and the 1bit index
 	 */
-	temp_infoword = st->ptyn_idx | st->ptyn_flush << 4;
+	temp_infoword = stream->ptyn_idx | st->ptyn_flush << 4;
 	group->blocks[1].infoword |= temp_infoword;
 
 	/*
 	 * Block 3/4 -> 2 characters from the PTYN
 	 */
-	group->blocks[2].infoword = st->ptyn[4 * st->ptyn_idx] << 8 |
-				    st->ptyn[4 * st->ptyn_idx + 1];
+	group->blocks[2].infoword = st->ptyn[4 * stream->ptyn_idx] << 8 |
+				    st->ptyn[4 * stream->ptyn_idx + 1];
 
-	group->blocks[3].infoword = st->ptyn[4 * st->ptyn_idx + 2] << 8 |
-				    st->ptyn[4 * st->ptyn_idx + 3];
+	group->blocks[3].infoword = st->ptyn[4 * stream->ptyn_idx + 2] << 8 |
+				    st->ptyn[4 * stream->ptyn_idx + 3];
 
-	if (st->ptyn_idx == 1)
-		st->ptyn_idx = 0;
+	if (stream->ptyn_idx == 1)
+		stream->ptyn_idx = 0;
 	else
-		st->ptyn_idx = 1;
+		stream->ptyn_idx = 1;
 
 	return 0;
 }
@@ -454,10 +536,10 @@ rds_generate_group_10(const struct rds_encoder *enc, struct rds_group *group,
 /* Group 15B: Fast basic tuning and switching information
  * (Section 6.1.5.21) */
 static int
-rds_generate_group_15(const struct rds_encoder *enc, struct rds_group *group,
-		      uint8_t version)
+rds_generate_group_15(const struct rds_encoder *enc, struct rds_stream *stream,
+		      struct rds_group *group, uint8_t version)
 {
-	struct rds_encoder_state *st = enc->state;
+	const struct rds_encoder_state *st = enc->state;
 	uint16_t temp_infoword = 0;
 
 	/*
@@ -466,7 +548,8 @@ rds_generate_group_15(const struct rds_encoder *enc, struct rds_group *group,
 	 *              (bit number maps to the idx so it's 0 - 3), and
 	 *              2 bits for the ps index.
 	 */
-	temp_infoword = st->ps_idx | ((st->di >> (3 - st->ps_idx)) & 1) << 2 |
+	temp_infoword = stream->ps_idx |
+			((st->di >> (3 - stream->ps_idx)) & 1) << 2 |
 			(st->ms & 1) << 3 | (st->ta & 1) << 4;
 	group->blocks[1].infoword |= temp_infoword;
 
@@ -481,10 +564,10 @@ rds_generate_group_15(const struct rds_encoder *enc, struct rds_group *group,
 
 	/* Use PS index for this one too since we send this only if PS
 	 * is not set (if it is we send a 0B instead) */
-	if (st->ps_idx >= 3)
-		st->ps_idx = 0;
+	if (stream->ps_idx >= 3)
+		stream->ps_idx = 0;
 	else
-		st->ps_idx++;
+		stream->ps_idx++;
 
 	return 0;
 }
@@ -492,8 +575,8 @@ rds_generate_group_15(const struct rds_encoder *enc, struct rds_group *group,
 /* Wrapper to handle common group characteristics and call
  * the propper group-specific function */
 static int
-rds_generate_group(const struct rds_encoder *enc, struct rds_group *group,
-		   uint8_t code, uint8_t version)
+rds_generate_group(const struct rds_encoder *enc, struct rds_stream *stream,
+		   struct rds_group *group, uint8_t code, uint8_t version)
 {
 	const struct rds_encoder_state *st = enc->state;
 	int i = 0;
@@ -531,168 +614,194 @@ rds_generate_group(const struct rds_encoder *enc, struct rds_group *group,
 
 	switch (code) {
 	case 0:
-		ret = rds_generate_group_0(enc, group, version);
+		ret = rds_generate_group_0(enc, stream, group, version);
 		break;
 	case 1:
-		ret = rds_generate_group_1(enc, group, version);
+		ret = rds_generate_group_1(enc, stream, group, version);
 		break;
 	case 2:
-		ret = rds_generate_group_2(enc, group, version);
+		ret = rds_generate_group_2(enc, stream, group, version);
 		break;
 	case 4:
-		ret = rds_generate_group_4(enc, group, version);
+		ret = rds_generate_group_4(enc, stream, group, version);
 		break;
 	case 10:
-		ret = rds_generate_group_10(enc, group, version);
+		ret = rds_generate_group_10(enc, stream, group, version);
 		break;
 	case 15:
-		ret = rds_generate_group_15(enc, group, version);
+		ret = rds_generate_group_15(enc, stream, group, version);
 		break;
 	default:
 		return -1;
 	}
 
-	if (ret < 0)
-		return ret;
-
-	return rds_generate_group_samples(group);
+	return ret;
 }
 
 /*****************\
 * GROUP SCHEDULER *
 \*****************/
 
+/* Each stream has its own scheduler, the RDS2 streams carry
+ * the same groups as the legacy one, at their own pace */
 static int
-rds_get_next_group(struct rds_encoder *enc, struct rds_group *group)
+rds_get_next_group(struct rds_encoder *enc, struct rds_stream *stream,
+		   struct rds_group *group)
 {
 	const struct rds_encoder_state *st = enc->state;
-	static int8_t groups_per_sec_counter = 0;
-	static uint16_t groups_per_min_counter = 0;
-	static uint8_t ptyn_cnt = 0;
 	int ret = 0;
 
 	/* Every 1 min send the 4A (CT) group and reset
 	 * the counter */
-	if (groups_per_min_counter >= RDS_GROUPS_PER_MIN) {
-		ret = rds_generate_group(enc, group, 4, RDS_GROUP_VERSION_A);
+	if (stream->groups_per_min_counter >= RDS_GROUPS_PER_MIN) {
+		ret = rds_generate_group(enc, stream, group, 4,
+					 RDS_GROUP_VERSION_A);
 		if (ret >= 0)
-			groups_per_min_counter = 0;
+			stream->groups_per_min_counter = 0;
 		return ret;
 	}
 	/* On every second send the PS and the DI one time
 	 * (so 4 0A/OB groups). This matches table 4 that
 	 * shows the repetition rates of each group
 	 * and will also update TA, MS and AF */
-	if (groups_per_sec_counter < 4) {
+	if (stream->groups_per_sec_counter < 4) {
 		if (st->ps_set) {
 			if (st->af_set)
-				ret = rds_generate_group(enc, group, 0,
+				ret = rds_generate_group(enc, stream, group, 0,
 							 RDS_GROUP_VERSION_A);
 			else
-				ret = rds_generate_group(enc, group, 0,
+				ret = rds_generate_group(enc, stream, group, 0,
 							 RDS_GROUP_VERSION_B);
 		} else
-			ret = rds_generate_group(enc, group, 15,
+			ret = rds_generate_group(enc, stream, group, 15,
 						 RDS_GROUP_VERSION_B);
 	}
 	/* Send a 1A group to update ECC / LIC on the receiver */
-	else if (groups_per_sec_counter < 5 && (st->ecc_set || st->lic_set)) {
-		ret = rds_generate_group(enc, group, 1, RDS_GROUP_VERSION_A);
+	else if (stream->groups_per_sec_counter < 5 &&
+		 (st->ecc_set || st->lic_set)) {
+		ret = rds_generate_group(enc, stream, group, 1,
+					 RDS_GROUP_VERSION_A);
 	}
 	/* Send 2 10A groups for PTYN if available */
-	else if (groups_per_sec_counter < 7 && st->ptyn_set && ptyn_cnt < 2) {
-		ret = rds_generate_group(enc, group, 10, RDS_GROUP_VERSION_A);
-		ptyn_cnt++;
+	else if (stream->groups_per_sec_counter < 7 && st->ptyn_set &&
+		 stream->ptyn_cnt < 2) {
+		ret = rds_generate_group(enc, stream, group, 10,
+					 RDS_GROUP_VERSION_A);
+		stream->ptyn_cnt++;
 	}
 	/* On the remaining slots send 2A groups to set
 	 * the RT buffer on the receiver */
-	else if (groups_per_sec_counter < RDS_GROUPS_PER_SEC && st->rt_set) {
-		ret = rds_generate_group(enc, group, 2, RDS_GROUP_VERSION_A);
+	else if (stream->groups_per_sec_counter < RDS_GROUPS_PER_SEC &&
+		 st->rt_set) {
+		ret = rds_generate_group(enc, stream, group, 2,
+					 RDS_GROUP_VERSION_A);
 	} else {
-		groups_per_sec_counter = -1;
-		ret = rds_get_next_group(enc, group);
+		stream->groups_per_sec_counter = -1;
+		ret = rds_get_next_group(enc, stream, group);
 	}
 
 	if (ret >= 0) {
-		groups_per_sec_counter++;
-		groups_per_min_counter++;
+		stream->groups_per_sec_counter++;
+		stream->groups_per_min_counter++;
 	}
 
-	if (ptyn_cnt >= 2)
-		ptyn_cnt = 0;
+	if (stream->ptyn_cnt >= 2)
+		stream->ptyn_cnt = 0;
 
 	return ret;
 }
 
-/* Ask a group from the scheduler and upsample its
- * waveform to the oscilator's sample rate so that it
- * can be modulated by the 57KHz subcarrier */
-static struct rds_upsampled_group *
-rds_get_next_upsampled_group(struct rds_encoder *enc)
+/* Ask a group from the stream's scheduler and put its
+ * symbols on the stream's unused output buffer */
+static int
+rds_get_next_group_symbols(struct rds_encoder *enc, int stream_idx)
 {
-	const struct resampler_data *rsmpl = enc->rsmpl;
+	struct rds_encoder_state *st = enc->state;
+	struct rds_stream *stream = &enc->streams[stream_idx];
 	struct rds_group next_group;
-	struct rds_upsampled_group *outbuf = NULL;
 	int out_idx = 0;
 	int ret = 0;
 
 	/* Encoder is inactive or is being terminated
 	 * so skip processing */
 	if (enc->status != RDS_ENC_ACTIVE)
-		return NULL;
+		return 0;
 
 	/* Only mess with the unused output buffer */
-	out_idx = enc->curr_outbuf_idx == 0 ? 1 : 0;
-	outbuf = &enc->outbuf[out_idx];
+	out_idx = stream->curr_outbuf_idx == 0 ? 1 : 0;
+
+	/* The legacy stream picks up where the state says it
+	 * is on PS / RT etc, since the setters may reset them */
+	if (stream_idx == 0) {
+		stream->ps_idx = st->ps_idx;
+		stream->af_idx = st->af_idx;
+		stream->rt_idx = st->rt_idx;
+		stream->ptyn_idx = st->ptyn_idx;
+	}
 
 	/* Update current group */
-	ret = rds_get_next_group(enc, &next_group);
-	if (unlikely(ret < 0)) {
-		outbuf->result = -1;
-		goto cleanup;
+	ret = rds_get_next_group(enc, stream, &next_group);
+
+	if (stream_idx == 0) {
+		st->ps_idx = stream->ps_idx;
+		st->af_idx = stream->af_idx;
+		st->rt_idx = stream->rt_idx;
+		st->ptyn_idx = stream->ptyn_idx;
 	}
 
-	/* Resample current group's waveform to the
-	 * main oscilators sampling rate */
-	outbuf->waveform_samples =
-			resampler_upsample_rds(rsmpl,
-						next_group.
-						samples_buffer,
-						outbuf->waveform,
-						RDS_GROUP_SAMPLES,
-						enc->upsampled_waveform_len);
-	if (unlikely(outbuf->waveform_samples < 0)) {
-		outbuf->waveform_samples = 0;
-		outbuf->result = -2;
-		goto cleanup;
-	} else
-		outbuf->result = 0;
+	if (unlikely(ret < 0))
+		return -1;
 
- cleanup:
-	return outbuf;
+	rds_generate_group_symbols(stream, &next_group,
+				   &stream->outbuf[out_idx]);
+
+	return 0;
+}
+
+static int
+rds_refill_pending(const struct rds_encoder *enc)
+{
+	int i = 0;
+
+	for (i = 0; i < enc->num_streams; i++)
+		if (__atomic_load_n(&enc->streams[i].refill, __ATOMIC_ACQUIRE))
+			return 1;
+
+	return 0;
 }
 
 static void *
 rds_main_loop(void *arg)
 {
 	struct rds_encoder *enc = (struct rds_encoder *)arg;
-	struct rds_upsampled_group *outbuf = NULL;
+	int ret = 0;
+	int i = 0;
 
 	while (enc->status == RDS_ENC_ACTIVE) {
 		pthread_mutex_lock(&enc->rds_process_mutex);
-		while (pthread_cond_wait(&enc->rds_process_trigger,
-					 &enc->rds_process_mutex) != 0);
+		/* The streams switch groups at the same time, so
+		 * handle all pending requests on each wakeup */
+		while (enc->status == RDS_ENC_ACTIVE &&
+		       !rds_refill_pending(enc))
+			pthread_cond_wait(&enc->rds_process_trigger,
+					  &enc->rds_process_mutex);
 
 		if (enc->status != RDS_ENC_ACTIVE) {
 			pthread_mutex_unlock(&enc->rds_process_mutex);
 			break;
 		}
 
-		outbuf = rds_get_next_upsampled_group(enc);
-		if (outbuf->result < 0) {
-			enc->status = RDS_ENC_FAILED;
-			utils_err("[RDS] Group generation failed with code: %i\n",
-				  outbuf->result);
+		for (i = 0; i < enc->num_streams; i++) {
+			if (!__atomic_exchange_n(&enc->streams[i].refill, 0,
+						 __ATOMIC_ACQ_REL))
+				continue;
+			ret = rds_get_next_group_symbols(enc, i);
+			if (ret < 0) {
+				enc->status = RDS_ENC_FAILED;
+				utils_err("[RDS] Group generation failed on stream %i with code: %i\n",
+					  i, ret);
+				break;
+			}
 		}
 		pthread_mutex_unlock(&enc->rds_process_mutex);
 	}
@@ -707,39 +816,169 @@ rds_main_loop(void *arg)
 * ENTRY POINT *
 \*************/
 
-/* The callback from the main loop to get the
- * next -upsampled- waveform sample */
-float
-rds_get_next_sample(struct rds_encoder *enc)
+/* Get the waveform of the current symbol, moving on to the next
+ * group when the current one is over. Returns the number of samples
+ * left on that waveform (starting from stream->samples_out), 0 if the
+ * next group is not there yet. */
+static inline int
+rds_stream_next_chunk(struct rds_encoder *enc, struct rds_stream *stream,
+		      int *window)
+{
+	const struct rds_group_symbols *outbuf = NULL;
+
+	outbuf = &stream->outbuf[stream->curr_outbuf_idx];
+
+	/* Last group was sent, go for the next one */
+	if (stream->symbols_out >= outbuf->num_symbols) {
+		/* Switch to the new output buffer */
+		stream->curr_outbuf_idx = stream->curr_outbuf_idx == 0 ? 1 : 0;
+
+		/* Ask for a new group to be generated on the old buffer */
+		__atomic_store_n(&stream->refill, 1, __ATOMIC_RELEASE);
+		pthread_cond_signal(&enc->rds_process_trigger);
+
+		/* Reset counters and start consuming the new buffer */
+		stream->symbols_out = 0;
+		stream->samples_out = 0;
+		outbuf = &stream->outbuf[stream->curr_outbuf_idx];
+
+		/* Not there yet */
+		if (unlikely(!outbuf->num_symbols))
+			return 0;
+	}
+
+	*window = outbuf->windows[stream->symbols_out];
+
+	return RDS_OSC_SAMPLES_PER_SYMBOL - stream->samples_out;
+}
+
+static inline void
+rds_stream_consume(struct rds_stream *stream, int num_samples)
+{
+	stream->samples_out += num_samples;
+	if (stream->samples_out >= RDS_OSC_SAMPLES_PER_SYMBOL) {
+		stream->samples_out = 0;
+		stream->symbols_out++;
+	}
+}
+
+/* The callback from the main loop to get the next
+ * num_samples -upsampled- waveform samples. Returns the
+ * number of samples written to out, 0 if the encoder is
+ * disabled, in which case the caller may skip RDS altogether. */
+int
+rds_get_samples(struct rds_encoder *enc, float *out, int num_samples)
 {
-	const struct rds_upsampled_group *outbuf = &enc->outbuf[enc->curr_outbuf_idx];
 	const struct rds_encoder_state *st = enc->state;
-	static int samples_out = 0;
-	float out = 0;
+	struct rds_stream *stream = &enc->streams[0];
+	const float *wf = NULL;
+	int window = 0;
+	int chunk = 0;
+	int done = 0;
 
 	/* Encoder is disabled, don't do any processing */
 	if (enc->status != RDS_ENC_ACTIVE || !st->enabled)
 		return 0;
 
-	/* We have remaining samples from the last group */
-	if (samples_out < outbuf->waveform_samples) {
-		out = outbuf->waveform[samples_out++];
-		return out;
+	while (done < num_samples) {
+		chunk = rds_stream_next_chunk(enc, stream, &window);
+		if (unlikely(!chunk))
+			break;
+		if (chunk > num_samples - done)
+			chunk = num_samples - done;
+
+		wf = osc_symbol_waveforms[window] + stream->samples_out;
+		memcpy(out + done, wf, chunk * sizeof(float));
+		rds_stream_consume(stream, chunk);
+		done += chunk;
 	}
 
-	/* Last group was sent, go for the next one */
+	if (done < num_samples)
+		memset(out + done, 0, (num_samples - done) * sizeof(float));
 
-	/* Switch to the new output buffer */
-	enc->curr_outbuf_idx = enc->curr_outbuf_idx == 0 ? 1 : 0;
+	return num_samples;
+}
 
-	/* Ask for a new group to be generated on the old buffer */
-	pthread_cond_signal(&enc->rds_process_trigger);
+/* Same as above in Q15, for the fixed-point path */
+int
+rds_get_samples_q15(struct rds_encoder *enc, int16_t *out, int num_samples)
+{
+	const struct rds_encoder_state *st = enc->state;
+	struct rds_stream *stream = &enc->streams[0];
+	const int16_t *wf = NULL;
+	int window = 0;
+	int chunk = 0;
+	int done = 0;
+
+	if (enc->status != RDS_ENC_ACTIVE || !st->enabled)
+		return 0;
+
+	while (done < num_samples) {
+		chunk = rds_stream_next_chunk(enc, stream, &window);
+		if (unlikely(!chunk))
+			break;
+		if (chunk > num_samples - done)
+			chunk = num_samples - done;
+
+		wf = osc_symbol_waveforms_q15[window] + stream->samples_out;
+		memcpy(out + done, wf, chunk * sizeof(int16_t));
+		rds_stream_consume(stream, chunk);
+		done += chunk;
+	}
+
+	if (done < num_samples)
+		memset(out + done, 0, (num_samples - done) * sizeof(int16_t));
+
+	return num_samples;
+}
+
+/* Same for the RDS2 streams, their sum is written to out already
+ * modulated by each one's subcarrier. pos is the sample within the
+ * current second (of the main oscilator) that out starts from, so
+ * that the subcarriers stay phase-locked to the pilot. Returns 0 if
+ * there are no RDS2 streams or the encoder is disabled. */
+int
+rds_get_upper_samples(struct rds_encoder *enc, float *out, int num_samples,
+		      uint32_t pos)
+{
+	const struct rds_encoder_state *st = enc->state;
+	struct rds_stream *stream = NULL;
+	const float *carrier = NULL;
+	const float *wf = NULL;
+	int window = 0;
+	int chunk = 0;
+	int done = 0;
+	int i = 0;
+	int j = 0;
+
+	if (enc->status != RDS_ENC_ACTIVE || !st->enabled ||
+	    enc->num_streams < 2)
+		return 0;
+
+	memset(out, 0, num_samples * sizeof(float));
+
+	for (i = 1; i < enc->num_streams; i++) {
+		stream = &enc->streams[i];
+		for (done = 0; done < num_samples; done += chunk) {
+			chunk = rds_stream_next_chunk(enc, stream, &window);
+			if (unlikely(!chunk))
+				break;
+			if (chunk > num_samples - done)
+				chunk = num_samples - done;
+
+			/* Within a symbol both the waveform and the
+			 * carrier are contiguous */
+			wf = osc_symbol_waveforms[window] + stream->samples_out;
+			carrier = stream->carrier +
+				  (pos + done) % stream->carrier_period;
+			for (j = 0; j < chunk; j++)
+				out[done + j] += wf[j] * carrier[j];
+
+			rds_stream_consume(stream, chunk);
+		}
+	}
 
-	/* Reset counter and start consuming the new buffer */
-	samples_out = 0;
-	outbuf = &enc->outbuf[enc->curr_outbuf_idx];
-	out = outbuf->waveform[samples_out++];
-	return out;
+	return num_samples;
 }
 
 /****************\
@@ -748,7 +987,7 @@ rds_get_next_sample(struct rds_encoder *enc)
 
 int
 rds_encoder_init(struct rds_encoder *enc, jack_client_t *client,
-		 struct resampler_data *rsmpl)
+		 uint32_t osc_samplerate, int num_streams)
 {
 	int ret = 0;
 
@@ -756,7 +995,6 @@ rds_encoder_init(struct rds_encoder *enc, jack_client_t *client,
 		return -1;
 
 	memset(enc, 0, sizeof(struct rds_encoder));
-	enc->rsmpl = rsmpl;
 
 	enc->status = RDS_ENC_INACTIVE;
 
@@ -772,26 +1010,29 @@ rds_encoder_init(struct rds_encoder *enc, jack_client_t *client,
 	enc->state = (struct rds_encoder_state*) enc->state_map->mem;
 	utils_dbg("[RDS] Control channel ready\n");
 
-	/* Allocate buffers */
-	enc->upsampled_waveform_len = num_resampled_samples(RDS_SAMPLE_RATE,
-							    rsmpl->osc_samplerate,
-							    RDS_GROUP_SAMPLES);
-	enc->upsampled_waveform_len *= sizeof(float);
-
-
-	enc->outbuf[0].waveform = (float *) malloc(enc->upsampled_waveform_len);
-	if (enc->outbuf[0].waveform == NULL) {
+	/* The symbol waveforms are synthesized for this one */
+	if (osc_samplerate != RDS_OSC_SAMPLE_RATE) {
+		utils_err("[RDS] Unsupported oscilator sample rate: %u\n",
+			  osc_samplerate);
 		ret = -3;
 		goto cleanup;
 	}
-	memset(enc->outbuf[0].waveform, 0, enc->upsampled_waveform_len);
+	rds_init_osc_waveforms();
+
+	if (num_streams < 1)
+		num_streams = 1;
+	if (num_streams > RDS_MAX_STREAMS)
+		num_streams = RDS_MAX_STREAMS;
+	enc->num_streams = num_streams;
 
-	enc->outbuf[1].waveform = (float *) malloc(enc->upsampled_waveform_len);
-	if (enc->outbuf[1].waveform == NULL) {
+	ret = rds_init_carriers(enc, osc_samplerate);
+	if (ret < 0) {
 		ret = -4;
 		goto cleanup;
 	}
-	memset(enc->outbuf[1].waveform, 0, enc->upsampled_waveform_len);
+	if (num_streams > 1)
+		utils_info("[RDS] RDS2 enabled, %i extra streams\n",
+			   num_streams - 1);
 
 	/* Set default state */
 	enc->state->ms = RDS_MS_DEFAULT;
@@ -861,14 +1102,6 @@ rds_encoder_destroy(struct rds_encoder *enc)
 	pthread_mutex_destroy(&enc->rds_process_mutex);
 	pthread_cond_destroy(&enc->rds_process_trigger);
 
-	if (enc->outbuf[0].waveform != NULL) {
-		free(enc->outbuf[0].waveform);
-		enc->outbuf[0].waveform = NULL;
-	} if (enc->outbuf[1].waveform != NULL) {
-		free(enc->outbuf[1].waveform);
-		enc->outbuf[1].waveform = NULL;
-	}
-
 	utils_dbg("[RDS] Destroyed\n");
 
 	/* Signal the parent it's game over, in case we
@@ -52,6 +52,29 @@
 /* Sample rate of the RDS encoder -> 47500Hz */
 #define RDS_SAMPLE_RATE	((RDS_BASIC_CLOCK_FREQ_x2 * RDS_SAMPLES_PER_SYMBOL) / 2)
 
+/* The waveforms are synthesized directly at the main oscilator's sample
+ * rate (228KHz, see oscilator.h), where each symbol is exactly 192
+ * samples, instead of going through a resampler. */
+#define RDS_OSC_SAMPLES_PER_SYMBOL	192
+#define RDS_OSC_SAMPLE_RATE	((RDS_BASIC_CLOCK_FREQ_x2 * \
+				  RDS_OSC_SAMPLES_PER_SYMBOL) / 2)
+
+/*
+ * RDS2 adds up to three more data streams, each one on its own subcarrier
+ * at 66.5, 71.25 and 76KHz (3.5, 3.75 and 4 times the pilot), stream 0 is
+ * the legacy one on 57KHz. The number of extra streams is set on startup
+ * through RDS_STREAMS_ENV (0 - 3).
+ */
+#define RDS_MAX_STREAMS		4
+#define RDS_STREAMS_ENV		"JMPXRDS_RDS2_STREAMS"
+
+/* At 228KHz the upper subcarriers repeat every 24 samples at most (66.5KHz
+ * is 7 cycles in 24 samples), their tables have an extra symbol's worth of
+ * samples so that a symbol may start anywhere within a cycle. */
+#define RDS2_CARRIER_MAX_PERIOD	24
+#define RDS2_CARRIER_TABLE_LEN	(RDS2_CARRIER_MAX_PERIOD + \
+				 RDS_OSC_SAMPLES_PER_SYMBOL)
+
 /*
  * Basic RDS data format elements (section 5.1)
  * The data transmitted is split in blocks, each block has an infoword
@@ -84,18 +107,43 @@ struct rds_group {
 	int code;
 	int version;
 	struct rds_block blocks[RDS_BLOCKS_PER_GROUP];
-	uint16_t last_sample_idx;
-	float samples_buffer[RDS_GROUP_SAMPLES];
 };
 
 #define RDS_GROUP_VERSION_A	0
 #define	RDS_GROUP_VERSION_B	1
 #define RDS_GROUP_VERSION_MAX	RDS_GROUP_VERSION_B
 
-struct rds_upsampled_group {
-	float *waveform;
-	int waveform_samples;
-	int result;
+/* A group's symbols, as the value of the 3bit moving window
+ * (the index on the waveform table) for each one */
+struct rds_group_symbols {
+	uint8_t windows[RDS_GROUP_SIZE_BITS];
+	int num_symbols;
+};
+
+struct rds_stream {
+	struct rds_group_symbols outbuf[2];
+	int curr_outbuf_idx;
+	/* Position within the current group */
+	int symbols_out;
+	int samples_out;
+	/* Set when the unused buffer needs a new group */
+	int refill;
+	uint8_t moving_window;
+	/* Group scheduler */
+	int8_t groups_per_sec_counter;
+	uint16_t groups_per_min_counter;
+	uint8_t ptyn_cnt;
+	/* Where we are on PS / AF / RT / PTYN, stream 0 keeps
+	 * them in sync with the ones on the encoder's state */
+	uint8_t ps_idx;
+	uint8_t af_idx;
+	uint8_t rt_idx;
+	uint8_t ptyn_idx;
+	int vcode;
+	/* Subcarrier (RDS2 streams only) */
+	float freq;
+	uint32_t carrier_period;
+	float carrier[RDS2_CARRIER_TABLE_LEN];
 };
 
 #define RDS_PS_LENGTH	8
@@ -149,10 +197,8 @@ enum rds_fields {
 struct rds_encoder {
 	struct shm_mapping* state_map;
 	struct rds_encoder_state *state;
-	struct resampler_data *rsmpl;
-	struct rds_upsampled_group outbuf[2];
-	int curr_outbuf_idx;
-	size_t upsampled_waveform_len;
+	struct rds_stream streams[RDS_MAX_STREAMS];
+	int num_streams;
 	int status;
 	jack_native_thread_t tid;
 	pthread_mutex_t rds_process_mutex;
@@ -184,9 +230,13 @@ enum rds_encoder_status {
 
 /* Prototypes */
 int rds_encoder_init(struct rds_encoder *enc, jack_client_t *client,
-		     struct resampler_data *rsmpl);
+		     uint32_t osc_samplerate, int num_streams);
 void rds_encoder_destroy(struct rds_encoder *enc);
-float rds_get_next_sample(struct rds_encoder *enc);
+int rds_get_samples(struct rds_encoder *enc, float *out, int num_samples);
+int rds_get_samples_q15(struct rds_encoder *enc, int16_t *out,
+			int num_samples);
+int rds_get_upper_samples(struct rds_encoder *enc, float *out,
+			  int num_samples, uint32_t pos);
 
 /* Getters/Setters */
 uint16_t rds_get_pi(const struct rds_encoder_state *st);
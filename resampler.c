@@ -19,8 +19,10 @@
  */
 #include "resampler.h"
 #include "utils.h"
-#include <stdlib.h>		/* For NULL */
+#include <stdlib.h>		/* For NULL, getenv() */
 #include <string.h>		/* For memset/memcpy */
+#include <math.h>		/* For sin(), cos(), atan2() */
+#include <time.h>		/* For clock_gettime() */
 #include <jack/thread.h>	/* For thread handling through jack */
 
 
@@ -31,11 +33,493 @@
 static void
 resampler_thread_run(struct resampler_thread_data *rstd)
 {
-	rstd->result = soxr_process(rstd->resampler, &rstd->in, rstd->inframes,
-				    &rstd->frames_used, &rstd->out, rstd->outframes,
+	int ret = 0;
+
+	if (rstd->kernel) {
+		ret = polyphase_process(rstd->kernel, rstd->in, rstd->out,
+					rstd->inframes, rstd->outframes);
+		rstd->frames_used = rstd->inframes;
+		rstd->frames_generated = (ret < 0) ? 0 : ret;
+		rstd->result = (ret < 0) ? "polyphase kernel failed" : NULL;
+		return;
+	}
+
+	rstd->result = soxr_process(rstd->resampler, rstd->in, rstd->inframes,
+				    &rstd->frames_used, rstd->out, rstd->outframes,
 				    &rstd->frames_generated);
 }
 
+/* Feed a resampler with silence until it generates outframes
+ * per period, returns the number of periods it took */
+static int
+resampler_prime_one(soxr_t resampler, const float *zeros, float *out,
+		    uint32_t inframes, uint32_t outframes)
+{
+	soxr_error_t error;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+	int i = 0;
+
+	for (i = 0; i < RESAMPLER_PRIME_MAX_PERIODS; i++) {
+		error = soxr_process(resampler, zeros, inframes, &frames_used,
+				     out, outframes, &frames_generated);
+		if (error)
+			return -1;
+		if (frames_generated == outframes)
+			return i + 1;
+	}
+
+	return -2;
+}
+
+/*
+ * Get the plain or the band-limiting audio upsamplers (or the retired
+ * band-limiting ones), the kernels are only set if we use the polyphase
+ * kernels for that pair.
+ */
+static void
+resampler_get_audio_upsamplers(struct resampler_data *rsmpl, int band_limit,
+			       soxr_t *upsampler_l, soxr_t *upsampler_r,
+			       struct polyphase **kernel_l,
+			       struct polyphase **kernel_r)
+{
+	*kernel_l = NULL;
+	*kernel_r = NULL;
+
+	if (band_limit == RESAMPLER_AUDIO_RETIRED) {
+		*upsampler_l = rsmpl->audio_lpf_retired_l;
+		*upsampler_r = rsmpl->audio_lpf_retired_r;
+		if (rsmpl->audio_lpf_retired_kernels) {
+			*kernel_l = &rsmpl->audio_lpf_kernel_l;
+			*kernel_r = &rsmpl->audio_lpf_kernel_r;
+		}
+	} else if (band_limit) {
+		*upsampler_l = rsmpl->audio_lpf_upsampler_l;
+		*upsampler_r = rsmpl->audio_lpf_upsampler_r;
+		if (rsmpl->use_audio_lpf_kernels) {
+			*kernel_l = &rsmpl->audio_lpf_kernel_l;
+			*kernel_r = &rsmpl->audio_lpf_kernel_r;
+		}
+	} else {
+		*upsampler_l = rsmpl->audio_upsampler_l;
+		*upsampler_r = rsmpl->audio_upsampler_r;
+		if (rsmpl->use_audio_kernels) {
+			*kernel_l = &rsmpl->audio_kernel_l;
+			*kernel_r = &rsmpl->audio_kernel_r;
+		}
+	}
+}
+
+/*
+ * Pick the pair of audio upsamplers to use for this period. The pair
+ * we switch to must have been reset and primed by the housekeeping
+ * thread (see resampler_prepare_audio()) since the last time it was
+ * used, if it's not ready yet we stay on the current one. The pair we
+ * switched from (if any) is returned on fade_from, it gets faded out
+ * during this period and is then left for resampler_prepare_audio().
+ * Returns -1 if there is no pair ready to use.
+ */
+static int
+resampler_switch_audio_upsamplers(struct resampler_data *rsmpl, int band_limit,
+				  int *fade_from)
+{
+	int stale = __atomic_load_n(&rsmpl->audio_stale, __ATOMIC_ACQUIRE);
+
+	*fade_from = -1;
+
+	if (stale & RESAMPLER_AUDIO_PAIR(band_limit))
+		return rsmpl->audio_lpf_active;
+
+	*fade_from = rsmpl->audio_lpf_active;
+	rsmpl->audio_lpf_active = band_limit;
+	rsmpl->audio_mono = 0;
+	rsmpl->audio_right_lag = 0;
+
+	return band_limit;
+}
+
+/*
+ * The band-limiting pair was re-designed while in use, fade out the
+ * retired one instead of the pair we were switching from (if any),
+ * since the new band-limiting pair has seen no audio yet.
+ */
+static int
+resampler_fade_retired_audio_lpf(struct resampler_data *rsmpl, int band_limit,
+				 int fade_from)
+{
+	rsmpl->audio_lpf_fade = 0;
+
+	if (fade_from == 1 || (band_limit == 1 && fade_from < 0))
+		return RESAMPLER_AUDIO_RETIRED;
+
+	return fade_from;
+}
+
+/*
+ * The right upsampler was left idle while in mono and got reset and
+ * primed again by the housekeeping thread, so it doesn't follow the
+ * left one's timeline anymore. The frames each one consumed / generated
+ * since the pair was last primed tell us how far apart they are, so
+ * feed the right one with a few samples of silence to bring it to the
+ * same input phase, and get the number of output samples it's ahead
+ * (audio_right_lag > 0) or behind (< 0) the left one, which
+ * resampler_run_audio_upsamplers() takes care of. The kernels are
+ * simpler, their whole timeline is the phase and the history's length,
+ * so the right one gets those from the left one, with a silent history
+ * (the left one keeps running untouched). Returns 0 if the right
+ * upsampler is not ready yet.
+ */
+static int
+resampler_resume_audio_right(struct resampler_data *rsmpl, int band_limit)
+{
+	struct polyphase *kernel_l = NULL;
+	struct polyphase *kernel_r = NULL;
+	soxr_t upsampler_l = NULL;
+	soxr_t upsampler_r = NULL;
+	soxr_error_t error;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+	int64_t in_diff = 0;
+	int64_t out_diff = 0;
+	uint32_t phase = 0;
+	int stale = 0;
+
+	stale = __atomic_load_n(&rsmpl->audio_stale, __ATOMIC_ACQUIRE);
+	if (stale & RESAMPLER_AUDIO_RIGHT(band_limit))
+		return 0;
+
+	rsmpl->audio_mono = 0;
+	rsmpl->audio_right_lag = 0;
+
+	resampler_get_audio_upsamplers(rsmpl, band_limit, &upsampler_l,
+				       &upsampler_r, &kernel_l, &kernel_r);
+	if (kernel_l) {
+		memset(kernel_r->hist, 0,
+		       kernel_r->hist_size * sizeof(float));
+		kernel_r->hist_len = kernel_l->hist_len;
+		kernel_r->phase = kernel_l->phase;
+		return 1;
+	}
+
+	in_diff = (int64_t) (rsmpl->audio_frames_in[band_limit][0] -
+			     rsmpl->audio_frames_in[band_limit][1]);
+	phase = (uint32_t) (((in_diff % rsmpl->audio_ratio_in) +
+			     rsmpl->audio_ratio_in) % rsmpl->audio_ratio_in);
+	if (phase) {
+		error = soxr_process(upsampler_r, rsmpl->prime_buf, phase,
+				     &frames_used, rsmpl->fade_buf_r,
+				     rsmpl->audio_outframes, &frames_generated);
+		if (error)
+			return 1;
+		rsmpl->audio_frames_in[band_limit][1] += frames_used;
+		rsmpl->audio_frames_out[band_limit][1] += frames_generated;
+		in_diff -= frames_used;
+	}
+
+	out_diff = (int64_t) (rsmpl->audio_frames_out[band_limit][0] -
+			      rsmpl->audio_frames_out[band_limit][1]);
+	rsmpl->audio_right_lag = (in_diff / rsmpl->audio_ratio_in) *
+				 rsmpl->audio_ratio_out - out_diff;
+
+	return 1;
+}
+
+/*
+ * Bring the right upsampler in line with the left one, see above. If
+ * it's ahead it gets to generate fewer frames (we fill the gap at the
+ * start of out_r with silence, it's there before any audio anyway),
+ * if it's behind we drop some of its output. Returns the offset within
+ * out_r for this period's output.
+ */
+static uint32_t
+resampler_align_audio_right(struct resampler_data *rsmpl, int band_limit,
+			    soxr_t upsampler_r, const float *in_r, float *out_r,
+			    uint32_t outframes)
+{
+	soxr_error_t error;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+	uint32_t len = 0;
+
+	if (rsmpl->audio_right_lag > 0) {
+		len = (rsmpl->audio_right_lag < outframes) ?
+		      (uint32_t) rsmpl->audio_right_lag : outframes;
+		memset(out_r, 0, len * sizeof(float));
+		rsmpl->audio_right_lag -= len;
+		return len;
+	}
+
+	len = (-rsmpl->audio_right_lag < outframes) ?
+	      (uint32_t) -rsmpl->audio_right_lag : outframes;
+	error = soxr_process(upsampler_r, in_r, 0, &frames_used,
+			     rsmpl->fade_buf_r, len, &frames_generated);
+	if (error)
+		return 0;
+	rsmpl->audio_frames_out[band_limit][1] += frames_generated;
+	rsmpl->audio_right_lag += frames_generated;
+
+	return 0;
+}
+
+/* Keep track of each upsampler's timeline, see above */
+static inline void
+resampler_count_audio_frames(struct resampler_data *rsmpl, int band_limit,
+			     int chan, const struct resampler_thread_data *rstd)
+{
+	if (band_limit == RESAMPLER_AUDIO_RETIRED)
+		return;
+	rsmpl->audio_frames_in[band_limit][chan] += rstd->frames_used;
+	rsmpl->audio_frames_out[band_limit][chan] += rstd->frames_generated;
+}
+
+/*
+ * Run a pair of audio upsamplers, or only the left one if in_r
+ * is NULL. Returns the number of frames generated, or -1 on error.
+ */
+static int
+resampler_run_audio_upsamplers(struct resampler_data *rsmpl, int band_limit,
+			       const float *in_l, const float *in_r,
+			       float *out_l, float *out_r,
+			       uint32_t inframes, uint32_t outframes)
+{
+	struct resampler_thread_data *rstd_l = &rsmpl->rstd_l;
+	struct resampler_thread_data *rstd_r = &rsmpl->rstd_r;
+	struct polyphase *kernel_l = NULL;
+	struct polyphase *kernel_r = NULL;
+	soxr_t upsampler_l = NULL;
+	soxr_t upsampler_r = NULL;
+
+	uint32_t offset_r = 0;
+
+	resampler_get_audio_upsamplers(rsmpl, band_limit, &upsampler_l,
+				       &upsampler_r, &kernel_l, &kernel_r);
+
+	/* No need to wake up the left channel thread for
+	 * a single channel, it only runs when signaled */
+	if (!in_r) {
+		rstd_l->resampler = upsampler_l;
+		rstd_l->kernel = kernel_l;
+		rstd_l->inframes = inframes;
+		rstd_l->in = in_l;
+		rstd_l->out = out_l;
+		rstd_l->outframes = outframes;
+
+		resampler_thread_run(rstd_l);
+
+		if(rstd_l->result) {
+			utils_err("[RESAMPLER] Audio upsampling failed on this period: %i\n",
+				  rstd_l->result);
+			return -1;
+		}
+
+		resampler_count_audio_frames(rsmpl, band_limit, 0, rstd_l);
+		return rstd_l->frames_generated;
+	}
+
+	if (unlikely(rsmpl->audio_right_lag) &&
+	    band_limit != RESAMPLER_AUDIO_RETIRED)
+		offset_r = resampler_align_audio_right(rsmpl, band_limit,
+						       upsampler_r, in_r, out_r,
+						       outframes);
+
+#ifdef JMPXRDS_MT
+	pthread_mutex_lock(&rstd_l->proc_mutex);
+	rstd_l->resampler = upsampler_l;
+	rstd_l->kernel = kernel_l;
+	rstd_l->inframes = inframes;
+	rstd_l->in = in_l;
+	rstd_l->out = out_l;
+	rstd_l->outframes = outframes;
+	pthread_mutex_unlock(&rstd_l->proc_mutex);
+
+	rstd_r->resampler = upsampler_r;
+	rstd_r->kernel = kernel_r;
+	rstd_r->inframes = inframes;
+	rstd_r->in = in_r;
+	rstd_r->out = out_r + offset_r;
+	rstd_r->outframes = outframes - offset_r;
+
+	/* Signal the left channel thread to start
+	 * processing this chunk */
+	pthread_mutex_lock(&rstd_l->proc_mutex);
+	pthread_cond_signal(&rstd_l->proc_trigger);
+	pthread_mutex_unlock(&rstd_l->proc_mutex);
+
+	/* Process right channel on current thread */
+	resampler_thread_run(rstd_r);
+
+	/* Wait for the left channel thread to finish */
+	while(pthread_cond_wait(&rstd_l->done_trigger, &rstd_l->done_mutex) != 0);
+
+#else
+	rstd_l->resampler = upsampler_l;
+	rstd_l->kernel = kernel_l;
+	rstd_l->inframes = inframes;
+	rstd_l->in = in_l;
+	rstd_l->out = out_l;
+	rstd_l->outframes = outframes;
+
+	resampler_thread_run(rstd_l);
+
+	rstd_r->resampler = upsampler_r;
+	rstd_r->kernel = kernel_r;
+	rstd_r->inframes = inframes;
+	rstd_r->in = in_r;
+	rstd_r->out = out_r + offset_r;
+	rstd_r->outframes = outframes - offset_r;
+
+	resampler_thread_run(rstd_r);
+#endif
+	if(rstd_l->result || rstd_r->result) {
+		utils_err("[RESAMPLER] Audio upsampling failed on this period: %i (L), %i (R)\n",
+			  rstd_l->result, rstd_r->result);
+		return -1;
+	}
+
+	resampler_count_audio_frames(rsmpl, band_limit, 0, rstd_l);
+	resampler_count_audio_frames(rsmpl, band_limit, 1, rstd_r);
+	return rstd_l->frames_generated;
+}
+
+/*
+ * Run the same input through the pair we switched from and crossfade
+ * from its output to the frames the new pair generated, so that the
+ * switch doesn't click. The old pair is then left for the housekeeping
+ * thread to reset and prime (or for the next resampler_swap_audio_lpf()
+ * to return, if it's the retired one). If the old pair fails we just
+ * switch.
+ */
+static void
+resampler_fade_audio_upsamplers(struct resampler_data *rsmpl, int fade_from,
+				const float *in_l, const float *in_r,
+				float *out_l, float *out_r,
+				uint32_t inframes, uint32_t outframes,
+				uint32_t frames_generated)
+{
+	float *fade_l = rsmpl->fade_buf_l;
+	float *fade_r = NULL;
+	float gain = 0.0;
+	uint32_t len = 0;
+	uint32_t i = 0;
+	int stale = 0;
+	int ret = 0;
+
+	/* The old pair's right upsampler may have been left idle (mono)
+	 * and be in the hands of resampler_prepare_audio(), only fade
+	 * the left channel then */
+	stale = __atomic_load_n(&rsmpl->audio_stale, __ATOMIC_ACQUIRE);
+	if (fade_from != RESAMPLER_AUDIO_RETIRED &&
+	    (stale & RESAMPLER_AUDIO_RIGHT(fade_from)))
+		in_r = NULL;
+	if (in_r)
+		fade_r = rsmpl->fade_buf_r;
+
+	ret = resampler_run_audio_upsamplers(rsmpl, fade_from, in_l, in_r,
+					     fade_l, fade_r, inframes,
+					     outframes);
+	if (fade_from != RESAMPLER_AUDIO_RETIRED)
+		__atomic_or_fetch(&rsmpl->audio_stale,
+				  RESAMPLER_AUDIO_PAIR(fade_from),
+				  __ATOMIC_RELEASE);
+	if (ret <= 0)
+		return;
+
+	len = ((uint32_t) ret < frames_generated) ? (uint32_t) ret :
+						    frames_generated;
+	for (i = 0; i < len; i++) {
+		gain = (float) (i + 1) / (float) len;
+		out_l[i] = fade_l[i] + (out_l[i] - fade_l[i]) * gain;
+		if (fade_r)
+			out_r[i] = fade_r[i] + (out_r[i] - fade_r[i]) * gain;
+	}
+}
+
+/*
+ * Create a band-limiting audio upsampler, its passband ends at
+ * passband_end and its stopband starts at stopband_begin (in Hz),
+ * both relative to the input's nyquist frequency.
+ */
+static soxr_t
+resampler_create_band_limited(const struct resampler_data *rsmpl,
+			      uint32_t passband_end, uint32_t stopband_begin,
+			      soxr_error_t *error)
+{
+	soxr_io_spec_t io_spec;
+	soxr_runtime_spec_t runtime_spec;
+	soxr_quality_spec_t q_spec;
+
+	/* Single channel, so we can pass plain buffers around */
+	io_spec = soxr_io_spec(SOXR_FLOAT32_I, SOXR_FLOAT32_I);
+	runtime_spec = soxr_runtime_spec(1);
+	q_spec = soxr_quality_spec(SOXR_HQ, 0);
+	q_spec.passband_end = ((double)passband_end /
+			       (double)rsmpl->audio_samplerate) * 2.0L;
+	q_spec.stopband_begin = ((double)stopband_begin /
+				 (double)rsmpl->audio_samplerate) * 2.0L;
+
+	return soxr_create(rsmpl->audio_samplerate, rsmpl->osc_samplerate, 1,
+			   error, &io_spec, &q_spec, &runtime_spec);
+}
+
+/* Same as above, for a pair of upsamplers (L/R) */
+static int
+resampler_create_audio_lpf_upsamplers(const struct resampler_data *rsmpl,
+				      uint32_t passband_end,
+				      uint32_t stopband_begin,
+				      soxr_t *upsampler_l, soxr_t *upsampler_r)
+{
+	soxr_error_t error;
+
+	if (passband_end >= stopband_begin ||
+	    2 * stopband_begin > rsmpl->audio_samplerate)
+		return -1;
+
+	*upsampler_l = resampler_create_band_limited(rsmpl, passband_end,
+						     stopband_begin, &error);
+	if (error) {
+		utils_err("[RESAMPLER] Audio LPF upsampler (L) init failed with code: %i\n",
+			  error);
+		return -2;
+	}
+
+	*upsampler_r = resampler_create_band_limited(rsmpl, passband_end,
+						     stopband_begin, &error);
+	if (error) {
+		utils_err("[RESAMPLER] Audio LPF upsampler (R) init failed with code: %i\n",
+			  error);
+		soxr_delete(*upsampler_l);
+		*upsampler_l = NULL;
+		return -3;
+	}
+
+	return 0;
+}
+
+/* Same as above, for a pair of polyphase kernels */
+static int
+resampler_init_audio_kernels(const struct polyphase_kernel *kernel,
+			     uint32_t max_inframes, struct polyphase *kernel_l,
+			     struct polyphase *kernel_r)
+{
+	int ret = 0;
+
+	ret = polyphase_init(kernel_l, kernel, max_inframes);
+	if (ret < 0) {
+		utils_err("[RESAMPLER] Audio kernel (L) init failed with code: %i\n",
+			  ret);
+		return -1;
+	}
+
+	ret = polyphase_init(kernel_r, kernel, max_inframes);
+	if (ret < 0) {
+		utils_err("[RESAMPLER] Audio kernel (R) init failed with code: %i\n",
+			  ret);
+		return -2;
+	}
+
+	return 0;
+}
+
 #ifdef JMPXRDS_MT
 static void*
 resampler_loop(void *arg)
@@ -105,24 +589,32 @@ resampler_init_upsampler_threads(struct resampler_data *rsmpl)
 /*
  * Since we oscilate the sound using high frequency signals from the
  * main oscilator, we need to upsample the sound to the sample rate of
- * the main oscilator and do our processing at that sampling rate. Same
- * goes for RDS which operates at a much smaller sampling rate than audio.
+ * the main oscilator and do our processing at that sampling rate (RDS
+ * gets synthesized directly at that rate, see rds_encoder.c).
  * After the processing is done we again need to downsample the result
  * (the MPX signal) to the sample rate of the sound card (jack's sample
  * rate), so that it can go out. That's the purpose of the resampler
  * implemented here.
  */
 
-/* Upsample audio to the main oscilator's sampling rate */
+/*
+ * Upsample audio to the main oscilator's sampling rate. When band_limit
+ * is set we use the band-limiting upsamplers, whose passband ends at the
+ * pilot protection cutoff frequency, so that the audio won't hit the
+ * 19KHz pilot without the need of a separate low-pass filter. When
+ * band_limit changes we crossfade to the other pair within the period
+ * (see resampler_switch_audio_upsamplers()).
+ */
 int
 resampler_upsample_audio(struct resampler_data *rsmpl,
 			 const float *in_l, const float *in_r,
 			 float *out_l, float *out_r,
-			 uint32_t inframes, uint32_t outframes)
+			 uint32_t inframes, uint32_t outframes,
+			 int band_limit)
 {
-	struct resampler_thread_data *rstd_l = &rsmpl->rstd_l;
-	struct resampler_thread_data *rstd_r = &rsmpl->rstd_r;
 	size_t frames_generated = 0;
+	int fade_from = -1;
+	int ret = 0;
 
 	/* No need to upsample anything, just copy the buffers.
 	 * Note: This is here for debugging mostly */
@@ -133,89 +625,130 @@ resampler_upsample_audio(struct resampler_data *rsmpl,
 		return frames_generated;
 	}
 
-#ifdef JMPXRDS_MT
-	pthread_mutex_lock(&rstd_l->proc_mutex);
-	rstd_l->inframes = inframes;
-	rstd_l->in = in_l;
-	rstd_l->out = out_l;
-	rstd_l->outframes = outframes;
-	pthread_mutex_unlock(&rstd_l->proc_mutex);
+	band_limit = band_limit ? 1 : 0;
+	if (unlikely(band_limit != rsmpl->audio_lpf_active))
+		band_limit = resampler_switch_audio_upsamplers(rsmpl, band_limit,
+							       &fade_from);
+
+	/* Nothing ready yet (we just came back from the Weaver
+	 * modulator), send out silence until it is */
+	if (unlikely(band_limit < 0)) {
+		memset(out_l, 0, outframes * sizeof(float));
+		memset(out_r, 0, outframes * sizeof(float));
+		return outframes;
+	}
 
-	rstd_r->inframes = inframes;
-	rstd_r->in = in_r;
-	rstd_r->out = out_r;
-	rstd_r->outframes = outframes;
+	if (unlikely(rsmpl->audio_lpf_fade))
+		fade_from = resampler_fade_retired_audio_lpf(rsmpl, band_limit,
+							     fade_from);
+
+	/* The right upsampler was left idle while in mono, until it's
+	 * ready again (see resampler_prepare_audio()) stay on the left
+	 * one and send out silence for L - R */
+	if (unlikely(rsmpl->audio_mono) &&
+	    !resampler_resume_audio_right(rsmpl, band_limit)) {
+		in_r = NULL;
+		memset(out_r, 0, outframes * sizeof(float));
+	}
 
-	/* Signal the left channel thread to start
-	 * processing this chunk */
-	pthread_mutex_lock(&rstd_l->proc_mutex);
-	pthread_cond_signal(&rstd_l->proc_trigger);
-	pthread_mutex_unlock(&rstd_l->proc_mutex);
+	ret = resampler_run_audio_upsamplers(rsmpl, band_limit, in_l, in_r,
+					     out_l, in_r ? out_r : NULL,
+					     inframes, outframes);
+	if (ret < 0)
+		return -1;
 
-	/* Process right channel on current thread */
-	resampler_thread_run(rstd_r);
+	if (unlikely(fade_from >= 0))
+		resampler_fade_audio_upsamplers(rsmpl, fade_from, in_l, in_r,
+						out_l, out_r, inframes,
+						outframes, ret);
 
-	/* Wait for the left channel thread to finish */
-	while(pthread_cond_wait(&rstd_l->done_trigger, &rstd_l->done_mutex) != 0);
+	if (ret == 0)
+		utils_wrn("[RESAMPLER] Audio upsampler didn't generate any frames\n");
 
-#else
-	rstd_l->inframes = inframes;
-	rstd_l->in = in_l;
-	rstd_l->out = out_l;
-	rstd_l->outframes = outframes;
+	return ret;
+}
 
-	resampler_thread_run(rstd_l);
+/*
+ * Same as above for a single channel (e.g. L+R in mono), it only uses
+ * the left upsampler and leaves the right one idle, for the housekeeping
+ * thread to reset and prime, so that it can be brought back in line with
+ * the left one when we go back to stereo.
+ */
+int
+resampler_upsample_audio_mono(struct resampler_data *rsmpl,
+			      const float *in, float *out,
+			      uint32_t inframes, uint32_t outframes,
+			      int band_limit)
+{
+	int fade_from = -1;
+	int ret = 0;
 
-	rstd_r->inframes = inframes;
-	rstd_r->in = in_r;
-	rstd_r->out = out_r;
-	rstd_r->outframes = outframes;
+	if (rsmpl->audio_upsampler_bypass) {
+		memcpy(out, in, inframes * sizeof(float));
+		return inframes;
+	}
 
-	resampler_thread_run(rstd_r);
-#endif
-	if(rstd_l->result || rstd_r->result) {
-		utils_err("[RESAMPLER] Audio upsampling failed on this period: %i (L), %i (R)\n",
-			  rstd_l->result, rstd_r->result);
-		return -1;
+	band_limit = band_limit ? 1 : 0;
+	if (unlikely(band_limit != rsmpl->audio_lpf_active))
+		band_limit = resampler_switch_audio_upsamplers(rsmpl, band_limit,
+							       &fade_from);
+	if (unlikely(band_limit < 0)) {
+		memset(out, 0, outframes * sizeof(float));
+		return outframes;
+	}
+	/* Leave the right upsampler to the housekeeping thread */
+	if (unlikely(!rsmpl->audio_mono)) {
+		__atomic_or_fetch(&rsmpl->audio_stale,
+				  RESAMPLER_AUDIO_RIGHT(band_limit),
+				  __ATOMIC_RELEASE);
+		rsmpl->audio_mono = 1;
 	}
 
-	if (rstd_l->frames_generated == 0)
-		utils_wrn("[RESAMPLER] Audio upsampler didn't generate any frames\n");
+	if (unlikely(rsmpl->audio_lpf_fade))
+		fade_from = resampler_fade_retired_audio_lpf(rsmpl, band_limit,
+							     fade_from);
 
-	return rstd_l->frames_generated;
+	ret = resampler_run_audio_upsamplers(rsmpl, band_limit, in, NULL,
+					     out, NULL, inframes, outframes);
+	if (ret < 0)
+		return -1;
+
+	if (unlikely(fade_from >= 0))
+		resampler_fade_audio_upsamplers(rsmpl, fade_from, in, NULL,
+						out, NULL, inframes,
+						outframes, ret);
+
+	return ret;
 }
 
-/* Upsample RDS waveform to the main oscilator's sampling rate */
+/* Same as below, for Q14 input straight from the fixed-point
+ * generators, only valid when the fixed-point downsampler is in use */
 int
-resampler_upsample_rds(const struct resampler_data *rsmpl, const float *in, float *out,
-		       uint32_t inframes, uint32_t outframes)
+resampler_downsample_mpx_q14(struct resampler_data *rsmpl, const int16_t *in,
+			     float *out, uint32_t inframes, uint32_t outframes)
 {
-	soxr_error_t error;
-	size_t frames_used = 0;
-	size_t frames_generated = 0;
+	int ret = 0;
 
-	error = soxr_process(rsmpl->rds_upsampler, in, inframes, &frames_used,
-			     out, outframes, &frames_generated);
-	if (error) {
-		utils_err("[RESAMPLER] RDS upsampling failed on this period: %i\n",
-			  error);
+	ret = polyphase_q15_process_q14(&rsmpl->mpx_fxp_downsampler, in, out,
+					inframes, outframes);
+	if (ret < 0) {
+		utils_err("[RESAMPLER] MPX downsampling (fixed-point) "
+			  "overflow on this period\n");
 		return -1;
 	}
 
-	if (frames_generated == 0)
-		utils_wrn("[RESAMPLER] RDS upsampler didn't generate any frames\n");
-
-	return frames_generated;
+	return ret;
 }
 
 /* Downsample MPX signal to JACK's sample rate */
 int
-resampler_downsample_mpx(const struct resampler_data *rsmpl, const float *in, float *out,
+resampler_downsample_mpx(struct resampler_data *rsmpl, const float *in, float *out,
 			 uint32_t inframes, uint32_t outframes)
 {
 	soxr_error_t error;
 	size_t frames_used = 0;
 	size_t frames_generated = 0;
+	int ret = 0;
 
 	/* No need to upsample anything, just copy the buffers.
 	 * Note: This is here for debugging mostly */
@@ -223,6 +756,24 @@ resampler_downsample_mpx(const struct resampler_data *rsmpl, const float *in, fl
 		memcpy(out, in, inframes * sizeof(float));
 		frames_generated = inframes;
 		return frames_generated;
+	} else if (rsmpl->mpx_fxp) {
+		ret = polyphase_q15_process(&rsmpl->mpx_fxp_downsampler, in,
+					    out, inframes, outframes);
+		if (ret < 0) {
+			utils_err("[RESAMPLER] MPX downsampling (fixed-point) "
+				  "overflow on this period\n");
+			return -1;
+		}
+		return ret;
+	} else if (rsmpl->use_mpx_kernel) {
+		ret = polyphase_process(&rsmpl->mpx_kernel, in, out,
+					inframes, outframes);
+		if (ret < 0) {
+			utils_err("[RESAMPLER] MPX downsampling (kernel) "
+				  "overflow on this period\n");
+			return -1;
+		}
+		return ret;
 	} else {
 		error = soxr_process(rsmpl->mpx_downsampler, in, inframes,
 				     &frames_used, out, outframes,
@@ -241,19 +792,614 @@ resampler_downsample_mpx(const struct resampler_data *rsmpl, const float *in, fl
 	return frames_generated;
 }
 
+/*
+ * The resamplers keep some input around before they start producing
+ * output (that's their filter delay), so for the first few periods
+ * they'll generate fewer samples than expected and those periods would
+ * get dropped. To avoid that we feed them with silence during init,
+ * until they produce full-length periods, so that the first period with
+ * actual audio comes out complete.
+ */
+int
+resampler_prime(struct resampler_data *rsmpl, uint32_t inframes,
+		uint32_t upsampled_frames, uint32_t outframes)
+{
+	soxr_t upsamplers[4] = { rsmpl->audio_upsampler_l,
+				 rsmpl->audio_upsampler_r,
+				 rsmpl->audio_lpf_upsampler_l,
+				 rsmpl->audio_lpf_upsampler_r };
+	float *out = NULL;
+	uint32_t buf_len = 0;
+	int ret = 0;
+	int i = 0;
+
+	rsmpl->audio_inframes = inframes;
+	rsmpl->audio_outframes = upsampled_frames;
+
+	buf_len = upsampled_frames;
+	if (inframes > buf_len)
+		buf_len = inframes;
+	if (outframes > buf_len)
+		buf_len = outframes;
+
+	/* Keep the silence around, we'll also need it when switching
+	 * between the audio upsamplers */
+	if (rsmpl->prime_buf_len < buf_len) {
+		free(rsmpl->prime_buf);
+		rsmpl->prime_buf = (float *) calloc(buf_len, sizeof(float));
+		rsmpl->prime_buf_len = rsmpl->prime_buf ? buf_len : 0;
+	}
+
+	/* Scratch space for the pair we fade out when switching */
+	if (!rsmpl->fade_buf_l) {
+		rsmpl->fade_buf_l = (float *) malloc(upsampled_frames *
+						     sizeof(float));
+		rsmpl->fade_buf_r = (float *) malloc(upsampled_frames *
+						     sizeof(float));
+	}
+
+	out = (float *) malloc(buf_len * sizeof(float));
+	if (!rsmpl->prime_buf || !rsmpl->fade_buf_l || !rsmpl->fade_buf_r ||
+	    !out) {
+		ret = -1;
+		goto cleanup;
+	}
+
+	if (!rsmpl->audio_upsampler_bypass) {
+		for (i = 0; i < 4; i++) {
+			/* Served by the polyphase kernels, they
+			 * don't need priming */
+			if (!upsamplers[i])
+				continue;
+			ret = resampler_prime_one(upsamplers[i],
+						  rsmpl->prime_buf, out,
+						  inframes, upsampled_frames);
+			if (ret < 0)
+				goto cleanup;
+		}
+		utils_dbg("[RESAMPLER] Audio upsamplers primed after %i periods\n",
+			  ret);
+	}
+
+	if (!rsmpl->mpx_downsampler_bypass && !rsmpl->mpx_fxp &&
+	    !rsmpl->use_mpx_kernel) {
+		ret = resampler_prime_one(rsmpl->mpx_downsampler,
+					  rsmpl->prime_buf, out,
+					  upsampled_frames, outframes);
+		if (ret < 0)
+			goto cleanup;
+		utils_dbg("[RESAMPLER] MPX downsampler primed after %i periods\n",
+			  ret);
+	}
+
+	ret = 0;
+
+ cleanup:
+	if (ret < 0)
+		utils_wrn("[RESAMPLER] Priming failed with code: %i\n", ret);
+	free(out);
+	return ret;
+}
+
+/*
+ * Create a new pair of band-limiting audio upsamplers with a different
+ * passband / stopband, and prime them so that they are ready to be
+ * swapped in. This is slow so it's meant to run on a non-RT thread,
+ * use resampler_swap_audio_lpf() between periods to swap them in.
+ */
+int
+resampler_redesign_audio_lpf(const struct resampler_data *rsmpl,
+			     uint32_t passband_end, uint32_t stopband_begin,
+			     soxr_t *upsampler_l, soxr_t *upsampler_r)
+{
+	float *out = NULL;
+	int ret = 0;
+
+	if (rsmpl->audio_upsampler_bypass)
+		return -1;
+
+	ret = resampler_create_audio_lpf_upsamplers(rsmpl, passband_end,
+						    stopband_begin,
+						    upsampler_l, upsampler_r);
+	if (ret < 0)
+		return -2;
+
+	if (!rsmpl->prime_buf || rsmpl->prime_buf_len < rsmpl->audio_inframes)
+		return 0;
+
+	out = (float *) malloc(rsmpl->audio_outframes * sizeof(float));
+	if (!out)
+		return 0;
+
+	resampler_prime_one(*upsampler_l, rsmpl->prime_buf, out,
+			    rsmpl->audio_inframes, rsmpl->audio_outframes);
+	resampler_prime_one(*upsampler_r, rsmpl->prime_buf, out,
+			    rsmpl->audio_inframes, rsmpl->audio_outframes);
+
+	free(out);
+	return 0;
+}
+
+/*
+ * Swap the band-limiting upsamplers, call it between periods. The old
+ * ones are kept around (retired) so that the next period can crossfade
+ * from them if they were in use, and the ones retired by the previous
+ * swap are returned for the caller to delete (with soxr_delete()). If
+ * we were using the polyphase kernels (they only cover the default
+ * design) we stick with SoXr from now on.
+ */
+void
+resampler_swap_audio_lpf(struct resampler_data *rsmpl, soxr_t *upsampler_l,
+			 soxr_t *upsampler_r)
+{
+	soxr_t tmp_l = rsmpl->audio_lpf_retired_l;
+	soxr_t tmp_r = rsmpl->audio_lpf_retired_r;
+
+	rsmpl->audio_lpf_retired_l = rsmpl->audio_lpf_upsampler_l;
+	rsmpl->audio_lpf_retired_r = rsmpl->audio_lpf_upsampler_r;
+	rsmpl->audio_lpf_retired_kernels = rsmpl->use_audio_lpf_kernels;
+	rsmpl->audio_lpf_fade = (rsmpl->audio_lpf_active == 1);
+
+	rsmpl->audio_lpf_upsampler_l = *upsampler_l;
+	rsmpl->audio_lpf_upsampler_r = *upsampler_r;
+	rsmpl->use_audio_lpf_kernels = 0;
+
+	/* The new pair is primed already */
+	memset(rsmpl->audio_frames_in[1], 0, sizeof(rsmpl->audio_frames_in[1]));
+	memset(rsmpl->audio_frames_out[1], 0,
+	       sizeof(rsmpl->audio_frames_out[1]));
+	__atomic_and_fetch(&rsmpl->audio_stale, ~(RESAMPLER_AUDIO_PAIR(1) |
+						  RESAMPLER_AUDIO_RIGHT(1)),
+			   __ATOMIC_RELEASE);
+
+	*upsampler_l = tmp_l;
+	*upsampler_r = tmp_r;
+}
+
+
+/* Clear an audio upsampler and prime it again, using out as scratch */
+static void
+resampler_prime_audio(const struct resampler_data *rsmpl, soxr_t upsampler,
+		      float *out)
+{
+	if (!upsampler)
+		return;
+
+	soxr_clear(upsampler);
+	if (rsmpl->prime_buf && rsmpl->prime_buf_len >= rsmpl->audio_inframes)
+		resampler_prime_one(upsampler, rsmpl->prime_buf, out,
+				    rsmpl->audio_inframes,
+				    rsmpl->audio_outframes);
+}
+
+/*
+ * Reset and prime the audio upsamplers the processing thread left idle
+ * (see resampler_switch_audio_upsamplers()), so that they are ready for
+ * the next switch. This is slow so it's meant to run on a non-RT thread,
+ * the processing thread won't touch them until we are done, so there is
+ * no need to wait for the current period to finish.
+ */
+void
+resampler_prepare_audio(struct resampler_data *rsmpl)
+{
+	struct polyphase *kernel_l = NULL;
+	struct polyphase *kernel_r = NULL;
+	soxr_t upsampler_l = NULL;
+	soxr_t upsampler_r = NULL;
+	float *out = NULL;
+	int stale = 0;
+	int i = 0;
+
+	stale = __atomic_load_n(&rsmpl->audio_stale, __ATOMIC_ACQUIRE);
+	if (!stale)
+		return;
+
+	out = (float *) malloc(rsmpl->audio_outframes * sizeof(float));
+	if (!out)
+		return;
+
+	for (i = 0; i < 2; i++) {
+		if (!(stale & (RESAMPLER_AUDIO_PAIR(i) |
+			       RESAMPLER_AUDIO_RIGHT(i))))
+			continue;
+
+		resampler_get_audio_upsamplers(rsmpl, i, &upsampler_l,
+					       &upsampler_r, &kernel_l,
+					       &kernel_r);
+
+		/* Only the right one was left idle (mono) */
+		if (!(stale & RESAMPLER_AUDIO_PAIR(i))) {
+			upsampler_l = NULL;
+			kernel_l = NULL;
+		}
+
+		if (kernel_r) {
+			if (kernel_l)
+				polyphase_reset(kernel_l);
+			polyphase_reset(kernel_r);
+		} else {
+			resampler_prime_audio(rsmpl, upsampler_l, out);
+			resampler_prime_audio(rsmpl, upsampler_r, out);
+		}
+
+		/* Both count from the end of the priming, and the
+		 * priming is the same for both (see
+		 * resampler_resume_audio_right()) */
+		if (upsampler_l || kernel_l) {
+			rsmpl->audio_frames_in[i][0] = 0;
+			rsmpl->audio_frames_out[i][0] = 0;
+		}
+		rsmpl->audio_frames_in[i][1] = 0;
+		rsmpl->audio_frames_out[i][1] = 0;
+
+		/* Only clear what we took care of, the processing thread
+		 * may have marked the pair stale since we looked */
+		__atomic_and_fetch(&rsmpl->audio_stale,
+				   ~(stale & (RESAMPLER_AUDIO_PAIR(i) |
+					      RESAMPLER_AUDIO_RIGHT(i))),
+				   __ATOMIC_RELEASE);
+		utils_dbg("[RESAMPLER] Audio upsampler%s (%s) ready\n",
+			  (upsampler_l || kernel_l) ? "s" : " (R)",
+			  i ? "LPF" : "plain");
+	}
+
+	free(out);
+}
+
+/* Check if resampler_prepare_audio() has work to do */
+int
+resampler_audio_stale(const struct resampler_data *rsmpl)
+{
+	return __atomic_load_n(&rsmpl->audio_stale, __ATOMIC_RELAXED) != 0;
+}
+
+/*
+ * The main audio upsamplers are about to be left idle for a while (e.g.
+ * while the Weaver modulator is in use), so they'll hold old audio when
+ * we come back to them. Leave the current pair to resampler_prepare_audio()
+ * and pick one again on the next resampler_upsample_audio().
+ */
+void
+resampler_reset_audio(struct resampler_data *rsmpl)
+{
+	if (rsmpl->audio_lpf_active >= 0)
+		__atomic_or_fetch(&rsmpl->audio_stale,
+				  RESAMPLER_AUDIO_PAIR(rsmpl->audio_lpf_active),
+				  __ATOMIC_RELEASE);
+	rsmpl->audio_lpf_active = -1;
+}
+
+/*
+ * Standalone band-limiting audio upsamplers, for the Weaver SSB
+ * modulator (see fmmod.c), that needs three of them (L+R, I and Q)
+ * that stay aligned with each other. When the audio upsampler is
+ * bypassed we don't create any and the functions below act as if
+ * they had no delay (they just copy the data).
+ */
+int
+resampler_create_audio_upsampler(const struct resampler_data *rsmpl,
+				 uint32_t passband_end,
+				 uint32_t stopband_begin, soxr_t *upsampler)
+{
+	soxr_error_t error;
+
+	*upsampler = NULL;
+	if (rsmpl->audio_upsampler_bypass)
+		return 0;
+
+	if (passband_end >= stopband_begin ||
+	    2 * stopband_begin > rsmpl->audio_samplerate)
+		return -1;
+
+	*upsampler = resampler_create_band_limited(rsmpl, passband_end,
+						   stopband_begin, &error);
+	if (error) {
+		utils_err("[RESAMPLER] Audio upsampler init failed with code: %i\n",
+			  error);
+		*upsampler = NULL;
+		return -2;
+	}
+
+	return 0;
+}
+
+/* Returns the number of frames generated, or -1 on error */
+int
+resampler_upsample_audio_one(const struct resampler_data *rsmpl,
+			     soxr_t upsampler, const float *in, float *out,
+			     uint32_t inframes, uint32_t outframes)
+{
+	soxr_error_t error;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+
+	if (rsmpl->audio_upsampler_bypass) {
+		memmove(out, in, inframes * sizeof(float));
+		return inframes;
+	}
+
+	error = soxr_process(upsampler, in, inframes, &frames_used,
+			     out, outframes, &frames_generated);
+	if (error) {
+		utils_err("[RESAMPLER] Audio upsampling failed with code: %i\n",
+			  error);
+		return -1;
+	}
+
+	return frames_generated;
+}
+
+/*
+ * Clear the upsampler and prime it again with silence (see
+ * resampler_prime()). The number of frames it consumed / generated
+ * in the process is returned on in_frames / out_frames, so that the
+ * caller can keep track of the upsampler's timeline.
+ */
+int
+resampler_reset_audio_upsampler(const struct resampler_data *rsmpl,
+				soxr_t upsampler, uint64_t *in_frames,
+				uint64_t *out_frames)
+{
+	soxr_error_t error;
+	float *out = NULL;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+	int ret = -1;
+	int i = 0;
+
+	*in_frames = 0;
+	*out_frames = 0;
+
+	if (rsmpl->audio_upsampler_bypass)
+		return 0;
+
+	soxr_clear(upsampler);
+
+	if (!rsmpl->prime_buf || rsmpl->prime_buf_len < rsmpl->audio_inframes)
+		return -1;
+
+	out = (float *) malloc(rsmpl->audio_outframes * sizeof(float));
+	if (!out)
+		return -1;
+
+	for (i = 0; i < RESAMPLER_PRIME_MAX_PERIODS; i++) {
+		error = soxr_process(upsampler, rsmpl->prime_buf,
+				     rsmpl->audio_inframes, &frames_used,
+				     out, rsmpl->audio_outframes,
+				     &frames_generated);
+		if (error)
+			break;
+		*in_frames += frames_used;
+		*out_frames += frames_generated;
+		if (frames_generated == rsmpl->audio_outframes) {
+			ret = 0;
+			break;
+		}
+	}
+
+	free(out);
+	return ret;
+}
+
+/*
+ * Measure the phase delay of an audio upsampler at the given frequency
+ * (in radians, 0 to 2 * pi), by running a cosine through it. Both the
+ * input and the output timelines start from the first sample after
+ * the upsampler is cleared (or created). The upsampler gets cleared
+ * afterwards.
+ */
+int
+resampler_measure_phase_delay(const struct resampler_data *rsmpl,
+			      soxr_t upsampler, float freq, double *phase)
+{
+	soxr_error_t error;
+	float *in = NULL;
+	float *out = NULL;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+	uint64_t in_frames = 0;
+	uint64_t out_frames = 0;
+	double in_step = 0.0L;
+	double out_step = 0.0L;
+	double re = 0.0L;
+	double im = 0.0L;
+	uint32_t full_periods = 0;
+	uint32_t i = 0;
+	int ret = 0;
+	int j = 0;
+
+	*phase = 0.0L;
+	if (rsmpl->audio_upsampler_bypass)
+		return 0;
+
+	in = (float *) malloc(rsmpl->audio_inframes * sizeof(float));
+	out = (float *) malloc(rsmpl->audio_outframes * sizeof(float));
+	if (!in || !out) {
+		ret = -1;
+		goto cleanup;
+	}
+
+	in_step = 2.0L * M_PI * (double) freq / (double) rsmpl->audio_samplerate;
+	out_step = 2.0L * M_PI * (double) freq / (double) rsmpl->osc_samplerate;
+
+	soxr_clear(upsampler);
+
+	/* Let it settle and then correlate a few full periods
+	 * of its output with the input's cosine / sine */
+	for (j = 0; j < 2 * RESAMPLER_PRIME_MAX_PERIODS && full_periods < 4;
+	     j++) {
+		for (i = 0; i < rsmpl->audio_inframes; i++)
+			in[i] = (float) cos(in_step * (double) (in_frames + i));
+
+		error = soxr_process(upsampler, in, rsmpl->audio_inframes,
+				     &frames_used, out, rsmpl->audio_outframes,
+				     &frames_generated);
+		if (error) {
+			ret = -2;
+			goto cleanup;
+		}
+
+		if (frames_generated == rsmpl->audio_outframes &&
+		    j >= RESAMPLER_PRIME_MAX_PERIODS / 2) {
+			for (i = 0; i < frames_generated; i++) {
+				re += out[i] * cos(out_step *
+						   (double) (out_frames + i));
+				im += out[i] * sin(out_step *
+						   (double) (out_frames + i));
+			}
+			full_periods++;
+		}
+
+		in_frames += frames_used;
+		out_frames += frames_generated;
+	}
+
+	if (!full_periods) {
+		ret = -3;
+		goto cleanup;
+	}
+
+	/* out = cos(w * (t - delay)) -> phase delay = w * delay */
+	*phase = atan2(im, re);
+	if (*phase < 0)
+		*phase += 2.0L * M_PI;
+
+ cleanup:
+	soxr_clear(upsampler);
+	free(in);
+	free(out);
+	return ret;
+}
+
 /****************\
 * INIT / DESTROY *
 \****************/
 
+static int64_t
+resampler_elapsed_ns(const struct timespec *start, const struct timespec *end)
+{
+	return (int64_t) (end->tv_sec - start->tv_sec) * 1000000000LL +
+	       (int64_t) (end->tv_nsec - start->tv_nsec);
+}
+
+/*
+ * Time a period's worth of resampling through the kernel and through
+ * SoXr, and return the kernel if it's the fastest, or NULL to go for
+ * SoXr. How they compare depends on the CPU (SIMD units, caches) and
+ * on how SoXr was built, so we do it on the machine we run on, as with
+ * the FFT backends. For a fair comparison SoXr gets the kernel's design
+ * (passband, stopband and attenuation), SoXr's precision in bits maps
+ * to (bits + 1) * 6.02dB of attenuation.
+ */
+static const struct polyphase_kernel *
+resampler_pick_kernel(const struct polyphase_kernel *kernel,
+		      uint32_t max_inframes)
+{
+	const char *env = getenv(RESAMPLER_BACKEND_ENV);
+	struct polyphase pp = {0};
+	struct timespec start = {0};
+	struct timespec end = {0};
+	soxr_error_t error;
+	soxr_io_spec_t io_spec;
+	soxr_runtime_spec_t runtime_spec;
+	soxr_quality_spec_t q_spec;
+	soxr_t soxr = NULL;
+	double nyquist = 0.0;
+	size_t frames_used = 0;
+	size_t frames_generated = 0;
+	float *in = NULL;
+	float *out = NULL;
+	int64_t kernel_time = -1;
+	int64_t soxr_time = -1;
+	int64_t elapsed = 0;
+	uint32_t max_outframes = 0;
+	uint32_t i = 0;
+	int run = 0;
+
+	if (!kernel)
+		return NULL;
+	if (env && !strcmp(env, "kernel"))
+		return kernel;
+	if (env && !strcmp(env, "soxr"))
+		return NULL;
+
+	max_outframes = (uint32_t) (((uint64_t) max_inframes *
+				     kernel->out_rate) / kernel->in_rate) + 2;
+	in = (float *) malloc(max_inframes * sizeof(float));
+	out = (float *) malloc(max_outframes * sizeof(float));
+	if (!in || !out || polyphase_init(&pp, kernel, max_inframes) < 0)
+		goto cleanup;
+
+	io_spec = soxr_io_spec(SOXR_FLOAT32_I, SOXR_FLOAT32_I);
+	runtime_spec = soxr_runtime_spec(1);
+	q_spec = soxr_quality_spec(SOXR_HQ, 0);
+	q_spec.precision = POLYPHASE_KERNEL_ATTEN / 6.0206 - 1.0;
+	nyquist = (double) ((kernel->in_rate < kernel->out_rate) ?
+			    kernel->in_rate : kernel->out_rate) / 2.0;
+	q_spec.passband_end = (double) kernel->passband_end / nyquist;
+	q_spec.stopband_begin = (double) kernel->stopband_begin / nyquist;
+	soxr = soxr_create(kernel->in_rate, kernel->out_rate, 1, &error,
+			   &io_spec, &q_spec, &runtime_spec);
+	if (error) {
+		utils_dbg("[RESAMPLER] Could not time the kernel against SoXr: "
+			  "%s\n", error);
+		goto cleanup;
+	}
+
+	for (i = 0; i < max_inframes; i++)
+		in[i] = (float) (0.5L * sin(2.0L * M_PI * 1000.0L *
+					    (double) i /
+					    (double) kernel->in_rate));
+
+	/* One extra run to warm up the caches */
+	for (run = 0; run <= RESAMPLER_BENCH_RUNS; run++) {
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		polyphase_process(&pp, in, out, max_inframes, max_outframes);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		elapsed = resampler_elapsed_ns(&start, &end);
+		if (run && (kernel_time < 0 || elapsed < kernel_time))
+			kernel_time = elapsed;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		soxr_process(soxr, in, max_inframes, &frames_used,
+			     out, max_outframes, &frames_generated);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		elapsed = resampler_elapsed_ns(&start, &end);
+		if (run && (soxr_time < 0 || elapsed < soxr_time))
+			soxr_time = elapsed;
+	}
+
+	utils_dbg("[RESAMPLER] %u -> %u (%u/%uHz): kernel %lins, SoXr %lins\n",
+		  kernel->in_rate, kernel->out_rate, kernel->passband_end,
+		  kernel->stopband_begin, (long) kernel_time, (long) soxr_time);
+
+ cleanup:
+	soxr_delete(soxr);
+	polyphase_destroy(&pp);
+	free(in);
+	free(out);
+
+	/* If we couldn't measure it, stick with the kernel */
+	if (kernel_time >= 0 && soxr_time >= 0 && soxr_time < kernel_time)
+		return NULL;
+	return kernel;
+}
+
 int
 resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 		jack_client_t *fmmod_client, uint32_t osc_samplerate,
-		uint32_t rds_samplerate, uint32_t output_samplerate)
+		uint32_t output_samplerate,
+		uint32_t audio_passband_end, uint32_t audio_stopband_begin,
+		uint32_t mpx_passband_end, uint32_t mpx_stopband_begin,
+		uint32_t max_inframes)
 {
+	const struct polyphase_kernel *kernel = NULL;
 	soxr_error_t error;
 	soxr_io_spec_t io_spec;
 	soxr_runtime_spec_t runtime_spec;
 	soxr_quality_spec_t q_spec;
+	uint32_t mpx_max_inframes = max_inframes;
+	uint32_t tmp = 0;
 	int ret = 0;
 
 	if (rsmpl == NULL)
@@ -261,8 +1407,8 @@ resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 
 	memset(rsmpl, 0, sizeof(struct resampler_data));
 
-	/* So that RDS encoder can calculate its buffer lengths */
 	rsmpl->osc_samplerate = osc_samplerate;
+	rsmpl->audio_samplerate = jack_samplerate;
 
 	rsmpl->fmmod_client = fmmod_client;
 
@@ -274,8 +1420,45 @@ resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 		goto audio_upsampler_bypass;
 	}
 
-	/* Initialize upsampler's parameters */
-	io_spec = soxr_io_spec(SOXR_FLOAT32_S, SOXR_FLOAT32_S);
+	/* The audio upsamplers' input / output phase repeats
+	 * every audio_ratio_in input / audio_ratio_out output
+	 * frames (see resampler_resume_audio_right()) */
+	rsmpl->audio_ratio_in = jack_samplerate;
+	rsmpl->audio_ratio_out = osc_samplerate;
+	while (rsmpl->audio_ratio_out) {
+		tmp = rsmpl->audio_ratio_in % rsmpl->audio_ratio_out;
+		rsmpl->audio_ratio_in = rsmpl->audio_ratio_out;
+		rsmpl->audio_ratio_out = tmp;
+	}
+	rsmpl->audio_ratio_out = osc_samplerate / rsmpl->audio_ratio_in;
+	rsmpl->audio_ratio_in = jack_samplerate / rsmpl->audio_ratio_in;
+
+	/* The most the MPX downsampler will get per call */
+	mpx_max_inframes = (uint32_t) (((uint64_t) max_inframes *
+					osc_samplerate) / jack_samplerate) + 1;
+
+	/* Use the polyphase kernels if we have them for this
+	 * ratio, and they are faster than SoXr's upsamplers */
+	kernel = polyphase_find_kernel(jack_samplerate, osc_samplerate,
+				       RESAMPLER_AUDIO_PASSBAND_END,
+				       jack_samplerate -
+				       RESAMPLER_AUDIO_PASSBAND_END);
+	kernel = resampler_pick_kernel(kernel, max_inframes);
+	if (kernel) {
+		ret = resampler_init_audio_kernels(kernel, max_inframes,
+						   &rsmpl->audio_kernel_l,
+						   &rsmpl->audio_kernel_r);
+		if (ret < 0) {
+			ret = -8;
+			goto cleanup;
+		}
+		rsmpl->use_audio_kernels = 1;
+		goto audio_lpf_upsamplers;
+	}
+
+	/* Initialize upsampler's parameters, they are single
+	 * channel so interleaved is the same as split */
+	io_spec = soxr_io_spec(SOXR_FLOAT32_I, SOXR_FLOAT32_I);
 	runtime_spec = soxr_runtime_spec(1);
 	q_spec = soxr_quality_spec(SOXR_QQ, 0);
 
@@ -299,6 +1482,30 @@ resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 		goto cleanup;
 	}
 
+ audio_lpf_upsamplers:
+	/* Band-limiting upsamplers, they replace the pilot protection
+	 * low-pass filter */
+	kernel = polyphase_find_kernel(jack_samplerate, osc_samplerate,
+				       audio_passband_end,
+				       audio_stopband_begin);
+	kernel = resampler_pick_kernel(kernel, max_inframes);
+	if (kernel) {
+		ret = resampler_init_audio_kernels(kernel, max_inframes,
+						   &rsmpl->audio_lpf_kernel_l,
+						   &rsmpl->audio_lpf_kernel_r);
+		rsmpl->use_audio_lpf_kernels = 1;
+	} else
+		ret = resampler_create_audio_lpf_upsamplers(rsmpl,
+						audio_passband_end,
+						audio_stopband_begin,
+						&rsmpl->audio_lpf_upsampler_l,
+						&rsmpl->audio_lpf_upsampler_r);
+	if (ret < 0) {
+		ret = -7;
+		goto cleanup;
+	}
+	rsmpl->audio_lpf_active = 1;
+
 	rsmpl->active = 1;
 	ret = resampler_init_upsampler_threads(rsmpl);
 	if (ret < 0) {
@@ -310,23 +1517,6 @@ resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 
  audio_upsampler_bypass:
 
-	/* RDS UPSAMPLER */
-
-	/* Initialize upsampler's parameters */
-	io_spec = soxr_io_spec(SOXR_FLOAT32_I, SOXR_FLOAT32_I);
-	runtime_spec = soxr_runtime_spec(1);
-	q_spec = soxr_quality_spec(SOXR_QQ, 0);
-	rsmpl->rds_upsampler = soxr_create(rds_samplerate, osc_samplerate, 1,
-					   &error, &io_spec, &q_spec,
-					   &runtime_spec);
-
-	if (error) {
-		utils_err("[RESAMPLER] RDS upsampler init failed with code: %i\n",
-			  error);
-		ret = -5;
-		goto cleanup;
-	}
-
 	/* DOWNSAMPLER */
 
 	if (osc_samplerate == output_samplerate) {
@@ -334,12 +1524,30 @@ resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 		goto cleanup;
 	}
 
+	kernel = polyphase_find_kernel(osc_samplerate, output_samplerate,
+				       mpx_passband_end, mpx_stopband_begin);
+	kernel = resampler_pick_kernel(kernel, mpx_max_inframes);
+	if (kernel) {
+		ret = polyphase_init(&rsmpl->mpx_kernel, kernel,
+				     mpx_max_inframes);
+		if (ret < 0) {
+			utils_err("[RESAMPLER] MPX kernel init failed with code: %i\n",
+				  ret);
+			ret = -9;
+			goto cleanup;
+		}
+		rsmpl->use_mpx_kernel = 1;
+		goto cleanup;
+	}
+
 	/* Initialize downsampler's parameters */
 	io_spec = soxr_io_spec(SOXR_FLOAT32_I, SOXR_FLOAT32_I);
 	runtime_spec = soxr_runtime_spec(1);
 	q_spec = soxr_quality_spec(SOXR_HQ, 0);
-	q_spec.passband_end = ((double)60000 / (double)output_samplerate) * 2.0L;
-	q_spec.stopband_begin = ((double)62500 / (double)output_samplerate) * 2.0L;
+	q_spec.passband_end = ((double)mpx_passband_end /
+			       (double)output_samplerate) * 2.0L;
+	q_spec.stopband_begin = ((double)mpx_stopband_begin /
+				 (double)output_samplerate) * 2.0L;
 
 	rsmpl->mpx_downsampler = soxr_create(osc_samplerate, output_samplerate,
 					     1, &error, &io_spec, &q_spec,
@@ -362,6 +1570,38 @@ resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 	return ret;
 }
 
+/*
+ * Switch the MPX downsampler to the fixed-point polyphase one, for
+ * boards without a decent FPU. It doesn't need a narrow transition
+ * band like SoXr's (nothing above the passband gets folded back into
+ * it as long as the stopband begins below the output's Nyquist), which
+ * keeps the number of taps low. The floating point downsampler is
+ * left around but won't be used.
+ */
+int
+resampler_init_fxp(struct resampler_data *rsmpl, uint32_t output_samplerate,
+		   uint32_t mpx_passband_end, uint32_t mpx_stopband_begin,
+		   uint32_t max_inframes)
+{
+	int ret = 0;
+
+	if (rsmpl->mpx_downsampler_bypass)
+		return 0;
+
+	ret = polyphase_q15_init(&rsmpl->mpx_fxp_downsampler,
+				 rsmpl->osc_samplerate, output_samplerate,
+				 mpx_passband_end, mpx_stopband_begin,
+				 max_inframes);
+	if (ret < 0) {
+		utils_err("[RESAMPLER] Fixed-point MPX downsampler init failed "
+			  "with code: %i\n", ret);
+		return -1;
+	}
+	rsmpl->mpx_fxp = 1;
+
+	return 0;
+}
+
 void
 resampler_destroy(struct resampler_data *rsmpl)
 {
@@ -369,7 +1609,27 @@ resampler_destroy(struct resampler_data *rsmpl)
 	/* SoXr checks if they are NULL or not */
 	soxr_delete(rsmpl->audio_upsampler_l);
 	soxr_delete(rsmpl->audio_upsampler_r);
-	soxr_delete(rsmpl->rds_upsampler);
+	soxr_delete(rsmpl->audio_lpf_upsampler_l);
+	soxr_delete(rsmpl->audio_lpf_upsampler_r);
+	soxr_delete(rsmpl->audio_lpf_retired_l);
+	soxr_delete(rsmpl->audio_lpf_retired_r);
 	soxr_delete(rsmpl->mpx_downsampler);
+	polyphase_destroy(&rsmpl->audio_kernel_l);
+	polyphase_destroy(&rsmpl->audio_kernel_r);
+	polyphase_destroy(&rsmpl->audio_lpf_kernel_l);
+	polyphase_destroy(&rsmpl->audio_lpf_kernel_r);
+	polyphase_destroy(&rsmpl->mpx_kernel);
+	rsmpl->use_audio_kernels = 0;
+	rsmpl->use_audio_lpf_kernels = 0;
+	rsmpl->use_mpx_kernel = 0;
+	polyphase_q15_destroy(&rsmpl->mpx_fxp_downsampler);
+	rsmpl->mpx_fxp = 0;
+	free(rsmpl->prime_buf);
+	rsmpl->prime_buf = NULL;
+	rsmpl->prime_buf_len = 0;
+	free(rsmpl->fade_buf_l);
+	free(rsmpl->fade_buf_r);
+	rsmpl->fade_buf_l = NULL;
+	rsmpl->fade_buf_r = NULL;
 	utils_dbg("[RESAMPLER] Destroyed\n");
 }
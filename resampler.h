@@ -21,9 +21,12 @@
 #include <soxr.h>		/* soxr types and macros */
 #include <jack/jack.h>		/* For jack-related types */
 #include <pthread.h>		/* For pthread mutex / conditional */
+#include "polyphase.h"
 
 struct resampler_thread_data {
 	soxr_t resampler;
+	/* Used instead of the above when set */
+	struct polyphase *kernel;
 	const float *in;
 	float *out;
 	uint32_t inframes;
@@ -42,25 +45,126 @@ struct resampler_thread_data {
 struct resampler_data {
 	jack_client_t *fmmod_client;
 	uint32_t osc_samplerate;
+	uint32_t audio_samplerate;
 	soxr_t audio_upsampler_l;
 	soxr_t audio_upsampler_r;
+	soxr_t audio_lpf_upsampler_l;
+	soxr_t audio_lpf_upsampler_r;
+	int audio_lpf_active;
+	/* Pairs left idle, waiting to be reset / primed by
+	 * resampler_prepare_audio(), use __atomic_* to access it */
+	int audio_stale;
+	float *fade_buf_l;
+	float *fade_buf_r;
+	/* The band-limiting pair replaced by resampler_swap_audio_lpf(),
+	 * faded out on the next period if it was in use */
+	soxr_t audio_lpf_retired_l;
+	soxr_t audio_lpf_retired_r;
+	int audio_lpf_retired_kernels;
+	int audio_lpf_fade;
+	/* Polyphase kernels, used instead of the SoXr upsamplers
+	 * above when there's one for the ratio / design in use
+	 * and it's faster (see resampler_pick_kernel()) */
+	struct polyphase audio_kernel_l;
+	struct polyphase audio_kernel_r;
+	struct polyphase audio_lpf_kernel_l;
+	struct polyphase audio_lpf_kernel_r;
+	int use_audio_kernels;
+	int use_audio_lpf_kernels;
+	/* Only the left upsampler is in use (mono) */
+	int audio_mono;
+	/* Frames each audio upsampler consumed / generated since it
+	 * was last primed, per pair ([band_limit][0: L, 1: R]) */
+	uint64_t audio_frames_in[2][2];
+	uint64_t audio_frames_out[2][2];
+	uint32_t audio_ratio_in;
+	uint32_t audio_ratio_out;
+	/* Output frames the right upsampler is ahead of the left
+	 * one after going back to stereo, < 0 if it's behind */
+	int64_t audio_right_lag;
 	int audio_upsampler_bypass;
-	soxr_t rds_upsampler;
 	soxr_t mpx_downsampler;
 	int mpx_downsampler_bypass;
+	/* Same as above, for the MPX downsampler */
+	struct polyphase mpx_kernel;
+	int use_mpx_kernel;
+	/* Fixed-point MPX downsampler, used instead of
+	 * the above when set (see resampler_init_fxp()) */
+	struct polyphase_q15 mpx_fxp_downsampler;
+	int mpx_fxp;
 	int active;
+	float *prime_buf;
+	uint32_t prime_buf_len;
+	uint32_t audio_inframes;
+	uint32_t audio_outframes;
 	struct resampler_thread_data rstd_l;
 	struct resampler_thread_data rstd_r;
 };
 
+/* Passband of the plain audio upsamplers, when there is
+ * a polyphase kernel for them (see polyphase_tool.c) */
+#define RESAMPLER_AUDIO_PASSBAND_END	20000
+
+/* When there is a polyphase kernel for a resampler we time it against
+ * SoXr on init and keep the fastest one, this can be overriden through
+ * the environment variable bellow ("kernel", "soxr" or "auto") */
+#define RESAMPLER_BACKEND_ENV		"JMPXRDS_RESAMPLER_BACKEND"
+#define RESAMPLER_BENCH_RUNS		8
+
+/* Bits of audio_stale, for the plain (0) and the
+ * band-limiting (1) pair of audio upsamplers */
+#define RESAMPLER_AUDIO_PAIR(_band_limit)	(1 << (_band_limit))
+/* Same, for the right upsampler only (left idle in mono) */
+#define RESAMPLER_AUDIO_RIGHT(_band_limit)	(4 << (_band_limit))
+
+/* Used in place of band_limit for the retired band-limiting pair */
+#define RESAMPLER_AUDIO_RETIRED	2
+
+/* Max number of silent periods to feed to each
+ * resampler when priming it (see resampler.c) */
+#define RESAMPLER_PRIME_MAX_PERIODS	32
+
 int resampler_init(struct resampler_data *rsmpl, uint32_t jack_samplerate,
 		jack_client_t *fmmod_client, uint32_t osc_samplerate,
-		uint32_t rds_samplerate, uint32_t output_samplerate);
+		uint32_t output_samplerate,
+		uint32_t audio_passband_end, uint32_t audio_stopband_begin,
+		uint32_t mpx_passband_end, uint32_t mpx_stopband_begin,
+		uint32_t max_inframes);
 int resampler_upsample_audio(struct resampler_data *rsmpl, const float *in_l,
 			     const float *in_r, float *out_l, float *out_r,
-			     uint32_t inframes, uint32_t outframes);
-int resampler_upsample_rds(const struct resampler_data *rsmpl, const float *in, float *out,
-			   uint32_t inframes, uint32_t outframes);
-int resampler_downsample_mpx(const struct resampler_data *rsmpl, const float *in,
+			     uint32_t inframes, uint32_t outframes,
+			     int band_limit);
+int resampler_upsample_audio_mono(struct resampler_data *rsmpl,
+				  const float *in, float *out,
+				  uint32_t inframes, uint32_t outframes,
+				  int band_limit);
+int resampler_downsample_mpx(struct resampler_data *rsmpl, const float *in,
 			     float *out, uint32_t inframes, uint32_t outframes);
+int resampler_downsample_mpx_q14(struct resampler_data *rsmpl,
+				 const int16_t *in, float *out,
+				 uint32_t inframes, uint32_t outframes);
+int resampler_init_fxp(struct resampler_data *rsmpl, uint32_t output_samplerate,
+			uint32_t mpx_passband_end, uint32_t mpx_stopband_begin,
+			uint32_t max_inframes);
+int resampler_prime(struct resampler_data *rsmpl, uint32_t inframes,
+		    uint32_t upsampled_frames, uint32_t outframes);
+int resampler_redesign_audio_lpf(const struct resampler_data *rsmpl,
+				 uint32_t passband_end, uint32_t stopband_begin,
+				 soxr_t *upsampler_l, soxr_t *upsampler_r);
+void resampler_swap_audio_lpf(struct resampler_data *rsmpl,
+			      soxr_t *upsampler_l, soxr_t *upsampler_r);
+int resampler_create_audio_upsampler(const struct resampler_data *rsmpl,
+				     uint32_t passband_end,
+				     uint32_t stopband_begin, soxr_t *upsampler);
+int resampler_upsample_audio_one(const struct resampler_data *rsmpl,
+				 soxr_t upsampler, const float *in, float *out,
+				 uint32_t inframes, uint32_t outframes);
+int resampler_reset_audio_upsampler(const struct resampler_data *rsmpl,
+				    soxr_t upsampler, uint64_t *in_frames,
+				    uint64_t *out_frames);
+int resampler_measure_phase_delay(const struct resampler_data *rsmpl,
+				  soxr_t upsampler, float freq, double *phase);
+void resampler_prepare_audio(struct resampler_data *rsmpl);
+int resampler_audio_stale(const struct resampler_data *rsmpl);
+void resampler_reset_audio(struct resampler_data *rsmpl);
 void resampler_destroy(struct resampler_data *rsmpl);
@@ -66,6 +66,46 @@ function test_fmmod {
 	if [[ $? == 1 ]]; then
 		return 1
 	fi
+	run_config_test fmmod_tool -b 1 -d 3
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -k 1 -x 100
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -o 1
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -u 1
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -w 3
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -q 75000
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -y 1,67000,fm,tone,10,6000
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -y 1,off
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
 	run_config_test fmmod_tool -g
 	if [[ $? == 1 ]]; then
 		return 1
@@ -85,6 +125,11 @@ function test_fmmod {
 		return 1
 	fi
 	sleep 1
+	run_config_test fmmod_tool -s 4
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
 	run_config_test fmmod_tool -e 1
 	if [[ $? == 1 ]]; then
 		return 1
@@ -95,7 +140,12 @@ function test_fmmod {
 		return 1
 	fi
 	sleep 1
-	run_config_test fmmod_tool -a 45 -m 80 -p 4 -r 3 -c 60 -s 0 -f 1 -e 0
+	run_config_test fmmod_tool -f 1 -l 15000 -t 3000
+	if [[ $? == 1 ]]; then
+		return 1
+	fi
+	sleep 1
+	run_config_test fmmod_tool -a 45 -m 80 -p 4 -r 3 -c 60 -s 0 -f 1 -l 16750 -t 2250 -e 0
 	if [[ $? == 1 ]]; then
 		return 1
 	fi
@@ -227,7 +277,8 @@ function test_run {
 
 	pr_info "Starting jmpxrds"
 
-	(${TOP_DIR}/jmpxrds &> ${DAEMON_LOGFILE} &)
+	# One subcarrier, for testing fmmod_tool -y
+	(JMPXRDS_SUBCARRIERS=1 ${TOP_DIR}/jmpxrds &> ${DAEMON_LOGFILE} &)
 
 	while [[ ${COUNT} -gt 0 ]]
 	do
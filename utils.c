@@ -137,6 +137,7 @@ utils_shm_unlink_all()
 	shm_unlink(FMMOD_CTL_SHM_NAME);
 	shm_unlink(RDS_ENC_SHM_NAME);
 	shm_unlink(RTP_SRV_SHM_NAME);
+	shm_unlink(IQ_SINK_SHM_NAME);
 }
 
 
@@ -25,6 +25,7 @@
 #define FMMOD_CTL_SHM_NAME	"/FMMOD_CTL_SHM"
 #define RDS_ENC_SHM_NAME	"/RDS_ENC_SHM"
 #define RTP_SRV_SHM_NAME	"/RTP_SRV_SHM"
+#define IQ_SINK_SHM_NAME	"/IQ_SINK_SHM"
 
 #define likely(x)       __builtin_expect((x),1)
 #define unlikely(x)     __builtin_expect((x),0)
@@ -0,0 +1,195 @@
+/*
+ * JMPXRDS, an FM MPX signal generator with RDS support on
+ * top of Jack Audio Connection Kit - FFTW wisdom generation tool
+ *
+ * Copyright (C) 2015 Nick Kossifidis <mickflemm@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "utils.h"
+#include "fmmod.h"
+#include <stdlib.h>		/* For strtol */
+#include <string.h>		/* For memset */
+#include <math.h>		/* For fmax */
+#include <unistd.h>		/* For getopt() */
+
+/* Common JACK configurations to pre-generate wisdom for */
+static const uint32_t common_rates[] = {44100, 48000, 96000};
+static const uint32_t common_periods[] = {256, 512, 1024, 2048, 4096};
+
+static void
+usage(char *name)
+{
+	utils_ann("FFTW wisdom generation tool for JMPXRDS\n");
+	utils_info("Usage: %s -c or -r <rate> -p <period>\n", name);
+	utils_info("\nParameters:\n"
+		"\t-c\t\tGenerate wisdom for common JACK configurations\n"
+		"\t-r   <int>\tJACK sample rate\n"
+		"\t-p   <int>\tJACK period size (frames)\n"
+		"\nWisdom is stored on $%s if set, else on\n"
+		"$XDG_CACHE_HOME/%s/%s (or ~/.cache/%s/%s)\n",
+		FFT_WISDOM_ENV, FFT_WISDOM_DIR, FFT_WISDOM_FILE,
+		FFT_WISDOM_DIR, FFT_WISDOM_FILE);
+}
+
+/* Same as on fmmod.c */
+static inline int
+num_resampled_samples(int in_srate, int out_srate, int num_samples)
+{
+	double ratio = (double) (out_srate) / (double) (in_srate);
+	double olenf = ratio * ((double) num_samples);
+	/* Also cover the case where out_srate < in_srate */
+	olenf = fmax(olenf, num_samples - olenf);
+	return (int) olenf;
+}
+
+/*
+ * Create the same plans the generator and the GUI would create
+ * for the given JACK configuration, FFTW will remember them.
+ */
+static int
+generate_wisdom(uint32_t jack_samplerate, uint32_t period_size)
+{
+	struct lpf_filter_data lpf;
+	struct hilbert_transformer_data ht;
+	struct fft_plan *plot_plan = NULL;
+	fft_complex *plot_cbuf = NULL;
+	float *plot_rbuf = NULL;
+	uint32_t upsampled_num_samples = 0;
+	uint32_t num_out_samples = 0;
+	int ret = 0;
+
+	upsampled_num_samples = num_resampled_samples(jack_samplerate,
+						      OSC_SAMPLE_RATE,
+						      period_size);
+	num_out_samples = num_resampled_samples(OSC_SAMPLE_RATE,
+						FMMOD_OUTPUT_SAMPLERATE,
+						upsampled_num_samples);
+
+	utils_info("Rate: %u, period: %u (upsampled: %u, output: %u)\n",
+		   jack_samplerate, period_size, upsampled_num_samples,
+		   num_out_samples);
+
+	/* Audio LPF, only used when the audio upsampler is bypassed */
+	if (jack_samplerate == OSC_SAMPLE_RATE) {
+		memset(&lpf, 0, sizeof(struct lpf_filter_data));
+		ret = lpf_filter_init(&lpf, AFLT_CUTOFF_FREQ, jack_samplerate,
+				      period_size, AFLT_LPF_OVERLAP_FACTOR, 2, 0);
+		if (ret < 0) {
+			utils_err("Audio LPF planning failed with code: %i\n",
+				  ret);
+			return -1;
+		}
+		lpf_filter_destroy(&lpf);
+	}
+
+	/* SSB LPF */
+	memset(&lpf, 0, sizeof(struct lpf_filter_data));
+	ret = lpf_filter_init(&lpf, 38000, OSC_SAMPLE_RATE,
+			      upsampled_num_samples, SSB_LPF_OVERLAP_FACTOR, 1, 0);
+	if (ret < 0) {
+		utils_err("SSB LPF planning failed with code: %i\n", ret);
+		return -2;
+	}
+	lpf_filter_destroy(&lpf);
+
+	/* Hilbert transformer */
+	memset(&ht, 0, sizeof(struct hilbert_transformer_data));
+	ret = hilbert_transformer_init(&ht, upsampled_num_samples, 0);
+	if (ret < 0) {
+		utils_err("Hilbert transformer planning failed with code: %i\n",
+			  ret);
+		return -3;
+	}
+	hilbert_transformer_destroy(&ht);
+
+	/* GUI's MPX plotter */
+	plot_rbuf = fft_alloc_real(num_out_samples);
+	plot_cbuf = fft_alloc_complex((num_out_samples / 2) + 1);
+	if (!plot_rbuf || !plot_cbuf) {
+		ret = -4;
+		goto cleanup;
+	}
+
+	plot_plan = fft_plan_r2c(num_out_samples, 1, plot_rbuf, plot_cbuf,
+				 FFT_PLAN_MEASURE);
+	if (!plot_plan) {
+		utils_err("MPX plotter planning failed\n");
+		ret = -5;
+	} else
+		fft_destroy_plan(plot_plan);
+
+ cleanup:
+	if (plot_rbuf)
+		fft_free(plot_rbuf);
+	if (plot_cbuf)
+		fft_free(plot_cbuf);
+	return ret < 0 ? ret : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	uint32_t jack_samplerate = 0;
+	uint32_t period_size = 0;
+	int common = 0;
+	int opt = 0;
+	int ret = 0;
+	int i = 0;
+	int j = 0;
+
+	while ((opt = getopt(argc, argv, "cr:p:")) != -1)
+		switch (opt) {
+		case 'c':
+			common = 1;
+			break;
+		case 'r':
+			jack_samplerate = strtol(optarg, NULL, 10);
+			break;
+		case 'p':
+			period_size = strtol(optarg, NULL, 10);
+			break;
+		default:
+			usage(argv[0]);
+			return -1;
+		}
+
+	if (!common && (!jack_samplerate || !period_size)) {
+		usage(argv[0]);
+		return -1;
+	}
+
+	/* Start from any existing wisdom so that we only
+	 * have to measure what's missing */
+	fft_wisdom_import();
+
+	if (common) {
+		for (i = 0; i < (int) (sizeof(common_rates) / sizeof(uint32_t)); i++)
+			for (j = 0; j < (int) (sizeof(common_periods) / sizeof(uint32_t)); j++) {
+				ret = generate_wisdom(common_rates[i],
+						      common_periods[j]);
+				if (ret < 0)
+					goto done;
+			}
+	}
+
+	if (jack_samplerate && period_size)
+		ret = generate_wisdom(jack_samplerate, period_size);
+
+ done:
+	if (fft_wisdom_export() < 0)
+		ret = -1;
+
+	return ret;
+}